@@ -72,6 +72,12 @@ option(MAYAFLUX_PORTABLE "Build portable binaries with RPATH" OFF)
 option(MAYAFLUX_DEV
        "Build MayaFlux for development with debug symobls, rpath and tests" OFF)
 option(MAYAFLUX_BUILD_PROJECT "Build project_launcher binary" OFF)
+option(MAYAFLUX_AUDIO_F32
+       "Exchange 32-bit float samples with the audio backend by default" OFF)
+
+if(MAYAFLUX_AUDIO_F32)
+    add_compile_definitions(MAYAFLUX_AUDIO_F32)
+endif()
 
 if(MAYAFLUX_CONFIG_OVERRIDE)
     add_compile_definitions(MAYAFLUX_CONFIG_OVERRIDE)
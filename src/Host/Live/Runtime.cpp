@@ -3,6 +3,8 @@
 #include "Lila/Commentator.hpp"
 #include "Lila/Lila.hpp"
 
+#include "MayaFlux/API/Core.hpp"
+#include "MayaFlux/Core/Engine.hpp"
 #include "MayaFlux/Transitive/Memory/Persist.hpp"
 
 #ifdef MAYAFLUX_PLATFORM_WINDOWS
@@ -19,6 +21,48 @@ namespace {
     std::vector<std::string> g_pending_compile_flags;
     std::vector<std::string> g_pending_libraries;
     std::vector<std::string> g_pending_evals;
+
+    // Audio-thread view of g_instance: read without g_mutex, and stop_lila
+    // waits for in-flight commits before destroying the instance.
+    std::atomic<Lila::Lila*> g_committer {};
+    std::atomic<int> g_commits_in_flight {};
+
+    constexpr auto k_commit_hook = "lila_commit";
+    bool g_commit_hook_registered {};
+
+    std::shared_ptr<Core::SubsystemManager> engine_subsystems()
+    {
+        if (!MayaFlux::is_initialized()) {
+            return nullptr;
+        }
+        return MayaFlux::get_context().get_subsystem_manager();
+    }
+
+    void register_commit_hook()
+    {
+        auto subsystems = engine_subsystems();
+        if (!subsystems) {
+            LILA_WARN(Lila::Emitter::SYSTEM,
+                "start_lila: engine not initialized, definitions will commit off the audio thread");
+            return;
+        }
+
+        subsystems->register_process_hook(Core::SubsystemType::AUDIO, k_commit_hook,
+            [](unsigned int) { lila_commit_pending(); }, Core::HookPosition::PRE_PROCESS);
+        g_commit_hook_registered = subsystems->has_process_hook(Core::SubsystemType::AUDIO, k_commit_hook);
+    }
+
+    void unregister_commit_hook()
+    {
+        if (!g_commit_hook_registered) {
+            return;
+        }
+        g_commit_hook_registered = false;
+
+        if (auto subsystems = engine_subsystems()) {
+            subsystems->unregister_process_hook(Core::SubsystemType::AUDIO, k_commit_hook);
+        }
+    }
 }
 
 bool start_lila(uint16_t port)
@@ -57,6 +101,8 @@ bool start_lila(uint16_t port)
 
     g_instance = std::move(instance);
     g_port = port;
+    g_committer.store(g_instance.get());
+    register_commit_hook();
 
     LILA_INFO(Lila::Emitter::SYSTEM,
         "start_lila: running on port " + std::to_string(port));
@@ -74,6 +120,12 @@ void stop_lila(bool clear_persistent_store)
     LILA_INFO(Lila::Emitter::SYSTEM,
         "stop_lila: stopping on port " + std::to_string(g_port));
 
+    unregister_commit_hook();
+    g_committer.store(nullptr);
+    while (g_commits_in_flight.load() != 0) {
+        std::this_thread::yield();
+    }
+
     g_instance->stop_server();
     g_instance.reset();
     g_port = 0;
@@ -84,6 +136,15 @@ void stop_lila(bool clear_persistent_store)
     }
 }
 
+void lila_commit_pending() noexcept
+{
+    g_commits_in_flight.fetch_add(1);
+    if (auto* instance = g_committer.load()) {
+        instance->commit_pending();
+    }
+    g_commits_in_flight.fetch_sub(1);
+}
+
 bool lila_active()
 {
     std::lock_guard<std::mutex> guard(g_mutex);
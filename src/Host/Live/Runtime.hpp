@@ -12,6 +12,10 @@ namespace MayaFlux::Host::Live {
  * Only one Lila instance is permitted per process. Subsequent calls
  * while one is already running return false and log a warning.
  *
+ * When the engine is already initialized, registers lila_commit_pending()
+ * as an audio pre-process hook so compiled definitions are applied at block
+ * boundaries; otherwise they commit from Lila's own thread.
+ *
  * JIT'd code evaluated through this session can call any MayaFlux
  * symbol visible in the process symbol table. Objects constructed
  * with shorter lifetimes than the host should use MayaFlux::store()
@@ -25,8 +29,9 @@ namespace MayaFlux::Host::Live {
 /**
  * @brief Stop the running Lila interpreter and TCP server.
  *
- * Any JIT'd function pointers obtained through this session become
- * invalid after this returns.
+ * Removes the audio pre-process hook installed by start_lila(). Any JIT'd
+ * function pointers obtained through this session become invalid after
+ * this returns.
  *
  * @param clear_persistent_store If true, also empties the persistent
  *        store so objects created during the session are released.
@@ -35,6 +40,20 @@ namespace MayaFlux::Host::Live {
  */
 MAYAFLUX_HOST_API void stop_lila(bool clear_persistent_store = false);
 
+/**
+ * @brief Apply definitions the running Lila session has compiled since the last call.
+ *
+ * Lila compiles on a background thread and stages each result; this swaps
+ * the staged symbol table in and runs any `//@action` bodies. Real-time
+ * safe and a no-op when no session is running.
+ *
+ * start_lila() registers this as the audio pre-process hook "lila_commit"
+ * when the engine is initialized. Call it directly only when driving a
+ * custom processing loop; without any caller, Lila commits from its own
+ * thread as soon as compilation ends.
+ */
+MAYAFLUX_HOST_API void lila_commit_pending() noexcept;
+
 /**
  * @brief True if a Lila instance is currently running in this process.
  */
@@ -1,6 +1,7 @@
 #include "ClangInterpreter.hpp"
 
 #include "Commentator.hpp"
+#include "SnippetCache.hpp"
 
 #include "MayaFlux/Transitive/Platform/HostEnvironment.hpp"
 
@@ -16,8 +17,12 @@
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/TargetParser/Host.h>
 
+#include <clang/AST/DeclCXX.h>
+#include <clang/AST/GlobalDecl.h>
 #include <clang/AST/Type.h>
+#include <clang/Basic/Version.h>
 #include <clang/Frontend/CompilerInstance.h>
+#include <clang/Frontend/FrontendActions.h>
 #include <clang/Interpreter/Interpreter.h>
 
 #ifdef MAYAFLUX_COMPILER_MSVC
@@ -32,8 +37,248 @@
 #include "MayaFlux/Transitive/Parallel/Dispatch.hpp"
 #endif
 
+#include <format>
+#include <fstream>
+
 namespace Lila {
 
+namespace {
+
+    double elapsed_ms(std::chrono::steady_clock::time_point since)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+    }
+
+    /// Headers every session starts with; the snapshot is built from exactly this.
+    constexpr std::string_view PRELUDE_SOURCE = "#include \"pch.h\"\n"
+                                                "#include \"MayaFlux/MayaFlux.hpp\"\n";
+
+    /**
+     * @brief Accumulates "phase 12.3 ms, ..." for the startup summary line.
+     */
+    class PhaseTimer {
+    public:
+        void mark(std::string_view phase)
+        {
+            const auto now = std::chrono::steady_clock::now();
+            m_report += std::format("{}{} {:.1f} ms", m_report.empty() ? "" : ", ", phase,
+                std::chrono::duration<double, std::milli>(now - m_last).count());
+            m_last = now;
+        }
+
+        [[nodiscard]] std::string summary() const
+        {
+            return std::format("{}, total {:.1f} ms", m_report, elapsed_ms(m_start));
+        }
+
+    private:
+        std::chrono::steady_clock::time_point m_start { std::chrono::steady_clock::now() };
+        std::chrono::steady_clock::time_point m_last { m_start };
+        std::string m_report;
+    };
+
+    /**
+     * @brief Per-user cache location, following each platform's convention.
+     */
+    std::filesystem::path default_cache_directory()
+    {
+        const auto env = [](const char* name) -> std::filesystem::path {
+            const char* value = std::getenv(name);
+            return value && *value ? std::filesystem::path(value) : std::filesystem::path {};
+        };
+
+#if defined(MAYAFLUX_PLATFORM_WINDOWS)
+        auto base = env("LOCALAPPDATA");
+#elif defined(MAYAFLUX_PLATFORM_MACOS)
+        auto base = env("HOME");
+        if (!base.empty()) {
+            base /= "Library/Caches";
+        }
+#else
+        auto base = env("XDG_CACHE_HOME");
+        if (base.empty() && !(base = env("HOME")).empty()) {
+            base /= ".cache";
+        }
+#endif
+        return base.empty() ? std::filesystem::path {} : base / "MayaFlux" / "lila";
+    }
+
+    /**
+     * @brief Name of the snapshot for one compiler and flag set.
+     *
+     * Snapshots are only loadable by the exact clang that wrote them and
+     * with compatible options, so both go into the name. Header edits are
+     * caught by clang's own input validation when the snapshot is loaded.
+     */
+    std::string snapshot_name(const std::vector<std::string>& flags)
+    {
+        uint64_t hash = 0xCBF29CE484222325ULL;
+        const auto feed = [&hash](std::string_view text) {
+            for (const char c : text) {
+                hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001B3ULL;
+            }
+            hash = (hash ^ 0xFF) * 0x100000001B3ULL;
+        };
+
+        feed(clang::getClangFullVersion());
+        feed(PRELUDE_SOURCE);
+        for (const auto& flag : flags) {
+            feed(flag);
+        }
+
+        return std::format("prelude-{:016x}.pch", hash);
+    }
+
+    /**
+     * @brief Build a compiler instance from driver-style flags.
+     */
+    llvm::Expected<std::unique_ptr<clang::CompilerInstance>> make_compiler(const std::vector<std::string>& flags)
+    {
+        std::vector<const char*> args;
+        args.reserve(flags.size());
+        for (const auto& flag : flags) {
+            args.push_back(flag.c_str());
+        }
+
+        clang::IncrementalCompilerBuilder builder;
+        builder.SetCompilerArgs(args);
+        return builder.CreateCpp();
+    }
+
+    /**
+     * @brief Serialise the parsed prelude to @p output.
+     *
+     * Uses the same incremental compiler setup as the interpreter so the
+     * language options match when the snapshot is loaded. Writes beside the
+     * target and renames, so a concurrent reader never sees a partial file.
+     */
+    bool write_snapshot(const std::vector<std::string>& flags, const std::filesystem::path& header,
+        const std::filesystem::path& output, std::string& error)
+    {
+        auto compiler = make_compiler(flags);
+        if (!compiler) {
+            error = llvm::toString(compiler.takeError());
+            return false;
+        }
+
+        auto temp = output;
+        temp += std::format(".{}.tmp", std::hash<std::thread::id> {}(std::this_thread::get_id()));
+
+        auto& frontend = (*compiler)->getFrontendOpts();
+        frontend.Inputs.clear();
+        frontend.Inputs.emplace_back(header.string(),
+            clang::InputKind(clang::Language::CXX, clang::InputKind::Source, false,
+                clang::InputKind::HeaderUnit_None, true));
+        frontend.OutputFile = temp.string();
+        frontend.ProgramAction = clang::frontend::GeneratePCH;
+
+        clang::GeneratePCHAction action;
+        if (!(*compiler)->ExecuteAction(action)) {
+            error = "clang reported errors while parsing the prelude";
+            std::error_code ec;
+            std::filesystem::remove(temp, ec);
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(temp, output, ec);
+        if (ec) {
+            error = "could not move snapshot into place: " + ec.message();
+            std::filesystem::remove(temp, ec);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Collect free functions and globals emitted by one partial translation unit.
+     *
+     * Descends into namespaces and extern "C" blocks. Templates, inline
+     * functions that were never emitted and anything else the JIT cannot
+     * resolve are skipped.
+     */
+    void collect_symbols(const clang::DeclContext* context, const clang::Interpreter& interpreter,
+        std::vector<std::pair<std::string, void*>>& out)
+    {
+        for (const auto* decl : context->decls()) {
+            if (const auto* nested = llvm::dyn_cast<clang::LinkageSpecDecl>(decl)) {
+                collect_symbols(nested, interpreter, out);
+                continue;
+            }
+            if (const auto* nested = llvm::dyn_cast<clang::NamespaceDecl>(decl)) {
+                collect_symbols(nested, interpreter, out);
+                continue;
+            }
+
+            std::optional<clang::GlobalDecl> global;
+
+            if (const auto* fn = llvm::dyn_cast<clang::FunctionDecl>(decl)) {
+                if (fn->doesThisDeclarationHaveABody() && !fn->isDependentContext()
+                    && !llvm::isa<clang::CXXMethodDecl>(fn)
+                    && fn->getTemplatedKind() == clang::FunctionDecl::TK_NonTemplate) {
+                    global = clang::GlobalDecl(fn);
+                }
+            } else if (const auto* var = llvm::dyn_cast<clang::VarDecl>(decl)) {
+                if (var->hasGlobalStorage() && !var->isStaticLocal() && !var->getDescribedVarTemplate()) {
+                    global = clang::GlobalDecl(var);
+                }
+            }
+
+            if (!global) {
+                continue;
+            }
+
+            auto address = interpreter.getSymbolAddress(*global);
+            if (!address) {
+                llvm::consumeError(address.takeError());
+                continue;
+            }
+
+            out.emplace_back(llvm::cast<clang::NamedDecl>(decl)->getQualifiedNameAsString(),
+                reinterpret_cast<void*>(address->getValue()));
+        }
+    }
+
+    /**
+     * @brief Whether a partial translation unit held definitions, statements or both.
+     */
+    SnippetCache::Kind classify(const clang::DeclContext* context)
+    {
+        bool statements = false;
+        bool declarations = false;
+
+        for (const auto* decl : context->decls()) {
+            if (llvm::isa<clang::TopLevelStmtDecl>(decl)) {
+                statements = true;
+            } else {
+                declarations = true;
+            }
+        }
+
+        if (statements != declarations) {
+            return statements ? SnippetCache::Kind::Statements : SnippetCache::Kind::Declarations;
+        }
+        return SnippetCache::Kind::Mixed;
+    }
+
+    /**
+     * @brief Run interpreter work where JIT'd code expects to run.
+     *
+     * On macOS that is the main queue (GLFW and friends); elsewhere the caller.
+     */
+    void on_jit_thread(const std::function<void()>& work)
+    {
+#ifdef MAYAFLUX_PLATFORM_MACOS
+        dispatch_sync(dispatch_get_main_queue(), ^{
+            work();
+        });
+#else
+        work();
+#endif
+    }
+
+} // namespace
+
 struct ClangInterpreter::Impl {
     std::unique_ptr<clang::Interpreter> interpreter;
 
@@ -43,6 +288,11 @@ struct ClangInterpreter::Impl {
 
     std::unordered_map<std::string, void*> symbol_table;
     int eval_counter = 0;
+
+    SnippetCache snippets;
+
+    std::filesystem::path cache_directory { default_cache_directory() };
+    std::thread snapshot_builder; ///< Writes the prelude snapshot after a cold start
 };
 
 ClangInterpreter::ClangInterpreter()
@@ -62,6 +312,7 @@ ClangInterpreter& ClangInterpreter::operator=(ClangInterpreter&&) noexcept = def
 bool ClangInterpreter::initialize(bool skip_host_library_load)
 {
     LILA_INFO(Emitter::INTERPRETER, "Initializing Clang interpreter");
+    PhaseTimer timer;
 
 #ifdef MAYAFLUX_PLATFORM_WINDOWS
     llvm::sys::DynamicLibrary::LoadLibraryPermanently("msvcp140.dll");
@@ -72,7 +323,81 @@ bool ClangInterpreter::initialize(bool skip_host_library_load)
     llvm::InitializeNativeTarget();
     llvm::InitializeNativeTargetAsmPrinter();
     llvm::InitializeNativeTargetAsmParser();
+    timer.mark("targets");
+
+    if (!configure_compile_flags()) {
+        return false;
+    }
+    timer.mark("flags");
+
+    const auto snapshot = snapshot_path();
+    bool warm = !snapshot.empty() && std::filesystem::exists(snapshot);
 
+    if (warm && !create_interpreter(snapshot)) {
+        LILA_WARN(Emitter::INTERPRETER, "Prelude snapshot unusable, discarding it: " + m_last_error);
+        discard_snapshot(snapshot);
+        warm = false;
+    }
+    if (!warm && !create_interpreter({})) {
+        return false;
+    }
+    timer.mark(warm ? "interpreter (snapshot)" : "interpreter");
+    m_impl->snippets.invalidate("new interpreter");
+
+    LILA_INFO(Emitter::INTERPRETER, "Clang interpreter created successfully");
+
+    if (skip_host_library_load) {
+        LILA_DEBUG(Emitter::INTERPRETER,
+            "Skipping MayaFluxLib load: host process already resident");
+    } else {
+        const auto& lib_to_load = MayaFlux::Platform::SystemConfig::find_dep_library(
+            "MayaFluxLib", std::string(MayaFlux::Config::INSTALL_PREFIX));
+
+        LILA_DEBUG(Emitter::INTERPRETER, "Loading MayaFlux library: " + lib_to_load);
+
+        if (auto err = m_impl->interpreter->LoadDynamicLibrary(lib_to_load.c_str())) {
+            m_last_error = "Failed to load " + lib_to_load + ": "
+                + llvm::toString(std::move(err));
+            LILA_ERROR(Emitter::INTERPRETER, m_last_error);
+            return false;
+        }
+
+        LILA_DEBUG(Emitter::INTERPRETER, "Loaded " + lib_to_load);
+    }
+    timer.mark("host library");
+
+    // With a snapshot the prelude declarations are already in the AST and
+    // are deserialised as code first names them, so only the readiness
+    // probe below runs here.
+    if (!warm) {
+        auto result = m_impl->interpreter->ParseAndExecute(std::string(PRELUDE_SOURCE));
+
+        if (result) {
+            std::string warning = "Failed to load MayaFlux headers: " + llvm::toString(std::move(result));
+            LILA_WARN(Emitter::INTERPRETER, warning);
+        } else {
+            LILA_INFO(Emitter::INTERPRETER, "MayaFlux headers loaded successfully");
+            schedule_snapshot(snapshot);
+        }
+    }
+
+    auto ready = m_impl->interpreter->ParseAndExecute("std::cout << \"Ready for Live\" << std::flush;");
+    if (ready && warm) {
+        llvm::consumeError(std::move(ready));
+        LILA_WARN(Emitter::INTERPRETER, "Prelude snapshot failed its readiness probe, starting cold");
+        discard_snapshot(snapshot);
+        shutdown();
+        return initialize(skip_host_library_load);
+    }
+    llvm::consumeError(std::move(ready));
+    timer.mark(warm ? "prelude (snapshot)" : "prelude");
+
+    LILA_INFO(Emitter::INTERPRETER, "Startup: " + timer.summary());
+    return true;
+}
+
+bool ClangInterpreter::configure_compile_flags()
+{
     m_impl->compile_flags.clear();
     m_impl->compile_flags.emplace_back("-std=c++23");
     m_impl->compile_flags.emplace_back("-DMAYASIMPLE");
@@ -174,15 +499,18 @@ bool ClangInterpreter::initialize(bool skip_host_library_load)
     m_impl->compile_flags.emplace_back("-D_CRT_SECURE_NO_WARNINGS");
 #endif
 
-    std::vector<const char*> args;
-    for (const auto& flag : m_impl->compile_flags) {
-        args.push_back(flag.c_str());
-    }
+    return true;
+}
 
-    clang::IncrementalCompilerBuilder ICB;
-    ICB.SetCompilerArgs(args);
+bool ClangInterpreter::create_interpreter(const std::filesystem::path& snapshot)
+{
+    auto flags = m_impl->compile_flags;
+    if (!snapshot.empty()) {
+        flags.emplace_back("-include-pch");
+        flags.push_back(snapshot.string());
+    }
 
-    auto CI = ICB.CreateCpp();
+    auto CI = make_compiler(flags);
     if (!CI) {
         m_last_error = "Failed to create CompilerInstance: " + llvm::toString(CI.takeError());
         LILA_ERROR(Emitter::INTERPRETER, m_last_error);
@@ -197,52 +525,197 @@ bool ClangInterpreter::initialize(bool skip_host_library_load)
     }
 
     m_impl->interpreter = std::move(*interp);
+    return true;
+}
 
-    LILA_INFO(Emitter::INTERPRETER, "Clang interpreter created successfully");
+// ---------------------------------------------------------------------------
+// Prelude snapshot
+// ---------------------------------------------------------------------------
 
-    if (skip_host_library_load) {
-        LILA_DEBUG(Emitter::INTERPRETER,
-            "Skipping MayaFluxLib load: host process already resident");
-    } else {
-        const auto& lib_to_load = MayaFlux::Platform::SystemConfig::find_dep_library(
-            "MayaFluxLib", std::string(MayaFlux::Config::INSTALL_PREFIX));
+std::filesystem::path ClangInterpreter::snapshot_path() const
+{
+    if (m_impl->cache_directory.empty()) {
+        return {};
+    }
+    return m_impl->cache_directory / snapshot_name(m_impl->compile_flags);
+}
 
-        LILA_DEBUG(Emitter::INTERPRETER, "Loading MayaFlux library: " + lib_to_load);
+void ClangInterpreter::discard_snapshot(const std::filesystem::path& snapshot)
+{
+    std::error_code ec;
+    std::filesystem::remove(snapshot, ec);
 
-        if (auto err = m_impl->interpreter->LoadDynamicLibrary(lib_to_load.c_str())) {
-            m_last_error = "Failed to load " + lib_to_load + ": "
-                + llvm::toString(std::move(err));
-            LILA_ERROR(Emitter::INTERPRETER, m_last_error);
-            return false;
+    if (std::filesystem::exists(snapshot, ec)) {
+        LILA_WARN(Emitter::INTERPRETER, "Cannot remove stale snapshot, disabling the cache: " + snapshot.string());
+        m_impl->cache_directory.clear();
+    }
+}
+
+void ClangInterpreter::schedule_snapshot(const std::filesystem::path& snapshot)
+{
+    if (snapshot.empty() || m_impl->snapshot_builder.joinable()) {
+        return;
+    }
+
+    m_impl->snapshot_builder = std::thread([flags = m_impl->compile_flags, snapshot] {
+        const auto start = std::chrono::steady_clock::now();
+        std::string error;
+
+        std::error_code ec;
+        std::filesystem::create_directories(snapshot.parent_path(), ec);
+
+        // Rewritten only when it changes: the snapshot records its mtime.
+        const auto header = snapshot.parent_path() / "prelude.hpp";
+        std::ifstream existing(header, std::ios::binary);
+        const std::string current { std::istreambuf_iterator<char>(existing), std::istreambuf_iterator<char>() };
+        existing.close();
+        if (current != PRELUDE_SOURCE) {
+            std::ofstream(header, std::ios::binary | std::ios::trunc) << PRELUDE_SOURCE;
         }
 
-        LILA_DEBUG(Emitter::INTERPRETER, "Loaded " + lib_to_load);
+        if (write_snapshot(flags, header, snapshot, error)) {
+            LILA_INFO(Emitter::INTERPRETER,
+                std::format("Prelude snapshot written in {:.1f} ms: {}", elapsed_ms(start), snapshot.string()));
+        } else {
+            LILA_WARN(Emitter::INTERPRETER, "Could not write prelude snapshot: " + error);
+        }
+    });
+}
+
+bool ClangInterpreter::build_prelude_snapshot()
+{
+    llvm::InitializeNativeTarget();
+    llvm::InitializeNativeTargetAsmPrinter();
+    llvm::InitializeNativeTargetAsmParser();
+
+    if (!configure_compile_flags()) {
+        return false;
     }
 
-    const char* header_include = "#include \"pch.h\"\n"
-                                 "#include \"MayaFlux/MayaFlux.hpp\"\n";
+    const auto snapshot = snapshot_path();
+    if (snapshot.empty()) {
+        m_last_error = "No cache directory for the prelude snapshot";
+        LILA_ERROR(Emitter::INTERPRETER, m_last_error);
+        return false;
+    }
 
-    auto result = m_impl->interpreter->ParseAndExecute(header_include);
+    discard_snapshot(snapshot);
+    schedule_snapshot(snapshot);
+    m_impl->snapshot_builder.join();
 
-    if (result) {
-        std::string warning = "Failed to load MayaFlux headers: " + llvm::toString(std::move(result));
-        LILA_WARN(Emitter::INTERPRETER, warning);
-    } else {
-        LILA_INFO(Emitter::INTERPRETER, "MayaFlux headers loaded successfully");
+    if (!std::filesystem::exists(snapshot)) {
+        m_last_error = "Prelude snapshot was not written";
+        return false;
+    }
+    return true;
+}
+
+void ClangInterpreter::set_cache_directory(const std::filesystem::path& directory)
+{
+    m_impl->cache_directory = directory;
+    LILA_DEBUG(Emitter::INTERPRETER,
+        directory.empty() ? std::string("Prelude snapshot disabled") : "Prelude snapshot directory: " + directory.string());
+}
+
+std::filesystem::path ClangInterpreter::get_cache_directory() const
+{
+    return m_impl->cache_directory;
+}
+
+SnippetCache::Kind ClangInterpreter::run_parse_and_execute(const std::string& code, EvalResult& result, bool report_errors)
+{
+    const auto parse_start = std::chrono::steady_clock::now();
+
+    auto ptu = m_impl->interpreter->Parse(code);
+    result.parse_ms = elapsed_ms(parse_start);
+
+    if (!ptu) {
+        result.success = false;
+        result.error = "Execution failed: " + llvm::toString(ptu.takeError());
+        if (report_errors) {
+            LILA_ERROR(Emitter::INTERPRETER, result.error);
+        }
+        return SnippetCache::Kind::Mixed;
     }
 
-    result = m_impl->interpreter->ParseAndExecute("std::cout << \"Ready for Live\" << std::flush;");
+    if (ptu->TheModule) {
+        const auto execute_start = std::chrono::steady_clock::now();
+        auto exec_error = m_impl->interpreter->Execute(*ptu);
+        result.execute_ms = elapsed_ms(execute_start);
 
+        if (exec_error) {
+            result.success = false;
+            result.error = "Execution failed: " + llvm::toString(std::move(exec_error));
+            if (report_errors) {
+                LILA_ERROR(Emitter::INTERPRETER, result.error);
+            }
+            return SnippetCache::Kind::Mixed;
+        }
+    }
+
+    auto kind = SnippetCache::Kind::Mixed;
+    if (ptu->TUPart) {
+        collect_symbols(ptu->TUPart, *m_impl->interpreter, result.symbols);
+        kind = classify(ptu->TUPart);
+    }
+
+    result.success = true;
+    LILA_DEBUG(Emitter::INTERPRETER, "Code evaluation succeeded");
+    return kind;
+}
+
+bool ClangInterpreter::serve_cached(const std::string& normalized, SnippetCache::Entry& entry, EvalResult& result)
+{
+    if (entry.kind == SnippetCache::Kind::Declarations) {
+        result.symbols = entry.symbols;
+        result.success = true;
+        result.cached = true;
+        result.noop = true;
+        result.output = "Definitions already linked; nothing was compiled or re-run";
+        LILA_INFO(Emitter::INTERPRETER, "Snippet cache hit: " + result.output);
+        return true;
+    }
+
+    if (entry.kind != SnippetCache::Kind::Statements) {
+        return false;
+    }
+
+    // The first repeat compiles the statements once more, as a function;
+    // every repeat after that only calls it.
+    if (!entry.replay) {
+        const auto name = std::format("__lila_replay_{}_{}",
+            SnippetCache::digest(normalized), m_impl->snippets.generation());
+
+        EvalResult compiled;
+        on_jit_thread([&] {
+            run_parse_and_execute(std::format("extern \"C\" void {}() {{\n{}\n}}\n", name, normalized), compiled, false);
+        });
+
+        const auto it = std::ranges::find(compiled.symbols, name, &std::pair<std::string, void*>::first);
+        if (!compiled.success || it == compiled.symbols.end()) {
+            LILA_DEBUG(Emitter::INTERPRETER, "Snippet cannot be replayed as a function, recompiling it each time");
+            entry.kind = SnippetCache::Kind::Mixed;
+            return false;
+        }
+
+        entry.replay = reinterpret_cast<void (*)()>(it->second);
+        result.parse_ms = compiled.parse_ms;
+        result.execute_ms = compiled.execute_ms;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    on_jit_thread([replay = entry.replay] { replay(); });
+    result.execute_ms += elapsed_ms(start);
+
+    result.success = true;
+    result.cached = true;
+    LILA_DEBUG(Emitter::INTERPRETER, "Snippet cache hit: replayed statements");
     return true;
 }
 
 ClangInterpreter::EvalResult ClangInterpreter::eval(const std::string& code)
 {
-#ifdef MAYAFLUX_PLATFORM_MACOS
-    __block EvalResult result;
-#else
     EvalResult result;
-#endif
 
     if (!m_impl->interpreter) {
         result.error = "Interpreter not initialized";
@@ -250,34 +723,25 @@ ClangInterpreter::EvalResult ClangInterpreter::eval(const std::string& code)
         return result;
     }
 
-    LILA_DEBUG(Emitter::INTERPRETER, "Evaluating code...");
+    const auto normalized = SnippetCache::normalize(code);
 
-#ifdef MAYAFLUX_PLATFORM_MACOS
-    dispatch_sync(dispatch_get_main_queue(), ^{
-        auto eval_result = m_impl->interpreter->ParseAndExecute(code);
+    if (auto* entry = m_impl->snippets.find(normalized); entry && serve_cached(normalized, *entry, result)) {
+        m_impl->eval_counter++;
+        return result;
+    }
 
-        if (!eval_result) {
-            result.success = true;
-            LILA_DEBUG(Emitter::INTERPRETER, "Code evaluation succeeded");
-        } else {
-            result.success = false;
-            result.error = "Execution failed: " + llvm::toString(std::move(eval_result));
-            LILA_ERROR(Emitter::INTERPRETER, result.error);
-        }
-    });
+    LILA_DEBUG(Emitter::INTERPRETER, "Evaluating code...");
 
-#else
-    auto eval_result = m_impl->interpreter->ParseAndExecute(code);
+    auto kind = SnippetCache::Kind::Mixed;
+    on_jit_thread([&] { kind = run_parse_and_execute(code, result); });
 
-    if (!eval_result) {
-        result.success = true;
-        LILA_DEBUG(Emitter::INTERPRETER, "Code evaluation succeeded");
-    } else {
-        result.success = false;
-        result.error = "Execution failed: " + llvm::toString(std::move(eval_result));
-        LILA_ERROR(Emitter::INTERPRETER, result.error);
+    if (result.success && kind != SnippetCache::Kind::Mixed) {
+        m_impl->snippets.store(normalized, { .kind = kind, .symbols = result.symbols });
+    }
+
+    for (const auto& [name, address] : result.symbols) {
+        m_impl->symbol_table[name] = address;
     }
-#endif
 
     m_impl->eval_counter++;
     return result;
@@ -329,6 +793,7 @@ void ClangInterpreter::add_include_path(const std::string& path)
 {
     if (std::filesystem::exists(path)) {
         m_impl->include_paths.push_back(path);
+        m_impl->snippets.invalidate("include path added");
         LILA_DEBUG(Emitter::INTERPRETER, std::string("Added include path: ") + path);
     } else {
         LILA_WARN(Emitter::INTERPRETER,
@@ -348,12 +813,14 @@ void ClangInterpreter::load_library(const std::string& path)
         LILA_ERROR(Emitter::INTERPRETER, m_last_error);
         return;
     }
+    m_impl->snippets.invalidate("library loaded");
     LILA_DEBUG(Emitter::INTERPRETER, std::string("Loaded library: ") + path);
 }
 
 void ClangInterpreter::add_compile_flag(const std::string& flag)
 {
     m_impl->compile_flags.push_back(flag);
+    m_impl->snippets.invalidate("compile flag added");
     LILA_DEBUG(Emitter::INTERPRETER, std::string("Added compile flag: ") + flag);
 }
 
@@ -363,6 +830,16 @@ void ClangInterpreter::set_target_triple(const std::string& triple)
     LILA_INFO(Emitter::INTERPRETER, std::string("Target triple set to: ") + triple);
 }
 
+SnippetCache::Stats ClangInterpreter::snippet_cache_stats() const
+{
+    return m_impl->snippets.stats();
+}
+
+uint64_t ClangInterpreter::snippet_cache_generation() const
+{
+    return m_impl->snippets.generation();
+}
+
 void ClangInterpreter::reset()
 {
     LILA_INFO(Emitter::INTERPRETER, "Resetting interpreter");
@@ -372,6 +849,14 @@ void ClangInterpreter::reset()
 
 void ClangInterpreter::shutdown()
 {
+    if (!m_impl) {
+        return;
+    }
+
+    if (m_impl->snapshot_builder.joinable()) {
+        m_impl->snapshot_builder.join();
+    }
+
     if (m_impl->interpreter) {
         LILA_INFO(Emitter::INTERPRETER, "Shutting down interpreter");
         m_impl->interpreter.reset();
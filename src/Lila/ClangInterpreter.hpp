@@ -1,5 +1,7 @@
 #pragma once
 
+#include "SnippetCache.hpp"
+
 namespace clang {
 class Interpreter;
 class CompilerInstance;
@@ -57,9 +59,39 @@ public:
      *        loaded MayaFluxLib (attach scenario). Pass false for
      *        standalone use (lila_server).
      * @return true on success.
+     *
+     * Parsing the MayaFlux headers dominates a cold start. After the first
+     * cold start the parsed headers are written to a prelude snapshot (a
+     * precompiled header built with the interpreter's own options) in the
+     * cache directory, on a background thread. Later starts load the
+     * snapshot instead, and declarations are deserialised only when code
+     * first uses them. A snapshot that no longer matches the headers or the
+     * compiler is discarded and the start falls back to parsing.
+     *
+     * Per-phase timings are logged at INFO level.
      */
     bool initialize(bool skip_host_library_load = false);
 
+    /**
+     * @brief Build the prelude snapshot now, blocking, without an interpreter.
+     *
+     * For install steps and CI, so even the first interactive start is warm.
+     * Uses the include paths and flags configured so far.
+     * @return true if the snapshot was written.
+     */
+    bool build_prelude_snapshot();
+
+    /**
+     * @brief Directory holding the prelude snapshot; empty disables it.
+     *
+     * Defaults to MayaFlux/lila under the per-user cache directory
+     * (XDG_CACHE_HOME, ~/Library/Caches or LOCALAPPDATA). Takes effect at the
+     * next initialize().
+     */
+    void set_cache_directory(const std::filesystem::path& directory);
+
+    [[nodiscard]] std::filesystem::path get_cache_directory() const;
+
     /**
      * @brief Shuts down the interpreter and releases resources
      */
@@ -76,12 +108,32 @@ public:
         std::string output; ///< Output from code execution
         std::string error; ///< Error message if evaluation failed
         void* symbol_address = nullptr; ///< Address of defined symbol (if applicable)
+
+        double parse_ms = 0.0; ///< Clang frontend and IR generation
+        double execute_ms = 0.0; ///< JIT code generation and top-level statements
+        bool cached = false; ///< Served from the snippet cache without a full compile
+        bool noop = false; ///< Definitions were already linked; nothing compiled or ran
+
+        /// Functions and globals with linkage defined by this snippet, with their addresses
+        std::vector<std::pair<std::string, void*>> symbols;
     };
 
     /**
      * @brief Evaluates a code snippet
      * @param code C++ code to execute
      * @return EvalResult containing success, output, and error info
+     *
+     * Parses, then executes. Not thread-safe: every call into one
+     * interpreter must come from the same thread at a time (Lila routes
+     * them all through its EvalPipeline worker).
+     *
+     * Repeats are served from a SnippetCache keyed on the normalized text.
+     * A snippet of definitions that is already linked returns its symbols
+     * without compiling or re-running initializers, and is reported as a
+     * no-op rather than as a fresh definition. A snippet of statements is compiled once more as
+     * a function on its first repeat, and later repeats just call that
+     * function. Snippets mixing both always compile. add_include_path(),
+     * add_compile_flag(), load_library() and initialize() clear the cache.
      */
     EvalResult eval(const std::string& code);
 
@@ -129,6 +181,11 @@ public:
      */
     void set_target_triple(const std::string& triple);
 
+    [[nodiscard]] SnippetCache::Stats snippet_cache_stats() const;
+
+    /// @brief Bumped whenever the snippet cache is invalidated; use in generated names.
+    [[nodiscard]] uint64_t snippet_cache_generation() const;
+
     /**
      * @brief Resets the interpreter, clearing all state
      */
@@ -146,9 +203,15 @@ private:
     std::string m_last_error;
 
     bool setup_compiler_instance();
-    bool create_interpreter();
+    bool configure_compile_flags();
+    bool create_interpreter(const std::filesystem::path& snapshot);
+    [[nodiscard]] std::filesystem::path snapshot_path() const;
+    void schedule_snapshot(const std::filesystem::path& snapshot);
+    void discard_snapshot(const std::filesystem::path& snapshot);
     std::string preprocess_code(const std::string& code);
     void extract_symbols_from_code(const std::string& code);
+    SnippetCache::Kind run_parse_and_execute(const std::string& code, EvalResult& result, bool report_errors = true);
+    bool serve_cached(const std::string& normalized, SnippetCache::Entry& entry, EvalResult& result);
     void detect_system_includes();
 };
 
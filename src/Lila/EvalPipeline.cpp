@@ -0,0 +1,389 @@
+#include "EvalPipeline.hpp"
+
+#include "ClangInterpreter.hpp"
+
+#include "Commentator.hpp"
+
+#include <format>
+
+namespace Lila {
+
+namespace {
+
+    constexpr auto COMMIT_TIMEOUT = std::chrono::seconds(2);
+    constexpr auto COMMIT_POLL = std::chrono::microseconds(100);
+
+    double ms_between(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+    {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    }
+
+    int64_t now_ns() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    /**
+     * Wrap an action body in a named C function so it can be compiled now
+     * and called later. Exceptions must not unwind into the audio thread.
+     */
+    std::string wrap_action(const std::string& name, const std::string& body)
+    {
+        return std::format("extern \"C\" void {}() {{\ntry {{\n{}\n}} catch (...) {{}}\n}}\n", name, body);
+    }
+
+} // namespace
+
+EvalPipeline::EvalPipeline(ClangInterpreter& interpreter)
+    : m_interpreter(interpreter)
+{
+    m_tables.push_back(std::make_unique<const SymbolTable>());
+    m_symbols.store(m_tables.back().get(), std::memory_order_release);
+}
+
+EvalPipeline::~EvalPipeline()
+{
+    stop();
+}
+
+void EvalPipeline::start()
+{
+    if (m_running.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    m_stopping.store(false, std::memory_order_release);
+    m_worker = std::thread([this] { worker_loop(); });
+    m_worker_id = m_worker.get_id();
+    m_running.store(true, std::memory_order_release);
+
+    LILA_DEBUG(Emitter::INTERPRETER, "Evaluation pipeline started");
+}
+
+void EvalPipeline::stop()
+{
+    {
+        std::lock_guard lock(m_queue_mutex);
+        if (!m_running.load(std::memory_order_acquire) || m_stopping.load(std::memory_order_acquire)) {
+            return;
+        }
+        m_stopping.store(true, std::memory_order_release);
+    }
+    m_queue_cv.notify_all();
+
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+
+    m_worker_id = {};
+    m_running.store(false, std::memory_order_release);
+
+    LILA_DEBUG(Emitter::INTERPRETER, "Evaluation pipeline stopped");
+}
+
+// ---------------------------------------------------------------------------
+// Submission
+// ---------------------------------------------------------------------------
+
+bool EvalPipeline::enqueue(std::function<void()> task)
+{
+    {
+        std::lock_guard lock(m_queue_mutex);
+        if (!m_running.load(std::memory_order_acquire) || m_stopping.load(std::memory_order_acquire)) {
+            return false;
+        }
+        m_queue.push_back(std::move(task));
+    }
+    m_queue_cv.notify_one();
+    return true;
+}
+
+uint64_t EvalPipeline::submit(std::string code, EvalMode mode, EvalCallback on_done)
+{
+    const auto submitted = Clock::now();
+
+    std::lock_guard lock(m_queue_mutex);
+    if (!m_running.load(std::memory_order_acquire) || m_stopping.load(std::memory_order_acquire)) {
+        return 0;
+    }
+
+    const uint64_t sequence = m_next_sequence++;
+    m_queue.emplace_back([this, code = std::move(code), mode, sequence, submitted, on_done = std::move(on_done)] {
+        compile(code, mode, sequence, submitted, on_done);
+    });
+    m_queue_cv.notify_one();
+
+    return sequence;
+}
+
+EvalReport EvalPipeline::eval(std::string code, EvalMode mode)
+{
+    if (std::this_thread::get_id() == m_worker_id) {
+        EvalReport report;
+        report.error = "eval() called from the evaluation worker would deadlock";
+        LILA_ERROR(Emitter::INTERPRETER, report.error);
+        return report;
+    }
+
+    auto promise = std::make_shared<std::promise<EvalReport>>();
+    auto future = promise->get_future();
+
+    if (submit(std::move(code), mode, [promise](const EvalReport& report) { promise->set_value(report); }) == 0) {
+        EvalReport report;
+        report.error = "Evaluation pipeline is not running";
+        return report;
+    }
+
+    return future.get();
+}
+
+void EvalPipeline::run(const std::function<void()>& task)
+{
+    if (std::this_thread::get_id() == m_worker_id || !m_running.load(std::memory_order_acquire)) {
+        task();
+        return;
+    }
+
+    std::promise<void> done;
+    auto future = done.get_future();
+
+    if (!enqueue([&task, &done] {
+            task();
+            done.set_value();
+        })) {
+        task();
+        return;
+    }
+
+    future.wait();
+}
+
+// ---------------------------------------------------------------------------
+// Worker
+// ---------------------------------------------------------------------------
+
+void EvalPipeline::worker_loop()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock lock(m_queue_mutex);
+            m_queue_cv.wait(lock, [this] {
+                return !m_queue.empty() || m_stopping.load(std::memory_order_acquire);
+            });
+
+            if (m_queue.empty()) {
+                return;
+            }
+
+            task = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        task();
+    }
+}
+
+void EvalPipeline::compile(const std::string& code, EvalMode mode, uint64_t sequence,
+    Clock::time_point submitted, const EvalCallback& on_done)
+{
+    EvalReport report;
+    report.sequence = sequence;
+    report.queued_ms = ms_between(submitted, Clock::now());
+
+    auto finish = [&] {
+        if (!report.success) {
+            LILA_WARN(Emitter::INTERPRETER, std::format("Evaluation #{} failed: {}", sequence, report.error));
+        }
+        if (on_done) {
+            on_done(report);
+        }
+    };
+
+    if (m_stopping.load(std::memory_order_acquire)) {
+        report.error = "Evaluation pipeline stopped before this snippet compiled";
+        finish();
+        return;
+    }
+
+    // Named by content so an identical action is served from the snippet cache.
+    const std::string action_name = std::format("__lila_action_{}_{}",
+        SnippetCache::digest(SnippetCache::normalize(code)), m_interpreter.snippet_cache_generation());
+    auto result = m_interpreter.eval(mode == EvalMode::Action ? wrap_action(action_name, code) : code);
+
+    report.parse_ms = result.parse_ms;
+    report.execute_ms = result.execute_ms;
+    report.cached = result.cached;
+    report.noop = result.noop;
+    report.message = result.output;
+
+    if (!result.success) {
+        report.error = result.error;
+        finish();
+        return;
+    }
+
+    void (*action)() = nullptr;
+    std::unique_ptr<SymbolTable> table;
+
+    for (const auto& [name, address] : result.symbols) {
+        if (mode == EvalMode::Action && name == action_name) {
+            action = reinterpret_cast<void (*)()>(address);
+            continue;
+        }
+        report.symbols.push_back(name);
+
+        const SymbolTable* current = table ? table.get() : m_symbols.load(std::memory_order_acquire);
+        if (const auto it = current->find(name); it != current->end() && it->second == address) {
+            continue;
+        }
+        if (!table) {
+            table = std::make_unique<SymbolTable>(*current);
+        }
+        (*table)[name] = address;
+    }
+
+    if (mode == EvalMode::Action && !action) {
+        report.error = "Action compiled but its entry point could not be resolved";
+        finish();
+        return;
+    }
+
+    report.success = true;
+
+    if (table || action) {
+        const auto commit_start = Clock::now();
+
+        if (table) {
+            m_tables.emplace_back(std::move(table));
+            m_staged_table = m_tables.back().get();
+        } else {
+            m_staged_table = nullptr;
+        }
+        m_staged_action = action;
+
+        const uint64_t commit = m_next_commit++;
+        m_staged_commit.store(commit, std::memory_order_release);
+
+        await_commit(commit);
+        report.commit_ms = ms_between(commit_start, Clock::now());
+
+        reclaim_tables();
+    }
+
+    LILA_DEBUG(Emitter::INTERPRETER,
+        std::format("Evaluation #{} committed: queued {:.2f} ms, compile {:.2f} ms, commit {:.2f} ms",
+            sequence, report.queued_ms, report.compile_ms(), report.commit_ms));
+
+    finish();
+}
+
+// ---------------------------------------------------------------------------
+// Commit
+// ---------------------------------------------------------------------------
+
+void EvalPipeline::commit_pending() noexcept
+{
+    m_last_boundary_ns.store(now_ns(), std::memory_order_relaxed);
+
+    if (m_staged_commit.load(std::memory_order_acquire) != m_applied_commit.load(std::memory_order_relaxed)) {
+        apply_staged();
+    }
+}
+
+bool EvalPipeline::apply_staged() noexcept
+{
+    if (m_committing.exchange(true, std::memory_order_acquire)) {
+        return false;
+    }
+
+    const uint64_t staged = m_staged_commit.load(std::memory_order_acquire);
+    if (staged == m_applied_commit.load(std::memory_order_relaxed)) {
+        m_committing.store(false, std::memory_order_release);
+        return false;
+    }
+
+    if (m_staged_table) {
+        m_symbols.store(m_staged_table, std::memory_order_release);
+    }
+    if (m_staged_action) {
+        m_staged_action();
+    }
+
+    m_applied_commit.store(staged, std::memory_order_release);
+    m_committing.store(false, std::memory_order_release);
+    return true;
+}
+
+bool EvalPipeline::boundary_active() const noexcept
+{
+    const int64_t last = m_last_boundary_ns.load(std::memory_order_relaxed);
+    return last != 0
+        && now_ns() - last < std::chrono::duration_cast<std::chrono::nanoseconds>(BOUNDARY_IDLE).count();
+}
+
+void EvalPipeline::await_commit(uint64_t commit)
+{
+    const auto deadline = Clock::now() + COMMIT_TIMEOUT;
+    bool warned = false;
+
+    while (m_applied_commit.load(std::memory_order_acquire) < commit) {
+        if (!boundary_active()) {
+            apply_staged();
+            continue;
+        }
+
+        if (Clock::now() > deadline) {
+            if (!warned) {
+                LILA_WARN(Emitter::INTERPRETER, "No block boundary within the commit timeout, committing off the audio thread");
+                warned = true;
+            }
+            apply_staged();
+            continue;
+        }
+
+        std::this_thread::sleep_for(COMMIT_POLL);
+    }
+}
+
+void EvalPipeline::reclaim_tables()
+{
+    if (m_tables.size() < 2) {
+        return;
+    }
+
+    const SymbolTable* current = m_symbols.load(std::memory_order_acquire);
+
+    std::unique_lock lock(m_reader_mutex);
+    std::erase_if(m_tables, [current](const auto& table) { return table.get() != current; });
+}
+
+// ---------------------------------------------------------------------------
+// Lookup
+// ---------------------------------------------------------------------------
+
+void* EvalPipeline::find_symbol(const std::string& name) const
+{
+    std::shared_lock lock(m_reader_mutex);
+    const SymbolTable* table = m_symbols.load(std::memory_order_acquire);
+
+    const auto it = table->find(name);
+    return it != table->end() ? it->second : nullptr;
+}
+
+std::vector<std::string> EvalPipeline::symbol_names() const
+{
+    std::shared_lock lock(m_reader_mutex);
+    const SymbolTable* table = m_symbols.load(std::memory_order_acquire);
+
+    std::vector<std::string> names;
+    names.reserve(table->size());
+    for (const auto& [name, address] : *table) {
+        names.push_back(name);
+    }
+    return names;
+}
+
+} // namespace Lila
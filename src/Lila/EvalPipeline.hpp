@@ -0,0 +1,175 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <future>
+
+namespace Lila {
+
+class ClangInterpreter;
+
+/**
+ * @enum EvalMode
+ * @brief How a submitted snippet takes effect.
+ */
+enum class EvalMode : uint8_t {
+    Define, ///< Compile and run on the worker; new symbols are published at the commit
+    Action ///< Compile on the worker; the body runs on the audio thread at the commit
+};
+
+/**
+ * @struct EvalReport
+ * @brief Outcome and latency breakdown of one submitted snippet.
+ */
+struct EvalReport {
+    uint64_t sequence {}; ///< Submission order, starting at 1
+    bool success {};
+    std::string error;
+
+    std::vector<std::string> symbols; ///< Functions and globals this snippet defined
+
+    double queued_ms {}; ///< Waiting behind earlier snippets
+    double parse_ms {}; ///< Clang frontend and IR generation
+    double execute_ms {}; ///< JIT code generation and top-level statements
+    double commit_ms {}; ///< Waiting for a block boundary to publish
+
+    bool cached {}; ///< Served from the interpreter's snippet cache
+    bool noop {}; ///< Repeated definitions: nothing compiled, ran or committed
+    std::string message; ///< Interpreter note for the client, empty when there is none
+
+    /// @brief Time spent compiling, excluding queueing and the commit wait.
+    [[nodiscard]] double compile_ms() const { return parse_ms + execute_ms; }
+};
+
+using EvalCallback = std::function<void(const EvalReport&)>;
+
+/**
+ * @class EvalPipeline
+ * @brief Off-thread compilation with commits at audio block boundaries.
+ *
+ * One worker thread owns the ClangInterpreter. Snippets are queued and
+ * compiled there in order, so a large evaluation never stalls the caller
+ * and code already running keeps running while the next version builds.
+ *
+ * Each successful snippet produces a commit: a new immutable symbol table,
+ * plus, for EvalMode::Action, a function wrapping the snippet body. The
+ * worker stages the commit and the next commit_pending() call applies it
+ * with a single pointer exchange (and runs the action). Call
+ * commit_pending() at the start of each audio block; it never blocks or
+ * allocates, so replacement lands exactly between two blocks.
+ *
+ * If nothing has called commit_pending() recently (no audio running, or a
+ * host that does not drive it), the worker applies the commit itself
+ * rather than wait. Define snippets always run their top-level statements
+ * on the worker; anything that must touch a running graph belongs in an
+ * Action.
+ *
+ * All other interpreter access (symbol lookup, library loading) is routed
+ * through run() so it is serialised with compilation.
+ */
+class LILA_API EvalPipeline {
+public:
+    /// Without a commit_pending() call for this long, the worker commits itself.
+    static constexpr auto BOUNDARY_IDLE = std::chrono::milliseconds(250);
+
+    explicit EvalPipeline(ClangInterpreter& interpreter);
+    ~EvalPipeline();
+
+    EvalPipeline(const EvalPipeline&) = delete;
+    EvalPipeline& operator=(const EvalPipeline&) = delete;
+    EvalPipeline(EvalPipeline&&) = delete;
+    EvalPipeline& operator=(EvalPipeline&&) = delete;
+
+    void start();
+
+    /**
+     * @brief Join the worker.
+     *
+     * The snippet in progress finishes; snippets still queued are reported
+     * as failed without compiling. Pending run() tasks still execute.
+     */
+    void stop();
+
+    [[nodiscard]] bool is_running() const { return m_running.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Queue a snippet.
+     * @param on_done Called on the worker thread once the snippet is
+     *        committed or has failed. May be empty.
+     * @return Sequence number of the submission, or 0 if not running.
+     */
+    uint64_t submit(std::string code, EvalMode mode, EvalCallback on_done);
+
+    /// @brief Queue a snippet and wait for its report.
+    EvalReport eval(std::string code, EvalMode mode = EvalMode::Define);
+
+    /**
+     * @brief Run @p task on the worker and wait for it.
+     *
+     * Runs inline when called from the worker itself or when the pipeline
+     * is stopped.
+     */
+    void run(const std::function<void()>& task);
+
+    /**
+     * @brief Apply a staged commit, if any.
+     *
+     * Real-time safe: one atomic load when there is nothing to do, never
+     * blocks. Call from the audio thread at a block boundary.
+     */
+    void commit_pending() noexcept;
+
+    /// @brief Address of a committed symbol, or nullptr. Any non-realtime thread.
+    [[nodiscard]] void* find_symbol(const std::string& name) const;
+
+    /// @brief Names of every committed symbol. Any non-realtime thread.
+    [[nodiscard]] std::vector<std::string> symbol_names() const;
+
+private:
+    using SymbolTable = std::unordered_map<std::string, void*>;
+    using Clock = std::chrono::steady_clock;
+
+    ClangInterpreter& m_interpreter;
+
+    std::thread m_worker;
+    std::thread::id m_worker_id;
+    std::atomic<bool> m_running { false };
+    std::atomic<bool> m_stopping { false };
+
+    std::mutex m_queue_mutex;
+    std::condition_variable m_queue_cv;
+    std::deque<std::function<void()>> m_queue;
+
+    uint64_t m_next_sequence { 1 };
+
+    // ─── Commit handoff (worker stages, committer applies) ─────────────────
+
+    uint64_t m_next_commit { 1 };
+    const SymbolTable* m_staged_table {};
+    void (*m_staged_action)() {};
+    std::atomic<uint64_t> m_staged_commit {};
+    std::atomic<uint64_t> m_applied_commit {};
+    std::atomic<bool> m_committing { false };
+    std::atomic<int64_t> m_last_boundary_ns { 0 };
+
+    // ─── Published symbols ─────────────────────────────────────────────────
+
+    std::atomic<const SymbolTable*> m_symbols;
+
+    /// Readers hold this shared while dereferencing m_symbols; the worker
+    /// takes it exclusively before freeing a retired table.
+    mutable std::shared_mutex m_reader_mutex;
+    std::vector<std::unique_ptr<const SymbolTable>> m_tables;
+
+    void worker_loop();
+    bool enqueue(std::function<void()> task);
+    void compile(const std::string& code, EvalMode mode, uint64_t sequence,
+        Clock::time_point submitted, const EvalCallback& on_done);
+    bool apply_staged() noexcept;
+    void await_commit(uint64_t commit);
+    void reclaim_tables();
+
+    [[nodiscard]] bool boundary_active() const noexcept;
+};
+
+} // namespace Lila
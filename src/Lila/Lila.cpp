@@ -5,6 +5,8 @@
 
 #include "Commentator.hpp"
 
+#include <format>
+
 #ifdef MAYAFLUX_PLATFORM_MACOS
 #include <CoreFoundation/CoreFoundation.h>
 #endif
@@ -15,8 +17,16 @@
 
 namespace Lila {
 
+namespace {
+
+    /// First line of a server message that marks it as an EvalMode::Action
+    constexpr std::string_view ACTION_DIRECTIVE = "//@action";
+
+} // namespace
+
 Lila::Lila()
     : m_interpreter(std::make_unique<ClangInterpreter>())
+    , m_pipeline(std::make_unique<EvalPipeline>(*m_interpreter))
     , m_current_mode(OperationMode::Direct)
     , server_loop_rate(0.1F)
 {
@@ -26,6 +36,7 @@ Lila::Lila()
 Lila::~Lila()
 {
     stop_server();
+    m_pipeline->stop();
     LILA_DEBUG(Emitter::SYSTEM, "Lila instance destroyed");
 }
 
@@ -53,7 +64,13 @@ bool Lila::initialize(OperationMode mode, int server_port, bool skip_host_librar
 bool Lila::initialize_interpreter(bool skip_host_library_load)
 {
     LILA_DEBUG(Emitter::SYSTEM, "Initializing interpreter subsystem");
-    return m_interpreter->initialize(skip_host_library_load);
+
+    if (!m_interpreter->initialize(skip_host_library_load)) {
+        return false;
+    }
+
+    m_pipeline->start();
+    return true;
 }
 
 bool Lila::initialize_server(int port)
@@ -68,51 +85,91 @@ bool Lila::initialize_server(int port)
 
     m_server = std::make_unique<Server>(port);
 
-    m_server->set_message_handler([this](std::string_view message) {
-        return this->handle_server_message(message);
+    m_server->set_async_message_handler([this](std::string_view message, Server::Reply reply) {
+        this->handle_server_message(message, std::move(reply));
     });
 
     return m_server->start();
 }
 
-std::expected<std::string, std::string> Lila::handle_server_message(std::string_view message)
+void Lila::handle_server_message(std::string_view message, std::function<void(std::expected<std::string, std::string>)> reply)
 {
     if (message.empty()) {
-        return R"({"status":"error","message":"Empty message"})";
+        reply(R"({"status":"error","message":"Empty message"})");
+        return;
     }
 
-    auto result = m_interpreter->eval(std::string(message));
+    auto mode = EvalMode::Define;
+    std::string code(message);
 
-    if (result.success) {
-        if (m_success_callback) {
-            m_success_callback();
-        }
-        return "";
+    if (code.starts_with(ACTION_DIRECTIVE)) {
+        mode = EvalMode::Action;
+        const auto line_end = code.find('\n');
+        code.erase(0, line_end == std::string::npos ? code.size() : line_end + 1);
     }
 
-    if (m_error_callback) {
-        m_error_callback(result.error);
+    const auto sequence = m_pipeline->submit(std::move(code), mode,
+        [this, reply](const EvalReport& report) {
+            notify(report);
+            if (report.success) {
+                reply(format_report(report));
+            } else {
+                reply(std::unexpected(escape_json(report.error)));
+            }
+        });
+
+    if (sequence == 0) {
+        reply(std::unexpected("Interpreter not initialized"));
+    }
+}
+
+void Lila::notify(const EvalReport& report)
+{
+    if (report.success && m_success_callback) {
+        m_success_callback();
+    } else if (!report.success && m_error_callback) {
+        m_error_callback(report.error);
     }
+}
 
-    return std::unexpected(escape_json(result.error));
+std::string Lila::format_report(const EvalReport& report)
+{
+    auto json = std::format(
+        R"({{"status":"success","sequence":{},"cached":{},"noop":{},"compile_ms":{:.3f},"parse_ms":{:.3f},"execute_ms":{:.3f},"queued_ms":{:.3f},"commit_ms":{:.3f})",
+        report.sequence, report.cached, report.noop, report.compile_ms(), report.parse_ms, report.execute_ms, report.queued_ms, report.commit_ms);
+
+    if (!report.message.empty()) {
+        json += R"(,"message":")" + escape_json(report.message) + "\"";
+    }
+    return json + "}";
 }
 
 bool Lila::eval(const std::string& code)
 {
-    if (!m_interpreter) {
+    if (!m_pipeline->is_running()) {
         LILA_ERROR(Emitter::SYSTEM, "Cannot eval: interpreter not initialized");
         return false;
     }
 
-    auto result = m_interpreter->eval(code);
+    auto report = m_pipeline->eval(code);
+    notify(report);
+    return report.success;
+}
 
-    if (result.success && m_success_callback) {
-        m_success_callback();
-    } else if (!result.success && m_error_callback) {
-        m_error_callback(result.error);
-    }
+uint64_t Lila::eval_async(std::string code, EvalCallback on_done, EvalMode mode)
+{
+    return m_pipeline->submit(std::move(code), mode,
+        [this, on_done = std::move(on_done)](const EvalReport& report) {
+            notify(report);
+            if (on_done) {
+                on_done(report);
+            }
+        });
+}
 
-    return result.success;
+void Lila::commit_pending() noexcept
+{
+    m_pipeline->commit_pending();
 }
 
 bool Lila::eval_file(const std::string& filepath)
@@ -122,8 +179,9 @@ bool Lila::eval_file(const std::string& filepath)
         return false;
     }
 
-    auto result = m_interpreter->eval_file(filepath);
-    return result.success;
+    bool success = false;
+    m_pipeline->run([&] { success = m_interpreter->eval_file(filepath).success; });
+    return success;
 }
 
 void Lila::start_server(int port)
@@ -138,6 +196,9 @@ void Lila::stop_server()
 {
     if (m_server) {
         LILA_INFO(Emitter::SYSTEM, "Stopping server");
+
+        // Replies queued ahead of this no-op reach the server before it goes away.
+        m_pipeline->run([] { });
         m_server->stop();
         m_server.reset();
     }
@@ -150,33 +211,47 @@ bool Lila::is_server_running() const
 
 void* Lila::get_symbol_address(const std::string& name)
 {
-    return m_interpreter ? m_interpreter->get_symbol_address(name) : nullptr;
+    if (void* address = m_pipeline->find_symbol(name)) {
+        return address;
+    }
+
+    void* address = nullptr;
+    m_pipeline->run([&] { address = m_interpreter->get_symbol_address(name); });
+    return address;
 }
 
 std::vector<std::string> Lila::get_defined_symbols()
 {
-    return m_interpreter ? m_interpreter->get_defined_symbols() : std::vector<std::string> {};
+    std::vector<std::string> symbols;
+    m_pipeline->run([&] { symbols = m_interpreter->get_defined_symbols(); });
+    return symbols;
 }
 
 void Lila::add_include_path(const std::string& path)
 {
-    if (m_interpreter) {
-        m_interpreter->add_include_path(path);
-    }
+    m_pipeline->run([&] { m_interpreter->add_include_path(path); });
 }
 
 void Lila::add_compile_flag(const std::string& flag)
 {
-    if (m_interpreter) {
-        m_interpreter->add_compile_flag(flag);
-    }
+    m_pipeline->run([&] { m_interpreter->add_compile_flag(flag); });
+}
+
+void Lila::set_cache_directory(const std::filesystem::path& directory)
+{
+    m_pipeline->run([&] { m_interpreter->set_cache_directory(directory); });
+}
+
+bool Lila::build_prelude_snapshot()
+{
+    bool built = false;
+    m_pipeline->run([&] { built = m_interpreter->build_prelude_snapshot(); });
+    return built;
 }
 
 void Lila::load_library(const std::string& path)
 {
-    if (m_interpreter) {
-        m_interpreter->load_library(path);
-    }
+    m_pipeline->run([&] { m_interpreter->load_library(path); });
 }
 
 void Lila::on_success(std::function<void()> callback)
@@ -2,6 +2,8 @@
 
 #include <expected>
 
+#include "EvalPipeline.hpp"
+
 namespace Lila {
 
 class ClangInterpreter;
@@ -39,6 +41,13 @@ enum class OperationMode : uint8_t {
  * 6. Optionally configure include paths and compile flags before initialization
  * 7. Register callbacks for success, error, and server/client events as needed
  *
+ * ## Threading
+ * Compilation runs on an EvalPipeline worker, so the code already running
+ * keeps running while a new snippet builds. Call commit_pending() at each
+ * audio block boundary to swap new definitions in between blocks. Server
+ * messages whose first line is `//@action` are compiled as EvalMode::Action
+ * and their body runs at that boundary.
+ *
  * Lila is intended as the main API for embedding live coding capabilities in MayaFlux.
  * End users interact with Lila via higher-level interfaces or the live_server binary,
  * not directly with its internal components.
@@ -79,6 +88,24 @@ public:
      */
     bool eval(const std::string& code);
 
+    /**
+     * @brief Queue a snippet for off-thread compilation
+     * @param code Code to compile
+     * @param on_done Called on the evaluation worker with the report
+     * @param mode Define (default) or Action
+     * @return Sequence number of the submission, or 0 if not initialized
+     *
+     * The success and error callbacks also fire on the worker thread.
+     */
+    uint64_t eval_async(std::string code, EvalCallback on_done = {}, EvalMode mode = EvalMode::Define);
+
+    /**
+     * @brief Apply definitions compiled since the last call
+     *
+     * Real-time safe. Call from the audio thread at the start of a block.
+     */
+    void commit_pending() noexcept;
+
     /**
      * @brief Evaluates a C++ code file directly
      * @param filepath Path to the file to execute
@@ -128,6 +155,18 @@ public:
      */
     void add_compile_flag(const std::string& flag);
 
+    /**
+     * @brief Directory for the interpreter's prelude snapshot; empty disables it
+     * @param directory Cache directory, used from the next initialize()
+     */
+    void set_cache_directory(const std::filesystem::path& directory);
+
+    /**
+     * @brief Build the prelude snapshot without starting a session
+     * @return True if the snapshot was written
+     */
+    bool build_prelude_snapshot();
+
     /**
      * @brief Load a shared library into the JIT symbol table.
      * @param path Full path to the shared library.
@@ -213,6 +252,7 @@ public:
 
 private:
     std::unique_ptr<ClangInterpreter> m_interpreter; ///< Embedded Clang interpreter
+    std::unique_ptr<EvalPipeline> m_pipeline; ///< Worker that owns all interpreter access
     std::unique_ptr<Server> m_server; ///< TCP server for live coding
 
     OperationMode m_current_mode; ///< Current operation mode
@@ -225,7 +265,11 @@ private:
 
     float server_loop_rate; ///< Server loop rate in seconds
 
-    std::expected<std::string, std::string> handle_server_message(std::string_view message);
+    void handle_server_message(std::string_view message, std::function<void(std::expected<std::string, std::string>)> reply);
+    void notify(const EvalReport& report);
+
+    /// @brief Success response with the latency breakdown of one evaluation
+    static std::string format_report(const EvalReport& report);
 
     /**
      * @brief Escapes a string for safe JSON encoding
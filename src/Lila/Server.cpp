@@ -2,6 +2,10 @@
 
 #include "Commentator.hpp"
 
+#include "MayaFlux/Transitive/Profile/Profiler.hpp"
+
+#include <charconv>
+
 namespace Lila {
 
 // ---------------------------------------------------------------------------
@@ -96,13 +100,10 @@ private:
             if (!m_block_buf.empty()) {
                 if (m_block_buf.starts_with('@')) {
                     m_server.process_control_message(m_info.fd, std::string_view(m_block_buf).substr(1));
+                } else if (m_server.m_async_message_handler) {
+                    m_server.m_async_message_handler(m_block_buf, make_reply());
                 } else if (m_server.m_message_handler) {
-                    auto response = m_server.m_message_handler(m_block_buf);
-                    if (response) {
-                        send(*response);
-                    } else {
-                        send(R"({"status":"error","message":")" + response.error() + "\"}");
-                    }
+                    respond(m_server.m_message_handler(m_block_buf));
                 }
             }
             m_block_buf.clear();
@@ -111,6 +112,27 @@ private:
         read_chunk();
     }
 
+    void respond(const std::expected<std::string, std::string>& response)
+    {
+        if (response) {
+            send(*response);
+        } else {
+            send(R"({"status":"error","message":")" + response.error() + "\"}");
+        }
+    }
+
+    /// Reply for the async handler: hops back onto the io thread to write,
+    /// and does nothing if the client has gone by then.
+    Server::Reply make_reply()
+    {
+        return [weak = weak_from_this()](std::expected<std::string, std::string> response) {
+            if (auto self = weak.lock()) {
+                asio::post(self->m_socket.get_executor(),
+                    [self, response = std::move(response)] { self->respond(response); });
+            }
+        };
+    }
+
     asio::ip::tcp::socket m_socket;
     std::array<char, 4096> m_read_buf {};
     std::string m_block_buf;
@@ -287,6 +309,14 @@ void Server::process_control_message(int client_id, std::string_view message)
             it->second->send(R"({"status":"success","message":"pong"})");
         }
 
+    } else if (message == "profile" || message.starts_with("profile ")) {
+        auto response = process_profile_command(message.size() > 8 ? message.substr(8) : std::string_view {});
+
+        std::shared_lock lock(m_clients_mutex);
+        if (auto it = m_sessions.find(client_id); it != m_sessions.end()) {
+            it->second->send(response);
+        }
+
     } else {
         std::shared_lock lock(m_clients_mutex);
         if (auto it = m_sessions.find(client_id); it != m_sessions.end()) {
@@ -296,6 +326,49 @@ void Server::process_control_message(int client_id, std::string_view message)
     }
 }
 
+std::string Server::process_profile_command(std::string_view args)
+{
+    auto& profiler = MayaFlux::Profile::Profiler::instance();
+
+    if (args.empty()) {
+        return R"({"status":"success","profile":)" + profiler.report_json() + "}";
+    }
+
+    if (args == "on") {
+        profiler.enable();
+        return R"({"status":"success","message":"Profiling enabled"})";
+    }
+
+    if (args == "off") {
+        profiler.disable();
+        return R"({"status":"success","message":"Profiling disabled"})";
+    }
+
+    if (args == "reset") {
+        profiler.reset();
+        return R"({"status":"success","message":"Profiling data cleared"})";
+    }
+
+    if (args.starts_with("top ")) {
+        size_t top {};
+        auto count = args.substr(4);
+        if (std::from_chars(count.data(), count.data() + count.size(), top).ec == std::errc {}) {
+            return R"({"status":"success","profile":)" + profiler.report_json(top) + "}";
+        }
+    }
+
+    if (args.starts_with("trace ")) {
+        std::string path(args.substr(6));
+        if (profiler.export_chrome_trace(path)) {
+            LILA_INFO(Emitter::SERVER, "Chrome trace written to " + path);
+            return R"({"status":"success","message":"Trace written"})";
+        }
+        return R"({"status":"error","message":"Failed to write trace"})";
+    }
+
+    return R"({"status":"error","message":"Usage: profile [on|off|reset|top <n>|trace <path>]"})";
+}
+
 void Server::set_client_session(int client_id, std::string session_id)
 {
     std::unique_lock lock(m_clients_mutex);
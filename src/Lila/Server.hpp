@@ -16,12 +16,22 @@ class ClientSession;
  * Async TCP server built on asio. Accepts newline-delimited messages,
  * dispatches them to a message handler, and returns the response.
  * Control messages prefixed with '@' are handled internally.
+ *
+ * With an AsyncMessageHandler the io thread only hands the message off;
+ * the response is sent whenever the handler calls its Reply, from any
+ * thread, so one slow evaluation does not stall other clients.
  */
 class LILA_API Server {
 public:
     /// @brief Handler for processing incoming client messages
     using MessageHandler = std::function<std::expected<std::string, std::string>(std::string_view)>;
 
+    /// @brief Sends the response to one message; callable once, from any thread
+    using Reply = std::function<void(std::expected<std::string, std::string>)>;
+
+    /// @brief Handler that answers later through a Reply. Copy the message before returning.
+    using AsyncMessageHandler = std::function<void(std::string_view, Reply)>;
+
     /// @brief Handler for client connection/disconnection events
     using ConnectionHandler = std::function<void(const ClientInfo&)>;
 
@@ -39,6 +49,9 @@ public:
     [[nodiscard]] bool is_running() const { return m_running.load(std::memory_order_acquire); }
 
     void set_message_handler(MessageHandler handler) { m_message_handler = std::move(handler); }
+
+    /// @brief Takes precedence over the synchronous handler when set.
+    void set_async_message_handler(AsyncMessageHandler handler) { m_async_message_handler = std::move(handler); }
     void on_client_connected(ConnectionHandler handler) { m_connect_handler = std::move(handler); }
     void on_client_disconnected(ConnectionHandler handler) { m_disconnect_handler = std::move(handler); }
     void on_server_started(StartHandler handler) { m_start_handler = std::move(handler); }
@@ -60,6 +73,12 @@ private:
     void remove_session(int client_id);
     void process_control_message(int client_id, std::string_view message);
 
+    /**
+     * @brief Handle "@profile [on|off|reset|top <n>|trace <path>]"
+     * @return JSON response for the client
+     */
+    static std::string process_profile_command(std::string_view args);
+
     friend class ClientSession;
 
     int m_port;
@@ -71,6 +90,7 @@ private:
     std::thread m_io_thread;
 
     MessageHandler m_message_handler;
+    AsyncMessageHandler m_async_message_handler;
     ConnectionHandler m_connect_handler;
     ConnectionHandler m_disconnect_handler;
     StartHandler m_start_handler;
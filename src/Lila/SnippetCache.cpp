@@ -0,0 +1,138 @@
+#include "SnippetCache.hpp"
+
+#include "Commentator.hpp"
+
+#include <format>
+
+namespace Lila {
+
+std::string SnippetCache::normalize(std::string_view code)
+{
+    std::string out;
+    out.reserve(code.size());
+
+    bool pending_space = false;
+    bool pending_newline = false;
+
+    const auto emit = [&](std::string_view text) {
+        if (pending_newline && !out.empty()) {
+            out.push_back('\n');
+        } else if (pending_space && !out.empty() && out.back() != '\n') {
+            out.push_back(' ');
+        }
+        pending_space = false;
+        pending_newline = false;
+        out.append(text);
+    };
+
+    size_t i = 0;
+    while (i < code.size()) {
+        const char c = code[i];
+
+        if (c == '\n') {
+            pending_newline = true;
+            ++i;
+            continue;
+        }
+
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v') {
+            pending_space = true;
+            ++i;
+            continue;
+        }
+
+        if (c == '/' && i + 1 < code.size() && code[i + 1] == '/') {
+            i = code.find('\n', i);
+            if (i == std::string_view::npos) {
+                i = code.size();
+            }
+            continue;
+        }
+
+        if (c == '/' && i + 1 < code.size() && code[i + 1] == '*') {
+            const size_t end = code.find("*/", i + 2);
+            i = end == std::string_view::npos ? code.size() : end + 2;
+            pending_space = true;
+            continue;
+        }
+
+        if (c == 'R' && i + 1 < code.size() && code[i + 1] == '"') {
+            const size_t open = code.find('(', i + 2);
+            if (open != std::string_view::npos) {
+                const std::string close = ")" + std::string(code.substr(i + 2, open - i - 2)) + "\"";
+                const size_t end = code.find(close, open + 1);
+                const size_t stop = end == std::string_view::npos ? code.size() : end + close.size();
+                emit(code.substr(i, stop - i));
+                i = stop;
+                continue;
+            }
+        }
+
+        if (c == '"' || c == '\'') {
+            size_t j = i + 1;
+            while (j < code.size() && code[j] != c && code[j] != '\n') {
+                j += code[j] == '\\' ? 2 : 1;
+            }
+            j = std::min(j + 1, code.size());
+            emit(code.substr(i, j - i));
+            i = j;
+            continue;
+        }
+
+        emit(code.substr(i, 1));
+        ++i;
+    }
+
+    return out;
+}
+
+std::string SnippetCache::digest(std::string_view normalized)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (const char c : normalized) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001B3ULL;
+    }
+    return std::format("{:016x}", hash);
+}
+
+SnippetCache::Entry* SnippetCache::find(const std::string& normalized)
+{
+    const auto it = m_entries.find(normalized);
+    if (it == m_entries.end()) {
+        ++m_misses;
+        return nullptr;
+    }
+
+    ++m_hits;
+    ++it->second.hits;
+    return &it->second;
+}
+
+SnippetCache::Entry& SnippetCache::store(const std::string& normalized, Entry entry)
+{
+    return m_entries.insert_or_assign(normalized, std::move(entry)).first->second;
+}
+
+void SnippetCache::invalidate(std::string_view reason)
+{
+    ++m_generation;
+    ++m_invalidations;
+
+    if (!m_entries.empty()) {
+        LILA_DEBUG(Emitter::INTERPRETER,
+            std::format("Snippet cache cleared ({} entries): {}", m_entries.size(), reason));
+        m_entries.clear();
+    }
+}
+
+SnippetCache::Stats SnippetCache::stats() const noexcept
+{
+    return {
+        .hits = m_hits,
+        .misses = m_misses,
+        .invalidations = m_invalidations,
+        .entries = m_entries.size(),
+    };
+}
+
+} // namespace Lila
@@ -0,0 +1,76 @@
+#pragma once
+
+namespace Lila {
+
+/**
+ * @class SnippetCache
+ * @brief Content-addressed record of snippets the interpreter has already compiled.
+ *
+ * Live sets evaluate the same helper code over and over. Entries are keyed
+ * on the snippet text after normalize() (comments dropped, whitespace
+ * collapsed), so cosmetic edits still hit. Each entry keeps what the
+ * compiled code left behind in the JIT: the symbols a declaration snippet
+ * defined, or an entry point that replays a statement snippet.
+ *
+ * The cache belongs to one compiler environment. Anything that changes how
+ * code compiles or links (include paths, flags, libraries, a new
+ * interpreter) must call invalidate(), which drops every entry and bumps
+ * generation().
+ */
+class LILA_API SnippetCache {
+public:
+    /// @brief What a snippet contained at top level, which decides how a hit is served.
+    enum class Kind : uint8_t {
+        Declarations, ///< Only definitions: already linked, a hit is a no-op
+        Statements, ///< Only expression statements: a hit calls the replay entry point
+        Mixed ///< Both, or unclassifiable: never served from the cache
+    };
+
+    struct Entry {
+        Kind kind { Kind::Mixed };
+        std::vector<std::pair<std::string, void*>> symbols;
+        void (*replay)() {}; ///< Statements compiled as a function, once they repeat
+        uint64_t hits {};
+    };
+
+    struct Stats {
+        uint64_t hits {};
+        uint64_t misses {};
+        uint64_t invalidations {};
+        size_t entries {};
+    };
+
+    /**
+     * @brief Canonical form used as the cache key.
+     *
+     * Drops comments, collapses horizontal whitespace to one space and blank
+     * lines to one newline, and trims each line. String, character and raw
+     * string literals are copied verbatim. Line structure is kept so
+     * preprocessor directives stay intact.
+     */
+    [[nodiscard]] static std::string normalize(std::string_view code);
+
+    /// @brief 64-bit FNV-1a of normalized text, as 16 hex digits. Safe in identifiers.
+    [[nodiscard]] static std::string digest(std::string_view normalized);
+
+    /// @brief Entry for @p normalized text, or nullptr. Counts a hit or a miss.
+    [[nodiscard]] Entry* find(const std::string& normalized);
+
+    Entry& store(const std::string& normalized, Entry entry);
+
+    /// @brief Drop every entry; the environment it was built in has changed.
+    void invalidate(std::string_view reason);
+
+    [[nodiscard]] uint64_t generation() const noexcept { return m_generation; }
+
+    [[nodiscard]] Stats stats() const noexcept;
+
+private:
+    std::unordered_map<std::string, Entry> m_entries;
+    uint64_t m_generation {};
+    uint64_t m_hits {};
+    uint64_t m_misses {};
+    uint64_t m_invalidations {};
+};
+
+} // namespace Lila
@@ -36,7 +36,7 @@ namespace Core {
  * @brief Checks if the default engine has been initialized
  * @return true if the engine is initialized, false otherwise
  */
-bool is_initialized();
+MAYAFLUX_API bool is_initialized();
 
 /**
  * @brief Checks if the default engine has currently accepted all configurations and initialized all managers
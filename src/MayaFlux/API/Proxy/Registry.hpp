@@ -52,6 +52,7 @@ namespace Nodes {
     }
     class Constant;
     class StreamReaderNode;
+    class VarispeedReaderNode;
 }
 
 namespace Buffers {
@@ -112,6 +113,7 @@ namespace IO {
     N(LineSegmentsNode, MayaFlux::Nodes::GpuSync::LineSegmentsNode)           \
     N(ProceduralTextureNode, MayaFlux::Nodes::GpuSync::ProceduralTextureNode) \
     N(StreamReaderNode, MayaFlux::Nodes::StreamReaderNode)                    \
+    N(VarispeedReaderNode, MayaFlux::Nodes::VarispeedReaderNode)              \
     N(Constant, MayaFlux::Nodes::Constant)
 
 #define ALL_NODE_NETWORK_REGISTRATIONS                                \
@@ -8,6 +8,9 @@
 #include "MayaFlux/Kinesis/Discrete/Analysis.hpp"
 #include "MayaFlux/Kinesis/Discrete/Transform.hpp"
 
+#include "MayaFlux/Kakshya/Source/SoundStreamContainer.hpp"
+#include "MayaFlux/Transitive/Parallel/Execution.hpp"
+
 namespace MayaFlux {
 
 namespace D = Kinesis::Discrete;
@@ -510,6 +513,50 @@ std::vector<std::vector<double>> detect_onsets_per_channel(const std::vector<Kak
     return all_onsets;
 }
 
+Kinesis::Discrete::FeatureTrack extract_features(const std::vector<double>& data, const Kinesis::Discrete::FeatureConfig& config)
+{
+    Kinesis::Discrete::FeatureEngine engine(config);
+    return engine.analyze(data);
+}
+
+Kinesis::Discrete::FeatureTrack extract_features(const Kakshya::DataVariant& data, const Kinesis::Discrete::FeatureConfig& config)
+{
+    auto numeric = data;
+    Kinesis::Discrete::FeatureEngine engine(config);
+    return engine.analyze(as_span(numeric));
+}
+
+std::vector<Kinesis::Discrete::FeatureTrack> extract_features_per_channel(const std::vector<Kakshya::DataVariant>& channels, const Kinesis::Discrete::FeatureConfig& config)
+{
+    std::vector<Kinesis::Discrete::FeatureTrack> tracks(channels.size());
+    std::vector<size_t> idx(channels.size());
+    std::iota(idx.begin(), idx.end(), 0);
+
+    Parallel::for_each(Parallel::par_unseq, idx.begin(), idx.end(),
+        [&](size_t ch) { tracks[ch] = extract_features(channels[ch], config); });
+    return tracks;
+}
+
+std::vector<Kinesis::Discrete::FeatureTrack> extract_features(const std::shared_ptr<Kakshya::SoundStreamContainer>& container, Kinesis::Discrete::FeatureConfig config)
+{
+    if (!container)
+        return {};
+
+    config.sample_rate = container->get_sample_rate();
+
+    std::vector<Kinesis::Discrete::FeatureTrack> tracks(container->get_num_channels());
+    std::vector<uint32_t> idx(tracks.size());
+    std::iota(idx.begin(), idx.end(), 0U);
+
+    Parallel::for_each(Parallel::par_unseq, idx.begin(), idx.end(),
+        [&](uint32_t ch) {
+            const auto [samples, stride] = container->get_channel_view(ch);
+            Kinesis::Discrete::FeatureEngine engine(config);
+            tracks[ch] = engine.analyze(samples, stride);
+        });
+    return tracks;
+}
+
 //=========================================================================
 // BASIC TRANSFORMATIONS - Use Kinesis
 //=========================================================================
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "MayaFlux/Kakshya/NDData/NDData.hpp"
+#include "MayaFlux/Kinesis/Discrete/Features.hpp"
 
 /**
  * @file API/Yantra.hpp
@@ -23,6 +24,10 @@
 
 namespace MayaFlux {
 
+namespace Kakshya {
+    class SoundStreamContainer;
+}
+
 //=========================================================================
 // STATISTICAL ANALYSIS - Quick data insights
 //=========================================================================
@@ -219,6 +224,35 @@ MAYAFLUX_API std::vector<double> detect_onsets(const Kakshya::DataVariant& data,
  */
 MAYAFLUX_API std::vector<std::vector<double>> detect_onsets_per_channel(const std::vector<Kakshya::DataVariant>& channels, double sample_rate = 48000.0, double threshold = 0.1);
 
+/**
+ * @brief Extract several descriptors in one pass over single-channel data
+ * @param data Input signal data
+ * @param config Descriptors, framing and filterbank settings
+ * @return One row of descriptors per hop
+ *
+ * All requested descriptors (centroid, flux, rolloff, RMS, ZCR, onset
+ * strength, MFCC, chroma, ...) share a single windowed FFT per hop,
+ * instead of one analysis pass per helper call.
+ */
+MAYAFLUX_API Kinesis::Discrete::FeatureTrack extract_features(const std::vector<double>& data, const Kinesis::Discrete::FeatureConfig& config = {});
+MAYAFLUX_API Kinesis::Discrete::FeatureTrack extract_features(const Kakshya::DataVariant& data, const Kinesis::Discrete::FeatureConfig& config = {});
+
+/**
+ * @brief Extract descriptors per channel for multi-channel signal
+ * @param channels Vector of channel data
+ * @param config Descriptors, framing and filterbank settings
+ * @return One FeatureTrack per channel
+ */
+MAYAFLUX_API std::vector<Kinesis::Discrete::FeatureTrack> extract_features_per_channel(const std::vector<Kakshya::DataVariant>& channels, const Kinesis::Discrete::FeatureConfig& config = {});
+
+/**
+ * @brief Extract descriptors per channel directly from a sound container
+ * @param container Loaded container; read in place, without de-interleaving copies
+ * @param config Descriptors and framing; sample_rate is taken from the container
+ * @return One FeatureTrack per channel
+ */
+MAYAFLUX_API std::vector<Kinesis::Discrete::FeatureTrack> extract_features(const std::shared_ptr<Kakshya::SoundStreamContainer>& container, Kinesis::Discrete::FeatureConfig config = {});
+
 //=========================================================================
 // MULTI-CHANNEL SPECIFIC ANALYSIS - Channel relationships
 //=========================================================================
@@ -1,8 +1,10 @@
 #include "BufferProcessingChain.hpp"
 
+#include "AudioBuffer.hpp"
 #include "Buffer.hpp"
 
 #include "MayaFlux/Journal/Archivist.hpp"
+#include "MayaFlux/Transitive/Profile/Profiler.hpp"
 
 namespace MayaFlux::Buffers {
 
@@ -67,6 +69,7 @@ bool BufferProcessingChain::add_processor_direct(const std::shared_ptr<BufferPro
 
     processors.push_back(processor);
     processor->on_attach(buffer);
+    invalidate_plan();
 
     return true;
 }
@@ -92,6 +95,7 @@ void BufferProcessingChain::remove_processor_direct(const std::shared_ptr<Buffer
 
         m_conditional_processors[buffer].erase(processor);
         m_pending_removal[buffer].erase(processor);
+        invalidate_plan();
     }
 }
 
@@ -101,25 +105,16 @@ void BufferProcessingChain::process_non_owning(const std::shared_ptr<Buffer>& bu
         process_pending_processor_operations();
     }
 
-    auto it = m_buffer_processors.find(buffer);
-    if (it == m_buffer_processors.end() || it->second.empty()) {
+    compile_if_dirty();
+
+    const auto* plan = find_plan(buffer);
+    if (!plan || plan->stage_count == 0) {
         return;
     }
 
-    for (auto& processor : it->second) {
-        bool should_process = true;
+    run_stages(*plan, buffer, false);
 
-        if (m_enforcement_strategy == TokenEnforcementStrategy::OVERRIDE_SKIP) {
-            auto processor_token = processor->get_processing_token();
-            should_process = are_tokens_compatible(m_token_filter_mask, processor_token);
-        }
-
-        if (should_process) {
-            processor->process_non_owning(buffer);
-        }
-    }
-
-    if (m_enforcement_strategy == TokenEnforcementStrategy::OVERRIDE_REJECT) {
+    if (plan->needs_cleanup) {
         cleanup_rejected_processors(buffer);
     }
 }
@@ -136,27 +131,15 @@ void BufferProcessingChain::process(const std::shared_ptr<Buffer>& buffer)
         process_pending_processor_operations();
     }
 
-    auto it = m_buffer_processors.find(buffer);
-    if (it == m_buffer_processors.end() || it->second.empty()) {
-        m_is_processing.store(false, std::memory_order_release);
-        return;
-    }
+    compile_if_dirty();
 
-    for (auto& processor : it->second) {
-        bool should_process = true;
+    const auto* plan = find_plan(buffer);
+    if (plan && plan->stage_count > 0) {
+        run_stages(*plan, buffer, true);
 
-        if (m_enforcement_strategy == TokenEnforcementStrategy::OVERRIDE_SKIP) {
-            auto processor_token = processor->get_processing_token();
-            should_process = are_tokens_compatible(m_token_filter_mask, processor_token);
+        if (plan->needs_cleanup) {
+            cleanup_rejected_processors(buffer);
         }
-
-        if (should_process) {
-            processor->process(buffer);
-        }
-    }
-
-    if (m_enforcement_strategy == TokenEnforcementStrategy::OVERRIDE_REJECT) {
-        cleanup_rejected_processors(buffer);
     }
 
     m_is_processing.store(false, std::memory_order_release);
@@ -194,18 +177,21 @@ void BufferProcessingChain::add_preprocessor(const std::shared_ptr<BufferProcess
 {
     processor->on_attach(buffer);
     m_preprocessors[buffer] = processor;
+    invalidate_plan();
 }
 
 void BufferProcessingChain::add_postprocessor(const std::shared_ptr<BufferProcessor>& processor, const std::shared_ptr<Buffer>& buffer)
 {
     processor->on_attach(buffer);
     m_postprocessors[buffer] = processor;
+    invalidate_plan();
 }
 
 void BufferProcessingChain::add_final_processor(const std::shared_ptr<BufferProcessor>& processor, const std::shared_ptr<Buffer>& buffer)
 {
     processor->on_attach(buffer);
     m_final_processors[buffer] = processor;
+    invalidate_plan();
 }
 
 bool BufferProcessingChain::has_processors(const std::shared_ptr<Buffer>& buffer) const
@@ -249,25 +235,25 @@ BufferProcessingChain::get_final_processor(const std::shared_ptr<Buffer>& buffer
 
 void BufferProcessingChain::preprocess(const std::shared_ptr<Buffer>& buffer)
 {
-    auto pre_it = m_preprocessors.find(buffer);
-    if (pre_it != m_preprocessors.end()) {
-        pre_it->second->process(buffer);
+    compile_if_dirty();
+    if (const auto* plan = find_plan(buffer); plan && plan->pre) {
+        run_single(*plan->pre, buffer, true);
     }
 }
 
 void BufferProcessingChain::postprocess(const std::shared_ptr<Buffer>& buffer)
 {
-    auto post_it = m_postprocessors.find(buffer);
-    if (post_it != m_postprocessors.end()) {
-        post_it->second->process(buffer);
+    compile_if_dirty();
+    if (const auto* plan = find_plan(buffer); plan && plan->post) {
+        run_single(*plan->post, buffer, true);
     }
 }
 
 void BufferProcessingChain::process_final(const std::shared_ptr<Buffer>& buffer)
 {
-    auto final_it = m_final_processors.find(buffer);
-    if (final_it != m_final_processors.end()) {
-        final_it->second->process(buffer);
+    compile_if_dirty();
+    if (const auto* plan = find_plan(buffer); plan && plan->final) {
+        run_single(*plan->final, buffer, true);
     }
 }
 
@@ -287,6 +273,8 @@ void BufferProcessingChain::merge_chain(const std::shared_ptr<BufferProcessingCh
             }
         }
     }
+
+    invalidate_plan();
 }
 
 void BufferProcessingChain::optimize_for_tokens(const std::shared_ptr<Buffer>& buffer)
@@ -315,6 +303,8 @@ void BufferProcessingChain::optimize_for_tokens(const std::shared_ptr<Buffer>& b
     if (m_enforcement_strategy != TokenEnforcementStrategy::STRICT && m_enforcement_strategy != TokenEnforcementStrategy::FILTERED) {
         processors.insert(processors.end(), incompatible_processors.begin(), incompatible_processors.end());
     }
+
+    invalidate_plan();
 }
 
 void BufferProcessingChain::cleanup_rejected_processors(const std::shared_ptr<Buffer>& buffer)
@@ -327,6 +317,7 @@ void BufferProcessingChain::cleanup_rejected_processors(const std::shared_ptr<Bu
     });
 
     m_pending_removal[buffer].clear();
+    invalidate_plan();
 }
 
 std::vector<TokenCompatibilityReport> BufferProcessingChain::analyze_token_compatibility() const
@@ -393,6 +384,8 @@ void BufferProcessingChain::enforce_chain_token_on_processors()
             }
         }
     }
+
+    invalidate_plan();
 }
 
 bool BufferProcessingChain::queue_pending_processor_op(const std::shared_ptr<BufferProcessor>& processor, const std::shared_ptr<Buffer>& buffer, bool is_addition, std::string* rejection_reason)
@@ -418,4 +411,187 @@ bool BufferProcessingChain::queue_pending_processor_op(const std::shared_ptr<Buf
     return false;
 }
 
+// ============================================================================
+// Compiled execution
+// ============================================================================
+
+void BufferProcessingChain::compile_if_dirty()
+{
+    if (m_plan_dirty.exchange(false, std::memory_order_acq_rel)) {
+        compile();
+    }
+}
+
+void BufferProcessingChain::compile()
+{
+    m_plan_processors.clear();
+    m_plan_stages.clear();
+    m_plan_buffers.clear();
+    m_plan_index.clear();
+
+    auto entry_for = [this](const std::shared_ptr<Buffer>& buffer) -> CompiledBuffer& {
+        auto [it, inserted] = m_plan_index.try_emplace(buffer.get(), static_cast<uint32_t>(m_plan_buffers.size()));
+        if (inserted) {
+            m_plan_buffers.push_back({ .audio = dynamic_cast<AudioBuffer*>(buffer.get()) });
+        }
+        return m_plan_buffers[it->second];
+    };
+
+    for (const auto& [buffer, processors] : m_buffer_processors) {
+        if (processors.empty()) {
+            continue;
+        }
+
+        auto& entry = entry_for(buffer);
+        entry.first_stage = static_cast<uint32_t>(m_plan_stages.size());
+
+        for (const auto& processor : processors) {
+            const bool compatible = are_tokens_compatible(m_token_filter_mask, processor->get_processing_token());
+
+            if (!compatible && m_enforcement_strategy == TokenEnforcementStrategy::OVERRIDE_SKIP) {
+                continue;
+            }
+            if (!compatible && m_enforcement_strategy == TokenEnforcementStrategy::OVERRIDE_REJECT) {
+                entry.needs_cleanup = true;
+            }
+
+            const bool elementwise = entry.audio && processor->is_elementwise();
+            const bool extends_run = elementwise
+                && m_plan_stages.size() > entry.first_stage
+                && m_plan_stages.back().fused;
+
+            if (extends_run) {
+                ++m_plan_stages.back().count;
+            } else {
+                m_plan_stages.push_back({ .first = static_cast<uint32_t>(m_plan_processors.size()),
+                    .count = 1,
+                    .fused = elementwise });
+            }
+            m_plan_processors.push_back(processor.get());
+        }
+
+        entry.stage_count = static_cast<uint32_t>(m_plan_stages.size()) - entry.first_stage;
+    }
+
+    // A lone element-wise processor gains nothing from tiling.
+    for (auto& stage : m_plan_stages) {
+        stage.fused = stage.fused && stage.count > 1;
+    }
+
+    for (const auto& [buffer, processor] : m_preprocessors) {
+        entry_for(buffer).pre = processor.get();
+    }
+    for (const auto& [buffer, processor] : m_postprocessors) {
+        entry_for(buffer).post = processor.get();
+    }
+    for (const auto& [buffer, processor] : m_final_processors) {
+        entry_for(buffer).final = processor.get();
+    }
+}
+
+const BufferProcessingChain::CompiledBuffer* BufferProcessingChain::find_plan(const std::shared_ptr<Buffer>& buffer)
+{
+    auto it = m_plan_index.find(buffer.get());
+    return it != m_plan_index.end() ? &m_plan_buffers[it->second] : nullptr;
+}
+
+size_t BufferProcessingChain::get_fused_stage_count(const std::shared_ptr<Buffer>& buffer)
+{
+    compile_if_dirty();
+
+    const auto* plan = find_plan(buffer);
+    if (!plan) {
+        return 0;
+    }
+
+    return std::ranges::count_if(
+        std::span(m_plan_stages).subspan(plan->first_stage, plan->stage_count),
+        &CompiledStage::fused);
+}
+
+void BufferProcessingChain::run_stages(const CompiledBuffer& plan, const std::shared_ptr<Buffer>& buffer, bool owning)
+{
+    const std::span<BufferProcessor* const> processors(m_plan_processors);
+
+    for (const auto& stage : std::span(m_plan_stages).subspan(plan.first_stage, plan.stage_count)) {
+        auto group = processors.subspan(stage.first, stage.count);
+
+        if (stage.fused && run_fused(group, *plan.audio, buffer, owning)) {
+            continue;
+        }
+
+        for (auto* processor : group) {
+            run_single(*processor, buffer, owning);
+        }
+    }
+}
+
+void BufferProcessingChain::run_single(BufferProcessor& processor, const std::shared_ptr<Buffer>& buffer, bool owning)
+{
+    Profile::Zone zone(Profile::Category::BUFFER_PROCESSOR, &processor, typeid(processor));
+    if (owning) {
+        processor.process(buffer);
+    } else {
+        processor.process_non_owning(buffer);
+    }
+}
+
+bool BufferProcessingChain::run_fused(std::span<BufferProcessor* const> group, AudioBuffer& audio, const std::shared_ptr<Buffer>& buffer, bool owning)
+{
+    if (!std::ranges::all_of(group, &BufferProcessor::is_elementwise)) {
+        return false;
+    }
+
+    auto& data = audio.get_data();
+    if (data.empty()) {
+        return true;
+    }
+
+    if (owning && !buffer->try_acquire_processing()) {
+        MF_RT_ERROR(Journal::Component::Buffers, Journal::Context::BufferProcessing,
+            "Buffer is already being processed, skipping fused processors");
+        return true;
+    }
+
+    auto release = [&] {
+        for (auto* processor : group) {
+            processor->m_active_processing.fetch_sub(1, std::memory_order_release);
+        }
+        if (owning) {
+            buffer->release_processing();
+        }
+    };
+
+    Profile::Zone zone(Profile::Category::BUFFER_PROCESSOR, group.front(), "fused_elementwise");
+
+    for (auto* processor : group) {
+        processor->m_active_processing.fetch_add(1, std::memory_order_acquire);
+    }
+
+    try {
+        const std::span<double> samples(data);
+
+        for (auto* processor : group) {
+            processor->begin_elementwise(samples);
+        }
+
+        for (size_t offset = 0; offset < samples.size(); offset += FUSED_TILE_SIZE) {
+            auto tile = samples.subspan(offset, std::min(FUSED_TILE_SIZE, samples.size() - offset));
+            for (auto* processor : group) {
+                processor->process_elements(tile, offset);
+            }
+        }
+
+        for (auto* processor : group) {
+            processor->end_elementwise();
+        }
+    } catch (...) {
+        release();
+        throw;
+    }
+
+    release();
+    return true;
+}
+
 }
@@ -4,6 +4,8 @@
 
 namespace MayaFlux::Buffers {
 
+class AudioBuffer;
+
 /**
  * @class BufferProcessingChain
  * @brief Advanced pipeline manager for multi-stage buffer transformations with backend optimization
@@ -41,6 +43,16 @@ namespace MayaFlux::Buffers {
  * - Provides special "final" processors for guaranteed post-processing operations
  * - Allows dynamic reconfiguration of transformation pipelines at runtime
  * - Leverages processor agency for optimal backend selection and resource utilization
+ *
+ * **Compiled Execution:**
+ * Any change to the chain (adding or removing processors, merging, changing the
+ * preferred token or enforcement strategy) marks it dirty. The next processing call
+ * compiles every buffer's preprocessor, main sequence, postprocessor and final
+ * processor into flat arrays with token filtering already applied, so a cycle costs
+ * one lookup per buffer followed by a linear walk. Adjacent processors that report
+ * BufferProcessor::is_elementwise() on an AudioBuffer are grouped into a single
+ * stage and run tile by tile, so the samples pass through the whole group in one
+ * sweep instead of one sweep per processor.
  */
 class MAYAFLUX_API BufferProcessingChain {
 public:
@@ -252,7 +264,11 @@ public:
      * The token can be used to optimize the entire pipeline based on the expected data type,
      * processing requirements, and available hardware resources.
      */
-    inline void set_preferred_token(ProcessingToken token) { m_token_filter_mask = token; }
+    inline void set_preferred_token(ProcessingToken token)
+    {
+        m_token_filter_mask = token;
+        invalidate_plan();
+    }
 
     /** * @brief Gets the preferred processing token for this chain
      * @return Current preferred processing token
@@ -277,6 +293,7 @@ public:
     inline void set_enforcement_strategy(TokenEnforcementStrategy strategy)
     {
         m_enforcement_strategy = strategy;
+        invalidate_plan();
     }
 
     /**
@@ -341,6 +358,23 @@ public:
         return m_pending_count.load(std::memory_order_relaxed) > 0;
     }
 
+    /**
+     * @brief Forces the execution plan to be rebuilt on the next processing call
+     *
+     * Called automatically by every method that changes the chain. Call it
+     * manually after changing a processor's token or element-wise mode if the
+     * change must take effect on the very next cycle.
+     */
+    inline void invalidate_plan() { m_plan_dirty.store(true, std::memory_order_release); }
+
+    /**
+     * @brief Number of fused element-wise stages in the current plan for a buffer
+     * @param buffer Buffer to query
+     *
+     * Compiles the plan if it is out of date. Intended for diagnostics and tests.
+     */
+    [[nodiscard]] size_t get_fused_stage_count(const std::shared_ptr<Buffer>& buffer);
+
     /**
      * @brief Gets a processor of a specific type from the buffer's processing pipeline
      * @tparam T Type of the processor to retrieve
@@ -392,6 +426,65 @@ private:
 
     bool queue_pending_processor_op(const std::shared_ptr<BufferProcessor>& processor, const std::shared_ptr<Buffer>& buffer, bool is_addition, std::string* rejection_reason = nullptr);
 
+    /**
+     * @struct CompiledStage
+     * @brief Contiguous run of processors in m_plan_processors executed as one step
+     */
+    struct CompiledStage {
+        uint32_t first {};
+        uint32_t count {};
+        bool fused {}; ///< Element-wise run over an AudioBuffer
+    };
+
+    /**
+     * @struct CompiledBuffer
+     * @brief Flattened processing plan for one buffer
+     */
+    struct CompiledBuffer {
+        AudioBuffer* audio {}; ///< Resolved once; null for non-audio buffers
+        BufferProcessor* pre {};
+        BufferProcessor* post {};
+        BufferProcessor* final {};
+        uint32_t first_stage {};
+        uint32_t stage_count {};
+        bool needs_cleanup {}; ///< OVERRIDE_REJECT processors still present
+    };
+
+    /**
+     * @brief Rebuilds the plan if the chain changed since it was last compiled
+     */
+    void compile_if_dirty();
+
+    /**
+     * @brief Rebuilds the flattened plan for every buffer known to the chain
+     */
+    void compile();
+
+    /**
+     * @brief Looks up the compiled plan for a buffer
+     * @return Plan entry or nullptr if the buffer has no processors of any kind
+     */
+    const CompiledBuffer* find_plan(const std::shared_ptr<Buffer>& buffer);
+
+    /**
+     * @brief Runs the main processor sequence of a compiled buffer
+     * @param plan Compiled plan for @p buffer
+     * @param buffer Buffer to process
+     * @param owning Whether processors acquire the buffer (process) or not (process_non_owning)
+     */
+    void run_stages(const CompiledBuffer& plan, const std::shared_ptr<Buffer>& buffer, bool owning);
+
+    /**
+     * @brief Runs one fused element-wise stage tile by tile
+     * @return false if any processor declined this cycle and the stage must run unfused
+     */
+    bool run_fused(std::span<BufferProcessor* const> group, AudioBuffer& audio, const std::shared_ptr<Buffer>& buffer, bool owning);
+
+    /**
+     * @brief Runs a single processor with profiling
+     */
+    static void run_single(BufferProcessor& processor, const std::shared_ptr<Buffer>& buffer, bool owning);
+
     /**
      * @brief Map of buffers to their processor sequences
      *
@@ -468,5 +561,14 @@ private:
     PendingProcessorOp m_pending_ops[MAX_PENDING_PROCESSORS];
 
     std::atomic<uint32_t> m_pending_count { 0 };
+
+    /** @brief Samples per tile when running fused element-wise stages */
+    static constexpr size_t FUSED_TILE_SIZE = 256;
+
+    std::atomic<bool> m_plan_dirty { true };
+    std::vector<BufferProcessor*> m_plan_processors;
+    std::vector<CompiledStage> m_plan_stages;
+    std::vector<CompiledBuffer> m_plan_buffers;
+    std::unordered_map<const Buffer*, uint32_t> m_plan_index;
 };
 }
@@ -179,6 +179,39 @@ public:
      */
     virtual bool is_compatible_with(const std::shared_ptr<Buffer>&) const { return true; }
 
+    /**
+     * @brief Whether this processor currently behaves as a per-sample map over audio data
+     * @return True if the element-wise entry points below reproduce processing_function()
+     *
+     * BufferProcessingChain fuses runs of adjacent element-wise processors on an
+     * AudioBuffer into a single pass: each processor gets begin_elementwise() once,
+     * then every cache-sized tile of the buffer is passed through the whole run
+     * with process_elements() before the next tile is touched, then
+     * end_elementwise(). The result must be identical to calling
+     * processing_function() on each processor in turn.
+     *
+     * Queried when the chain is compiled and again every cycle before fusing,
+     * so processors whose mode can change at runtime may answer differently
+     * from one cycle to the next. Default is false.
+     */
+    [[nodiscard]] virtual bool is_elementwise() const { return false; }
+
+    /**
+     * @brief Per-cycle setup before fused element-wise processing
+     * @param samples The whole buffer about to be processed
+     */
+    virtual void begin_elementwise(std::span<double> /*samples*/) { }
+
+    /**
+     * @brief Processes one tile of samples in place
+     * @param samples Tile to transform
+     * @param offset  Position of the tile's first sample in the buffer
+     */
+    virtual void process_elements(std::span<double> /*samples*/, size_t /*offset*/) { }
+
+    /// @brief Per-cycle teardown after fused element-wise processing.
+    virtual void end_elementwise() { }
+
 protected:
     ProcessingToken m_processing_token { ProcessingToken::AUDIO_BACKEND };
 
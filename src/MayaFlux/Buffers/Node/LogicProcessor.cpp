@@ -182,6 +182,100 @@ void LogicProcessor::processing_function(const std::shared_ptr<Buffer>& buffer)
     apply(buffer);
 }
 
+bool LogicProcessor::is_elementwise() const
+{
+    if (!m_logic) {
+        return false;
+    }
+
+    switch (m_modulation_type) {
+    case ModulationType::HOLD_ON_FALSE:
+    case ModulationType::SAMPLE_AND_HOLD:
+        return false;
+    case ModulationType::CUSTOM:
+        return static_cast<bool>(m_modulation_function);
+    default:
+        return true;
+    }
+}
+
+void LogicProcessor::begin_elementwise(std::span<double> samples)
+{
+    if (m_pending_logic) {
+        m_logic = m_pending_logic;
+        m_pending_logic.reset();
+        m_use_internal = true;
+    }
+
+    m_logic_data.resize(samples.size(), 0);
+
+    if (m_reset_between_buffers) {
+        m_logic->reset();
+    }
+
+    m_restore_after_elements = m_logic->m_state.load() != Nodes::NodeState::INACTIVE;
+    if (m_restore_after_elements) {
+        m_logic->save_state();
+    }
+
+    m_has_generated_data = true;
+}
+
+void LogicProcessor::process_elements(std::span<double> samples, size_t offset)
+{
+    const std::span<double> logic(m_logic_data.data() + offset, samples.size());
+    for (size_t i = 0; i < samples.size(); ++i) {
+        logic[i] = m_logic->process_sample(samples[i]);
+    }
+
+    switch (m_modulation_type) {
+    case ModulationType::REPLACE:
+        std::ranges::copy(logic, samples.begin());
+        break;
+    case ModulationType::MULTIPLY:
+    case ModulationType::CROSSFADE:
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] *= logic[i];
+        }
+        break;
+    case ModulationType::ADD:
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] += logic[i];
+        }
+        break;
+    case ModulationType::INVERT_ON_TRUE:
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = logic[i] > 0.5 ? -samples[i] : samples[i];
+        }
+        break;
+    case ModulationType::ZERO_ON_FALSE:
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = logic[i] > 0.5 ? samples[i] : 0.0;
+        }
+        break;
+    case ModulationType::THRESHOLD_REMAP:
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = logic[i] > 0.5 ? m_high_value : m_low_value;
+        }
+        break;
+    case ModulationType::CUSTOM:
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = m_modulation_function(logic[i], samples[i]);
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void LogicProcessor::end_elementwise()
+{
+    if (m_restore_after_elements) {
+        m_logic->restore_state();
+        m_restore_after_elements = false;
+    }
+}
+
 void LogicProcessor::on_attach(const std::shared_ptr<Buffer>& /*buffer*/)
 {
     if (m_logic) {
@@ -134,6 +134,19 @@ public:
      */
     inline void on_detach(const std::shared_ptr<Buffer>&) override { }
 
+    /**
+     * @brief Every modulation type except HOLD_ON_FALSE and SAMPLE_AND_HOLD can be fused
+     *
+     * Those two seed their held value from the first sample of the buffer, so
+     * they always run through processing_function(). Logic data is still
+     * recorded for get_logic_data() when fused.
+     */
+    [[nodiscard]] bool is_elementwise() const override;
+
+    void begin_elementwise(std::span<double> samples) override;
+    void process_elements(std::span<double> samples, size_t offset) override;
+    void end_elementwise() override;
+
     /**
      * @brief Generates discrete logic data from input without modifying any buffer
      * @param num_samples Number of samples to generate
@@ -314,6 +327,7 @@ private:
     double m_low_value; ///< Low value for THRESHOLD_REMAP
     double m_last_held_value; ///< Last held value for HOLD_ON_FALSE and SAMPLE_AND_HOLD
     double m_last_logic_value; ///< Previous logic value for change detection
+    bool m_restore_after_elements {}; ///< Node state was saved in begin_elementwise()
 };
 
 } // namespace MayaFlux::Buffers
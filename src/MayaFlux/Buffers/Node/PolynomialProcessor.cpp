@@ -75,6 +75,45 @@ void PolynomialProcessor::processing_function(const std::shared_ptr<Buffer>& buf
     }
 }
 
+bool PolynomialProcessor::is_elementwise() const
+{
+    return m_polynomial
+        && (m_process_mode == ProcessMode::SAMPLE_BY_SAMPLE || m_process_mode == ProcessMode::BATCH);
+}
+
+void PolynomialProcessor::begin_elementwise(std::span<double> /*samples*/)
+{
+    if (m_pending_polynomial) {
+        m_polynomial = m_pending_polynomial;
+        m_pending_polynomial.reset();
+        m_use_internal = true;
+    }
+
+    if (m_process_mode == ProcessMode::BATCH) {
+        m_polynomial->reset();
+    }
+
+    m_restore_after_elements = m_polynomial->m_state.load() != Nodes::NodeState::INACTIVE;
+    if (m_restore_after_elements) {
+        m_polynomial->save_state();
+    }
+}
+
+void PolynomialProcessor::process_elements(std::span<double> samples, size_t /*offset*/)
+{
+    for (double& sample : samples) {
+        sample = m_polynomial->process_sample(sample);
+    }
+}
+
+void PolynomialProcessor::end_elementwise()
+{
+    if (m_restore_after_elements) {
+        m_polynomial->restore_state();
+        m_restore_after_elements = false;
+    }
+}
+
 void PolynomialProcessor::on_attach(const std::shared_ptr<Buffer>& /*buffer*/)
 {
     m_polynomial->reset();
@@ -77,6 +77,18 @@ public:
      */
     inline void on_detach(const std::shared_ptr<Buffer>&) override { }
 
+    /**
+     * @brief SAMPLE_BY_SAMPLE and BATCH modes are per-sample maps and can be fused
+     *
+     * WINDOWED resets the polynomial at window boundaries and BUFFER_CONTEXT needs
+     * the whole buffer, so both always run through processing_function().
+     */
+    [[nodiscard]] bool is_elementwise() const override;
+
+    void begin_elementwise(std::span<double> samples) override;
+    void process_elements(std::span<double> samples, size_t offset) override;
+    void end_elementwise() override;
+
     /**
      * @brief Sets the processing mode
      * @param mode New processing mode
@@ -150,6 +162,7 @@ private:
 
     bool m_use_internal {}; ///< Whether to use the buffer's internal previous state
     std::shared_ptr<Nodes::Generator::Polynomial> m_pending_polynomial; ///< Internal polynomial node
+    bool m_restore_after_elements {}; ///< Node state was saved in begin_elementwise()
 
     /**
      * @brief Processes a span of data using the polynomial function
@@ -0,0 +1,100 @@
+#include "AudioReceiveBuffer.hpp"
+
+#include "MayaFlux/Journal/Archivist.hpp"
+#include "MayaFlux/Registry/BackendRegistry.hpp"
+#include "MayaFlux/Registry/Service/NetworkService.hpp"
+
+namespace MayaFlux::Buffers {
+
+AudioReceiveProcessor::AudioReceiveProcessor(std::shared_ptr<Portal::Network::AudioJitterBuffer> jitter)
+    : m_jitter(std::move(jitter))
+{
+}
+
+void AudioReceiveProcessor::processing_function(const std::shared_ptr<Buffer>& buffer)
+{
+    auto audio_buffer = std::dynamic_pointer_cast<AudioBuffer>(buffer);
+    if (!audio_buffer || !m_jitter) {
+        return;
+    }
+
+    m_jitter->pull(audio_buffer->get_data());
+}
+
+bool AudioReceiveProcessor::is_compatible_with(const std::shared_ptr<Buffer>& buffer) const
+{
+    return std::dynamic_pointer_cast<AudioBuffer>(buffer) != nullptr;
+}
+
+AudioReceiveBuffer::AudioReceiveBuffer(
+    uint32_t channel_id,
+    uint32_t num_samples,
+    Portal::Network::JitterBufferConfig config)
+    : AudioBuffer(channel_id, num_samples)
+    , m_jitter(std::make_shared<Portal::Network::AudioJitterBuffer>(std::move(config)))
+{
+}
+
+AudioReceiveBuffer::~AudioReceiveBuffer()
+{
+    stop_listening();
+}
+
+void AudioReceiveBuffer::setup_processors(ProcessingToken /*token*/)
+{
+    m_default_processor = create_default_processor();
+    m_default_processor->on_attach(shared_from_this());
+}
+
+std::shared_ptr<BufferProcessor> AudioReceiveBuffer::create_default_processor()
+{
+    return std::make_shared<AudioReceiveProcessor>(m_jitter);
+}
+
+bool AudioReceiveBuffer::listen(uint16_t local_port)
+{
+    stop_listening();
+
+    auto* svc = Registry::BackendRegistry::instance()
+                    .get_service<Registry::Service::NetworkService>();
+    if (!svc) {
+        MF_WARN(Journal::Component::Buffers, Journal::Context::Networking,
+            "AudioReceiveBuffer: NetworkService not available");
+        return false;
+    }
+
+    Core::EndpointInfo info;
+    info.transport = Core::NetworkTransport::UDP;
+    info.role = Core::EndpointRole::RECEIVE;
+    info.local_port = local_port;
+    info.label = "audio_receive";
+
+    const uint64_t id = svc->open_endpoint(info);
+    if (id == 0) {
+        MF_WARN(Journal::Component::Buffers, Journal::Context::Networking,
+            "AudioReceiveBuffer: failed to open UDP port {}", local_port);
+        return false;
+    }
+
+    // The callback owns the jitter buffer so a late datagram never outlives it.
+    svc->set_endpoint_receive_callback(id,
+        [jitter = m_jitter](uint64_t, const uint8_t* data, size_t size, std::string_view) {
+            jitter->push(Portal::Network::ByteView(data, size));
+        });
+
+    m_service = svc;
+    m_endpoint_id = id;
+    return true;
+}
+
+void AudioReceiveBuffer::stop_listening()
+{
+    if (m_endpoint_id == 0 || !m_service) {
+        return;
+    }
+    m_service->close_endpoint(m_endpoint_id);
+    m_endpoint_id = 0;
+    m_service = nullptr;
+}
+
+} // namespace MayaFlux::Buffers
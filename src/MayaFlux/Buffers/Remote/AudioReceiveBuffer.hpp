@@ -0,0 +1,112 @@
+#pragma once
+
+#include "MayaFlux/Buffers/AudioBuffer.hpp"
+#include "MayaFlux/Buffers/BufferProcessor.hpp"
+#include "MayaFlux/Portal/Network/AudioJitterBuffer.hpp"
+
+namespace MayaFlux::Registry::Service {
+struct NetworkService;
+}
+
+namespace MayaFlux::Buffers {
+
+/**
+ * @class AudioReceiveProcessor
+ * @brief Pulls one block of playout audio from an AudioJitterBuffer each cycle.
+ *
+ * Overwrites the buffer. Never blocks or allocates; while the jitter buffer
+ * is still filling, or has nothing to play, the buffer is silent.
+ */
+class MAYAFLUX_API AudioReceiveProcessor : public BufferProcessor {
+public:
+    explicit AudioReceiveProcessor(std::shared_ptr<Portal::Network::AudioJitterBuffer> jitter);
+
+    void processing_function(const std::shared_ptr<Buffer>& buffer) override;
+
+    [[nodiscard]] bool is_compatible_with(const std::shared_ptr<Buffer>& buffer) const override;
+
+private:
+    std::shared_ptr<Portal::Network::AudioJitterBuffer> m_jitter;
+};
+
+/**
+ * @class AudioReceiveBuffer
+ * @brief AudioBuffer fed by a stream of audio packets from another instance.
+ *
+ * Receiving counterpart to AudioSendProcessor. Datagrams are handed to an
+ * owned Portal::Network::AudioJitterBuffer from the network thread; the
+ * default processor pulls playout audio on the audio thread. Reordering,
+ * loss concealment, adaptive delay and clock drift are all handled there;
+ * see AudioJitterBuffer for the policy and AudioStreamStats for what is
+ * measured.
+ *
+ * listen() opens a UDP endpoint through NetworkService and wires it up.
+ * Anything else that receives datagrams (a shared socket, a test harness)
+ * can call receive() directly instead.
+ *
+ * @code
+ * auto input = std::make_shared<AudioReceiveBuffer>(0, 128,
+ *     Portal::Network::JitterBufferConfig { .max_delay_ms = 10.0 });
+ * input->setup_processors(ProcessingToken::AUDIO_BACKEND);
+ * input->listen(9100);
+ *
+ * // later
+ * auto stats = input->get_stats();
+ * MF_INFO(..., "net audio: {:.2f} ms buffered, {:.2f} ms jitter, {} lost",
+ *     stats.buffered_ms, stats.jitter_ms, stats.packets_lost);
+ * @endcode
+ */
+class MAYAFLUX_API AudioReceiveBuffer : public AudioBuffer {
+public:
+    /**
+     * @param channel_id  Channel identifier for this buffer
+     * @param num_samples Buffer size in samples
+     * @param config      Playout policy; sample_rate is the local rate
+     */
+    AudioReceiveBuffer(
+        uint32_t channel_id,
+        uint32_t num_samples,
+        Portal::Network::JitterBufferConfig config = {});
+
+    ~AudioReceiveBuffer() override;
+
+    AudioReceiveBuffer(const AudioReceiveBuffer&) = delete;
+    AudioReceiveBuffer& operator=(const AudioReceiveBuffer&) = delete;
+    AudioReceiveBuffer(AudioReceiveBuffer&&) = delete;
+    AudioReceiveBuffer& operator=(AudioReceiveBuffer&&) = delete;
+
+    void setup_processors(ProcessingToken token) override;
+
+    /**
+     * @brief Open a UDP endpoint on @p local_port and feed it into this buffer.
+     * @return false if NetworkService is unavailable or the port cannot be bound.
+     *
+     * Replaces any endpoint opened by an earlier call.
+     */
+    bool listen(uint16_t local_port);
+
+    /// @brief Close the endpoint opened by listen(), if any.
+    void stop_listening();
+
+    /**
+     * @brief Hand one received datagram to the jitter buffer.
+     *
+     * Call from a single network thread.
+     */
+    bool receive(Portal::Network::ByteView datagram) { return m_jitter->push(datagram); }
+
+    [[nodiscard]] Portal::Network::AudioStreamStats get_stats() const { return m_jitter->get_stats(); }
+
+    [[nodiscard]] std::shared_ptr<Portal::Network::AudioJitterBuffer> get_jitter_buffer() const { return m_jitter; }
+
+protected:
+    std::shared_ptr<BufferProcessor> create_default_processor() override;
+
+private:
+    std::shared_ptr<Portal::Network::AudioJitterBuffer> m_jitter;
+
+    uint64_t m_endpoint_id {};
+    Registry::Service::NetworkService* m_service {};
+};
+
+} // namespace MayaFlux::Buffers
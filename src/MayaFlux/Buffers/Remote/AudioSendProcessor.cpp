@@ -0,0 +1,98 @@
+#include "AudioSendProcessor.hpp"
+
+#include "MayaFlux/Buffers/AudioBuffer.hpp"
+#include "MayaFlux/Journal/Archivist.hpp"
+#include "MayaFlux/Portal/Network/NetworkSink.hpp"
+
+namespace MayaFlux::Buffers {
+
+AudioSendProcessor::AudioSendProcessor(
+    std::shared_ptr<Portal::Network::NetworkSink> sink,
+    AudioSendConfig config)
+    : m_config(config)
+    , m_sink(std::move(sink))
+{
+    validate_config();
+
+    if (m_sink) {
+        m_writer = [sink = m_sink.get()](Portal::Network::ByteView bytes) {
+            return sink->send(bytes);
+        };
+    }
+
+    m_packet.resize(Portal::Network::audio_packet_size(m_config.format, m_config.frames_per_packet));
+}
+
+AudioSendProcessor::AudioSendProcessor(PacketWriter writer, AudioSendConfig config)
+    : m_config(config)
+    , m_writer(std::move(writer))
+{
+    validate_config();
+    m_packet.resize(Portal::Network::audio_packet_size(m_config.format, m_config.frames_per_packet));
+}
+
+void AudioSendProcessor::validate_config() const
+{
+    if (m_config.frames_per_packet == 0
+        || m_config.frames_per_packet > Portal::Network::MAX_AUDIO_PACKET_FRAMES) {
+        error<std::invalid_argument>(
+            Journal::Component::Buffers,
+            Journal::Context::Init,
+            std::source_location::current(),
+            "AudioSendProcessor frames_per_packet must be in [1, {}], got {}",
+            Portal::Network::MAX_AUDIO_PACKET_FRAMES, m_config.frames_per_packet);
+    }
+
+    if (m_config.sample_rate == 0) {
+        error<std::invalid_argument>(
+            Journal::Component::Buffers,
+            Journal::Context::Init,
+            std::source_location::current(),
+            "AudioSendProcessor sample_rate must be non-zero");
+    }
+}
+
+void AudioSendProcessor::processing_function(const std::shared_ptr<Buffer>& buffer)
+{
+    if (!m_writer) {
+        return;
+    }
+
+    auto audio_buffer = std::dynamic_pointer_cast<AudioBuffer>(buffer);
+    if (!audio_buffer) {
+        return;
+    }
+
+    const std::span<const double> data(audio_buffer->get_data());
+    const auto send_time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+                               .count();
+
+    Portal::Network::AudioPacketHeader header;
+    header.format = m_config.format;
+    header.stream_id = m_config.stream_id;
+    header.sample_rate = m_config.sample_rate;
+    header.send_time_ns = send_time;
+
+    for (size_t offset = 0; offset < data.size(); offset += m_config.frames_per_packet) {
+        const auto chunk = data.subspan(offset, std::min<size_t>(m_config.frames_per_packet, data.size() - offset));
+
+        header.sequence = m_sequence++;
+        header.timestamp = m_timestamp;
+        m_timestamp += chunk.size();
+
+        const size_t size = Portal::Network::encode_audio_packet(header, chunk, m_packet);
+        if (size == 0 || !m_writer(Portal::Network::ByteView(m_packet.data(), size))) {
+            m_send_failures.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        m_packets_sent.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+bool AudioSendProcessor::is_compatible_with(const std::shared_ptr<Buffer>& buffer) const
+{
+    return std::dynamic_pointer_cast<AudioBuffer>(buffer) != nullptr;
+}
+
+} // namespace MayaFlux::Buffers
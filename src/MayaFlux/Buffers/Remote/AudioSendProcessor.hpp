@@ -0,0 +1,94 @@
+#pragma once
+
+#include "MayaFlux/Buffers/BufferProcessor.hpp"
+#include "MayaFlux/Portal/Network/AudioPacket.hpp"
+
+namespace MayaFlux::Portal::Network {
+class NetworkSink;
+}
+
+namespace MayaFlux::Buffers {
+
+/**
+ * @struct AudioSendConfig
+ * @brief Packetisation settings for AudioSendProcessor.
+ */
+struct MAYAFLUX_API AudioSendConfig {
+    Portal::Network::AudioSampleFormat format { Portal::Network::AudioSampleFormat::FLOAT32 };
+    uint16_t frames_per_packet { 64 }; ///< 1.33 ms at 48 kHz
+    uint32_t stream_id {};
+    uint32_t sample_rate { 48000 };
+};
+
+/**
+ * @class AudioSendProcessor
+ * @brief Streams an AudioBuffer to another MayaFlux instance as audio packets.
+ *
+ * Each cycle the buffer is cut into frames_per_packet chunks and every chunk
+ * becomes one sequence-numbered, timestamped datagram (see AudioPacket.hpp).
+ * The processor leaves the buffer untouched, so it can sit anywhere in a
+ * chain and the local signal keeps flowing.
+ *
+ * Packets go either to a Portal::Network::NetworkSink or to any callable
+ * that accepts the encoded bytes, which is how tests and custom transports
+ * plug in. Encoding reuses one scratch packet and never allocates; whatever
+ * the transport does with the bytes is up to the transport.
+ *
+ * Pair with AudioReceiveBuffer on the receiving side.
+ *
+ * @code
+ * auto sink = std::make_shared<Portal::Network::NetworkSink>(
+ *     Portal::Network::StreamConfig {
+ *         .name = "render_b",
+ *         .endpoint = { .address = "10.0.0.2", .port = 9100 },
+ *         .profile = Portal::Network::StreamProfile::REALTIME_SMALL,
+ *         .transport = Portal::Network::NetworkTransportHint::UDP,
+ *     });
+ *
+ * auto sender = std::make_shared<AudioSendProcessor>(sink,
+ *     AudioSendConfig { .format = Portal::Network::AudioSampleFormat::PCM24 });
+ * buffer->get_processing_chain()->add_processor(sender, buffer);
+ * @endcode
+ */
+class MAYAFLUX_API AudioSendProcessor : public BufferProcessor {
+public:
+    using PacketWriter = std::function<bool(Portal::Network::ByteView)>;
+
+    /**
+     * @brief Send through an open NetworkSink.
+     */
+    explicit AudioSendProcessor(
+        std::shared_ptr<Portal::Network::NetworkSink> sink,
+        AudioSendConfig config = {});
+
+    /**
+     * @brief Send through an arbitrary writer.
+     * @param writer Called once per packet on the processing thread.
+     */
+    explicit AudioSendProcessor(PacketWriter writer, AudioSendConfig config = {});
+
+    void processing_function(const std::shared_ptr<Buffer>& buffer) override;
+
+    [[nodiscard]] bool is_compatible_with(const std::shared_ptr<Buffer>& buffer) const override;
+
+    [[nodiscard]] const AudioSendConfig& get_config() const { return m_config; }
+
+    [[nodiscard]] uint64_t get_packets_sent() const { return m_packets_sent.load(std::memory_order_relaxed); }
+    [[nodiscard]] uint64_t get_send_failures() const { return m_send_failures.load(std::memory_order_relaxed); }
+
+private:
+    AudioSendConfig m_config;
+    std::shared_ptr<Portal::Network::NetworkSink> m_sink;
+    PacketWriter m_writer;
+
+    std::vector<uint8_t> m_packet;
+    uint32_t m_sequence {};
+    uint64_t m_timestamp {};
+
+    std::atomic<uint64_t> m_packets_sent {};
+    std::atomic<uint64_t> m_send_failures {};
+
+    void validate_config() const;
+};
+
+} // namespace MayaFlux::Buffers
@@ -0,0 +1,61 @@
+#include "GainProcessor.hpp"
+
+#include "MayaFlux/Buffers/AudioBuffer.hpp"
+
+namespace MayaFlux::Buffers {
+
+GainProcessor::GainProcessor(double gain)
+    : m_target(gain)
+    , m_current(gain)
+{
+}
+
+void GainProcessor::processing_function(const std::shared_ptr<Buffer>& buffer)
+{
+    auto audio_buffer = std::dynamic_pointer_cast<AudioBuffer>(buffer);
+    if (!audio_buffer || audio_buffer->get_data().empty()) {
+        return;
+    }
+
+    std::span<double> samples(audio_buffer->get_data());
+    begin_elementwise(samples);
+    process_elements(samples, 0);
+    end_elementwise();
+}
+
+bool GainProcessor::is_compatible_with(const std::shared_ptr<Buffer>& buffer) const
+{
+    return std::dynamic_pointer_cast<AudioBuffer>(buffer) != nullptr;
+}
+
+void GainProcessor::begin_elementwise(std::span<double> samples)
+{
+    const double target = m_target.load(std::memory_order_relaxed);
+    m_start = m_current;
+    m_step = samples.empty() ? 0.0 : (target - m_current) / static_cast<double>(samples.size());
+    m_current = target;
+}
+
+void GainProcessor::process_elements(std::span<double> samples, size_t offset)
+{
+    if (m_step == 0.0) {
+        for (double& sample : samples) {
+            sample *= m_start;
+        }
+        return;
+    }
+
+    // Indexed rather than accumulated so the ramp is identical however it is tiled.
+    const double base = m_start + m_step * static_cast<double>(offset + 1);
+    for (size_t i = 0; i < samples.size(); ++i) {
+        samples[i] *= base + m_step * static_cast<double>(i);
+    }
+}
+
+void GainProcessor::end_elementwise()
+{
+    m_start = m_current;
+    m_step = 0.0;
+}
+
+} // namespace MayaFlux::Buffers
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "MayaFlux/Buffers/BufferProcessor.hpp"
+
+namespace MayaFlux::Buffers {
+
+/**
+ * @class GainProcessor
+ * @brief Scales every sample of an audio buffer by a gain factor
+ *
+ * The gain can be changed from any thread while audio is running. Changes
+ * are ramped linearly across the next buffer to avoid zipper noise. As a
+ * pure per-sample map it is fused with adjacent element-wise processors
+ * (PolynomialProcessor, LogicProcessor) by BufferProcessingChain.
+ */
+class MAYAFLUX_API GainProcessor : public BufferProcessor {
+public:
+    /**
+     * @param gain Linear gain factor
+     */
+    explicit GainProcessor(double gain = 1.0);
+
+    void processing_function(const std::shared_ptr<Buffer>& buffer) override;
+
+    [[nodiscard]] bool is_compatible_with(const std::shared_ptr<Buffer>& buffer) const override;
+
+    [[nodiscard]] inline bool is_elementwise() const override { return true; }
+
+    void begin_elementwise(std::span<double> samples) override;
+    void process_elements(std::span<double> samples, size_t offset) override;
+    void end_elementwise() override;
+
+    inline void set_gain(double gain) { m_target.store(gain, std::memory_order_relaxed); }
+    [[nodiscard]] inline double get_gain() const { return m_target.load(std::memory_order_relaxed); }
+
+    /// @brief Sets the gain in decibels.
+    inline void set_gain_db(double db) { set_gain(std::pow(10.0, db / 20.0)); }
+
+private:
+    std::atomic<double> m_target;
+    double m_current; ///< Gain applied at the end of the last buffer
+    double m_start {}; ///< Ramp start for the buffer in flight
+    double m_step {}; ///< Per-sample ramp increment for the buffer in flight
+};
+
+} // namespace MayaFlux::Buffers
@@ -0,0 +1,56 @@
+#include "FeatureProcessor.hpp"
+
+#include "MayaFlux/Buffers/AudioBuffer.hpp"
+#include "MayaFlux/Nodes/Conduit/Constant.hpp"
+
+namespace MayaFlux::Buffers {
+
+FeatureProcessor::FeatureProcessor(Kinesis::Discrete::FeatureConfig config)
+    : m_engine(std::move(config))
+{
+    m_processing_token = ProcessingToken::AUDIO_BACKEND;
+
+    m_nodes.reserve(m_engine.layout().stride);
+    for (uint32_t i = 0; i < m_engine.layout().stride; ++i)
+        m_nodes.push_back(std::make_shared<Nodes::Constant>(0.0));
+
+    m_publish = [this](std::span<const double> frame) {
+        for (size_t i = 0; i < frame.size(); ++i)
+            m_nodes[i]->set_constant(frame[i]);
+        ++m_frame_count;
+    };
+}
+
+void FeatureProcessor::processing_function(const std::shared_ptr<Buffer>& buffer)
+{
+    auto audio_buffer = std::dynamic_pointer_cast<AudioBuffer>(buffer);
+    if (!audio_buffer)
+        return;
+
+    const auto& data = audio_buffer->get_data();
+    if (data.empty())
+        return;
+
+    m_engine.process(data, m_publish);
+}
+
+void FeatureProcessor::on_attach(const std::shared_ptr<Buffer>& /*buffer*/)
+{
+    m_engine.reset();
+    m_frame_count = 0;
+}
+
+bool FeatureProcessor::is_compatible_with(const std::shared_ptr<Buffer>& buffer) const
+{
+    return std::dynamic_pointer_cast<AudioBuffer>(buffer) != nullptr;
+}
+
+std::shared_ptr<Nodes::Constant> FeatureProcessor::get_node(Kinesis::Discrete::Descriptor descriptor, size_t index) const
+{
+    const auto& layout = m_engine.layout();
+    if (index >= layout.width_of(descriptor))
+        return nullptr;
+    return m_nodes[layout.offset_of(descriptor) + index];
+}
+
+} // namespace MayaFlux::Buffers
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "MayaFlux/Buffers/BufferProcessor.hpp"
+#include "MayaFlux/Kinesis/Discrete/Features.hpp"
+
+namespace MayaFlux::Nodes {
+class Constant;
+}
+
+namespace MayaFlux::Buffers {
+
+/**
+ * @class FeatureProcessor
+ * @brief Streams an audio buffer through a FeatureEngine and publishes
+ *        each descriptor as a control-rate node
+ *
+ * Every output slot of the configured layout (one per scalar descriptor,
+ * mfcc_count for MFCC, 12 for CHROMA) is backed by a Nodes::Constant whose
+ * value is replaced once per analysis hop. The nodes can be wired into
+ * parameter mappings, node textures or on_tick() callbacks like any other
+ * node; they change only on hop boundaries.
+ *
+ * The buffer itself is left untouched. Attach one processor per channel.
+ *
+ * @code
+ * auto features = std::make_shared<FeatureProcessor>(Kinesis::Discrete::FeatureConfig {
+ *     .descriptors = { Descriptor::RMS, Descriptor::CENTROID } });
+ * buffer->get_processing_chain()->add_processor(features, buffer);
+ * auto brightness = features->get_node(Descriptor::CENTROID);
+ * @endcode
+ */
+class MAYAFLUX_API FeatureProcessor : public BufferProcessor {
+public:
+    explicit FeatureProcessor(Kinesis::Discrete::FeatureConfig config = {});
+
+    void processing_function(const std::shared_ptr<Buffer>& buffer) override;
+
+    void on_attach(const std::shared_ptr<Buffer>& buffer) override;
+
+    [[nodiscard]] bool is_compatible_with(const std::shared_ptr<Buffer>& buffer) const override;
+
+    /**
+     * @brief Node carrying one descriptor component
+     * @param descriptor Descriptor to read
+     * @param index      Component for MFCC / CHROMA, 0 otherwise
+     * @return The node, or nullptr if the descriptor was not configured
+     */
+    [[nodiscard]] std::shared_ptr<Nodes::Constant> get_node(Kinesis::Discrete::Descriptor descriptor, size_t index = 0) const;
+
+    /// @brief Descriptors of the most recent hop, laid out per get_layout().
+    [[nodiscard]] inline std::span<const double> get_latest() const { return m_engine.latest(); }
+
+    [[nodiscard]] inline const Kinesis::Discrete::FeatureLayout& get_layout() const { return m_engine.layout(); }
+
+    /// @brief Hops analysed since construction or attach.
+    [[nodiscard]] inline size_t get_frame_count() const { return m_frame_count; }
+
+private:
+    Kinesis::Discrete::FeatureEngine m_engine;
+    std::vector<std::shared_ptr<Nodes::Constant>> m_nodes;
+    std::function<void(std::span<const double>)> m_publish;
+    size_t m_frame_count {};
+};
+
+} // namespace MayaFlux::Buffers
@@ -0,0 +1,99 @@
+#include "SpectralProcessor.hpp"
+
+#include "MayaFlux/Buffers/AudioBuffer.hpp"
+
+namespace MayaFlux::Buffers {
+
+// ============================================================================
+// SpectralProcessor
+// ============================================================================
+
+SpectralProcessor::SpectralProcessor(Kinesis::Discrete::SpectrumProcessor processor,
+    uint32_t window_size, uint32_t hop_size, Kinesis::Discrete::SpectralWindow window)
+    : m_stft(window_size, hop_size, window)
+    , m_processor(std::move(processor))
+{
+    m_processing_token = ProcessingToken::AUDIO_BACKEND;
+}
+
+void SpectralProcessor::processing_function(const std::shared_ptr<Buffer>& buffer)
+{
+    auto audio_buffer = std::dynamic_pointer_cast<AudioBuffer>(buffer);
+    if (!audio_buffer)
+        return;
+
+    auto& data = audio_buffer->get_data();
+    if (data.empty())
+        return;
+
+    m_stft.process(data, m_processor);
+}
+
+void SpectralProcessor::on_attach(const std::shared_ptr<Buffer>& /*buffer*/)
+{
+    reset();
+}
+
+bool SpectralProcessor::is_compatible_with(const std::shared_ptr<Buffer>& buffer) const
+{
+    return std::dynamic_pointer_cast<AudioBuffer>(buffer) != nullptr;
+}
+
+void SpectralProcessor::reset()
+{
+    m_stft.reset();
+}
+
+// ============================================================================
+// PitchShiftProcessor
+// ============================================================================
+
+PitchShiftProcessor::PitchShiftProcessor(double semitones, uint32_t window_size, uint32_t hop_size,
+    Kinesis::Discrete::SpectralWindow window)
+    : PitchShiftProcessor(
+          std::make_shared<Kinesis::Discrete::StreamingPitchShift>(semitones, window_size, hop_size),
+          window_size, hop_size, window)
+{
+}
+
+PitchShiftProcessor::PitchShiftProcessor(std::shared_ptr<Kinesis::Discrete::StreamingPitchShift> shift,
+    uint32_t window_size, uint32_t hop_size, Kinesis::Discrete::SpectralWindow window)
+    : SpectralProcessor(
+          [raw = shift.get()](std::vector<std::complex<double>>& spectrum, size_t frame) {
+              (*raw)(spectrum, frame);
+          },
+          window_size, hop_size, window)
+    , m_shift(std::move(shift))
+{
+}
+
+void PitchShiftProcessor::reset()
+{
+    SpectralProcessor::reset();
+    m_shift->reset();
+}
+
+// ============================================================================
+// SpectralGateProcessor
+// ============================================================================
+
+SpectralGateProcessor::SpectralGateProcessor(double threshold_db, uint32_t window_size, uint32_t hop_size,
+    Kinesis::Discrete::SpectralWindow window)
+    : SpectralGateProcessor(
+          std::make_shared<Kinesis::Discrete::StreamingSpectralGate>(threshold_db, window_size, window),
+          window_size, hop_size, window)
+{
+}
+
+SpectralGateProcessor::SpectralGateProcessor(std::shared_ptr<Kinesis::Discrete::StreamingSpectralGate> gate,
+    uint32_t window_size, uint32_t hop_size, Kinesis::Discrete::SpectralWindow window)
+    : SpectralProcessor(
+          [raw = gate.get()](std::vector<std::complex<double>>& spectrum, size_t frame) {
+              (*raw)(spectrum, frame);
+          },
+          window_size, hop_size, window)
+    , m_gate(std::move(gate))
+{
+}
+
+} // namespace MayaFlux::Buffers
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "MayaFlux/Buffers/BufferProcessor.hpp"
+#include "MayaFlux/Kinesis/Discrete/SpectralStream.hpp"
+
+namespace MayaFlux::Buffers {
+
+/**
+ * @class SpectralProcessor
+ * @brief Realtime STFT processor for audio buffers
+ *
+ * Streams the buffer through a Kinesis::Discrete::StreamingSTFT, calling a
+ * SpectrumProcessor once per hop on the one-sided spectrum and
+ * overlap-adding the result back into the buffer. Window and hop are
+ * independent of the buffer size; the engine carries partial hops across
+ * calls and never allocates while processing.
+ *
+ * Output is delayed by get_latency() samples (the window size). Each
+ * AudioBuffer is one channel, so attach one processor per buffer.
+ *
+ * @code
+ * auto gate = std::make_shared<SpectralGateProcessor>(-60.0);
+ * buffer->get_processing_chain()->add_processor(gate, buffer);
+ * @endcode
+ */
+class MAYAFLUX_API SpectralProcessor : public BufferProcessor {
+public:
+    /**
+     * @param processor   Per-hop spectrum callback, run on the processing thread
+     * @param window_size FFT frame size (power of 2, >= 64)
+     * @param hop_size    Analysis hop; must divide @p window_size
+     * @param window      Analysis and synthesis window shape
+     */
+    SpectralProcessor(Kinesis::Discrete::SpectrumProcessor processor,
+        uint32_t window_size = 1024, uint32_t hop_size = 256,
+        Kinesis::Discrete::SpectralWindow window = Kinesis::Discrete::SpectralWindow::HANN);
+
+    void processing_function(const std::shared_ptr<Buffer>& buffer) override;
+
+    void on_attach(const std::shared_ptr<Buffer>& buffer) override;
+
+    [[nodiscard]] bool is_compatible_with(const std::shared_ptr<Buffer>& buffer) const override;
+
+    /// @brief Input-to-output delay in samples.
+    [[nodiscard]] inline uint32_t get_latency() const { return m_stft.latency(); }
+
+    [[nodiscard]] inline uint32_t get_window_size() const { return m_stft.window_size(); }
+    [[nodiscard]] inline uint32_t get_hop_size() const { return m_stft.hop_size(); }
+    [[nodiscard]] inline Kinesis::Discrete::SpectralWindow get_window_shape() const { return m_stft.window_shape(); }
+
+protected:
+    /// @brief Clears spectral history; called on attach.
+    virtual void reset();
+
+    Kinesis::Discrete::StreamingSTFT m_stft;
+    Kinesis::Discrete::SpectrumProcessor m_processor;
+};
+
+/**
+ * @class PitchShiftProcessor
+ * @brief Streaming phase-vocoder pitch shift that preserves duration
+ *
+ * The shift can be changed from any thread while audio is running.
+ */
+class MAYAFLUX_API PitchShiftProcessor : public SpectralProcessor {
+public:
+    /**
+     * @param semitones   Shift in semitones (positive = up)
+     * @param window_size FFT frame size
+     * @param hop_size    Analysis hop; window / 4 or smaller recommended
+     * @param window      Analysis and synthesis window shape
+     */
+    PitchShiftProcessor(double semitones, uint32_t window_size = 2048, uint32_t hop_size = 512,
+        Kinesis::Discrete::SpectralWindow window = Kinesis::Discrete::SpectralWindow::HANN);
+
+    inline void set_semitones(double semitones) { m_shift->set_semitones(semitones); }
+    [[nodiscard]] inline double get_semitones() const { return m_shift->get_semitones(); }
+
+protected:
+    void reset() override;
+
+private:
+    PitchShiftProcessor(std::shared_ptr<Kinesis::Discrete::StreamingPitchShift> shift,
+        uint32_t window_size, uint32_t hop_size, Kinesis::Discrete::SpectralWindow window);
+
+    std::shared_ptr<Kinesis::Discrete::StreamingPitchShift> m_shift;
+};
+
+/**
+ * @class SpectralGateProcessor
+ * @brief Streaming spectral gate: zeroes bins below a dBFS threshold
+ *
+ * The threshold can be changed from any thread while audio is running.
+ */
+class MAYAFLUX_API SpectralGateProcessor : public SpectralProcessor {
+public:
+    /**
+     * @param threshold_db Per-bin sinusoidal amplitude threshold in dBFS
+     * @param window_size  FFT frame size
+     * @param hop_size     Analysis hop
+     * @param window       Window shape; also sets the gate's gain correction
+     */
+    SpectralGateProcessor(double threshold_db, uint32_t window_size = 1024, uint32_t hop_size = 256,
+        Kinesis::Discrete::SpectralWindow window = Kinesis::Discrete::SpectralWindow::HANN);
+
+    inline void set_threshold_db(double threshold_db) { m_gate->set_threshold_db(threshold_db); }
+    [[nodiscard]] inline double get_threshold_db() const { return m_gate->get_threshold_db(); }
+
+private:
+    SpectralGateProcessor(std::shared_ptr<Kinesis::Discrete::StreamingSpectralGate> gate,
+        uint32_t window_size, uint32_t hop_size, Kinesis::Discrete::SpectralWindow window);
+
+    std::shared_ptr<Kinesis::Discrete::StreamingSpectralGate> m_gate;
+};
+
+} // namespace MayaFlux::Buffers
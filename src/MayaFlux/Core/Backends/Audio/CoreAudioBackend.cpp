@@ -806,10 +806,10 @@ bool CoreAudioStream::configure_output_format()
     format.mSampleRate = m_stream_info.sample_rate;
     format.mFormatID = kAudioFormatLinearPCM;
     format.mFormatFlags = kAudioFormatFlagIsFloat | kAudioFormatFlagIsPacked;
-    format.mBitsPerChannel = 64;
+    format.mBitsPerChannel = m_stream_info.sample_bytes() * 8;
     format.mChannelsPerFrame = m_stream_info.output.channels;
     format.mFramesPerPacket = 1;
-    format.mBytesPerFrame = sizeof(double) * format.mChannelsPerFrame;
+    format.mBytesPerFrame = m_stream_info.sample_bytes() * format.mChannelsPerFrame;
     format.mBytesPerPacket = format.mBytesPerFrame;
 
     auto status = AudioUnitSetProperty(
@@ -837,10 +837,10 @@ bool CoreAudioStream::configure_input_format()
     format.mSampleRate = m_stream_info.sample_rate;
     format.mFormatID = kAudioFormatLinearPCM;
     format.mFormatFlags = kAudioFormatFlagIsFloat | kAudioFormatFlagIsPacked;
-    format.mBitsPerChannel = 64;
+    format.mBitsPerChannel = m_stream_info.sample_bytes() * 8;
     format.mChannelsPerFrame = m_stream_info.input.channels;
     format.mFramesPerPacket = 1;
-    format.mBytesPerFrame = sizeof(double) * format.mChannelsPerFrame;
+    format.mBytesPerFrame = m_stream_info.sample_bytes() * format.mChannelsPerFrame;
     format.mBytesPerPacket = format.mBytesPerFrame;
 
     auto status = AudioUnitSetProperty(
@@ -857,7 +857,7 @@ bool CoreAudioStream::configure_input_format()
     }
 
     const auto bytes = static_cast<UInt32>(
-        sizeof(double) * m_stream_info.input.channels * m_stream_info.buffer_size);
+        m_stream_info.sample_bytes() * m_stream_info.input.channels * m_stream_info.buffer_size);
 
     m_input_buffer_list = static_cast<AudioBufferList*>(
         std::calloc(1, sizeof(AudioBufferList) + sizeof(AudioBuffer)));
@@ -892,7 +892,7 @@ OSStatus CoreAudioStream::output_callback(
         return noErr;
     }
 
-    auto* output = static_cast<double*>(io_data->mBuffers[0].mData);
+    void* output = io_data->mBuffers[0].mData;
 
     void* input = stream->m_input_enabled.load(std::memory_order_acquire)
         ? stream->m_input_buffer_list->mBuffers[0].mData
@@ -917,7 +917,7 @@ OSStatus CoreAudioStream::input_callback(
         return noErr;
 
     stream->m_input_buffer_list->mBuffers[0].mDataByteSize = static_cast<UInt32>(
-        sizeof(double) * stream->m_stream_info.input.channels * num_frames);
+        stream->m_stream_info.sample_bytes() * stream->m_stream_info.input.channels * num_frames);
 
     AudioUnitRender(
         stream->m_input_unit,
@@ -13,6 +13,11 @@ namespace MayaFlux::Core {
 namespace {
     constexpr auto C = Journal::Component::Core;
     constexpr auto X = Journal::Context::AudioBackend;
+
+    spa_audio_format spa_sample_format(const GlobalStreamInfo& info)
+    {
+        return info.uses_float32() ? SPA_AUDIO_FORMAT_F32 : SPA_AUDIO_FORMAT_F64;
+    }
 }
 
 // ---------------------------------------------------------------------------
@@ -343,8 +348,7 @@ void PipewireStream::on_input_process(void* userdata)
     const size_t n_samples = static_cast<size_t>(frames) * ch;
 
     if (sb->datas[0].data && n_samples > 0) {
-        const auto src = static_cast<const double*>(sb->datas[0].data);
-        std::memcpy(self->m_input_staging.data(), src, n_samples * sizeof(double));
+        std::memcpy(self->m_input_staging.data(), sb->datas[0].data, n_samples * self->m_stream_info.sample_bytes());
     } else {
         std::ranges::fill(self->m_input_staging, 0.0);
     }
@@ -359,7 +363,7 @@ void PipewireStream::build_output_format_params(
 {
     spa_pod_builder b = SPA_POD_BUILDER_INIT(buf, buf_size);
     struct spa_audio_info_raw raw = SPA_AUDIO_INFO_RAW_INIT(
-            .format = SPA_AUDIO_FORMAT_F64,
+            .format = spa_sample_format(m_stream_info),
         .rate = m_stream_info.sample_rate,
         .channels = m_stream_info.output.channels);
     params[0] = static_cast<const struct spa_pod*>(
@@ -373,7 +377,7 @@ void PipewireStream::build_input_format_params(
 {
     spa_pod_builder b = SPA_POD_BUILDER_INIT(buf, buf_size);
     struct spa_audio_info_raw raw = SPA_AUDIO_INFO_RAW_INIT(
-            .format = SPA_AUDIO_FORMAT_F64,
+            .format = spa_sample_format(m_stream_info),
         .rate = m_stream_info.sample_rate,
         .channels = m_stream_info.input.channels);
     params[0] = static_cast<const struct spa_pod*>(
@@ -396,6 +400,7 @@ void PipewireStream::on_output_process(void* userdata)
     spa_buffer* sb = pb->buffer;
     void* data = sb->datas[0].data;
     const uint32_t ch = self->m_stream_info.output.channels;
+    const uint32_t sample_bytes = self->m_stream_info.sample_bytes();
 
     uint32_t frames = self->m_rate_match
         ? self->m_rate_match->size
@@ -408,14 +413,14 @@ void PipewireStream::on_output_process(void* userdata)
     if (xrun) {
         MF_RT_WARN(C, X, "output xrun");
         if (self->m_stream_info.handle_xruns) {
-            std::memset(data, 0, frames * ch * sizeof(double));
+            std::memset(data, 0, static_cast<size_t>(frames) * ch * sample_bytes);
             pw_stream_queue_buffer(self->m_output_stream, pb);
             return;
         }
     }
 
     if (frames == 0)
-        frames = sb->datas[0].chunk->size / (ch * sizeof(double));
+        frames = sb->datas[0].chunk->size / (ch * sample_bytes);
 
     if (frames == 0 || !data) {
         MF_RT_WARN(C, X, "on_process: zero frames or null data, skipping");
@@ -424,8 +429,8 @@ void PipewireStream::on_output_process(void* userdata)
     }
 
     sb->datas[0].chunk->offset = 0;
-    sb->datas[0].chunk->stride = static_cast<int32_t>(ch * sizeof(double));
-    sb->datas[0].chunk->size = static_cast<size_t>(frames * ch) * sizeof(double);
+    sb->datas[0].chunk->stride = static_cast<int32_t>(ch * sample_bytes);
+    sb->datas[0].chunk->size = static_cast<size_t>(frames * ch) * sample_bytes;
 
     void* input_ptr = nullptr;
     if (self->m_stream_info.input.enabled && self->m_input_ready.load(std::memory_order_acquire)) {
@@ -452,19 +457,21 @@ void PipewireStream::on_param_changed(void* userdata, uint32_t id, const struct
 
     self->m_negotiated_frames.store(self->m_stream_info.buffer_size, std::memory_order_relaxed);
 
-    MF_INFO(C, X, "format negotiated: F64 {} ch @ {} Hz",
+    MF_INFO(C, X, "format negotiated: {} {} ch @ {} Hz",
+        self->m_stream_info.uses_float32() ? "F32" : "F64",
         info.info.raw.channels, info.info.raw.rate);
 
     uint8_t buf[1024];
     spa_pod_builder b = SPA_POD_BUILDER_INIT(buf, sizeof(buf));
     const uint32_t ch = self->m_stream_info.output.channels;
+    const uint32_t sample_bytes = self->m_stream_info.sample_bytes();
 
     const auto* bufparam = static_cast<const struct spa_pod*>(
         spa_pod_builder_add_object(&b,
             SPA_TYPE_OBJECT_ParamBuffers, SPA_PARAM_Buffers,
             SPA_PARAM_BUFFERS_blocks, SPA_POD_Int(1),
-            SPA_PARAM_BUFFERS_size, SPA_POD_Int(self->m_stream_info.buffer_size * ch * sizeof(double)),
-            SPA_PARAM_BUFFERS_stride, SPA_POD_Int(ch * sizeof(double))));
+            SPA_PARAM_BUFFERS_size, SPA_POD_Int(self->m_stream_info.buffer_size * ch * sample_bytes),
+            SPA_PARAM_BUFFERS_stride, SPA_POD_Int(ch * sample_bytes)));
 
     pw_stream_update_params(self->m_output_stream, &bufparam, 1);
 }
@@ -102,9 +102,11 @@ private:
  * @class PipewireStream
  * @brief PipeWire implementation of the audio stream interface
  *
- * Wraps a pw_stream follower node. The stream proposes SPA_AUDIO_FORMAT_F64
- * interleaved during format negotiation, matching the engine's internal
- * double representation and eliminating format conversion in the hot path.
+ * Wraps a pw_stream follower node. The stream proposes interleaved
+ * SPA_AUDIO_FORMAT_F64, or SPA_AUDIO_FORMAT_F32 when GlobalStreamInfo::format
+ * is FLOAT32, and hands buffers to the process callback in that format.
+ * F32 halves the shared buffers and matches what the PipeWire graph runs
+ * in, so the server skips a conversion pass per cycle.
  *
  * On param_changed the negotiated frame count is stored and used to validate
  * the buffer size contract. If PipeWire adjusts the quantum away from the
@@ -177,7 +179,7 @@ private:
 
     spa_io_rate_match* m_rate_match = nullptr;
 
-    std::vector<double> m_input_staging;
+    std::vector<double> m_input_staging; ///< Input samples in the stream format; sized for F64, so F32 fits too
     std::atomic<bool> m_input_ready { false };
 
     /** @brief Negotiated quantum; updated from param_changed before first process call */
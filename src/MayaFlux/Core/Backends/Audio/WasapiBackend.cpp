@@ -346,6 +346,11 @@ void WasapiStream::open()
     if (m_is_open.load())
         return;
 
+    if (m_stream_info.uses_float32()) {
+        MF_INFO(C, X, "WASAPI: render and capture rings stay float64; float32 applies on the wire only");
+        m_stream_info.format = GlobalStreamInfo::AudioFormat::FLOAT64;
+    }
+
     m_stop_event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
     if (!m_stop_event)
         error(C, X, std::source_location::current(), "WasapiStream: CreateEvent (stop) failed");
@@ -106,7 +106,9 @@ private:
  * waking exactly once per buffer period with no busy-wait.
  *
  * The internal loop converts between WASAPI's native float32 interleaved
- * layout and the engine's float64 interleaved layout in the hot path.
+ * layout and the engine's float64 interleaved layout in the hot path, so
+ * the process callback always receives float64 and open() resets a FLOAT32
+ * GlobalStreamInfo::format to FLOAT64.
  * Format negotiation falls back to the mix format reported by WASAPI if the
  * requested sample rate is not supported in shared mode.
  *
@@ -770,6 +770,147 @@ void BackendResourceManager::upload_image_data(
         size, image->get_width(), image->get_height());
 }
 
+void BackendResourceManager::upload_image_regions(
+    const std::shared_ptr<VKImage>& image,
+    const void* data,
+    size_t bytes_per_texel,
+    std::span<const vk::Rect2D> regions)
+{
+    if (!image || !data || bytes_per_texel == 0) {
+        MF_ERROR(Journal::Component::Core, Journal::Context::GraphicsBackend,
+            "Invalid parameters for upload_image_regions");
+        return;
+    }
+
+    const uint32_t img_w = image->get_width();
+    const uint32_t img_h = image->get_height();
+
+    std::vector<vk::BufferImageCopy> copies;
+    copies.reserve(regions.size());
+    size_t total = 0;
+
+    for (const auto& r : regions) {
+        if (r.offset.x < 0 || r.offset.y < 0) {
+            continue;
+        }
+        const auto x = static_cast<uint32_t>(r.offset.x);
+        const auto y = static_cast<uint32_t>(r.offset.y);
+        if (x >= img_w || y >= img_h) {
+            continue;
+        }
+        const uint32_t w = std::min(r.extent.width, img_w - x);
+        const uint32_t h = std::min(r.extent.height, img_h - y);
+        if (w == 0 || h == 0) {
+            continue;
+        }
+
+        vk::BufferImageCopy region {};
+        region.bufferOffset = total;
+        region.bufferRowLength = 0;
+        region.bufferImageHeight = 0;
+        region.imageSubresource.aspectMask = image->get_aspect_flags();
+        region.imageSubresource.mipLevel = 0;
+        region.imageSubresource.baseArrayLayer = 0;
+        region.imageSubresource.layerCount = 1;
+        region.imageOffset = vk::Offset3D { static_cast<int32_t>(x), static_cast<int32_t>(y), 0 };
+        region.imageExtent = vk::Extent3D { w, h, 1 };
+        copies.push_back(region);
+
+        // Vulkan requires bufferOffset to be a multiple of the texel size and of 4.
+        total += static_cast<size_t>(w) * h * bytes_per_texel;
+        total = (total + 3) & ~size_t { 3 };
+    }
+
+    if (copies.empty()) {
+        return;
+    }
+
+    auto staging = std::make_shared<Buffers::VKBuffer>(
+        total,
+        Buffers::VKBuffer::Usage::STAGING,
+        Kakshya::DataModality::IMAGE_COLOR);
+
+    initialize_buffer(staging);
+
+    auto* mapped = static_cast<uint8_t*>(staging->get_mapped_ptr());
+    if (!mapped) {
+        MF_ERROR(Journal::Component::Core, Journal::Context::GraphicsBackend,
+            "Failed to map staging buffer for region upload");
+        cleanup_buffer(staging);
+        return;
+    }
+
+    const auto* src = static_cast<const uint8_t*>(data);
+    const size_t src_stride = static_cast<size_t>(img_w) * bytes_per_texel;
+
+    for (const auto& c : copies) {
+        const size_t row_bytes = static_cast<size_t>(c.imageExtent.width) * bytes_per_texel;
+        uint8_t* dst = mapped + c.bufferOffset;
+        for (uint32_t row = 0; row < c.imageExtent.height; ++row) {
+            const size_t src_off = (static_cast<size_t>(c.imageOffset.y) + row) * src_stride
+                + static_cast<size_t>(c.imageOffset.x) * bytes_per_texel;
+            std::memcpy(dst + row * row_bytes, src + src_off, row_bytes);
+        }
+    }
+
+    staging->mark_dirty_range(0, total);
+
+    auto& resources = staging->get_buffer_resources();
+    vk::MappedMemoryRange range { resources.memory, 0, VK_WHOLE_SIZE };
+
+    if (auto result = m_context.get_device().flushMappedMemoryRanges(1, &range); result != vk::Result::eSuccess) {
+        MF_ERROR(Journal::Component::Core, Journal::Context::GraphicsBackend,
+            "Failed to flush mapped memory range: {}", vk::to_string(result));
+    }
+
+    execute_immediate_commands([&](vk::CommandBuffer cmd) {
+        vk::ImageMemoryBarrier barrier {};
+        barrier.oldLayout = image->get_current_layout();
+        barrier.newLayout = vk::ImageLayout::eTransferDstOptimal;
+        barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barrier.image = image->get_image();
+        barrier.subresourceRange.aspectMask = image->get_aspect_flags();
+        barrier.subresourceRange.baseMipLevel = 0;
+        barrier.subresourceRange.levelCount = image->get_mip_levels();
+        barrier.subresourceRange.baseArrayLayer = 0;
+        barrier.subresourceRange.layerCount = image->get_array_layers();
+        barrier.srcAccessMask = vk::AccessFlagBits::eShaderRead;
+        barrier.dstAccessMask = vk::AccessFlagBits::eTransferWrite;
+
+        cmd.pipelineBarrier(
+            vk::PipelineStageFlagBits::eFragmentShader,
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::DependencyFlags {},
+            0, nullptr, 0, nullptr, 1, &barrier);
+
+        cmd.copyBufferToImage(
+            staging->get_buffer(),
+            image->get_image(),
+            vk::ImageLayout::eTransferDstOptimal,
+            static_cast<uint32_t>(copies.size()), copies.data());
+
+        barrier.oldLayout = vk::ImageLayout::eTransferDstOptimal;
+        barrier.newLayout = vk::ImageLayout::eShaderReadOnlyOptimal;
+        barrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
+        barrier.dstAccessMask = vk::AccessFlagBits::eShaderRead;
+
+        cmd.pipelineBarrier(
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::PipelineStageFlagBits::eFragmentShader,
+            vk::DependencyFlags {},
+            0, nullptr, 0, nullptr, 1, &barrier);
+    });
+
+    image->set_current_layout(vk::ImageLayout::eShaderReadOnlyOptimal);
+
+    cleanup_buffer(staging);
+
+    MF_DEBUG(Journal::Component::Core, Journal::Context::GraphicsBackend,
+        "Uploaded {} regions ({} bytes) to image {}x{}",
+        copies.size(), total, img_w, img_h);
+}
+
 void BackendResourceManager::upload_image_data(
     std::shared_ptr<VKImage> image,
     const void* data,
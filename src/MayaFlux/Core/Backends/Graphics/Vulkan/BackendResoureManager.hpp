@@ -137,6 +137,25 @@ public:
         const void* data,
         size_t size);
 
+    /**
+     * @brief Upload sub-rectangles of a full-image pixel array to an image.
+     *
+     * Only the rows inside @p regions are packed into the staging buffer and
+     * one copy per region is recorded in a single submission, so touching a
+     * few glyphs in a large atlas costs bytes proportional to the glyphs.
+     *
+     * @param image           Target VKImage (mip 0, layer 0).
+     * @param data            Tightly packed pixels for the whole image, row stride
+     *                        image width * @p bytes_per_texel.
+     * @param bytes_per_texel Texel size in bytes.
+     * @param regions         Rectangles to upload; clamped to the image extent.
+     */
+    void upload_image_regions(
+        const std::shared_ptr<VKImage>& image,
+        const void* data,
+        size_t bytes_per_texel,
+        std::span<const vk::Rect2D> regions);
+
     /**
      * @brief Upload image data using a caller-supplied persistent staging buffer.
      *        Identical to upload_image_data() but skips the per-call VkBuffer
@@ -292,6 +292,16 @@ bool VKShaderModule::create_from_spirv_asm(
     vk::ShaderStageFlagBits stage,
     const std::string& entry_point,
     bool enable_reflection)
+{
+    auto words = assemble_spirv_asm(spirv_asm);
+    if (words.empty()) {
+        return false;
+    }
+
+    return create_from_spirv(device, words, stage, entry_point, enable_reflection);
+}
+
+std::vector<uint32_t> VKShaderModule::assemble_spirv_asm(const std::string& spirv_asm)
 {
     spv_context ctx = spvContextCreate(SPV_ENV_VULKAN_1_3);
     spv_binary binary = nullptr;
@@ -310,7 +320,7 @@ bool VKShaderModule::create_from_spirv_asm(
             (diag && diag->error) ? diag->error : "unknown error");
         spvDiagnosticDestroy(diag);
         spvContextDestroy(ctx);
-        return false;
+        return {};
     }
 
     std::vector<uint32_t> words(binary->code, binary->code + binary->wordCount);
@@ -327,7 +337,7 @@ bool VKShaderModule::create_from_spirv_asm(
             (val_diag && val_diag->error) ? val_diag->error : "unknown");
         spvDiagnosticDestroy(val_diag);
         spvContextDestroy(ctx);
-        return false;
+        return {};
     }
     spvDiagnosticDestroy(val_diag);
     spvContextDestroy(ctx);
@@ -335,7 +345,7 @@ bool VKShaderModule::create_from_spirv_asm(
     MF_DEBUG(Journal::Component::Core, Journal::Context::GraphicsBackend,
         "Assembled and validated SPIR-V ({} words)", words.size());
 
-    return create_from_spirv(device, words, stage, entry_point, enable_reflection);
+    return words;
 }
 
 // ============================================================================
@@ -779,6 +789,16 @@ std::vector<uint32_t> VKShaderModule::compile_glsl_to_spirv(
     return spirv;
 }
 
+std::string VKShaderModule::compiler_fingerprint()
+{
+    unsigned int spv_version = 0;
+    unsigned int spv_revision = 0;
+    shaderc_get_spv_version(&spv_version, &spv_revision);
+
+    return std::format("vulkan1.3;spv1.6;O=performance;shaderc-spv={}.{};spirv-tools={}",
+        spv_version, spv_revision, spvSoftwareVersionString());
+}
+
 std::vector<uint32_t> VKShaderModule::read_spirv_file(const std::string& filepath)
 {
     std::ifstream file(filepath, std::ios::binary | std::ios::ate);
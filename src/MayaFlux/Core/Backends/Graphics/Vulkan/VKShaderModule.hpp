@@ -397,6 +397,44 @@ public:
      */
     static std::optional<vk::ShaderStageFlagBits> detect_stage_from_extension(const std::string& filepath);
 
+    //==========================================================================
+    // Device-free compilation
+    //==========================================================================
+
+    /**
+     * @brief Compile GLSL to SPIR-V using shaderc
+     * @param glsl_source GLSL source code
+     * @param stage Shader stage (affects compiler settings)
+     * @param include_directories Include paths
+     * @param defines Preprocessor macros
+     * @return SPIR-V bytecode, or empty vector on failure
+     *
+     * Needs no device and is reentrant; safe to call from worker threads.
+     */
+    static std::vector<uint32_t> compile_glsl_to_spirv(
+        const std::string& glsl_source,
+        vk::ShaderStageFlagBits stage,
+        const std::vector<std::string>& include_directories,
+        const std::unordered_map<std::string, std::string>& defines);
+
+    /**
+     * @brief Assemble and validate SPIR-V assembly text
+     * @param spirv_asm SPIR-V assembly text
+     * @return SPIR-V bytecode, or empty vector on failure
+     *
+     * Targets Vulkan 1.3. Needs no device and is reentrant.
+     */
+    static std::vector<uint32_t> assemble_spirv_asm(const std::string& spirv_asm);
+
+    /**
+     * @brief Identity of the compilation toolchain and its fixed options
+     *
+     * Combines target environment, SPIR-V version, optimisation level and the
+     * shaderc / SPIRV-Tools versions. Used as part of persistent cache keys so
+     * that a toolchain upgrade invalidates previously cached SPIR-V.
+     */
+    static std::string compiler_fingerprint();
+
 private:
     vk::ShaderModule m_module = nullptr;
     vk::ShaderStageFlagBits m_stage = vk::ShaderStageFlagBits::eCompute;
@@ -426,20 +464,6 @@ private:
      */
     bool reflect_spirv(const std::vector<uint32_t>& spirv_code);
 
-    /**
-     * @brief Compile GLSL to SPIR-V using shaderc
-     * @param glsl_source GLSL source code
-     * @param stage Shader stage (affects compiler settings)
-     * @param include_directories Include paths
-     * @param defines Preprocessor macros
-     * @return SPIR-V bytecode, or empty vector on failure
-     */
-    std::vector<uint32_t> compile_glsl_to_spirv(
-        const std::string& glsl_source,
-        vk::ShaderStageFlagBits stage,
-        const std::vector<std::string>& include_directories,
-        const std::unordered_map<std::string, std::string>& defines);
-
     /**
      * @brief Read binary file into vector
      * @param filepath Path to file
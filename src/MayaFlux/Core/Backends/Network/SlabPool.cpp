@@ -0,0 +1,49 @@
+#include "SlabPool.hpp"
+
+namespace MayaFlux::Core {
+
+SlabPool::SlabPool(size_t slab_size, size_t max_cached)
+    : m_slab_size(std::max<size_t>(slab_size, 64))
+    , m_max_cached(max_cached)
+{
+}
+
+SlabPool::Slab SlabPool::acquire(size_t min_capacity)
+{
+    if (min_capacity > m_slab_size) {
+        m_allocations.fetch_add(1, std::memory_order_relaxed);
+        return { .data = std::make_unique_for_overwrite<uint8_t[]>(min_capacity), .capacity = min_capacity };
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        if (!m_free.empty()) {
+            Slab slab { .data = std::move(m_free.back()), .capacity = m_slab_size };
+            m_free.pop_back();
+            return slab;
+        }
+    }
+
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    return { .data = std::make_unique_for_overwrite<uint8_t[]>(m_slab_size), .capacity = m_slab_size };
+}
+
+void SlabPool::release(Slab slab)
+{
+    if (!slab || slab.capacity != m_slab_size) {
+        return;
+    }
+
+    std::lock_guard lock(m_mutex);
+    if (m_free.size() < m_max_cached) {
+        m_free.push_back(std::move(slab.data));
+    }
+}
+
+size_t SlabPool::cached() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_free.size();
+}
+
+} // namespace MayaFlux::Core
@@ -0,0 +1,72 @@
+#pragma once
+
+namespace MayaFlux::Core {
+
+/**
+ * @class SlabPool
+ * @brief Thread-safe free list of fixed-size byte blocks for network I/O.
+ *
+ * TCPBackend draws its per-connection receive buffers and its send
+ * staging blocks from one pool, so steady-state traffic recycles the same
+ * few blocks instead of allocating per message.
+ *
+ * Requests larger than the slab size get a dedicated block of exactly the
+ * requested size. Those are never cached: release() frees them, keeping
+ * the pool bounded at max_cached standard slabs.
+ */
+class MAYAFLUX_API SlabPool {
+public:
+    /**
+     * @struct Slab
+     * @brief One owned block and how much of it is in use.
+     */
+    struct Slab {
+        std::unique_ptr<uint8_t[]> data;
+        size_t capacity {};
+        size_t size {};
+
+        [[nodiscard]] explicit operator bool() const noexcept { return data != nullptr; }
+        [[nodiscard]] size_t available() const noexcept { return capacity - size; }
+    };
+
+    /**
+     * @param slab_size  Capacity of a standard slab in bytes.
+     * @param max_cached Free slabs kept for reuse; extras are freed.
+     */
+    explicit SlabPool(size_t slab_size, size_t max_cached = 64);
+
+    SlabPool(const SlabPool&) = delete;
+    SlabPool& operator=(const SlabPool&) = delete;
+    SlabPool(SlabPool&&) = delete;
+    SlabPool& operator=(SlabPool&&) = delete;
+
+    /**
+     * @brief Take a block with at least @p min_capacity bytes.
+     *
+     * Returns a cached standard slab when one fits, otherwise allocates.
+     * The block contents are uninitialised and size is zero.
+     */
+    [[nodiscard]] Slab acquire(size_t min_capacity = 0);
+
+    /// @brief Return a block. Standard slabs are cached, others freed.
+    void release(Slab slab);
+
+    [[nodiscard]] size_t slab_size() const noexcept { return m_slab_size; }
+
+    /// @brief Free standard slabs currently cached.
+    [[nodiscard]] size_t cached() const;
+
+    /// @brief Blocks allocated since construction, standard and dedicated.
+    [[nodiscard]] uint64_t allocations() const noexcept { return m_allocations.load(std::memory_order_relaxed); }
+
+private:
+    size_t m_slab_size;
+    size_t m_max_cached;
+
+    mutable std::mutex m_mutex;
+    std::vector<std::unique_ptr<uint8_t[]>> m_free;
+
+    std::atomic<uint64_t> m_allocations {};
+};
+
+} // namespace MayaFlux::Core
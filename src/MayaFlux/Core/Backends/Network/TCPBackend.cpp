@@ -1,6 +1,6 @@
 #include "TCPBackend.hpp"
 
-#include <asio/read.hpp>
+#include <asio/post.hpp>
 #include <asio/write.hpp>
 
 #include "MayaFlux/Journal/Archivist.hpp"
@@ -10,6 +10,7 @@ namespace MayaFlux::Core {
 TCPBackend::TCPBackend(const TCPBackendInfo& config, asio::io_context& context)
     : m_config(config)
     , m_context(context)
+    , m_slabs(config.slab_size)
 {
 }
 
@@ -69,6 +70,10 @@ void TCPBackend::stop()
             if (conn->reconnect_timer) {
                 conn->reconnect_timer->cancel();
             }
+
+            if (conn->cork_timer) {
+                conn->cork_timer->cancel();
+            }
         }
     }
 
@@ -205,6 +210,10 @@ void TCPBackend::close_endpoint(uint64_t endpoint_id)
             if (it->second->reconnect_timer) {
                 it->second->reconnect_timer->cancel();
             }
+
+            if (it->second->cork_timer) {
+                it->second->cork_timer->cancel();
+            }
             m_connections.erase(it);
 
             MF_DEBUG(Journal::Component::Core, Journal::Context::NetworkBackend,
@@ -281,6 +290,10 @@ std::vector<EndpointInfo> TCPBackend::get_endpoints() const
 
 bool TCPBackend::send(uint64_t endpoint_id, const uint8_t* data, size_t size)
 {
+    if (size == 0 || size > MAX_FRAME_SIZE) {
+        return false;
+    }
+
     std::shared_lock lock(m_connections_mutex);
     auto it = m_connections.find(endpoint_id);
     if (it == m_connections.end()) {
@@ -292,26 +305,65 @@ bool TCPBackend::send(uint64_t endpoint_id, const uint8_t* data, size_t size)
         return false;
     }
 
-    auto frame = std::make_shared<std::vector<uint8_t>>(sizeof(uint32_t) + size);
-    uint32_t net_len = htonl(static_cast<uint32_t>(size));
-    std::memcpy(frame->data(), &net_len, sizeof(uint32_t));
-    std::memcpy(frame->data() + sizeof(uint32_t), data, size);
+    const size_t frame_size = sizeof(uint32_t) + size;
 
-    asio::async_write(
-        conn.socket,
-        asio::buffer(*frame),
-        [frame, endpoint_id, this](const asio::error_code& ec, size_t) {
-            if (ec) {
-                MF_WARN(Journal::Component::Core, Journal::Context::NetworkBackend,
-                    "TCP write failed on endpoint {}: {}", endpoint_id, ec.message());
+    bool refused = false;
+    bool became_congested = false;
+    bool flush = false;
+    bool cork = false;
 
-                std::shared_lock lk(m_connections_mutex);
-                auto cit = m_connections.find(endpoint_id);
-                if (cit != m_connections.end()) {
-                    on_connection_error(*cit->second, ec);
+    {
+        std::lock_guard send_lock(conn.send_mutex);
+
+        // An empty queue always takes the frame, however large, so it can drain.
+        const size_t limit = m_config.send_queue_limit;
+        if (limit > 0 && conn.queued_bytes > 0 && conn.queued_bytes + frame_size > limit) {
+            refused = true;
+            became_congested = !std::exchange(conn.congested, true);
+        } else {
+            if (conn.staged.empty() || conn.staged.back().available() < frame_size) {
+                conn.staged.push_back(m_slabs.acquire(frame_size));
+            }
+
+            auto& slab = conn.staged.back();
+            uint8_t* dst = slab.data.get() + slab.size;
+            uint32_t net_len = htonl(static_cast<uint32_t>(size));
+            std::memcpy(dst, &net_len, sizeof(uint32_t));
+            std::memcpy(dst + sizeof(uint32_t), data, size);
+            slab.size += frame_size;
+
+            conn.queued_bytes += frame_size;
+            conn.staged_bytes += frame_size;
+
+            if (!conn.write_active) {
+                if (m_config.cork_us == 0 || conn.staged_bytes >= m_config.cork_bytes) {
+                    conn.write_active = true;
+                    flush = true;
+                } else if (!conn.cork_armed) {
+                    conn.cork_armed = true;
+                    cork = true;
                 }
             }
-        });
+        }
+    }
+
+    lock.unlock();
+
+    if (refused) {
+        m_sends_refused.fetch_add(1, std::memory_order_relaxed);
+        if (became_congested && m_backpressure_callback) {
+            m_backpressure_callback(endpoint_id, true);
+        }
+        return false;
+    }
+
+    m_frames_sent.fetch_add(1, std::memory_order_relaxed);
+
+    if (flush) {
+        post_flush(endpoint_id);
+    } else if (cork) {
+        post_cork(endpoint_id);
+    }
 
     return true;
 }
@@ -336,6 +388,39 @@ void TCPBackend::set_state_callback(EndpointStateCallback callback)
     m_state_callback = std::move(callback);
 }
 
+void TCPBackend::set_backpressure_callback(BackpressureCallback callback)
+{
+    m_backpressure_callback = std::move(callback);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Flow control
+// ─────────────────────────────────────────────────────────────────────────────
+
+size_t TCPBackend::get_send_queue_bytes(uint64_t endpoint_id) const
+{
+    std::shared_lock lock(m_connections_mutex);
+    auto it = m_connections.find(endpoint_id);
+    if (it == m_connections.end()) {
+        return 0;
+    }
+
+    std::lock_guard send_lock(it->second->send_mutex);
+    return it->second->queued_bytes;
+}
+
+TCPBackend::TransferStats TCPBackend::get_transfer_stats() const
+{
+    return {
+        .frames_sent = m_frames_sent.load(std::memory_order_relaxed),
+        .frames_received = m_frames_received.load(std::memory_order_relaxed),
+        .writes = m_writes.load(std::memory_order_relaxed),
+        .reads = m_reads.load(std::memory_order_relaxed),
+        .sends_refused = m_sends_refused.load(std::memory_order_relaxed),
+        .slab_allocations = m_slabs.allocations(),
+    };
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Private: async connect
 // ─────────────────────────────────────────────────────────────────────────────
@@ -378,6 +463,7 @@ void TCPBackend::start_connect(ConnectionState& conn)
                 return;
             }
 
+            prepare_connection(c);
             transition_state(c.info, EndpointState::OPEN);
             start_receive_chain(c);
 
@@ -443,6 +529,8 @@ void TCPBackend::start_accept(ListenerState& listener)
                 m_connections[new_id] = std::move(conn);
             }
 
+            prepare_connection(*raw);
+
             if (m_state_callback) {
                 m_state_callback(raw->info, EndpointState::CLOSED, EndpointState::OPEN);
             }
@@ -461,73 +549,254 @@ void TCPBackend::start_accept(ListenerState& listener)
 // Private: framed receive chain
 // ─────────────────────────────────────────────────────────────────────────────
 
+void TCPBackend::prepare_connection(ConnectionState& conn)
+{
+    asio::error_code ec;
+
+    if (conn.socket.set_option(asio::ip::tcp::no_delay(m_config.no_delay), ec)) {
+        MF_WARN(Journal::Component::Core, Journal::Context::NetworkBackend,
+            "Failed to set TCP_NODELAY on endpoint {}: {}", conn.info.id, ec.message());
+    }
+
+    if (m_config.receive_buffer_size > 0) {
+        if (conn.socket.set_option(
+                asio::socket_base::receive_buffer_size(
+                    static_cast<int>(m_config.receive_buffer_size)),
+                ec)) {
+            MF_WARN(Journal::Component::Core, Journal::Context::NetworkBackend,
+                "Failed to set receive buffer size on endpoint {}: {}", conn.info.id, ec.message());
+        }
+    }
+
+    conn.peer = conn.info.remote_address + ":" + std::to_string(conn.info.remote_port);
+
+    if (!conn.rx) {
+        conn.rx = m_slabs.acquire();
+    }
+    conn.rx.size = 0;
+    conn.rx_begin = 0;
+}
+
 void TCPBackend::start_receive_chain(ConnectionState& conn)
 {
-    asio::async_read(
-        conn.socket,
-        asio::buffer(conn.header_buf),
+    auto& rx = conn.rx;
+
+    conn.socket.async_read_some(
+        asio::buffer(rx.data.get() + rx.size, rx.available()),
         [this, ep_id = conn.info.id](const asio::error_code& ec, size_t bytes) {
-            std::shared_lock lock(m_connections_mutex);
-            auto it = m_connections.find(ep_id);
-            if (it == m_connections.end()) {
-                return;
-            }
-            on_header_received(*it->second, ec, bytes);
+            with_connection(ep_id, [&](ConnectionState& c) {
+                on_data_received(c, ec, bytes);
+            });
         });
 }
 
-void TCPBackend::on_header_received(ConnectionState& conn,
-    const asio::error_code& ec, size_t)
+void TCPBackend::on_data_received(ConnectionState& conn,
+    const asio::error_code& ec, size_t bytes)
 {
     if (ec) {
         on_connection_error(conn, ec);
         return;
     }
 
-    uint32_t net_len {};
-    std::memcpy(&net_len, conn.header_buf.data(), sizeof(uint32_t));
-    uint32_t payload_size = ntohl(net_len);
+    m_reads.fetch_add(1, std::memory_order_relaxed);
 
-    if (payload_size == 0 || payload_size > 64 * 1024 * 1024) {
-        MF_WARN(Journal::Component::Core, Journal::Context::NetworkBackend,
-            "TCP endpoint {} received invalid frame length: {}",
-            conn.info.id, payload_size);
-        on_connection_error(conn, asio::error::message_size);
-        return;
+    auto& rx = conn.rx;
+    rx.size += bytes;
+
+    while (rx.size - conn.rx_begin >= sizeof(uint32_t)) {
+        const uint8_t* frame = rx.data.get() + conn.rx_begin;
+
+        uint32_t net_len {};
+        std::memcpy(&net_len, frame, sizeof(uint32_t));
+        uint32_t payload_size = ntohl(net_len);
+
+        if (payload_size == 0 || payload_size > MAX_FRAME_SIZE) {
+            MF_WARN(Journal::Component::Core, Journal::Context::NetworkBackend,
+                "TCP endpoint {} received invalid frame length: {}",
+                conn.info.id, payload_size);
+            on_connection_error(conn, asio::error::message_size);
+            return;
+        }
+
+        const size_t frame_size = sizeof(uint32_t) + payload_size;
+
+        if (rx.size - conn.rx_begin < frame_size) {
+            if (frame_size > rx.capacity) {
+                auto larger = m_slabs.acquire(frame_size);
+                larger.size = rx.size - conn.rx_begin;
+                std::memcpy(larger.data.get(), frame, larger.size);
+                m_slabs.release(std::exchange(rx, std::move(larger)));
+                conn.rx_begin = 0;
+            }
+            break;
+        }
+
+        m_frames_received.fetch_add(1, std::memory_order_relaxed);
+
+        if (m_receive_callback) {
+            m_receive_callback(conn.info.id, frame + sizeof(uint32_t), payload_size, conn.peer);
+        }
+
+        conn.rx_begin += frame_size;
     }
 
-    conn.payload_buf.resize(payload_size);
+    if (conn.rx_begin == rx.size) {
+        rx.size = 0;
+        if (rx.capacity != m_slabs.slab_size()) {
+            m_slabs.release(std::exchange(rx, m_slabs.acquire()));
+        }
+    } else if (conn.rx_begin > 0) {
+        std::memmove(rx.data.get(), rx.data.get() + conn.rx_begin, rx.size - conn.rx_begin);
+        rx.size -= conn.rx_begin;
+    }
+    conn.rx_begin = 0;
 
-    asio::async_read(
-        conn.socket,
-        asio::buffer(conn.payload_buf),
-        [this, ep_id = conn.info.id](const asio::error_code& read_ec, size_t bytes) {
-            std::shared_lock lock(m_connections_mutex);
-            auto it = m_connections.find(ep_id);
-            if (it == m_connections.end()) {
-                return;
+    start_receive_chain(conn);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Private: coalesced send queue
+// ─────────────────────────────────────────────────────────────────────────────
+
+void TCPBackend::post_flush(uint64_t endpoint_id)
+{
+    asio::post(m_context, [this, endpoint_id]() {
+        with_connection(endpoint_id, [this](ConnectionState& c) {
+            flush_send_queue(c);
+        });
+    });
+}
+
+void TCPBackend::post_cork(uint64_t endpoint_id)
+{
+    asio::post(m_context, [this, endpoint_id]() {
+        with_connection(endpoint_id, [this, endpoint_id](ConnectionState& c) {
+            if (!c.cork_timer) {
+                c.cork_timer = std::make_unique<asio::steady_timer>(m_context);
             }
-            on_payload_received(*it->second, read_ec, bytes);
+
+            c.cork_timer->expires_after(std::chrono::microseconds(m_config.cork_us));
+            c.cork_timer->async_wait([this, endpoint_id](const asio::error_code& ec) {
+                if (ec == asio::error::operation_aborted) {
+                    return;
+                }
+
+                with_connection(endpoint_id, [this](ConnectionState& corked) {
+                    bool flush = false;
+                    {
+                        std::lock_guard send_lock(corked.send_mutex);
+                        corked.cork_armed = false;
+                        if (!corked.write_active && !corked.staged.empty()) {
+                            corked.write_active = true;
+                            flush = true;
+                        }
+                    }
+
+                    if (flush) {
+                        flush_send_queue(corked);
+                    }
+                });
+            });
+        });
+    });
+}
+
+void TCPBackend::flush_send_queue(ConnectionState& conn)
+{
+    {
+        std::lock_guard send_lock(conn.send_mutex);
+
+        if (conn.staged.empty() || !conn.socket.is_open()) {
+            conn.write_active = false;
+            return;
+        }
+
+        conn.in_flight.swap(conn.staged);
+        conn.staged_bytes = 0;
+
+        conn.gather.clear();
+        for (const auto& slab : conn.in_flight) {
+            conn.gather.emplace_back(slab.data.get(), slab.size);
+        }
+    }
+
+    m_writes.fetch_add(1, std::memory_order_relaxed);
+
+    asio::async_write(
+        conn.socket,
+        conn.gather,
+        [this, ep_id = conn.info.id](const asio::error_code& ec, size_t bytes) {
+            with_connection(ep_id, [&](ConnectionState& c) {
+                on_write_complete(c, ec, bytes);
+            });
         });
 }
 
-void TCPBackend::on_payload_received(ConnectionState& conn,
+void TCPBackend::on_write_complete(ConnectionState& conn,
     const asio::error_code& ec, size_t /*bytes*/)
 {
-    if (ec) {
+    bool relieved = false;
+    bool again = false;
+
+    {
+        std::lock_guard send_lock(conn.send_mutex);
+
+        for (auto& slab : conn.in_flight) {
+            conn.queued_bytes -= slab.size;
+            m_slabs.release(std::move(slab));
+        }
+        conn.in_flight.clear();
+
+        if (conn.congested && conn.queued_bytes <= m_config.send_queue_limit / 2) {
+            conn.congested = false;
+            relieved = true;
+        }
+
+        if (!ec && !conn.staged.empty()) {
+            again = true;
+        } else {
+            conn.write_active = false;
+        }
+    }
+
+    if (ec && ec != asio::error::operation_aborted) {
+        MF_WARN(Journal::Component::Core, Journal::Context::NetworkBackend,
+            "TCP write failed on endpoint {}: {}", conn.info.id, ec.message());
         on_connection_error(conn, ec);
-        return;
     }
 
-    if (m_receive_callback) {
-        std::string peer_str = conn.info.remote_address + ":" + std::to_string(conn.info.remote_port);
+    if (relieved && m_backpressure_callback) {
+        m_backpressure_callback(conn.info.id, false);
+    }
 
-        m_receive_callback(conn.info.id,
-            conn.payload_buf.data(), conn.payload_buf.size(),
-            peer_str);
+    if (again) {
+        flush_send_queue(conn);
     }
+}
 
-    start_receive_chain(conn);
+void TCPBackend::discard_send_queue(ConnectionState& conn)
+{
+    bool relieved = false;
+
+    {
+        std::lock_guard send_lock(conn.send_mutex);
+
+        for (auto& slab : conn.staged) {
+            m_slabs.release(std::move(slab));
+        }
+        conn.staged.clear();
+        conn.queued_bytes -= conn.staged_bytes;
+        conn.staged_bytes = 0;
+
+        if (conn.congested && conn.queued_bytes <= m_config.send_queue_limit / 2) {
+            conn.congested = false;
+            relieved = true;
+        }
+    }
+
+    if (relieved && m_backpressure_callback) {
+        m_backpressure_callback(conn.info.id, false);
+    }
 }
 
 // ─────────────────────────────────────────────────────────────────────────────
@@ -554,6 +823,8 @@ void TCPBackend::on_connection_error(ConnectionState& conn, const asio::error_co
             "Error closing TCP socket for endpoint {}: {}", conn.info.id, close_ec.message());
     }
 
+    discard_send_queue(conn);
+
     if (conn.is_outbound && m_config.auto_reconnect) {
         transition_state(conn.info, EndpointState::RECONNECTING);
         schedule_reconnect(conn);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "NetworkBackend.hpp"
+#include "SlabPool.hpp"
 
 #include <asio/io_context.hpp>
 #include <asio/ip/tcp.hpp>
@@ -26,16 +27,29 @@ namespace MayaFlux::Core {
  * via asio::steady_timer.
  *
  * All I/O is async on the shared io_context. No dedicated threads per
- * connection. No mutexes on the data path. One io_context thread handles
- * all sockets: accept, connect, read, write, reconnect timers.
+ * connection. The only lock on the data path is a short per-connection
+ * send queue mutex. One io_context thread handles all sockets: accept,
+ * connect, read, write, cork and reconnect timers.
  *
  * Receive chain per connection:
- *   async_read(4 bytes header) -> parse length
- *   -> async_read(length bytes payload) -> fire callback -> resubmit header read
+ *   async_read_some(into pooled slab) -> parse every complete frame
+ *   -> fire callback with a view into the slab -> compact tail -> resubmit
+ *
+ * One read typically delivers many small frames, and payloads are handed
+ * out in place, never copied. A frame larger than the slab moves to a
+ * dedicated block for as long as it takes to arrive.
  *
  * Send:
- *   async_write(4 bytes header + payload). Serialised per-connection via
- *   Asio strand (implicit: all operations on one io_context thread).
+ *   send() copies the frame into the connection's staging slabs and returns.
+ *   At most one write is in flight per connection; everything staged while
+ *   it runs goes out together as the next scatter-gather async_write. With
+ *   cork_us set, a short queue waits that long (or until cork_bytes) to
+ *   batch more frames. no_delay controls Nagle on the socket itself.
+ *
+ * Backpressure: when a connection's queue would exceed send_queue_limit,
+ * send() returns false and the backpressure callback fires with
+ * congested = true. It fires again with false once the queue drains to
+ * half the limit. Producers can also poll get_send_queue_bytes().
  *
  * @code
  * asio::io_context ctx;
@@ -112,6 +126,42 @@ public:
     void set_receive_callback(NetworkReceiveCallback callback) override;
     void set_state_callback(EndpointStateCallback callback) override;
 
+    // ─── Flow control ───────────────────────────────────────────────────────
+
+    /**
+     * @brief Callback for send queue congestion changes.
+     * @param endpoint_id Connection whose queue crossed a threshold.
+     * @param congested   true when send() started refusing, false once drained.
+     *
+     * Fires on the thread that caused the transition: the sender for
+     * congestion, the io_context thread for relief.
+     */
+    using BackpressureCallback = std::function<void(uint64_t endpoint_id, bool congested)>;
+
+    /// @brief Set before start(); not synchronised with sends in progress.
+    void set_backpressure_callback(BackpressureCallback callback);
+
+    /**
+     * @brief Bytes accepted by send() and not yet written to the socket.
+     * @return 0 for unknown endpoints and listeners.
+     */
+    [[nodiscard]] size_t get_send_queue_bytes(uint64_t endpoint_id) const;
+
+    /**
+     * @struct TransferStats
+     * @brief Backend-wide counters for framing and coalescing.
+     */
+    struct TransferStats {
+        uint64_t frames_sent {};
+        uint64_t frames_received {};
+        uint64_t writes {}; ///< async_write calls; frames_sent / writes is the coalescing ratio
+        uint64_t reads {}; ///< Completed read_some calls
+        uint64_t sends_refused {}; ///< send() calls rejected by backpressure
+        uint64_t slab_allocations {}; ///< Pool blocks allocated; stays flat in steady state
+    };
+
+    [[nodiscard]] TransferStats get_transfer_stats() const;
+
 private:
     /**
      * @brief State for a connected TCP peer (inbound or outbound)
@@ -119,11 +169,26 @@ private:
     struct ConnectionState {
         EndpointInfo info;
         asio::ip::tcp::socket socket;
-        std::array<uint8_t, 4> header_buf {};
-        std::vector<uint8_t> payload_buf;
+        std::string peer;
         std::unique_ptr<asio::steady_timer> reconnect_timer;
         bool is_outbound {};
 
+        // Receive: frames are parsed in place between rx_begin and rx.size.
+        SlabPool::Slab rx;
+        size_t rx_begin {};
+
+        // Send: guarded by send_mutex; touched by senders and the io thread.
+        std::mutex send_mutex;
+        std::vector<SlabPool::Slab> staged;
+        std::vector<SlabPool::Slab> in_flight;
+        std::vector<asio::const_buffer> gather;
+        size_t queued_bytes {};
+        size_t staged_bytes {};
+        bool write_active {}; ///< A flush is posted or a write is in flight
+        bool cork_armed {};
+        bool congested {};
+        std::unique_ptr<asio::steady_timer> cork_timer;
+
         explicit ConnectionState(asio::io_context& ctx)
             : socket(ctx)
         {
@@ -145,9 +210,13 @@ private:
         }
     };
 
+    static constexpr uint32_t MAX_FRAME_SIZE = 64 * 1024 * 1024;
+
     TCPBackendInfo m_config;
     asio::io_context& m_context;
 
+    SlabPool m_slabs;
+
     std::atomic<bool> m_initialized { false };
     std::atomic<bool> m_running { false };
 
@@ -159,6 +228,13 @@ private:
 
     NetworkReceiveCallback m_receive_callback;
     EndpointStateCallback m_state_callback;
+    BackpressureCallback m_backpressure_callback;
+
+    std::atomic<uint64_t> m_frames_sent {};
+    std::atomic<uint64_t> m_frames_received {};
+    std::atomic<uint64_t> m_writes {};
+    std::atomic<uint64_t> m_reads {};
+    std::atomic<uint64_t> m_sends_refused {};
 
     /**
      * @brief Pointer to subsystem's endpoint id allocator.
@@ -188,27 +264,72 @@ private:
      */
     void start_accept(ListenerState& listener);
 
+    /**
+     * @brief Apply socket options and reset buffers for a fresh connection.
+     */
+    void prepare_connection(ConnectionState& conn);
+
     /**
      * @brief Start the framed message receive chain on a connection.
      *
-     * Posts async_read for 4-byte header. Completion parses length,
-     * posts async_read for payload. Completion fires receive callback,
-     * then resubmits header read.
+     * Posts async_read_some into the free tail of the connection's slab.
      */
     void start_receive_chain(ConnectionState& conn);
 
     /**
-     * @brief Header read completion handler.
+     * @brief Read completion handler.
+     *
+     * Fires the receive callback for every complete frame in the slab,
+     * moves any partial frame to the front, then resubmits the read.
      */
-    void on_header_received(ConnectionState& conn,
+    void on_data_received(ConnectionState& conn,
         const asio::error_code& ec, size_t bytes);
 
     /**
-     * @brief Payload read completion handler.
+     * @brief Post a flush of the staged queue to the io_context thread.
+     */
+    void post_flush(uint64_t endpoint_id);
+
+    /**
+     * @brief Arm the cork timer; a flush follows when it expires.
+     */
+    void post_cork(uint64_t endpoint_id);
+
+    /**
+     * @brief Write everything staged as one scatter-gather async_write.
+     *
+     * Runs on the io_context thread. Completion recycles the written
+     * slabs and flushes again if more was staged meanwhile.
+     */
+    void flush_send_queue(ConnectionState& conn);
+
+    /**
+     * @brief Write completion handler.
      */
-    void on_payload_received(ConnectionState& conn,
+    void on_write_complete(ConnectionState& conn,
         const asio::error_code& ec, size_t bytes);
 
+    /**
+     * @brief Return staged slabs to the pool and forget the queue.
+     *
+     * Called when a connection fails; frames that were never written are
+     * lost, as they would be with any dropped stream.
+     */
+    void discard_send_queue(ConnectionState& conn);
+
+    /**
+     * @brief Look up a connection under the shared lock and run @p fn on it.
+     */
+    template <typename Fn>
+    void with_connection(uint64_t endpoint_id, Fn&& fn)
+    {
+        std::shared_lock lock(m_connections_mutex);
+        auto it = m_connections.find(endpoint_id);
+        if (it != m_connections.end()) {
+            std::forward<Fn>(fn)(*it->second);
+        }
+    }
+
     /**
      * @brief Handle a connection error (read/write failure).
      *
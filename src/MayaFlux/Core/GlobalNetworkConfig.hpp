@@ -120,6 +120,23 @@ struct MAYAFLUX_API TCPBackendInfo {
     uint32_t reconnect_interval_ms { 2000 };
     uint32_t connect_timeout_ms { 5000 };
 
+    /// Disable Nagle's algorithm. The backend coalesces queued frames itself,
+    /// so delaying small segments in the kernel only adds latency.
+    bool no_delay { true };
+
+    /// Hold a short send queue back for up to this long so more frames can
+    /// join the same write. 0 writes as soon as the io thread is free.
+    uint32_t cork_us { 0 };
+
+    /// A corked queue is written immediately once it holds this many bytes.
+    size_t cork_bytes { 16384 };
+
+    /// Block size for pooled receive buffers and send staging.
+    size_t slab_size { 65536 };
+
+    /// Bytes queued per connection before send() refuses more; 0 is unbounded.
+    size_t send_queue_limit { 8 * 1024 * 1024 };
+
     static constexpr auto describe()
     {
         return std::make_tuple(
@@ -128,7 +145,12 @@ struct MAYAFLUX_API TCPBackendInfo {
             Reflect::member("receive_buffer_size", &TCPBackendInfo::receive_buffer_size),
             Reflect::member("auto_reconnect", &TCPBackendInfo::auto_reconnect),
             Reflect::member("reconnect_interval_ms", &TCPBackendInfo::reconnect_interval_ms),
-            Reflect::member("connect_timeout_ms", &TCPBackendInfo::connect_timeout_ms));
+            Reflect::member("connect_timeout_ms", &TCPBackendInfo::connect_timeout_ms),
+            Reflect::member("no_delay", &TCPBackendInfo::no_delay),
+            Reflect::member("cork_us", &TCPBackendInfo::cork_us),
+            Reflect::member("cork_bytes", &TCPBackendInfo::cork_bytes),
+            Reflect::member("slab_size", &TCPBackendInfo::slab_size),
+            Reflect::member("send_queue_limit", &TCPBackendInfo::send_queue_limit));
     }
 };
 
@@ -51,8 +51,31 @@ struct GlobalStreamInfo {
 #error "Unknown or unsupport audio backend"
 #endif
 
-    /** @brief Sample data format for stream processing */
+    /**
+     * @brief Sample format of the buffers exchanged with the audio backend
+     *
+     * FLOAT32 halves the size of device buffers and avoids the server-side
+     * conversion from 64-bit samples; the node graph and audio buffers keep
+     * running in double unless block_node_rendering is set. Integer formats
+     * are not supported on the callback path and behave as FLOAT64. Building
+     * with MAYAFLUX_AUDIO_F32 makes FLOAT32 the default.
+     */
+#ifdef MAYAFLUX_AUDIO_F32
+    AudioFormat format = AudioFormat::FLOAT32;
+#else
     AudioFormat format = AudioFormat::FLOAT64;
+#endif
+
+    /**
+     * @brief Render audio-rate nodes one float block per channel (FLOAT32 only)
+     *
+     * Opt-in: each channel's nodes render a whole block through
+     * Node::process_batch_f32() before mixing, so scheduled tasks and other
+     * control changes take effect at block rather than sample granularity.
+     * Cycles where any node reads another node or fires tick callbacks (see
+     * Node::is_block_independent()) fall back to per-sample rendering.
+     */
+    bool block_node_rendering = false;
 
     /** @brief Channel organization mode (true: planar, false: interleaved) */
     bool non_interleaved = false;
@@ -161,6 +184,18 @@ struct GlobalStreamInfo {
         return (output.enabled ? output.channels : 0) + (input.enabled ? input.channels : 0);
     }
 
+    /**
+     * @brief Whether backend buffers carry 32-bit float samples
+     * @return true for FLOAT32, false for FLOAT64 and the unsupported integer formats
+     */
+    [[nodiscard]] bool uses_float32() const { return format == AudioFormat::FLOAT32; }
+
+    /**
+     * @brief Size in bytes of one sample in backend buffers
+     * @return 4 when uses_float32(), otherwise 8
+     */
+    [[nodiscard]] uint32_t sample_bytes() const { return uses_float32() ? sizeof(float) : sizeof(double); }
+
     /**
      * @brief Retrieves the number of output channels
      * @return Number of output channels configured in the stream
@@ -173,6 +208,7 @@ struct GlobalStreamInfo {
             Reflect::member("sample_rate", &GlobalStreamInfo::sample_rate),
             Reflect::member("buffer_size", &GlobalStreamInfo::buffer_size),
             Reflect::member("format", &GlobalStreamInfo::format),
+            Reflect::member("block_node_rendering", &GlobalStreamInfo::block_node_rendering),
             Reflect::member("non_interleaved", &GlobalStreamInfo::non_interleaved),
             Reflect::member("output", &GlobalStreamInfo::output),
             Reflect::member("input", &GlobalStreamInfo::input),
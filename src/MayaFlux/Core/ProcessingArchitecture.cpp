@@ -117,6 +117,16 @@ double NodeProcessingHandle::process_sample(uint32_t channel)
     return m_manager->process_sample(m_token, channel);
 }
 
+void NodeProcessingHandle::process_channel_f32(uint32_t channel, std::span<float> output)
+{
+    m_manager->process_channel_f32(m_token, channel, output);
+}
+
+bool NodeProcessingHandle::can_render_blocks() const
+{
+    return m_manager->can_render_blocks(m_token);
+}
+
 std::vector<std::vector<double>> NodeProcessingHandle::process_audio_networks(uint32_t num_samples, uint32_t channel)
 {
     return m_manager->process_audio_networks(m_token, num_samples, channel);
@@ -132,6 +142,11 @@ void NodeProcessingHandle::cleanup_completed_routing()
     m_manager->cleanup_completed_routing(m_token);
 }
 
+size_t NodeProcessingHandle::commit_pending_topology()
+{
+    return m_manager->commit_pending_topology();
+}
+
 TaskSchedulerHandle::TaskSchedulerHandle(
     std::shared_ptr<Vruta::TaskScheduler> task_manager,
     Vruta::ProcessingToken token)
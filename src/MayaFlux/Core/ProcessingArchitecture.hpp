@@ -161,10 +161,19 @@ public:
 
     double process_sample(uint32_t channel);
 
+    /** @brief Render one normalized single-precision block for a channel */
+    void process_channel_f32(uint32_t channel, std::span<float> output);
+
+    /** @brief Whether this cycle can use process_channel_f32() for every channel */
+    [[nodiscard]] bool can_render_blocks() const;
+
     void update_routing_states();
 
     void cleanup_completed_routing();
 
+    /** @brief Apply queued topology edits and free retired snapshots (control thread) */
+    size_t commit_pending_topology();
+
     std::vector<std::vector<double>> process_audio_networks(uint32_t num_samples, uint32_t channel = 0);
 
     /** @brief Create node with automatic token assignment */
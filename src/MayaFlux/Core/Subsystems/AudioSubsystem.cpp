@@ -4,6 +4,9 @@
 #include "MayaFlux/Registry/Service/AudioBackendService.hpp"
 
 #include "MayaFlux/Journal/Archivist.hpp"
+#include "MayaFlux/Kakshya/Utils/ConversionKernels.hpp"
+#include "MayaFlux/Nodes/RootNode.hpp"
+#include "MayaFlux/Transitive/Profile/Profiler.hpp"
 
 namespace MayaFlux::Core {
 
@@ -29,6 +32,11 @@ void AudioSubsystem::initialize(SubsystemProcessingHandle& handle)
         m_stream_info,
         this);
 
+    m_input_wide.resize(static_cast<size_t>(m_stream_info.buffer_size) * m_stream_info.input.channels);
+    m_output_wide.resize(static_cast<size_t>(m_stream_info.buffer_size) * m_stream_info.output.channels);
+    if (m_stream_info.uses_float32() && m_stream_info.block_node_rendering)
+        m_node_blocks.resize(static_cast<size_t>(m_stream_info.buffer_size) * m_stream_info.output.channels);
+
     register_backend_service();
     m_notify_running.store(true, std::memory_order_release);
 
@@ -52,28 +60,79 @@ void AudioSubsystem::register_callbacks()
 
     m_audio_stream->set_process_callback(
         [this](void* output_buffer, void* input_buffer, unsigned int num_frames) -> int {
-            auto input_ptr = static_cast<double*>(input_buffer);
-            auto output_ptr = static_cast<double*>(output_buffer);
-
-            if (input_ptr && output_ptr) {
-                return this->process_audio(input_ptr, output_ptr, num_frames);
-            }
-
-            if (output_ptr) {
-                return this->process_output(output_ptr, num_frames);
+            if (m_stream_info.uses_float32()) {
+                return this->process_float32(
+                    static_cast<float*>(output_buffer),
+                    static_cast<const float*>(input_buffer),
+                    num_frames);
             }
 
-            if (input_ptr) {
-                return this->process_input(input_ptr, num_frames);
-            }
-            return 0;
+            return this->process_cycle(
+                static_cast<double*>(output_buffer),
+                static_cast<double*>(input_buffer),
+                num_frames);
         });
 }
 
+int AudioSubsystem::process_cycle(double* output_buffer, double* input_buffer, unsigned int num_frames)
+{
+    Nodes::ProcessingScope processing_scope;
+
+    if (input_buffer && output_buffer) {
+        return process_audio(input_buffer, output_buffer, num_frames);
+    }
+
+    if (!input_buffer && !output_buffer) {
+        return 0;
+    }
+
+    for (const auto& [name, hook] : m_handle->pre_process_hooks) {
+        hook(num_frames);
+    }
+
+    const int status = output_buffer
+        ? process_output(output_buffer, num_frames)
+        : process_input(input_buffer, num_frames);
+
+    for (const auto& [name, hook] : m_handle->post_process_hooks) {
+        hook(num_frames);
+    }
+
+    return status;
+}
+
+int AudioSubsystem::process_float32(float* output_buffer, const float* input_buffer, unsigned int num_frames)
+{
+    const size_t in_samples = input_buffer ? static_cast<size_t>(num_frames) * m_stream_info.input.channels : 0;
+    const size_t out_samples = output_buffer ? static_cast<size_t>(num_frames) * m_stream_info.output.channels : 0;
+
+    if (m_input_wide.size() < in_samples)
+        m_input_wide.resize(in_samples);
+    if (m_output_wide.size() < out_samples)
+        m_output_wide.resize(out_samples);
+
+    if (input_buffer) {
+        Kakshya::widen_to_double({ input_buffer, in_samples }, m_input_wide);
+    }
+
+    const int status = process_cycle(
+        output_buffer ? m_output_wide.data() : nullptr,
+        input_buffer ? m_input_wide.data() : nullptr,
+        num_frames);
+
+    if (output_buffer) {
+        Kakshya::narrow_to_float({ m_output_wide.data(), out_samples }, { output_buffer, out_samples });
+    }
+    return status;
+}
+
 int AudioSubsystem::process_output(double* output_buffer, unsigned int num_frames)
 {
     m_callback_active.fetch_add(1, std::memory_order_acquire);
 
+    Profile::Zone cycle_zone(Profile::Category::CYCLE, this, "audio_output",
+        m_stream_info.sample_rate ? static_cast<uint32_t>(uint64_t(num_frames) * 1'000'000'000ULL / m_stream_info.sample_rate) : 0);
+
     if (output_buffer == nullptr) {
         MF_RT_ERROR(Journal::Component::Core, Journal::Context::AudioCallback,
             "No output available");
@@ -128,6 +187,18 @@ int AudioSubsystem::process_output(double* output_buffer, unsigned int num_frame
             }
         }
 
+        const bool block_nodes = m_stream_info.uses_float32() && m_stream_info.block_node_rendering
+            && m_handle->nodes.can_render_blocks();
+        if (block_nodes) {
+            if (m_node_blocks.size() < total_samples)
+                m_node_blocks.resize(total_samples);
+
+            for (uint32_t channel = 0; channel < num_channels; channel++) {
+                m_handle->nodes.process_channel_f32(channel,
+                    std::span<float>(m_node_blocks).subspan(static_cast<size_t>(channel) * num_frames, num_frames));
+            }
+        }
+
         for (size_t i = 0; i < num_frames; ++i) {
 
             m_handle->tasks.process(1);
@@ -138,7 +209,10 @@ int AudioSubsystem::process_output(double* output_buffer, unsigned int num_frame
                     buffer_sample = buffer_data[j][i];
                 }
 
-                double sample = m_handle->nodes.process_sample(j) + buffer_sample;
+                double node_sample = block_nodes
+                    ? static_cast<double>(m_node_blocks[j * num_frames + i])
+                    : m_handle->nodes.process_sample(j);
+                double sample = node_sample + buffer_sample;
 
                 for (const auto& network_buffer : all_network_outputs[j]) {
                     if (i < network_buffer.size()) {
@@ -302,6 +376,10 @@ void AudioSubsystem::notify_loop()
 
         last_gen = m_snapshot_generation.load(std::memory_order_acquire);
 
+        if (m_handle) {
+            m_handle->nodes.commit_pending_topology();
+        }
+
         const double* ptr = m_snapshot_ptr.load(std::memory_order_acquire);
         uint32_t sz = m_snapshot_size.load(std::memory_order_acquire);
 
@@ -406,6 +484,10 @@ void AudioSubsystem::stop()
     if (m_notify_thread.joinable())
         m_notify_thread.join();
 
+    if (m_handle) {
+        m_handle->nodes.commit_pending_topology();
+    }
+
     MF_INFO(Journal::Component::Core, Journal::Context::AudioSubsystem,
         "AudioSubsystem stopped");
 }
@@ -121,8 +121,28 @@ public:
 private:
     using ObserverMap = std::unordered_map<uint32_t, std::function<void(const double*, uint32_t)>>;
     void register_backend_service();
+    /** @brief Observer fan-out and node topology upkeep, woken once per output cycle */
     void notify_loop();
 
+    /**
+     * @brief Routes one backend cycle to process_audio(), process_output() or process_input()
+     *        depending on which buffers the backend supplied. Process hooks run
+     *        once per cycle on every path, including output-only streams.
+     */
+    int process_cycle(double* output_buffer, double* input_buffer, unsigned int num_frames);
+
+    /**
+     * @brief FLOAT32 stream entry point: widens input, runs process_cycle() in
+     *        double, narrows the mixed output back into the device buffer.
+     *        With block_node_rendering set, process_output() renders the node
+     *        graph in float blocks rather than one double sample at a time.
+     */
+    int process_float32(float* output_buffer, const float* input_buffer, unsigned int num_frames);
+
+    std::vector<double> m_input_wide; ///< FLOAT32 streams: widened device input
+    std::vector<double> m_output_wide; ///< FLOAT32 streams: double mix before narrowing
+    std::vector<float> m_node_blocks; ///< Block node rendering: per-channel node graph blocks, channel-major
+
     GlobalStreamInfo m_stream_info; ///< Audio stream configuration
 
     std::unique_ptr<IAudioBackend> m_audiobackend; ///< Audio backend implementation
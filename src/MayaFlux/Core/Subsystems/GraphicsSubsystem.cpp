@@ -9,6 +9,7 @@
 #include "MayaFlux/Vruta/Routine.hpp"
 
 #include "MayaFlux/Portal/Graphics/Graphics.hpp"
+#include "MayaFlux/Portal/Graphics/ShaderFoundry.hpp"
 #include "MayaFlux/Portal/Text/Text.hpp"
 
 namespace MayaFlux::Core {
@@ -79,6 +80,11 @@ void GraphicsSubsystem::initialize_graphics_portal()
 {
     try {
         if (auto vulkan_backend = dynamic_cast<VulkanBackend*>(m_backend.get())) {
+            const auto& backend_info = m_graphics_config.backend_info;
+            if (backend_info.shader_compilation == GraphicsBackendInfo::ShaderCompilation::CACHED) {
+                Portal::Graphics::ShaderFoundry::instance().set_spirv_cache_directory(backend_info.shader_cache_dir);
+            }
+
             Portal::Graphics::initialize(std::shared_ptr<VulkanBackend>(vulkan_backend, [](VulkanBackend*) { }));
         }
     } catch (std::exception& e) {
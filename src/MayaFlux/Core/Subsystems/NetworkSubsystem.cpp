@@ -327,6 +327,12 @@ bool NetworkSubsystem::send_to(uint64_t endpoint_id, const uint8_t* data, size_t
     return backend->send_to(endpoint_id, data, size, address, port);
 }
 
+size_t NetworkSubsystem::get_send_queue_bytes(uint64_t endpoint_id) const
+{
+    auto* tcp = dynamic_cast<TCPBackend*>(resolve_backend(endpoint_id));
+    return tcp ? tcp->get_send_queue_bytes(endpoint_id) : 0;
+}
+
 EndpointState NetworkSubsystem::get_endpoint_state(uint64_t endpoint_id) const
 {
     auto* backend = resolve_backend(endpoint_id);
@@ -399,6 +405,10 @@ void NetworkSubsystem::register_backend_service()
         return send_to(id, data, size, addr, port);
     };
 
+    service->get_send_queue_bytes = [this](uint64_t id) {
+        return get_send_queue_bytes(id);
+    };
+
     service->get_endpoint_state = [this](uint64_t id) {
         return get_endpoint_state(id);
     };
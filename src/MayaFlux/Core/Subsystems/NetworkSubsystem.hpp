@@ -136,6 +136,11 @@ public:
     bool send_to(uint64_t endpoint_id, const uint8_t* data, size_t size,
         const std::string& address, uint16_t port);
 
+    /**
+     * @brief Bytes queued for sending on a TCP connection; 0 otherwise
+     */
+    [[nodiscard]] size_t get_send_queue_bytes(uint64_t endpoint_id) const;
+
     /**
      * @brief Query endpoint state
      */
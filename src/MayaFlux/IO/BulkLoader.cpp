@@ -0,0 +1,568 @@
+#include "BulkLoader.hpp"
+
+#include "ModelReader.hpp"
+
+#include "MayaFlux/Buffers/Geometry/MeshBuffer.hpp"
+#include "MayaFlux/Buffers/Textures/TextureBuffer.hpp"
+#include "MayaFlux/Kakshya/Source/SoundFileContainer.hpp"
+#include "MayaFlux/Nodes/Network/MeshNetwork.hpp"
+
+#include "MayaFlux/Journal/Archivist.hpp"
+
+namespace MayaFlux::IO {
+
+namespace {
+
+    double ms_since(std::chrono::steady_clock::time_point from)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - from).count();
+    }
+
+    /// Canonical key so a file reached through different relative paths decodes once.
+    std::string texture_key(const std::string& path)
+    {
+        return std::filesystem::path(FileReader::resolve_path(path)).lexically_normal().generic_string();
+    }
+
+    bool needs_texture_stage(const AssetRequest& request)
+    {
+        return (request.kind == AssetKind::Mesh || request.kind == AssetKind::MeshNetwork) && !request.resolver;
+    }
+
+}
+
+BulkLoad::BulkLoad(IOManager& manager, AssetManifest manifest, BulkLoadOptions options)
+    : m_manager(manager)
+    , m_options(std::move(options))
+    , m_assets(manifest.size())
+{
+    const auto now = Clock::now();
+    bool spawns_textures = false;
+
+    std::lock_guard lock(m_mutex);
+
+    m_progress.total = m_assets.size();
+
+    for (size_t i = 0; i < m_assets.size(); ++i) {
+        auto& asset = m_assets[i];
+        asset.request = std::move(manifest[i]);
+        asset.submitted = now;
+        asset.future = asset.promise.get_future().share();
+
+        switch (asset.request.kind) {
+        case AssetKind::Image: {
+            const size_t t = require_texture(texture_key(asset.request.path), asset.request.priority, i);
+            asset.texture_lookup.emplace(asset.request.path, t);
+            asset.state = State::WaitingTextures;
+            if (asset.pending_textures == 0) {
+                mark_ready(i);
+            }
+            break;
+        }
+        case AssetKind::Video:
+            mark_ready(i);
+            break;
+        default:
+            spawns_textures = spawns_textures || needs_texture_stage(asset.request);
+            m_jobs.push({ .priority = asset.request.priority, .sequence = m_next_sequence++, .kind = JobKind::Asset, .index = i });
+            break;
+        }
+    }
+
+    if (m_jobs.empty()) {
+        return;
+    }
+
+    size_t workers = m_options.max_workers ? m_options.max_workers : std::max(1U, std::thread::hardware_concurrency());
+    if (!spawns_textures) {
+        workers = std::min(workers, m_jobs.size());
+    }
+
+    m_workers.reserve(workers);
+    for (size_t w = 0; w < workers; ++w) {
+        m_workers.emplace_back([this] { worker_loop(); });
+    }
+
+    MF_INFO(Journal::Component::IO, Journal::Context::FileIO,
+        "BulkLoad: {} assets ({} textures) on {} workers",
+        m_assets.size(), m_textures.size(), workers);
+}
+
+BulkLoad::~BulkLoad()
+{
+    cancel();
+    join();
+    poll();
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Scheduling
+// ─────────────────────────────────────────────────────────────────────────
+
+size_t BulkLoad::require_texture(const std::string& path, int32_t priority, size_t dependent)
+{
+    auto [it, inserted] = m_texture_index.try_emplace(path, m_textures.size());
+    if (inserted) {
+        m_textures.emplace_back();
+        m_textures.back().path = path;
+        ++m_progress.textures_total;
+    }
+
+    const size_t t = it->second;
+    auto& tex = m_textures[t];
+    ++tex.consumers;
+
+    if (tex.decoded) {
+        return t;
+    }
+
+    tex.waiters.push_back(dependent);
+    ++m_assets[dependent].pending_textures;
+
+    // A higher-priority dependent re-queues the decode; the stale job is skipped.
+    if (!tex.decoding && (!tex.queued || priority > tex.priority)) {
+        tex.queued = true;
+        tex.priority = priority;
+        m_jobs.push({ .priority = priority, .sequence = m_next_sequence++, .kind = JobKind::Texture, .index = t });
+        m_work_cv.notify_one();
+    }
+
+    return t;
+}
+
+void BulkLoad::mark_ready(size_t index)
+{
+    auto& asset = m_assets[index];
+    asset.state = State::Ready;
+    asset.decode_ms = ms_since(asset.submitted);
+
+    m_ready.push({ .priority = asset.request.priority, .sequence = m_next_sequence++, .kind = JobKind::Asset, .index = index });
+    ++m_progress.decoded;
+    m_ready_cv.notify_all();
+}
+
+void BulkLoad::worker_loop()
+{
+    while (true) {
+        Job job;
+        std::string texture_path;
+        {
+            std::unique_lock lock(m_mutex);
+            m_work_cv.wait(lock, [this] {
+                return is_cancelled() || !m_jobs.empty() || m_in_flight == 0;
+            });
+
+            if (is_cancelled() || m_jobs.empty()) {
+                m_work_cv.notify_all();
+                return;
+            }
+
+            job = m_jobs.top();
+            m_jobs.pop();
+
+            if (job.kind == JobKind::Texture) {
+                auto& tex = m_textures[job.index];
+                if (!tex.queued || tex.decoding) {
+                    continue;
+                }
+                tex.decoding = true;
+                texture_path = tex.path;
+            } else {
+                m_assets[job.index].state = State::Decoding;
+            }
+
+            ++m_in_flight;
+        }
+
+        if (job.kind == JobKind::Texture) {
+            decode_texture(job.index, texture_path);
+        } else {
+            decode_asset(job.index);
+        }
+
+        {
+            std::lock_guard lock(m_mutex);
+            --m_in_flight;
+        }
+        m_work_cv.notify_all();
+    }
+}
+
+void BulkLoad::decode_asset(size_t index)
+{
+    auto& asset = m_assets[index];
+    const auto& request = asset.request;
+
+    std::string error;
+    std::shared_ptr<SoundFileReader> audio_reader;
+    std::shared_ptr<Kakshya::SoundFileContainer> audio;
+    std::vector<Kakshya::MeshData> meshes;
+
+    if (request.kind == AssetKind::Audio) {
+        audio_reader = std::make_shared<SoundFileReader>();
+
+        if (!audio_reader->can_read(request.path)) {
+            error = "Cannot read file";
+        } else {
+            audio_reader->set_target_sample_rate(m_manager.m_stream_info.sample_rate);
+            audio_reader->set_audio_options(request.config.audio_options);
+
+            if (!audio_reader->open(request.path, request.config.file_options)) {
+                error = "Failed to open file: " + audio_reader->get_last_error();
+            } else {
+                audio = std::dynamic_pointer_cast<Kakshya::SoundFileContainer>(audio_reader->create_container());
+                if (!audio) {
+                    error = "Failed to create sound container";
+                } else if (!audio_reader->load_into_container(audio)) {
+                    error = "Failed to load audio data: " + audio_reader->get_last_error();
+                }
+            }
+        }
+    } else {
+        ModelReader reader;
+        reader.set_cache(m_manager.m_mesh_cache);
+
+        if (!reader.can_read(request.path)) {
+            error = "Unsupported model format";
+        } else {
+            meshes = reader.load(request.path);
+            if (meshes.empty()) {
+                error = reader.get_last_error().empty() ? "No meshes in model" : "Failed to load model: " + reader.get_last_error();
+            }
+        }
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    if (asset.state != State::Decoding) {
+        return;
+    }
+
+    asset.error = std::move(error);
+    asset.audio_reader = std::move(audio_reader);
+    asset.audio = std::move(audio);
+    asset.meshes = std::move(meshes);
+
+    if (asset.error.empty() && needs_texture_stage(request)) {
+        const auto base_dir = std::filesystem::path(request.path).parent_path();
+        for (const auto& mesh : asset.meshes) {
+            auto raw = ModelReader::diffuse_path(mesh);
+            if (raw.empty() || asset.texture_lookup.contains(raw)) {
+                continue;
+            }
+            const size_t t = require_texture(texture_key((base_dir / raw).generic_string()), request.priority, index);
+            asset.texture_lookup.emplace(std::move(raw), t);
+        }
+    }
+
+    asset.state = State::WaitingTextures;
+    if (asset.pending_textures == 0) {
+        mark_ready(index);
+    }
+}
+
+void BulkLoad::decode_texture(size_t index, const std::string& path)
+{
+    auto data = ImageReader::load(path, 4);
+
+    if (!data) {
+        MF_WARN(Journal::Component::IO, Journal::Context::FileIO,
+            "BulkLoad: failed to decode texture '{}'", path);
+    }
+
+    std::lock_guard lock(m_mutex);
+
+    auto& tex = m_textures[index];
+    tex.data = std::move(data);
+    tex.decoded = true;
+    tex.decoding = false;
+    tex.queued = false;
+    ++m_progress.textures_decoded;
+
+    for (const size_t waiter : tex.waiters) {
+        auto& asset = m_assets[waiter];
+        if (--asset.pending_textures == 0 && asset.state == State::WaitingTextures) {
+            mark_ready(waiter);
+        }
+    }
+    tex.waiters.clear();
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Finalisation
+// ─────────────────────────────────────────────────────────────────────────
+
+size_t BulkLoad::poll(size_t max_assets)
+{
+    size_t handled = 0;
+
+    if (is_cancelled()) {
+        std::vector<size_t> pending;
+        {
+            std::lock_guard lock(m_mutex);
+            for (size_t i = 0; i < m_assets.size(); ++i) {
+                if (m_assets[i].state != State::Done) {
+                    m_assets[i].state = State::Done;
+                    pending.push_back(i);
+                }
+            }
+            m_ready = {};
+        }
+
+        for (const size_t i : pending) {
+            auto result = make_result(i);
+            result.cancelled = true;
+            result.error = "Cancelled";
+            resolve(i, std::move(result));
+        }
+        handled = pending.size();
+    }
+
+    while (max_assets == 0 || handled < max_assets) {
+        size_t index {};
+        {
+            std::lock_guard lock(m_mutex);
+            if (m_ready.empty()) {
+                break;
+            }
+            index = m_ready.top().index;
+            m_ready.pop();
+            m_assets[index].state = State::Done;
+        }
+
+        finalize(index);
+        ++handled;
+    }
+
+    report_progress();
+    return handled;
+}
+
+std::vector<LoadedAsset> BulkLoad::wait()
+{
+    while (true) {
+        poll();
+
+        std::unique_lock lock(m_mutex);
+        if (m_progress.done()) {
+            break;
+        }
+        m_ready_cv.wait(lock, [this] {
+            return !m_ready.empty() || is_cancelled();
+        });
+    }
+
+    std::vector<LoadedAsset> results;
+    results.reserve(m_assets.size());
+    for (const auto& asset : m_assets) {
+        results.push_back(asset.future.get());
+    }
+    return results;
+}
+
+void BulkLoad::finalize(size_t index)
+{
+    auto& asset = m_assets[index];
+    const auto& request = asset.request;
+    const auto start = Clock::now();
+
+    auto result = make_result(index);
+    result.error = asset.error;
+
+    if (result.error.empty()) {
+        switch (request.kind) {
+        case AssetKind::Audio:
+            m_manager.configure_audio_processor(asset.audio);
+            m_manager.m_audio_readers.push_back(std::move(asset.audio_reader));
+            result.audio = std::move(asset.audio);
+            break;
+
+        case AssetKind::Image: {
+            const auto& tex = m_textures[asset.texture_lookup.begin()->second];
+            if (!tex.data) {
+                result.error = "Failed to decode image";
+                break;
+            }
+            result.image = std::make_shared<Buffers::TextureBuffer>(
+                tex.data->width, tex.data->height, tex.data->format, tex.data->data());
+            break;
+        }
+
+        case AssetKind::Mesh:
+        case AssetKind::MeshNetwork: {
+            TextureResolver resolver = request.resolver;
+            if (!resolver) {
+                resolver = [this, index](const std::string& raw) { return upload_texture(index, raw); };
+            }
+
+            if (request.kind == AssetKind::Mesh) {
+                result.meshes = ModelReader::build_mesh_buffers(asset.meshes, resolver);
+                if (result.meshes.empty()) {
+                    result.error = "No usable meshes in model";
+                }
+            } else {
+                result.mesh_network = ModelReader::build_mesh_network(asset.meshes, resolver);
+                if (!result.mesh_network || result.mesh_network->slot_count() == 0) {
+                    result.error = "No usable meshes in model";
+                }
+            }
+            asset.meshes = {};
+            break;
+        }
+
+        case AssetKind::Video:
+            result.video = m_manager.load_video(request.path, request.config);
+            if (!result.video.video) {
+                result.error = "Failed to load video";
+            }
+            break;
+        }
+    }
+
+    result.success = result.error.empty();
+    result.finalize_ms = ms_since(start);
+
+    if (!result.success) {
+        MF_ERROR(Journal::Component::API, Journal::Context::FileIO,
+            "BulkLoad: '{}' failed — {}", request.path, result.error);
+    }
+
+    release_textures(index);
+    resolve(index, std::move(result));
+}
+
+std::shared_ptr<Core::VKImage> BulkLoad::upload_texture(size_t index, const std::string& raw)
+{
+    TextureEntry* tex = nullptr;
+    {
+        std::lock_guard lock(m_mutex);
+        const auto& lookup = m_assets[index].texture_lookup;
+        const auto it = lookup.find(raw);
+        if (it == lookup.end()) {
+            return nullptr;
+        }
+        tex = &m_textures[it->second];
+    }
+
+    if (!tex->image && tex->data) {
+        tex->image = Portal::Graphics::get_texture_manager().create_2d(
+            tex->data->width, tex->data->height, tex->data->format, tex->data->data());
+    }
+    return tex->image;
+}
+
+void BulkLoad::release_textures(size_t index)
+{
+    std::lock_guard lock(m_mutex);
+
+    for (const auto& [raw, t] : m_assets[index].texture_lookup) {
+        auto& tex = m_textures[t];
+        if (--tex.consumers != 0) {
+            continue;
+        }
+        // Pixels are only needed until the last known consumer finalises. A
+        // model imported later can still share the uploaded image; without
+        // one it decodes the file again.
+        tex.data.reset();
+        if (!tex.image) {
+            tex.decoded = false;
+            --m_progress.textures_decoded;
+        }
+    }
+}
+
+LoadedAsset BulkLoad::make_result(size_t index) const
+{
+    const auto& asset = m_assets[index];
+    return LoadedAsset {
+        .kind = asset.request.kind,
+        .path = asset.request.path,
+        .index = index,
+        .decode_ms = asset.decode_ms,
+    };
+}
+
+void BulkLoad::resolve(size_t index, LoadedAsset result)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        if (result.cancelled) {
+            ++m_progress.cancelled;
+        } else if (result.success) {
+            ++m_progress.completed;
+        } else {
+            ++m_progress.failed;
+        }
+    }
+
+    if (m_options.on_loaded) {
+        m_options.on_loaded(result);
+    }
+    m_assets[index].promise.set_value(std::move(result));
+}
+
+void BulkLoad::report_progress()
+{
+    BulkLoadProgress snapshot;
+    {
+        std::lock_guard lock(m_mutex);
+        snapshot = m_progress;
+    }
+
+    if (snapshot == m_reported) {
+        return;
+    }
+    m_reported = snapshot;
+
+    if (m_options.on_progress) {
+        m_options.on_progress(snapshot);
+    }
+
+    if (snapshot.done()) {
+        MF_INFO(Journal::Component::IO, Journal::Context::FileIO,
+            "BulkLoad: {} loaded, {} failed, {} cancelled ({} textures)",
+            snapshot.completed, snapshot.failed, snapshot.cancelled, snapshot.textures_total);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────────────────
+// Control
+// ─────────────────────────────────────────────────────────────────────────
+
+void BulkLoad::cancel()
+{
+    m_cancelled.store(true, std::memory_order_release);
+    {
+        std::lock_guard lock(m_mutex);
+    }
+    m_work_cv.notify_all();
+    m_ready_cv.notify_all();
+}
+
+void BulkLoad::join()
+{
+    for (auto& worker : m_workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+}
+
+bool BulkLoad::is_done() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_progress.done();
+}
+
+BulkLoadProgress BulkLoad::progress() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_progress;
+}
+
+std::shared_future<LoadedAsset> BulkLoad::future(size_t index) const
+{
+    return m_assets.at(index).future;
+}
+
+} // namespace MayaFlux::IO
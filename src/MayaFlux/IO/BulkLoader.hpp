@@ -0,0 +1,278 @@
+#pragma once
+
+#include "IOManager.hpp"
+
+#include "ImageReader.hpp"
+
+#include "MayaFlux/Kakshya/NDData/MeshData.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <queue>
+
+namespace MayaFlux::IO {
+
+/**
+ * @enum AssetKind
+ * @brief Which IOManager loader an AssetRequest maps to.
+ */
+enum class AssetKind : uint8_t {
+    Audio, ///< load_audio(): SoundFileContainer
+    Image, ///< load_image(): TextureBuffer
+    Mesh, ///< load_mesh(): one MeshBuffer per mesh
+    MeshNetwork, ///< load_mesh_network(): MeshNetwork
+    Video ///< load_video(path, config): VideoLoadResult
+};
+
+/**
+ * @struct AssetRequest
+ * @brief One manifest entry for IOManager::load_batch().
+ */
+struct AssetRequest {
+    AssetKind kind { AssetKind::Audio };
+    std::string path;
+
+    /// Higher decodes and finalises first; equal priorities keep manifest order.
+    int32_t priority {};
+
+    /// Audio and video options. Ignored for images and meshes.
+    LoadConfig config {};
+
+    /**
+     * Mesh and MeshNetwork only. Null shares the batch texture stage:
+     * diffuse textures are resolved relative to the model file, decoded on
+     * the worker pool once per unique file, and uploaded once.
+     */
+    TextureResolver resolver;
+};
+
+using AssetManifest = std::vector<AssetRequest>;
+
+/**
+ * @struct LoadedAsset
+ * @brief Result of one manifest entry. Only the member matching @c kind is set.
+ */
+struct LoadedAsset {
+    AssetKind kind { AssetKind::Audio };
+    std::string path;
+    size_t index {}; ///< Position in the manifest
+
+    bool success {};
+    bool cancelled {};
+    std::string error;
+
+    std::shared_ptr<Kakshya::SoundFileContainer> audio;
+    std::shared_ptr<Buffers::TextureBuffer> image;
+    std::vector<std::shared_ptr<Buffers::MeshBuffer>> meshes;
+    std::shared_ptr<Nodes::Network::MeshNetwork> mesh_network;
+    VideoLoadResult video;
+
+    double decode_ms {}; ///< Submission until decoded, including queueing and textures
+    double finalize_ms {}; ///< Time on the finalising thread
+};
+
+/**
+ * @struct BulkLoadProgress
+ * @brief Snapshot of a batch. Textures count the shared decode stage only.
+ */
+struct BulkLoadProgress {
+    size_t total {};
+    size_t decoded {}; ///< Decoded and waiting to finalise, or finalised
+    size_t completed {}; ///< Finalised successfully
+    size_t failed {};
+    size_t cancelled {};
+    size_t textures_total {};
+    size_t textures_decoded {};
+
+    [[nodiscard]] bool done() const noexcept { return completed + failed + cancelled == total; }
+    [[nodiscard]] float fraction() const noexcept
+    {
+        return total ? static_cast<float>(completed + failed + cancelled) / static_cast<float>(total) : 1.0F;
+    }
+
+    bool operator==(const BulkLoadProgress&) const = default;
+};
+
+/**
+ * @struct BulkLoadOptions
+ * @brief Worker count and events for IOManager::load_batch().
+ *
+ * Both callbacks run on the thread calling BulkLoad::poll() or wait(),
+ * never on a worker.
+ */
+struct BulkLoadOptions {
+    uint32_t max_workers {}; ///< 0 uses std::thread::hardware_concurrency()
+    std::function<void(const BulkLoadProgress&)> on_progress;
+    std::function<void(const LoadedAsset&)> on_loaded;
+};
+
+/**
+ * @class BulkLoad
+ * @brief A manifest of assets loading in parallel, created by IOManager::load_batch().
+ *
+ * Loading runs in two stages. Decoding (FFmpeg, stb_image, assimp) is CPU
+ * work and runs on a private worker pool in priority order. Finalising
+ * creates GPU objects and registers readers with IOManager; TextureLoom
+ * and BufferManager expect that on one thread, so it happens in poll() or
+ * wait() on the caller's thread, again in priority order.
+ *
+ * Models are a dependency source: once a model is imported its diffuse
+ * texture paths become texture decode jobs, deduplicated across the whole
+ * batch (an Image entry and a model sharing a file decode it once). The
+ * model finalises only after all its textures have decoded. Video entries
+ * are opened by load_video() at finalise time, since their readers stream
+ * on a decode thread of their own.
+ *
+ * Each entry resolves a shared_future when it finalises. Futures are
+ * fulfilled by poll(), so do not block on one from the finalising thread
+ * without calling wait() or poll() first.
+ *
+ * cancel() stops work that has not started; decodes already running finish
+ * and are discarded. Entries not yet finalised resolve as cancelled.
+ * Destroying the handle cancels and joins the workers.
+ */
+class MAYAFLUX_API BulkLoad {
+public:
+    BulkLoad(IOManager& manager, AssetManifest manifest, BulkLoadOptions options);
+    ~BulkLoad();
+
+    BulkLoad(const BulkLoad&) = delete;
+    BulkLoad& operator=(const BulkLoad&) = delete;
+    BulkLoad(BulkLoad&&) = delete;
+    BulkLoad& operator=(BulkLoad&&) = delete;
+
+    /**
+     * @brief Finalise decoded entries on the calling thread.
+     * @param max_assets Stop after this many; 0 finalises everything ready.
+     *                   A frame loop can bound per-frame GPU work with it.
+     * @return Number of entries finalised or resolved as cancelled.
+     */
+    size_t poll(size_t max_assets = 0);
+
+    /**
+     * @brief Finalise entries as they decode until the whole batch resolves.
+     * @return Results in manifest order.
+     */
+    std::vector<LoadedAsset> wait();
+
+    /// @brief Stop scheduling decodes. Takes effect at the next poll().
+    void cancel();
+
+    /// @brief Block until the workers have exited. Used by IOManager teardown.
+    void join();
+
+    [[nodiscard]] bool is_cancelled() const noexcept { return m_cancelled.load(std::memory_order_acquire); }
+    [[nodiscard]] bool is_done() const;
+
+    [[nodiscard]] BulkLoadProgress progress() const;
+
+    [[nodiscard]] size_t size() const noexcept { return m_assets.size(); }
+
+    /// @brief Future for manifest entry @p index; ready once it finalises.
+    [[nodiscard]] std::shared_future<LoadedAsset> future(size_t index) const;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    enum class State : uint8_t {
+        Queued,
+        Decoding,
+        WaitingTextures,
+        Ready,
+        Done
+    };
+
+    enum class JobKind : uint8_t {
+        Asset,
+        Texture
+    };
+
+    struct Job {
+        int32_t priority {};
+        uint64_t sequence {};
+        JobKind kind { JobKind::Asset };
+        size_t index {};
+
+        /// Max-heap order: priority, then textures before assets so models
+        /// already imported complete first, then submission order.
+        bool operator<(const Job& other) const noexcept
+        {
+            if (priority != other.priority) {
+                return priority < other.priority;
+            }
+            if (kind != other.kind) {
+                return kind == JobKind::Asset;
+            }
+            return sequence > other.sequence;
+        }
+    };
+
+    struct TextureEntry {
+        std::string path;
+        int32_t priority {};
+        bool queued {};
+        bool decoding {};
+        bool decoded {};
+        std::optional<ImageData> data;
+        std::shared_ptr<Core::VKImage> image; ///< Created on first use by a model
+        std::vector<size_t> waiters; ///< Assets blocked on this decode
+        size_t consumers {}; ///< Assets that have not finalised yet
+    };
+
+    struct AssetEntry {
+        AssetRequest request;
+        State state { State::Queued };
+        size_t pending_textures {};
+        std::unordered_map<std::string, size_t> texture_lookup; ///< Raw path to m_textures index
+
+        std::shared_ptr<SoundFileReader> audio_reader;
+        std::shared_ptr<Kakshya::SoundFileContainer> audio;
+        std::vector<Kakshya::MeshData> meshes;
+
+        std::string error;
+        Clock::time_point submitted;
+        double decode_ms {};
+
+        std::promise<LoadedAsset> promise;
+        std::shared_future<LoadedAsset> future;
+    };
+
+    IOManager& m_manager;
+    BulkLoadOptions m_options;
+
+    std::vector<AssetEntry> m_assets;
+    std::deque<TextureEntry> m_textures; ///< Stable references while workers append
+    std::unordered_map<std::string, size_t> m_texture_index;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_work_cv;
+    std::condition_variable m_ready_cv;
+    std::priority_queue<Job> m_jobs;
+    std::priority_queue<Job> m_ready;
+    uint64_t m_next_sequence {};
+    size_t m_in_flight {};
+
+    BulkLoadProgress m_progress;
+    BulkLoadProgress m_reported;
+
+    std::atomic<bool> m_cancelled { false };
+    std::vector<std::thread> m_workers;
+
+    void worker_loop();
+    void decode_asset(size_t index);
+    void decode_texture(size_t index, const std::string& path);
+
+    /// Requires m_mutex. Returns the texture index, queueing a decode if needed.
+    size_t require_texture(const std::string& path, int32_t priority, size_t dependent);
+    /// Requires m_mutex.
+    void mark_ready(size_t index);
+
+    void finalize(size_t index);
+    std::shared_ptr<Core::VKImage> upload_texture(size_t index, const std::string& raw);
+    [[nodiscard]] LoadedAsset make_result(size_t index) const;
+    void resolve(size_t index, LoadedAsset result);
+    void release_textures(size_t index);
+    void report_progress();
+};
+
+} // namespace MayaFlux::IO
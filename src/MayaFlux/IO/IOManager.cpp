@@ -24,6 +24,7 @@
 #include "MayaFlux/Registry/Service/AudioBackendService.hpp"
 #include "MayaFlux/Registry/Service/IOService.hpp"
 
+#include "BulkLoader.hpp"
 #include "EXRWriter.hpp"
 #include "ImageExport.hpp"
 #include "ModelReader.hpp"
@@ -77,6 +78,17 @@ IOManager::IOManager(Core::GlobalStreamInfo& stream_info, uint32_t frame_rate, c
 
 IOManager::~IOManager()
 {
+    {
+        std::lock_guard lock(m_bulk_loads_mutex);
+        for (auto& weak : m_bulk_loads) {
+            if (auto load = weak.lock()) {
+                load->cancel();
+                load->join();
+            }
+        }
+        m_bulk_loads.clear();
+    }
+
     {
         std::vector<uint32_t> ids;
         {
@@ -636,9 +648,11 @@ IOManager::load_mesh(const std::string& filepath, TextureResolver resolver)
         return {};
     }
 
-    if (!reader->open(filepath)) {
+    reader->set_cache(m_mesh_cache);
+    const auto meshes = reader->load(filepath);
+    if (meshes.empty()) {
         MF_ERROR(Journal::Component::API, Journal::Context::FileIO,
-            "IOManager::load_mesh: failed to open '{}' — {}",
+            "IOManager::load_mesh: failed to load '{}' — {}",
             filepath, reader->get_last_error());
         return {};
     }
@@ -646,8 +660,7 @@ IOManager::load_mesh(const std::string& filepath, TextureResolver resolver)
     if (!resolver)
         resolver = make_default_resolver(filepath);
 
-    auto buffers = reader->create_mesh_buffers(resolver);
-    reader->close();
+    auto buffers = ModelReader::build_mesh_buffers(meshes, resolver);
 
     if (buffers.empty()) {
         MF_ERROR(Journal::Component::API, Journal::Context::FileIO,
@@ -674,9 +687,11 @@ IOManager::load_mesh_network(const std::string& filepath, TextureResolver resolv
         return nullptr;
     }
 
-    if (!reader->open(filepath)) {
+    reader->set_cache(m_mesh_cache);
+    const auto meshes = reader->load(filepath);
+    if (meshes.empty()) {
         MF_ERROR(Journal::Component::API, Journal::Context::FileIO,
-            "IOManager::load_mesh_network: failed to open '{}' — {}",
+            "IOManager::load_mesh_network: failed to load '{}' — {}",
             filepath, reader->get_last_error());
         return nullptr;
     }
@@ -684,8 +699,7 @@ IOManager::load_mesh_network(const std::string& filepath, TextureResolver resolv
     if (!resolver)
         resolver = make_default_resolver(filepath);
 
-    auto net = reader->create_mesh_network(resolver);
-    reader->close();
+    auto net = ModelReader::build_mesh_network(meshes, resolver);
 
     if (!net) {
         MF_ERROR(Journal::Component::API, Journal::Context::FileIO,
@@ -701,6 +715,23 @@ IOManager::load_mesh_network(const std::string& filepath, TextureResolver resolv
     return net;
 }
 
+bool IOManager::set_mesh_cache_directory(const std::filesystem::path& directory)
+{
+    return m_mesh_cache->set_directory(directory);
+}
+
+std::shared_ptr<BulkLoad>
+IOManager::load_batch(std::vector<AssetRequest> manifest, BulkLoadOptions options)
+{
+    auto load = std::make_shared<BulkLoad>(*this, std::move(manifest), std::move(options));
+
+    std::lock_guard lock(m_bulk_loads_mutex);
+    std::erase_if(m_bulk_loads, [](const auto& weak) { return weak.expired(); });
+    m_bulk_loads.push_back(load);
+
+    return load;
+}
+
 void IOManager::configure_frame_processor(
     const std::shared_ptr<Kakshya::VideoFileContainer>& container)
 {
@@ -2,6 +2,7 @@
 
 #include "CameraReader.hpp"
 #include "ImageWriter.hpp"
+#include "MeshCache.hpp"
 #include "SoundFileWriter.hpp"
 #include "VideoFileReader.hpp"
 #include "VideoFileWriter.hpp"
@@ -45,6 +46,9 @@ using TextureResolver = std::function<std::shared_ptr<Core::VKImage>(const std::
 
 class ImageReader;
 class ModelReader;
+class BulkLoad;
+struct AssetRequest;
+struct BulkLoadOptions;
 
 struct LoadConfig {
     FileReadOptions file_options { FileReadOptions::EXTRACT_METADATA | FileReadOptions::EXTRACT_REGIONS };
@@ -494,7 +498,8 @@ public:
      *
      * Opens the file via ModelReader, extracts all aiMesh entries as MeshData,
      * constructs one MeshBuffer per mesh, calls setup_processors() on each,
-     * and returns them. setup_rendering() is left to the caller.
+     * and returns them. setup_rendering() is left to the caller. With a mesh
+     * cache directory set, unchanged files skip the import.
      *
      * If resolver is null, the default resolver is used: paths resolved
      * relative to the model file's directory via ImageReader::load_texture.
@@ -525,6 +530,63 @@ public:
         const std::string& filepath,
         TextureResolver resolver = nullptr);
 
+    // ─────────────────────────────────────────────────────────────────────────
+    // Mesh — cache
+    // ─────────────────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Set the on-disk mesh cache used by load_mesh(), load_mesh_network()
+     *        and load_batch().
+     *
+     * Entries hold post-processed MeshData keyed on file content, so repeat
+     * loads skip assimp. ModelReader::bake() fills the same directory offline.
+     * Call before loading; changing the directory while loads run is unsafe.
+     *
+     * @param directory Cache location, created if missing; empty disables persistence.
+     * @return false if the directory could not be created.
+     */
+    bool set_mesh_cache_directory(const std::filesystem::path& directory);
+
+    /**
+     * @brief Hit/miss/write counters of the mesh cache.
+     */
+    [[nodiscard]] MeshCacheStats get_mesh_cache_stats() const { return m_mesh_cache->stats(); }
+
+    /**
+     * @brief Delete every entry in the on-disk mesh cache.
+     * @return Number of entries removed.
+     */
+    size_t purge_mesh_cache() { return m_mesh_cache->purge(); }
+
+    /**
+     * @brief The shared cache, for attaching to standalone ModelReaders.
+     */
+    [[nodiscard]] const std::shared_ptr<MeshCache>& get_mesh_cache() const { return m_mesh_cache; }
+
+    // ─────────────────────────────────────────────────────────────────────────
+    // Batch — load
+    // ─────────────────────────────────────────────────────────────────────────
+
+    /**
+     * @brief Load a manifest of audio, image, mesh and video assets in parallel.
+     *
+     * Decoding runs on a worker pool in priority order; GPU objects are
+     * created when the returned handle is polled on this thread. Model
+     * textures are discovered after import and decoded once per file across
+     * the batch. See BulkLoad (BulkLoader.hpp) for the threading contract.
+     *
+     * Results match the single-asset loaders: audio is configured like
+     * load_audio(), images like load_image(), meshes like load_mesh() and
+     * load_mesh_network(), video through load_video(path, config).
+     *
+     * @param manifest Assets to load. Order breaks priority ties.
+     * @param options  Worker count, progress and per-asset callbacks.
+     * @return Handle to poll, wait on, or cancel.
+     */
+    [[nodiscard]] std::shared_ptr<BulkLoad> load_batch(
+        std::vector<AssetRequest> manifest,
+        BulkLoadOptions options);
+
     // ─────────────────────────────────────────────────────────────────────────
     // Image — save
     // ─────────────────────────────────────────────────────────────────────────
@@ -632,6 +694,8 @@ public:
     [[nodiscard]] std::vector<std::shared_ptr<SoundFileWriter>> get_sound_writers() const { return m_writers; };
 
 private:
+    friend class BulkLoad;
+
     Core::GlobalStreamInfo& m_stream_info;
     uint32_t m_frame_rate;
 
@@ -691,8 +755,13 @@ private:
 
     std::vector<std::shared_ptr<ModelReader>> m_model_readers;
 
+    std::shared_ptr<MeshCache> m_mesh_cache { std::make_shared<MeshCache>() };
+
     std::vector<std::shared_ptr<SoundFileWriter>> m_writers;
 
+    std::mutex m_bulk_loads_mutex;
+    std::vector<std::weak_ptr<BulkLoad>> m_bulk_loads;
+
     // ── Stored buffers ─────────────────────────────────────────────────────
 
     mutable std::shared_mutex m_buffers_mutex;
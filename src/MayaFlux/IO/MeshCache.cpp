@@ -0,0 +1,806 @@
+#include "MeshCache.hpp"
+
+#include "MayaFlux/Journal/Archivist.hpp"
+
+#include <fstream>
+
+#ifdef MAYAFLUX_PLATFORM_WINDOWS
+#include <windows.h>
+#ifdef ERROR
+#undef ERROR
+#endif // ERROR
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace MayaFlux::IO {
+
+namespace {
+
+    constexpr uint32_t k_entry_magic = 0x434D464D; // "MFMC"
+    constexpr uint64_t k_section_alignment = 64;
+    constexpr uint32_t k_mesh_has_submeshes = 1U << 0;
+    constexpr uint32_t k_submesh_embedded = 1U << 0;
+
+    // ─────────────────────────────────────────────────────────────────────────
+    // On-disk records. Fixed size and naturally aligned so a mapped file can
+    // be read in place; all offsets are from the start of the file.
+    // ─────────────────────────────────────────────────────────────────────────
+
+    struct FileHeader {
+        uint32_t magic {};
+        uint32_t version {};
+        uint32_t mesh_count {};
+        uint32_t attribute_count {};
+        uint32_t submesh_count {};
+        uint32_t dependency_count {};
+        uint64_t file_size {};
+        uint64_t checksum {}; ///< Over every byte after the header
+        uint64_t strings_offset {};
+        uint64_t strings_size {};
+        uint64_t reserved {};
+    };
+
+    struct StringRef {
+        uint32_t offset {}; ///< Into the string table
+        uint32_t size {};
+    };
+
+    struct MeshRecord {
+        uint64_t vertex_offset {};
+        uint64_t vertex_bytes {};
+        uint64_t index_offset {};
+        uint64_t index_count {};
+        uint32_t stride {};
+        uint32_t vertex_count {};
+        uint32_t first_attribute {};
+        uint32_t attribute_count {};
+        uint32_t first_submesh {};
+        uint32_t submesh_count {};
+        uint32_t flags {};
+        uint32_t reserved {};
+    };
+
+    struct AttributeRecord {
+        uint32_t modality {};
+        uint32_t offset_in_vertex {};
+        StringRef name {};
+    };
+
+    struct SubmeshRecord {
+        uint32_t index_start {};
+        uint32_t index_count {};
+        uint32_t vertex_offset {};
+        uint32_t flags {};
+        StringRef name {};
+        StringRef material_name {};
+        StringRef diffuse_path {};
+    };
+
+    struct DependencyRecord {
+        uint64_t size {};
+        int64_t mtime {};
+        StringRef path {};
+    };
+
+    static_assert(sizeof(FileHeader) == 64);
+    static_assert(sizeof(MeshRecord) == 64);
+    static_assert(std::is_trivially_copyable_v<SubmeshRecord> && std::is_trivially_copyable_v<DependencyRecord>);
+
+    /// Byte offsets of each table, derived from the header counts.
+    struct Layout {
+        uint64_t meshes;
+        uint64_t attributes;
+        uint64_t submeshes;
+        uint64_t dependencies;
+        uint64_t strings;
+
+        static Layout from(const FileHeader& h)
+        {
+            Layout l {};
+            l.meshes = sizeof(FileHeader);
+            l.attributes = l.meshes + uint64_t { h.mesh_count } * sizeof(MeshRecord);
+            l.submeshes = l.attributes + uint64_t { h.attribute_count } * sizeof(AttributeRecord);
+            l.dependencies = l.submeshes + uint64_t { h.submesh_count } * sizeof(SubmeshRecord);
+            l.strings = l.dependencies + uint64_t { h.dependency_count } * sizeof(DependencyRecord);
+            return l;
+        }
+    };
+
+    uint64_t align_up(uint64_t v)
+    {
+        return (v + k_section_alignment - 1) & ~(k_section_alignment - 1);
+    }
+
+    uint64_t mix64(uint64_t x)
+    {
+        x ^= x >> 30;
+        x *= 0xBF58476D1CE4E5B9ULL;
+        x ^= x >> 27;
+        x *= 0x94D049BB133111EBULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    /**
+     * @brief Incremental two-lane hash consuming eight bytes per step.
+     *
+     * Fast enough to key and verify multi-hundred-megabyte files in a
+     * fraction of the import time. Used for both the key and the entry
+     * checksum; feeding the same bytes in different chunkings gives the
+     * same result.
+     */
+    class StreamHasher {
+    public:
+        void bytes(const void* data, size_t size)
+        {
+            const auto* p = static_cast<const uint8_t*>(data);
+            m_length += size;
+
+            while (size > 0 && m_pending_size > 0) {
+                push_pending(*p++);
+                --size;
+            }
+            for (; size >= 8; p += 8, size -= 8) {
+                uint64_t w;
+                std::memcpy(&w, p, 8);
+                word(w);
+            }
+            while (size > 0) {
+                push_pending(*p++);
+                --size;
+            }
+        }
+
+        void field(std::string_view s)
+        {
+            number(s.size());
+            bytes(s.data(), s.size());
+        }
+
+        void number(uint64_t v) { bytes(&v, sizeof(v)); }
+
+        [[nodiscard]] std::pair<uint64_t, uint64_t> finish() const
+        {
+            uint64_t a = m_a;
+            uint64_t b = m_b;
+            if (m_pending_size > 0) {
+                a = (a ^ m_pending) * 0x100000001B3ULL;
+                b = std::rotl(b ^ mix64(m_pending), 27) * 0x9E3779B97F4A7C15ULL;
+            }
+            return { mix64(a ^ m_length), mix64(b ^ a) };
+        }
+
+        [[nodiscard]] std::string hex() const
+        {
+            const auto [a, b] = finish();
+            return std::format("{:016x}{:016x}", a, b);
+        }
+
+    private:
+        uint64_t m_a { 0xCBF29CE484222325ULL };
+        uint64_t m_b { 0x84222325CBF29CE4ULL };
+        uint64_t m_pending {};
+        size_t m_pending_size {};
+        uint64_t m_length {};
+
+        void word(uint64_t w)
+        {
+            m_a = (m_a ^ w) * 0x100000001B3ULL;
+            m_b = std::rotl(m_b ^ mix64(w), 27) * 0x9E3779B97F4A7C15ULL;
+        }
+
+        void push_pending(uint8_t byte)
+        {
+            m_pending |= uint64_t { byte } << (8 * m_pending_size);
+            if (++m_pending_size == 8) {
+                word(m_pending);
+                m_pending = 0;
+                m_pending_size = 0;
+            }
+        }
+    };
+
+    uint64_t checksum_of(std::span<const std::byte> bytes)
+    {
+        StreamHasher h;
+        h.bytes(bytes.data(), bytes.size());
+        return h.finish().first;
+    }
+
+    /**
+     * @brief Read-only mapping of a whole file, unmapped on destruction.
+     */
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::filesystem::path& path)
+        {
+#ifdef MAYAFLUX_PLATFORM_WINDOWS
+            m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (m_file == INVALID_HANDLE_VALUE) {
+                return;
+            }
+            LARGE_INTEGER size {};
+            if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0) {
+                return;
+            }
+            m_mapping = CreateFileMappingW(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!m_mapping) {
+                return;
+            }
+            m_data = static_cast<const std::byte*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+            if (m_data) {
+                m_size = static_cast<size_t>(size.QuadPart);
+            }
+#else
+            const int fd = ::open(path.c_str(), O_RDONLY);
+            if (fd < 0) {
+                return;
+            }
+            struct stat st {};
+            if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+                void* p = ::mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                if (p != MAP_FAILED) {
+                    m_data = static_cast<const std::byte*>(p);
+                    m_size = static_cast<size_t>(st.st_size);
+                }
+            }
+            ::close(fd);
+#endif
+        }
+
+        ~MappedFile()
+        {
+#ifdef MAYAFLUX_PLATFORM_WINDOWS
+            if (m_data) {
+                UnmapViewOfFile(m_data);
+            }
+            if (m_mapping) {
+                CloseHandle(m_mapping);
+            }
+            if (m_file != INVALID_HANDLE_VALUE) {
+                CloseHandle(m_file);
+            }
+#else
+            if (m_data) {
+                ::munmap(const_cast<std::byte*>(m_data), m_size);
+            }
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        [[nodiscard]] bool is_open() const { return m_data != nullptr; }
+        [[nodiscard]] std::span<const std::byte> bytes() const { return { m_data, m_size }; }
+
+        /// Hint that the whole file is about to be read front to back.
+        void will_need() const
+        {
+#ifndef MAYAFLUX_PLATFORM_WINDOWS
+            if (m_data) {
+                ::madvise(const_cast<std::byte*>(m_data), m_size, MADV_SEQUENTIAL | MADV_WILLNEED);
+            }
+#endif
+        }
+
+    private:
+        const std::byte* m_data {};
+        size_t m_size {};
+#ifdef MAYAFLUX_PLATFORM_WINDOWS
+        HANDLE m_file { INVALID_HANDLE_VALUE };
+        HANDLE m_mapping {};
+#endif
+    };
+
+    template <typename T>
+    const T* record_at(std::span<const std::byte> file, uint64_t offset, uint64_t index = 0)
+    {
+        return reinterpret_cast<const T*>(file.data() + offset) + index;
+    }
+
+    /**
+     * @brief Header and record tables of a mapped entry, bounds-checked.
+     */
+    struct EntryView {
+        const FileHeader* header {};
+        Layout layout {};
+        std::string_view strings;
+
+        [[nodiscard]] std::string_view str(StringRef ref) const { return strings.substr(ref.offset, ref.size); }
+    };
+
+    std::optional<EntryView> view_entry(std::span<const std::byte> file)
+    {
+        if (file.size() < sizeof(FileHeader)) {
+            return std::nullopt;
+        }
+
+        const auto* header = record_at<FileHeader>(file, 0);
+        if (header->magic != k_entry_magic
+            || header->version != MeshCache::FORMAT_VERSION
+            || header->file_size != file.size()) {
+            return std::nullopt;
+        }
+
+        const auto layout = Layout::from(*header);
+        if (layout.strings != header->strings_offset
+            || header->strings_offset + header->strings_size > file.size()) {
+            return std::nullopt;
+        }
+
+        return EntryView {
+            .header = header,
+            .layout = layout,
+            .strings = { reinterpret_cast<const char*>(file.data() + header->strings_offset), header->strings_size },
+        };
+    }
+
+    bool dependencies_current(std::span<const std::byte> file, const EntryView& view)
+    {
+        for (uint32_t i = 0; i < view.header->dependency_count; ++i) {
+            const auto* dep = record_at<DependencyRecord>(file, view.layout.dependencies, i);
+            const std::filesystem::path path(view.str(dep->path));
+
+            std::error_code ec;
+            const auto size = std::filesystem::file_size(path, ec);
+            if (ec || size != dep->size) {
+                return false;
+            }
+            const auto mtime = std::filesystem::last_write_time(path, ec);
+            if (ec || mtime.time_since_epoch().count() != dep->mtime) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint64_t elapsed_ns(std::chrono::steady_clock::time_point since)
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - since)
+                .count());
+    }
+
+    Kakshya::MeshSubrange subrange_from(const Kakshya::Region& region)
+    {
+        Kakshya::MeshSubrange sub;
+        sub.index_start = region.start_coordinates.empty() ? 0 : static_cast<uint32_t>(region.start_coordinates[0]);
+        sub.index_count = static_cast<uint32_t>(region.get_attribute<uint64_t>("index_count").value_or(0));
+        sub.vertex_offset = static_cast<uint32_t>(region.get_attribute<uint64_t>("vertex_offset").value_or(0));
+        sub.name = region.get_attribute<std::string>("name").value_or("");
+        sub.material_name = region.get_attribute<std::string>("material_name").value_or("");
+        sub.diffuse_path = region.get_attribute<std::string>("diffuse_path").value_or("");
+        sub.diffuse_embedded = region.get_attribute<bool>("diffuse_embedded").value_or(false);
+        return sub;
+    }
+
+    /**
+     * @brief Accumulates the string table while records are built.
+     */
+    class StringTable {
+    public:
+        StringRef add(std::string_view s)
+        {
+            const StringRef ref { .offset = static_cast<uint32_t>(m_data.size()), .size = static_cast<uint32_t>(s.size()) };
+            m_data.append(s);
+            return ref;
+        }
+
+        [[nodiscard]] const std::string& data() const { return m_data; }
+
+    private:
+        std::string m_data;
+    };
+
+} // namespace
+
+MeshCache::MeshCache(std::filesystem::path directory)
+{
+    if (!directory.empty()) {
+        set_directory(directory);
+    }
+}
+
+bool MeshCache::set_directory(const std::filesystem::path& directory)
+{
+    m_directory.clear();
+
+    if (directory.empty()) {
+        return true;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec || !std::filesystem::is_directory(directory, ec)) {
+        MF_WARN(Journal::Component::IO, Journal::Context::FileIO,
+            "Mesh cache directory '{}' unavailable ({}); cache is transient",
+            directory.string(), ec.message());
+        return false;
+    }
+
+    m_directory = directory;
+    MF_DEBUG(Journal::Component::IO, Journal::Context::FileIO,
+        "Mesh cache directory: {}", m_directory.string());
+    return true;
+}
+
+std::filesystem::path MeshCache::entry_path(const std::string& key) const
+{
+    return m_directory / (key + ".mfmesh");
+}
+
+std::string MeshCache::make_key(const std::filesystem::path& source, std::string_view fingerprint)
+{
+    if (!is_persistent()) {
+        return {};
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+
+    const MappedFile file(source);
+    if (!file.is_open()) {
+        return {};
+    }
+    file.will_need();
+
+    StreamHasher hasher;
+    hasher.number(FORMAT_VERSION);
+    hasher.field(fingerprint);
+    hasher.field(source.extension().string());
+    hasher.number(file.bytes().size());
+    hasher.bytes(file.bytes().data(), file.bytes().size());
+
+    m_key_ns.fetch_add(elapsed_ns(t0), std::memory_order_relaxed);
+    return hasher.hex();
+}
+
+void MeshCache::discard(const std::filesystem::path& path)
+{
+    m_corrupt.fetch_add(1, std::memory_order_relaxed);
+    MF_WARN(Journal::Component::IO, Journal::Context::FileIO,
+        "Discarding corrupt mesh cache entry: {}", path.string());
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+}
+
+std::optional<std::vector<Kakshya::MeshData>> MeshCache::load(const std::string& key)
+{
+    if (!is_persistent() || key.empty()) {
+        return std::nullopt;
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    const auto path = entry_path(key);
+
+    enum class Outcome : uint8_t { Missing,
+        Corrupt,
+        Stale,
+        Hit };
+
+    std::vector<Kakshya::MeshData> meshes;
+
+    const auto outcome = [&] {
+        const MappedFile file(path);
+        if (!file.is_open()) {
+            return Outcome::Missing;
+        }
+        file.will_need();
+
+        const auto bytes = file.bytes();
+        const auto view = view_entry(bytes);
+
+        if (!view || checksum_of(bytes.subspan(sizeof(FileHeader))) != view->header->checksum) {
+            return Outcome::Corrupt;
+        }
+        if (!dependencies_current(bytes, *view)) {
+            return Outcome::Stale;
+        }
+
+        const auto& header = *view->header;
+        meshes.reserve(header.mesh_count);
+
+        for (uint32_t m = 0; m < header.mesh_count; ++m) {
+            const auto* rec = record_at<MeshRecord>(bytes, view->layout.meshes, m);
+
+            if (rec->vertex_offset + rec->vertex_bytes > bytes.size()
+                || rec->index_offset + rec->index_count * sizeof(uint32_t) > bytes.size()
+                || rec->first_attribute + rec->attribute_count > header.attribute_count
+                || rec->first_submesh + rec->submesh_count > header.submesh_count) {
+                return Outcome::Corrupt;
+            }
+
+            Kakshya::MeshData mesh;
+
+            const auto* vertices = reinterpret_cast<const uint8_t*>(bytes.data() + rec->vertex_offset);
+            mesh.vertex_variant = std::vector<uint8_t>(vertices, vertices + rec->vertex_bytes);
+
+            const auto* indices = record_at<uint32_t>(bytes, rec->index_offset);
+            mesh.index_variant = std::vector<uint32_t>(indices, indices + rec->index_count);
+
+            mesh.layout.stride_bytes = rec->stride;
+            mesh.layout.vertex_count = rec->vertex_count;
+            mesh.layout.attributes.reserve(rec->attribute_count);
+            for (uint32_t a = 0; a < rec->attribute_count; ++a) {
+                const auto* attr = record_at<AttributeRecord>(bytes, view->layout.attributes, rec->first_attribute + a);
+                mesh.layout.attributes.push_back({
+                    .component_modality = static_cast<Kakshya::DataModality>(attr->modality),
+                    .offset_in_vertex = attr->offset_in_vertex,
+                    .name = std::string(view->str(attr->name)),
+                });
+            }
+
+            if (rec->flags & k_mesh_has_submeshes) {
+                Kakshya::RegionGroup group("submeshes");
+                for (uint32_t s = 0; s < rec->submesh_count; ++s) {
+                    const auto* sr = record_at<SubmeshRecord>(bytes, view->layout.submeshes, rec->first_submesh + s);
+                    Kakshya::MeshSubrange sub;
+                    sub.index_start = sr->index_start;
+                    sub.index_count = sr->index_count;
+                    sub.vertex_offset = sr->vertex_offset;
+                    sub.name = view->str(sr->name);
+                    sub.material_name = view->str(sr->material_name);
+                    sub.diffuse_path = view->str(sr->diffuse_path);
+                    sub.diffuse_embedded = (sr->flags & k_submesh_embedded) != 0;
+                    group.add_region(sub.to_region());
+                }
+                mesh.submeshes = std::move(group);
+            }
+
+            meshes.push_back(std::move(mesh));
+        }
+        return Outcome::Hit;
+    }();
+
+    switch (outcome) {
+    case Outcome::Hit:
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        m_load_ns.fetch_add(elapsed_ns(t0), std::memory_order_relaxed);
+        return meshes;
+    case Outcome::Corrupt:
+        discard(path);
+        break;
+    case Outcome::Stale:
+        m_stale.fetch_add(1, std::memory_order_relaxed);
+        break;
+    case Outcome::Missing:
+        break;
+    }
+
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    return std::nullopt;
+}
+
+bool MeshCache::is_current(const std::string& key) const
+{
+    if (!is_persistent() || key.empty()) {
+        return false;
+    }
+
+    const MappedFile file(entry_path(key));
+    if (!file.is_open()) {
+        return false;
+    }
+
+    const auto view = view_entry(file.bytes());
+    return view && dependencies_current(file.bytes(), *view);
+}
+
+bool MeshCache::store(const std::string& key,
+    std::span<const Kakshya::MeshData> meshes,
+    std::span<const std::filesystem::path> dependencies)
+{
+    if (!is_persistent() || key.empty() || meshes.empty()) {
+        return false;
+    }
+
+    FileHeader header {
+        .magic = k_entry_magic,
+        .version = FORMAT_VERSION,
+        .mesh_count = static_cast<uint32_t>(meshes.size()),
+    };
+
+    StringTable strings;
+    std::vector<MeshRecord> mesh_records;
+    std::vector<AttributeRecord> attributes;
+    std::vector<SubmeshRecord> submeshes;
+    std::vector<DependencyRecord> dependency_records;
+
+    mesh_records.reserve(meshes.size());
+
+    for (const auto& mesh : meshes) {
+        if (!mesh.is_valid()) {
+            MF_WARN(Journal::Component::IO, Journal::Context::FileIO,
+                "MeshCache::store: refusing to cache invalid MeshData for {}", key);
+            return false;
+        }
+
+        MeshRecord rec {
+            .vertex_bytes = std::get<std::vector<uint8_t>>(mesh.vertex_variant).size(),
+            .index_count = std::get<std::vector<uint32_t>>(mesh.index_variant).size(),
+            .stride = mesh.layout.stride_bytes,
+            .vertex_count = mesh.layout.vertex_count,
+            .first_attribute = static_cast<uint32_t>(attributes.size()),
+            .attribute_count = static_cast<uint32_t>(mesh.layout.attributes.size()),
+            .first_submesh = static_cast<uint32_t>(submeshes.size()),
+        };
+
+        for (const auto& attr : mesh.layout.attributes) {
+            attributes.push_back({
+                .modality = static_cast<uint32_t>(attr.component_modality),
+                .offset_in_vertex = attr.offset_in_vertex,
+                .name = strings.add(attr.name),
+            });
+        }
+
+        if (mesh.submeshes) {
+            rec.flags |= k_mesh_has_submeshes;
+            for (const auto& region : mesh.submeshes->regions) {
+                const auto sub = subrange_from(region);
+                submeshes.push_back({
+                    .index_start = sub.index_start,
+                    .index_count = sub.index_count,
+                    .vertex_offset = sub.vertex_offset,
+                    .flags = sub.diffuse_embedded ? k_submesh_embedded : 0U,
+                    .name = strings.add(sub.name),
+                    .material_name = strings.add(sub.material_name),
+                    .diffuse_path = strings.add(sub.diffuse_path),
+                });
+            }
+            rec.submesh_count = static_cast<uint32_t>(submeshes.size()) - rec.first_submesh;
+        }
+
+        mesh_records.push_back(rec);
+    }
+
+    for (const auto& dep : dependencies) {
+        std::error_code ec;
+        const auto absolute = std::filesystem::absolute(dep, ec).lexically_normal();
+        const auto size = std::filesystem::file_size(absolute, ec);
+        if (ec) {
+            continue;
+        }
+        const auto mtime = std::filesystem::last_write_time(absolute, ec);
+        if (ec) {
+            continue;
+        }
+        dependency_records.push_back({
+            .size = size,
+            .mtime = static_cast<int64_t>(mtime.time_since_epoch().count()),
+            .path = strings.add(absolute.generic_string()),
+        });
+    }
+
+    header.attribute_count = static_cast<uint32_t>(attributes.size());
+    header.submesh_count = static_cast<uint32_t>(submeshes.size());
+    header.dependency_count = static_cast<uint32_t>(dependency_records.size());
+
+    const auto layout = Layout::from(header);
+    header.strings_offset = layout.strings;
+    header.strings_size = strings.data().size();
+
+    uint64_t cursor = layout.strings + header.strings_size;
+    for (size_t m = 0; m < meshes.size(); ++m) {
+        auto& rec = mesh_records[m];
+        rec.vertex_offset = align_up(cursor);
+        rec.index_offset = align_up(rec.vertex_offset + rec.vertex_bytes);
+        cursor = rec.index_offset + rec.index_count * sizeof(uint32_t);
+    }
+    header.file_size = cursor;
+
+    const auto final_path = entry_path(key);
+    const auto tmp_path = m_directory / std::format("{}.{:x}.{}.tmp", key,
+                                            std::hash<std::thread::id> {}(std::this_thread::get_id())
+                                                ^ reinterpret_cast<uintptr_t>(this),
+                                            m_temp_counter.fetch_add(1, std::memory_order_relaxed));
+
+    {
+        std::ofstream f(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!f.is_open()) {
+            MF_WARN(Journal::Component::IO, Journal::Context::FileIO,
+                "Cannot write mesh cache entry: {}", tmp_path.string());
+            return false;
+        }
+
+        StreamHasher checksum;
+        uint64_t written = sizeof(FileHeader);
+
+        const auto emit = [&](const void* data, size_t size) {
+            f.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+            checksum.bytes(data, size);
+            written += size;
+        };
+        const auto pad_to = [&](uint64_t offset) {
+            static constexpr std::array<char, k_section_alignment> zeros {};
+            emit(zeros.data(), offset - written);
+        };
+
+        f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        emit(mesh_records.data(), mesh_records.size() * sizeof(MeshRecord));
+        emit(attributes.data(), attributes.size() * sizeof(AttributeRecord));
+        emit(submeshes.data(), submeshes.size() * sizeof(SubmeshRecord));
+        emit(dependency_records.data(), dependency_records.size() * sizeof(DependencyRecord));
+        emit(strings.data().data(), strings.data().size());
+
+        for (size_t m = 0; m < meshes.size(); ++m) {
+            const auto& vb = std::get<std::vector<uint8_t>>(meshes[m].vertex_variant);
+            const auto& ib = std::get<std::vector<uint32_t>>(meshes[m].index_variant);
+            pad_to(mesh_records[m].vertex_offset);
+            emit(vb.data(), vb.size());
+            pad_to(mesh_records[m].index_offset);
+            emit(ib.data(), ib.size() * sizeof(uint32_t));
+        }
+
+        header.checksum = checksum.finish().first;
+        f.seekp(0);
+        f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+        if (!f) {
+            f.close();
+            std::error_code ec;
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, final_path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+
+    m_writes.fetch_add(1, std::memory_order_relaxed);
+    MF_DEBUG(Journal::Component::IO, Journal::Context::FileIO,
+        "Mesh cache stored {} ({} meshes, {} bytes)", key, meshes.size(), header.file_size);
+    return true;
+}
+
+size_t MeshCache::purge()
+{
+    if (!is_persistent()) {
+        return 0;
+    }
+
+    size_t removed = 0;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(m_directory, ec)) {
+        const auto ext = entry.path().extension();
+        if (entry.is_regular_file(ec) && (ext == ".mfmesh" || ext == ".tmp")) {
+            if (std::filesystem::remove(entry.path(), ec) && ext == ".mfmesh") {
+                ++removed;
+            }
+        }
+    }
+    return removed;
+}
+
+MeshCacheStats MeshCache::stats() const
+{
+    return MeshCacheStats {
+        .hits = m_hits.load(std::memory_order_relaxed),
+        .misses = m_misses.load(std::memory_order_relaxed),
+        .stale = m_stale.load(std::memory_order_relaxed),
+        .writes = m_writes.load(std::memory_order_relaxed),
+        .corrupt = m_corrupt.load(std::memory_order_relaxed),
+        .key_ms = static_cast<double>(m_key_ns.load(std::memory_order_relaxed)) * 1e-6,
+        .load_ms = static_cast<double>(m_load_ns.load(std::memory_order_relaxed)) * 1e-6,
+    };
+}
+
+void MeshCache::reset_stats()
+{
+    m_hits = 0;
+    m_misses = 0;
+    m_stale = 0;
+    m_writes = 0;
+    m_corrupt = 0;
+    m_key_ns = 0;
+    m_load_ns = 0;
+}
+
+} // namespace MayaFlux::IO
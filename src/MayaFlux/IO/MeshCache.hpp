@@ -0,0 +1,142 @@
+#pragma once
+
+#include "MayaFlux/Kakshya/NDData/MeshData.hpp"
+
+/**
+ * @file MeshCache.hpp
+ * @brief Versioned binary cache of imported meshes, keyed on source content.
+ *
+ * Importing a model through assimp with ModelReader's post-processing
+ * (triangulation, smooth normals, tangent space, vertex welding) dominates
+ * load time for large scanned assets and produces the same MeshData every
+ * time for the same input. MeshCache stores that MeshData in a flat binary
+ * file so later loads skip assimp entirely.
+ *
+ * ## Key
+ * The key covers the bytes of the source file, its extension and an
+ * importer fingerprint supplied by the owner (library version and
+ * post-processing flags). Files the importer opened besides the source
+ * (glTF buffers, OBJ material libraries, textures probed during import) are
+ * recorded in the entry with size and modification time, and a change to
+ * any of them makes the entry stale.
+ *
+ * ## Storage
+ * One file per key, `<hex key>.mfmesh`, laid out for memory mapping: a
+ * fixed header, fixed-size mesh, attribute, submesh and dependency records,
+ * a string table, then each mesh's vertex bytes and indices in 64-byte
+ * aligned sections. Loading maps the file, checks the header and checksum,
+ * and copies each section into MeshData storage in one pass; nothing is
+ * parsed. Writes go to a temporary file renamed into place, so concurrent
+ * readers and bake workers never see a partial entry.
+ *
+ * The cache performs no import itself; ModelReader drives it.
+ */
+
+namespace MayaFlux::IO {
+
+/**
+ * @struct MeshCacheStats
+ * @brief Counters accumulated by a MeshCache since construction or reset_stats().
+ */
+struct MeshCacheStats {
+    uint64_t hits {}; ///< Entries served from disk
+    uint64_t misses {}; ///< Lookups with no usable entry
+    uint64_t stale {}; ///< Entries whose dependencies changed
+    uint64_t writes {}; ///< Entries written to disk
+    uint64_t corrupt {}; ///< Entries rejected on load
+    double key_ms {}; ///< Wall time spent hashing sources
+    double load_ms {}; ///< Wall time spent reading hits
+
+    [[nodiscard]] double hit_rate() const
+    {
+        const auto total = hits + misses;
+        return total ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+    }
+};
+
+/**
+ * @class MeshCache
+ * @brief Thread-safe on-disk store of post-processed MeshData.
+ *
+ * With an empty directory the cache is transient: make_key() returns an
+ * empty key, load() always misses and store() does nothing.
+ */
+class MAYAFLUX_API MeshCache {
+public:
+    /**
+     * @param directory Cache directory; empty disables persistence.
+     */
+    explicit MeshCache(std::filesystem::path directory = {});
+
+    /**
+     * @brief Change the cache directory. Creates it if missing.
+     * @return false if the directory could not be created; the cache is then transient.
+     */
+    bool set_directory(const std::filesystem::path& directory);
+
+    [[nodiscard]] const std::filesystem::path& directory() const { return m_directory; }
+    [[nodiscard]] bool is_persistent() const { return !m_directory.empty(); }
+
+    /**
+     * @brief Compute the content key for a source file as 32 hex digits.
+     *
+     * Reads the whole file. Returns empty if the cache is transient or the
+     * file cannot be read.
+     *
+     * @param source      Model file.
+     * @param fingerprint Importer identity: library version and import flags.
+     */
+    [[nodiscard]] std::string make_key(const std::filesystem::path& source, std::string_view fingerprint);
+
+    /**
+     * @brief Read an entry by key.
+     * @return Meshes in the order they were stored, or nullopt if absent,
+     *         stale or corrupt.
+     */
+    std::optional<std::vector<Kakshya::MeshData>> load(const std::string& key);
+
+    /**
+     * @brief True if an entry exists for @p key and its dependencies are
+     *        unchanged. Reads only the header and records.
+     */
+    [[nodiscard]] bool is_current(const std::string& key) const;
+
+    /**
+     * @brief Write an entry by key, replacing any existing one.
+     * @param key          Key from make_key().
+     * @param meshes       Valid MeshData; entries failing is_valid() are rejected.
+     * @param dependencies Files besides the source whose changes invalidate the entry.
+     */
+    bool store(const std::string& key,
+        std::span<const Kakshya::MeshData> meshes,
+        std::span<const std::filesystem::path> dependencies = {});
+
+    /**
+     * @brief Delete every entry in the cache directory.
+     * @return Number of entries removed.
+     */
+    size_t purge();
+
+    [[nodiscard]] MeshCacheStats stats() const;
+    void reset_stats();
+
+    /// On-disk entry format version; bump when the layout changes.
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+private:
+    std::filesystem::path m_directory;
+
+    std::atomic<uint64_t> m_hits {};
+    std::atomic<uint64_t> m_misses {};
+    std::atomic<uint64_t> m_stale {};
+    std::atomic<uint64_t> m_writes {};
+    std::atomic<uint64_t> m_corrupt {};
+    std::atomic<uint64_t> m_key_ns {};
+    std::atomic<uint64_t> m_load_ns {};
+    std::atomic<uint64_t> m_temp_counter {};
+
+    [[nodiscard]] std::filesystem::path entry_path(const std::string& key) const;
+    void discard(const std::filesystem::path& path);
+};
+
+} // namespace MayaFlux::IO
@@ -1,5 +1,7 @@
 #include "ModelReader.hpp"
 
+#include "MeshCache.hpp"
+
 #include "MayaFlux/Kakshya/NDData/MeshInsertion.hpp"
 
 #include "MayaFlux/Buffers/Geometry/MeshBuffer.hpp"
@@ -7,15 +9,47 @@
 #include "MayaFlux/Nodes/Network/MeshNetwork.hpp"
 
 #include "MayaFlux/Journal/Archivist.hpp"
+#include "MayaFlux/Transitive/Parallel/Execution.hpp"
 
+#include <assimp/DefaultIOSystem.h>
 #include <assimp/Importer.hpp>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
+#include <assimp/version.h>
+
+namespace P = MayaFlux::Parallel;
 
 namespace MayaFlux::IO {
 
 namespace {
-    std::string get_diffuse_path(const Kakshya::MeshData& mesh_data)
+    constexpr unsigned int k_import_flags = aiProcess_Triangulate
+        | aiProcess_GenSmoothNormals
+        | aiProcess_CalcTangentSpace
+        | aiProcess_FlipUVs
+        | aiProcess_JoinIdenticalVertices
+        | aiProcess_SortByPType;
+
+    /**
+     * Default filesystem access that remembers every file the importer opens,
+     * so side files (glTF buffers, OBJ material libraries) can invalidate a
+     * mesh cache entry.
+     */
+    class RecordingIOSystem : public Assimp::DefaultIOSystem {
+    public:
+        Assimp::IOStream* Open(const char* file, const char* mode = "rb") override
+        {
+            auto* stream = Assimp::DefaultIOSystem::Open(file, mode);
+            if (stream) {
+                std::error_code ec;
+                opened.push_back(std::filesystem::absolute(file, ec).lexically_normal());
+            }
+            return stream;
+        }
+
+        std::vector<std::filesystem::path> opened;
+    };
+
+    std::string get_string_attribute(const Kakshya::MeshData& mesh_data, const std::string& key)
     {
         if (!mesh_data.submeshes.has_value())
             return {};
@@ -23,13 +57,19 @@ namespace {
         if (regions.empty())
             return {};
         const auto& attrs = regions.front().attributes;
-        auto it = attrs.find("diffuse_path");
+        auto it = attrs.find(key);
         if (it == attrs.end())
             return {};
         const auto* s = std::any_cast<std::string>(&it->second);
-        if (!s || s->empty() || (*s)[0] == '*')
+        return s ? *s : std::string {};
+    }
+
+    std::string get_diffuse_path(const Kakshya::MeshData& mesh_data)
+    {
+        auto path = get_string_attribute(mesh_data, "diffuse_path");
+        if (path.empty() || path[0] == '*')
             return {};
-        return *s;
+        return path;
     }
 }
 
@@ -40,6 +80,7 @@ namespace {
 struct ModelReader::Impl {
     Assimp::Importer importer;
     const aiScene* scene { nullptr };
+    RecordingIOSystem* io { nullptr }; ///< Owned by importer
 };
 
 // =============================================================================
@@ -49,6 +90,8 @@ struct ModelReader::Impl {
 ModelReader::ModelReader()
     : m_impl(std::make_unique<Impl>())
 {
+    m_impl->io = new RecordingIOSystem();
+    m_impl->importer.SetIOHandler(m_impl->io);
 }
 
 ModelReader::~ModelReader()
@@ -62,14 +105,125 @@ ModelReader::~ModelReader()
 
 std::vector<Kakshya::MeshData> ModelReader::load(const std::string& filepath)
 {
+    std::string key;
+    std::string resolved;
+    if (m_cache && m_cache->is_persistent()) {
+        resolved = resolve_path(filepath);
+        key = m_cache->make_key(resolved, import_fingerprint());
+
+        if (auto cached = m_cache->load(key)) {
+            MF_INFO(Journal::Component::IO, Journal::Context::FileIO,
+                "ModelReader: '{}' served from mesh cache — {} meshes",
+                std::filesystem::path(resolved).filename().string(), cached->size());
+            return std::move(*cached);
+        }
+    }
+
     if (!open(filepath)) {
         return {};
     }
     auto result = extract_meshes();
+
+    if (!key.empty() && !result.empty()) {
+        m_cache->store(key, result, import_dependencies(resolved));
+    }
+
     close();
     return result;
 }
 
+std::string ModelReader::import_fingerprint()
+{
+    return std::format("assimp-{}.{}.{}-{:x}",
+        aiGetVersionMajor(), aiGetVersionMinor(), aiGetVersionRevision(), k_import_flags);
+}
+
+std::vector<std::filesystem::path> ModelReader::import_dependencies(const std::string& source) const
+{
+    std::error_code ec;
+    const auto self = std::filesystem::absolute(source, ec).lexically_normal();
+
+    std::vector<std::filesystem::path> deps;
+    for (const auto& path : m_impl->io->opened) {
+        if (path != self && std::ranges::find(deps, path) == deps.end()) {
+            deps.push_back(path);
+        }
+    }
+    return deps;
+}
+
+MeshBakeReport ModelReader::bake(
+    const std::vector<std::string>& sources,
+    const std::filesystem::path& directory,
+    uint32_t max_workers)
+{
+    MeshBakeReport report;
+    const auto t0 = std::chrono::steady_clock::now();
+
+    auto cache = std::make_shared<MeshCache>();
+    if (sources.empty() || !cache->set_directory(directory)) {
+        report.failed = sources.size();
+        report.failures = sources;
+        return report;
+    }
+
+    size_t workers = max_workers ? max_workers : std::max(1U, std::thread::hardware_concurrency());
+    workers = std::min(workers, sources.size());
+
+    std::mutex report_mutex;
+    std::atomic<size_t> next { 0 };
+
+    P::for_each(P::par,
+        std::views::iota(size_t { 0 }, workers).begin(),
+        std::views::iota(size_t { 0 }, workers).end(),
+        [&](size_t) {
+            ModelReader reader;
+
+            for (size_t i = next.fetch_add(1, std::memory_order_relaxed); i < sources.size();
+                i = next.fetch_add(1, std::memory_order_relaxed)) {
+                const auto resolved = resolve_path(sources[i]);
+                const auto key = cache->make_key(resolved, import_fingerprint());
+
+                enum class Outcome : uint8_t { Baked,
+                    Current,
+                    Failed } outcome
+                    = Outcome::Failed;
+
+                if (!key.empty() && cache->is_current(key)) {
+                    outcome = Outcome::Current;
+                } else if (!key.empty() && reader.open(sources[i])) {
+                    const auto meshes = reader.extract_meshes();
+                    if (!meshes.empty() && cache->store(key, meshes, reader.import_dependencies(resolved))) {
+                        outcome = Outcome::Baked;
+                    }
+                    reader.close();
+                }
+
+                std::lock_guard lock(report_mutex);
+                switch (outcome) {
+                case Outcome::Baked:
+                    ++report.baked;
+                    break;
+                case Outcome::Current:
+                    ++report.current;
+                    break;
+                case Outcome::Failed:
+                    ++report.failed;
+                    report.failures.push_back(sources[i]);
+                    break;
+                }
+            }
+        });
+
+    report.elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    MF_INFO(Journal::Component::IO, Journal::Context::FileIO,
+        "ModelReader::bake: {} baked, {} current, {} failed in {:.1f} ms on {} workers",
+        report.baked, report.current, report.failed, report.elapsed_ms, workers);
+
+    return report;
+}
+
 std::vector<Kakshya::MeshData> ModelReader::extract_meshes() const
 {
     if (!m_impl->scene) {
@@ -113,12 +267,18 @@ std::vector<Kakshya::MeshData> ModelReader::extract_meshes() const
 std::vector<std::shared_ptr<Buffers::MeshBuffer>>
 ModelReader::create_mesh_buffers(const TextureResolver& resolver) const
 {
-    auto meshes = extract_meshes();
+    return build_mesh_buffers(extract_meshes(), resolver);
+}
 
+std::vector<std::shared_ptr<Buffers::MeshBuffer>>
+ModelReader::build_mesh_buffers(
+    const std::vector<Kakshya::MeshData>& meshes,
+    const TextureResolver& resolver)
+{
     std::vector<std::shared_ptr<Buffers::MeshBuffer>> result;
     result.reserve(meshes.size());
 
-    for (auto& mesh_data : meshes) {
+    for (const auto& mesh_data : meshes) {
         if (!mesh_data.is_valid()) {
             MF_WARN(Journal::Component::IO, Journal::Context::FileIO,
                 "ModelReader::create_mesh_buffers: skipping invalid MeshData");
@@ -151,6 +311,68 @@ ModelReader::create_mesh_buffers(const TextureResolver& resolver) const
     return result;
 }
 
+std::shared_ptr<Nodes::Network::MeshNetwork>
+ModelReader::build_mesh_network(
+    const std::vector<Kakshya::MeshData>& meshes,
+    const TextureResolver& resolver)
+{
+    auto net = std::make_shared<Nodes::Network::MeshNetwork>();
+
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        const auto& mesh_data = meshes[i];
+
+        std::string mesh_name = get_string_attribute(mesh_data, "name");
+        if (mesh_name.empty())
+            mesh_name = "mesh_" + std::to_string(i);
+
+        if (!mesh_data.is_valid()) {
+            MF_WARN(Journal::Component::IO, Journal::Context::FileIO,
+                "ModelReader::create_mesh_network: skipping invalid mesh '{}'", mesh_name);
+            continue;
+        }
+
+        const auto* vb = std::get_if<std::vector<uint8_t>>(&mesh_data.vertex_variant);
+        const auto* ib = std::get_if<std::vector<uint32_t>>(&mesh_data.index_variant);
+
+        if (!vb || !ib)
+            continue;
+
+        const size_t vertex_count = vb->size() / sizeof(Kakshya::MeshVertex);
+        auto node = std::make_shared<Nodes::GpuSync::MeshWriterNode>(vertex_count);
+        node->set_mesh(
+            std::span<const Kakshya::MeshVertex>(
+                reinterpret_cast<const Kakshya::MeshVertex*>(vb->data()),
+                vertex_count),
+            std::span<const uint32_t>(ib->data(), ib->size()));
+
+        auto slot_idx = net->add_slot(mesh_name, node);
+
+        if (resolver) {
+            const auto raw = get_diffuse_path(mesh_data);
+            if (!raw.empty()) {
+                auto image = resolver(raw);
+                if (image) {
+                    net->get_slot(slot_idx).diffuse_texture = std::move(image);
+                } else {
+                    MF_ERROR(Journal::Component::IO, Journal::Context::FileIO,
+                        "ModelReader::create_mesh_network: resolver returned null for '{}' (slot '{}')",
+                        raw, mesh_name);
+                }
+            }
+        }
+    }
+
+    MF_INFO(Journal::Component::IO, Journal::Context::FileIO,
+        "ModelReader::create_mesh_network: {} slots", net->slot_count());
+
+    return net;
+}
+
+std::string ModelReader::diffuse_path(const Kakshya::MeshData& mesh_data)
+{
+    return get_diffuse_path(mesh_data);
+}
+
 std::shared_ptr<Nodes::Network::MeshNetwork>
 ModelReader::create_mesh_network(const TextureResolver& resolver) const
 {
@@ -257,14 +479,8 @@ bool ModelReader::open(const std::string& filepath, FileReadOptions /*options*/)
         return false;
     }
 
-    constexpr unsigned int flags = aiProcess_Triangulate
-        | aiProcess_GenSmoothNormals
-        | aiProcess_CalcTangentSpace
-        | aiProcess_FlipUVs
-        | aiProcess_JoinIdenticalVertices
-        | aiProcess_SortByPType;
-
-    m_impl->scene = m_impl->importer.ReadFile(resolved, flags);
+    m_impl->io->opened.clear();
+    m_impl->scene = m_impl->importer.ReadFile(resolved, k_import_flags);
 
     if (!m_impl->scene
         || (m_impl->scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE)
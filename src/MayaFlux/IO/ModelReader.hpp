@@ -17,6 +17,20 @@ class MeshNetwork;
 
 namespace MayaFlux::IO {
 
+class MeshCache;
+
+/**
+ * @struct MeshBakeReport
+ * @brief Outcome of ModelReader::bake().
+ */
+struct MeshBakeReport {
+    size_t baked {}; ///< Imported and written to the cache
+    size_t current {}; ///< Already cached and up to date
+    size_t failed {}; ///< Import or write failed
+    std::vector<std::string> failures; ///< Sources that failed, in completion order
+    double elapsed_ms {};
+};
+
 /**
  * @brief Callable that maps a raw material texture path to a GPU image.
  *
@@ -49,6 +63,12 @@ using TextureResolver = std::function<std::shared_ptr<Core::VKImage>(const std::
  * - aiProcess_JoinIdenticalVertices: deduplicate vertices
  * - aiProcess_SortByPType: isolate TRIANGLE primitives
  *
+ * Mesh cache:
+ * With a MeshCache attached via set_cache(), load() looks the file up by
+ * content before importing and stores the result after a miss, so repeat
+ * loads of an unchanged file skip assimp. bake() fills a cache directory
+ * ahead of time. open() and the scene-based create_* calls always import.
+ *
  * FileReader contract:
  * create_container() and load_into_container() are no-ops for this reader;
  * mesh data does not go through the SignalSourceContainer streaming path.
@@ -67,6 +87,7 @@ public:
      * @brief Load all meshes from a file in one call.
      *
      * Opens, imports, extracts, and closes in a single synchronous operation.
+     * With a cache attached, a current entry is returned without importing.
      * Returns an empty vector on failure; check get_last_error().
      *
      * @param filepath Path to the model file.
@@ -74,6 +95,41 @@ public:
      */
     [[nodiscard]] std::vector<Kakshya::MeshData> load(const std::string& filepath);
 
+    /**
+     * @brief Serve load() from @p cache when possible and populate it on a miss.
+     *
+     * Null disables caching. Caches are thread-safe, so one instance can back
+     * every reader in a process.
+     */
+    void set_cache(std::shared_ptr<MeshCache> cache) { m_cache = std::move(cache); }
+
+    [[nodiscard]] const std::shared_ptr<MeshCache>& get_cache() const { return m_cache; }
+
+    /**
+     * @brief Importer identity mixed into mesh cache keys.
+     *
+     * Covers the assimp version and the post-processing flags, so upgrading
+     * assimp or changing the flags never serves stale geometry.
+     */
+    [[nodiscard]] static std::string import_fingerprint();
+
+    /**
+     * @brief Import models ahead of time into a mesh cache directory.
+     *
+     * Offline entry point for asset pipelines and build steps. Sources whose
+     * entry is already current are skipped, so re-running a bake after
+     * editing a few files only imports those. Imports run in parallel, one
+     * ModelReader per worker.
+     *
+     * @param sources     Model files.
+     * @param directory   Cache directory, as later passed to IOManager::set_mesh_cache_directory().
+     * @param max_workers 0 uses std::thread::hardware_concurrency().
+     */
+    static MeshBakeReport bake(
+        const std::vector<std::string>& sources,
+        const std::filesystem::path& directory,
+        uint32_t max_workers = 0);
+
     /**
      * @brief Load all meshes after open() has already been called.
      *
@@ -118,6 +174,45 @@ public:
     [[nodiscard]] std::shared_ptr<Nodes::Network::MeshNetwork>
     create_mesh_network(const TextureResolver& resolver = nullptr) const;
 
+    /**
+     * @brief Construct one MeshBuffer per entry of already-extracted mesh data.
+     *
+     * The GPU half of create_mesh_buffers(), split out so extraction can run
+     * on a worker thread and buffer construction on the thread that owns the
+     * graphics context. Invalid entries are skipped with a warning.
+     *
+     * @param meshes   MeshData from load() or extract_meshes().
+     * @param resolver Optional texture resolver, as for create_mesh_buffers().
+     * @return One MeshBuffer per valid entry, in input order.
+     */
+    [[nodiscard]] static std::vector<std::shared_ptr<Buffers::MeshBuffer>>
+    build_mesh_buffers(
+        const std::vector<Kakshya::MeshData>& meshes,
+        const TextureResolver& resolver = nullptr);
+
+    /**
+     * @brief Construct a MeshNetwork from already-extracted mesh data.
+     *
+     * Slot names come from each entry's submesh name, or "mesh_N" if unnamed.
+     * Otherwise identical to create_mesh_network().
+     *
+     * @param meshes   MeshData from load() or extract_meshes().
+     * @param resolver Optional texture resolver.
+     * @return Populated MeshNetwork; empty if no entry was usable.
+     */
+    [[nodiscard]] static std::shared_ptr<Nodes::Network::MeshNetwork>
+    build_mesh_network(
+        const std::vector<Kakshya::MeshData>& meshes,
+        const TextureResolver& resolver = nullptr);
+
+    /**
+     * @brief Raw diffuse texture path recorded for a mesh, as stored in the file.
+     *
+     * Empty if the mesh has no diffuse texture or it is embedded ("*N").
+     * This is the string a TextureResolver receives.
+     */
+    [[nodiscard]] static std::string diffuse_path(const Kakshya::MeshData& mesh_data);
+
     // -------------------------------------------------------------------------
     // FileReader interface
     // -------------------------------------------------------------------------
@@ -182,6 +277,11 @@ private:
     bool m_is_open { false };
     mutable std::string m_last_error;
 
+    std::shared_ptr<MeshCache> m_cache;
+
+    /// Files the last import opened besides @p source, for cache invalidation.
+    [[nodiscard]] std::vector<std::filesystem::path> import_dependencies(const std::string& source) const;
+
     [[nodiscard]] Kakshya::MeshData extract_single_mesh(
         const void* ai_mesh,
         const void* ai_scene,
@@ -3,6 +3,7 @@
 #include "MayaFlux/Buffers/AudioBuffer.hpp"
 #include "MayaFlux/Buffers/BufferUtils.hpp"
 
+#include "MayaFlux/Kakshya/Source/DynamicSoundStream.hpp"
 #include "MayaFlux/Kakshya/Source/PlotContainer.hpp"
 
 #include "MayaFlux/Journal/Archivist.hpp"
@@ -34,6 +35,7 @@ void PlotProcessor::bind_node(uint32_t series_index,
     b.audio_buffer.reset();
     b.network.reset();
     b.callable = {};
+    b.stream.reset();
 }
 
 void PlotProcessor::bind_audio_buffer(uint32_t series_index,
@@ -49,6 +51,7 @@ void PlotProcessor::bind_audio_buffer(uint32_t series_index,
     b.node.reset();
     b.network.reset();
     b.callable = {};
+    b.stream.reset();
 }
 
 void PlotProcessor::bind_network(uint32_t series_index,
@@ -73,6 +76,7 @@ void PlotProcessor::bind_network(uint32_t series_index,
     b.node.reset();
     b.audio_buffer.reset();
     b.callable = {};
+    b.stream.reset();
 }
 
 void PlotProcessor::bind_callable(uint32_t series_index,
@@ -88,6 +92,30 @@ void PlotProcessor::bind_callable(uint32_t series_index,
     b.node.reset();
     b.audio_buffer.reset();
     b.network.reset();
+    b.stream.reset();
+}
+
+void PlotProcessor::bind_stream(uint32_t series_index,
+    std::shared_ptr<DynamicSoundStream> stream,
+    uint32_t channel)
+{
+    if (!stream) {
+        MF_ERROR(C, X, "PlotProcessor::bind_stream: null stream for series {}", series_index);
+        return;
+    }
+    if (channel >= stream->get_num_channels()) {
+        MF_ERROR(C, X, "PlotProcessor::bind_stream: channel {} out of range for series {}", channel, series_index);
+        return;
+    }
+    auto& b = m_bindings[series_index];
+    b.source_type = SourceType::STREAM;
+    b.stream = std::move(stream);
+    b.stream_channel = channel;
+    b.stream_frames = std::numeric_limits<uint64_t>::max();
+    b.node.reset();
+    b.audio_buffer.reset();
+    b.network.reset();
+    b.callable = {};
 }
 
 void PlotProcessor::set_raw(uint32_t series_index, std::vector<double> data)
@@ -157,6 +185,14 @@ void PlotProcessor::process(const std::shared_ptr<SignalSourceContainer>& contai
         if (idx >= plot->series_count())
             continue;
 
+        if (b.source_type == SourceType::STREAM) {
+            acquire_from_stream(b, *plot, idx);
+            continue;
+        }
+
+        if (b.source_type == SourceType::RAW && !b.raw_dirty.test(std::memory_order_acquire))
+            continue;
+
         thread_local std::vector<double> staging;
         staging.resize(plot->series_size(idx));
 
@@ -185,16 +221,15 @@ void PlotProcessor::process(const std::shared_ptr<SignalSourceContainer>& contai
         case SourceType::RAW:
             acquire_from_raw(b, staging);
             break;
+        case SourceType::STREAM:
+            break;
         }
 
         plot->write_series(idx, staging);
     }
 
-    auto& src = plot->get_data();
-    auto& dst = plot->get_processed_data();
-    dst.resize(src.size());
-    for (size_t i = 0; i < src.size(); ++i)
-        dst[i] = src[i];
+    for (uint32_t i = 0; i < plot->series_count(); ++i)
+        plot->sync_processed_series(i);
 
     m_processing.store(false, std::memory_order_release);
 }
@@ -259,4 +294,26 @@ void PlotProcessor::acquire_from_raw(SeriesBinding& b, std::vector<double>& seri
         std::fill(series.begin() + static_cast<ptrdiff_t>(n), series.end(), 0.0);
 }
 
+void PlotProcessor::acquire_from_stream(SeriesBinding& b, PlotContainer& plot, uint32_t series_index)
+{
+    if (!b.stream)
+        return;
+
+    const uint64_t frames = b.stream->get_num_frames();
+    if (b.stream->is_circular() || frames < b.stream_frames) {
+        plot.resize_series(series_index, 0);
+        b.stream_frames = 0;
+    }
+
+    if (frames == b.stream_frames)
+        return;
+
+    thread_local std::vector<double> staging;
+    staging.resize(frames - b.stream_frames);
+    b.stream->get_channel_frames(staging, b.stream_channel, b.stream_frames);
+
+    plot.append_series(series_index, staging);
+    b.stream_frames = frames;
+}
+
 } // namespace MayaFlux::Kakshya
@@ -17,6 +17,9 @@ class AudioBuffer;
 
 namespace MayaFlux::Kakshya {
 
+class DynamicSoundStream;
+class PlotContainer;
+
 /**
  * @class PlotProcessor
  * @brief DataProcessor that acquires per-series data from heterogeneous sources
@@ -34,10 +37,12 @@ namespace MayaFlux::Kakshya {
  *   NETWORK      — NodeNetwork with audio output, reads get_audio_buffer() → full series copy
  *   CALLABLE     — std::function<void(std::vector<double>&)>, caller fills the series
  *   RAW          — pending std::vector<double> pushed via set_raw(), swapped in on process()
+ *   STREAM       — one channel of a DynamicSoundStream, new frames appended on process()
  *
  * process() iterates all bindings, acquires from source, writes into the container's
- * m_data variant at the bound series index, then copies m_data into processed_data.
- * Called by Forma immediately before the geometry function runs.
+ * m_data variant at the bound series index, then mirrors the written ranges into
+ * processed_data. A RAW binding with nothing pending writes nothing, so static series
+ * cost nothing per frame. Called by Forma immediately before the geometry function runs.
  */
 class MAYAFLUX_API PlotProcessor : public DataProcessor {
 public:
@@ -47,6 +52,7 @@ public:
         NETWORK,
         CALLABLE,
         RAW,
+        STREAM,
     };
 
     struct SeriesBinding {
@@ -58,6 +64,9 @@ public:
         std::shared_ptr<Buffers::AudioBuffer> audio_buffer;
         std::shared_ptr<Nodes::Network::NodeNetwork> network;
         std::function<void(std::vector<double>&)> callable;
+        std::shared_ptr<DynamicSoundStream> stream;
+        uint32_t stream_channel {};
+        uint64_t stream_frames {};
 
         std::vector<double> pending_raw;
         std::atomic_flag raw_dirty = ATOMIC_FLAG_INIT;
@@ -121,6 +130,21 @@ public:
     void bind_callable(uint32_t series_index,
         std::function<void(std::vector<double>&)> fn);
 
+    /**
+     * @brief Bind a series slot to one channel of a DynamicSoundStream.
+     *
+     * Each process() appends the frames added to the stream since the
+     * previous call via PlotContainer::append_series(). Circular streams,
+     * and streams whose frame count dropped, are re-read in full.
+     *
+     * @param series_index  Index returned by PlotContainer::add_series().
+     * @param stream        Stream to follow.
+     * @param channel       Channel of @p stream to read.
+     */
+    void bind_stream(uint32_t series_index,
+        std::shared_ptr<DynamicSoundStream> stream,
+        uint32_t channel);
+
     /**
      * @brief Push raw sample data for a series.
      *
@@ -167,7 +191,8 @@ public:
      * @brief Acquire data from all bound sources and write into the container.
      *
      * For each bound series: acquires from source, writes into container m_data,
-     * then copies m_data into processed_data. Unbound series are left unchanged.
+     * then mirrors every written range into processed_data through
+     * PlotContainer::sync_processed_series(). Unbound series are left unchanged.
      * Called from the graphics thread by Forma before the geometry function runs.
      */
     void process(const std::shared_ptr<SignalSourceContainer>& container) override;
@@ -183,6 +208,7 @@ private:
     void acquire_from_network(SeriesBinding& b, std::vector<double>& series);
     void acquire_from_callable(SeriesBinding& b, std::vector<double>& series);
     void acquire_from_raw(SeriesBinding& b, std::vector<double>& series);
+    void acquire_from_stream(SeriesBinding& b, PlotContainer& plot, uint32_t series_index);
 
     std::unordered_map<uint32_t, SeriesBinding> m_bindings;
     std::atomic<bool> m_processing { false };
@@ -1,7 +1,7 @@
 #include "RegionProcessors.hpp"
 
 #include "MayaFlux/Kakshya/SignalSourceContainer.hpp"
-#include "MayaFlux/Kakshya/Utils/DataUtils.hpp"
+#include "MayaFlux/Kakshya/Utils/VariantView.hpp"
 
 #include "MayaFlux/Journal/Archivist.hpp"
 
@@ -318,9 +318,10 @@ void RegionOrganizationProcessor::apply_region_transition(const OrganizedRegion&
     } */
 
     const size_t data_count = std::min<size_t>(output_data.size(), next_data.size());
+    std::vector<double> next_storage;
     for (size_t variant_idx = 0; variant_idx < data_count; ++variant_idx) {
         auto current_span = convert_variant<double>(output_data[variant_idx]);
-        auto next_span = convert_variant<double>(const_cast<DataVariant&>(next_data[variant_idx]));
+        auto next_span = view_as<double>(next_data[variant_idx], next_storage);
 
         const size_t sample_count = std::min<size_t>(current_span.size(), next_span.size());
 
@@ -134,6 +134,17 @@ uint64_t DynamicSoundStream::write_frames(std::vector<std::span<const double>> d
         return num_frames;
     }
 
+    if (m_segment_writer) {
+        Memory::SeqlockWriteGuard g(m_data_lock);
+        if (m_structure.organization == OrganizationStrategy::INTERLEAVED) {
+            m_segment_writer->write_interleaved(start_frame, data[0].first(num_frames * get_num_channels()));
+        } else {
+            for (uint32_t ch = 0; ch < get_num_channels(); ++ch)
+                m_segment_writer->write(ch, start_frame, data[ch].first(num_frames));
+        }
+        return num_frames;
+    }
+
     Region write_region {
         { start_frame, 0 },
         { start_frame + num_frames - 1, get_num_channels() - 1 }
@@ -180,6 +191,12 @@ uint64_t DynamicSoundStream::write_frames(
         return num_frames;
     }
 
+    if (m_segment_writer) {
+        Memory::SeqlockWriteGuard g(m_data_lock);
+        m_segment_writer->write(channel, start_frame, data.first(num_frames));
+        return num_frames;
+    }
+
     if (m_structure.organization == OrganizationStrategy::INTERLEAVED) {
         Memory::SeqlockWriteGuard g(m_data_lock);
         if (m_data.empty())
@@ -231,6 +248,16 @@ std::span<const double> DynamicSoundStream::get_channel_frames(uint32_t channel,
     }
 
     std::span<const double> result;
+
+    if (auto segments = m_segments.read()) {
+        seqlock_read_void(m_data_lock, 8, [&] {
+            if (start_frame >= m_num_frames)
+                return;
+            result = segments->contiguous_run(channel, start_frame, std::min(num_frames, m_num_frames - start_frame));
+        });
+        return result;
+    }
+
     seqlock_read_void(m_data_lock, 8, [&] {
         if (channel >= m_data.size())
             return;
@@ -251,6 +278,17 @@ void DynamicSoundStream::get_channel_frames(std::span<double> output, uint32_t c
 
     const uint64_t num_frames = output.size();
 
+    if (auto segments = m_segments.read()) {
+        seqlock_read_void(m_data_lock, 8, [&] {
+            const uint64_t available = start_frame < m_num_frames
+                ? std::min(num_frames, m_num_frames - start_frame)
+                : 0;
+            segments->read(channel, start_frame, output.first(available));
+            std::ranges::fill(output.subspan(available), 0.0);
+        });
+        return;
+    }
+
     if (m_structure.organization == OrganizationStrategy::INTERLEAVED) {
         seqlock_read_void(m_data_lock, 8, [&] {
             if (m_data.empty()) {
@@ -289,6 +327,12 @@ void DynamicSoundStream::ensure_capacity(uint64_t required_frames)
 
 void DynamicSoundStream::enable_circular_buffer(uint64_t capacity)
 {
+    if (m_segment_writer) {
+        MF_INFO(Journal::Component::Kakshya, Journal::Context::ContainerProcessing,
+            "Circular mode uses contiguous storage; disabling segmented storage");
+        disable_segmented_storage();
+    }
+
     ensure_capacity(capacity);
 
     Region circular_region {
@@ -336,6 +380,199 @@ const std::vector<DataVariant>& DynamicSoundStream::get_dynamic_data(uint32_t in
     return m_dynamic_data.at(index);
 }
 
+void DynamicSoundStream::enable_segmented_storage(uint64_t segment_frames)
+{
+    if (m_is_circular) {
+        MF_WARN(Journal::Component::Kakshya, Journal::Context::ContainerProcessing,
+            "Segmented storage is not available in circular mode");
+        return;
+    }
+
+    if (m_segment_writer) {
+        return;
+    }
+
+    const bool interleaved = m_structure.organization == OrganizationStrategy::INTERLEAVED;
+    auto store = std::make_unique<SegmentedStore>(get_num_channels(), segment_frames, interleaved);
+    store->reserve(m_num_frames);
+
+    {
+        Memory::SeqlockWriteGuard g(m_data_lock);
+        if (interleaved) {
+            if (!m_data.empty()) {
+                auto samples = convert_variant<double>(m_data[0]);
+                store->write_interleaved(0, samples.first(std::min<size_t>(samples.size(), m_num_frames * get_num_channels())));
+            }
+        } else {
+            for (uint32_t ch = 0; ch < std::min<size_t>(m_data.size(), get_num_channels()); ++ch) {
+                auto samples = convert_variant<double>(m_data[ch]);
+                store->write(ch, 0, samples.first(std::min<size_t>(samples.size(), m_num_frames)));
+            }
+        }
+
+        for (auto& variant : m_data)
+            variant = DataVariant(std::vector<double> {});
+
+        m_segment_writer = store.get();
+        m_segments.publish(std::move(store));
+    }
+
+    invalidate_span_cache();
+    m_double_extraction_dirty.store(true, std::memory_order_release);
+}
+
+void DynamicSoundStream::disable_segmented_storage()
+{
+    if (!m_segment_writer)
+        return;
+
+    materialize();
+
+    {
+        Memory::SeqlockWriteGuard g(m_data_lock);
+        m_segment_writer = nullptr;
+    }
+    m_segments.publish(nullptr);
+}
+
+Memory::SnapshotCell<SegmentedStore>::ReadGuard DynamicSoundStream::pin_segments(uint64_t& num_frames) const
+{
+    auto segments = m_segments.read();
+    num_frames = 0;
+    if (segments) {
+        seqlock_read_void(m_data_lock, 8, [&] {
+            num_frames = m_num_frames;
+        });
+    }
+    return segments;
+}
+
+void DynamicSoundStream::materialize()
+{
+    if (!m_segment_writer)
+        return;
+
+    auto data = m_segment_writer->materialize(m_num_frames);
+    {
+        Memory::SeqlockWriteGuard g(m_data_lock);
+        m_data = std::move(data);
+    }
+
+    invalidate_span_cache();
+    m_double_extraction_dirty.store(true, std::memory_order_release);
+}
+
+std::vector<DataVariant> DynamicSoundStream::get_region_data(const Region& region) const
+{
+    auto segments = m_segments.read();
+    if (!segments)
+        return SoundStreamContainer::get_region_data(region);
+
+    const uint32_t num_channels = get_num_channels();
+    const uint64_t first = region.start_coordinates.empty() ? 0 : region.start_coordinates[0];
+    const uint64_t last = region.end_coordinates.empty() ? 0 : region.end_coordinates[0];
+
+    if (first > last || last >= m_num_frames) {
+        error<std::out_of_range>(
+            Journal::Component::Kakshya, Journal::Context::Runtime,
+            std::source_location::current(),
+            "Requested region [{}, {}] is out of bounds for {} frames", first, last, m_num_frames);
+    }
+
+    const uint64_t frames = last - first + 1;
+
+    if (m_structure.organization == OrganizationStrategy::INTERLEAVED) {
+        const uint32_t first_ch = region.start_coordinates.size() > 1
+            ? static_cast<uint32_t>(region.start_coordinates[1])
+            : 0;
+        const uint32_t last_ch = region.end_coordinates.size() > 1
+            ? std::min(static_cast<uint32_t>(region.end_coordinates[1]), num_channels - 1)
+            : num_channels - 1;
+        const uint32_t width = last_ch >= first_ch ? last_ch - first_ch + 1 : 0;
+
+        std::vector<double> result(frames * width);
+        seqlock_read_void(m_data_lock, 8, [&] {
+            for (uint64_t f = 0; f < frames; ++f) {
+                for (uint32_t c = 0; c < width; ++c)
+                    result[f * width + c] = segments->sample(first_ch + c, first + f);
+            }
+        });
+        return { DataVariant(std::move(result)) };
+    }
+
+    std::vector<std::vector<double>> channels(num_channels, std::vector<double>(frames));
+    seqlock_read_void(m_data_lock, 8, [&] {
+        for (uint32_t ch = 0; ch < num_channels; ++ch)
+            segments->read(ch, first, channels[ch]);
+    });
+
+    return channels
+        | std::views::transform([](auto& channel) { return DataVariant(std::move(channel)); })
+        | std::ranges::to<std::vector>();
+}
+
+uint64_t DynamicSoundStream::peek_sequential(std::span<double> output, uint64_t count, uint64_t offset) const
+{
+    auto segments = m_segments.read();
+    if (!segments)
+        return SoundStreamContainer::peek_sequential(output, count, offset);
+
+    const uint64_t num_channels = get_num_channels();
+    if (m_num_frames == 0 || output.empty())
+        return 0;
+
+    const uint64_t start_frame = (m_read_position.empty() ? 0 : m_read_position[0].load()) + offset;
+    const uint64_t elements_to_read = std::min<uint64_t>(count, output.size());
+
+    if (m_looping_enabled && m_loop_region.start_coordinates.empty()) {
+        std::ranges::fill(output, 0.0);
+        return 0;
+    }
+
+    const uint64_t loop_start = m_looping_enabled ? m_loop_region.start_coordinates[0] : 0;
+    const uint64_t loop_length = m_looping_enabled ? m_loop_region.end_coordinates[0] - loop_start + 1 : 0;
+
+    uint64_t elements_read = 0;
+    seqlock_read_void(m_data_lock, 8, [&] {
+        elements_read = 0;
+        for (uint64_t i = 0; i < elements_to_read; ++i) {
+            const uint64_t element = start_frame * num_channels + i;
+            uint64_t frame = element / num_channels;
+            const auto channel = static_cast<uint32_t>(element % num_channels);
+
+            if (m_looping_enabled) {
+                frame = ((frame - loop_start) % loop_length) + loop_start;
+            } else if (frame >= m_num_frames) {
+                break;
+            }
+
+            output[i] = frame < m_num_frames ? segments->sample(channel, frame) : 0.0;
+            ++elements_read;
+        }
+    });
+
+    std::ranges::fill(output.subspan(elements_read), 0.0);
+    return elements_read;
+}
+
+bool DynamicSoundStream::has_data() const
+{
+    if (m_segments.read())
+        return m_num_frames > 0;
+    return SoundStreamContainer::has_data();
+}
+
+void DynamicSoundStream::clear()
+{
+    SoundStreamContainer::clear();
+
+    if (m_segment_writer) {
+        Memory::SeqlockWriteGuard g(m_data_lock);
+        m_segment_writer->clear();
+    }
+    m_segments.reclaim();
+}
+
 void DynamicSoundStream::disable_circular_buffer()
 {
     set_looping(false);
@@ -345,6 +582,33 @@ void DynamicSoundStream::disable_circular_buffer()
 
 void DynamicSoundStream::set_all_data(const std::vector<DataVariant>& data)
 {
+    if (m_segment_writer && !data.empty()) {
+        {
+            Memory::SeqlockWriteGuard g(m_data_lock);
+
+            std::vector<double> scratch;
+            if (m_structure.organization == OrganizationStrategy::INTERLEAVED) {
+                auto samples = view_as<double>(data[0], scratch);
+                m_num_frames = samples.size() / get_num_channels();
+                m_segment_writer->reserve(m_num_frames);
+                m_segment_writer->write_interleaved(0, samples);
+            } else {
+                m_num_frames = 0;
+                for (uint32_t ch = 0; ch < std::min<size_t>(data.size(), get_num_channels()); ++ch) {
+                    auto samples = view_as<double>(data[ch], scratch);
+                    m_num_frames = std::max<uint64_t>(m_num_frames, samples.size());
+                    m_segment_writer->reserve(m_num_frames);
+                    m_segment_writer->write(ch, 0, samples);
+                }
+            }
+            setup_dimensions();
+        }
+
+        m_double_extraction_dirty.store(true, std::memory_order_release);
+        update_processing_state(ProcessingState::READY);
+        return;
+    }
+
     {
         Memory::SeqlockWriteGuard g(m_data_lock);
         m_data.resize(data.size());
@@ -374,6 +638,17 @@ void DynamicSoundStream::set_all_data(const DataVariant& data)
 
 void DynamicSoundStream::expand_to(uint64_t target_frames)
 {
+    if (m_segment_writer) {
+        m_segment_writer->reserve(target_frames);
+        {
+            Memory::SeqlockWriteGuard g(m_data_lock);
+            m_num_frames = target_frames;
+            setup_dimensions();
+        }
+        update_processing_state(ProcessingState::READY);
+        return;
+    }
+
     uint64_t current_frames = get_total_elements() / get_num_channels();
     uint64_t new_capacity = std::max(target_frames, current_frames * 2);
 
@@ -2,6 +2,9 @@
 
 #include "SoundStreamContainer.hpp"
 
+#include "MayaFlux/Kakshya/Utils/SegmentedStore.hpp"
+#include "MayaFlux/Transitive/Memory/Snapshot.hpp"
+
 namespace MayaFlux::IO {
 class SoundFileReader;
 }
@@ -35,6 +38,12 @@ namespace MayaFlux::Kakshya {
  * 1. **Linear Mode**: Automatically expands as data is written, suitable for recording
  * 2. **Circular Mode**: Fixed-size buffer that wraps around, ideal for delay effects
  *
+ * Linear mode stores one vector per channel by default, and growing it copies
+ * every sample already recorded. enable_segmented_storage() switches to a
+ * SegmentedStore that grows by appending fixed-size segments instead, for
+ * long takes and live looper layers. See that method for which accessors
+ * read the segments directly.
+ *
  * **Thread Safety:**
  * Inherits full thread safety from SoundStreamContainer including shared/exclusive locks
  * for concurrent read/write access and atomic state management for processing coordination.
@@ -127,6 +136,72 @@ public:
 
     uint64_t get_circular_capacity() const { return m_circular_capacity; }
 
+    /**
+     * @brief Store samples in fixed-size segments that are never moved once written.
+     *
+     * Growth appends zeroed segments instead of reallocating and copying, so
+     * the seqlock is held only while new samples are copied in. Existing
+     * samples are moved into segments once, here.
+     *
+     * write_frames(), get_channel_frames(), get_region_data(), read_frames()
+     * and peek_sequential() work on the segments directly; the span overload
+     * of get_channel_frames() stops at a segment boundary. Accessors that
+     * hand out contiguous storage (get_data(), get_data_as_double(),
+     * get_channel_view(), channel_data()) see the snapshot taken by the last
+     * materialize() call and are empty before it.
+     *
+     * Not available in circular mode; enable_circular_buffer() returns to
+     * contiguous storage.
+     *
+     * @param segment_frames Frames per segment, rounded up to a power of two.
+     */
+    void enable_segmented_storage(uint64_t segment_frames = 4096);
+
+    /**
+     * @brief Return to contiguous per-channel storage, materializing all frames.
+     *
+     * The store is retired rather than destroyed; it is freed once every
+     * reader that could still hold it has finished. Spans returned by
+     * get_channel_frames() while segmented must not outlive this call.
+     */
+    void disable_segmented_storage();
+
+    /** @brief True while samples live in a SegmentedStore. */
+    [[nodiscard]] bool is_segmented() const { return static_cast<bool>(m_segments.read()); }
+
+    /** @brief Frames per segment, or 0 when not segmented. */
+    [[nodiscard]] uint64_t get_segment_frames() const
+    {
+        auto segments = m_segments.read();
+        return segments ? segments->get_segment_frames() : 0;
+    }
+
+    /**
+     * @brief Pin the segmented store for a realtime reader.
+     * @param num_frames Receives the number of frames written so far
+     * @return Guard holding the store; empty when not segmented. Segment
+     *         pointers taken from it stay valid while the guard lives.
+     *
+     * Wait-free apart from the seqlock read of the frame count, and never
+     * allocates, so realtime readers such as VarispeedReaderNode can follow
+     * the store as it grows instead of the last materialize() snapshot.
+     * Sample values are read without the seqlock, as with get_channel_view().
+     */
+    [[nodiscard]] Memory::SnapshotCell<SegmentedStore>::ReadGuard pin_segments(uint64_t& num_frames) const;
+
+    /**
+     * @brief Copy the segmented frames into contiguous storage for get_data() and friends.
+     *
+     * The copy is a snapshot; frames written afterwards appear only after
+     * the next call. Does nothing when not segmented.
+     */
+    void materialize();
+
+    std::vector<DataVariant> get_region_data(const Region& region) const override;
+    uint64_t peek_sequential(std::span<double> output, uint64_t count, uint64_t offset = 0) const override;
+    bool has_data() const override;
+    void clear() override;
+
     /**
      * @brief Allocate an independent processed data slot.
      *
@@ -158,6 +233,8 @@ private:
     uint64_t m_circular_capacity {}; ///< Fixed capacity for circular mode
     std::vector<std::vector<DataVariant>> m_dynamic_data;
     std::vector<bool> m_dynamic_slots;
+    Memory::SnapshotCell<SegmentedStore> m_segments; ///< Published store; readers pin it with read()
+    SegmentedStore* m_segment_writer {}; ///< Same store for the writer side, null when not segmented
 
     void expand_to(uint64_t target_frames);
 
@@ -42,6 +42,8 @@ uint32_t PlotContainer::add_series(std::string name, uint64_t count,
 {
     m_data.emplace_back(std::vector<double>(count, 0.0));
     m_processed_data.emplace_back(std::vector<double>(count, 0.0));
+    m_dirty.emplace_back();
+    m_summaries.emplace_back();
 
     m_series_locks.resize(m_data.size());
 
@@ -73,6 +75,7 @@ void PlotContainer::write_series(uint32_t index, std::span<const double> samples
     const uint64_t n = std::min<uint64_t>(samples.size(), vec->size());
     Memory::SeqlockWriteGuard g(m_series_locks[index]);
     std::copy_n(samples.begin(), n, vec->begin());
+    mark_dirty(index, 0, n);
 }
 
 void PlotContainer::write_sample(uint32_t index, uint64_t sample_index, double value)
@@ -90,6 +93,30 @@ void PlotContainer::write_sample(uint32_t index, uint64_t sample_index, double v
 
     Memory::SeqlockWriteGuard g(m_series_locks[index]);
     (*vec)[sample_index] = value;
+    mark_dirty(index, sample_index, sample_index + 1);
+}
+
+void PlotContainer::append_series(uint32_t index, std::span<const double> samples)
+{
+    if (index >= m_data.size()) {
+        MF_ERROR(C, X, "PlotContainer::append_series: index {} out of range", index);
+        return;
+    }
+
+    auto* vec = std::get_if<std::vector<double>>(&m_data[index]);
+    if (!vec) {
+        MF_ERROR(C, X, "PlotContainer::append_series: series {} has unexpected variant type", index);
+        return;
+    }
+
+    if (samples.empty())
+        return;
+
+    Memory::SeqlockWriteGuard g(m_series_locks[index]);
+    const uint64_t start = vec->size();
+    vec->insert(vec->end(), samples.begin(), samples.end());
+    m_structure.dimensions[index].size = vec->size();
+    mark_dirty(index, start, vec->size());
 }
 
 void PlotContainer::resize_series(uint32_t index, uint64_t count)
@@ -103,13 +130,86 @@ void PlotContainer::resize_series(uint32_t index, uint64_t count)
     if (!vec)
         return;
 
+    Memory::SeqlockWriteGuard g(m_series_locks[index]);
+    const uint64_t previous = vec->size();
     vec->resize(count, 0.0);
+    m_structure.dimensions[index].size = count;
+    mark_dirty(index, std::min(previous, count), count);
+}
 
-    auto* pv = std::get_if<std::vector<double>>(&m_processed_data[index]);
-    if (pv)
-        pv->resize(count, 0.0);
+void PlotContainer::mark_dirty(size_t index, uint64_t first, uint64_t end)
+{
+    auto& d = m_dirty[index];
+    d.first = std::min(d.first, first);
+    d.end = std::max(d.end, end);
+}
 
-    m_structure.dimensions[index].size = count;
+void PlotContainer::sync_processed_series(uint32_t index)
+{
+    if (index >= m_data.size())
+        return;
+
+    auto* dst = std::get_if<std::vector<double>>(&m_processed_data[index]);
+    if (!dst)
+        return;
+
+    DirtyRange dirty;
+    bool resized = false;
+    {
+        Memory::SeqlockWriteGuard g(m_series_locks[index]);
+        const auto* src = std::get_if<std::vector<double>>(&m_data[index]);
+        if (!src)
+            return;
+
+        dirty = std::exchange(m_dirty[index], DirtyRange {});
+        resized = dst->size() != src->size();
+        if (dirty.first >= dirty.end && !resized)
+            return;
+
+        dst->resize(src->size());
+        const uint64_t end = std::min<uint64_t>(dirty.end, src->size());
+        if (dirty.first < end) {
+            std::copy(src->begin() + static_cast<ptrdiff_t>(dirty.first),
+                src->begin() + static_cast<ptrdiff_t>(end),
+                dst->begin() + static_cast<ptrdiff_t>(dirty.first));
+        }
+    }
+
+    if (auto& summary = m_summaries[index]) {
+        const uint64_t first = std::min<uint64_t>(dirty.first, dst->size());
+        summary->update(*dst, first, std::max(dirty.end, first) - first);
+    }
+}
+
+void PlotContainer::enable_summary(uint32_t index, uint32_t base_bucket)
+{
+    if (index >= m_data.size()) {
+        MF_ERROR(C, X, "PlotContainer::enable_summary: index {} out of range", index);
+        return;
+    }
+
+    const auto* series = std::get_if<std::vector<double>>(&m_processed_data[index]);
+    if (!series)
+        return;
+
+    auto& summary = m_summaries[index];
+    if (!summary || summary->get_base_bucket() != std::bit_ceil(std::max(base_bucket, 1U)))
+        summary = std::make_unique<WaveformSummary>(base_bucket);
+    summary->build(*series);
+
+    MF_INFO(C, X, "PlotContainer: series {} summarised ({} samples, {} levels)",
+        index, summary->get_sample_count(), summary->get_level_count());
+}
+
+void PlotContainer::disable_summary(uint32_t index)
+{
+    if (index < m_summaries.size())
+        m_summaries[index].reset();
+}
+
+const WaveformSummary* PlotContainer::series_summary(uint32_t index) const
+{
+    return index < m_summaries.size() ? m_summaries[index].get() : nullptr;
 }
 
 uint32_t PlotContainer::series_count() const
@@ -183,6 +283,17 @@ void PlotContainer::bind(uint32_t series_index,
     mark_ready_for_processing(true);
 }
 
+void PlotContainer::bind(uint32_t series_index,
+    std::shared_ptr<DynamicSoundStream> stream,
+    uint32_t channel)
+{
+    auto& p = ensure_processor();
+    p.bind_stream(series_index, std::move(stream), channel);
+    p.set_series_semantics(series_index, m_structure.dimensions[series_index].role,
+        m_structure.modality);
+    mark_ready_for_processing(true);
+}
+
 void PlotContainer::set_raw(uint32_t series_index, std::vector<double> data)
 {
     auto& p = ensure_processor();
@@ -278,6 +389,7 @@ void PlotContainer::set_region_data(const Region& region, const std::vector<Data
 
     const uint64_t n = std::min<uint64_t>(src->size(), e - s + 1);
     std::copy_n(src->begin(), n, dst->begin() + static_cast<ptrdiff_t>(s));
+    mark_dirty(series_idx, s, s + n);
 }
 
 std::vector<DataVariant> PlotContainer::get_region_group_data(const RegionGroup& group) const
@@ -312,6 +424,8 @@ void PlotContainer::clear()
 {
     m_data.clear();
     m_processed_data.clear();
+    m_dirty.clear();
+    m_summaries.clear();
     m_structure.dimensions.clear();
     update_processing_state(ProcessingState::IDLE);
 }
@@ -336,6 +450,11 @@ DataAccess PlotContainer::channel_data(size_t index)
         static std::vector<DataDimension> empty_dims;
         return { empty, empty_dims, DataModality::TENSOR_ND };
     }
+    // Callers may write through the returned access, so the next sync copies the whole series.
+    {
+        Memory::SeqlockWriteGuard g(m_series_locks[index]);
+        mark_dirty(index, 0, series_size(static_cast<uint32_t>(index)));
+    }
     return { m_data[index], { m_structure.dimensions[index] }, DataModality::TENSOR_ND };
 }
 
@@ -344,6 +463,10 @@ std::vector<DataAccess> PlotContainer::all_channel_data()
     std::vector<DataAccess> result;
     result.reserve(m_data.size());
     for (size_t i = 0; i < m_data.size(); ++i) {
+        {
+            Memory::SeqlockWriteGuard g(m_series_locks[i]);
+            mark_dirty(i, 0, series_size(static_cast<uint32_t>(i)));
+        }
         result.emplace_back(m_data[i],
             std::vector<DataDimension> { m_structure.dimensions[i] },
             DataModality::TENSOR_ND);
@@ -553,6 +676,7 @@ void PlotContainer::set_value_impl(
         return;
 
     (*vec)[coords[1]] = *static_cast<const double*>(in);
+    mark_dirty(idx, coords[1], coords[1] + 1);
 }
 
 } // namespace MayaFlux::Kakshya
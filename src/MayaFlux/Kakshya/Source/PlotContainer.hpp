@@ -1,6 +1,7 @@
 #pragma once
 
 #include "MayaFlux/Kakshya/SignalSourceContainer.hpp"
+#include "MayaFlux/Kakshya/Utils/WaveformSummary.hpp"
 
 #include "MayaFlux/Transitive/Memory/SeqLock.hpp"
 
@@ -17,6 +18,7 @@ class AudioBuffer;
 
 namespace MayaFlux::Kakshya {
 
+class DynamicSoundStream;
 class PlotProcessor;
 
 /**
@@ -28,7 +30,13 @@ class PlotProcessor;
  * processed_data mirrors m_data after PlotProcessor::process() — one DataVariant per series,
  * index-stable, suitable for direct consumption by Forma geometry functions.
  *
- * Series are append-only by index. Resize via resize_series() when the sample count changes.
+ * Series are append-only by index. Resize via resize_series() when the sample count changes,
+ * or grow a series in place with append_series().
+ *
+ * Writes record the sample range they touched, and process() mirrors only those ranges into
+ * processed_data, so a long series that is not changing costs nothing per frame. A series can
+ * also carry a WaveformSummary (enable_summary()), kept in step with processed_data, from which
+ * waveform encodings draw long signals at O(pixels).
  * Region semantics apply per-series: a Region with start/end coordinates on the TIME-equivalent
  * axis (dim 0) selects a sample range within that series. get_region_data() returns the
  * selected slice as vector<double>, enabling wavetable read-back and drag-to-select interaction.
@@ -132,6 +140,24 @@ public:
     void bind(uint32_t series_index,
         std::function<void(std::vector<double>&)> fn);
 
+    /**
+     * @brief Bind a series to one channel of a DynamicSoundStream.
+     *
+     * Each process() appends only the frames added to the stream since the
+     * previous call, so following a recording costs O(new frames) rather
+     * than O(length). A circular stream, or one that shrank, is re-read in
+     * full. Frames are tracked through get_num_frames(); enable segmented
+     * storage on the stream so that equals the written extent instead of
+     * the allocated capacity.
+     *
+     * @param series_index  Index returned by add_series().
+     * @param stream        Stream to follow.
+     * @param channel       Channel of @p stream to read.
+     */
+    void bind(uint32_t series_index,
+        std::shared_ptr<DynamicSoundStream> stream,
+        uint32_t channel = 0);
+
     /**
      * @brief Push raw sample data into a series.
      *
@@ -164,6 +190,13 @@ public:
      */
     void write_sample(uint32_t index, uint64_t sample_index, double value);
 
+    /**
+     * @brief Append samples to the end of a series, growing it and its DataDimension.
+     * @param index   Series index.
+     * @param samples Samples to append.
+     */
+    void append_series(uint32_t index, std::span<const double> samples);
+
     /**
      * @brief Resize a series. Truncates or zero-extends. Updates the DataDimension.
      * @param index Series index.
@@ -191,6 +224,41 @@ public:
      */
     [[nodiscard]] DataDimension::Role series_role(uint32_t index) const;
 
+    /**
+     * @brief Maintain a min/max/RMS pyramid over a series.
+     *
+     * Built immediately, in parallel, from the series' processed_data, then
+     * updated incrementally over each range sync_processed_series() mirrors.
+     * Calling it again with a different @p base_bucket rebuilds the pyramid.
+     *
+     * @param index       Series index.
+     * @param base_bucket Samples per finest bucket; rounded up to a power of two.
+     */
+    void enable_summary(uint32_t index, uint32_t base_bucket = 256);
+
+    /**
+     * @brief Drop the pyramid for a series.
+     */
+    void disable_summary(uint32_t index);
+
+    /**
+     * @brief Pyramid describing processed_data for a series, or nullptr if not enabled.
+     *
+     * Updated by process(); read it from the thread that drives processing.
+     */
+    [[nodiscard]] const WaveformSummary* series_summary(uint32_t index) const;
+
+    /**
+     * @brief Mirror the samples written since the last call into processed_data.
+     *
+     * Copies only the written range, resizing the processed_data series if
+     * its length changed, and updates the series summary over that range.
+     * Called by PlotProcessor::process() for every series.
+     *
+     * @param index Series index.
+     */
+    void sync_processed_series(uint32_t index);
+
     // =========================================================================
     // NDDataContainer
     // =========================================================================
@@ -301,6 +369,19 @@ protected:
         const void* in, const std::type_info& type) override;
 
 private:
+    /**
+     * @brief Sample range of a series written since the last sync. Empty when first >= end.
+     */
+    struct DirtyRange {
+        uint64_t first { std::numeric_limits<uint64_t>::max() };
+        uint64_t end {};
+    };
+
+    /**
+     * @brief Widen the dirty range of a series. Caller holds the series write lock.
+     */
+    void mark_dirty(size_t index, uint64_t first, uint64_t end);
+
     /**
      * @brief Return the PlotProcessor, creating and attaching it if absent.
      *
@@ -316,6 +397,9 @@ private:
     std::shared_ptr<DataProcessor> m_processor;
     std::shared_ptr<DataProcessingChain> m_chain;
 
+    std::vector<DirtyRange> m_dirty;
+    std::vector<std::unique_ptr<WaveformSummary>> m_summaries;
+
     Memory::SeqlockArray m_series_locks;
     mutable Memory::Seqlock m_region_lock;
     mutable Memory::Seqlock m_cb_lock;
@@ -91,17 +91,12 @@ std::vector<DataVariant> SoundStreamContainer::get_region_data(const Region& reg
         if (spans.empty())
             return {};
 
-        std::span<const double> const_span(spans[0].data(), spans[0].size());
-        auto extracted = extract_region_data<double>(const_span, region, m_structure.dimensions);
+        auto extracted = extract_region_data<double>(spans[0], region, m_structure.dimensions);
         return { DataVariant(std::move(extracted)) };
     }
 
-    auto const_spans = spans | std::views::transform([](const auto& span) {
-        return std::span<const double>(span.data(), span.size());
-    });
-
     auto extracted_channels = extract_region_data<double>(
-        std::vector<std::span<const double>>(const_spans.begin(), const_spans.end()),
+        spans,
         region, m_structure.dimensions);
 
     return extracted_channels
@@ -117,18 +112,20 @@ void SoundStreamContainer::set_region_data(const Region& region, const std::vect
         if (m_data.empty() || data.empty())
             return;
 
+        std::vector<double> scratch;
         Memory::SeqlockWriteGuard g(m_data_lock);
         auto dest_span = convert_variant<double>(m_data[0]);
-        auto src_span = convert_variant<double>(data[0]);
+        auto src_span = view_as<double>(data[0], scratch);
 
         set_or_update_region_data<double>(dest_span, src_span, region, m_structure.dimensions);
     } else {
         size_t channels_to_update = std::min(m_data.size(), data.size());
+        std::vector<double> scratch;
         Memory::SeqlockWriteGuard g(m_data_lock);
 
         for (size_t i = 0; i < channels_to_update; ++i) {
             auto dest_span = convert_variant<double>(m_data[i]);
-            auto src_span = convert_variant<double>(data[i]);
+            auto src_span = view_as<double>(data[i], scratch);
             set_or_update_region_data<double>(dest_span, src_span, region, m_structure.dimensions);
         }
     }
@@ -144,12 +141,8 @@ std::vector<DataVariant> SoundStreamContainer::get_region_group_data(const Regio
     if (spans.empty())
         return {};
 
-    auto const_spans = spans | std::views::transform([](const auto& span) {
-        return std::span<const double>(span.data(), span.size());
-    });
-
     auto extracted_channels = extract_group_data<double>(
-        std::vector<std::span<const double>>(const_spans.begin(), const_spans.end()),
+        spans,
         region_group, m_structure.dimensions, m_structure.organization);
 
     return extracted_channels
@@ -166,13 +159,9 @@ std::vector<DataVariant> SoundStreamContainer::get_segments_data(const std::vect
     if (spans.empty() || segments.empty())
         return {};
 
-    auto const_spans = spans | std::views::transform([](const auto& span) {
-        return std::span<const double>(span.data(), span.size());
-    });
-
     auto extracted_channels = extract_segments_data<double>(
         segments,
-        std::vector<std::span<const double>>(const_spans.begin(), const_spans.end()),
+        spans,
         m_structure.dimensions, m_structure.organization);
 
     return extracted_channels
@@ -204,13 +193,17 @@ std::span<const double> SoundStreamContainer::get_frame_typed(uint64_t frame_ind
         if (spans.empty())
             return {};
 
-        auto frame_span = extract_frame<double>(spans[0], frame_index, m_num_channels);
-        return { frame_span.data(), frame_span.size() };
+        const uint64_t start = frame_index * m_num_channels;
+        if (start >= spans[0].size())
+            return {};
+        return spans[0].subspan(start, std::min<uint64_t>(m_num_channels, spans[0].size() - start));
     }
 
     static thread_local std::vector<double> frame_buffer;
-    auto frame_span = extract_frame<double>(spans, frame_index, frame_buffer);
-    return { frame_span.data(), frame_span.size() };
+    frame_buffer.clear();
+    for (const auto& channel : spans)
+        frame_buffer.push_back(frame_index < channel.size() ? channel[frame_index] : 0.0);
+    return { frame_buffer.data(), frame_buffer.size() };
 }
 
 void SoundStreamContainer::get_frames_typed(std::span<double> output, uint64_t start_frame, uint64_t num_frames) const
@@ -721,8 +714,8 @@ void SoundStreamContainer::reorganize_data_layout(MemoryLayout new_layout)
         return;
     }
 
-    auto current_span = convert_variant<double>(m_data[0]);
-    std::vector<double> current_data(current_span.begin(), current_span.end());
+    std::vector<double> current_data;
+    convert_into<double>(m_data[0], current_data);
 
     auto channels = deinterleave_channels<double>(
         std::span<const double>(current_data.data(), current_data.size()),
@@ -756,12 +749,8 @@ std::span<const double> SoundStreamContainer::get_data_as_double() const
         if (m_data.empty())
             return {};
 
-        std::span<const double> result;
-        seqlock_read_void(m_data_lock, 8, [&] {
-            auto span = convert_variant<double>(m_data[0]);
-            result = { span.data(), span.size() };
-        });
-        return result;
+        const auto& spans = get_span_cache();
+        return spans.empty() ? std::span<const double> {} : spans[0];
     }
 
     const auto& spans = get_span_cache();
@@ -802,22 +791,47 @@ std::vector<DataAccess> SoundStreamContainer::all_channel_data()
     return result;
 }
 
-const std::vector<std::span<double>>& SoundStreamContainer::get_span_cache() const
+std::pair<std::span<const double>, size_t> SoundStreamContainer::get_channel_view(uint32_t channel) const
+{
+    if (channel >= m_num_channels)
+        return { {}, 1 };
+
+    const auto& spans = get_span_cache();
+
+    if (m_structure.organization == OrganizationStrategy::INTERLEAVED) {
+        if (spans.empty() || channel >= spans[0].size())
+            return { {}, 1 };
+        return { spans[0].subspan(channel), m_num_channels };
+    }
+
+    if (channel >= spans.size())
+        return { {}, 1 };
+    return { spans[channel], 1 };
+}
+
+const std::vector<std::span<const double>>& SoundStreamContainer::get_span_cache() const
 {
     if (!m_span_cache_dirty.load(std::memory_order_acquire) && m_span_cache.has_value())
         return *m_span_cache;
 
     seqlock_read_void(m_data_lock, 8, [&] {
+        std::lock_guard lock(m_span_cache_mutex);
         if (!m_span_cache_dirty.load(std::memory_order_acquire) && m_span_cache.has_value())
             return;
 
-        auto spans = m_data
-            | std::views::transform([](auto& variant) {
-                  return convert_variant<double>(const_cast<DataVariant&>(variant));
-              })
-            | std::ranges::to<std::vector>();
+        const uint64_t version = m_data_version.load(std::memory_order_acquire);
+        if (m_double_shadows.size() != m_data.size())
+            m_double_shadows.resize(m_data.size());
+
+        std::vector<VariantView<double>> leases;
+        leases.reserve(m_data.size());
+        for (size_t ch = 0; ch < m_data.size(); ++ch)
+            leases.push_back(m_double_shadows[ch].view(m_data[ch], version));
 
-        m_span_cache = std::move(spans);
+        m_span_cache = leases
+            | std::views::transform([](const auto& view) { return view.span(); })
+            | std::ranges::to<std::vector>();
+        m_span_leases = std::move(leases);
         m_span_cache_dirty.store(false, std::memory_order_release);
     });
 
@@ -826,6 +840,7 @@ const std::vector<std::span<double>>& SoundStreamContainer::get_span_cache() con
 
 void SoundStreamContainer::invalidate_span_cache()
 {
+    m_data_version.fetch_add(1, std::memory_order_acq_rel);
     m_span_cache_dirty.store(true, std::memory_order_release);
 }
 
@@ -873,19 +888,31 @@ void SoundStreamContainer::set_value_impl(
     if (frame >= m_num_frames || channel >= m_num_channels)
         return;
 
-    const auto& spans = get_span_cache();
+    {
+        Memory::SeqlockWriteGuard g(m_data_lock);
 
-    if (m_structure.organization == OrganizationStrategy::INTERLEAVED) {
-        if (spans.empty())
+        const size_t slot = m_structure.organization == OrganizationStrategy::INTERLEAVED ? 0 : channel;
+        if (slot >= m_data.size())
             return;
-        const uint64_t idx = frame * m_num_channels + channel;
-        if (idx >= spans[0].size())
-            return;
-        const_cast<std::span<double>&>(spans[0])[idx] = *static_cast<const double*>(in);
-    } else {
-        if (channel >= spans.size() || frame >= spans[channel].size())
-            return;
-        const_cast<std::span<double>&>(spans[channel])[frame] = *static_cast<const double*>(in);
+
+        const uint64_t idx = m_structure.organization == OrganizationStrategy::INTERLEAVED
+            ? frame * m_num_channels + channel
+            : frame;
+
+        // Write in the stored element type; converting the whole channel to
+        // double here would change the variant's alternative behind readers.
+        const double value = *static_cast<const double*>(in);
+        std::visit([idx, value](auto& vec) {
+            using ValueType = typename std::decay_t<decltype(vec)>::value_type;
+            if (idx >= vec.size())
+                return;
+            if constexpr (ArithmeticData<ValueType>) {
+                vec[idx] = static_cast<ValueType>(value);
+            } else if constexpr (ComplexData<ValueType> && !GlmType<ValueType>) {
+                vec[idx] = ValueType(static_cast<typename ValueType::value_type>(value), 0);
+            }
+        },
+            m_data[slot]);
     }
 
     invalidate_span_cache();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "MayaFlux/Kakshya/StreamContainer.hpp"
+#include "MayaFlux/Kakshya/Utils/VariantView.hpp"
 
 #include "MayaFlux/Transitive/Memory/SeqLock.hpp"
 
@@ -199,13 +200,40 @@ public:
      */
     std::vector<DataAccess> all_channel_data() override;
 
+    /**
+     * @brief Read-only view of one channel's samples as double, without copying
+     * @param channel Channel index
+     * @return Samples starting at frame 0 of @p channel, and the distance
+     *         between successive frames (1 for planar, channel count for
+     *         interleaved). Empty span if the channel does not exist.
+     *
+     * The view stays valid until the container's data is next modified.
+     * Intended for realtime readers such as varispeed playback that index
+     * frames directly.
+     */
+    [[nodiscard]] std::pair<std::span<const double>, size_t> get_channel_view(uint32_t channel) const;
+
+    /**
+     * @brief Counter bumped whenever the sample data or its layout changes
+     *
+     * A view from get_channel_view() taken at one version may be read
+     * until the version moves on. Lock-free; safe on the audio thread.
+     */
+    [[nodiscard]] uint64_t get_data_version() const { return m_data_version.load(std::memory_order_acquire); }
+
 protected:
     void setup_dimensions();
     void notify_state_change(ProcessingState new_state);
     void reorganize_data_layout(MemoryLayout new_layout);
 
-    /** @brief Get the cached spans for each channel, recomputing if dirty */
-    const std::vector<std::span<double>>& get_span_cache() const;
+    /**
+     * @brief Get the cached read-only double spans for each channel, recomputing if dirty.
+     *
+     * Channels already stored as double are viewed in place. Other element
+     * types are converted into per-channel shadows; m_data is never
+     * modified here.
+     */
+    const std::vector<std::span<const double>>& get_span_cache() const;
 
     /** @brief Invalidate the span cache when data or layout changes */
     void invalidate_span_cache();
@@ -266,9 +294,14 @@ protected:
         const void* in, const std::type_info& type) override;
 
 private:
-    mutable std::optional<std::vector<std::span<double>>> m_span_cache;
+    mutable std::optional<std::vector<std::span<const double>>> m_span_cache;
     mutable std::atomic<bool> m_span_cache_dirty { true };
 
+    mutable std::vector<VariantShadow<double>> m_double_shadows;
+    mutable std::vector<VariantView<double>> m_span_leases;
+    mutable std::mutex m_span_cache_mutex;
+    std::atomic<uint64_t> m_data_version { 0 };
+
     std::span<const double> get_frame_typed(uint64_t frame_index) const;
     void get_frames_typed(std::span<double> output, uint64_t start_frame, uint64_t num_frames) const;
 };
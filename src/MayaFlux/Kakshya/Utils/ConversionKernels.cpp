@@ -0,0 +1,416 @@
+// NOLINTBEGIN
+#include "ConversionKernels.hpp"
+
+#ifdef MAYAFLUX_ARCH_X64
+#include <immintrin.h>
+#endif
+#ifdef MAYAFLUX_ARCH_ARM64
+#include <arm_neon.h>
+#endif
+
+namespace MayaFlux::Kakshya {
+
+namespace {
+
+    constexpr float k_pi = std::numbers::pi_v<float>;
+    constexpr float k_half_pi = k_pi * 0.5F;
+    constexpr float k_quarter_pi = k_pi * 0.25F;
+    constexpr float k_tan_pi_8 = 0.414213562373095F;
+
+    /**
+     * @brief Cephes-style atan2: reduce to atan(a), a in [0, 1], then to
+     * [0, tan(pi/8)] and evaluate a degree-9 odd polynomial.
+     */
+    float atan2_poly(float y, float x)
+    {
+        const float ax = std::abs(x);
+        const float ay = std::abs(y);
+        const float mx = std::max(ax, ay);
+        const float mn = std::min(ax, ay);
+        float a = mx > 0.F ? mn / mx : 0.F;
+
+        float base = 0.F;
+        if (a > k_tan_pi_8) {
+            base = k_quarter_pi;
+            a = (a - 1.F) / (a + 1.F);
+        }
+
+        const float z = a * a;
+        const float p = (((8.05374449538e-2F * z - 1.38776856032e-1F) * z + 1.99777106478e-1F) * z - 3.33329491539e-1F) * z;
+        float r = base + std::fma(p, a, a);
+
+        if (ay > ax) {
+            r = k_half_pi - r;
+        }
+        if (std::signbit(x)) {
+            r = k_pi - r;
+        }
+        return std::copysign(r, y);
+    }
+
+    template <typename Src, typename Dst>
+    size_t common_size(std::span<Src> src, std::span<Dst> dst)
+    {
+        return std::min(src.size(), dst.size());
+    }
+
+} // namespace
+
+// =========================================================================
+// float <-> double
+// =========================================================================
+
+void widen_to_double(std::span<const float> src, std::span<double> dst)
+{
+    const size_t n = common_size(src, dst);
+    const float* s = src.data();
+    double* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_pd(d + i, _mm256_cvtps_pd(_mm_loadu_ps(s + i)));
+        _mm256_storeu_pd(d + i + 4, _mm256_cvtps_pd(_mm_loadu_ps(s + i + 4)));
+    }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+    for (; i + 4 <= n; i += 4) {
+        const float32x4_t v = vld1q_f32(s + i);
+        vst1q_f64(d + i, vcvt_f64_f32(vget_low_f32(v)));
+        vst1q_f64(d + i + 2, vcvt_high_f64_f32(v));
+    }
+#endif
+
+    for (; i < n; ++i)
+        d[i] = static_cast<double>(s[i]);
+}
+
+void narrow_to_float(std::span<const double> src, std::span<float> dst)
+{
+    const size_t n = common_size(src, dst);
+    const double* s = src.data();
+    float* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    for (; i + 8 <= n; i += 8) {
+        const __m128 lo = _mm256_cvtpd_ps(_mm256_loadu_pd(s + i));
+        const __m128 hi = _mm256_cvtpd_ps(_mm256_loadu_pd(s + i + 4));
+        _mm256_storeu_ps(d + i, _mm256_set_m128(hi, lo));
+    }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+    for (; i + 4 <= n; i += 4) {
+        const float32x2_t lo = vcvt_f32_f64(vld1q_f64(s + i));
+        vst1q_f32(d + i, vcvt_high_f32_f64(lo, vld1q_f64(s + i + 2)));
+    }
+#endif
+
+    for (; i < n; ++i)
+        d[i] = static_cast<float>(s[i]);
+}
+
+// =========================================================================
+// Integer -> float
+// =========================================================================
+
+void u8_to_float(std::span<const uint8_t> src, std::span<float> dst, float scale)
+{
+    const size_t n = common_size(src, dst);
+    const uint8_t* s = src.data();
+    float* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    const __m256 k = _mm256_set1_ps(scale);
+    for (; i + 16 <= n; i += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        const __m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(bytes));
+        const __m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8)));
+        _mm256_storeu_ps(d + i, _mm256_mul_ps(lo, k));
+        _mm256_storeu_ps(d + i + 8, _mm256_mul_ps(hi, k));
+    }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+    for (; i + 8 <= n; i += 8) {
+        const uint16x8_t w = vmovl_u8(vld1_u8(s + i));
+        const float32x4_t lo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(w)));
+        const float32x4_t hi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(w)));
+        vst1q_f32(d + i, vmulq_n_f32(lo, scale));
+        vst1q_f32(d + i + 4, vmulq_n_f32(hi, scale));
+    }
+#endif
+
+    for (; i < n; ++i)
+        d[i] = static_cast<float>(s[i]) * scale;
+}
+
+void u16_to_float(std::span<const uint16_t> src, std::span<float> dst, float scale)
+{
+    const size_t n = common_size(src, dst);
+    const uint16_t* s = src.data();
+    float* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    const __m256 k = _mm256_set1_ps(scale);
+    for (; i + 8 <= n; i += 8) {
+        const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        const __m256 v = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(w));
+        _mm256_storeu_ps(d + i, _mm256_mul_ps(v, k));
+    }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+    for (; i + 8 <= n; i += 8) {
+        const uint16x8_t w = vld1q_u16(s + i);
+        vst1q_f32(d + i, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(w))), scale));
+        vst1q_f32(d + i + 4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(w))), scale));
+    }
+#endif
+
+    for (; i < n; ++i)
+        d[i] = static_cast<float>(s[i]) * scale;
+}
+
+void i16_to_float(std::span<const int16_t> src, std::span<float> dst, float scale)
+{
+    const size_t n = common_size(src, dst);
+    const int16_t* s = src.data();
+    float* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    const __m256 k = _mm256_set1_ps(scale);
+    for (; i + 8 <= n; i += 8) {
+        const __m128i w = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        const __m256 v = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(w));
+        _mm256_storeu_ps(d + i, _mm256_mul_ps(v, k));
+    }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+    for (; i + 8 <= n; i += 8) {
+        const int16x8_t w = vld1q_s16(s + i);
+        vst1q_f32(d + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(w))), scale));
+        vst1q_f32(d + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(w))), scale));
+    }
+#endif
+
+    for (; i < n; ++i)
+        d[i] = static_cast<float>(s[i]) * scale;
+}
+
+void float_to_i16(std::span<const float> src, std::span<int16_t> dst)
+{
+    const size_t n = common_size(src, dst);
+    const float* s = src.data();
+    int16_t* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    const __m256 k = _mm256_set1_ps(32767.F);
+    const __m256 lo = _mm256_set1_ps(-1.F);
+    const __m256 hi = _mm256_set1_ps(1.F);
+    for (; i + 16 <= n; i += 16) {
+        const __m256 a = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(s + i), lo), hi);
+        const __m256 b = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(s + i + 8), lo), hi);
+        const __m256i ia = _mm256_cvtps_epi32(_mm256_mul_ps(a, k));
+        const __m256i ib = _mm256_cvtps_epi32(_mm256_mul_ps(b, k));
+        // packs interleaves 128-bit lanes; restore element order afterwards.
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(ia, ib), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(d + i), packed);
+    }
+#endif
+
+    for (; i < n; ++i) {
+        const float v = std::clamp(s[i], -1.F, 1.F) * 32767.F;
+        d[i] = static_cast<int16_t>(std::nearbyint(v));
+    }
+}
+
+// =========================================================================
+// Complex -> real
+// =========================================================================
+
+void complex_magnitude(std::span<const std::complex<float>> src, std::span<float> dst)
+{
+    const size_t n = common_size(src, dst);
+    const auto* s = reinterpret_cast<const float*>(src.data());
+    float* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    for (; i + 8 <= n; i += 8) {
+        const __m256 a = _mm256_loadu_ps(s + 2 * i);
+        const __m256 b = _mm256_loadu_ps(s + 2 * i + 8);
+        const __m256 re = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 im = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m256 mag = _mm256_sqrt_ps(_mm256_fmadd_ps(re, re, _mm256_mul_ps(im, im)));
+        // shuffle_ps works per 128-bit lane: order is 0 1 4 5 2 3 6 7.
+        const __m256 ordered = _mm256_castpd_ps(
+            _mm256_permute4x64_pd(_mm256_castps_pd(mag), _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm256_storeu_ps(d + i, ordered);
+    }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+    for (; i + 4 <= n; i += 4) {
+        const float32x4x2_t v = vld2q_f32(s + 2 * i);
+        vst1q_f32(d + i, vsqrtq_f32(vfmaq_f32(vmulq_f32(v.val[1], v.val[1]), v.val[0], v.val[0])));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        const float re = s[2 * i];
+        const float im = s[2 * i + 1];
+        d[i] = std::sqrt(std::fma(re, re, im * im));
+    }
+}
+
+void complex_magnitude(std::span<const std::complex<double>> src, std::span<double> dst)
+{
+    const size_t n = common_size(src, dst);
+    const auto* s = reinterpret_cast<const double*>(src.data());
+    double* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    for (; i + 4 <= n; i += 4) {
+        const __m256d a = _mm256_loadu_pd(s + 2 * i);
+        const __m256d b = _mm256_loadu_pd(s + 2 * i + 4);
+        const __m256d re = _mm256_unpacklo_pd(a, b);
+        const __m256d im = _mm256_unpackhi_pd(a, b);
+        const __m256d mag = _mm256_sqrt_pd(_mm256_fmadd_pd(re, re, _mm256_mul_pd(im, im)));
+        _mm256_storeu_pd(d + i, _mm256_permute4x64_pd(mag, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+    for (; i + 2 <= n; i += 2) {
+        const float64x2x2_t v = vld2q_f64(s + 2 * i);
+        vst1q_f64(d + i, vsqrtq_f64(vfmaq_f64(vmulq_f64(v.val[1], v.val[1]), v.val[0], v.val[0])));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        const double re = s[2 * i];
+        const double im = s[2 * i + 1];
+        d[i] = std::sqrt(std::fma(re, re, im * im));
+    }
+}
+
+void complex_squared_magnitude(std::span<const std::complex<float>> src, std::span<float> dst)
+{
+    const size_t n = common_size(src, dst);
+    const auto* s = reinterpret_cast<const float*>(src.data());
+    float* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    for (; i + 8 <= n; i += 8) {
+        const __m256 a = _mm256_loadu_ps(s + 2 * i);
+        const __m256 b = _mm256_loadu_ps(s + 2 * i + 8);
+        const __m256 re = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 im = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+        const __m256 sq = _mm256_fmadd_ps(re, re, _mm256_mul_ps(im, im));
+        const __m256 ordered = _mm256_castpd_ps(
+            _mm256_permute4x64_pd(_mm256_castps_pd(sq), _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm256_storeu_ps(d + i, ordered);
+    }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+    for (; i + 4 <= n; i += 4) {
+        const float32x4x2_t v = vld2q_f32(s + 2 * i);
+        vst1q_f32(d + i, vfmaq_f32(vmulq_f32(v.val[1], v.val[1]), v.val[0], v.val[0]));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        const float re = s[2 * i];
+        const float im = s[2 * i + 1];
+        d[i] = std::fma(re, re, im * im);
+    }
+}
+
+void complex_squared_magnitude(std::span<const std::complex<double>> src, std::span<double> dst)
+{
+    const size_t n = common_size(src, dst);
+    const auto* s = reinterpret_cast<const double*>(src.data());
+    double* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    for (; i + 4 <= n; i += 4) {
+        const __m256d a = _mm256_loadu_pd(s + 2 * i);
+        const __m256d b = _mm256_loadu_pd(s + 2 * i + 4);
+        const __m256d re = _mm256_unpacklo_pd(a, b);
+        const __m256d im = _mm256_unpackhi_pd(a, b);
+        const __m256d sq = _mm256_fmadd_pd(re, re, _mm256_mul_pd(im, im));
+        _mm256_storeu_pd(d + i, _mm256_permute4x64_pd(sq, _MM_SHUFFLE(3, 1, 2, 0)));
+    }
+#endif
+
+    for (; i < n; ++i) {
+        const double re = s[2 * i];
+        const double im = s[2 * i + 1];
+        d[i] = std::fma(re, re, im * im);
+    }
+}
+
+void complex_phase(std::span<const std::complex<float>> src, std::span<float> dst)
+{
+    const size_t n = common_size(src, dst);
+    const auto* s = reinterpret_cast<const float*>(src.data());
+    float* d = dst.data();
+    size_t i = 0;
+
+#ifdef MAYAFLUX_ARCH_X64
+    const __m256 sign_mask = _mm256_set1_ps(-0.F);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.F);
+    const __m256 pi = _mm256_set1_ps(k_pi);
+    const __m256 half_pi = _mm256_set1_ps(k_half_pi);
+    const __m256 quarter_pi = _mm256_set1_ps(k_quarter_pi);
+    const __m256 tan_pi_8 = _mm256_set1_ps(k_tan_pi_8);
+    const __m256 c0 = _mm256_set1_ps(8.05374449538e-2F);
+    const __m256 c1 = _mm256_set1_ps(-1.38776856032e-1F);
+    const __m256 c2 = _mm256_set1_ps(1.99777106478e-1F);
+    const __m256 c3 = _mm256_set1_ps(-3.33329491539e-1F);
+
+    for (; i + 8 <= n; i += 8) {
+        const __m256 a = _mm256_loadu_ps(s + 2 * i);
+        const __m256 b = _mm256_loadu_ps(s + 2 * i + 8);
+        const __m256 x = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        const __m256 y = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+
+        const __m256 ax = _mm256_andnot_ps(sign_mask, x);
+        const __m256 ay = _mm256_andnot_ps(sign_mask, y);
+        const __m256 mx = _mm256_max_ps(ax, ay);
+        const __m256 mn = _mm256_min_ps(ax, ay);
+
+        const __m256 nonzero = _mm256_cmp_ps(mx, zero, _CMP_GT_OQ);
+        __m256 t = _mm256_and_ps(_mm256_div_ps(mn, _mm256_blendv_ps(one, mx, nonzero)), nonzero);
+
+        const __m256 reduce = _mm256_cmp_ps(t, tan_pi_8, _CMP_GT_OQ);
+        const __m256 base = _mm256_and_ps(reduce, quarter_pi);
+        t = _mm256_blendv_ps(t, _mm256_div_ps(_mm256_sub_ps(t, one), _mm256_add_ps(t, one)), reduce);
+
+        const __m256 z = _mm256_mul_ps(t, t);
+        __m256 p = _mm256_fmadd_ps(c0, z, c1);
+        p = _mm256_fmadd_ps(p, z, c2);
+        p = _mm256_fmadd_ps(p, z, c3);
+        p = _mm256_mul_ps(p, z);
+        __m256 r = _mm256_add_ps(base, _mm256_fmadd_ps(p, t, t));
+
+        r = _mm256_blendv_ps(r, _mm256_sub_ps(half_pi, r), _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+        r = _mm256_blendv_ps(r, _mm256_sub_ps(pi, r), x);
+        r = _mm256_or_ps(r, _mm256_and_ps(y, sign_mask));
+
+        const __m256 ordered = _mm256_castpd_ps(
+            _mm256_permute4x64_pd(_mm256_castps_pd(r), _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm256_storeu_ps(d + i, ordered);
+    }
+#endif
+
+    for (; i < n; ++i)
+        d[i] = atan2_poly(s[2 * i + 1], s[2 * i]);
+}
+
+void complex_phase(std::span<const std::complex<double>> src, std::span<double> dst)
+{
+    const size_t n = common_size(src, dst);
+    for (size_t i = 0; i < n; ++i)
+        dst[i] = std::atan2(src[i].imag(), src[i].real());
+}
+
+} // namespace MayaFlux::Kakshya
+// NOLINTEND
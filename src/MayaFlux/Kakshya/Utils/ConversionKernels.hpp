@@ -0,0 +1,69 @@
+#pragma once
+
+/**
+ * @file ConversionKernels.hpp
+ * @brief Vectorized element-type conversion kernels for DataVariant access.
+ *
+ * Every kernel reads @p src and writes min(src.size(), dst.size()) elements
+ * of @p dst (complex kernels: one output per complex input). Source and
+ * destination must not overlap. AVX2/FMA is used on x86_64 and NEON on
+ * ARM64 where the operation maps cleanly; the remainder, and platforms
+ * without either, use scalar loops with identical results.
+ */
+
+namespace MayaFlux::Kakshya {
+
+/** @brief float -> double, exact. */
+MAYAFLUX_API void widen_to_double(std::span<const float> src, std::span<double> dst);
+
+/** @brief double -> float, round to nearest. */
+MAYAFLUX_API void narrow_to_float(std::span<const double> src, std::span<float> dst);
+
+/**
+ * @brief uint8 -> float, multiplied by @p scale.
+ *
+ * scale = 1 reproduces static_cast<float>; 1/255 normalises to [0, 1].
+ */
+MAYAFLUX_API void u8_to_float(std::span<const uint8_t> src, std::span<float> dst, float scale = 1.F);
+
+/**
+ * @brief uint16 -> float, multiplied by @p scale.
+ *
+ * scale = 1 reproduces static_cast<float>; 1/65535 normalises to [0, 1].
+ */
+MAYAFLUX_API void u16_to_float(std::span<const uint16_t> src, std::span<float> dst, float scale = 1.F);
+
+/**
+ * @brief int16 PCM -> float, multiplied by @p scale (default 1/32768, giving [-1, 1)).
+ */
+MAYAFLUX_API void i16_to_float(std::span<const int16_t> src, std::span<float> dst, float scale = 1.F / 32768.F);
+
+/**
+ * @brief float in [-1, 1] -> int16 PCM, scaled by 32767, rounded and saturated.
+ */
+MAYAFLUX_API void float_to_i16(std::span<const float> src, std::span<int16_t> dst);
+
+/**
+ * @brief |z| per element, computed as sqrt(re^2 + im^2).
+ *
+ * Unlike std::abs this does not guard against overflow for components
+ * above ~1e19 (float) or ~1e154 (double), which never occur in audio or
+ * spectral data.
+ */
+MAYAFLUX_API void complex_magnitude(std::span<const std::complex<float>> src, std::span<float> dst);
+MAYAFLUX_API void complex_magnitude(std::span<const std::complex<double>> src, std::span<double> dst);
+
+/** @brief |z|^2 per element. */
+MAYAFLUX_API void complex_squared_magnitude(std::span<const std::complex<float>> src, std::span<float> dst);
+MAYAFLUX_API void complex_squared_magnitude(std::span<const std::complex<double>> src, std::span<double> dst);
+
+/**
+ * @brief arg(z) per element, in (-pi, pi].
+ *
+ * The float version evaluates a polynomial atan2 accurate to a few 1e-7 rad
+ * (vectorized on x86_64); the double version defers to std::atan2.
+ */
+MAYAFLUX_API void complex_phase(std::span<const std::complex<float>> src, std::span<float> dst);
+MAYAFLUX_API void complex_phase(std::span<const std::complex<double>> src, std::span<double> dst);
+
+} // namespace MayaFlux::Kakshya
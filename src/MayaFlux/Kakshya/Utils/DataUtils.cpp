@@ -58,6 +58,37 @@ void safe_copy_data_variant(const DataVariant& input, DataVariant& output)
         input, output);
 }
 
+namespace {
+
+    /// Elements per task when splitting a conversion across the pool.
+    constexpr size_t k_convert_block = size_t { 1 } << 16;
+
+    /**
+     * @brief Run a span kernel over [0, n) in parallel blocks.
+     *
+     * Below two blocks the kernel runs inline; the SIMD kernels already
+     * saturate memory bandwidth for buffers that small.
+     */
+    template <typename Kernel>
+    void convert_blocked(size_t n, Kernel&& kernel)
+    {
+        const size_t blocks = (n + k_convert_block - 1) / k_convert_block;
+        if (blocks < 2) {
+            kernel(size_t { 0 }, n);
+            return;
+        }
+
+        Parallel::for_each(Parallel::par,
+            std::views::iota(size_t { 0 }, blocks).begin(),
+            std::views::iota(size_t { 0 }, blocks).end(),
+            [&](size_t b) {
+                const size_t begin = b * k_convert_block;
+                kernel(begin, std::min(n, begin + k_convert_block) - begin);
+            });
+    }
+
+} // namespace
+
 std::span<const float> as_normalised_float(
     const DataVariant& variant, std::vector<float>& storage)
 {
@@ -69,20 +100,18 @@ std::span<const float> as_normalised_float(
 
         } else if constexpr (std::is_same_v<T, uint8_t>) {
             storage.resize(vec.size());
-            constexpr float k = 1.0F / 255.0F;
-
-            std::transform(Parallel::par_unseq,
-                vec.begin(), vec.end(), storage.begin(),
-                [](uint8_t v) { return static_cast<float>(v) * k; });
+            convert_blocked(vec.size(), [&](size_t begin, size_t count) {
+                u8_to_float(std::span(vec).subspan(begin, count),
+                    std::span(storage).subspan(begin, count), 1.0F / 255.0F);
+            });
             return { storage.data(), storage.size() };
 
         } else if constexpr (std::is_same_v<T, uint16_t>) {
             storage.resize(vec.size());
-            constexpr float k = 1.0F / 65535.0F;
-
-            std::transform(Parallel::par_unseq,
-                vec.begin(), vec.end(), storage.begin(),
-                [](uint16_t v) { return static_cast<float>(v) * k; });
+            convert_blocked(vec.size(), [&](size_t begin, size_t count) {
+                u16_to_float(std::span(vec).subspan(begin, count),
+                    std::span(storage).subspan(begin, count), 1.0F / 65535.0F);
+            });
             return { storage.data(), storage.size() };
 
         } else {
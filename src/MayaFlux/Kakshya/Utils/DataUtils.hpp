@@ -1,6 +1,7 @@
 #pragma once
 
 #include "MayaFlux/Kakshya/NDData/NDData.hpp"
+#include "MayaFlux/Kakshya/Utils/ConversionKernels.hpp"
 
 #include "MayaFlux/Journal/Archivist.hpp"
 
@@ -55,9 +56,23 @@ struct DataConverter<
         ComplexConversionStrategy = ComplexConversionStrategy::MAGNITUDE)
     {
         storage.resize(source.size());
-        std::transform(
-            source.begin(), source.end(), storage.begin(),
-            [](From val) { return static_cast<To>(val); });
+
+        using F = std::remove_const_t<From>;
+        if constexpr (std::is_same_v<F, float> && std::is_same_v<To, double>) {
+            widen_to_double(source, storage);
+        } else if constexpr (std::is_same_v<F, double> && std::is_same_v<To, float>) {
+            narrow_to_float(source, storage);
+        } else if constexpr (std::is_same_v<F, uint8_t> && std::is_same_v<To, float>) {
+            u8_to_float(source, storage);
+        } else if constexpr (std::is_same_v<F, uint16_t> && std::is_same_v<To, float>) {
+            u16_to_float(source, storage);
+        } else if constexpr (std::is_same_v<F, int16_t> && std::is_same_v<To, float>) {
+            i16_to_float(source, storage, 1.F);
+        } else {
+            std::transform(
+                source.begin(), source.end(), storage.begin(),
+                [](From val) { return static_cast<To>(val); });
+        }
 
         return std::span<To>(storage.data(), storage.size());
     }
@@ -77,6 +92,31 @@ struct DataConverter<
     {
         storage.resize(source.size());
 
+        using Real = typename std::remove_const_t<From>::value_type;
+        const bool kernel_strategy = strategy == ComplexConversionStrategy::MAGNITUDE
+            || strategy == ComplexConversionStrategy::SQUARED_MAGNITUDE;
+
+        if constexpr (std::is_same_v<Real, To> || (std::is_same_v<Real, float> && std::is_same_v<To, double>)) {
+            if (kernel_strategy) {
+                std::span<const std::complex<Real>> src(source.data(), source.size());
+
+                if constexpr (std::is_same_v<Real, To>) {
+                    if (strategy == ComplexConversionStrategy::MAGNITUDE)
+                        complex_magnitude(src, storage);
+                    else
+                        complex_squared_magnitude(src, storage);
+                } else {
+                    std::vector<float> real(source.size());
+                    if (strategy == ComplexConversionStrategy::MAGNITUDE)
+                        complex_magnitude(src, real);
+                    else
+                        complex_squared_magnitude(src, real);
+                    widen_to_double(real, storage);
+                }
+                return std::span<To>(storage.data(), storage.size());
+            }
+        }
+
         for (size_t i = 0; i < source.size(); ++i) {
             switch (strategy) {
             case ComplexConversionStrategy::MAGNITUDE:
@@ -411,23 +451,35 @@ std::span<T> convert_variant(DataVariant& variant,
         variant);
 }
 
+/**
+ * @brief Deleted: converting a const variant would replace storage the
+ *        caller still owns.
+ *
+ * Read a const variant through view_as() or convert_into() from
+ * VariantView.hpp, or pass a variant the caller is prepared to have
+ * converted in place.
+ */
 template <ProcessableData T>
 std::span<T> convert_variant(const DataVariant& variant,
     ComplexConversionStrategy strategy = ComplexConversionStrategy::MAGNITUDE)
-{
-    return convert_variant<T>(const_cast<DataVariant&>(variant), strategy);
-}
+    = delete;
 
+/**
+ * @brief convert_variant() applied to each variant in place
+ * @param variants Variants to convert; storage is replaced where T differs
+ * @param strategy Complex-to-real conversion strategy
+ * @return One span per variant into its (possibly converted) storage
+ */
 template <ProcessableData T>
 std::vector<std::span<T>> convert_variants(
-    const std::vector<DataVariant>& variants,
+    std::vector<DataVariant>& variants,
     ComplexConversionStrategy strategy = ComplexConversionStrategy::MAGNITUDE)
 {
     std::vector<std::span<T>> result;
     result.reserve(variants.size());
 
-    for (const auto& i : variants) {
-        result.push_back(convert_variant<T>(const_cast<DataVariant&>(i), strategy));
+    for (auto& variant : variants) {
+        result.push_back(convert_variant<T>(variant, strategy));
     }
     return result;
 }
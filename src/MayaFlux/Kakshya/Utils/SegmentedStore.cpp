@@ -0,0 +1,205 @@
+#include "SegmentedStore.hpp"
+
+namespace MayaFlux::Kakshya {
+
+namespace {
+    constexpr size_t k_min_directory_capacity = 16;
+}
+
+SegmentedStore::SegmentedStore(uint32_t num_channels, uint64_t segment_frames, bool interleaved)
+    : m_num_channels(std::max(num_channels, 1U))
+    , m_segment_frames(std::bit_ceil(std::max<uint64_t>(segment_frames, 1)))
+    , m_shift(static_cast<uint32_t>(std::countr_zero(m_segment_frames)))
+    , m_mask(m_segment_frames - 1)
+    , m_interleaved(interleaved)
+{
+}
+
+void SegmentedStore::reserve(uint64_t frames)
+{
+    const size_t needed = (frames + m_mask) >> m_shift;
+    size_t count = m_segment_count.load(std::memory_order_relaxed);
+    if (needed <= count)
+        return;
+
+    Directory* dir = m_directory.load(std::memory_order_relaxed);
+    if (!dir || needed > dir->capacity) {
+        size_t capacity = dir ? dir->capacity : k_min_directory_capacity;
+        while (capacity < needed)
+            capacity *= 2;
+
+        auto grown = std::make_unique<Directory>();
+        grown->capacity = capacity;
+        grown->segments = std::make_unique<double*[]>(capacity);
+        if (dir)
+            std::copy_n(dir->segments.get(), count, grown->segments.get());
+
+        dir = grown.get();
+        m_directories.push_back(std::move(grown));
+        m_directory.store(dir, std::memory_order_release);
+    }
+
+    const size_t segment_size = m_segment_frames * m_num_channels;
+    m_segments.reserve(needed);
+    for (; count < needed; ++count) {
+        m_segments.push_back(std::make_unique<double[]>(segment_size));
+        dir->segments[count] = m_segments.back().get();
+        m_segment_count.store(count + 1, std::memory_order_release);
+    }
+}
+
+double* SegmentedStore::segment_for(uint64_t frame) const
+{
+    const uint64_t index = frame >> m_shift;
+    if (index >= m_segment_count.load(std::memory_order_acquire))
+        return nullptr;
+    return m_directory.load(std::memory_order_acquire)->segments[index];
+}
+
+std::span<double* const> SegmentedStore::get_segment_table() const
+{
+    const size_t count = m_segment_count.load(std::memory_order_acquire);
+    if (count == 0)
+        return {};
+    return { m_directory.load(std::memory_order_acquire)->segments.get(), count };
+}
+
+uint64_t SegmentedStore::write(uint32_t channel, uint64_t start_frame, std::span<const double> data)
+{
+    if (channel >= m_num_channels)
+        return 0;
+
+    const uint64_t capacity = get_capacity();
+    if (start_frame >= capacity)
+        return 0;
+
+    const uint64_t frames = std::min<uint64_t>(data.size(), capacity - start_frame);
+
+    for (uint64_t done = 0; done < frames;) {
+        const uint64_t frame = start_frame + done;
+        double* segment = segment_for(frame);
+        const uint64_t run = std::min(frames - done, m_segment_frames - (frame & m_mask));
+
+        if (m_interleaved) {
+            double* dest = segment + offset_in_segment(channel, frame);
+            for (uint64_t i = 0; i < run; ++i)
+                dest[i * m_num_channels] = data[done + i];
+        } else {
+            std::copy_n(data.begin() + static_cast<std::ptrdiff_t>(done), run,
+                segment + offset_in_segment(channel, frame));
+        }
+        done += run;
+    }
+    return frames;
+}
+
+uint64_t SegmentedStore::write_interleaved(uint64_t start_frame, std::span<const double> data)
+{
+    const uint64_t capacity = get_capacity();
+    if (start_frame >= capacity)
+        return 0;
+
+    const uint64_t frames = std::min<uint64_t>(data.size() / m_num_channels, capacity - start_frame);
+
+    for (uint64_t done = 0; done < frames;) {
+        const uint64_t frame = start_frame + done;
+        double* segment = segment_for(frame);
+        const uint64_t run = std::min(frames - done, m_segment_frames - (frame & m_mask));
+        const double* src = data.data() + done * m_num_channels;
+
+        if (m_interleaved) {
+            std::copy_n(src, run * m_num_channels, segment + offset_in_segment(0, frame));
+        } else {
+            for (uint32_t ch = 0; ch < m_num_channels; ++ch) {
+                double* dest = segment + offset_in_segment(ch, frame);
+                for (uint64_t i = 0; i < run; ++i)
+                    dest[i] = src[i * m_num_channels + ch];
+            }
+        }
+        done += run;
+    }
+    return frames;
+}
+
+double SegmentedStore::sample(uint32_t channel, uint64_t frame) const
+{
+    if (channel >= m_num_channels)
+        return 0.0;
+    const double* segment = segment_for(frame);
+    return segment ? segment[offset_in_segment(channel, frame)] : 0.0;
+}
+
+void SegmentedStore::read(uint32_t channel, uint64_t start_frame, std::span<double> output) const
+{
+    if (channel >= m_num_channels) {
+        std::ranges::fill(output, 0.0);
+        return;
+    }
+
+    for (uint64_t done = 0; done < output.size();) {
+        const uint64_t frame = start_frame + done;
+        const uint64_t run = std::min<uint64_t>(output.size() - done, m_segment_frames - (frame & m_mask));
+        auto dest = output.subspan(done, run);
+
+        const double* segment = segment_for(frame);
+        if (!segment) {
+            std::ranges::fill(output.subspan(done), 0.0);
+            return;
+        }
+
+        const double* src = segment + offset_in_segment(channel, frame);
+        if (m_interleaved) {
+            for (uint64_t i = 0; i < run; ++i)
+                dest[i] = src[i * m_num_channels];
+        } else {
+            std::copy_n(src, run, dest.begin());
+        }
+        done += run;
+    }
+}
+
+std::span<const double> SegmentedStore::contiguous_run(uint32_t channel, uint64_t start_frame, uint64_t max_frames) const
+{
+    if (m_interleaved || channel >= m_num_channels)
+        return {};
+
+    const double* segment = segment_for(start_frame);
+    if (!segment)
+        return {};
+
+    const uint64_t run = std::min(max_frames, m_segment_frames - (start_frame & m_mask));
+    return { segment + offset_in_segment(channel, start_frame), run };
+}
+
+std::vector<DataVariant> SegmentedStore::materialize(uint64_t num_frames) const
+{
+    if (m_interleaved) {
+        std::vector<double> interleaved(num_frames * m_num_channels, 0.0);
+        const uint64_t available = std::min(num_frames, get_capacity());
+
+        for (uint64_t frame = 0; frame < available; frame += m_segment_frames) {
+            const uint64_t run = std::min(available - frame, m_segment_frames);
+            std::copy_n(segment_for(frame), run * m_num_channels,
+                interleaved.begin() + static_cast<std::ptrdiff_t>(frame * m_num_channels));
+        }
+        return { DataVariant(std::move(interleaved)) };
+    }
+
+    std::vector<DataVariant> channels;
+    channels.reserve(m_num_channels);
+    for (uint32_t ch = 0; ch < m_num_channels; ++ch) {
+        std::vector<double> samples(num_frames);
+        read(ch, 0, samples);
+        channels.emplace_back(std::move(samples));
+    }
+    return channels;
+}
+
+void SegmentedStore::clear()
+{
+    const size_t segment_size = m_segment_frames * m_num_channels;
+    for (auto& segment : m_segments)
+        std::fill_n(segment.get(), segment_size, 0.0);
+}
+
+} // namespace MayaFlux::Kakshya
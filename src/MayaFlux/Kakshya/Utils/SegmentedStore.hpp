@@ -0,0 +1,160 @@
+#pragma once
+
+#include "MayaFlux/Kakshya/NDData/NDData.hpp"
+
+/**
+ * @file SegmentedStore.hpp
+ * @brief Append-only multichannel sample storage in fixed-size segments.
+ *
+ * A growing std::vector moves every sample it holds each time it runs out
+ * of room. SegmentedStore instead allocates fixed-size segments and keeps a
+ * directory of segment pointers, so growing never touches existing samples
+ * and frame lookup stays O(1): the segment size is a power of two, and a
+ * frame resolves to a directory slot by shift and to an offset by mask.
+ *
+ * Each segment holds segment_frames frames of every channel, either
+ * channel-major (planar) or frame-major (interleaved), matching the owning
+ * container's OrganizationStrategy.
+ *
+ * The store has a single writer. Readers may run concurrently with reserve()
+ * and writes: a segment, once allocated, never moves, and a directory
+ * outgrown by reserve() is retired rather than freed, so a reader holding an
+ * older directory still dereferences valid memory. clear() zeroes samples in
+ * place and frees nothing, so it may run alongside readers too. Sample
+ * values are not synchronised here; owners pair the store with a Seqlock as
+ * they would a vector. Only destruction must wait for readers to drain.
+ */
+
+namespace MayaFlux::Kakshya {
+
+/**
+ * @class SegmentedStore
+ * @brief Multichannel double storage that grows by appending segments.
+ */
+class MAYAFLUX_API SegmentedStore {
+public:
+    /**
+     * @param num_channels   Channels stored per frame.
+     * @param segment_frames Frames per segment; rounded up to a power of two.
+     * @param interleaved    Frame-major segment layout instead of channel-major.
+     */
+    SegmentedStore(uint32_t num_channels, uint64_t segment_frames, bool interleaved);
+
+    SegmentedStore(const SegmentedStore&) = delete;
+    SegmentedStore& operator=(const SegmentedStore&) = delete;
+    SegmentedStore(SegmentedStore&&) = delete;
+    SegmentedStore& operator=(SegmentedStore&&) = delete;
+    ~SegmentedStore() = default;
+
+    [[nodiscard]] uint32_t get_num_channels() const { return m_num_channels; }
+    [[nodiscard]] uint64_t get_segment_frames() const { return m_segment_frames; }
+    [[nodiscard]] bool is_interleaved() const { return m_interleaved; }
+
+    /** @brief Number of allocated segments. Safe to call from readers. */
+    [[nodiscard]] size_t get_segment_count() const
+    {
+        return m_segment_count.load(std::memory_order_acquire);
+    }
+
+    /** @brief Frames addressable without further allocation. */
+    [[nodiscard]] uint64_t get_capacity() const { return get_segment_count() << m_shift; }
+
+    /**
+     * @brief Append zeroed segments until at least @p frames are addressable.
+     *
+     * Allocates only the missing segments; existing samples are not copied.
+     * Writer thread only.
+     */
+    void reserve(uint64_t frames);
+
+    /**
+     * @brief Write one channel starting at @p start_frame.
+     * @return Frames written; frames past get_capacity() are dropped.
+     */
+    uint64_t write(uint32_t channel, uint64_t start_frame, std::span<const double> data);
+
+    /**
+     * @brief Write whole interleaved frames starting at @p start_frame.
+     * @return Frames written; frames past get_capacity() are dropped.
+     */
+    uint64_t write_interleaved(uint64_t start_frame, std::span<const double> data);
+
+    /** @brief One sample, or 0.0 past get_capacity(). */
+    [[nodiscard]] double sample(uint32_t channel, uint64_t frame) const;
+
+    /**
+     * @brief Copy output.size() frames of one channel, zero-filling past get_capacity().
+     */
+    void read(uint32_t channel, uint64_t start_frame, std::span<double> output) const;
+
+    /**
+     * @brief Zero-copy view of one channel from @p start_frame to the end of its segment.
+     *
+     * Planar layout only. The view holds at most @p max_frames frames and is
+     * empty for interleaved layout or past get_capacity(). It stays valid
+     * for the lifetime of the store.
+     */
+    [[nodiscard]] std::span<const double> contiguous_run(uint32_t channel, uint64_t start_frame, uint64_t max_frames) const;
+
+    /**
+     * @brief Segment base pointers in frame order, for lock-free readers.
+     *
+     * Holds the segments allocated at the time of the call. Both the
+     * pointers and the table itself stay valid for the lifetime of the
+     * store, even after reserve() outgrows the table.
+     */
+    [[nodiscard]] std::span<double* const> get_segment_table() const;
+
+    /** @brief Position of @p channel's first frame within a segment. */
+    [[nodiscard]] size_t get_channel_offset(uint32_t channel) const { return offset_in_segment(channel, 0); }
+
+    /** @brief Distance between successive frames of one channel within a segment. */
+    [[nodiscard]] size_t get_frame_stride() const { return m_interleaved ? m_num_channels : 1; }
+
+    /**
+     * @brief Copy the first @p num_frames frames into contiguous storage.
+     * @return One vector per channel for planar layout, a single interleaved
+     *         vector otherwise.
+     */
+    [[nodiscard]] std::vector<DataVariant> materialize(uint64_t num_frames) const;
+
+    /**
+     * @brief Zero every allocated sample, keeping segments and capacity.
+     *
+     * Nothing is freed, so readers holding a segment or directory pointer
+     * stay valid; reserve() after clear() reuses the zeroed segments.
+     * Writer thread only.
+     */
+    void clear();
+
+private:
+    struct Directory {
+        size_t capacity {};
+        std::unique_ptr<double*[]> segments;
+    };
+
+    uint32_t m_num_channels;
+    uint64_t m_segment_frames;
+    uint32_t m_shift;
+    uint64_t m_mask;
+    bool m_interleaved;
+
+    std::vector<std::unique_ptr<double[]>> m_segments; ///< Owning storage, writer side
+    std::vector<std::unique_ptr<Directory>> m_directories; ///< Current is back(); the rest are retired
+
+    std::atomic<Directory*> m_directory { nullptr };
+    std::atomic<size_t> m_segment_count { 0 };
+
+    /** @brief Segment base for @p frame, or nullptr past get_capacity(). */
+    [[nodiscard]] double* segment_for(uint64_t frame) const;
+
+    [[nodiscard]] size_t offset_in_segment(uint32_t channel, uint64_t frame) const
+    {
+        const uint64_t local = frame & m_mask;
+        return m_interleaved
+            ? local * m_num_channels + channel
+            : static_cast<size_t>(channel) * m_segment_frames + local;
+    }
+};
+
+} // namespace MayaFlux::Kakshya
@@ -0,0 +1,232 @@
+#pragma once
+
+#include "DataUtils.hpp"
+
+/**
+ * @file VariantView.hpp
+ * @brief Non-mutating typed access to DataVariant storage.
+ *
+ * convert_variant<T>() replaces a variant's storage with a converted
+ * std::vector<T> whenever the element types differ. The functions here
+ * never touch the variant:
+ *
+ * - view_as<T>() returns a zero-copy span when the variant already holds T,
+ *   and otherwise converts into caller-owned storage.
+ * - VariantShadow<T> keeps one converted copy per source, stamped with a
+ *   caller-supplied version, and hands out VariantView<T> leases. A lease
+ *   keeps its buffer alive, so a concurrent reconversion after a version
+ *   bump allocates a fresh buffer instead of writing under a reader.
+ *
+ * Conversions go through convert_into(), which routes float <-> double,
+ * integer -> float and complex -> magnitude/power to ConversionKernels.
+ */
+
+namespace MayaFlux::Kakshya {
+
+/**
+ * @brief Convert the active alternative of @p variant into @p storage as T.
+ *
+ * Always writes @p storage, even when the variant already holds T; use
+ * view_as() to avoid that copy.
+ *
+ * @throws std::invalid_argument if no conversion exists to T.
+ */
+template <ProcessableData T>
+std::span<const T> convert_into(const DataVariant& variant,
+    std::vector<T>& storage,
+    ComplexConversionStrategy strategy = ComplexConversionStrategy::MAGNITUDE)
+{
+    return std::visit([&storage, strategy](const auto& vec) -> std::span<const T> {
+        using ValueType = typename std::decay_t<decltype(vec)>::value_type;
+
+        if constexpr (std::is_same_v<ValueType, T>) {
+            storage.assign(vec.begin(), vec.end());
+            return { storage.data(), storage.size() };
+        } else if constexpr (is_convertible_data_v<ValueType, T>) {
+            // DataConverter takes a mutable span but only reads from it.
+            std::span<ValueType> source(const_cast<ValueType*>(vec.data()), vec.size());
+            auto converted = convert_data(source, storage, strategy);
+            return { converted.data(), converted.size() };
+        } else {
+            error<std::invalid_argument>(
+                Journal::Component::Kakshya,
+                Journal::Context::Runtime,
+                std::source_location::current(),
+                "No conversion available from {} to {}",
+                typeid(ValueType).name(),
+                typeid(T).name());
+        }
+    },
+        variant);
+}
+
+/**
+ * @brief Read @p variant as T without modifying it.
+ * @param variant Source variant.
+ * @param storage Used only when a conversion is needed. Reuse it across
+ *                calls to avoid per-call allocation.
+ * @return Span into the variant when it already holds T, otherwise into
+ *         @p storage.
+ */
+template <ProcessableData T>
+std::span<const T> view_as(const DataVariant& variant,
+    std::vector<T>& storage,
+    ComplexConversionStrategy strategy = ComplexConversionStrategy::MAGNITUDE)
+{
+    if (const auto* vec = std::get_if<std::vector<T>>(&variant)) {
+        return { vec->data(), vec->size() };
+    }
+    return convert_into<T>(variant, storage, strategy);
+}
+
+/**
+ * @class VariantView
+ * @brief Read-only typed span that may own a lease on a converted buffer.
+ *
+ * Zero-copy views point straight into the variant and carry no lease; they
+ * are valid for as long as the variant's storage is. Converted views share
+ * ownership of their buffer and stay valid regardless of later conversions.
+ */
+template <ProcessableData T>
+class VariantView {
+public:
+    VariantView() = default;
+
+    explicit VariantView(std::span<const T> span, std::shared_ptr<const std::vector<T>> lease = {})
+        : m_span(span)
+        , m_lease(std::move(lease))
+    {
+    }
+
+    [[nodiscard]] std::span<const T> span() const { return m_span; }
+    [[nodiscard]] const T* data() const { return m_span.data(); }
+    [[nodiscard]] size_t size() const { return m_span.size(); }
+    [[nodiscard]] bool empty() const { return m_span.empty(); }
+    [[nodiscard]] auto begin() const { return m_span.begin(); }
+    [[nodiscard]] auto end() const { return m_span.end(); }
+    [[nodiscard]] const T& operator[](size_t i) const { return m_span[i]; }
+
+    /** @brief True when the view aliases the variant's own storage. */
+    [[nodiscard]] bool is_zero_copy() const { return !m_lease; }
+
+    operator std::span<const T>() const { return m_span; }
+
+private:
+    std::span<const T> m_span;
+    std::shared_ptr<const std::vector<T>> m_lease;
+};
+
+/**
+ * @class VariantShadow
+ * @brief Cached, version-stamped typed copy of one DataVariant.
+ *
+ * The owner bumps a version counter whenever it writes the source variant
+ * and passes that version to view(). The shadow reconverts only when the
+ * version, the active alternative, the source buffer or the complex
+ * strategy changed. When the previous buffer is still leased it is left to
+ * its readers and a new one is allocated; otherwise it is reused.
+ *
+ * view() is thread-safe. The source variant must not be written while
+ * view() runs; owners typically call it under their read lock.
+ */
+template <ProcessableData T>
+class VariantShadow {
+public:
+    VariantShadow() = default;
+
+    VariantShadow(VariantShadow&& other) noexcept
+    {
+        std::lock_guard lock(other.m_mutex);
+        m_buffer = std::move(other.m_buffer);
+        m_stamp = other.m_stamp;
+        m_conversions = other.m_conversions;
+    }
+
+    VariantShadow& operator=(VariantShadow&& other) noexcept
+    {
+        if (this != &other) {
+            std::scoped_lock lock(m_mutex, other.m_mutex);
+            m_buffer = std::move(other.m_buffer);
+            m_stamp = other.m_stamp;
+            m_conversions = other.m_conversions;
+        }
+        return *this;
+    }
+
+    VariantShadow(const VariantShadow&) = delete;
+    VariantShadow& operator=(const VariantShadow&) = delete;
+
+    /**
+     * @brief Typed view of @p variant, converting only if the stamp changed.
+     * @param variant  Source variant; never modified.
+     * @param version  Owner's write counter for @p variant.
+     * @param strategy Complex-to-real strategy.
+     */
+    VariantView<T> view(const DataVariant& variant,
+        uint64_t version,
+        ComplexConversionStrategy strategy = ComplexConversionStrategy::MAGNITUDE)
+    {
+        if (const auto* vec = std::get_if<std::vector<T>>(&variant)) {
+            return VariantView<T>({ vec->data(), vec->size() });
+        }
+
+        const Stamp stamp {
+            .version = version,
+            .source = std::visit([](const auto& v) -> const void* { return v.data(); }, variant),
+            .size = std::visit([](const auto& v) { return v.size(); }, variant),
+            .index = variant.index(),
+            .strategy = strategy,
+            .valid = true,
+        };
+
+        std::lock_guard lock(m_mutex);
+
+        if (m_buffer && m_stamp == stamp) {
+            return VariantView<T>({ m_buffer->data(), m_buffer->size() }, m_buffer);
+        }
+
+        if (!m_buffer || m_buffer.use_count() > 1) {
+            m_buffer = std::make_shared<std::vector<T>>();
+        }
+
+        convert_into<T>(variant, *m_buffer, strategy);
+        m_stamp = stamp;
+        ++m_conversions;
+
+        return VariantView<T>({ m_buffer->data(), m_buffer->size() }, m_buffer);
+    }
+
+    /** @brief Drop the cached copy; outstanding leases remain valid. */
+    void invalidate()
+    {
+        std::lock_guard lock(m_mutex);
+        m_buffer.reset();
+        m_stamp = {};
+    }
+
+    /** @brief Number of conversions performed since construction. */
+    [[nodiscard]] uint64_t conversions() const
+    {
+        std::lock_guard lock(m_mutex);
+        return m_conversions;
+    }
+
+private:
+    struct Stamp {
+        uint64_t version {};
+        const void* source {};
+        size_t size {};
+        size_t index {};
+        ComplexConversionStrategy strategy {};
+        bool valid {};
+
+        bool operator==(const Stamp&) const = default;
+    };
+
+    mutable std::mutex m_mutex;
+    std::shared_ptr<std::vector<T>> m_buffer;
+    Stamp m_stamp;
+    uint64_t m_conversions {};
+};
+
+} // namespace MayaFlux::Kakshya
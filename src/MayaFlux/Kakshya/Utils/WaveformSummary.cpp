@@ -0,0 +1,234 @@
+#include "WaveformSummary.hpp"
+
+#include "MayaFlux/Transitive/Parallel/Execution.hpp"
+
+namespace MayaFlux::Kakshya {
+
+namespace {
+    /** Bucket ranges at least this long are recomputed in parallel. */
+    constexpr size_t k_parallel_buckets = 512;
+
+    /** summarize() reads from a level about this many buckets finer than
+     *  a column, so aligning to the bucket grid widens each column by at
+     *  most an eighth of its width on either side. */
+    constexpr double k_buckets_per_column = 8.0;
+
+    template <typename Fn>
+    void for_buckets(size_t first, size_t last, Fn&& fn)
+    {
+        if (last - first < k_parallel_buckets) {
+            for (size_t i = first; i < last; ++i)
+                fn(i);
+            return;
+        }
+
+        std::vector<size_t> idx(last - first);
+        std::iota(idx.begin(), idx.end(), first);
+        Parallel::for_each(Parallel::par_unseq, idx.begin(), idx.end(), fn);
+    }
+
+    struct Extent {
+        double min;
+        double max;
+        double sum_sq;
+    };
+
+    Extent scan(std::span<const double> samples)
+    {
+        Extent e { .min = samples.front(), .max = samples.front(), .sum_sq = 0.0 };
+        for (double v : samples) {
+            e.min = std::min(e.min, v);
+            e.max = std::max(e.max, v);
+            e.sum_sq += v * v;
+        }
+        return e;
+    }
+}
+
+WaveformSummary::WaveformSummary(uint32_t base_bucket)
+    : m_base(std::bit_ceil(std::max(base_bucket, 1U)))
+    , m_shift(static_cast<uint32_t>(std::countr_zero(m_base)))
+{
+}
+
+uint64_t WaveformSummary::samples_in(size_t level, size_t index) const
+{
+    const uint64_t span = get_bucket_span(level);
+    const uint64_t start = index * span;
+    return start < m_sample_count ? std::min(span, m_sample_count - start) : 0;
+}
+
+WaveformSummary::Bucket WaveformSummary::bucket(size_t level, size_t index) const
+{
+    if (level >= m_levels.size() || index >= m_levels[level].size())
+        return {};
+
+    const auto& c = m_levels[level][index];
+    return {
+        .min = c.min,
+        .max = c.max,
+        .rms = std::sqrt(c.sum_sq / static_cast<float>(samples_in(level, index))),
+    };
+}
+
+void WaveformSummary::resize_levels()
+{
+    size_t count = (m_sample_count + m_base - 1) >> m_shift;
+    size_t level = 0;
+
+    while (count > 0) {
+        if (level == m_levels.size())
+            m_levels.emplace_back();
+        m_levels[level].resize(count);
+        ++level;
+        if (count == 1)
+            break;
+        count = (count + 1) / 2;
+    }
+    m_levels.resize(level);
+}
+
+void WaveformSummary::build(std::span<const double> series)
+{
+    clear();
+    update(series, 0, series.size());
+}
+
+void WaveformSummary::update(std::span<const double> series, uint64_t first, uint64_t count)
+{
+    const uint64_t n = series.size();
+    if (n < m_sample_count) {
+        clear();
+        first = 0;
+        count = n;
+    }
+
+    uint64_t begin = std::min(first, n);
+    uint64_t end = std::min(first + count, n);
+    if (n > m_sample_count) {
+        begin = std::min(begin, m_sample_count);
+        end = n;
+        m_sample_count = n;
+        resize_levels();
+    }
+
+    if (begin >= end)
+        return;
+
+    size_t lo = begin >> m_shift;
+    size_t hi = ((end - 1) >> m_shift) + 1;
+
+    auto& base = m_levels[0];
+    for_buckets(lo, hi, [&](size_t i) {
+        const auto e = scan(series.subspan(i << m_shift, samples_in(0, i)));
+        base[i] = {
+            .min = static_cast<float>(e.min),
+            .max = static_cast<float>(e.max),
+            .sum_sq = static_cast<float>(e.sum_sq),
+        };
+    });
+
+    for (size_t level = 1; level < m_levels.size(); ++level) {
+        lo >>= 1;
+        hi = ((hi - 1) >> 1) + 1;
+
+        const auto& children = m_levels[level - 1];
+        auto& cells = m_levels[level];
+        for_buckets(lo, hi, [&](size_t i) {
+            Cell c = children[2 * i];
+            if (2 * i + 1 < children.size()) {
+                const Cell& r = children[2 * i + 1];
+                c.min = std::min(c.min, r.min);
+                c.max = std::max(c.max, r.max);
+                c.sum_sq += r.sum_sq;
+            }
+            cells[i] = c;
+        });
+    }
+}
+
+size_t WaveformSummary::level_for(double samples_per_column) const
+{
+    if (m_levels.empty() || samples_per_column < static_cast<double>(m_base))
+        return 0;
+
+    const auto ratio = static_cast<uint64_t>(samples_per_column) >> m_shift;
+    const auto level = static_cast<size_t>(std::bit_width(ratio) - 1);
+    return std::min(level, m_levels.size() - 1);
+}
+
+void WaveformSummary::summarize(std::span<const double> series, uint64_t first, uint64_t count,
+    std::span<Bucket> columns) const
+{
+    if (columns.empty())
+        return;
+
+    first = std::min<uint64_t>(first, series.size());
+    count = std::min<uint64_t>(count, series.size() - first);
+
+    const double per_column = static_cast<double>(count) / static_cast<double>(columns.size());
+    if (m_levels.empty() || m_sample_count != series.size() || per_column < static_cast<double>(m_base)) {
+        reduce(series, first, count, columns);
+        return;
+    }
+
+    const size_t level = level_for(per_column / k_buckets_per_column);
+    const uint32_t shift = m_shift + static_cast<uint32_t>(level);
+    const auto& cells = m_levels[level];
+    const uint64_t n_cols = columns.size();
+
+    for (uint64_t col = 0; col < n_cols; ++col) {
+        const uint64_t s = first + col * count / n_cols;
+        const uint64_t e = first + (col + 1) * count / n_cols;
+
+        const size_t i0 = s >> shift;
+        const size_t i1 = (e - 1) >> shift;
+
+        Cell acc = cells[i0];
+        uint64_t samples = samples_in(level, i0);
+        for (size_t i = i0 + 1; i <= i1; ++i) {
+            acc.min = std::min(acc.min, cells[i].min);
+            acc.max = std::max(acc.max, cells[i].max);
+            acc.sum_sq += cells[i].sum_sq;
+            samples += samples_in(level, i);
+        }
+
+        columns[col] = {
+            .min = acc.min,
+            .max = acc.max,
+            .rms = std::sqrt(acc.sum_sq / static_cast<float>(samples)),
+        };
+    }
+}
+
+void WaveformSummary::reduce(std::span<const double> series, uint64_t first, uint64_t count,
+    std::span<Bucket> columns)
+{
+    first = std::min<uint64_t>(first, series.size());
+    count = std::min<uint64_t>(count, series.size() - first);
+
+    if (count == 0) {
+        std::ranges::fill(columns, Bucket {});
+        return;
+    }
+
+    const uint64_t n_cols = columns.size();
+    for (uint64_t col = 0; col < n_cols; ++col) {
+        const uint64_t s = first + col * count / n_cols;
+        const uint64_t e = std::max(first + (col + 1) * count / n_cols, s + 1);
+        const auto ext = scan(series.subspan(s, e - s));
+        columns[col] = {
+            .min = static_cast<float>(ext.min),
+            .max = static_cast<float>(ext.max),
+            .rms = static_cast<float>(std::sqrt(ext.sum_sq / static_cast<double>(e - s))),
+        };
+    }
+}
+
+void WaveformSummary::clear()
+{
+    m_sample_count = 0;
+    m_levels.clear();
+}
+
+} // namespace MayaFlux::Kakshya
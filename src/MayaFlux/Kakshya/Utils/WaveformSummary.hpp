@@ -0,0 +1,129 @@
+#pragma once
+
+/**
+ * @file WaveformSummary.hpp
+ * @brief Multi-resolution min/max/RMS pyramid over a scalar series.
+ *
+ * Drawing a long signal at screen resolution only needs the extremes of the
+ * samples that land in each pixel column. WaveformSummary stores those
+ * extremes, together with the sum of squares for RMS, in buckets at
+ * power-of-two decimation levels: level 0 buckets span base_bucket samples,
+ * level k buckets span base_bucket << k. A column that covers S samples is
+ * answered from the level whose bucket span is about S / 8, so it touches a
+ * bounded number of buckets regardless of series length.
+ *
+ * The summary does not own the samples. update() is told which sample range
+ * changed and recomputes only the buckets covering it plus their ancestors,
+ * so appending to a growing series costs O(appended + log n). Large ranges
+ * are reduced in parallel.
+ *
+ * Not synchronised: owners update and query from the same thread.
+ */
+
+namespace MayaFlux::Kakshya {
+
+/**
+ * @class WaveformSummary
+ * @brief Power-of-two bucket pyramid of min, max and RMS for one series.
+ */
+class MAYAFLUX_API WaveformSummary {
+public:
+    /**
+     * @struct Bucket
+     * @brief Reduced view of a sample range.
+     */
+    struct Bucket {
+        float min {};
+        float max {};
+        float rms {};
+    };
+
+    /**
+     * @param base_bucket Samples per level-0 bucket; rounded up to a power of two.
+     */
+    explicit WaveformSummary(uint32_t base_bucket = 256);
+
+    [[nodiscard]] uint32_t get_base_bucket() const { return m_base; }
+
+    /** @brief Length of the series the summary currently describes. */
+    [[nodiscard]] uint64_t get_sample_count() const { return m_sample_count; }
+
+    [[nodiscard]] size_t get_level_count() const { return m_levels.size(); }
+
+    /** @brief Samples covered by one bucket at @p level. */
+    [[nodiscard]] uint64_t get_bucket_span(size_t level) const { return uint64_t { m_base } << level; }
+
+    [[nodiscard]] size_t get_bucket_count(size_t level) const
+    {
+        return level < m_levels.size() ? m_levels[level].size() : 0;
+    }
+
+    /** @brief Bucket @p index at @p level. Zeroed when out of range. */
+    [[nodiscard]] Bucket bucket(size_t level, size_t index) const;
+
+    /**
+     * @brief Discard all buckets and summarise @p series from scratch.
+     */
+    void build(std::span<const double> series);
+
+    /**
+     * @brief Recompute the buckets covering samples [first, first + count).
+     *
+     * @p series is the full series after the change. When it is longer than
+     * get_sample_count() the appended tail is summarised as well; when it is
+     * shorter the summary is rebuilt.
+     */
+    void update(std::span<const double> series, uint64_t first, uint64_t count);
+
+    /**
+     * @brief Coarsest level whose bucket span does not exceed @p samples_per_column.
+     *
+     * Returns 0 when @p samples_per_column is below the base bucket.
+     */
+    [[nodiscard]] size_t level_for(double samples_per_column) const;
+
+    /**
+     * @brief Reduce samples [first, first + count) of @p series into columns.size() columns.
+     *
+     * Columns spanning at least one base bucket are answered from the
+     * pyramid at O(1) per column. Each column is widened to the bucket grid
+     * of a level roughly eight buckets finer than the column, so its extent
+     * may include up to an eighth of a column on either side (a full base
+     * bucket at the finest zoom). Finer columns, or a summary out of step
+     * with @p series, fall back to reduce().
+     */
+    void summarize(std::span<const double> series, uint64_t first, uint64_t count,
+        std::span<Bucket> columns) const;
+
+    /**
+     * @brief Reduce samples [first, first + count) of @p series into columns by scanning them.
+     *
+     * Exact, but O(count). Columns narrower than one sample repeat the
+     * sample they fall on.
+     */
+    static void reduce(std::span<const double> series, uint64_t first, uint64_t count,
+        std::span<Bucket> columns);
+
+    /** @brief Drop every level. */
+    void clear();
+
+private:
+    struct Cell {
+        float min {};
+        float max {};
+        float sum_sq {};
+    };
+
+    uint32_t m_base;
+    uint32_t m_shift;
+    uint64_t m_sample_count {};
+    std::vector<std::vector<Cell>> m_levels;
+
+    /** @brief Resize every level for m_sample_count, adding levels as needed. */
+    void resize_levels();
+
+    /** @brief Samples actually covered by bucket @p index at @p level. */
+    [[nodiscard]] uint64_t samples_in(size_t level, size_t index) const;
+};
+
+} // namespace MayaFlux::Kakshya
@@ -0,0 +1,424 @@
+#include "Features.hpp"
+#include "Analysis.hpp"
+
+#include "MayaFlux/Journal/Archivist.hpp"
+
+#include <unsupported/Eigen/FFT>
+
+namespace MayaFlux::Kinesis::Discrete {
+
+namespace {
+
+    constexpr double k_tau = 2.0 * std::numbers::pi;
+    constexpr double k_eps = 1e-20;
+
+    [[nodiscard]] double hz_to_mel(double hz) noexcept { return 2595.0 * std::log10(1.0 + hz / 700.0); }
+    [[nodiscard]] double mel_to_hz(double mel) noexcept { return 700.0 * (std::pow(10.0, mel / 2595.0) - 1.0); }
+
+    struct TableKey {
+        uint32_t window_size;
+        double sample_rate;
+        uint32_t mel_bands;
+        uint32_t mfcc_count;
+        double mel_min_hz;
+        double mel_max_hz;
+        double chroma_min_hz;
+        double chroma_max_hz;
+        double tuning_hz;
+
+        auto operator<=>(const TableKey&) const = default;
+    };
+
+} // namespace
+
+/**
+ * Filterbanks shared by every engine with the same framing and band setup.
+ */
+struct FeatureEngine::Tables {
+    struct Band {
+        uint32_t first_bin;
+        std::vector<double> weights;
+    };
+
+    std::vector<Band> mel; ///< Triangular, Slaney-style area normalised
+    std::vector<double> dct; ///< mfcc_count x mel_bands, orthonormal DCT-II
+    std::vector<int8_t> chroma_class; ///< Pitch class per bin, -1 outside range
+
+    static std::shared_ptr<const Tables> get(const TableKey& key)
+    {
+        static std::mutex s_mutex;
+        static std::map<TableKey, std::weak_ptr<const Tables>> s_cache;
+
+        std::lock_guard lock(s_mutex);
+        if (auto it = s_cache.find(key); it != s_cache.end()) {
+            if (auto tables = it->second.lock())
+                return tables;
+        }
+
+        auto tables = std::make_shared<Tables>();
+        tables->build(key);
+        s_cache[key] = tables;
+        return tables;
+    }
+
+    void build(const TableKey& key)
+    {
+        const uint32_t bins = key.window_size / 2 + 1;
+        const double bin_hz = key.sample_rate / key.window_size;
+
+        const double lo = hz_to_mel(key.mel_min_hz);
+        const double hi = hz_to_mel(key.mel_max_hz);
+        std::vector<double> edges(key.mel_bands + 2);
+        for (size_t i = 0; i < edges.size(); ++i)
+            edges[i] = mel_to_hz(lo + (hi - lo) * static_cast<double>(i) / static_cast<double>(key.mel_bands + 1));
+
+        mel.resize(key.mel_bands);
+        for (uint32_t m = 0; m < key.mel_bands; ++m) {
+            const double left = edges[m];
+            const double centre = edges[m + 1];
+            const double right = edges[m + 2];
+            const double norm = 2.0 / (right - left);
+
+            const auto first = static_cast<uint32_t>(std::ceil(left / bin_hz));
+            const auto last = std::min<uint32_t>(static_cast<uint32_t>(std::floor(right / bin_hz)), bins - 1);
+
+            auto& band = mel[m];
+            band.first_bin = first;
+            for (uint32_t b = first; b <= last && first <= last; ++b) {
+                const double f = b * bin_hz;
+                const double w = f <= centre ? (f - left) / (centre - left) : (right - f) / (right - centre);
+                band.weights.push_back(std::max(w, 0.0) * norm);
+            }
+        }
+
+        dct.resize(static_cast<size_t>(key.mfcc_count) * key.mel_bands);
+        const double scale0 = std::sqrt(1.0 / key.mel_bands);
+        const double scale = std::sqrt(2.0 / key.mel_bands);
+        for (uint32_t k = 0; k < key.mfcc_count; ++k) {
+            for (uint32_t m = 0; m < key.mel_bands; ++m) {
+                dct[k * key.mel_bands + m] = (k == 0 ? scale0 : scale)
+                    * std::cos(std::numbers::pi * k * (m + 0.5) / key.mel_bands);
+            }
+        }
+
+        chroma_class.assign(bins, -1);
+        const double c0 = key.tuning_hz * std::pow(2.0, -57.0 / 12.0); // C0 relative to A4
+        for (uint32_t b = 1; b < bins; ++b) {
+            const double f = b * bin_hz;
+            if (f < key.chroma_min_hz || f > key.chroma_max_hz)
+                continue;
+            const auto semitone = static_cast<long>(std::lround(12.0 * std::log2(f / c0)));
+            chroma_class[b] = static_cast<int8_t>(((semitone % 12) + 12) % 12);
+        }
+    }
+};
+
+struct FeatureEngine::Plan {
+    Eigen::FFT<double> fft;
+};
+
+// ============================================================================
+// FeatureTrack
+// ============================================================================
+
+std::vector<double> FeatureTrack::column(Descriptor d, size_t index) const
+{
+    std::vector<double> out(frames);
+    if (!layout.has(d) || index >= layout.width_of(d))
+        return out;
+
+    const size_t offset = layout.offset_of(d) + index;
+    for (size_t i = 0; i < frames; ++i)
+        out[i] = values[i * layout.stride + offset];
+    return out;
+}
+
+// ============================================================================
+// FeatureEngine
+// ============================================================================
+
+FeatureEngine::FeatureEngine(FeatureConfig config)
+    : m_config(std::move(config))
+    , m_plan(std::make_unique<Plan>())
+{
+    if (!std::has_single_bit(m_config.window_size) || m_config.window_size < 64) {
+        error<std::invalid_argument>(
+            Journal::Component::Kinesis,
+            Journal::Context::Configuration,
+            std::source_location::current(),
+            "FeatureEngine window size must be a power of 2 and at least 64, got {}",
+            m_config.window_size);
+    }
+
+    m_config.hop_size = std::clamp<uint32_t>(m_config.hop_size, 1, m_config.window_size);
+    if (m_config.mel_max_hz <= 0.0 || m_config.mel_max_hz > m_config.sample_rate * 0.5)
+        m_config.mel_max_hz = m_config.sample_rate * 0.5;
+    m_config.mel_bands = std::max<uint32_t>(m_config.mel_bands, 1);
+    m_config.mfcc_count = std::clamp<uint32_t>(m_config.mfcc_count, 1, m_config.mel_bands);
+
+    uint32_t offset = 0;
+    for (Descriptor d : m_config.descriptors) {
+        const auto i = static_cast<size_t>(d);
+        if (m_layout.width[i] != 0)
+            continue;
+
+        uint32_t width = 1;
+        if (d == Descriptor::MFCC)
+            width = m_config.mfcc_count;
+        else if (d == Descriptor::CHROMA)
+            width = 12;
+
+        m_layout.offset[i] = offset;
+        m_layout.width[i] = width;
+        offset += width;
+
+        if (d != Descriptor::RMS && d != Descriptor::ZERO_CROSSING_RATE)
+            m_needs_spectrum = true;
+    }
+    m_layout.stride = offset;
+
+    const uint32_t N = m_config.window_size;
+    const uint32_t bins = N / 2 + 1;
+
+    if (m_needs_spectrum) {
+        m_window.resize(N);
+        for (uint32_t i = 0; i < N; ++i)
+            m_window[i] = 0.5 * (1.0 - std::cos(k_tau * i / N));
+
+        m_frame.assign(N, 0.0);
+        m_spectrum.resize(bins);
+        m_magnitude.assign(bins, 0.0);
+        m_previous.assign(bins, 0.0);
+        m_log_magnitude.assign(bins, 0.0);
+        m_previous_log.assign(bins, 0.0);
+
+        if (m_layout.has(Descriptor::MFCC) || m_layout.has(Descriptor::CHROMA)) {
+            m_tables = Tables::get({ N, m_config.sample_rate, m_config.mel_bands, m_config.mfcc_count,
+                m_config.mel_min_hz, m_config.mel_max_hz, m_config.chroma_min_hz, m_config.chroma_max_hz,
+                m_config.tuning_hz });
+            m_mel.assign(m_config.mel_bands, 0.0);
+        }
+
+        m_plan->fft.SetFlag(Eigen::FFT<double>::HalfSpectrum);
+        m_plan->fft.fwd(m_spectrum, m_frame);
+    }
+
+    m_history.assign(N, 0.0);
+    m_latest.assign(m_layout.stride, 0.0);
+}
+
+FeatureEngine::~FeatureEngine() = default;
+FeatureEngine::FeatureEngine(FeatureEngine&&) noexcept = default;
+FeatureEngine& FeatureEngine::operator=(FeatureEngine&&) noexcept = default;
+
+void FeatureEngine::reset()
+{
+    std::ranges::fill(m_history, 0.0);
+    std::ranges::fill(m_latest, 0.0);
+    m_fill = 0;
+    m_has_previous = false;
+}
+
+void FeatureEngine::analyze_frame(std::span<const double> frame, std::span<double> out)
+{
+    const uint32_t N = m_config.window_size;
+    const auto& L = m_layout;
+
+    if (L.has(Descriptor::RMS)) {
+        double sum = 0.0;
+        for (double v : frame)
+            sum += v * v;
+        out[L.offset_of(Descriptor::RMS)] = std::sqrt(sum / N);
+    }
+
+    if (L.has(Descriptor::ZERO_CROSSING_RATE)) {
+        uint32_t crossings = 0;
+        for (uint32_t i = 1; i < N; ++i)
+            crossings += (frame[i - 1] >= 0.0) != (frame[i] >= 0.0);
+        out[L.offset_of(Descriptor::ZERO_CROSSING_RATE)] = static_cast<double>(crossings) / (N - 1);
+    }
+
+    if (!m_needs_spectrum)
+        return;
+
+    for (uint32_t i = 0; i < N; ++i)
+        m_frame[i] = frame[i] * m_window[i];
+
+    m_plan->fft.fwd(m_spectrum, m_frame);
+
+    const size_t bins = m_spectrum.size();
+    const double bin_hz = m_config.sample_rate / N;
+    const double gain = 4.0 / N;
+
+    double magnitude_sum = 0.0;
+    double weighted_sum = 0.0;
+    double power_sum = 0.0;
+    double log_power_sum = 0.0;
+
+    for (size_t b = 0; b < bins; ++b) {
+        const double m = std::abs(m_spectrum[b]) * gain;
+        m_magnitude[b] = m;
+        magnitude_sum += m;
+        weighted_sum += m * b;
+        power_sum += m * m;
+        log_power_sum += std::log(m * m + k_eps);
+    }
+
+    const double centroid_bins = magnitude_sum > k_eps ? weighted_sum / magnitude_sum : 0.0;
+
+    if (L.has(Descriptor::CENTROID))
+        out[L.offset_of(Descriptor::CENTROID)] = centroid_bins * bin_hz;
+
+    if (L.has(Descriptor::SPREAD)) {
+        double spread = 0.0;
+        if (magnitude_sum > k_eps) {
+            for (size_t b = 0; b < bins; ++b) {
+                const double d = static_cast<double>(b) - centroid_bins;
+                spread += d * d * m_magnitude[b];
+            }
+            spread = std::sqrt(spread / magnitude_sum);
+        }
+        out[L.offset_of(Descriptor::SPREAD)] = spread * bin_hz;
+    }
+
+    if (L.has(Descriptor::FLATNESS)) {
+        const double arithmetic = power_sum / bins;
+        const double geometric = std::exp(log_power_sum / bins);
+        out[L.offset_of(Descriptor::FLATNESS)] = arithmetic > k_eps ? geometric / arithmetic : 0.0;
+    }
+
+    if (L.has(Descriptor::ROLLOFF)) {
+        const double target = power_sum * m_config.rolloff_fraction;
+        double cumulative = 0.0;
+        size_t b = 0;
+        for (; b < bins; ++b) {
+            cumulative += m_magnitude[b] * m_magnitude[b];
+            if (cumulative >= target)
+                break;
+        }
+        out[L.offset_of(Descriptor::ROLLOFF)] = power_sum > k_eps ? std::min(b, bins - 1) * bin_hz : 0.0;
+    }
+
+    if (L.has(Descriptor::FLUX)) {
+        double flux = 0.0;
+        if (m_has_previous) {
+            for (size_t b = 0; b < bins; ++b) {
+                const double d = m_magnitude[b] - m_previous[b];
+                if (d > 0.0)
+                    flux += d * d;
+            }
+        }
+        out[L.offset_of(Descriptor::FLUX)] = std::sqrt(flux);
+    }
+
+    if (L.has(Descriptor::ONSET_STRENGTH)) {
+        constexpr double compression = 100.0;
+        double onset = 0.0;
+        for (size_t b = 0; b < bins; ++b) {
+            m_log_magnitude[b] = std::log1p(compression * m_magnitude[b]);
+            if (m_has_previous)
+                onset += std::max(m_log_magnitude[b] - m_previous_log[b], 0.0);
+        }
+        out[L.offset_of(Descriptor::ONSET_STRENGTH)] = onset / bins;
+        std::swap(m_log_magnitude, m_previous_log);
+    }
+
+    if (L.has(Descriptor::MFCC)) {
+        const auto& tables = *m_tables;
+        for (size_t m = 0; m < tables.mel.size(); ++m) {
+            const auto& band = tables.mel[m];
+            double energy = 0.0;
+            for (size_t k = 0; k < band.weights.size(); ++k) {
+                const double mag = m_magnitude[band.first_bin + k];
+                energy += band.weights[k] * mag * mag;
+            }
+            m_mel[m] = std::log(energy + 1e-10);
+        }
+
+        const size_t bands = m_mel.size();
+        double* mfcc = out.data() + L.offset_of(Descriptor::MFCC);
+        for (uint32_t k = 0; k < m_config.mfcc_count; ++k) {
+            const double* row = tables.dct.data() + k * bands;
+            double sum = 0.0;
+            for (size_t m = 0; m < bands; ++m)
+                sum += row[m] * m_mel[m];
+            mfcc[k] = sum;
+        }
+    }
+
+    if (L.has(Descriptor::CHROMA)) {
+        double* chroma = out.data() + L.offset_of(Descriptor::CHROMA);
+        std::fill_n(chroma, 12, 0.0);
+        const auto& classes = m_tables->chroma_class;
+        for (size_t b = 0; b < bins; ++b) {
+            if (classes[b] >= 0)
+                chroma[classes[b]] += m_magnitude[b] * m_magnitude[b];
+        }
+        const double peak = *std::max_element(chroma, chroma + 12);
+        if (peak > k_eps) {
+            for (int c = 0; c < 12; ++c)
+                chroma[c] /= peak;
+        }
+    }
+
+    std::swap(m_magnitude, m_previous);
+    m_has_previous = true;
+}
+
+FeatureTrack FeatureEngine::analyze(std::span<const double> data, size_t stride)
+{
+    reset();
+
+    const uint32_t N = m_config.window_size;
+    const uint32_t H = m_config.hop_size;
+    stride = std::max<size_t>(stride, 1);
+    const size_t samples = (data.size() + stride - 1) / stride;
+
+    FeatureTrack track;
+    track.layout = m_layout;
+    track.hop_size = H;
+    track.sample_rate = m_config.sample_rate;
+    track.frames = std::max<size_t>(num_windows(samples, N, H), samples > 0 ? 1 : 0);
+    track.values.assign(track.frames * m_layout.stride, 0.0);
+
+    std::vector<double> frame(N, 0.0);
+    for (size_t f = 0; f < track.frames; ++f) {
+        const size_t start = f * H;
+        for (uint32_t k = 0; k < N; ++k) {
+            const size_t i = start + k;
+            frame[k] = i < samples ? data[i * stride] : 0.0;
+        }
+        analyze_frame(frame, std::span(track.values).subspan(f * m_layout.stride, m_layout.stride));
+    }
+
+    return track;
+}
+
+size_t FeatureEngine::process(std::span<const double> block,
+    const std::function<void(std::span<const double>)>& on_frame)
+{
+    const uint32_t N = m_config.window_size;
+    const uint32_t H = m_config.hop_size;
+    double* newest = m_history.data() + (N - H);
+
+    size_t frames = 0;
+    size_t i = 0;
+    while (i < block.size()) {
+        const auto n = static_cast<uint32_t>(std::min<size_t>(H - m_fill, block.size() - i));
+        std::copy_n(block.begin() + static_cast<std::ptrdiff_t>(i), n, newest + m_fill);
+        m_fill += n;
+        i += n;
+
+        if (m_fill == H) {
+            analyze_frame(m_history, m_latest);
+            if (on_frame)
+                on_frame(m_latest);
+            std::copy(m_history.begin() + H, m_history.end(), m_history.begin());
+            m_fill = 0;
+            ++frames;
+        }
+    }
+    return frames;
+}
+
+} // namespace MayaFlux::Kinesis::Discrete
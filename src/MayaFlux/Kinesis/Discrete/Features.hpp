@@ -0,0 +1,198 @@
+#pragma once
+
+/**
+ * @file Features.hpp
+ * @brief Single-pass multi-descriptor feature extraction
+ *
+ * FeatureEngine computes any subset of the descriptors below from one
+ * shared windowed FFT per hop. The time-domain descriptors (RMS, zero
+ * crossing rate) read the same frame, so asking for ten descriptors costs
+ * one window pass, one FFT and one magnitude pass, plus a cheap reduction
+ * per descriptor.
+ *
+ * Mel, DCT and chroma tables depend only on the configuration and are
+ * shared between engines through a process-wide cache.
+ *
+ * Spectral magnitudes are normalised by the Hann window gain, so a full
+ * scale sinusoid has magnitude 1 in its peak bin independent of window
+ * size. Frequencies are reported in Hz.
+ *
+ * Eigen FFT dependency is confined to the .cpp translation unit.
+ */
+
+namespace MayaFlux::Kinesis::Discrete {
+
+/**
+ * @enum Descriptor
+ * @brief Per-frame features produced by FeatureEngine
+ */
+enum class Descriptor : uint8_t {
+    RMS, ///< Root mean square of the unwindowed frame
+    ZERO_CROSSING_RATE, ///< Sign changes per sample
+    CENTROID, ///< Magnitude-weighted mean frequency (Hz)
+    SPREAD, ///< Magnitude-weighted standard deviation around the centroid (Hz)
+    FLATNESS, ///< Geometric / arithmetic mean of the power spectrum, 0..1
+    ROLLOFF, ///< Frequency below which rolloff_fraction of the power lies (Hz)
+    FLUX, ///< L2 norm of the positive magnitude change since the previous frame
+    ONSET_STRENGTH, ///< Mean positive log-magnitude change since the previous frame
+    MFCC, ///< mfcc_count mel-frequency cepstral coefficients
+    CHROMA ///< 12 pitch-class energies (C first), peak-normalised
+};
+
+inline constexpr size_t DESCRIPTOR_COUNT = 10;
+
+/**
+ * @struct FeatureConfig
+ * @brief What to extract and how to frame the signal
+ */
+struct FeatureConfig {
+    std::vector<Descriptor> descriptors { Descriptor::RMS, Descriptor::CENTROID, Descriptor::FLUX };
+
+    uint32_t window_size { 2048 }; ///< FFT frame size, power of 2
+    uint32_t hop_size { 512 };
+    double sample_rate { 48000.0 };
+
+    double rolloff_fraction { 0.85 };
+
+    uint32_t mel_bands { 40 };
+    uint32_t mfcc_count { 13 };
+    double mel_min_hz { 20.0 };
+    double mel_max_hz {}; ///< 0 uses Nyquist
+
+    double chroma_min_hz { 55.0 };
+    double chroma_max_hz { 5000.0 };
+    double tuning_hz { 440.0 }; ///< Frequency of A4
+};
+
+/**
+ * @struct FeatureLayout
+ * @brief Position of each descriptor inside one output frame
+ *
+ * A frame is a flat row of @c stride doubles. Descriptors appear in the
+ * order they were requested; absent descriptors have width 0.
+ */
+struct FeatureLayout {
+    std::array<uint32_t, DESCRIPTOR_COUNT> offset {};
+    std::array<uint32_t, DESCRIPTOR_COUNT> width {};
+    uint32_t stride {};
+
+    [[nodiscard]] bool has(Descriptor d) const noexcept { return width[static_cast<size_t>(d)] != 0; }
+    [[nodiscard]] uint32_t offset_of(Descriptor d) const noexcept { return offset[static_cast<size_t>(d)]; }
+    [[nodiscard]] uint32_t width_of(Descriptor d) const noexcept { return width[static_cast<size_t>(d)]; }
+};
+
+/**
+ * @struct FeatureTrack
+ * @brief Offline result: one row per hop
+ */
+struct FeatureTrack {
+    FeatureLayout layout;
+    uint32_t hop_size {};
+    double sample_rate {};
+    size_t frames {};
+    std::vector<double> values; ///< frames x layout.stride, row-major
+
+    [[nodiscard]] std::span<const double> frame(size_t i) const
+    {
+        return { values.data() + i * layout.stride, layout.stride };
+    }
+
+    [[nodiscard]] double value(size_t frame, Descriptor d, size_t index = 0) const
+    {
+        return values[frame * layout.stride + layout.offset_of(d) + index];
+    }
+
+    /// @brief One descriptor component over time.
+    [[nodiscard]] MAYAFLUX_API std::vector<double> column(Descriptor d, size_t index = 0) const;
+
+    /// @brief Time in seconds of the centre of frame @p i.
+    [[nodiscard]] double time_of(size_t i, uint32_t window_size) const
+    {
+        return (static_cast<double>(i * hop_size) + 0.5 * window_size) / sample_rate;
+    }
+};
+
+/**
+ * @class FeatureEngine
+ * @brief Shared-FFT descriptor extractor for offline and streaming use
+ *
+ * Offline: analyze() frames a whole span (optionally strided, for
+ * interleaved data) and returns a FeatureTrack.
+ *
+ * Streaming: process() accepts blocks of any size, emits one frame every
+ * hop over the most recent window_size samples, and never allocates. Not
+ * thread-safe; one engine per channel.
+ */
+class MAYAFLUX_API FeatureEngine {
+public:
+    explicit FeatureEngine(FeatureConfig config = {});
+    ~FeatureEngine();
+
+    FeatureEngine(const FeatureEngine&) = delete;
+    FeatureEngine& operator=(const FeatureEngine&) = delete;
+    FeatureEngine(FeatureEngine&&) noexcept;
+    FeatureEngine& operator=(FeatureEngine&&) noexcept;
+
+    [[nodiscard]] const FeatureConfig& config() const noexcept { return m_config; }
+    [[nodiscard]] const FeatureLayout& layout() const noexcept { return m_layout; }
+
+    /**
+     * @brief Compute all descriptors for one frame
+     * @param frame window_size samples
+     * @param out   layout().stride values
+     *
+     * Flux and onset strength compare against the previous call.
+     */
+    void analyze_frame(std::span<const double> frame, std::span<double> out);
+
+    /**
+     * @brief Frame and analyse a complete signal
+     * @param data   Samples; frame i of the signal is data[i * stride]
+     * @param stride Distance between successive samples
+     *
+     * Resets history first. Produces num_windows() frames; a signal shorter
+     * than one window yields a single zero-padded frame.
+     */
+    [[nodiscard]] FeatureTrack analyze(std::span<const double> data, size_t stride = 1);
+
+    /**
+     * @brief Streaming entry point
+     * @param block    Next input samples
+     * @param on_frame Called with each completed frame's descriptors
+     * @return Frames emitted during this call
+     */
+    size_t process(std::span<const double> block,
+        const std::function<void(std::span<const double>)>& on_frame = {});
+
+    /// @brief Descriptors of the most recent frame.
+    [[nodiscard]] std::span<const double> latest() const noexcept { return m_latest; }
+
+    /// @brief Clear streaming input and flux history.
+    void reset();
+
+private:
+    struct Tables;
+    struct Plan;
+
+    FeatureConfig m_config;
+    FeatureLayout m_layout;
+    std::shared_ptr<const Tables> m_tables;
+    std::unique_ptr<Plan> m_plan;
+    bool m_needs_spectrum {};
+
+    std::vector<double> m_window;
+    std::vector<double> m_frame; ///< Windowed FFT input
+    std::vector<std::complex<double>> m_spectrum;
+    std::vector<double> m_magnitude;
+    std::vector<double> m_previous;
+    std::vector<double> m_log_magnitude;
+    std::vector<double> m_previous_log;
+    std::vector<double> m_mel;
+    bool m_has_previous {};
+
+    std::vector<double> m_history; ///< Streaming input, last window_size samples
+    uint32_t m_fill {};
+    std::vector<double> m_latest;
+};
+
+} // namespace MayaFlux::Kinesis::Discrete
@@ -0,0 +1,260 @@
+#include "SpectralStream.hpp"
+
+#include "MayaFlux/Journal/Archivist.hpp"
+
+#include <unsupported/Eigen/FFT>
+
+namespace MayaFlux::Kinesis::Discrete {
+
+namespace {
+
+    constexpr double k_pi = std::numbers::pi;
+    constexpr double k_tau = 2.0 * std::numbers::pi;
+
+    [[nodiscard]] inline double wrap_phase(double p) noexcept
+    {
+        p -= k_tau * std::floor((p + k_pi) / k_tau);
+        return p;
+    }
+
+} // namespace
+
+std::vector<double> spectral_window(SpectralWindow shape, uint32_t n)
+{
+    std::vector<double> w;
+    switch (shape) {
+    case SpectralWindow::HAMMING:
+        w = hamming(n + 1);
+        break;
+    case SpectralWindow::BLACKMAN:
+        w = blackman(n + 1);
+        break;
+    case SpectralWindow::HANN:
+    default:
+        w = hann(n + 1);
+        break;
+    }
+    w.pop_back();
+    return w;
+}
+
+// ============================================================================
+// StreamingSTFT
+// ============================================================================
+
+struct StreamingSTFT::Plan {
+    Eigen::FFT<double> fft;
+};
+
+StreamingSTFT::StreamingSTFT(uint32_t window_size, uint32_t hop_size, SpectralWindow window)
+    : m_window_size(std::max<uint32_t>(window_size, 64))
+    , m_hop_size(std::clamp<uint32_t>(hop_size, 1, m_window_size))
+    , m_window_shape(window)
+    , m_window(spectral_window(window, m_window_size))
+    , m_inv_norm(m_hop_size)
+    , m_input(m_window_size, 0.0)
+    , m_accum(m_window_size, 0.0)
+    , m_output(m_hop_size, 0.0)
+    , m_frame(m_window_size, 0.0)
+    , m_spectrum(bin_count())
+    , m_plan(std::make_unique<Plan>())
+{
+    if (!std::has_single_bit(window_size) || window_size < 64) {
+        error<std::invalid_argument>(
+            Journal::Component::Kinesis,
+            Journal::Context::Configuration,
+            std::source_location::current(),
+            "StreamingSTFT window size must be a power of 2 and at least 64, got {}",
+            window_size);
+    }
+    if (hop_size == 0 || window_size % hop_size != 0) {
+        error<std::invalid_argument>(
+            Journal::Component::Kinesis,
+            Journal::Context::Configuration,
+            std::source_location::current(),
+            "StreamingSTFT hop size {} must divide the window size {}",
+            hop_size, window_size);
+    }
+
+    for (uint32_t k = 0; k < m_hop_size; ++k) {
+        double sum = 0.0;
+        for (uint32_t j = k; j < m_window_size; j += m_hop_size)
+            sum += m_window[j] * m_window[j];
+        m_inv_norm[k] = sum > 1e-10 ? 1.0 / sum : 0.0;
+    }
+
+    // Twiddles and scratch are built lazily by Eigen; do it here, not on the first hop.
+    m_plan->fft.SetFlag(Eigen::FFT<double>::HalfSpectrum);
+    m_plan->fft.fwd(m_spectrum, m_frame);
+    m_plan->fft.inv(m_frame, m_spectrum, m_window_size);
+    std::ranges::fill(m_frame, 0.0);
+}
+
+StreamingSTFT::~StreamingSTFT() = default;
+StreamingSTFT::StreamingSTFT(StreamingSTFT&&) noexcept = default;
+StreamingSTFT& StreamingSTFT::operator=(StreamingSTFT&&) noexcept = default;
+
+void StreamingSTFT::reset()
+{
+    std::ranges::fill(m_input, 0.0);
+    std::ranges::fill(m_accum, 0.0);
+    std::ranges::fill(m_output, 0.0);
+    m_fill = 0;
+    m_frame_index = 0;
+}
+
+void StreamingSTFT::process(std::span<double> io, const SpectrumProcessor& processor)
+{
+    const uint32_t N = m_window_size;
+    const uint32_t H = m_hop_size;
+    double* newest = m_input.data() + (N - H);
+
+    size_t i = 0;
+    while (i < io.size()) {
+        const auto n = static_cast<uint32_t>(std::min<size_t>(H - m_fill, io.size() - i));
+
+        for (uint32_t k = 0; k < n; ++k) {
+            newest[m_fill + k] = io[i + k];
+            io[i + k] = m_output[m_fill + k];
+        }
+
+        m_fill += n;
+        i += n;
+
+        if (m_fill == H) {
+            run_frame(processor);
+            m_fill = 0;
+        }
+    }
+}
+
+void StreamingSTFT::run_frame(const SpectrumProcessor& processor)
+{
+    const uint32_t N = m_window_size;
+    const uint32_t H = m_hop_size;
+
+    for (uint32_t k = 0; k < N; ++k)
+        m_frame[k] = m_input[k] * m_window[k];
+
+    m_plan->fft.fwd(m_spectrum, m_frame);
+
+    if (processor)
+        processor(m_spectrum, m_frame_index);
+
+    m_plan->fft.inv(m_frame, m_spectrum, N);
+
+    for (uint32_t k = 0; k < N; ++k)
+        m_accum[k] += m_frame[k] * m_window[k];
+
+    for (uint32_t k = 0; k < H; ++k)
+        m_output[k] = m_accum[k] * m_inv_norm[k];
+
+    std::copy(m_accum.begin() + H, m_accum.end(), m_accum.begin());
+    std::fill(m_accum.end() - H, m_accum.end(), 0.0);
+    std::copy(m_input.begin() + H, m_input.end(), m_input.begin());
+
+    ++m_frame_index;
+}
+
+// ============================================================================
+// StreamingPitchShift
+// ============================================================================
+
+StreamingPitchShift::StreamingPitchShift(double semitones, uint32_t window_size, uint32_t hop_size)
+    : m_ratio(std::pow(2.0, semitones / 12.0))
+    , m_expected(k_tau * static_cast<double>(hop_size) / static_cast<double>(window_size))
+    , m_last_phase(window_size / 2 + 1, 0.0)
+    , m_sum_phase(window_size / 2 + 1, 0.0)
+    , m_synth_magnitude(window_size / 2 + 1, 0.0)
+    , m_synth_frequency(window_size / 2 + 1, 0.0)
+{
+}
+
+void StreamingPitchShift::set_semitones(double semitones) noexcept
+{
+    m_ratio.store(std::pow(2.0, semitones / 12.0), std::memory_order_relaxed);
+}
+
+double StreamingPitchShift::get_semitones() const noexcept
+{
+    return 12.0 * std::log2(m_ratio.load(std::memory_order_relaxed));
+}
+
+void StreamingPitchShift::reset()
+{
+    std::ranges::fill(m_last_phase, 0.0);
+    std::ranges::fill(m_sum_phase, 0.0);
+}
+
+void StreamingPitchShift::operator()(std::vector<std::complex<double>>& spectrum, size_t /*frame*/)
+{
+    const size_t bins = std::min(spectrum.size(), m_last_phase.size());
+    const double ratio = m_ratio.load(std::memory_order_relaxed);
+
+    std::fill_n(m_synth_magnitude.begin(), bins, 0.0);
+    std::fill_n(m_synth_frequency.begin(), bins, 0.0);
+
+    // Analysis: true frequency of each bin in units of bin index.
+    for (size_t b = 0; b < bins; ++b) {
+        const double magnitude = std::abs(spectrum[b]);
+        const double phase = std::arg(spectrum[b]);
+        const double expected = m_expected * static_cast<double>(b);
+        const double deviation = wrap_phase(phase - m_last_phase[b] - expected);
+        m_last_phase[b] = phase;
+
+        const auto target = static_cast<size_t>(std::lround(static_cast<double>(b) * ratio));
+        if (target < bins) {
+            const double frequency = static_cast<double>(b) + deviation / m_expected;
+            // Keep the stronger contributor's frequency when bins collide.
+            if (magnitude > m_synth_magnitude[target])
+                m_synth_frequency[target] = frequency * ratio;
+            m_synth_magnitude[target] += magnitude;
+        }
+    }
+
+    // Synthesis: advance each bin's phase by its shifted frequency.
+    for (size_t b = 0; b < bins; ++b) {
+        m_sum_phase[b] = wrap_phase(m_sum_phase[b] + m_expected * m_synth_frequency[b]);
+        spectrum[b] = std::polar(m_synth_magnitude[b], m_sum_phase[b]);
+    }
+}
+
+// ============================================================================
+// StreamingSpectralGate
+// ============================================================================
+
+StreamingSpectralGate::StreamingSpectralGate(double threshold_db, uint32_t window_size, SpectralWindow window)
+    : m_threshold_db(threshold_db)
+    , m_threshold(0.0)
+    , m_window_gain(0.0)
+{
+    for (double w : spectral_window(window, window_size))
+        m_window_gain += w;
+    m_window_gain *= 0.5;
+
+    set_threshold_db(threshold_db);
+}
+
+void StreamingSpectralGate::set_threshold_db(double threshold_db) noexcept
+{
+    m_threshold_db.store(threshold_db, std::memory_order_relaxed);
+    m_threshold.store(std::pow(10.0, threshold_db / 20.0) * m_window_gain, std::memory_order_relaxed);
+}
+
+double StreamingSpectralGate::get_threshold_db() const noexcept
+{
+    return m_threshold_db.load(std::memory_order_relaxed);
+}
+
+void StreamingSpectralGate::operator()(std::vector<std::complex<double>>& spectrum, size_t /*frame*/) const
+{
+    const double threshold = m_threshold.load(std::memory_order_relaxed);
+    const double threshold_sq = threshold * threshold;
+
+    for (auto& bin : spectrum) {
+        if (std::norm(bin) < threshold_sq)
+            bin = {};
+    }
+}
+
+} // namespace MayaFlux::Kinesis::Discrete
@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Spectral.hpp"
+#include "Taper.hpp"
+
+/**
+ * @file SpectralStream.hpp
+ * @brief Realtime, block-based counterpart of apply_spectral()
+ *
+ * StreamingSTFT consumes arbitrary-sized blocks, runs a SpectrumProcessor
+ * once per hop and overlap-adds the resynthesised frames. Every buffer
+ * (input FIFO, output accumulator, FFT scratch and the one-sided spectrum
+ * handed to the processor) is allocated at construction, so process()
+ * never allocates and its cost per hop is fixed.
+ *
+ * Analysis and synthesis use the same periodic window (Hann by default, see
+ * SpectralWindow). The synthesis output is divided by the hop-periodic sum
+ * of squared windows, which makes reconstruction exact for any hop that
+ * divides the window size.
+ *
+ * The engine introduces a fixed delay of window_size samples, reported by
+ * latency(). A sample is complete only after the last frame overlapping it
+ * has been synthesised, so the delay does not depend on how the caller
+ * blocks its input.
+ */
+
+namespace MayaFlux::Kinesis::Discrete {
+
+/**
+ * @enum SpectralWindow
+ * @brief Analysis/synthesis window shape for StreamingSTFT
+ */
+enum class SpectralWindow : uint8_t {
+    HANN, ///< Good default; 75% overlap recommended
+    HAMMING, ///< Lower first sidelobe, non-zero edges
+    BLACKMAN, ///< Lowest leakage, widest main lobe
+};
+
+/**
+ * @brief Periodic form of the Taper.hpp coefficients for @p shape
+ * @param shape Window shape
+ * @param n     Length in samples
+ * @return Length-n window, i.e. the symmetric length-(n+1) taper without its last sample
+ */
+[[nodiscard]] MAYAFLUX_API std::vector<double> spectral_window(SpectralWindow shape, uint32_t n);
+
+/**
+ * @class StreamingSTFT
+ * @brief Streaming weighted overlap-add analysis/resynthesis engine
+ *
+ * One instance per channel. Not thread-safe; call from one processing thread.
+ */
+class MAYAFLUX_API StreamingSTFT {
+public:
+    /**
+     * @param window_size FFT frame size (power of 2, >= 64)
+     * @param hop_size    Samples between frames; must divide @p window_size
+     * @param window      Analysis and synthesis window shape
+     */
+    explicit StreamingSTFT(uint32_t window_size = 1024, uint32_t hop_size = 256,
+        SpectralWindow window = SpectralWindow::HANN);
+
+    ~StreamingSTFT();
+
+    StreamingSTFT(const StreamingSTFT&) = delete;
+    StreamingSTFT& operator=(const StreamingSTFT&) = delete;
+    StreamingSTFT(StreamingSTFT&&) noexcept;
+    StreamingSTFT& operator=(StreamingSTFT&&) noexcept;
+
+    /**
+     * @brief Process @p io in place
+     * @param io        Any number of samples; output is delayed by latency()
+     * @param processor Called once per completed hop with the one-sided
+     *                  spectrum (bins 0..N/2) and a running frame index.
+     *                  Null passes frames through unchanged.
+     */
+    void process(std::span<double> io, const SpectrumProcessor& processor);
+
+    /// @brief Clear all history; the next output is silence for latency() samples.
+    void reset();
+
+    [[nodiscard]] uint32_t window_size() const noexcept { return m_window_size; }
+    [[nodiscard]] uint32_t hop_size() const noexcept { return m_hop_size; }
+    [[nodiscard]] uint32_t bin_count() const noexcept { return m_window_size / 2 + 1; }
+    [[nodiscard]] SpectralWindow window_shape() const noexcept { return m_window_shape; }
+
+    /// @brief Window coefficients applied at analysis and synthesis.
+    [[nodiscard]] std::span<const double> window() const noexcept { return m_window; }
+
+    /// @brief Delay between input and output, in samples.
+    [[nodiscard]] uint32_t latency() const noexcept { return m_window_size; }
+
+    /// @brief Frames processed since construction or reset().
+    [[nodiscard]] size_t frame_index() const noexcept { return m_frame_index; }
+
+private:
+    struct Plan;
+
+    uint32_t m_window_size;
+    uint32_t m_hop_size;
+    SpectralWindow m_window_shape;
+
+    std::vector<double> m_window;
+    std::vector<double> m_inv_norm; ///< 1 / sum of squared windows, per hop phase
+    std::vector<double> m_input; ///< Last window_size input samples
+    std::vector<double> m_accum; ///< Overlap-add accumulator
+    std::vector<double> m_output; ///< Completed samples awaiting emission (hop_size)
+    std::vector<double> m_frame;
+    std::vector<std::complex<double>> m_spectrum;
+    std::unique_ptr<Plan> m_plan;
+
+    uint32_t m_fill {}; ///< Samples accepted into the current hop
+    size_t m_frame_index {};
+
+    void run_frame(const SpectrumProcessor& processor);
+};
+
+// ============================================================================
+// Streaming spectral operations
+// ============================================================================
+
+/**
+ * @class StreamingPitchShift
+ * @brief Phase-vocoder pitch shifter for use with StreamingSTFT
+ *
+ * Estimates the true frequency of each analysis bin from its phase advance
+ * over one hop, moves magnitudes to bin * ratio and re-accumulates synthesis
+ * phase at the shifted frequencies. Duration is preserved without the
+ * stretch-then-resample step of the offline pitch_shift(). The ratio can be
+ * changed from any thread while processing; it takes effect at the next hop.
+ *
+ * Best results at 75% overlap or more (hop <= window / 4).
+ */
+class MAYAFLUX_API StreamingPitchShift {
+public:
+    StreamingPitchShift(double semitones, uint32_t window_size, uint32_t hop_size);
+
+    void set_semitones(double semitones) noexcept;
+    [[nodiscard]] double get_semitones() const noexcept;
+
+    /// @brief Clear phase history.
+    void reset();
+
+    /// @brief SpectrumProcessor entry point.
+    void operator()(std::vector<std::complex<double>>& spectrum, size_t frame);
+
+private:
+    std::atomic<double> m_ratio;
+    double m_expected; ///< Phase advance per bin per hop (2π hop / N)
+
+    std::vector<double> m_last_phase;
+    std::vector<double> m_sum_phase;
+    std::vector<double> m_synth_magnitude;
+    std::vector<double> m_synth_frequency;
+};
+
+/**
+ * @class StreamingSpectralGate
+ * @brief Zeroes bins whose sinusoidal amplitude is below a threshold
+ *
+ * Unlike the offline spectral_gate(), the threshold is relative to full
+ * scale: a bin's magnitude is corrected for the analysis window's coherent
+ * gain so that a 0 dBFS sine sits at 0 dB regardless of window size or
+ * shape. Pass the same shape as the StreamingSTFT it runs in.
+ */
+class MAYAFLUX_API StreamingSpectralGate {
+public:
+    StreamingSpectralGate(double threshold_db, uint32_t window_size,
+        SpectralWindow window = SpectralWindow::HANN);
+
+    void set_threshold_db(double threshold_db) noexcept;
+    [[nodiscard]] double get_threshold_db() const noexcept;
+
+    /// @brief SpectrumProcessor entry point.
+    void operator()(std::vector<std::complex<double>>& spectrum, size_t frame) const;
+
+private:
+    std::atomic<double> m_threshold_db;
+    std::atomic<double> m_threshold; ///< Raw bin magnitude equivalent
+    double m_window_gain; ///< Bin magnitude of a unit-amplitude sine: sum(window) / 2
+};
+
+} // namespace MayaFlux::Kinesis::Discrete
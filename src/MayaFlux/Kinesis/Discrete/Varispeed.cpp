@@ -0,0 +1,362 @@
+#include "Varispeed.hpp"
+
+#ifdef MAYAFLUX_ARCH_X64
+#include <immintrin.h>
+#endif
+
+namespace MayaFlux::Kinesis::Discrete {
+
+namespace {
+
+    constexpr uint32_t PHASES = 256;
+    constexpr uint32_t ZERO_CROSSINGS = 16; ///< Per side, at unity rate
+    constexpr double PASSBAND = 0.92; ///< Cutoff as a fraction of the band limit
+    constexpr double KAISER_BETA = 8.0;
+
+    /// Kernel band limits at half-octave steps; rate r uses the first factor >= |r|.
+    constexpr std::array<double, 7> BAND_FACTORS {
+        1.0, std::numbers::sqrt2, 2.0, 2.0 * std::numbers::sqrt2, 4.0, 4.0 * std::numbers::sqrt2, 8.0
+    };
+
+    /**
+     * Row p holds the coefficients for fractional offset p / PHASES; rows
+     * 0..PHASES are stored so phase interpolation never reads out of range.
+     * Tap j multiplies source frame floor(position) - (taps / 2 - 1) + j.
+     */
+    struct SincBank {
+        uint32_t taps {};
+        std::vector<float> table;
+    };
+
+    struct SincBanks {
+        std::array<std::once_flag, BAND_FACTORS.size()> once;
+        std::array<SincBank, BAND_FACTORS.size()> banks;
+    };
+
+    SincBanks& sinc_banks()
+    {
+        static SincBanks banks;
+        return banks;
+    }
+
+    double bessel_i0(double x)
+    {
+        double sum = 1.0;
+        double term = 1.0;
+        const double q = 0.25 * x * x;
+        for (int k = 1; k < 64 && term > 1e-17 * sum; ++k) {
+            term *= q / (static_cast<double>(k) * static_cast<double>(k));
+            sum += term;
+        }
+        return sum;
+    }
+
+    void build_bank(SincBank& bank, double factor)
+    {
+        const auto raw = static_cast<uint32_t>(std::ceil(2.0 * ZERO_CROSSINGS * factor));
+        bank.taps = (raw + 3U) & ~3U;
+        bank.table.assign(static_cast<size_t>(PHASES + 1) * bank.taps, 0.0F);
+
+        const double half = 0.5 * static_cast<double>(bank.taps);
+        const double cutoff = 0.5 * PASSBAND / factor;
+        const double norm = 1.0 / bessel_i0(KAISER_BETA);
+        std::vector<double> row(bank.taps);
+
+        for (uint32_t p = 0; p <= PHASES; ++p) {
+            const double frac = static_cast<double>(p) / PHASES;
+            double sum = 0.0;
+
+            for (uint32_t j = 0; j < bank.taps; ++j) {
+                const double d = static_cast<double>(j) - (half - 1.0) - frac;
+                const double w = d / half;
+                if (std::abs(w) >= 1.0) {
+                    row[j] = 0.0;
+                    continue;
+                }
+                const double x = 2.0 * cutoff * d;
+                const double sinc = std::abs(x) < 1e-12
+                    ? 1.0
+                    : std::sin(std::numbers::pi * x) / (std::numbers::pi * x);
+                row[j] = sinc * bessel_i0(KAISER_BETA * std::sqrt(1.0 - w * w)) * norm;
+                sum += row[j];
+            }
+
+            float* dst = bank.table.data() + static_cast<size_t>(p) * bank.taps;
+            for (uint32_t j = 0; j < bank.taps; ++j) {
+                dst[j] = static_cast<float>(row[j] / sum);
+            }
+        }
+    }
+
+    const SincBank& sinc_bank(size_t band)
+    {
+        auto& banks = sinc_banks();
+        std::call_once(banks.once[band], [&] { build_bank(banks.banks[band], BAND_FACTORS[band]); });
+        return banks.banks[band];
+    }
+
+    size_t band_for(double rate)
+    {
+        const double r = std::abs(rate);
+        for (size_t b = 0; b < BAND_FACTORS.size(); ++b) {
+            if (r <= BAND_FACTORS[b] * (1.0 + 1e-9)) {
+                return b;
+            }
+        }
+        return BAND_FACTORS.size() - 1;
+    }
+
+    /// Blend rows c0 and c1 by @p t and take the inner product with @p x.
+    double dot_phase(const double* x, const float* c0, const float* c1, double t, uint32_t taps) noexcept
+    {
+        uint32_t j = 0;
+        double acc = 0.0;
+
+#ifdef MAYAFLUX_ARCH_X64
+        __m256d vacc = _mm256_setzero_pd();
+        const __m256d vt = _mm256_set1_pd(t);
+        for (; j + 4 <= taps; j += 4) {
+            const __m256d a = _mm256_cvtps_pd(_mm_loadu_ps(c0 + j));
+            const __m256d b = _mm256_cvtps_pd(_mm_loadu_ps(c1 + j));
+            const __m256d c = _mm256_fmadd_pd(vt, _mm256_sub_pd(b, a), a);
+            vacc = _mm256_fmadd_pd(_mm256_loadu_pd(x + j), c, vacc);
+        }
+        __m128d lo = _mm_add_pd(_mm256_castpd256_pd128(vacc), _mm256_extractf128_pd(vacc, 1));
+        lo = _mm_add_sd(lo, _mm_unpackhi_pd(lo, lo));
+        acc = _mm_cvtsd_f64(lo);
+#endif
+
+        for (; j < taps; ++j) {
+            const double c = c0[j] + t * (c1[j] - c0[j]);
+            acc += x[j] * c;
+        }
+        return acc;
+    }
+
+    /**
+     * Source accessor resolving loop wrap and out-of-range frames. The fast
+     * paths bypass it through run() whenever the whole kernel window lies
+     * in [0, limit) and, for segmented storage, inside one segment.
+     */
+    struct Source {
+        const double* data {};
+        const double* const* segments {}; ///< Set for segmented storage; data is then unused
+        uint32_t shift {};
+        uint64_t mask {};
+        size_t offset {};
+        size_t stride {};
+        int64_t frames {};
+        int64_t limit {}; ///< loop end when looping, frames otherwise
+        int64_t loop_begin {};
+        bool looping {};
+
+        [[nodiscard]] const double* frame(int64_t i) const noexcept
+        {
+            const auto u = static_cast<uint64_t>(i);
+            return segments
+                ? segments[u >> shift] + offset + static_cast<size_t>(u & mask) * stride
+                : data + static_cast<size_t>(u) * stride;
+        }
+
+        /// Frames [i, i + count) as one strided run, or nullptr when they are not.
+        [[nodiscard]] const double* run(int64_t i, int64_t count) const noexcept
+        {
+            if (i < 0 || i + count > limit) {
+                return nullptr;
+            }
+            if (segments && (static_cast<uint64_t>(i) >> shift) != (static_cast<uint64_t>(i + count - 1) >> shift)) {
+                return nullptr;
+            }
+            return frame(i);
+        }
+
+        [[nodiscard]] double at(int64_t i) const noexcept
+        {
+            if (looping && i >= limit) {
+                i = loop_begin + (i - limit) % (limit - loop_begin);
+            }
+            if (i < 0 || i >= frames) {
+                return 0.0;
+            }
+            return *frame(i);
+        }
+    };
+
+    double sample_sinc(const Source& src, const SincBank& bank, double position) noexcept
+    {
+        const double base = std::floor(position);
+        const double fp = (position - base) * PHASES;
+        const auto phase = std::min(static_cast<uint32_t>(fp), PHASES - 1);
+        const double t = fp - phase;
+
+        const uint32_t taps = bank.taps;
+        const float* c0 = bank.table.data() + static_cast<size_t>(phase) * taps;
+        const float* c1 = c0 + taps;
+        const int64_t start = static_cast<int64_t>(base) - static_cast<int64_t>(taps / 2 - 1);
+
+        if (src.stride == 1) {
+            if (const double* x = src.run(start, taps)) {
+                return dot_phase(x, c0, c1, t, taps);
+            }
+        }
+
+        double acc = 0.0;
+        for (uint32_t j = 0; j < taps; ++j) {
+            acc += src.at(start + j) * (c0[j] + t * (c1[j] - c0[j]));
+        }
+        return acc;
+    }
+
+    double sample_cubic(const Source& src, double position) noexcept
+    {
+        const double base = std::floor(position);
+        const double f = position - base;
+        const auto i = static_cast<int64_t>(base);
+
+        double y0 = 0.0;
+        double y1 = 0.0;
+        double y2 = 0.0;
+        double y3 = 0.0;
+        if (const double* p = src.run(i - 1, 4)) {
+            y0 = p[0];
+            y1 = p[src.stride];
+            y2 = p[2 * src.stride];
+            y3 = p[3 * src.stride];
+        } else {
+            y0 = src.at(i - 1);
+            y1 = src.at(i);
+            y2 = src.at(i + 1);
+            y3 = src.at(i + 2);
+        }
+
+        const double a = -0.5 * y0 + 1.5 * y1 - 1.5 * y2 + 0.5 * y3;
+        const double b = y0 - 2.5 * y1 + 2.0 * y2 - 0.5 * y3;
+        const double c = -0.5 * y0 + 0.5 * y2;
+        return ((a * f + b) * f + c) * f + y1;
+    }
+
+    Source contiguous_source(std::span<const double> source, size_t stride) noexcept
+    {
+        stride = std::max<size_t>(stride, 1);
+        const auto frames = source.empty() ? 0 : static_cast<int64_t>((source.size() - 1) / stride + 1);
+        return { .data = source.data(), .stride = stride, .frames = frames, .limit = frames };
+    }
+
+    /// @p src carries the storage description; loop bounds are filled in here.
+    template <typename RateAt>
+    size_t render(VarispeedVoice& voice, Source src, std::span<double> out,
+        double max_rate, RateAt&& rate_at) noexcept
+    {
+        const int64_t frames = src.frames;
+
+        if (frames == 0 || voice.finished) {
+            std::ranges::fill(out, 0.0);
+            return 0;
+        }
+
+        if (voice.looping) {
+            const auto begin = static_cast<int64_t>(std::min<uint64_t>(voice.loop_begin, frames));
+            const auto end = voice.loop_end == 0
+                ? frames
+                : static_cast<int64_t>(std::min<uint64_t>(voice.loop_end, frames));
+            if (end > begin) {
+                src.looping = true;
+                src.loop_begin = begin;
+                src.limit = end;
+            }
+        }
+
+        const SincBank* bank = voice.quality == ResampleQuality::SINC
+            ? &sinc_bank(band_for(max_rate))
+            : nullptr;
+
+        const auto loop_begin = static_cast<double>(src.loop_begin);
+        const auto loop_end = static_cast<double>(src.limit);
+        const double loop_length = loop_end - loop_begin;
+        const auto end = static_cast<double>(frames);
+
+        double position = voice.position;
+        size_t n = 0;
+
+        for (; n < out.size(); ++n) {
+            if (!src.looping && (position >= end || position < 0.0)) {
+                voice.finished = true;
+                break;
+            }
+
+            out[n] = bank ? sample_sinc(src, *bank, position) : sample_cubic(src, position);
+
+            const double rate = rate_at(n);
+            position += rate;
+
+            if (src.looping) {
+                if (position >= loop_end) {
+                    position = loop_begin + std::fmod(position - loop_begin, loop_length);
+                } else if (position < loop_begin && rate < 0.0) {
+                    position = loop_end - std::fmod(loop_begin - position, loop_length);
+                }
+            }
+        }
+
+        std::fill(out.begin() + static_cast<std::ptrdiff_t>(n), out.end(), 0.0);
+        voice.position = position;
+        return n;
+    }
+
+} // namespace
+
+size_t render_varispeed(VarispeedVoice& voice, std::span<const double> source, std::span<double> out, size_t stride) noexcept
+{
+    const double rate = voice.rate;
+    return render(voice, contiguous_source(source, stride), out, rate, [rate](size_t) { return rate; });
+}
+
+size_t render_varispeed(VarispeedVoice& voice, std::span<const double> source, std::span<double> out,
+    std::span<const double> rates, size_t stride) noexcept
+{
+    const size_t count = std::min(out.size(), rates.size());
+    if (count == 0) {
+        std::ranges::fill(out, 0.0);
+        return 0;
+    }
+
+    double max_rate = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        max_rate = std::max(max_rate, std::abs(rates[i]));
+    }
+
+    const size_t written = render(voice, contiguous_source(source, stride), out.first(count), max_rate,
+        [rates](size_t i) { return rates[i]; });
+    std::fill(out.begin() + static_cast<std::ptrdiff_t>(count), out.end(), 0.0);
+    voice.rate = rates[count - 1];
+    return written;
+}
+
+size_t render_varispeed(VarispeedVoice& voice, const SegmentedSource& source, std::span<double> out) noexcept
+{
+    const uint64_t capacity = static_cast<uint64_t>(source.segments.size()) << source.shift;
+    const auto frames = static_cast<int64_t>(std::min(source.frames, capacity));
+
+    const Source src {
+        .segments = source.segments.data(),
+        .shift = source.shift,
+        .mask = (uint64_t { 1 } << source.shift) - 1,
+        .offset = source.offset,
+        .stride = std::max<size_t>(source.stride, 1),
+        .frames = frames,
+        .limit = frames,
+    };
+
+    const double rate = voice.rate;
+    return render(voice, src, out, rate, [rate](size_t) { return rate; });
+}
+
+void prepare_varispeed(double max_rate)
+{
+    const size_t last = band_for(max_rate);
+    for (size_t b = 0; b <= last; ++b) {
+        (void)sinc_bank(b);
+    }
+}
+
+} // namespace MayaFlux::Kinesis::Discrete
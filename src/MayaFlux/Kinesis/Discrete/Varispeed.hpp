@@ -0,0 +1,121 @@
+#pragma once
+
+/**
+ * @file Varispeed.hpp
+ * @brief Realtime variable-rate playback of sampled sequences
+ *
+ * Reads a source span at a continuously variable, fractional rate into an
+ * output span. All state lives in a small VarispeedVoice owned by the
+ * caller; rendering never allocates, so hundreds of voices can share one
+ * core and one set of kernel tables.
+ *
+ * SINC quality uses a polyphase Kaiser-windowed sinc with 256 phases and
+ * linear interpolation between adjacent phases. The kernel bandwidth is
+ * chosen from a bank at half-octave steps of playback rate so that pitching
+ * up does not alias. Coefficients are stored as float and the inner
+ * product runs four taps per AVX2 instruction on x86-64.
+ *
+ * CUBIC quality is 4-point Catmull-Rom, matching interpolate_cubic();
+ * cheap, but with no anti-aliasing when rate > 1.
+ */
+
+namespace MayaFlux::Kinesis::Discrete {
+
+/**
+ * @enum ResampleQuality
+ * @brief Interpolation kernel used by render_varispeed()
+ */
+enum class ResampleQuality : uint8_t {
+    CUBIC, ///< 4-point Catmull-Rom
+    SINC ///< Band-limited polyphase windowed sinc
+};
+
+/**
+ * @struct VarispeedVoice
+ * @brief Complete per-voice playback state
+ *
+ * Plain data; copy it to snapshot a voice.
+ */
+struct VarispeedVoice {
+    double position {}; ///< Read head in source frames (fractional)
+    double rate { 1.0 }; ///< Source frames per output sample; negative plays backwards
+    ResampleQuality quality { ResampleQuality::SINC };
+
+    bool looping {};
+    uint64_t loop_begin {}; ///< First frame of the loop
+    uint64_t loop_end {}; ///< One past the last loop frame; 0 loops to the source end
+
+    bool finished {}; ///< Set once a non-looping voice runs off either end
+};
+
+/**
+ * @struct SegmentedSource
+ * @brief Source samples split across equally sized segments
+ *
+ * Frame i is segments[i >> shift][offset + (i & (2^shift - 1)) * stride].
+ * Describes storage that grows by appending segments, so a reader can play
+ * samples written after it took the segment table.
+ */
+struct SegmentedSource {
+    std::span<const double* const> segments; ///< Segment base pointers in frame order
+    uint32_t shift {}; ///< log2 of the frames per segment
+    size_t offset {}; ///< Position of the channel's first frame within a segment
+    size_t stride { 1 }; ///< Distance between successive frames within a segment
+    uint64_t frames {}; ///< Frames readable; must not exceed segments.size() << shift
+};
+
+/**
+ * @brief Render @p out from @p source at the voice's rate
+ * @param voice  Playback state; position and finished are updated
+ * @param source Source samples. Frame i is source[i * stride]
+ * @param out    Destination, fully written
+ * @param stride Distance between successive frames (channel count for interleaved data)
+ * @return Samples rendered before the voice finished; the remainder of
+ *         @p out is zero-filled
+ *
+ * Frames outside the source read as silence, so playback starts and ends
+ * without clicks. When looping, frames past the loop end read from the
+ * loop start, giving a seamless interpolated wrap.
+ *
+ * SINC quality needs the kernel table for the current rate. Call
+ * prepare_varispeed() beforehand; otherwise the first render at each
+ * bandwidth builds its table on the calling thread.
+ */
+MAYAFLUX_API size_t render_varispeed(VarispeedVoice& voice,
+    std::span<const double> source,
+    std::span<double> out,
+    size_t stride = 1) noexcept;
+
+/**
+ * @brief Render with a per-sample rate (audio-rate pitch modulation)
+ * @param rates Rate for each output sample; must be at least out.size() long.
+ *              voice.rate is left at the last value used.
+ *
+ * The sinc bandwidth is chosen once per call from the largest |rate|.
+ */
+MAYAFLUX_API size_t render_varispeed(VarispeedVoice& voice,
+    std::span<const double> source,
+    std::span<double> out,
+    std::span<const double> rates,
+    size_t stride = 1) noexcept;
+
+/**
+ * @brief Render from segmented storage
+ *
+ * Same result as rendering the frames gathered into one span. Kernel
+ * windows that straddle a segment boundary take the per-tap path.
+ */
+MAYAFLUX_API size_t render_varispeed(VarispeedVoice& voice,
+    const SegmentedSource& source,
+    std::span<double> out) noexcept;
+
+/**
+ * @brief Build sinc tables for playback rates up to @p max_rate
+ *
+ * Tables are otherwise built lazily on first use at each bandwidth. Call
+ * from a non-realtime thread before playback to keep that work off the
+ * audio callback.
+ */
+MAYAFLUX_API void prepare_varispeed(double max_rate = 8.0);
+
+} // namespace MayaFlux::Kinesis::Discrete
@@ -3,6 +3,7 @@
 #include "MayaFlux/Kakshya/NDData/MeshData.hpp"
 #include "MayaFlux/Kakshya/NDData/VertexFormats.hpp"
 
+#include "MayaFlux/Kinesis/SDFMesher.hpp"
 #include "MayaFlux/Kinesis/Spatial/Bounds.hpp"
 
 namespace MayaFlux::Kinesis {
@@ -434,6 +435,9 @@ struct QuadGeometry {
  * [@p bounds_min, @p bounds_max] with @p res_x * @p res_y * @p res_z cells.
  * Triangles are generated wherever the field crosses @p iso_level.
  * Vertex normals are estimated via central finite differences on the field.
+ * Vertices are shared between adjacent triangles and the grid is sampled
+ * and triangulated in parallel bricks (see SDFMesher), so @p field must be
+ * safe to call concurrently.
  *
  * Any Kinesis::SpatialField is valid: distance(), combine(), chain(),
  * or any user-supplied glm::vec3 -> float lambda wrapped in a SpatialField.
@@ -457,4 +461,21 @@ struct QuadGeometry {
     uint32_t res_z,
     float iso_level = 0.0F);
 
+/**
+ * @brief generate_sdf_mesh() with explicit brick, skipping and threading options.
+ * @param options Passed to SDFMesher. Set SDFMeshOptions::lipschitz for
+ *                distance fields to skip bricks far from the surface.
+ * @param stats   If non-null, receives evaluation counts and timings.
+ */
+[[nodiscard]] MAYAFLUX_API Kakshya::MeshData generate_sdf_mesh(
+    const Kinesis::SpatialField& field,
+    const glm::vec3& bounds_min,
+    const glm::vec3& bounds_max,
+    uint32_t res_x,
+    uint32_t res_y,
+    uint32_t res_z,
+    float iso_level,
+    const SDFMeshOptions& options,
+    SDFMeshStats* stats = nullptr);
+
 } // namespace MayaFlux::Kinesis
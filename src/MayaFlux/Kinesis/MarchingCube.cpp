@@ -1,7 +1,10 @@
 #include "GeometryPrimitives.hpp"
+#include "SDFMesher.hpp"
 
 #include "KMarchingTable.hpp"
+#include "MayaFlux/Journal/Archivist.hpp"
 #include "MayaFlux/Kakshya/NDData/MeshInsertion.hpp"
+#include "MayaFlux/Transitive/Parallel/Execution.hpp"
 
 #ifdef MAYAFLUX_ARCH_X64
 #include <immintrin.h>
@@ -56,65 +59,224 @@ namespace MayaFlux::Kinesis {
 #endif
 }
 
+namespace {
+
+    constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+    /// Corner offsets in k_tri_table order.
+    constexpr std::array<std::array<uint32_t, 3>, 8> k_corners { {
+        { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 },
+        { 0, 0, 1 }, { 1, 0, 1 }, { 1, 1, 1 }, { 0, 1, 1 } } };
+
+    /// Cube edge -> (lower corner, upper corner, axis).
+    constexpr std::array<std::array<uint32_t, 3>, 12> k_edges { {
+        { 0, 1, 0 }, { 1, 2, 1 }, { 3, 2, 0 }, { 0, 3, 1 },
+        { 4, 5, 0 }, { 5, 6, 1 }, { 7, 6, 0 }, { 4, 7, 1 },
+        { 0, 4, 2 }, { 1, 5, 2 }, { 2, 6, 2 }, { 3, 7, 2 } } };
+
+    double elapsed_ms(std::chrono::steady_clock::time_point since)
+    {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - since).count();
+    }
+
+} // namespace
+
 // =============================================================================
-// generate_sdf_mesh
+// SDFMesher
 // =============================================================================
 
-struct InterpolatedEdge {
-    glm::vec3 position;
-    glm::vec3 normal;
-};
-
-Kakshya::MeshData generate_sdf_mesh(
-    const Kinesis::SpatialField& field,
+SDFMesher::SDFMesher(
     const glm::vec3& bounds_min,
     const glm::vec3& bounds_max,
     uint32_t res_x,
     uint32_t res_y,
     uint32_t res_z,
-    float iso_level)
+    float iso_level,
+    SDFMeshOptions options)
+    : m_bounds_min(bounds_min)
+    , m_extent(bounds_max - bounds_min)
+    , m_res { std::max(res_x, 1U), std::max(res_y, 1U), std::max(res_z, 1U) }
+    , m_iso_level(iso_level)
+    , m_options(options)
 {
-    res_x = std::max(res_x, 1U);
-    res_y = std::max(res_y, 1U);
-    res_z = std::max(res_z, 1U);
+    m_options.brick_size = std::max(m_options.brick_size, 1U);
+    m_step = glm::vec3(
+        m_extent.x / static_cast<float>(m_res[0]),
+        m_extent.y / static_cast<float>(m_res[1]),
+        m_extent.z / static_cast<float>(m_res[2]));
+
+    size_t samples = 1;
+    size_t bricks = 1;
+    for (size_t a = 0; a < 3; ++a) {
+        m_padded[a] = m_res[a] + 3;
+        m_brick_counts[a] = (m_res[a] + m_options.brick_size - 1) / m_options.brick_size;
+        samples *= m_padded[a];
+        bricks *= m_brick_counts[a];
+    }
 
-    const glm::vec3 extent = bounds_max - bounds_min;
-    const glm::vec3 step {
-        extent.x / static_cast<float>(res_x),
-        extent.y / static_cast<float>(res_y),
-        extent.z / static_cast<float>(res_z),
-    };
+    m_values.resize(samples);
+    m_valid.assign(samples, 0);
+    m_bricks.resize(bricks);
+}
+
+void SDFMesher::set_field(SpatialField field)
+{
+    m_field = std::move(field);
+    invalidate();
+}
+
+void SDFMesher::invalidate()
+{
+    std::ranges::fill(m_valid, uint8_t { 0 });
+    for (auto& brick : m_bricks) {
+        brick.dirty = true;
+    }
+}
 
-    const uint32_t nx = res_x + 1;
-    const uint32_t ny = res_y + 1;
-    const uint32_t nz = res_z + 1;
+void SDFMesher::invalidate_region(const glm::vec3& region_min, const glm::vec3& region_max)
+{
+    // Sample coordinates run from -1 to res + 1 including the padding layer.
+    std::array<int64_t, 3> lo {};
+    std::array<int64_t, 3> hi {};
+    for (int a = 0; a < 3; ++a) {
+        const float origin = m_bounds_min[a];
+        const float step = m_step[a];
+        const auto limit = static_cast<int64_t>(m_res[a]) + 1;
+        if (step <= 0.0F) {
+            lo[a] = -1;
+            hi[a] = limit;
+            continue;
+        }
+        lo[a] = std::clamp(static_cast<int64_t>(std::floor((region_min[a] - origin) / step)), int64_t { -1 }, limit);
+        hi[a] = std::clamp(static_cast<int64_t>(std::ceil((region_max[a] - origin) / step)), int64_t { -1 }, limit);
+        if (lo[a] > hi[a]) {
+            return;
+        }
+    }
 
-    const uint32_t px = nx + 2;
-    const uint32_t py = ny + 2;
-    const uint32_t pz = nz + 2;
-    const size_t num_voxels = static_cast<size_t>(px) * py * pz;
+    for (int64_t z = lo[2]; z <= hi[2]; ++z) {
+        for (int64_t y = lo[1]; y <= hi[1]; ++y) {
+            const size_t row = ((static_cast<size_t>(z + 1) * m_padded[1]) + static_cast<size_t>(y + 1)) * m_padded[0];
+            std::fill(m_valid.begin() + static_cast<std::ptrdiff_t>(row + static_cast<size_t>(lo[0] + 1)),
+                m_valid.begin() + static_cast<std::ptrdiff_t>(row + static_cast<size_t>(hi[0] + 2)), uint8_t { 0 });
+        }
+    }
 
-    const size_t sx = 1;
-    const size_t sy = px;
-    const size_t sz = static_cast<size_t>(py) * px;
-
-    std::vector<float> vals(num_voxels);
-    for (uint32_t iz = 0; iz < pz; ++iz) {
-        float z = bounds_min.z + static_cast<float>(static_cast<int32_t>(iz) - 1) * step.z;
-        for (uint32_t iy = 0; iy < py; ++iy) {
-            float y = bounds_min.y + static_cast<float>(static_cast<int32_t>(iy) - 1) * step.y;
-            size_t base_idx = (static_cast<size_t>(iz) * py + iy) * px;
-            for (uint32_t ix = 0; ix < px; ++ix) {
-                float x = bounds_min.x + static_cast<float>(static_cast<int32_t>(ix) - 1) * step.x;
-                vals[base_idx + ix] = field(glm::vec3(x, y, z));
-            }
+    // A brick reads samples one beyond its cells for normals.
+    for (size_t b = 0; b < m_bricks.size(); ++b) {
+        const auto coords = brick_coords(b);
+        const auto begin = cell_begin(coords);
+        const auto end = cell_end(coords);
+        bool touched = true;
+        for (int a = 0; a < 3 && touched; ++a) {
+            touched = static_cast<int64_t>(begin[a]) - 1 <= hi[a] && static_cast<int64_t>(end[a]) + 1 >= lo[a];
+        }
+        if (touched) {
+            m_bricks[b].dirty = true;
+        }
+    }
+}
+
+std::array<uint32_t, 3> SDFMesher::brick_coords(size_t brick) const
+{
+    const auto bx = static_cast<uint32_t>(brick % m_brick_counts[0]);
+    const auto by = static_cast<uint32_t>((brick / m_brick_counts[0]) % m_brick_counts[1]);
+    const auto bz = static_cast<uint32_t>(brick / (static_cast<size_t>(m_brick_counts[0]) * m_brick_counts[1]));
+    return { bx, by, bz };
+}
+
+std::array<uint32_t, 3> SDFMesher::cell_begin(const std::array<uint32_t, 3>& b) const
+{
+    return { b[0] * m_options.brick_size, b[1] * m_options.brick_size, b[2] * m_options.brick_size };
+}
+
+std::array<uint32_t, 3> SDFMesher::cell_end(const std::array<uint32_t, 3>& b) const
+{
+    return {
+        std::min((b[0] + 1) * m_options.brick_size, m_res[0]),
+        std::min((b[1] + 1) * m_options.brick_size, m_res[1]),
+        std::min((b[2] + 1) * m_options.brick_size, m_res[2]),
+    };
+}
+
+size_t SDFMesher::owner_of(uint64_t key) const
+{
+    const uint64_t sample = key / 3;
+    const uint64_t nx = m_res[0] + 1;
+    const uint64_t ny = m_res[1] + 1;
+    const uint64_t B = m_options.brick_size;
+
+    const uint64_t bx = std::min<uint64_t>((sample % nx) / B, m_brick_counts[0] - 1);
+    const uint64_t by = std::min<uint64_t>(((sample / nx) % ny) / B, m_brick_counts[1] - 1);
+    const uint64_t bz = std::min<uint64_t>((sample / (nx * ny)) / B, m_brick_counts[2] - 1);
+    return static_cast<size_t>((bz * m_brick_counts[1] + by) * m_brick_counts[0] + bx);
+}
+
+template <typename Fn>
+void SDFMesher::run(size_t count, Fn&& fn) const
+{
+    if (!m_options.parallel || count < 2) {
+        for (size_t i = 0; i < count; ++i) {
+            fn(i);
         }
+        return;
+    }
+    Parallel::for_each(Parallel::par,
+        std::views::iota(size_t { 0 }, count).begin(),
+        std::views::iota(size_t { 0 }, count).end(),
+        fn);
+}
+
+bool SDFMesher::provably_empty(size_t brick) const
+{
+    if (m_options.lipschitz <= 0.0F) {
+        return false;
+    }
+
+    const auto coords = brick_coords(brick);
+    const auto begin = cell_begin(coords);
+    const auto end = cell_end(coords);
+
+    glm::vec3 center;
+    glm::vec3 half;
+    for (int a = 0; a < 3; ++a) {
+        center[a] = m_bounds_min[a] + 0.5F * static_cast<float>(begin[a] + end[a]) * m_step[a];
+        half[a] = 0.5F * static_cast<float>(end[a] - begin[a]) * std::abs(m_step[a]);
     }
 
-    std::vector<Kakshya::MeshVertex> verts;
-    std::vector<uint32_t> indices;
-    verts.reserve(static_cast<size_t>(res_x * res_y * res_z) * 3);
-    indices.reserve(static_cast<size_t>(res_x * res_y * res_z) * 3);
+    // Small margin so rounding in the field never hides a crossing.
+    const float reach = m_options.lipschitz * glm::length(half) * 1.001F;
+    return std::abs(m_field(center) - m_iso_level) > reach;
+}
+
+void SDFMesher::mesh_brick(size_t brick)
+{
+    Brick& out = m_bricks[brick];
+    out.vertices.clear();
+    out.keys.clear();
+    out.indices.clear();
+    out.remote.clear();
+    out.owned = 0;
+
+    const auto coords = brick_coords(brick);
+    const auto begin = cell_begin(coords);
+    const auto end = cell_end(coords);
+
+    const size_t sx = 1;
+    const size_t sy = m_padded[0];
+    const size_t sz = static_cast<size_t>(m_padded[1]) * m_padded[0];
+    const uint64_t nx = m_res[0] + 1;
+    const uint64_t nxy = nx * (m_res[1] + 1);
+
+    // Local edge -> vertex cache over this brick's corner samples.
+    const uint32_t lx = end[0] - begin[0] + 1;
+    const uint32_t ly = end[1] - begin[1] + 1;
+    const uint32_t lz = end[2] - begin[2] + 1;
+    thread_local std::vector<uint32_t> edge_cache;
+    edge_cache.assign(static_cast<size_t>(lx) * ly * lz * 3, NONE);
+
+    const std::vector<float>& vals = m_values;
+    const glm::vec3 step = m_step;
 
     auto grad_at = [&](size_t ptr) -> glm::vec3 {
         glm::vec3 n {
@@ -126,97 +288,173 @@ Kakshya::MeshData generate_sdf_mesh(
         return len > 1e-7F ? (n / len) : glm::vec3(0.0F, 1.0F, 0.0F);
     };
 
-    for (uint32_t iz = 0; iz < res_z; ++iz) {
-        float z0 = bounds_min.z + static_cast<float>(iz) * step.z;
-        float z1 = z0 + step.z;
-
-        for (uint32_t iy = 0; iy < res_y; ++iy) {
-            float y0 = bounds_min.y + static_cast<float>(iy) * step.y;
-            float y1 = y0 + step.y;
+    for (uint32_t iz = begin[2]; iz < end[2]; ++iz) {
+        for (uint32_t iy = begin[1]; iy < end[1]; ++iy) {
+            size_t voxel_ptr = (static_cast<size_t>(iz + 1) * m_padded[1] + (iy + 1)) * m_padded[0] + begin[0] + 1;
 
-            size_t voxel_ptr = (static_cast<size_t>(iz + 1) * py + (iy + 1)) * px + 1;
-
-            for (uint32_t ix = 0; ix < res_x; ++ix, ++voxel_ptr) {
+            for (uint32_t ix = begin[0]; ix < end[0]; ++ix, ++voxel_ptr) {
+                const size_t corner_ptr[8] = {
+                    voxel_ptr, voxel_ptr + sx, voxel_ptr + sy + sx, voxel_ptr + sy,
+                    voxel_ptr + sz, voxel_ptr + sz + sx, voxel_ptr + sz + sy + sx, voxel_ptr + sz + sy
+                };
                 const float v[8] = {
-                    vals[voxel_ptr], vals[voxel_ptr + sx], vals[voxel_ptr + sy + sx], vals[voxel_ptr + sy],
-                    vals[voxel_ptr + sz], vals[voxel_ptr + sz + sx], vals[voxel_ptr + sz + sy + sx], vals[voxel_ptr + sz + sy]
+                    vals[corner_ptr[0]], vals[corner_ptr[1]], vals[corner_ptr[2]], vals[corner_ptr[3]],
+                    vals[corner_ptr[4]], vals[corner_ptr[5]], vals[corner_ptr[6]], vals[corner_ptr[7]]
                 };
 
-                const uint32_t cube_idx = compute_cube_index(v, iso_level);
+                const uint32_t cube_idx = compute_cube_index(v, m_iso_level);
                 const uint16_t edges = k_edge_table[cube_idx];
                 if (edges == 0)
                     continue;
 
-                float x0 = bounds_min.x + static_cast<float>(ix) * step.x;
-                float x1 = x0 + step.x;
-                const glm::vec3 c[8] = {
-                    { x0, y0, z0 }, { x1, y0, z0 }, { x1, y1, z0 }, { x0, y1, z0 },
-                    { x0, y0, z1 }, { x1, y0, z1 }, { x1, y1, z1 }, { x0, y1, z1 }
-                };
-
-                const glm::vec3 nrm[8] = {
-                    grad_at(voxel_ptr), grad_at(voxel_ptr + sx), grad_at(voxel_ptr + sy + sx), grad_at(voxel_ptr + sy),
-                    grad_at(voxel_ptr + sz), grad_at(voxel_ptr + sz + sx), grad_at(voxel_ptr + sz + sy + sx), grad_at(voxel_ptr + sz + sy)
-                };
-
-                InterpolatedEdge ep[12];
+                std::array<uint32_t, 12> ep {};
+                for (uint32_t e = 0; e < 12; ++e) {
+                    if (!(edges & (1U << e)))
+                        continue;
+
+                    const auto [lower, upper, axis] = k_edges[e];
+                    const auto& co = k_corners[lower];
+                    const uint32_t gx = ix + co[0];
+                    const uint32_t gy = iy + co[1];
+                    const uint32_t gz = iz + co[2];
+
+                    const size_t slot = ((static_cast<size_t>(gz - begin[2]) * ly + (gy - begin[1])) * lx + (gx - begin[0])) * 3 + axis;
+                    if (edge_cache[slot] != NONE) {
+                        ep[e] = edge_cache[slot];
+                        continue;
+                    }
 
-                auto interp_edge = [&](int i1, int i2) -> InterpolatedEdge {
-                    float va = v[i1], vb = v[i2];
-                    float d = vb - va;
-                    float t = (std::abs(d) < 1e-7F) ? 0.5F : ((iso_level - va) / d);
+                    // Always interpolate lower -> upper so bricks sharing an edge agree bit for bit.
+                    const float va = v[lower];
+                    const float vb = v[upper];
+                    const float d = vb - va;
+                    const float t = (std::abs(d) < 1e-7F) ? 0.5F : ((m_iso_level - va) / d);
 
-                    return {
-                        .position = c[i1] + t * (c[i2] - c[i1]),
-                        .normal = glm::normalize(nrm[i1] + t * (nrm[i2] - nrm[i1]))
+                    const glm::vec3 pa {
+                        m_bounds_min.x + static_cast<float>(gx) * step.x,
+                        m_bounds_min.y + static_cast<float>(gy) * step.y,
+                        m_bounds_min.z + static_cast<float>(gz) * step.z
                     };
-                };
-
-                if (edges & 0x001)
-                    ep[0] = interp_edge(0, 1);
-                if (edges & 0x002)
-                    ep[1] = interp_edge(1, 2);
-                if (edges & 0x004)
-                    ep[2] = interp_edge(2, 3);
-                if (edges & 0x008)
-                    ep[3] = interp_edge(3, 0);
-                if (edges & 0x010)
-                    ep[4] = interp_edge(4, 5);
-                if (edges & 0x020)
-                    ep[5] = interp_edge(5, 6);
-                if (edges & 0x040)
-                    ep[6] = interp_edge(6, 7);
-                if (edges & 0x080)
-                    ep[7] = interp_edge(7, 4);
-                if (edges & 0x100)
-                    ep[8] = interp_edge(0, 4);
-                if (edges & 0x200)
-                    ep[9] = interp_edge(1, 5);
-                if (edges & 0x400)
-                    ep[10] = interp_edge(2, 6);
-                if (edges & 0x800)
-                    ep[11] = interp_edge(3, 7);
+                    glm::vec3 pb = pa;
+                    pb[static_cast<int>(axis)] += step[static_cast<int>(axis)];
+
+                    const glm::vec3 na = grad_at(corner_ptr[lower]);
+                    const glm::vec3 nb = grad_at(corner_ptr[upper]);
+                    const glm::vec3 position = pa + t * (pb - pa);
+
+                    glm::vec2 uv((position.x - m_bounds_min.x) / m_extent.x,
+                        (position.y - m_bounds_min.y) / m_extent.y);
+
+                    const auto id = static_cast<uint32_t>(out.vertices.size());
+                    out.vertices.push_back({ .position = position,
+                        .uv = uv,
+                        .normal = glm::normalize(na + t * (nb - na)) });
+                    out.keys.push_back(((gz * nxy) + (gy * nx) + gx) * 3 + axis);
+                    edge_cache[slot] = id;
+                    ep[e] = id;
+                }
 
                 const auto& tri = k_tri_table[cube_idx];
-
                 for (int i = 0; tri[i] != -1; i += 3) {
-                    const auto base = static_cast<uint32_t>(verts.size());
+                    out.indices.insert(out.indices.end(), { ep[tri[i]], ep[tri[i + 1]], ep[tri[i + 2]] });
+                }
+            }
+        }
+    }
 
-                    for (int j = 0; j < 3; ++j) {
-                        const auto& edge_data = ep[tri[i + j]];
-                        glm::vec2 uv((edge_data.position.x - bounds_min.x) / extent.x,
-                            (edge_data.position.y - bounds_min.y) / extent.y);
+    // Owned vertices first, sorted by key, so neighbours can binary search them.
+    const size_t count = out.vertices.size();
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0U);
+    const auto is_owned = [&](uint32_t v) { return owner_of(out.keys[v]) == brick; };
+    const auto split = std::stable_partition(order.begin(), order.end(), is_owned);
+    std::sort(order.begin(), split, [&](uint32_t a, uint32_t b) { return out.keys[a] < out.keys[b]; });
+    out.owned = static_cast<uint32_t>(split - order.begin());
+
+    std::vector<uint32_t> remap(count);
+    std::vector<Kakshya::MeshVertex> vertices(count);
+    std::vector<uint64_t> keys(count);
+    for (uint32_t k = 0; k < count; ++k) {
+        remap[order[k]] = k;
+        vertices[k] = out.vertices[order[k]];
+        keys[k] = out.keys[order[k]];
+    }
+    for (auto& index : out.indices) {
+        index = remap[index];
+    }
+    out.vertices = std::move(vertices);
+    out.keys = std::move(keys);
+}
 
-                        verts.push_back({ .position = edge_data.position,
-                            .uv = uv,
-                            .normal = edge_data.normal });
-                    }
-                    indices.insert(indices.end(), { base, base + 1, base + 2 });
-                }
+Kakshya::MeshData SDFMesher::assemble()
+{
+    const size_t count = m_bricks.size();
+
+    std::vector<uint32_t> vertex_base(count + 1, 0);
+    std::vector<size_t> index_base(count + 1, 0);
+    for (size_t b = 0; b < count; ++b) {
+        vertex_base[b + 1] = vertex_base[b] + m_bricks[b].owned;
+        index_base[b + 1] = index_base[b] + m_bricks[b].indices.size();
+    }
+    const uint32_t owned_total = vertex_base[count];
+
+    // Resolve vertices on edges owned by a neighbouring brick.
+    run(count, [&](size_t b) {
+        Brick& brick = m_bricks[b];
+        brick.remote.assign(brick.vertices.size() - brick.owned, NONE);
+        for (size_t v = brick.owned; v < brick.vertices.size(); ++v) {
+            const uint64_t key = brick.keys[v];
+            const size_t owner = owner_of(key);
+            const Brick& other = m_bricks[owner];
+            const auto owned_keys = std::span(other.keys).first(other.owned);
+            const auto it = std::ranges::lower_bound(owned_keys, key);
+            if (it != owned_keys.end() && *it == key) {
+                brick.remote[v - brick.owned] = vertex_base[owner] + static_cast<uint32_t>(it - owned_keys.begin());
+            }
+        }
+    });
+
+    // Anything unresolved (owner skipped) is appended once per brick.
+    uint32_t next = owned_total;
+    for (auto& brick : m_bricks) {
+        for (auto& r : brick.remote) {
+            if (r == NONE) {
+                r = next++;
             }
         }
     }
 
+    std::vector<Kakshya::MeshVertex> verts(next);
+    std::vector<uint32_t> indices(index_base[count]);
+
+    run(count, [&](size_t b) {
+        const Brick& brick = m_bricks[b];
+        std::copy_n(brick.vertices.begin(), brick.owned, verts.begin() + vertex_base[b]);
+        for (size_t r = 0; r < brick.remote.size(); ++r) {
+            if (brick.remote[r] >= owned_total) {
+                verts[brick.remote[r]] = brick.vertices[brick.owned + r];
+            }
+        }
+
+        auto dst = indices.begin() + static_cast<std::ptrdiff_t>(index_base[b]);
+        for (uint32_t index : brick.indices) {
+            *dst++ = index < brick.owned ? vertex_base[b] + index : brick.remote[index - brick.owned];
+        }
+    });
+
+    if (!m_options.weld_vertices) {
+        std::vector<Kakshya::MeshVertex> flat;
+        flat.reserve(indices.size());
+        for (uint32_t index : indices) {
+            flat.push_back(verts[index]);
+        }
+        verts = std::move(flat);
+        std::iota(indices.begin(), indices.end(), 0U);
+    }
+
+    m_stats.vertices = verts.size();
+    m_stats.triangles = indices.size() / 3;
+
     if (verts.empty())
         return Kakshya::MeshData::empty();
 
@@ -232,4 +470,143 @@ Kakshya::MeshData generate_sdf_mesh(
     return data;
 }
 
+Kakshya::MeshData SDFMesher::extract()
+{
+    m_stats = { .bricks_total = m_bricks.size() };
+
+    if (!m_field.fn) {
+        MF_WARN(Journal::Component::Kinesis, Journal::Context::Runtime,
+            "SDFMesher::extract: no field set");
+        return Kakshya::MeshData::empty();
+    }
+
+    const auto eval_start = std::chrono::steady_clock::now();
+
+    std::vector<uint32_t> dirty;
+    for (size_t b = 0; b < m_bricks.size(); ++b) {
+        if (m_bricks[b].dirty) {
+            dirty.push_back(static_cast<uint32_t>(b));
+        }
+    }
+
+    run(dirty.size(), [&](size_t d) {
+        m_bricks[dirty[d]].active = !provably_empty(dirty[d]);
+    });
+    if (m_options.lipschitz > 0.0F) {
+        m_stats.field_evaluations += dirty.size();
+    }
+
+    // Schedule every missing sample an active brick reads, including the normal padding.
+    constexpr uint8_t scheduled = 2;
+    uint32_t z_first = m_padded[2];
+    uint32_t z_last = 0;
+    for (uint32_t b : dirty) {
+        if (!m_bricks[b].active)
+            continue;
+
+        const auto coords = brick_coords(b);
+        const auto begin = cell_begin(coords);
+        const auto end = cell_end(coords);
+        z_first = std::min(z_first, begin[2]);
+        z_last = std::max(z_last, end[2] + 2);
+        for (uint32_t z = begin[2]; z <= end[2] + 2; ++z) {
+            for (uint32_t y = begin[1]; y <= end[1] + 2; ++y) {
+                const size_t row = (static_cast<size_t>(z) * m_padded[1] + y) * m_padded[0];
+                for (uint32_t x = begin[0]; x <= end[0] + 2; ++x) {
+                    if (!m_valid[row + x]) {
+                        m_valid[row + x] = scheduled;
+                    }
+                }
+            }
+        }
+    }
+
+    if (z_first <= z_last) {
+        std::vector<size_t> plane_evaluations(z_last - z_first + 1, 0);
+        run(plane_evaluations.size(), [&](size_t plane) {
+            const uint32_t iz = z_first + static_cast<uint32_t>(plane);
+            const float z = m_bounds_min.z + static_cast<float>(static_cast<int32_t>(iz) - 1) * m_step.z;
+            for (uint32_t iy = 0; iy < m_padded[1]; ++iy) {
+                const float y = m_bounds_min.y + static_cast<float>(static_cast<int32_t>(iy) - 1) * m_step.y;
+                const size_t row = (static_cast<size_t>(iz) * m_padded[1] + iy) * m_padded[0];
+                for (uint32_t ix = 0; ix < m_padded[0]; ++ix) {
+                    if (m_valid[row + ix] != scheduled)
+                        continue;
+                    const float x = m_bounds_min.x + static_cast<float>(static_cast<int32_t>(ix) - 1) * m_step.x;
+                    m_values[row + ix] = m_field(glm::vec3(x, y, z));
+                    m_valid[row + ix] = 1;
+                    ++plane_evaluations[plane];
+                }
+            }
+        });
+        m_stats.field_evaluations += std::reduce(plane_evaluations.begin(), plane_evaluations.end());
+    }
+    m_stats.evaluate_ms = elapsed_ms(eval_start);
+
+    const auto mesh_start = std::chrono::steady_clock::now();
+
+    run(dirty.size(), [&](size_t d) {
+        Brick& brick = m_bricks[dirty[d]];
+        if (brick.active) {
+            mesh_brick(dirty[d]);
+        } else {
+            brick = Brick {};
+        }
+        brick.dirty = false;
+    });
+
+    for (uint32_t b : dirty) {
+        m_stats.bricks_meshed += m_bricks[b].active ? 1 : 0;
+    }
+    for (const auto& brick : m_bricks) {
+        m_stats.bricks_skipped += brick.active ? 0 : 1;
+    }
+
+    auto data = assemble();
+    m_stats.mesh_ms = elapsed_ms(mesh_start);
+
+    MF_DEBUG(Journal::Component::Kinesis, Journal::Context::Runtime,
+        "SDFMesher: {} evaluations, {}/{} bricks meshed, {} skipped, {} vertices, {} triangles ({:.2f} + {:.2f} ms)",
+        m_stats.field_evaluations, m_stats.bricks_meshed, m_stats.bricks_total, m_stats.bricks_skipped,
+        m_stats.vertices, m_stats.triangles, m_stats.evaluate_ms, m_stats.mesh_ms);
+
+    return data;
+}
+
+// =============================================================================
+// generate_sdf_mesh
+// =============================================================================
+
+Kakshya::MeshData generate_sdf_mesh(
+    const Kinesis::SpatialField& field,
+    const glm::vec3& bounds_min,
+    const glm::vec3& bounds_max,
+    uint32_t res_x,
+    uint32_t res_y,
+    uint32_t res_z,
+    float iso_level)
+{
+    return generate_sdf_mesh(field, bounds_min, bounds_max, res_x, res_y, res_z, iso_level, SDFMeshOptions {});
+}
+
+Kakshya::MeshData generate_sdf_mesh(
+    const Kinesis::SpatialField& field,
+    const glm::vec3& bounds_min,
+    const glm::vec3& bounds_max,
+    uint32_t res_x,
+    uint32_t res_y,
+    uint32_t res_z,
+    float iso_level,
+    const SDFMeshOptions& options,
+    SDFMeshStats* stats)
+{
+    SDFMesher mesher(bounds_min, bounds_max, res_x, res_y, res_z, iso_level, options);
+    mesher.set_field(field);
+    auto data = mesher.extract();
+    if (stats) {
+        *stats = mesher.stats();
+    }
+    return data;
+}
+
 } // namespace MayaFlux::Kinesis
@@ -0,0 +1,363 @@
+#include "RandomStream.hpp"
+
+#ifdef MAYAFLUX_ARCH_X64
+#include <immintrin.h>
+#endif
+
+namespace MayaFlux::Kinesis::Stochastic {
+
+namespace {
+
+    constexpr size_t CHUNK = 256;
+
+    /// xoshiro256 jump polynomials: 2^128 and 2^192 steps.
+    constexpr std::array<uint64_t, 4> JUMP_128 {
+        0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+    };
+    constexpr std::array<uint64_t, 4> JUMP_192 {
+        0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL
+    };
+
+    uint64_t splitmix64(uint64_t& x)
+    {
+        uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    /**
+     * Ziggurat layer table in Doornik's layout: x[0] is the base strip's
+     * equivalent width, x[1] the tail start, x[layers] = 0, and
+     * ratio[i] = x[i + 1] / x[i] is the fast-accept threshold.
+     */
+    template <size_t Layers>
+    struct ZigguratTable {
+        std::array<double, Layers + 1> x {};
+        std::array<double, Layers> ratio {};
+    };
+
+    const ZigguratTable<128>& normal_table()
+    {
+        static const ZigguratTable<128> table = [] {
+            constexpr double r = 3.442619855899;
+            constexpr double v = 9.91256303526217e-3;
+            ZigguratTable<128> t;
+            double f = std::exp(-0.5 * r * r);
+            t.x[0] = v / f;
+            t.x[1] = r;
+            for (size_t i = 2; i < 128; ++i) {
+                t.x[i] = std::sqrt(-2.0 * std::log(v / t.x[i - 1] + f));
+                f = std::exp(-0.5 * t.x[i] * t.x[i]);
+            }
+            t.x[128] = 0.0;
+            for (size_t i = 0; i < 128; ++i) {
+                t.ratio[i] = t.x[i + 1] / t.x[i];
+            }
+            return t;
+        }();
+        return table;
+    }
+
+    const ZigguratTable<256>& exponential_table()
+    {
+        static const ZigguratTable<256> table = [] {
+            constexpr double r = 7.697117470131487;
+            constexpr double v = 3.949659822581572e-3;
+            ZigguratTable<256> t;
+            t.x[0] = v / std::exp(-r);
+            t.x[1] = r;
+            for (size_t i = 2; i < 256; ++i) {
+                t.x[i] = -std::log(v / t.x[i - 1] + std::exp(-t.x[i - 1]));
+            }
+            t.x[256] = 0.0;
+            for (size_t i = 0; i < 256; ++i) {
+                t.ratio[i] = t.x[i + 1] / t.x[i];
+            }
+            return t;
+        }();
+        return table;
+    }
+
+} // namespace
+
+RandomStream::RandomStream(uint64_t seed, uint64_t stream)
+{
+    this->seed(seed, stream);
+}
+
+void RandomStream::seed(uint64_t seed, uint64_t stream)
+{
+    uint64_t mix = stream;
+    uint64_t x = seed ^ splitmix64(mix);
+    for (auto& word : m_s) {
+        word[0] = splitmix64(x);
+    }
+
+    for (size_t lane = 1; lane < 4; ++lane) {
+        for (auto& word : m_s) {
+            word[lane] = word[lane - 1];
+        }
+        advance_lane(lane, JUMP_128);
+    }
+    m_lane = 0;
+}
+
+void RandomStream::advance_lane(size_t lane, const std::array<uint64_t, 4>& polynomial) noexcept
+{
+    std::array<uint64_t, 4> s { m_s[0][lane], m_s[1][lane], m_s[2][lane], m_s[3][lane] };
+    std::array<uint64_t, 4> acc {};
+
+    for (uint64_t word : polynomial) {
+        for (int b = 0; b < 64; ++b) {
+            if (word & (uint64_t { 1 } << b)) {
+                for (size_t k = 0; k < 4; ++k) {
+                    acc[k] ^= s[k];
+                }
+            }
+            const uint64_t t = s[1] << 17;
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = rotl(s[3], 45);
+        }
+    }
+
+    for (size_t k = 0; k < 4; ++k) {
+        m_s[k][lane] = acc[k];
+    }
+}
+
+void RandomStream::jump() noexcept
+{
+    for (size_t lane = 0; lane < 4; ++lane) {
+        advance_lane(lane, JUMP_192);
+    }
+}
+
+// =========================================================================
+// Block generation
+// =========================================================================
+
+void RandomStream::fill_bits(std::span<uint64_t> out) noexcept
+{
+    size_t i = 0;
+    const size_t n = out.size();
+
+    // Realign to lane 0 so the vector loop continues the scalar sequence.
+    while (i < n && m_lane != 0) {
+        out[i++] = next();
+    }
+
+#ifdef MAYAFLUX_ARCH_X64
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    __m256i s0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_s[0].data()));
+    __m256i s1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_s[1].data()));
+    __m256i s2 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_s[2].data()));
+    __m256i s3 = _mm256_load_si256(reinterpret_cast<const __m256i*>(m_s[3].data()));
+
+    for (; i + 4 <= n; i += 4) {
+        const __m256i sum = _mm256_add_epi64(s0, s3);
+        const __m256i rot = _mm256_or_si256(_mm256_slli_epi64(sum, 23), _mm256_srli_epi64(sum, 41));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out.data() + i), _mm256_add_epi64(rot, s0));
+
+        const __m256i t = _mm256_slli_epi64(s1, 17);
+        s2 = _mm256_xor_si256(s2, s0);
+        s3 = _mm256_xor_si256(s3, s1);
+        s1 = _mm256_xor_si256(s1, s2);
+        s0 = _mm256_xor_si256(s0, s3);
+        s2 = _mm256_xor_si256(s2, t);
+        s3 = _mm256_or_si256(_mm256_slli_epi64(s3, 45), _mm256_srli_epi64(s3, 19));
+    }
+
+    _mm256_store_si256(reinterpret_cast<__m256i*>(m_s[0].data()), s0);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(m_s[1].data()), s1);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(m_s[2].data()), s2);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(m_s[3].data()), s3);
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+#endif
+
+    for (; i < n; ++i) {
+        out[i] = next();
+    }
+}
+
+void RandomStream::fill_uniform(std::span<double> out, double min, double max) noexcept
+{
+    const double range = max - min;
+    std::array<uint64_t, CHUNK> bits {};
+
+    for (size_t base = 0; base < out.size(); base += CHUNK) {
+        const size_t count = std::min(CHUNK, out.size() - base);
+        fill_bits(std::span(bits).first(count));
+        double* dst = out.data() + base;
+
+        size_t i = 0;
+#ifdef MAYAFLUX_ARCH_X64
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+        const __m256i exponent = _mm256_set1_epi64x(0x3FF0000000000000LL);
+        const __m256d one = _mm256_set1_pd(1.0);
+        const __m256d scale = _mm256_set1_pd(range);
+        const __m256d offset = _mm256_set1_pd(min);
+        for (; i + 4 <= count; i += 4) {
+            const __m256i raw = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bits.data() + i));
+            const __m256d unit = _mm256_sub_pd(
+                _mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(raw, 12), exponent)), one);
+            _mm256_storeu_pd(dst + i, _mm256_fmadd_pd(unit, scale, offset));
+        }
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+#endif
+        for (; i < count; ++i) {
+            dst[i] = min + to_unit(bits[i]) * range;
+        }
+    }
+}
+
+void RandomStream::fill_uniform(std::span<float> out, float min, float max) noexcept
+{
+    const float range = max - min;
+    std::array<uint64_t, CHUNK> bits {};
+
+    for (size_t base = 0; base < out.size(); base += CHUNK) {
+        const size_t count = std::min(CHUNK, out.size() - base);
+        fill_bits(std::span(bits).first(count));
+        float* dst = out.data() + base;
+
+        for (size_t i = 0; i < count; ++i) {
+            const float unit = std::bit_cast<float>(static_cast<uint32_t>(bits[i] >> 41) | 0x3F800000U) - 1.0F;
+            dst[i] = min + unit * range;
+        }
+    }
+}
+
+// =========================================================================
+// Ziggurat
+// =========================================================================
+
+double RandomStream::normal() noexcept
+{
+    const uint64_t bits = next();
+    const auto& t = normal_table();
+    const size_t i = bits & 127;
+    const double u = 2.0 * to_unit(bits) - 1.0;
+    if (std::abs(u) < t.ratio[i]) {
+        return u * t.x[i];
+    }
+    return normal_slow(bits);
+}
+
+double RandomStream::normal_slow(uint64_t bits) noexcept
+{
+    const auto& t = normal_table();
+
+    for (;;) {
+        const size_t i = bits & 127;
+        const double u = 2.0 * to_unit(bits) - 1.0;
+
+        if (std::abs(u) < t.ratio[i]) {
+            return u * t.x[i];
+        }
+
+        if (i == 0) {
+            const double r = t.x[1];
+            double x = 0.0;
+            double y = 0.0;
+            do {
+                x = std::log(1.0 - uniform()) / r;
+                y = std::log(1.0 - uniform());
+            } while (-2.0 * y < x * x);
+            return u < 0.0 ? x - r : r - x;
+        }
+
+        const double x = u * t.x[i];
+        const double f0 = std::exp(-0.5 * (t.x[i] * t.x[i] - x * x));
+        const double f1 = std::exp(-0.5 * (t.x[i + 1] * t.x[i + 1] - x * x));
+        if (f1 + uniform() * (f0 - f1) < 1.0) {
+            return x;
+        }
+
+        bits = next();
+    }
+}
+
+double RandomStream::exponential() noexcept
+{
+    const uint64_t bits = next();
+    const auto& t = exponential_table();
+    const size_t i = bits & 255;
+    const double u = to_unit(bits);
+    if (u < t.ratio[i]) {
+        return u * t.x[i];
+    }
+    return exponential_slow(bits);
+}
+
+double RandomStream::exponential_slow(uint64_t bits) noexcept
+{
+    const auto& t = exponential_table();
+
+    for (;;) {
+        const size_t i = bits & 255;
+        const double u = to_unit(bits);
+
+        if (u < t.ratio[i]) {
+            return u * t.x[i];
+        }
+
+        if (i == 0) {
+            return t.x[1] - std::log(1.0 - uniform());
+        }
+
+        const double x = u * t.x[i];
+        const double f0 = std::exp(x - t.x[i]);
+        const double f1 = std::exp(x - t.x[i + 1]);
+        if (f1 + uniform() * (f0 - f1) < 1.0) {
+            return x;
+        }
+
+        bits = next();
+    }
+}
+
+void RandomStream::fill_normal(std::span<double> out, double mean, double stddev) noexcept
+{
+    const auto& t = normal_table();
+    std::array<uint64_t, CHUNK> bits {};
+
+    for (size_t base = 0; base < out.size(); base += CHUNK) {
+        const size_t count = std::min(CHUNK, out.size() - base);
+        fill_bits(std::span(bits).first(count));
+        double* dst = out.data() + base;
+
+        for (size_t k = 0; k < count; ++k) {
+            const size_t i = bits[k] & 127;
+            const double u = 2.0 * to_unit(bits[k]) - 1.0;
+            const double z = std::abs(u) < t.ratio[i] ? u * t.x[i] : normal_slow(bits[k]);
+            dst[k] = mean + z * stddev;
+        }
+    }
+}
+
+void RandomStream::fill_exponential(std::span<double> out, double rate) noexcept
+{
+    const auto& t = exponential_table();
+    const double scale = 1.0 / rate;
+    std::array<uint64_t, CHUNK> bits {};
+
+    for (size_t base = 0; base < out.size(); base += CHUNK) {
+        const size_t count = std::min(CHUNK, out.size() - base);
+        fill_bits(std::span(bits).first(count));
+        double* dst = out.data() + base;
+
+        for (size_t k = 0; k < count; ++k) {
+            const size_t i = bits[k] & 255;
+            const double u = to_unit(bits[k]);
+            const double e = u < t.ratio[i] ? u * t.x[i] : exponential_slow(bits[k]);
+            dst[k] = e * scale;
+        }
+    }
+}
+
+} // namespace MayaFlux::Kinesis::Stochastic
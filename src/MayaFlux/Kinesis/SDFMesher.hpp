@@ -0,0 +1,149 @@
+#pragma once
+
+#include "MayaFlux/Kakshya/NDData/MeshData.hpp"
+#include "MayaFlux/Kakshya/NDData/VertexFormats.hpp"
+
+#include "MayaFlux/Kinesis/Tendency/Tendency.hpp"
+
+namespace MayaFlux::Kinesis {
+
+/**
+ * @struct SDFMeshOptions
+ * @brief Tuning for SDFMesher and generate_sdf_mesh().
+ */
+struct SDFMeshOptions {
+    /// Cells per brick edge. Bricks are the unit of skipping, parallel work and remeshing.
+    uint32_t brick_size { 8 };
+
+    /**
+     * Lipschitz bound of the field: |f(a) - f(b)| <= lipschitz * |a - b|.
+     * A true signed distance field has bound 1. When positive, a brick whose
+     * centre value is further from the iso level than the bound allows over
+     * its half-diagonal is skipped without sampling. 0 samples every brick.
+     */
+    float lipschitz { 0.0F };
+
+    /// Share vertices between adjacent triangles. When false every triangle owns three vertices.
+    bool weld_vertices { true };
+
+    /// Evaluate the field and mesh bricks on worker threads. The field must then be safe to call concurrently.
+    bool parallel { true };
+};
+
+/**
+ * @struct SDFMeshStats
+ * @brief Work done by the most recent SDFMesher::extract().
+ */
+struct SDFMeshStats {
+    size_t field_evaluations {}; ///< Field calls, including brick-skip probes.
+    size_t bricks_total {};
+    size_t bricks_skipped {}; ///< Bricks currently proven free of the surface.
+    size_t bricks_meshed {}; ///< Bricks re-triangulated by this call.
+    size_t vertices {};
+    size_t triangles {};
+    double evaluate_ms {};
+    double mesh_ms {}; ///< Triangulation and assembly.
+};
+
+/**
+ * @class SDFMesher
+ * @brief Bricked, incremental marching cubes over a SpatialField.
+ *
+ * The grid of @p res_x * @p res_y * @p res_z cells is partitioned into
+ * cubic bricks. Only bricks that may contain the surface are sampled (see
+ * SDFMeshOptions::lipschitz) and each brick is triangulated independently,
+ * in parallel, with vertices keyed on the grid edge they lie on. Assembly
+ * then welds vertices shared across brick faces into one indexed mesh.
+ *
+ * Field samples and per-brick triangles are retained between calls, so
+ * after invalidate_region() only the bricks touching the edit are
+ * re-sampled and re-meshed. The output is identical to a full rebuild.
+ */
+class MAYAFLUX_API SDFMesher {
+public:
+    /**
+     * @param bounds_min World-space minimum corner of the evaluation volume.
+     * @param bounds_max World-space maximum corner of the evaluation volume.
+     * @param res_x      Cell count along X. Clamped to minimum 1.
+     * @param res_y      Cell count along Y. Clamped to minimum 1.
+     * @param res_z      Cell count along Z. Clamped to minimum 1.
+     * @param iso_level  Isosurface threshold.
+     * @param options    Brick size, skipping and threading.
+     */
+    SDFMesher(
+        const glm::vec3& bounds_min,
+        const glm::vec3& bounds_max,
+        uint32_t res_x,
+        uint32_t res_y,
+        uint32_t res_z,
+        float iso_level = 0.0F,
+        SDFMeshOptions options = {});
+
+    /**
+     * @brief Replace the field and invalidate every brick.
+     * @param field SpatialField: glm::vec3 -> float.
+     */
+    void set_field(SpatialField field);
+
+    /// @brief Discard all cached samples and triangles.
+    void invalidate();
+
+    /**
+     * @brief Mark the field as changed inside an axis-aligned box.
+     *
+     * The field must be unchanged outside the box. Samples inside it and
+     * every brick whose triangles or normals depend on them are recomputed
+     * by the next extract().
+     */
+    void invalidate_region(const glm::vec3& region_min, const glm::vec3& region_max);
+
+    /**
+     * @brief Bring dirty bricks up to date and assemble the mesh.
+     * @return MeshData ready for TRIANGLE_LIST draw, or empty MeshData if
+     *         the field has no crossings at the iso level.
+     */
+    [[nodiscard]] Kakshya::MeshData extract();
+
+    /// @brief Counters and timings of the last extract().
+    [[nodiscard]] const SDFMeshStats& stats() const { return m_stats; }
+
+private:
+    struct Brick {
+        std::vector<Kakshya::MeshVertex> vertices;
+        std::vector<uint64_t> keys; ///< Grid edge of each vertex.
+        std::vector<uint32_t> indices; ///< Local to vertices.
+        std::vector<uint32_t> remote; ///< Global index of each non-owned vertex, filled at assembly.
+        uint32_t owned {}; ///< vertices[0, owned) lie on edges this brick owns, sorted by key.
+        bool active {};
+        bool dirty { true };
+    };
+
+    SpatialField m_field;
+    glm::vec3 m_bounds_min;
+    glm::vec3 m_extent;
+    glm::vec3 m_step;
+    std::array<uint32_t, 3> m_res {};
+    std::array<uint32_t, 3> m_padded {};
+    std::array<uint32_t, 3> m_brick_counts {};
+    float m_iso_level;
+    SDFMeshOptions m_options;
+
+    std::vector<float> m_values; ///< Samples with one layer of padding for normals.
+    std::vector<uint8_t> m_valid;
+    std::vector<Brick> m_bricks;
+    SDFMeshStats m_stats;
+
+    [[nodiscard]] std::array<uint32_t, 3> brick_coords(size_t brick) const;
+    [[nodiscard]] std::array<uint32_t, 3> cell_begin(const std::array<uint32_t, 3>& b) const;
+    [[nodiscard]] std::array<uint32_t, 3> cell_end(const std::array<uint32_t, 3>& b) const;
+    [[nodiscard]] size_t owner_of(uint64_t key) const;
+
+    [[nodiscard]] bool provably_empty(size_t brick) const;
+    void mesh_brick(size_t brick);
+    [[nodiscard]] Kakshya::MeshData assemble();
+
+    template <typename Fn>
+    void run(size_t count, Fn&& fn) const;
+};
+
+} // namespace MayaFlux::Kinesis
@@ -0,0 +1,604 @@
+#include "Delaunay.hpp"
+
+#include "MayaFlux/Journal/Archivist.hpp"
+
+namespace MayaFlux::Kinesis {
+
+namespace {
+
+    // =====================================================================
+    // Exact integer arithmetic
+    // =====================================================================
+
+    /**
+     * Two's-complement 128-bit integer with just the operations the
+     * predicates need. Portable to compilers without __int128.
+     */
+    struct Int128 {
+        uint64_t lo {};
+        uint64_t hi {};
+
+        static Int128 from(int64_t v)
+        {
+            return { .lo = static_cast<uint64_t>(v), .hi = v < 0 ? ~uint64_t { 0 } : 0 };
+        }
+
+        [[nodiscard]] bool negative() const { return static_cast<int64_t>(hi) < 0; }
+
+        [[nodiscard]] int sign() const
+        {
+            if (negative()) {
+                return -1;
+            }
+            return (hi | lo) != 0 ? 1 : 0;
+        }
+
+        friend Int128 operator+(Int128 a, Int128 b)
+        {
+            Int128 r;
+            r.lo = a.lo + b.lo;
+            r.hi = a.hi + b.hi + (r.lo < a.lo ? 1 : 0);
+            return r;
+        }
+
+        friend Int128 operator-(Int128 a)
+        {
+            return Int128 { .lo = ~a.lo, .hi = ~a.hi } + from(1);
+        }
+
+        friend Int128 operator-(Int128 a, Int128 b) { return a + (-b); }
+    };
+
+    Int128 mul_u64(uint64_t a, uint64_t b)
+    {
+        constexpr uint64_t mask = 0xFFFFFFFFULL;
+        const uint64_t ll = (a & mask) * (b & mask);
+        const uint64_t lh = (a & mask) * (b >> 32);
+        const uint64_t hl = (a >> 32) * (b & mask);
+        const uint64_t hh = (a >> 32) * (b >> 32);
+        const uint64_t mid = (ll >> 32) + (lh & mask) + (hl & mask);
+        return { .lo = (mid << 32) | (ll & mask), .hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32) };
+    }
+
+    uint64_t magnitude(int64_t v)
+    {
+        return v < 0 ? uint64_t { 0 } - static_cast<uint64_t>(v) : static_cast<uint64_t>(v);
+    }
+
+    Int128 mul(int64_t a, int64_t b)
+    {
+        const Int128 m = mul_u64(magnitude(a), magnitude(b));
+        return (a < 0) != (b < 0) ? -m : m;
+    }
+
+    /// Exact when the product fits in 127 bits, which the lattice bounds guarantee.
+    Int128 mul(Int128 a, int64_t b)
+    {
+        const bool neg = a.negative() != (b < 0);
+        const Int128 ma = a.negative() ? -a : a;
+        const uint64_t mb = magnitude(b);
+        Int128 r = mul_u64(ma.lo, mb);
+        r.hi += ma.hi * mb;
+        return neg ? -r : r;
+    }
+
+    // =====================================================================
+    // Predicates (Shewchuk's sign conventions)
+    // =====================================================================
+
+    template <int D>
+    using Lattice = std::array<int64_t, D>;
+
+    /// Lattice steps along the longest bounding-box axis. Chosen so every
+    /// intermediate of the predicates below fits in int64 / Int128,
+    /// including the enclosing simplex vertices.
+    template <int D>
+    constexpr int64_t LATTICE_SPAN = D == 2 ? (int64_t { 1 } << 26) : (int64_t { 1 } << 20);
+
+    /**
+     * 2D: > 0 when p[0], p[1], p[2] are counterclockwise.
+     * 3D: > 0 when p[3] lies below the plane of p[0], p[1], p[2] seen counterclockwise.
+     */
+    template <int D>
+    int orient(const std::array<const Lattice<D>*, D + 1>& p)
+    {
+        if constexpr (D == 2) {
+            const Lattice<2>& a = *p[0];
+            const Lattice<2>& b = *p[1];
+            const Lattice<2>& c = *p[2];
+            const int64_t det = (a[0] - c[0]) * (b[1] - c[1]) - (a[1] - c[1]) * (b[0] - c[0]);
+            return (det > 0) - (det < 0);
+        } else {
+            const Lattice<3>& a = *p[0];
+            const Lattice<3>& b = *p[1];
+            const Lattice<3>& c = *p[2];
+            const Lattice<3>& d = *p[3];
+            const int64_t adx = a[0] - d[0], ady = a[1] - d[1], adz = a[2] - d[2];
+            const int64_t bdx = b[0] - d[0], bdy = b[1] - d[1], bdz = b[2] - d[2];
+            const int64_t cdx = c[0] - d[0], cdy = c[1] - d[1], cdz = c[2] - d[2];
+            const Int128 det = mul(adx, bdy * cdz - bdz * cdy)
+                + mul(bdx, cdy * adz - cdz * ady)
+                + mul(cdx, ady * bdz - adz * bdy);
+            return det.sign();
+        }
+    }
+
+    /// > 0 when e lies strictly inside the circumsphere of the positively oriented simplex p.
+    template <int D>
+    int insphere(const std::array<const Lattice<D>*, D + 1>& p, const Lattice<D>& e)
+    {
+        if constexpr (D == 2) {
+            const int64_t adx = (*p[0])[0] - e[0], ady = (*p[0])[1] - e[1];
+            const int64_t bdx = (*p[1])[0] - e[0], bdy = (*p[1])[1] - e[1];
+            const int64_t cdx = (*p[2])[0] - e[0], cdy = (*p[2])[1] - e[1];
+            const int64_t alift = adx * adx + ady * ady;
+            const int64_t blift = bdx * bdx + bdy * bdy;
+            const int64_t clift = cdx * cdx + cdy * cdy;
+            const Int128 det = mul(alift, bdx * cdy - bdy * cdx)
+                + mul(blift, cdx * ady - cdy * adx)
+                + mul(clift, adx * bdy - ady * bdx);
+            return det.sign();
+        } else {
+            const int64_t aex = (*p[0])[0] - e[0], aey = (*p[0])[1] - e[1], aez = (*p[0])[2] - e[2];
+            const int64_t bex = (*p[1])[0] - e[0], bey = (*p[1])[1] - e[1], bez = (*p[1])[2] - e[2];
+            const int64_t cex = (*p[2])[0] - e[0], cey = (*p[2])[1] - e[1], cez = (*p[2])[2] - e[2];
+            const int64_t dex = (*p[3])[0] - e[0], dey = (*p[3])[1] - e[1], dez = (*p[3])[2] - e[2];
+
+            const int64_t ab = aex * bey - bex * aey;
+            const int64_t bc = bex * cey - cex * bey;
+            const int64_t cd = cex * dey - dex * cey;
+            const int64_t da = dex * aey - aex * dey;
+            const int64_t ac = aex * cey - cex * aey;
+            const int64_t bd = bex * dey - dex * bey;
+
+            const Int128 abc = mul(aez, bc) - mul(bez, ac) + mul(cez, ab);
+            const Int128 bcd = mul(bez, cd) - mul(cez, bd) + mul(dez, bc);
+            const Int128 cda = mul(cez, da) + mul(dez, ac) + mul(aez, cd);
+            const Int128 dab = mul(dez, ab) + mul(aez, bd) + mul(bez, da);
+
+            const int64_t alift = aex * aex + aey * aey + aez * aez;
+            const int64_t blift = bex * bex + bey * bey + bez * bez;
+            const int64_t clift = cex * cex + cey * cey + cez * cez;
+            const int64_t dlift = dex * dex + dey * dey + dez * dez;
+
+            const Int128 det = (mul(abc, dlift) - mul(dab, clift)) + (mul(cda, blift) - mul(bcd, alift));
+            return det.sign();
+        }
+    }
+
+    // =====================================================================
+    // Bowyer-Watson triangulator
+    // =====================================================================
+
+    constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * Incremental Delaunay triangulation of lattice points. Vertices
+     * 0..D are the enclosing simplex; every inserted vertex must lie
+     * strictly inside it and be distinct from all others.
+     */
+    template <int D>
+    class Triangulator {
+    public:
+        struct Simplex {
+            std::array<uint32_t, D + 1> v; ///< v[0] == NONE marks a free slot
+            std::array<uint32_t, D + 1> n; ///< n[i] is the neighbor opposite v[i]
+        };
+
+        explicit Triangulator(std::vector<Lattice<D>> vertices)
+            : m_vertices(std::move(vertices))
+        {
+            Simplex root {};
+            std::iota(root.v.begin(), root.v.end(), 0U);
+            root.n.fill(NONE);
+            m_simplices.push_back(root);
+            m_mark.push_back(0);
+        }
+
+        /// @return False if the vertex could not be placed.
+        bool insert(uint32_t vertex)
+        {
+            const Lattice<D>& p = m_vertices[vertex];
+
+            const uint32_t start = locate(p);
+            if (start == NONE || !in_conflict(m_simplices[start], p)) {
+                return false;
+            }
+
+            ++m_epoch;
+            const uint32_t inside = 2 * m_epoch;
+            const uint32_t outside = 2 * m_epoch + 1;
+
+            m_cavity.clear();
+            m_boundary.clear();
+            m_stack.assign(1, start);
+            m_mark[start] = inside;
+
+            while (!m_stack.empty()) {
+                const uint32_t c = m_stack.back();
+                m_stack.pop_back();
+                m_cavity.push_back(c);
+
+                for (uint32_t i = 0; i <= D; ++i) {
+                    const uint32_t nb = m_simplices[c].n[i];
+                    if (nb == NONE) {
+                        m_boundary.emplace_back(c, i);
+                    } else if (m_mark[nb] == inside) {
+                        continue;
+                    } else if (m_mark[nb] != outside && in_conflict(m_simplices[nb], p)) {
+                        m_mark[nb] = inside;
+                        m_stack.push_back(nb);
+                    } else {
+                        m_mark[nb] = outside;
+                        m_boundary.emplace_back(c, i);
+                    }
+                }
+            }
+
+            // One new simplex per boundary facet, joined to p.
+            m_created.clear();
+            m_ridges.clear();
+            for (const auto& [c, i] : m_boundary) {
+                Simplex s = m_simplices[c];
+                const uint32_t outer = s.n[i];
+                s.v[i] = vertex;
+                s.n.fill(NONE);
+                s.n[i] = outer;
+
+                const uint32_t id = allocate(s);
+                m_created.push_back(id);
+
+                if (outer != NONE) {
+                    for (auto& back : m_simplices[outer].n) {
+                        if (back == c) {
+                            back = id;
+                            break;
+                        }
+                    }
+                }
+
+                for (uint32_t j = 0; j <= D; ++j) {
+                    if (j != i) {
+                        m_ridges.push_back({ ridge_key(s, i, j), id, j });
+                    }
+                }
+            }
+
+            // Each ridge through p is shared by exactly two new simplices.
+            std::ranges::sort(m_ridges, {}, &Ridge::key);
+            for (size_t r = 0; r + 1 < m_ridges.size(); ++r) {
+                if (m_ridges[r].key == m_ridges[r + 1].key) {
+                    m_simplices[m_ridges[r].simplex].n[m_ridges[r].face] = m_ridges[r + 1].simplex;
+                    m_simplices[m_ridges[r + 1].simplex].n[m_ridges[r + 1].face] = m_ridges[r].simplex;
+                    ++r;
+                }
+            }
+
+            for (uint32_t c : m_cavity) {
+                m_simplices[c].v[0] = NONE;
+                m_free.push_back(c);
+            }
+
+            m_last = m_created.front();
+            return true;
+        }
+
+        /// Call fn(a, b) for every simplex edge between non-enclosing vertices (with repeats).
+        template <typename Fn>
+        void for_each_edge(Fn&& fn) const
+        {
+            for (const Simplex& s : m_simplices) {
+                if (s.v[0] == NONE) {
+                    continue;
+                }
+                for (uint32_t a = 0; a <= D; ++a) {
+                    for (uint32_t b = a + 1; b <= D; ++b) {
+                        if (s.v[a] > D && s.v[b] > D) {
+                            fn(s.v[a], s.v[b]);
+                        }
+                    }
+                }
+            }
+        }
+
+        [[nodiscard]] size_t simplex_count() const { return m_simplices.size() - m_free.size(); }
+
+    private:
+        struct Ridge {
+            uint64_t key;
+            uint32_t simplex;
+            uint32_t face;
+        };
+
+        std::vector<Lattice<D>> m_vertices;
+        std::vector<Simplex> m_simplices;
+        std::vector<uint32_t> m_mark;
+        std::vector<uint32_t> m_free;
+
+        std::vector<uint32_t> m_stack;
+        std::vector<uint32_t> m_cavity;
+        std::vector<std::pair<uint32_t, uint32_t>> m_boundary;
+        std::vector<uint32_t> m_created;
+        std::vector<Ridge> m_ridges;
+
+        uint32_t m_epoch {};
+        uint32_t m_last {};
+        uint32_t m_rotation {};
+
+        uint32_t allocate(const Simplex& s)
+        {
+            if (!m_free.empty()) {
+                const uint32_t id = m_free.back();
+                m_free.pop_back();
+                m_simplices[id] = s;
+                m_mark[id] = 0;
+                return id;
+            }
+            m_simplices.push_back(s);
+            m_mark.push_back(0);
+            return static_cast<uint32_t>(m_simplices.size() - 1);
+        }
+
+        /// Vertices of s other than v[i] and v[j], order-independent.
+        static uint64_t ridge_key(const Simplex& s, uint32_t i, uint32_t j)
+        {
+            if constexpr (D == 2) {
+                return s.v[3 - i - j];
+            } else {
+                std::array<uint32_t, 2> rest {};
+                size_t k = 0;
+                for (uint32_t m = 0; m <= D; ++m) {
+                    if (m != i && m != j) {
+                        rest[k++] = s.v[m];
+                    }
+                }
+                const auto [lo, hi] = std::minmax(rest[0], rest[1]);
+                return (static_cast<uint64_t>(lo) << 32) | hi;
+            }
+        }
+
+        std::array<const Lattice<D>*, D + 1> corners(const Simplex& s) const
+        {
+            std::array<const Lattice<D>*, D + 1> pts {};
+            for (uint32_t k = 0; k <= D; ++k) {
+                pts[k] = &m_vertices[s.v[k]];
+            }
+            return pts;
+        }
+
+        bool in_conflict(const Simplex& s, const Lattice<D>& p) const
+        {
+            return insphere<D>(corners(s), p) > 0;
+        }
+
+        /// Visibility walk with a rotating start facet; terminates on Delaunay triangulations.
+        uint32_t locate(const Lattice<D>& p)
+        {
+            uint32_t s = m_last;
+            const size_t max_steps = m_simplices.size() + 16;
+
+            for (size_t step = 0; step < max_steps; ++step) {
+                const Simplex& sx = m_simplices[s];
+                const uint32_t first = m_rotation++ % (D + 1);
+                bool moved = false;
+
+                for (uint32_t t = 0; t <= D; ++t) {
+                    const uint32_t i = (first + t) % (D + 1);
+                    auto pts = corners(sx);
+                    pts[i] = &p;
+                    if (orient<D>(pts) < 0) {
+                        s = sx.n[i];
+                        moved = true;
+                        break;
+                    }
+                }
+
+                if (!moved) {
+                    return s;
+                }
+                if (s == NONE) {
+                    return NONE;
+                }
+            }
+            return NONE;
+        }
+    };
+
+    // =====================================================================
+    // Driver
+    // =====================================================================
+
+    uint64_t morton_code(const int64_t* c, int dims, int bits_per_axis)
+    {
+        uint64_t code = 0;
+        for (int bit = bits_per_axis - 1; bit >= 0; --bit) {
+            for (int a = 0; a < dims; ++a) {
+                code = (code << 1) | static_cast<uint64_t>((c[a] >> bit) & 1);
+            }
+        }
+        return code;
+    }
+
+    /// Edges among coincident points, and every member of one site to every member of another.
+    EdgeList expand_sites(
+        const std::vector<std::pair<uint32_t, uint32_t>>& site_edges,
+        const std::vector<uint32_t>& members,
+        const std::vector<uint32_t>& site_start)
+    {
+        EdgeList edges;
+        edges.reserve(site_edges.size());
+
+        for (const auto& [sa, sb] : site_edges) {
+            for (uint32_t x = site_start[sa]; x < site_start[sa + 1]; ++x) {
+                for (uint32_t y = site_start[sb]; y < site_start[sb + 1]; ++y) {
+                    edges.emplace_back(std::minmax<size_t>(members[x], members[y]));
+                }
+            }
+        }
+
+        for (size_t site = 0; site + 1 < site_start.size(); ++site) {
+            for (uint32_t x = site_start[site]; x < site_start[site + 1]; ++x) {
+                for (uint32_t y = x + 1; y < site_start[site + 1]; ++y) {
+                    edges.emplace_back(std::minmax<size_t>(members[x], members[y]));
+                }
+            }
+        }
+
+        std::ranges::sort(edges);
+        edges.erase(std::ranges::unique(edges).begin(), edges.end());
+        return edges;
+    }
+
+    EdgeList delaunay_1d(const Eigen::MatrixXd& points)
+    {
+        const auto n = static_cast<uint32_t>(points.cols());
+        std::vector<uint32_t> members(n);
+        std::iota(members.begin(), members.end(), 0U);
+        std::ranges::stable_sort(members, {}, [&points](uint32_t i) { return points(0, i); });
+
+        std::vector<uint32_t> site_start { 0 };
+        for (uint32_t k = 1; k < n; ++k) {
+            if (points(0, members[k]) != points(0, members[k - 1])) {
+                site_start.push_back(k);
+            }
+        }
+        site_start.push_back(n);
+
+        std::vector<std::pair<uint32_t, uint32_t>> site_edges;
+        for (uint32_t s = 0; s + 2 < site_start.size(); ++s) {
+            site_edges.emplace_back(s, s + 1);
+        }
+        return expand_sites(site_edges, members, site_start);
+    }
+
+    template <int D>
+    EdgeList delaunay_nd(const Eigen::MatrixXd& points)
+    {
+        const auto n = static_cast<uint32_t>(points.cols());
+
+        if (!points.allFinite()) {
+            MF_WARN(Journal::Component::Kinesis, Journal::Context::Runtime,
+                "delaunay_edges: non-finite coordinates, no edges generated");
+            return {};
+        }
+
+        const Eigen::VectorXd lo = points.rowwise().minCoeff();
+        const Eigen::VectorXd hi = points.rowwise().maxCoeff();
+        const double extent = (hi - lo).maxCoeff();
+        const double scale = extent > 0.0 ? static_cast<double>(LATTICE_SPAN<D>) / extent : 0.0;
+
+        std::vector<Lattice<D>> lattice(n);
+        for (uint32_t i = 0; i < n; ++i) {
+            for (int a = 0; a < D; ++a) {
+                lattice[i][a] = std::llround((points(a, i) - lo(a)) * scale);
+            }
+        }
+
+        // Group coincident lattice points into sites.
+        std::vector<uint32_t> members(n);
+        std::iota(members.begin(), members.end(), 0U);
+        std::ranges::sort(members, [&lattice](uint32_t a, uint32_t b) {
+            return lattice[a] != lattice[b] ? lattice[a] < lattice[b] : a < b;
+        });
+
+        std::vector<uint32_t> site_start { 0 };
+        for (uint32_t k = 1; k < n; ++k) {
+            if (lattice[members[k]] != lattice[members[k - 1]]) {
+                site_start.push_back(k);
+            }
+        }
+        site_start.push_back(n);
+        const auto site_count = static_cast<uint32_t>(site_start.size() - 1);
+
+        // Enclosing simplex: inradius covers the ball of radius (lattice diagonal)
+        // around the center, which contains every diametral ball.
+        const double radius = 1.05 * static_cast<double>(LATTICE_SPAN<D>) * std::sqrt(static_cast<double>(D));
+        std::array<double, D> center {};
+        for (int a = 0; a < D; ++a) {
+            center[a] = 0.5 * (hi(a) - lo(a)) * scale;
+        }
+
+        std::vector<Lattice<D>> vertices;
+        vertices.reserve(D + 1 + site_count);
+
+        if constexpr (D == 2) {
+            const double r = 2.0 * radius;
+            for (const double angle : { 90.0, 210.0, 330.0 }) {
+                const double t = angle * std::numbers::pi / 180.0;
+                vertices.push_back({ std::llround(center[0] + r * std::cos(t)),
+                    std::llround(center[1] + r * std::sin(t)) });
+            }
+        } else {
+            const double r = std::sqrt(3.0) * radius;
+            constexpr std::array<std::array<double, 3>, 4> dirs { {
+                { 1, 1, 1 }, { 1, -1, -1 }, { -1, 1, -1 }, { -1, -1, 1 } } };
+            for (const auto& d : dirs) {
+                vertices.push_back({ std::llround(center[0] + r * d[0]),
+                    std::llround(center[1] + r * d[1]),
+                    std::llround(center[2] + r * d[2]) });
+            }
+            const std::array<const Lattice<3>*, 4> root { &vertices[0], &vertices[1], &vertices[2], &vertices[3] };
+            if (orient<3>(root) < 0) {
+                std::swap(vertices[0], vertices[1]);
+            }
+        }
+
+        for (uint32_t s = 0; s < site_count; ++s) {
+            vertices.push_back(lattice[members[site_start[s]]]);
+        }
+
+        // Spatially coherent insertion keeps point location walks short.
+        constexpr int morton_bits = D == 2 ? 26 : 20;
+        std::vector<std::pair<uint64_t, uint32_t>> insertion(site_count);
+        for (uint32_t s = 0; s < site_count; ++s) {
+            insertion[s] = { morton_code(vertices[D + 1 + s].data(), D, morton_bits), D + 1 + s };
+        }
+        std::ranges::sort(insertion);
+
+        Triangulator<D> tri(std::move(vertices));
+        size_t failed = 0;
+        for (const auto& [code, vertex] : insertion) {
+            if (!tri.insert(vertex)) {
+                ++failed;
+            }
+        }
+
+        if (failed > 0) {
+            MF_WARN(Journal::Component::Kinesis, Journal::Context::Runtime,
+                "delaunay_edges: {} of {} sites could not be inserted", failed, site_count);
+        }
+
+        std::vector<std::pair<uint32_t, uint32_t>> site_edges;
+        site_edges.reserve(tri.simplex_count() * (D + 1) * D / 2);
+        tri.for_each_edge([&](uint32_t a, uint32_t b) {
+            site_edges.emplace_back(std::minmax(a - (D + 1), b - (D + 1)));
+        });
+        std::ranges::sort(site_edges);
+        site_edges.erase(std::ranges::unique(site_edges).begin(), site_edges.end());
+
+        return expand_sites(site_edges, members, site_start);
+    }
+
+} // namespace
+
+EdgeList delaunay_edges(const Eigen::MatrixXd& points)
+{
+    if (points.cols() < 2) {
+        return {};
+    }
+
+    switch (points.rows()) {
+    case 1:
+        return delaunay_1d(points);
+    case 2:
+        return delaunay_nd<2>(points);
+    case 3:
+        return delaunay_nd<3>(points);
+    default:
+        MF_WARN(Journal::Component::Kinesis, Journal::Context::Runtime,
+            "delaunay_edges: {} dimensions not supported", points.rows());
+        return {};
+    }
+}
+
+} // namespace MayaFlux::Kinesis
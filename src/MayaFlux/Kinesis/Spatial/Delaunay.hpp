@@ -0,0 +1,31 @@
+#pragma once
+
+#include "ProximityGraphs.hpp"
+
+namespace MayaFlux::Kinesis {
+
+/**
+ * @brief Unique edges of a Delaunay triangulation of the columns of @p points.
+ * @param points 1xN, 2xN or 3xN matrix, one point per column.
+ * @return Undirected edges (i < j) in lexicographic order. Empty for other
+ *         dimensionalities or fewer than two points.
+ *
+ * Bowyer-Watson insertion in Morton order with a visibility walk for point
+ * location. Coordinates are snapped to a uniform integer lattice spanning
+ * the bounding box (2^26 steps in 2D, 2^20 in 3D) so that orientation and
+ * in-sphere predicates are evaluated exactly in integer arithmetic; the
+ * triangulation therefore never degenerates, including for cocircular or
+ * gridded input. Points that snap to the same lattice site are inserted
+ * once: every one of them receives the representative's edges, and they are
+ * connected to each other.
+ *
+ * The enclosing simplex lies outside the diametral ball of every point
+ * pair, so every Gabriel edge of the input, and hence every relative
+ * neighborhood and Euclidean minimum spanning tree edge, is present.
+ * Convex hull edges with very large empty circumspheres may be absent.
+ *
+ * Complexity: O(n log n) expected for well-distributed input.
+ */
+MAYAFLUX_API EdgeList delaunay_edges(const Eigen::MatrixXd& points);
+
+} // namespace MayaFlux::Kinesis
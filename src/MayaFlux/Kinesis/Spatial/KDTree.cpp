@@ -0,0 +1,132 @@
+#include "KDTree.hpp"
+
+namespace MayaFlux::Kinesis {
+
+KDTree::KDTree(const Eigen::MatrixXd& points, uint32_t leaf_size)
+    : m_dims(static_cast<uint32_t>(points.rows()))
+    , m_leaf_size(std::max(leaf_size, 1U))
+{
+    const auto n = static_cast<uint32_t>(points.cols());
+    if (n == 0 || m_dims == 0) {
+        return;
+    }
+
+    m_order.resize(n);
+    std::iota(m_order.begin(), m_order.end(), 0U);
+    m_nodes.reserve(2 * (n / m_leaf_size + 1));
+    build(0, n, points);
+
+    m_coords.resize(static_cast<size_t>(n) * m_dims);
+    for (uint32_t pos = 0; pos < n; ++pos) {
+        const double* src = points.col(m_order[pos]).data();
+        std::copy(src, src + m_dims, m_coords.data() + static_cast<size_t>(pos) * m_dims);
+    }
+}
+
+uint32_t KDTree::build(uint32_t begin, uint32_t end, const Eigen::MatrixXd& points)
+{
+    const auto id = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.push_back({ .begin = begin, .end = end });
+
+    if (end - begin <= m_leaf_size) {
+        return id;
+    }
+
+    uint32_t axis = 0;
+    double widest = -1.0;
+    for (uint32_t a = 0; a < m_dims; ++a) {
+        double lo = std::numeric_limits<double>::max();
+        double hi = std::numeric_limits<double>::lowest();
+        for (uint32_t i = begin; i < end; ++i) {
+            const double v = points(a, m_order[i]);
+            lo = std::min(lo, v);
+            hi = std::max(hi, v);
+        }
+        if (hi - lo > widest) {
+            widest = hi - lo;
+            axis = a;
+        }
+    }
+
+    // All points coincide: splitting cannot separate them.
+    if (widest <= 0.0) {
+        return id;
+    }
+
+    const uint32_t mid = begin + (end - begin) / 2;
+    std::nth_element(m_order.begin() + begin, m_order.begin() + mid, m_order.begin() + end,
+        [&points, axis](uint32_t a, uint32_t b) { return points(axis, a) < points(axis, b); });
+
+    const double split = points(axis, m_order[mid]);
+    const uint32_t left = build(begin, mid, points);
+    const uint32_t right = build(mid, end, points);
+
+    Node& node = m_nodes[id];
+    node.left = left;
+    node.right = right;
+    node.axis = axis;
+    node.split = split;
+    return id;
+}
+
+void KDTree::k_nearest(const double* query, size_t k, std::vector<Neighbor>& out, size_t exclude) const
+{
+    out.clear();
+    if (k == 0 || m_nodes.empty()) {
+        return;
+    }
+
+    // Max-heap on (distance, index); the root is the current k-th best.
+    auto offer = [&](double d, size_t index) {
+        const Neighbor candidate { d, index };
+        if (out.size() < k) {
+            out.push_back(candidate);
+            std::ranges::push_heap(out);
+        } else if (candidate < out.front()) {
+            std::ranges::pop_heap(out);
+            out.back() = candidate;
+            std::ranges::push_heap(out);
+        }
+    };
+
+    auto bound = [&]() {
+        return out.size() < k ? std::numeric_limits<double>::max() : out.front().first;
+    };
+
+    struct Pending {
+        uint32_t node;
+        double plane_sq;
+    };
+    std::array<Pending, 64> stack {};
+    size_t top = 0;
+    stack[top++] = { 0, 0.0 };
+
+    while (top > 0) {
+        const Pending item = stack[--top];
+        // Equal distances may still win on index, so prune strictly.
+        if (item.plane_sq > bound()) {
+            continue;
+        }
+
+        const Node& node = m_nodes[item.node];
+        if (node.left == 0) {
+            for (uint32_t pos = node.begin; pos < node.end; ++pos) {
+                const size_t index = m_order[pos];
+                if (index != exclude) {
+                    offer(distance_sq(query, pos), index);
+                }
+            }
+            continue;
+        }
+
+        const double diff = query[node.axis] - node.split;
+        const uint32_t near = diff < 0.0 ? node.left : node.right;
+        const uint32_t far = diff < 0.0 ? node.right : node.left;
+        stack[top++] = { far, std::max(item.plane_sq, diff * diff) };
+        stack[top++] = { near, item.plane_sq };
+    }
+
+    std::ranges::sort_heap(out);
+}
+
+} // namespace MayaFlux::Kinesis
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <Eigen/Core>
+
+namespace MayaFlux::Kinesis {
+
+/**
+ * @class KDTree
+ * @brief Static k-d tree over the columns of a DxN point matrix.
+ *
+ * Built once in O(n log n) by median splits on the axis of widest spread.
+ * Points are copied into leaf order so each leaf scans a contiguous block.
+ * Queries are const and safe to run concurrently from any number of threads.
+ *
+ * Distances are squared Euclidean. Ties in k_nearest() are broken by the
+ * lower point index, so results are deterministic and match a brute-force
+ * sort on (distance, index).
+ */
+class MAYAFLUX_API KDTree {
+public:
+    static constexpr size_t npos = std::numeric_limits<size_t>::max();
+
+    /// @brief (squared distance, point index)
+    using Neighbor = std::pair<double, size_t>;
+
+    /**
+     * @brief Build over the columns of @p points.
+     * @param points DxN matrix, one point per column.
+     * @param leaf_size Maximum points per leaf.
+     */
+    explicit KDTree(const Eigen::MatrixXd& points, uint32_t leaf_size = 12);
+
+    [[nodiscard]] size_t size() const { return m_order.size(); }
+    [[nodiscard]] uint32_t dimensions() const { return m_dims; }
+
+    /**
+     * @brief The k nearest points to @p query, ascending by (distance, index).
+     * @param query Pointer to dimensions() coordinates.
+     * @param k Maximum number of neighbors.
+     * @param out Cleared and filled with at most k neighbors.
+     * @param exclude Point index to skip (typically the query's own index).
+     */
+    void k_nearest(const double* query, size_t k, std::vector<Neighbor>& out, size_t exclude = npos) const;
+
+    /**
+     * @brief Visit every point whose squared distance to @p query is <= @p radius_sq.
+     * @param fn Called as fn(index, distance_sq); return false to stop early.
+     * @return False if @p fn stopped the traversal.
+     */
+    template <typename Fn>
+    bool visit_radius(const double* query, double radius_sq, Fn&& fn) const;
+
+private:
+    struct Node {
+        uint32_t begin {};
+        uint32_t end {};
+        uint32_t left {}; ///< 0 for leaves
+        uint32_t right {};
+        uint32_t axis {};
+        double split {};
+    };
+
+    uint32_t m_dims {};
+    uint32_t m_leaf_size {};
+    std::vector<double> m_coords; ///< Point coordinates in leaf order, m_dims per point.
+    std::vector<uint32_t> m_order; ///< Leaf-order position -> original index.
+    std::vector<Node> m_nodes;
+
+    uint32_t build(uint32_t begin, uint32_t end, const Eigen::MatrixXd& points);
+
+    [[nodiscard]] double distance_sq(const double* query, uint32_t pos) const
+    {
+        const double* p = m_coords.data() + static_cast<size_t>(pos) * m_dims;
+        double d = 0.0;
+        for (uint32_t a = 0; a < m_dims; ++a) {
+            const double t = p[a] - query[a];
+            d += t * t;
+        }
+        return d;
+    }
+};
+
+template <typename Fn>
+bool KDTree::visit_radius(const double* query, double radius_sq, Fn&& fn) const
+{
+    if (m_nodes.empty()) {
+        return true;
+    }
+
+    std::array<uint32_t, 64> stack {};
+    size_t top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const Node& node = m_nodes[stack[--top]];
+
+        if (node.left == 0) {
+            for (uint32_t pos = node.begin; pos < node.end; ++pos) {
+                const double d = distance_sq(query, pos);
+                if (d <= radius_sq && !fn(static_cast<size_t>(m_order[pos]), d)) {
+                    return false;
+                }
+            }
+            continue;
+        }
+
+        const double diff = query[node.axis] - node.split;
+        const uint32_t near = diff < 0.0 ? node.left : node.right;
+        const uint32_t far = diff < 0.0 ? node.right : node.left;
+        if (diff * diff <= radius_sq) {
+            stack[top++] = far;
+        }
+        stack[top++] = near;
+    }
+
+    return true;
+}
+
+} // namespace MayaFlux::Kinesis
@@ -1,11 +1,18 @@
 #include "ProximityGraphs.hpp"
 
+#include "Delaunay.hpp"
+#include "KDTree.hpp"
+
 #include "MayaFlux/Journal/Archivist.hpp"
+#include "MayaFlux/Transitive/Parallel/Execution.hpp"
+
 #include <queue>
 
 namespace MayaFlux::Kinesis {
 
 namespace {
+    constexpr size_t POINT_BLOCK = 256;
+
     double distance_squared(const Eigen::VectorXd& a, const Eigen::VectorXd& b)
     {
         return (b - a).squaredNorm();
@@ -16,11 +23,222 @@ namespace {
         return (b - a).norm();
     }
 
+    double distance_squared(const double* a, const double* b, Eigen::Index dims)
+    {
+        double d = 0.0;
+        for (Eigen::Index k = 0; k < dims; ++k) {
+            const double t = b[k] - a[k];
+            d += t * t;
+        }
+        return d;
+    }
+
     struct Edge {
         size_t a, b;
         double weight;
         bool operator>(const Edge& other) const { return weight > other.weight; }
     };
+
+    /**
+     * @brief r lies in the closed diametral ball of (p, q).
+     *
+     * Points coincident with p or q are treated as the same site and never
+     * block, matching how delaunay_edges() groups duplicates.
+     */
+    bool blocks_gabriel(double pr_sq, double qr_sq, double pq_sq)
+    {
+        return pr_sq > 0.0 && qr_sq > 0.0 && pr_sq + qr_sq <= pq_sq;
+    }
+
+    /// r lies in the open lune of (p, q).
+    bool blocks_relative(double pr_sq, double qr_sq, double pq_sq)
+    {
+        return std::max(pr_sq, qr_sq) < pq_sq;
+    }
+
+    /**
+     * @brief Run emit(i, out) for every index in [0, count) in parallel blocks.
+     * @return Concatenation of every block's output, in index order.
+     */
+    template <typename Fn>
+    EdgeList collect_parallel(size_t count, Fn&& emit)
+    {
+        const size_t blocks = (count + POINT_BLOCK - 1) / POINT_BLOCK;
+        std::vector<EdgeList> block_edges(blocks);
+
+        Parallel::for_each(Parallel::par,
+            std::views::iota(size_t { 0 }, blocks).begin(),
+            std::views::iota(size_t { 0 }, blocks).end(),
+            [&](size_t b) {
+                const size_t end = std::min(count, (b + 1) * POINT_BLOCK);
+                for (size_t i = b * POINT_BLOCK; i < end; ++i) {
+                    emit(i, block_edges[b]);
+                }
+            });
+
+        size_t total = 0;
+        for (const auto& e : block_edges) {
+            total += e.size();
+        }
+
+        EdgeList edges;
+        edges.reserve(total);
+        for (const auto& e : block_edges) {
+            edges.insert(edges.end(), e.begin(), e.end());
+        }
+        return edges;
+    }
+
+    /// Delaunay triangulation is available for these dimensionalities.
+    bool has_delaunay(const Eigen::MatrixXd& points)
+    {
+        return points.rows() >= 1 && points.rows() <= 3;
+    }
+
+    /// Keep the Delaunay edges for which no point blocks the diametral ball.
+    EdgeList gabriel_from_delaunay(const Eigen::MatrixXd& points, const KDTree& tree)
+    {
+        const EdgeList candidates = delaunay_edges(points);
+        const Eigen::Index dims = points.rows();
+
+        return collect_parallel(candidates.size(), [&](size_t e, EdgeList& out) {
+            const auto [i, j] = candidates[e];
+            const double* p = points.col(static_cast<Eigen::Index>(i)).data();
+            const double* q = points.col(static_cast<Eigen::Index>(j)).data();
+            const double pq_sq = distance_squared(p, q, dims);
+
+            std::array<double, 3> mid {};
+            for (Eigen::Index k = 0; k < dims; ++k) {
+                mid[k] = 0.5 * (p[k] + q[k]);
+            }
+
+            // Slightly inflated so rounding never hides a point on the sphere;
+            // the exact test below decides.
+            const double search_sq = 0.25 * pq_sq * (1.0 + 1e-9);
+
+            const bool empty = tree.visit_radius(mid.data(), search_sq, [&](size_t r, double) {
+                if (r == i || r == j) {
+                    return true;
+                }
+                const double* pr = points.col(static_cast<Eigen::Index>(r)).data();
+                return !blocks_gabriel(distance_squared(p, pr, dims), distance_squared(q, pr, dims), pq_sq);
+            });
+
+            if (empty) {
+                out.emplace_back(i, j);
+            }
+        });
+    }
+
+    // =====================================================================
+    // Brute-force fallbacks for dimensions without a triangulation
+    // =====================================================================
+
+    EdgeList brute_minimum_spanning_tree(const Eigen::MatrixXd& points)
+    {
+        Eigen::Index n = points.cols();
+
+        EdgeList mst_edges;
+        mst_edges.reserve(n - 1);
+
+        std::vector<bool> in_mst(n, false);
+        std::priority_queue<Edge, std::vector<Edge>, std::greater<>> pq;
+
+        in_mst[0] = true;
+
+        for (Eigen::Index j = 1; j < n; ++j) {
+            double dist = distance(points.col(0), points.col(j));
+            pq.push({ 0, static_cast<size_t>(j), dist });
+        }
+
+        while (!pq.empty() && mst_edges.size() < static_cast<size_t>(n - 1)) {
+            Edge e = pq.top();
+            pq.pop();
+
+            if (in_mst[e.b])
+                continue;
+
+            mst_edges.emplace_back(e.a, e.b);
+            in_mst[e.b] = true;
+
+            for (Eigen::Index j = 0; j < n; ++j) {
+                if (!in_mst[j]) {
+                    double dist = distance(points.col(e.b), points.col(j));
+                    pq.push({ e.b, static_cast<size_t>(j), dist });
+                }
+            }
+        }
+
+        return mst_edges;
+    }
+
+    EdgeList brute_gabriel_graph(const Eigen::MatrixXd& points)
+    {
+        Eigen::Index n = points.cols();
+        EdgeList edges;
+
+        for (Eigen::Index i = 0; i < n; ++i) {
+            for (Eigen::Index j = i + 1; j < n; ++j) {
+                Eigen::VectorXd p = points.col(i);
+                Eigen::VectorXd q = points.col(j);
+
+                double pq_dist_sq = distance_squared(p, q);
+                bool is_gabriel_edge = true;
+
+                for (Eigen::Index k = 0; k < n; ++k) {
+                    if (k == i || k == j)
+                        continue;
+
+                    Eigen::VectorXd r = points.col(k);
+
+                    if (blocks_gabriel(distance_squared(p, r), distance_squared(q, r), pq_dist_sq)) {
+                        is_gabriel_edge = false;
+                        break;
+                    }
+                }
+
+                if (is_gabriel_edge) {
+                    edges.emplace_back(static_cast<size_t>(i), static_cast<size_t>(j));
+                }
+            }
+        }
+
+        return edges;
+    }
+
+    EdgeList brute_relative_neighborhood_graph(const Eigen::MatrixXd& points)
+    {
+        Eigen::Index n = points.cols();
+        EdgeList edges;
+
+        for (Eigen::Index i = 0; i < n; ++i) {
+            for (Eigen::Index j = i + 1; j < n; ++j) {
+                Eigen::VectorXd p = points.col(i);
+                Eigen::VectorXd q = points.col(j);
+
+                double pq_dist_sq = distance_squared(p, q);
+                bool is_rng_edge = true;
+
+                for (Eigen::Index k = 0; k < n; ++k) {
+                    if (k == i || k == j)
+                        continue;
+
+                    Eigen::VectorXd r = points.col(k);
+
+                    if (blocks_relative(distance_squared(p, r), distance_squared(q, r), pq_dist_sq)) {
+                        is_rng_edge = false;
+                        break;
+                    }
+                }
+
+                if (is_rng_edge) {
+                    edges.emplace_back(static_cast<size_t>(i), static_cast<size_t>(j));
+                }
+            }
+        }
+
+        return edges;
+    }
 }
 
 EdgeList sequential_chain(const Eigen::MatrixXd& points)
@@ -54,29 +272,15 @@ EdgeList k_nearest_neighbors(
 
     k = std::min(k, static_cast<size_t>(n - 1));
 
-    EdgeList edges;
-    edges.reserve(n * k);
-
-    for (Eigen::Index i = 0; i < n; ++i) {
-        std::vector<std::pair<double, size_t>> distances;
-        distances.reserve(n - 1);
+    const KDTree tree(points);
 
-        for (Eigen::Index j = 0; j < n; ++j) {
-            if (i == j)
-                continue;
-            double dist_sq = distance_squared(points.col(i), points.col(j));
-            distances.emplace_back(dist_sq, static_cast<size_t>(j));
+    EdgeList edges = collect_parallel(static_cast<size_t>(n), [&](size_t i, EdgeList& out) {
+        thread_local std::vector<KDTree::Neighbor> neighbors;
+        tree.k_nearest(points.col(static_cast<Eigen::Index>(i)).data(), k, neighbors, i);
+        for (const auto& [dist_sq, j] : neighbors) {
+            out.emplace_back(i, j);
         }
-
-        std::partial_sort(
-            distances.begin(),
-            distances.begin() + k,
-            distances.end());
-
-        for (size_t neighbor_idx = 0; neighbor_idx < k; ++neighbor_idx) {
-            edges.emplace_back(static_cast<size_t>(i), distances[neighbor_idx].second);
-        }
-    }
+    });
 
     MF_DEBUG(Journal::Component::Kinesis, Journal::Context::Runtime,
         "k_nearest_neighbors: {} points, k={}, generated {} edges",
@@ -95,16 +299,18 @@ EdgeList radius_threshold_graph(
     }
 
     double radius_sq = radius * radius;
-    EdgeList edges;
+    const KDTree tree(points);
 
-    for (Eigen::Index i = 0; i < n; ++i) {
-        for (Eigen::Index j = i + 1; j < n; ++j) {
-            double dist_sq = distance_squared(points.col(i), points.col(j));
-            if (dist_sq <= radius_sq) {
-                edges.emplace_back(static_cast<size_t>(i), static_cast<size_t>(j));
+    EdgeList edges = collect_parallel(static_cast<size_t>(n), [&](size_t i, EdgeList& out) {
+        const size_t first = out.size();
+        tree.visit_radius(points.col(static_cast<Eigen::Index>(i)).data(), radius_sq, [&](size_t j, double) {
+            if (j > i) {
+                out.emplace_back(i, j);
             }
-        }
-    }
+            return true;
+        });
+        std::sort(out.begin() + static_cast<std::ptrdiff_t>(first), out.end());
+    });
 
     MF_DEBUG(Journal::Component::Kinesis, Journal::Context::Runtime,
         "radius_threshold_graph: {} points, radius={:.3f}, generated {} edges",
@@ -120,34 +326,55 @@ EdgeList minimum_spanning_tree(const Eigen::MatrixXd& points)
         return {};
     }
 
-    EdgeList mst_edges;
-    mst_edges.reserve(n - 1);
-
-    std::vector<bool> in_mst(n, false);
-    std::priority_queue<Edge, std::vector<Edge>, std::greater<>> pq;
-
-    in_mst[0] = true;
-
-    for (Eigen::Index j = 1; j < n; ++j) {
-        double dist = distance(points.col(0), points.col(j));
-        pq.push({ 0, static_cast<size_t>(j), dist });
+    if (!has_delaunay(points)) {
+        EdgeList mst_edges = brute_minimum_spanning_tree(points);
+        MF_DEBUG(Journal::Component::Kinesis, Journal::Context::Runtime,
+            "minimum_spanning_tree: {} points, generated {} edges",
+            n, mst_edges.size());
+        return mst_edges;
     }
 
-    while (!pq.empty() && mst_edges.size() < static_cast<size_t>(n - 1)) {
-        Edge e = pq.top();
-        pq.pop();
+    // Kruskal over the Delaunay edges, which contain every EMST edge.
+    const EdgeList candidates = delaunay_edges(points);
+    std::vector<Edge> weighted(candidates.size());
+
+    Parallel::for_each(Parallel::par,
+        std::views::iota(size_t { 0 }, candidates.size()).begin(),
+        std::views::iota(size_t { 0 }, candidates.size()).end(),
+        [&](size_t e) {
+            const auto [i, j] = candidates[e];
+            weighted[e] = { i, j,
+                distance_squared(points.col(static_cast<Eigen::Index>(i)).data(),
+                    points.col(static_cast<Eigen::Index>(j)).data(), points.rows()) };
+        });
+
+    std::ranges::sort(weighted, [](const Edge& a, const Edge& b) {
+        return std::tie(a.weight, a.a, a.b) < std::tie(b.weight, b.a, b.b);
+    });
+
+    std::vector<size_t> parent(static_cast<size_t>(n));
+    std::iota(parent.begin(), parent.end(), size_t { 0 });
+    auto find = [&parent](size_t x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    };
+
+    EdgeList mst_edges;
+    mst_edges.reserve(n - 1);
 
-        if (in_mst[e.b])
+    for (const Edge& e : weighted) {
+        const size_t ra = find(e.a);
+        const size_t rb = find(e.b);
+        if (ra == rb) {
             continue;
-
+        }
+        parent[ra] = rb;
         mst_edges.emplace_back(e.a, e.b);
-        in_mst[e.b] = true;
-
-        for (Eigen::Index j = 0; j < n; ++j) {
-            if (!in_mst[j]) {
-                double dist = distance(points.col(e.b), points.col(j));
-                pq.push({ e.b, static_cast<size_t>(j), dist });
-            }
+        if (mst_edges.size() == static_cast<size_t>(n - 1)) {
+            break;
         }
     }
 
@@ -165,36 +392,9 @@ EdgeList gabriel_graph(const Eigen::MatrixXd& points)
         return {};
     }
 
-    EdgeList edges;
-
-    for (Eigen::Index i = 0; i < n; ++i) {
-        for (Eigen::Index j = i + 1; j < n; ++j) {
-            Eigen::VectorXd p = points.col(i);
-            Eigen::VectorXd q = points.col(j);
-
-            double pq_dist_sq = distance_squared(p, q);
-            bool is_gabriel_edge = true;
-
-            for (Eigen::Index k = 0; k < n; ++k) {
-                if (k == i || k == j)
-                    continue;
-
-                Eigen::VectorXd r = points.col(k);
-
-                double pr_dist_sq = distance_squared(p, r);
-                double qr_dist_sq = distance_squared(q, r);
-
-                if (pr_dist_sq + qr_dist_sq < pq_dist_sq) {
-                    is_gabriel_edge = false;
-                    break;
-                }
-            }
-
-            if (is_gabriel_edge) {
-                edges.emplace_back(static_cast<size_t>(i), static_cast<size_t>(j));
-            }
-        }
-    }
+    EdgeList edges = has_delaunay(points)
+        ? gabriel_from_delaunay(points, KDTree(points))
+        : brute_gabriel_graph(points);
 
     MF_DEBUG(Journal::Component::Kinesis, Journal::Context::Runtime,
         "gabriel_graph: {} points, generated {} edges",
@@ -210,28 +410,15 @@ EdgeList nearest_neighbor_graph(const Eigen::MatrixXd& points)
         return {};
     }
 
-    EdgeList edges;
-    edges.reserve(n);
+    const KDTree tree(points);
 
-    for (Eigen::Index i = 0; i < n; ++i) {
-        double min_dist_sq = std::numeric_limits<double>::max();
-        size_t nearest = i;
-
-        for (Eigen::Index j = 0; j < n; ++j) {
-            if (i == j)
-                continue;
-
-            double dist_sq = distance_squared(points.col(i), points.col(j));
-            if (dist_sq < min_dist_sq) {
-                min_dist_sq = dist_sq;
-                nearest = static_cast<size_t>(j);
-            }
+    EdgeList edges = collect_parallel(static_cast<size_t>(n), [&](size_t i, EdgeList& out) {
+        thread_local std::vector<KDTree::Neighbor> nearest;
+        tree.k_nearest(points.col(static_cast<Eigen::Index>(i)).data(), 1, nearest, i);
+        if (!nearest.empty()) {
+            out.emplace_back(i, nearest.front().second);
         }
-
-        if (nearest != static_cast<size_t>(i)) {
-            edges.emplace_back(static_cast<size_t>(i), nearest);
-        }
-    }
+    });
 
     MF_DEBUG(Journal::Component::Kinesis, Journal::Context::Runtime,
         "nearest_neighbor_graph: {} points, generated {} edges", n, edges.size());
@@ -246,38 +433,37 @@ EdgeList relative_neighborhood_graph(const Eigen::MatrixXd& points)
         return {};
     }
 
-    EdgeList edges;
-
-    for (Eigen::Index i = 0; i < n; ++i) {
-        for (Eigen::Index j = i + 1; j < n; ++j) {
-            Eigen::VectorXd p = points.col(i);
-            Eigen::VectorXd q = points.col(j);
-
-            double pq_dist = distance(p, q);
-            bool is_rng_edge = true;
-
-            for (Eigen::Index k = 0; k < n; ++k) {
-                if (k == i || k == j)
-                    continue;
-
-                Eigen::VectorXd r = points.col(k);
+    if (!has_delaunay(points)) {
+        EdgeList edges = brute_relative_neighborhood_graph(points);
+        MF_DEBUG(Journal::Component::Kinesis, Journal::Context::Runtime,
+            "relative_neighborhood_graph: {} points, generated {} edges",
+            n, edges.size());
+        return edges;
+    }
 
-                double pr_dist = distance(p, r);
-                double qr_dist = distance(q, r);
+    // Every RNG edge is a Gabriel edge; test the lune of each.
+    const KDTree tree(points);
+    const EdgeList candidates = gabriel_from_delaunay(points, tree);
+    const Eigen::Index dims = points.rows();
 
-                double max_dist = std::max(pr_dist, qr_dist);
+    EdgeList edges = collect_parallel(candidates.size(), [&](size_t e, EdgeList& out) {
+        const auto [i, j] = candidates[e];
+        const double* p = points.col(static_cast<Eigen::Index>(i)).data();
+        const double* q = points.col(static_cast<Eigen::Index>(j)).data();
+        const double pq_sq = distance_squared(p, q, dims);
 
-                if (max_dist < pq_dist) {
-                    is_rng_edge = false;
-                    break;
-                }
+        const bool empty = tree.visit_radius(p, pq_sq, [&](size_t r, double pr_sq) {
+            if (r == i || r == j) {
+                return true;
             }
+            const double* rp = points.col(static_cast<Eigen::Index>(r)).data();
+            return !blocks_relative(pr_sq, distance_squared(q, rp, dims), pq_sq);
+        });
 
-            if (is_rng_edge) {
-                edges.emplace_back(static_cast<size_t>(i), static_cast<size_t>(j));
-            }
+        if (empty) {
+            out.emplace_back(i, j);
         }
-    }
+    });
 
     MF_DEBUG(Journal::Component::Kinesis, Journal::Context::Runtime,
         "relative_neighborhood_graph: {} points, generated {} edges",
@@ -44,9 +44,11 @@ MAYAFLUX_API EdgeList sequential_chain(const Eigen::MatrixXd& points);
  *
  * For each point, connects it to its k nearest neighbors.
  * Directed graph: point i connects to k neighbors, but neighbor j
- * might not reciprocally connect to i.
+ * might not reciprocally connect to i. Neighbors are listed nearest
+ * first, ties broken by lower index.
  *
- * Complexity: O(n² log k) with partial sort
+ * Complexity: O(n log n) k-d tree build, O(k log n) expected per point,
+ * queries run in parallel
  */
 MAYAFLUX_API EdgeList k_nearest_neighbors(
     const Eigen::MatrixXd& points,
@@ -61,21 +63,26 @@ MAYAFLUX_API EdgeList k_nearest_neighbors(
  * Connects all point pairs within radius distance.
  * Undirected graph: if (i,j) exists, edge appears once.
  *
- * Complexity: O(n²) brute force
+ * Complexity: O(n log n + m) with k-d tree range queries run in parallel,
+ * where m is the number of edges
  */
 MAYAFLUX_API EdgeList radius_threshold_graph(
     const Eigen::MatrixXd& points,
     double radius);
 
 /**
- * @brief Compute minimum spanning tree (Prim's algorithm)
+ * @brief Compute Euclidean minimum spanning tree
  * @param points DxN matrix where each column is a point
  * @return Edge list forming MST
  *
  * Returns exactly (n-1) edges forming tree of minimum total length
  * that connects all points. Undirected acyclic graph.
  *
- * Complexity: O(n² log n) with priority queue
+ * For 1-3 dimensions, Kruskal's algorithm runs over the Delaunay edges
+ * (see delaunay_edges()) and edges are returned in ascending length.
+ * Higher dimensions fall back to Prim's algorithm.
+ *
+ * Complexity: O(n log n) for 1-3 dimensions, O(n² log n) otherwise
  */
 MAYAFLUX_API EdgeList minimum_spanning_tree(const Eigen::MatrixXd& points);
 
@@ -91,9 +98,13 @@ MAYAFLUX_API EdgeList minimum_spanning_tree(const Eigen::MatrixXd& points);
  * Two points p and q are connected if and only if the closed disk
  * having the line segment pq as diameter contains no other points.
  *
- * Equivalently: |p-r|² + |q-r|² ≥ |p-q|² for all r ∈ P \ {p,q}
+ * Equivalently: |p-r|² + |q-r|² > |p-q|² for all r ∈ P \ {p,q}
+ * not coincident with p or q.
+ *
+ * For 1-3 dimensions the candidates are the Delaunay edges, each tested
+ * in parallel with a k-d tree query over its diametral ball.
  *
- * Complexity: O(n³) with naive geometric tests
+ * Complexity: O(n log n) for 1-3 dimensions, O(n³) otherwise
  */
 MAYAFLUX_API EdgeList gabriel_graph(const Eigen::MatrixXd& points);
 
@@ -106,7 +117,7 @@ MAYAFLUX_API EdgeList gabriel_graph(const Eigen::MatrixXd& points);
  * Directed graph: point i connects to nearest neighbor j, but j may
  * connect to a different point k.
  *
- * Complexity: O(n²) brute force
+ * Complexity: O(n log n) with parallel k-d tree queries
  */
 MAYAFLUX_API EdgeList nearest_neighbor_graph(const Eigen::MatrixXd& points);
 
@@ -122,8 +133,10 @@ MAYAFLUX_API EdgeList nearest_neighbor_graph(const Eigen::MatrixXd& points);
  * Equivalently: max(|p-r|, |q-r|) ≥ |p-q| for all r ∈ P \ {p,q}
  *
  * The RNG is a subset of Gabriel graph and Delaunay triangulation.
+ * For 1-3 dimensions the Gabriel edges are filtered in parallel with a
+ * k-d tree query over each lune.
  *
- * Complexity: O(n³) with geometric tests
+ * Complexity: O(n log n) expected for 1-3 dimensions, O(n³) otherwise
  */
 MAYAFLUX_API EdgeList relative_neighborhood_graph(const Eigen::MatrixXd& points);
 
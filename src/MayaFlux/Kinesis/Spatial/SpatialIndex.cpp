@@ -1,8 +1,7 @@
 #include "SpatialIndex.hpp"
 
 #include "MayaFlux/Journal/Archivist.hpp"
-
-#include <queue>
+#include "MayaFlux/Transitive/Parallel/Execution.hpp"
 
 namespace MayaFlux::Kinesis {
 
@@ -52,7 +51,228 @@ namespace detail {
         }
     }
 
-    constexpr uint32_t MAX_GRID_DIMENSIONS = 6;
+    using Cell = std::array<int32_t, MAX_GRID_DIMENSIONS>;
+
+    /// Points per parallel work item during grid construction.
+    constexpr size_t BUILD_CHUNK = 4096;
+
+    /// A dense 3D grid may use up to this many cells per point before falling back to hashing.
+    constexpr uint64_t DENSE_CELLS_PER_POINT = 16;
+    constexpr uint64_t DENSE_MIN_CELLS = 4096;
+
+    /// Queries per parallel work item in batched queries.
+    constexpr size_t BATCH_BLOCK = 64;
+
+    template <typename PointT>
+    double coord(const PointT& p, uint32_t axis)
+    {
+        if constexpr (std::is_same_v<PointT, glm::vec3>) {
+            return static_cast<double>(p[static_cast<int>(axis)]);
+        } else {
+            return p(axis);
+        }
+    }
+
+    inline int32_t floor_cell(double v)
+    {
+        return static_cast<int32_t>(std::floor(v));
+    }
+
+    template <typename PointT>
+    void cell_of(const PointT& p, float inv_cell, uint32_t axes, int32_t* cell)
+    {
+        if constexpr (std::is_same_v<PointT, glm::vec3>) {
+            const auto c = cell_coords_3d(p, inv_cell);
+            std::copy(c.begin(), c.end(), cell);
+        } else {
+            for (uint32_t a = 0; a < axes; ++a) {
+                cell[a] = floor_cell(p(a) * inv_cell);
+            }
+        }
+    }
+
+    template <typename PointT>
+    uint64_t cell_hash(const int32_t* cell, uint32_t axes)
+    {
+        if constexpr (std::is_same_v<PointT, glm::vec3>) {
+            return hash_cell_3d(cell[0], cell[1], cell[2]);
+        } else {
+            return hash_cell_coords(cell, axes);
+        }
+    }
+
+    inline uint64_t dense_cell_index(const SpatialGrid& g, const int32_t* cell)
+    {
+        return (static_cast<uint64_t>(cell[2] - g.min_cell[2]) * g.extent[1]
+                   + static_cast<uint64_t>(cell[1] - g.min_cell[1]))
+            * g.extent[0]
+            + static_cast<uint64_t>(cell[0] - g.min_cell[0]);
+    }
+
+    /**
+     * @brief Box of cells within Chebyshev distance r of c, clamped to the grid bounds.
+     * @return Number of cells in the clamped box (0 if it misses the bounds).
+     */
+    inline uint64_t clamped_box(const SpatialGrid& g, const Cell& c, int32_t r, Cell& lo, Cell& hi)
+    {
+        uint64_t cells = 1;
+        for (uint32_t a = 0; a < g.axes; ++a) {
+            lo[a] = std::max(c[a] - r, g.min_cell[a]);
+            hi[a] = std::min(c[a] + r, g.max_cell[a]);
+            if (lo[a] > hi[a]) {
+                return 0;
+            }
+            cells *= static_cast<uint64_t>(hi[a] - lo[a]) + 1;
+        }
+        return cells;
+    }
+
+    /**
+     * @brief Call row(cell) for every combination of axes 1..axes-1 in [lo, hi].
+     *
+     * Axis 0 is the row axis and is left to the callback.
+     */
+    template <typename Fn>
+    void for_each_row(uint32_t axes, const Cell& lo, const Cell& hi, Fn&& row)
+    {
+        for (uint32_t a = 1; a < axes; ++a) {
+            if (lo[a] > hi[a]) {
+                return;
+            }
+        }
+
+        Cell cell = lo;
+        while (true) {
+            row(cell);
+            uint32_t a = 1;
+            for (; a < axes; ++a) {
+                if (++cell[a] <= hi[a]) {
+                    break;
+                }
+                cell[a] = lo[a];
+            }
+            if (a >= axes) {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Visit every sorted point in cells [x0, x1] along axis 0 of the row through cell.
+     *
+     * In the dense layout the row is a single contiguous slot range.
+     */
+    template <typename PointT, typename Fn>
+    void scan_row(const SpatialGrid& g, Cell& cell, int32_t x0, int32_t x1, Fn&& fn)
+    {
+        for (uint32_t a = 1; a < g.axes; ++a) {
+            if (cell[a] < g.min_cell[a] || cell[a] > g.max_cell[a]) {
+                return;
+            }
+        }
+        x0 = std::max(x0, g.min_cell[0]);
+        x1 = std::min(x1, g.max_cell[0]);
+        if (x0 > x1) {
+            return;
+        }
+
+        if (g.dense) {
+            cell[0] = x0;
+            const uint64_t first = dense_cell_index(g, cell.data());
+            const uint32_t end = g.cell_start[first + static_cast<uint64_t>(x1 - x0) + 1];
+            for (uint32_t s = g.cell_start[first]; s < end; ++s) {
+                fn(s);
+            }
+            return;
+        }
+
+        for (int32_t x = x0; x <= x1; ++x) {
+            cell[0] = x;
+            const uint64_t h = cell_hash<PointT>(cell.data(), g.axes);
+            const uint64_t b = h & g.bucket_mask;
+            for (uint32_t s = g.cell_start[b]; s < g.cell_start[b + 1]; ++s) {
+                if (g.point_cell[s] == h) {
+                    fn(s);
+                }
+            }
+        }
+    }
+
+    constexpr auto by_distance = [](const QueryResult& a, const QueryResult& b) {
+        return a.distance_sq < b.distance_sq;
+    };
+
+    /// Offer a candidate to the k-bounded max-heap occupying out[base, end).
+    inline void offer(std::vector<QueryResult>& out, size_t base, uint32_t k, QueryResult candidate)
+    {
+        const auto first = out.begin() + static_cast<std::ptrdiff_t>(base);
+        if (out.size() - base < k) {
+            out.push_back(candidate);
+            std::push_heap(out.begin() + static_cast<std::ptrdiff_t>(base), out.end(), by_distance);
+        } else if (candidate.distance_sq < first->distance_sq) {
+            std::pop_heap(first, out.end(), by_distance);
+            out.back() = candidate;
+            std::push_heap(out.begin() + static_cast<std::ptrdiff_t>(base), out.end(), by_distance);
+        }
+    }
+
+    template <typename Fn>
+    void for_each_chunk(size_t n, Fn&& fn)
+    {
+        const size_t chunks = (n + BUILD_CHUNK - 1) / BUILD_CHUNK;
+        if (chunks < 2) {
+            fn(size_t { 0 }, n);
+            return;
+        }
+        Parallel::for_each(Parallel::par,
+            std::views::iota(size_t { 0 }, chunks).begin(),
+            std::views::iota(size_t { 0 }, chunks).end(),
+            [&](size_t c) { fn(c * BUILD_CHUNK, std::min(n, (c + 1) * BUILD_CHUNK)); });
+    }
+
+    /**
+     * @brief Run query(i, out) for i in [0, count) in parallel blocks and flatten.
+     *
+     * query appends its results for query i to out.
+     */
+    template <typename Fn>
+    BatchQueryResult run_batched(size_t count, Fn&& query)
+    {
+        BatchQueryResult batch;
+        batch.offsets.assign(count + 1, 0);
+        if (count == 0) {
+            return batch;
+        }
+
+        const size_t blocks = (count + BATCH_BLOCK - 1) / BATCH_BLOCK;
+        std::vector<std::vector<QueryResult>> block_results(blocks);
+
+        Parallel::for_each(Parallel::par,
+            std::views::iota(size_t { 0 }, blocks).begin(),
+            std::views::iota(size_t { 0 }, blocks).end(),
+            [&](size_t b) {
+                auto& out = block_results[b];
+                const size_t end = std::min(count, (b + 1) * BATCH_BLOCK);
+                for (size_t i = b * BATCH_BLOCK; i < end; ++i) {
+                    const size_t before = out.size();
+                    query(i, out);
+                    batch.offsets[i + 1] = static_cast<uint32_t>(out.size() - before);
+                }
+            });
+
+        std::inclusive_scan(batch.offsets.begin(), batch.offsets.end(), batch.offsets.begin());
+        batch.results.resize(batch.offsets.back());
+
+        Parallel::for_each(Parallel::par,
+            std::views::iota(size_t { 0 }, blocks).begin(),
+            std::views::iota(size_t { 0 }, blocks).end(),
+            [&](size_t b) {
+                std::ranges::copy(block_results[b],
+                    batch.results.begin() + batch.offsets[b * BATCH_BLOCK]);
+            });
+
+        return batch;
+    }
 
 } // namespace detail
 
@@ -176,19 +396,34 @@ void SpatialIndex<PointT>::publish()
     }
 
     auto live_count = static_cast<uint32_t>(m_id_to_slot.size());
-    snap->positions.reserve(live_count);
-    snap->slot_to_id.reserve(live_count);
-    snap->id_to_slot.reserve(live_count);
 
+    std::vector<uint32_t> live_slots;
+    std::vector<uint32_t> live_ids;
+    live_slots.reserve(live_count);
+    live_ids.reserve(live_count);
     for (const auto& [id, slot] : m_id_to_slot) {
-        auto new_slot = static_cast<uint32_t>(snap->positions.size());
-        snap->positions.push_back(m_positions[slot]);
-        snap->slot_to_id.push_back(id);
-        snap->id_to_slot[id] = new_slot;
+        live_slots.push_back(slot);
+        live_ids.push_back(id);
     }
 
-    if (m_use_grid) {
-        rebuild_grid(*snap);
+    snap->positions.resize(live_count);
+    snap->slot_to_id.resize(live_count);
+
+    const std::vector<uint32_t> order = m_use_grid
+        ? rebuild_grid(*snap, live_slots)
+        : std::vector<uint32_t> {};
+
+    detail::for_each_chunk(live_count, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const uint32_t src = order.empty() ? static_cast<uint32_t>(i) : order[i];
+            snap->positions[i] = m_positions[live_slots[src]];
+            snap->slot_to_id[i] = live_ids[src];
+        }
+    });
+
+    snap->id_to_slot.reserve(live_count);
+    for (uint32_t i = 0; i < live_count; ++i) {
+        snap->id_to_slot[snap->slot_to_id[i]] = i;
     }
 
 #ifdef MAYAFLUX_PLATFORM_MACOS
@@ -208,24 +443,115 @@ void SpatialIndex<PointT>::publish()
 // =========================================================================
 
 template <typename PointT>
-void SpatialIndex<PointT>::rebuild_grid(SpatialSnapshot<PointT>& snap) const
+std::vector<uint32_t> SpatialIndex<PointT>::rebuild_grid(
+    SpatialSnapshot<PointT>& snap,
+    std::span<const uint32_t> live_slots) const
 {
-    snap.cells.clear();
-    for (uint32_t i = 0; i < static_cast<uint32_t>(snap.positions.size()); ++i) {
-        uint64_t h = hash_cell(snap.positions[i]);
-        snap.cells[h].push_back(i);
+    SpatialGrid& g = snap.grid;
+    g = SpatialGrid {};
+    g.axes = std::min(snap.dimensions, detail::MAX_GRID_DIMENSIONS);
+
+    const size_t n = live_slots.size();
+    const uint32_t axes = g.axes;
+    if (n == 0 || axes == 0) {
+        return {};
+    }
+
+    // Cell coordinates and per-chunk bounds, in parallel.
+    std::vector<int32_t> coords(n * axes);
+    const size_t chunk_count = (n + detail::BUILD_CHUNK - 1) / detail::BUILD_CHUNK;
+    std::vector<detail::Cell> chunk_min(chunk_count);
+    std::vector<detail::Cell> chunk_max(chunk_count);
+
+    detail::for_each_chunk(n, [&](size_t begin, size_t end) {
+        detail::Cell lo {};
+        detail::Cell hi {};
+        lo.fill(std::numeric_limits<int32_t>::max());
+        hi.fill(std::numeric_limits<int32_t>::min());
+        for (size_t i = begin; i < end; ++i) {
+            int32_t* cell = coords.data() + i * axes;
+            detail::cell_of(m_positions[live_slots[i]], m_inv_cell, axes, cell);
+            for (uint32_t a = 0; a < axes; ++a) {
+                lo[a] = std::min(lo[a], cell[a]);
+                hi[a] = std::max(hi[a], cell[a]);
+            }
+        }
+        chunk_min[begin / detail::BUILD_CHUNK] = lo;
+        chunk_max[begin / detail::BUILD_CHUNK] = hi;
+    });
+
+    for (uint32_t a = 0; a < axes; ++a) {
+        g.min_cell[a] = std::ranges::min(chunk_min, {}, [a](const detail::Cell& c) { return c[a]; })[a];
+        g.max_cell[a] = std::ranges::max(chunk_max, {}, [a](const detail::Cell& c) { return c[a]; })[a];
     }
+
+    // Dense layout when the occupied box is small enough, hashed buckets otherwise.
+    uint64_t cell_count = 0;
+    if constexpr (std::is_same_v<PointT, glm::vec3>) {
+        const uint64_t limit = std::max<uint64_t>(n * detail::DENSE_CELLS_PER_POINT, detail::DENSE_MIN_CELLS);
+        uint64_t total = 1;
+        for (uint32_t a = 0; a < 3 && total <= limit; ++a) {
+            const auto ext = static_cast<uint64_t>(
+                static_cast<int64_t>(g.max_cell[a]) - static_cast<int64_t>(g.min_cell[a]) + 1);
+            g.extent[a] = static_cast<uint32_t>(std::min<uint64_t>(ext, UINT32_MAX));
+            total *= ext;
+        }
+        g.dense = total <= limit;
+        cell_count = total;
+    }
+
+    if (!g.dense) {
+        g.extent = {};
+        cell_count = std::bit_ceil(std::max<uint64_t>(2 * n, 64));
+        g.bucket_mask = cell_count - 1;
+    }
+
+    std::vector<uint32_t> keys(n);
+    std::vector<uint64_t> hashes(g.dense ? 0 : n);
+
+    detail::for_each_chunk(n, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const int32_t* cell = coords.data() + i * axes;
+            if (g.dense) {
+                keys[i] = static_cast<uint32_t>(detail::dense_cell_index(g, cell));
+            } else {
+                hashes[i] = detail::cell_hash<PointT>(cell, axes);
+                keys[i] = static_cast<uint32_t>(hashes[i] & g.bucket_mask);
+            }
+        }
+    });
+
+    // Counting sort: histogram, prefix sum, stable scatter.
+    g.cell_start.assign(cell_count + 1, 0);
+    for (uint32_t key : keys) {
+        ++g.cell_start[key + 1];
+    }
+    std::inclusive_scan(g.cell_start.begin(), g.cell_start.end(), g.cell_start.begin());
+
+    std::vector<uint32_t> cursor(g.cell_start.begin(), g.cell_start.end() - 1);
+    std::vector<uint32_t> order(n);
+    for (uint32_t i = 0; i < static_cast<uint32_t>(n); ++i) {
+        order[cursor[keys[i]]++] = i;
+    }
+
+    if (!g.dense) {
+        g.point_cell.resize(n);
+        detail::for_each_chunk(n, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                g.point_cell[i] = hashes[order[i]];
+            }
+        });
+    }
+
+    return order;
 }
 
 template <typename PointT>
-uint64_t SpatialIndex<PointT>::hash_cell(const PointT& p) const
+float SpatialIndex<PointT>::distance_sq(const PointT& a, const PointT& b) const
 {
-    if constexpr (std::is_same_v<PointT, glm::vec3>) {
-        auto [cx, cy, cz] = detail::cell_coords_3d(p, m_inv_cell);
-        return detail::hash_cell_3d(cx, cy, cz);
-    } else {
-        return detail::hash_cell_nd(p, m_inv_cell);
-    }
+    return m_distance_fn
+        ? m_distance_fn(a, b)
+        : detail::PointTraits<PointT>::sq_distance_euclidean(a, b);
 }
 
 // =========================================================================
@@ -238,32 +564,30 @@ std::vector<QueryResult> SpatialIndex<PointT>::within_radius(
     float radius) const
 {
     std::vector<QueryResult> results;
-    float radius_sq = radius * radius;
+    within_radius(center, radius, results);
+    return results;
+}
 
-#ifdef MAYAFLUX_PLATFORM_MACOS
-    auto [snap, slot] = acquire_snapshot();
+template <typename PointT>
+void SpatialIndex<PointT>::within_radius(
+    const PointT& center,
+    float radius,
+    std::vector<QueryResult>& out) const
+{
+    out.clear();
+
+    SnapshotLease lease(*this);
+    const auto* snap = lease.get();
     if (!snap) {
-        return results;
-    }
-#else
-    auto snap_ptr = m_snapshot.load(std::memory_order_acquire);
-    if (!snap_ptr) {
-        return results;
+        return;
     }
-    const auto* snap = snap_ptr.get();
-#endif
 
-    if (m_use_grid) {
-        query_grid(*snap, center, radius_sq, results);
+    const float radius_sq = radius * radius;
+    if (m_use_grid && !snap->grid.empty()) {
+        query_grid(*snap, center, radius_sq, out);
     } else {
-        query_brute(*snap, center, radius_sq, results);
+        query_brute(*snap, center, radius_sq, out);
     }
-
-#ifdef MAYAFLUX_PLATFORM_MACOS
-    release_snapshot(slot);
-#endif
-
-    return results;
 }
 
 template <typename PointT>
@@ -271,51 +595,54 @@ std::vector<QueryResult> SpatialIndex<PointT>::k_nearest(
     const PointT& center,
     uint32_t k) const
 {
-#ifdef MAYAFLUX_PLATFORM_MACOS
-    auto [snap, slot] = acquire_snapshot();
-    if (!snap || snap->positions.empty()) {
-        if (snap)
-            release_snapshot(slot);
-        return {};
-    }
-#else
-    auto snap_ptr = m_snapshot.load(std::memory_order_acquire);
-    if (!snap_ptr || snap_ptr->positions.empty()) {
-        return {};
+    std::vector<QueryResult> results;
+
+    SnapshotLease lease(*this);
+    const auto* snap = lease.get();
+    if (!snap || snap->positions.empty() || k == 0) {
+        return results;
     }
-    const auto* snap = snap_ptr.get();
-#endif
 
-    k = std::min(k, static_cast<uint32_t>(snap->positions.size()));
+    results.reserve(std::min<size_t>(k, snap->positions.size()));
+    nearest(*snap, center, k, results);
+    return results;
+}
 
-    auto cmp = [](const QueryResult& a, const QueryResult& b) {
-        return a.distance_sq < b.distance_sq;
-    };
-    std::priority_queue<QueryResult, std::vector<QueryResult>, decltype(cmp)> heap(cmp);
+template <typename PointT>
+BatchQueryResult SpatialIndex<PointT>::within_radius_batch(
+    std::span<const PointT> centers,
+    float radius) const
+{
+    SnapshotLease lease(*this);
+    const auto* snap = lease.get();
+    const float radius_sq = radius * radius;
+    const bool grid = m_use_grid && snap && !snap->grid.empty();
 
-    for (uint32_t i = 0; i < static_cast<uint32_t>(snap->positions.size()); ++i) {
-        float d_sq = m_distance_fn(center, snap->positions[i]);
-        if (heap.size() < k) {
-            heap.push({ snap->slot_to_id[i], d_sq });
-        } else if (d_sq < heap.top().distance_sq) {
-            heap.pop();
-            heap.push({ snap->slot_to_id[i], d_sq });
+    return detail::run_batched(centers.size(), [&](size_t i, std::vector<QueryResult>& out) {
+        if (!snap) {
+            return;
         }
-    }
-
-    std::vector<QueryResult> results;
-    results.reserve(heap.size());
-    while (!heap.empty()) {
-        results.push_back(heap.top());
-        heap.pop();
-    }
-    std::ranges::reverse(results);
+        if (grid) {
+            query_grid(*snap, centers[i], radius_sq, out);
+        } else {
+            query_brute(*snap, centers[i], radius_sq, out);
+        }
+    });
+}
 
-#ifdef MAYAFLUX_PLATFORM_MACOS
-    release_snapshot(slot);
-#endif
+template <typename PointT>
+BatchQueryResult SpatialIndex<PointT>::k_nearest_batch(
+    std::span<const PointT> centers,
+    uint32_t k) const
+{
+    SnapshotLease lease(*this);
+    const auto* snap = lease.get();
 
-    return results;
+    return detail::run_batched(centers.size(), [&](size_t i, std::vector<QueryResult>& out) {
+        if (snap && !snap->positions.empty() && k > 0) {
+            nearest(*snap, centers[i], k, out);
+        }
+    });
 }
 
 template <typename PointT>
@@ -400,56 +727,127 @@ void SpatialIndex<PointT>::query_grid(
     float radius_sq,
     std::vector<QueryResult>& out) const
 {
-    auto extent = static_cast<int32_t>(std::ceil(std::sqrt(radius_sq) * m_inv_cell));
-
-    auto check_cell = [&](uint64_t h) {
-        auto it = snap.cells.find(h);
-        if (it == snap.cells.end()) {
+    const SpatialGrid& g = snap.grid;
+    const double radius = std::sqrt(static_cast<double>(radius_sq));
+
+    detail::Cell lo {};
+    detail::Cell hi {};
+    uint64_t cells = 1;
+    for (uint32_t a = 0; a < g.axes; ++a) {
+        const double x = detail::coord(center, a);
+        lo[a] = std::max(g.min_cell[a], detail::floor_cell((x - radius) * m_inv_cell));
+        hi[a] = std::min(g.max_cell[a], detail::floor_cell((x + radius) * m_inv_cell));
+        if (lo[a] > hi[a]) {
             return;
         }
-        for (uint32_t slot : it->second) {
-            float d_sq = m_distance_fn(center, snap.positions[slot]);
-            if (d_sq <= radius_sq) {
-                out.push_back({ snap.slot_to_id[slot], d_sq });
-            }
+        cells *= static_cast<uint64_t>(hi[a] - lo[a]) + 1;
+    }
+
+    // Probing more hashed cells than there are points costs more than a scan.
+    if (!g.dense && cells > snap.positions.size()) {
+        query_brute(snap, center, radius_sq, out);
+        return;
+    }
+
+    auto check = [&](uint32_t slot) {
+        const float d_sq = distance_sq(center, snap.positions[slot]);
+        if (d_sq <= radius_sq) {
+            out.push_back({ snap.slot_to_id[slot], d_sq });
         }
     };
 
-    if constexpr (std::is_same_v<PointT, glm::vec3>) {
-        auto [cx, cy, cz] = detail::cell_coords_3d(center, m_inv_cell);
-        for (int32_t dx = -extent; dx <= extent; ++dx) {
-            for (int32_t dy = -extent; dy <= extent; ++dy) {
-                for (int32_t dz = -extent; dz <= extent; ++dz) {
-                    check_cell(detail::hash_cell_3d(cx + dx, cy + dy, cz + dz));
-                }
+    detail::for_each_row(g.axes, lo, hi, [&](detail::Cell& cell) {
+        detail::scan_row<PointT>(g, cell, lo[0], hi[0], check);
+    });
+}
+
+template <typename PointT>
+void SpatialIndex<PointT>::nearest_grid(
+    const SpatialSnapshot<PointT>& snap,
+    const PointT& center,
+    uint32_t k,
+    std::vector<QueryResult>& out) const
+{
+    const SpatialGrid& g = snap.grid;
+    const size_t base = out.size();
+
+    detail::Cell c {};
+    detail::cell_of(center, m_inv_cell, g.axes, c.data());
+
+    // Rings closer than the point bounds are empty; rings past them add nothing.
+    int32_t r_begin = 0;
+    int32_t r_end = 0;
+    for (uint32_t a = 0; a < g.axes; ++a) {
+        r_begin = std::max({ r_begin, g.min_cell[a] - c[a], c[a] - g.max_cell[a] });
+        r_end = std::max({ r_end, c[a] - g.min_cell[a], g.max_cell[a] - c[a] });
+    }
+
+    auto consider = [&](uint32_t slot) {
+        detail::offer(out, base, k, { snap.slot_to_id[slot], distance_sq(center, snap.positions[slot]) });
+    };
+
+    uint64_t visited = 0;
+    for (int32_t r = r_begin; r <= r_end; ++r) {
+        detail::Cell lo {};
+        detail::Cell hi {};
+        const uint64_t box = detail::clamped_box(g, c, r, lo, hi);
+
+        // Past this many hashed probes a linear scan is cheaper.
+        if (!g.dense) {
+            detail::Cell inner_lo {};
+            detail::Cell inner_hi {};
+            visited += box - (r > 0 ? detail::clamped_box(g, c, r - 1, inner_lo, inner_hi) : 0);
+            if (visited > snap.positions.size()) {
+                out.resize(base);
+                nearest_brute(snap, center, k, out);
+                return;
             }
         }
-    } else {
-        uint32_t dims = snap.dimensions;
-        std::vector<int32_t> base_cell(dims);
-        for (uint32_t d = 0; d < dims; ++d) {
-            base_cell[d] = static_cast<int32_t>(std::floor(center(d) * m_inv_cell));
-        }
 
-        std::vector<int32_t> offsets(dims, -extent);
-
-        auto advance = [&]() -> bool {
-            for (uint32_t d = 0; d < dims; ++d) {
-                if (++offsets[d] <= extent) {
-                    return true;
-                }
-                offsets[d] = -extent;
+        detail::for_each_row(g.axes, lo, hi, [&](detail::Cell& cell) {
+            bool shell = r == 0;
+            for (uint32_t a = 1; a < g.axes && !shell; ++a) {
+                shell = cell[a] == c[a] - r || cell[a] == c[a] + r;
             }
-            return false;
-        };
+            if (shell) {
+                detail::scan_row<PointT>(g, cell, c[0] - r, c[0] + r, consider);
+            } else {
+                detail::scan_row<PointT>(g, cell, c[0] - r, c[0] - r, consider);
+                detail::scan_row<PointT>(g, cell, c[0] + r, c[0] + r, consider);
+            }
+        });
 
-        do {
-            Eigen::VectorXd probe(dims);
-            for (uint32_t d = 0; d < dims; ++d) {
-                probe(d) = static_cast<double>(base_cell[d] + offsets[d]) + 0.5;
+        if (out.size() - base == k) {
+            // Every unvisited point lies outside the (2r+1)^D cell box around c.
+            double gap = std::numeric_limits<double>::max();
+            for (uint32_t a = 0; a < g.axes; ++a) {
+                const double x = detail::coord(center, a);
+                gap = std::min({ gap,
+                    x - static_cast<double>(c[a] - r) * m_cell_size,
+                    static_cast<double>(c[a] + r + 1) * m_cell_size - x });
             }
-            check_cell(detail::hash_cell_nd(probe, m_inv_cell));
-        } while (advance());
+            if (static_cast<double>(out[base].distance_sq) <= gap * gap) {
+                break;
+            }
+        }
+    }
+
+    std::sort_heap(out.begin() + static_cast<std::ptrdiff_t>(base), out.end(), detail::by_distance);
+}
+
+template <typename PointT>
+void SpatialIndex<PointT>::nearest(
+    const SpatialSnapshot<PointT>& snap,
+    const PointT& center,
+    uint32_t k,
+    std::vector<QueryResult>& out) const
+{
+    // The ring search stops on a Euclidean gap bound, which a custom metric
+    // need not respect.
+    if (m_use_grid && !m_distance_fn && !snap.grid.empty()) {
+        nearest_grid(snap, center, k, out);
+    } else {
+        nearest_brute(snap, center, k, out);
     }
 }
 
@@ -465,13 +863,62 @@ void SpatialIndex<PointT>::query_brute(
     std::vector<QueryResult>& out) const
 {
     for (uint32_t i = 0; i < static_cast<uint32_t>(snap.positions.size()); ++i) {
-        float d_sq = m_distance_fn(center, snap.positions[i]);
+        float d_sq = distance_sq(center, snap.positions[i]);
         if (d_sq <= radius_sq) {
             out.push_back({ snap.slot_to_id[i], d_sq });
         }
     }
 }
 
+template <typename PointT>
+void SpatialIndex<PointT>::nearest_brute(
+    const SpatialSnapshot<PointT>& snap,
+    const PointT& center,
+    uint32_t k,
+    std::vector<QueryResult>& out) const
+{
+    const size_t base = out.size();
+    for (uint32_t i = 0; i < static_cast<uint32_t>(snap.positions.size()); ++i) {
+        detail::offer(out, base, k, { snap.slot_to_id[i], distance_sq(center, snap.positions[i]) });
+    }
+    std::sort_heap(out.begin() + static_cast<std::ptrdiff_t>(base), out.end(), detail::by_distance);
+}
+
+// =========================================================================
+// Snapshot lease
+// =========================================================================
+
+#ifdef MAYAFLUX_PLATFORM_MACOS
+
+template <typename PointT>
+SpatialIndex<PointT>::SnapshotLease::SnapshotLease(const SpatialIndex& owner)
+    : m_owner(owner)
+{
+    auto [snap, slot] = owner.acquire_snapshot();
+    m_snap = snap;
+    m_slot = slot;
+}
+
+template <typename PointT>
+SpatialIndex<PointT>::SnapshotLease::~SnapshotLease()
+{
+    m_owner.release_snapshot(m_slot);
+}
+
+#else
+
+template <typename PointT>
+SpatialIndex<PointT>::SnapshotLease::SnapshotLease(const SpatialIndex& owner)
+    : m_ptr(owner.m_snapshot.load(std::memory_order_acquire))
+{
+    m_snap = m_ptr.get();
+}
+
+template <typename PointT>
+SpatialIndex<PointT>::SnapshotLease::~SnapshotLease() = default;
+
+#endif
+
 // =========================================================================
 // macOS hazard pointer protocol
 // =========================================================================
@@ -528,21 +975,12 @@ void SpatialIndex<PointT>::retire_snapshot(const SpatialSnapshot<PointT>* old)
 
 std::unique_ptr<SpatialIndex3D> make_spatial_index_3d(float cell_size)
 {
-    return std::make_unique<SpatialIndex3D>(
-        cell_size,
-        [](const glm::vec3& a, const glm::vec3& b) -> float {
-            glm::vec3 d = a - b;
-            return glm::dot(d, d);
-        });
+    return std::make_unique<SpatialIndex3D>(cell_size, nullptr);
 }
 
 std::unique_ptr<SpatialIndexND> make_spatial_index_nd(float cell_size, uint32_t dimensions)
 {
-    auto idx = std::make_unique<SpatialIndexND>(
-        cell_size,
-        [](const Eigen::VectorXd& a, const Eigen::VectorXd& b) -> float {
-            return static_cast<float>((a - b).squaredNorm());
-        });
+    auto idx = std::make_unique<SpatialIndexND>(cell_size, nullptr);
 
     if (dimensions > detail::MAX_GRID_DIMENSIONS) {
         MF_INFO(Journal::Component::Kinesis, Journal::Context::Runtime,
@@ -12,11 +12,73 @@ struct QueryResult {
     float distance_sq;
 };
 
+/**
+ * @brief Flattened results of a batched query.
+ *
+ * Results for query i occupy results[offsets[i], offsets[i + 1]).
+ */
+struct BatchQueryResult {
+    std::vector<QueryResult> results;
+    std::vector<uint32_t> offsets;
+
+    /// @brief Number of queries in the batch.
+    [[nodiscard]] size_t size() const { return offsets.empty() ? 0 : offsets.size() - 1; }
+
+    /// @brief Results belonging to query @p i.
+    [[nodiscard]] std::span<const QueryResult> operator[](size_t i) const
+    {
+        return std::span(results).subspan(offsets[i], offsets[i + 1] - offsets[i]);
+    }
+};
+
+namespace detail {
+
+    /// @brief Highest dimensionality served by the grid; above this queries scan linearly.
+    constexpr uint32_t MAX_GRID_DIMENSIONS = 6;
+
+} // namespace detail
+
+/**
+ * @brief Counting-sorted uniform grid over a snapshot's positions.
+ *
+ * Snapshot positions are stored in cell order, so the points of cell c are
+ * the contiguous range [cell_start[c], cell_start[c + 1]). When the occupied
+ * cell bounding box is small relative to the point count (3D only), cells
+ * are laid out densely with x fastest and a row of cells is a single point
+ * range. Otherwise cells are hashed into a power-of-two bucket table and
+ * point_cell keeps each point's full cell hash to reject bucket collisions.
+ */
+struct SpatialGrid {
+    /// @brief Prefix offsets into the sorted positions; one entry per cell plus one.
+    std::vector<uint32_t> cell_start;
+
+    /// @brief Full cell hash per sorted point (hashed layout only).
+    std::vector<uint64_t> point_cell;
+
+    /// @brief Inclusive integer cell bounds of all points.
+    std::array<int32_t, detail::MAX_GRID_DIMENSIONS> min_cell {};
+    std::array<int32_t, detail::MAX_GRID_DIMENSIONS> max_cell {};
+
+    /// @brief Cells per axis (dense layout only).
+    std::array<uint32_t, 3> extent {};
+
+    /// @brief Bucket count minus one (hashed layout only).
+    uint64_t bucket_mask {};
+
+    /// @brief Number of grid axes.
+    uint32_t axes {};
+
+    /// @brief True for the dense layout, false for hashed buckets.
+    bool dense {};
+
+    [[nodiscard]] bool empty() const { return cell_start.empty(); }
+};
+
 /// @brief Immutable spatial snapshot published atomically for lock-free reads.
 /// @tparam PointT Coordinate type (glm::vec3 or Eigen::VectorXd).
 template <typename PointT>
 struct SpatialSnapshot {
-    /// @brief Packed position storage indexed by internal slot.
+    /// @brief Packed position storage indexed by internal slot, in grid cell order.
     std::vector<PointT> positions;
 
     /// @brief Maps external entity id to internal slot index.
@@ -25,8 +87,8 @@ struct SpatialSnapshot {
     /// @brief Maps internal slot index back to external entity id.
     std::vector<uint32_t> slot_to_id;
 
-    /// @brief Grid cell contents. Key is hashed cell coordinate.
-    std::unordered_map<uint64_t, std::vector<uint32_t>> cells;
+    /// @brief Cell grid over positions. Empty when the index scans linearly.
+    SpatialGrid grid;
 
     /// @brief Cell size used when this snapshot was built.
     float cell_size {};
@@ -58,7 +120,7 @@ namespace detail {
         };
     }
 
-    inline uint64_t hash_cell_nd(const Eigen::VectorXd& p, float inv_cell)
+    inline uint64_t hash_cell_coords(const int32_t* cell, uint32_t dims)
     {
         uint64_t h = 0;
         constexpr uint64_t primes[] = {
@@ -66,14 +128,23 @@ namespace detail {
             48611ULL, 76963ULL, 15485863ULL,
             32452843ULL, 49979687ULL
         };
-        Eigen::Index dims = std::min(p.size(), static_cast<Eigen::Index>(8));
-        for (Eigen::Index i = 0; i < dims; ++i) {
-            auto ci = static_cast<int32_t>(std::floor(p(i) * inv_cell));
-            h ^= static_cast<uint64_t>(static_cast<uint32_t>(ci)) * primes[i];
+        dims = std::min(dims, 8U);
+        for (uint32_t i = 0; i < dims; ++i) {
+            h ^= static_cast<uint64_t>(static_cast<uint32_t>(cell[i])) * primes[i];
         }
         return h;
     }
 
+    inline uint64_t hash_cell_nd(const Eigen::VectorXd& p, float inv_cell)
+    {
+        std::array<int32_t, 8> cell {};
+        const auto dims = static_cast<uint32_t>(std::min(p.size(), static_cast<Eigen::Index>(8)));
+        for (uint32_t i = 0; i < dims; ++i) {
+            cell[i] = static_cast<int32_t>(std::floor(p(i) * inv_cell));
+        }
+        return hash_cell_coords(cell.data(), dims);
+    }
+
 } // namespace detail
 
 // =========================================================================
@@ -91,9 +162,16 @@ namespace detail {
  * within_radius() or k_nearest() against the last published snapshot with no
  * synchronization overhead.
  *
- * Backed by a uniform spatial hash grid for PointT = glm::vec3, and brute-force
- * scan for PointT = Eigen::VectorXd with dimensionality > 6. Grid cell neighbor
- * enumeration scales as 3^D, so the grid is only practical for low dimensionality.
+ * Backed by a counting-sorted uniform grid (see SpatialGrid) rebuilt in
+ * parallel on publish(), and by a linear scan for PointT = Eigen::VectorXd
+ * with dimensionality > 6. Grid cell neighbor enumeration scales as 3^D, so
+ * the grid is only practical for low dimensionality. k_nearest() searches
+ * rings of cells outward from the query cell and stops once no unvisited
+ * cell can beat the current k-th distance.
+ *
+ * Grid pruning assumes the distance function is Euclidean squared distance.
+ * Pass an empty DistanceFn to have it evaluated inline; with a custom
+ * DistanceFn k_nearest() scans every point instead of searching rings.
  *
  * Publication model:
  *   Non-macOS: std::atomic<std::shared_ptr<const SpatialSnapshot<PointT>>>
@@ -108,7 +186,8 @@ public:
     /**
      * @brief Construct a spatial index.
      * @param cell_size Grid cell edge length. Ignored when brute-force is selected.
-     * @param distance Distance function returning squared distance between two points.
+     * @param distance Distance function returning squared distance between two
+     *                 points. Empty selects inline Euclidean squared distance.
      */
     SpatialIndex(float cell_size, DistanceFn distance);
     ~SpatialIndex();
@@ -164,6 +243,18 @@ public:
         const PointT& center,
         float radius) const;
 
+    /**
+     * @brief within_radius() into a caller-owned vector.
+     * @param center Query origin.
+     * @param radius Search radius (same units as positions).
+     * @param out Cleared, then filled with unsorted results. Its capacity is
+     *            kept, so a vector reused across frames stops allocating.
+     */
+    void within_radius(
+        const PointT& center,
+        float radius,
+        std::vector<QueryResult>& out) const;
+
     /**
      * @brief Find the k nearest entities to a point.
      * @param center Query origin.
@@ -174,6 +265,26 @@ public:
         const PointT& center,
         uint32_t k) const;
 
+    /**
+     * @brief within_radius() for many query points against one snapshot.
+     * @param centers Query origins.
+     * @param radius Search radius shared by all queries.
+     * @return One result range per center, in input order. Queries run in parallel.
+     */
+    [[nodiscard]] BatchQueryResult within_radius_batch(
+        std::span<const PointT> centers,
+        float radius) const;
+
+    /**
+     * @brief k_nearest() for many query points against one snapshot.
+     * @param centers Query origins.
+     * @param k Maximum number of results per query.
+     * @return One sorted result range per center, in input order. Queries run in parallel.
+     */
+    [[nodiscard]] BatchQueryResult k_nearest_batch(
+        std::span<const PointT> centers,
+        uint32_t k) const;
+
     /**
      * @brief Read the position of an entity from the published snapshot.
      * @param id Entity id.
@@ -212,9 +323,15 @@ private:
     std::vector<uint32_t> m_slot_to_id;
     std::vector<uint32_t> m_free_slots;
 
-    void rebuild_grid(SpatialSnapshot<PointT>& snap) const;
+    /**
+     * @brief Build snap.grid over the live write slots.
+     * @return Permutation: sorted position i comes from live_slots[order[i]].
+     */
+    std::vector<uint32_t> rebuild_grid(
+        SpatialSnapshot<PointT>& snap,
+        std::span<const uint32_t> live_slots) const;
 
-    uint64_t hash_cell(const PointT& p) const;
+    float distance_sq(const PointT& a, const PointT& b) const;
 
     void query_grid(
         const SpatialSnapshot<PointT>& snap,
@@ -228,6 +345,51 @@ private:
         float radius_sq,
         std::vector<QueryResult>& out) const;
 
+    void nearest_grid(
+        const SpatialSnapshot<PointT>& snap,
+        const PointT& center,
+        uint32_t k,
+        std::vector<QueryResult>& out) const;
+
+    void nearest_brute(
+        const SpatialSnapshot<PointT>& snap,
+        const PointT& center,
+        uint32_t k,
+        std::vector<QueryResult>& out) const;
+
+    void nearest(
+        const SpatialSnapshot<PointT>& snap,
+        const PointT& center,
+        uint32_t k,
+        std::vector<QueryResult>& out) const;
+
+    /**
+     * @brief Scoped read access to the published snapshot.
+     *
+     * Holds the shared_ptr, or the hazard slot on macOS, for its lifetime.
+     */
+    class SnapshotLease {
+    public:
+        explicit SnapshotLease(const SpatialIndex& owner);
+        ~SnapshotLease();
+
+        SnapshotLease(const SnapshotLease&) = delete;
+        SnapshotLease& operator=(const SnapshotLease&) = delete;
+        SnapshotLease(SnapshotLease&&) = delete;
+        SnapshotLease& operator=(SnapshotLease&&) = delete;
+
+        [[nodiscard]] const SpatialSnapshot<PointT>* get() const { return m_snap; }
+
+    private:
+        const SpatialSnapshot<PointT>* m_snap {};
+#ifdef MAYAFLUX_PLATFORM_MACOS
+        const SpatialIndex& m_owner;
+        size_t m_slot {};
+#else
+        std::shared_ptr<const SpatialSnapshot<PointT>> m_ptr;
+#endif
+    };
+
     // -----------------------------------------------------------------
     // Read-side snapshot (lock-free publication)
     // -----------------------------------------------------------------
@@ -5,20 +5,14 @@
 namespace MayaFlux::Kinesis::Stochastic {
 
 Stochastic::Stochastic(Algorithm algo)
-    : m_engine(std::random_device {}())
+    : m_stream(std::random_device {}() | (static_cast<uint64_t>(std::random_device {}()) << 32))
     , m_algorithm(algo)
-    , m_xorshift_state(std::random_device {}() | (static_cast<uint64_t>(std::random_device {}()) << 32))
 {
-    if (m_xorshift_state == 0)
-        m_xorshift_state = 0xDEADBEEFCAFEBABE;
 }
 
-void Stochastic::seed(uint64_t seed)
+void Stochastic::seed(uint64_t seed, uint64_t stream)
 {
-    m_engine.seed(static_cast<std::mt19937::result_type>(seed));
-    m_xorshift_state = seed;
-    if (m_xorshift_state == 0)
-        m_xorshift_state = 0xDEADBEEFCAFEBABE;
+    m_stream.seed(seed, stream);
     reset_state();
 }
 
@@ -88,14 +82,49 @@ std::vector<double> Stochastic::batch(double min, double max, size_t count)
 {
     validate_range(min, max);
 
-    std::vector<double> result;
-    result.reserve(count);
+    std::vector<double> result(count);
+    fill(result, min, max);
+    return result;
+}
 
-    for (size_t i = 0; i < count; ++i) {
-        result.push_back((*this)(min, max));
+void Stochastic::fill(std::span<double> out, double min, double max, double gain)
+{
+    validate_range(min, max);
+
+    switch (m_algorithm) {
+    case Algorithm::UNIFORM:
+        m_stream.fill_uniform(out, min * gain, max * gain);
+        return;
+
+    case Algorithm::NORMAL: {
+        if (min != m_cached_min || max != m_cached_max) {
+            m_cached_min = min;
+            m_cached_max = max;
+            m_dist_dirty = true;
+        }
+        rebuild_distributions_if_needed(min, max);
+        m_stream.fill_normal(out, 0.0, m_normal_sigma);
+        for (auto& v : out) {
+            v = std::clamp(v, min, max) * gain;
+        }
+        return;
     }
 
-    return result;
+    case Algorithm::EXPONENTIAL: {
+        const double scale = (max - min) / max;
+        m_stream.fill_exponential(out);
+        for (auto& v : out) {
+            v = (min + v * scale) * gain;
+        }
+        return;
+    }
+
+    default:
+        for (auto& v : out) {
+            v = (*this)(min, max) * gain;
+        }
+        return;
+    }
 }
 
 void Stochastic::reset_state()
@@ -119,20 +148,19 @@ double Stochastic::generate_memoryless(double min, double max)
 
     case Algorithm::NORMAL: {
         rebuild_distributions_if_needed(min, max);
-        raw_value = m_normal_dist(m_engine);
+        raw_value = m_stream.normal() * m_normal_sigma;
         return std::clamp(raw_value, min, max);
     }
 
     case Algorithm::EXPONENTIAL: {
-        rebuild_distributions_if_needed(min, max);
-        raw_value = m_exponential_dist(m_engine);
+        raw_value = m_stream.exponential();
         raw_value /= max;
         return min + raw_value * (max - min);
     }
 
     case Algorithm::POISSON: {
         std::poisson_distribution<int> dist(static_cast<int>(max - min));
-        return static_cast<double>(dist(m_engine));
+        return static_cast<double>(dist(m_stream));
     }
 
     default:
@@ -196,9 +224,7 @@ void Stochastic::rebuild_distributions_if_needed(double min, double max)
         if (auto cfg = get_config("spread"); cfg.has_value()) {
             spread = std::any_cast<double>(*cfg);
         }
-        m_normal_dist = std::normal_distribution<double>(0.0, range / spread);
-    } else if (m_algorithm == Algorithm::EXPONENTIAL) {
-        m_exponential_dist = std::exponential_distribution<double>(1.0);
+        m_normal_sigma = range / spread;
     }
 
     m_dist_dirty = false;
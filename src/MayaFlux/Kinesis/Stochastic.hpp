@@ -1,5 +1,7 @@
 #pragma once
 
+#include "RandomStream.hpp"
+
 #include <random>
 
 namespace MayaFlux::Kinesis::Stochastic {
@@ -125,8 +127,13 @@ public:
     /**
      * @brief Seeds entropy source
      * @param seed Seed value for deterministic sequences
+     * @param stream Independent stream index within @p seed (per voice or thread)
+     *
+     * Generators sharing a seed but with different stream indices produce
+     * uncorrelated sequences, so a bank of voices can be seeded reproducibly
+     * from a single value.
      */
-    void seed(uint64_t seed);
+    void seed(uint64_t seed, uint64_t stream = 0);
 
     /**
      * @brief Changes active algorithm
@@ -200,6 +207,24 @@ public:
      */
     [[nodiscard]] std::vector<double> batch(double min, double max, size_t count);
 
+    /**
+     * @brief Fills a caller-provided span without allocating
+     * @param out Destination samples
+     * @param min Lower bound
+     * @param max Upper bound
+     * @param gain Factor applied to every generated value
+     *
+     * UNIFORM, NORMAL and EXPONENTIAL are generated in vectorised blocks;
+     * other algorithms evolve their state sample by sample.
+     */
+    void fill(std::span<double> out, double min, double max, double gain = 1.0);
+
+    /**
+     * @brief Underlying random source
+     * @return Mutable reference to the bit stream
+     */
+    [[nodiscard]] RandomStream& stream() { return m_stream; }
+
     /**
      * @brief Resets internal state for stateful algorithms
      *
@@ -317,24 +342,15 @@ private:
     void validate_range(double min, double max) const;
     void rebuild_distributions_if_needed(double min, double max);
 
-    [[nodiscard]] inline double fast_uniform() noexcept
-    {
-        m_xorshift_state ^= m_xorshift_state >> 12;
-        m_xorshift_state ^= m_xorshift_state << 25;
-        m_xorshift_state ^= m_xorshift_state >> 27;
-        return static_cast<double>(m_xorshift_state * 0x2545F4914F6CDD1DULL)
-            * (1.0 / 18446744073709551616.0);
-    }
+    [[nodiscard]] inline double fast_uniform() noexcept { return m_stream.uniform(); }
 
-    std::mt19937 m_engine;
-    uint64_t m_xorshift_state;
+    RandomStream m_stream;
     Algorithm m_algorithm;
 
     GeneratorState m_state;
     std::map<std::string, std::any> m_config;
 
-    std::normal_distribution<double> m_normal_dist { 0.0, 1.0 };
-    std::exponential_distribution<double> m_exponential_dist { 1.0 };
+    double m_normal_sigma { 0.25 };
 
     double m_cached_min { 0.0 };
     double m_cached_max { 1.0 };
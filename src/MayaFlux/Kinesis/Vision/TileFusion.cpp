@@ -0,0 +1,491 @@
+#include "TileFusion.hpp"
+
+#ifdef MAYAFLUX_ARCH_X64
+#include <immintrin.h>
+#endif
+#ifdef MAYAFLUX_ARCH_ARM64
+#include <arm_neon.h>
+#endif
+
+#include "MayaFlux/Transitive/Parallel/Execution.hpp"
+
+namespace P = MayaFlux::Parallel;
+
+namespace MayaFlux::Kinesis::Vision {
+
+namespace {
+
+    /**
+     * @brief Half-open pixel rectangle in image coordinates.
+     */
+    struct Rect {
+        int32_t x0, y0, x1, y1;
+
+        [[nodiscard]] int32_t width() const noexcept { return x1 - x0; }
+        [[nodiscard]] int32_t height() const noexcept { return y1 - y0; }
+    };
+
+    Rect expand(const Rect& r, int32_t by, int32_t w, int32_t h) noexcept
+    {
+        return {
+            .x0 = std::max(r.x0 - by, 0),
+            .y0 = std::max(r.y0 - by, 0),
+            .x1 = std::min(r.x1 + by, w),
+            .y1 = std::min(r.y1 + by, h),
+        };
+    }
+
+    /**
+     * @brief Tile-local plane addressed in image coordinates.
+     *
+     * All planes of one tile share the origin and stride of the
+     * halo-expanded load rect, so every stage region is a sub-rect of it.
+     */
+    struct Plane {
+        float* data;
+        int32_t ox;
+        int32_t oy;
+        int32_t stride;
+
+        [[nodiscard]] float* at(int32_t x, int32_t y) const noexcept
+        {
+            return data + static_cast<ptrdiff_t>(y - oy) * stride + (x - ox);
+        }
+    };
+
+    template <typename T>
+    constexpr float normalise_scale() noexcept
+    {
+        if constexpr (std::is_same_v<T, uint8_t>) {
+            return 1.0F / 255.0F;
+        } else if constexpr (std::is_same_v<T, uint16_t>) {
+            return 1.0F / 65535.0F;
+        } else {
+            return 1.0F;
+        }
+    }
+
+    template <typename T>
+    void load_region(std::span<const T> src, bool to_gray, const Plane& dst, const Rect& r, int32_t w)
+    {
+        constexpr float s = normalise_scale<T>();
+        const auto n = r.width();
+
+        for (int32_t y = r.y0; y < r.y1; ++y) {
+            float* out = dst.at(r.x0, y);
+            const size_t base = static_cast<size_t>(y) * w + r.x0;
+
+            if (to_gray) {
+                const T* in = src.data() + base * 4;
+                for (int32_t i = 0; i < n; ++i) {
+                    const size_t p = static_cast<size_t>(i) * 4;
+                    out[i] = (static_cast<float>(in[p]) * 0.299F
+                                 + static_cast<float>(in[p + 1]) * 0.587F
+                                 + static_cast<float>(in[p + 2]) * 0.114F)
+                        * s;
+                }
+            } else {
+                const T* in = src.data() + base;
+                for (int32_t i = 0; i < n; ++i)
+                    out[i] = static_cast<float>(in[i]) * s;
+            }
+        }
+    }
+
+    void apply_point(const FusedStage& st, const Plane& p, const Rect& r)
+    {
+        const auto n = r.width();
+        for (int32_t y = r.y0; y < r.y1; ++y) {
+            float* v = p.at(r.x0, y);
+            switch (st.kind) {
+            case FusedStageKind::Scale:
+                for (int32_t i = 0; i < n; ++i)
+                    v[i] *= st.a;
+                break;
+            case FusedStageKind::Threshold:
+                for (int32_t i = 0; i < n; ++i)
+                    v[i] = v[i] >= st.a ? 1.0F : 0.0F;
+                break;
+            case FusedStageKind::NormalizeRange: {
+                const float inv = 1.0F / (st.b - st.a);
+                for (int32_t i = 0; i < n; ++i)
+                    v[i] = std::clamp((v[i] - st.a) * inv, 0.0F, 1.0F);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+    }
+
+    /**
+     * @brief Horizontal 1D convolution over columns [x0, x1) of rows [y0, y1).
+     *
+     * Interior columns accumulate all taps in registers, 8 (AVX2) or 4 (NEON)
+     * outputs at a time; border columns clamp against the image width.
+     */
+    void convolve_h(const Plane& src, const Plane& dst,
+        int32_t x0, int32_t x1, int32_t y0, int32_t y1, int32_t w,
+        std::span<const float> kernel)
+    {
+        const auto half = static_cast<int32_t>(kernel.size() / 2);
+        const int32_t a = std::clamp(half, x0, x1);
+        const int32_t b = std::clamp(w - half, a, x1);
+
+        for (int32_t y = y0; y < y1; ++y) {
+            auto scalar = [&](int32_t x) {
+                float acc = 0.0F;
+                for (int32_t k = -half; k <= half; ++k)
+                    acc += *src.at(std::clamp(x + k, 0, w - 1), y) * kernel[static_cast<size_t>(k + half)];
+                *dst.at(x, y) = acc;
+            };
+
+            for (int32_t x = x0; x < a; ++x)
+                scalar(x);
+
+            int32_t x = a;
+#ifdef MAYAFLUX_ARCH_X64
+            for (; x + 8 <= b; x += 8) {
+                __m256 acc = _mm256_setzero_ps();
+                for (int32_t k = -half; k <= half; ++k) {
+                    const __m256 sv = _mm256_loadu_ps(src.at(x + k, y));
+                    const __m256 kv = _mm256_set1_ps(kernel[static_cast<size_t>(k + half)]);
+                    acc = _mm256_fmadd_ps(sv, kv, acc);
+                }
+                _mm256_storeu_ps(dst.at(x, y), acc);
+            }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+            for (; x + 4 <= b; x += 4) {
+                float32x4_t acc = vdupq_n_f32(0.0F);
+                for (int32_t k = -half; k <= half; ++k) {
+                    const float32x4_t sv = vld1q_f32(src.at(x + k, y));
+                    const float32x4_t kv = vdupq_n_f32(kernel[static_cast<size_t>(k + half)]);
+                    acc = vmlaq_f32(acc, sv, kv);
+                }
+                vst1q_f32(dst.at(x, y), acc);
+            }
+#endif
+            for (; x < x1; ++x)
+                scalar(x);
+        }
+    }
+
+    /**
+     * @brief Vertical 1D convolution over columns [x0, x1) of rows [y0, y1).
+     */
+    void convolve_v(const Plane& src, const Plane& dst,
+        int32_t x0, int32_t x1, int32_t y0, int32_t y1, int32_t h,
+        std::span<const float> kernel)
+    {
+        const auto half = static_cast<int32_t>(kernel.size() / 2);
+
+        for (int32_t y = y0; y < y1; ++y) {
+            int32_t x = x0;
+#ifdef MAYAFLUX_ARCH_X64
+            for (; x + 8 <= x1; x += 8) {
+                __m256 acc = _mm256_setzero_ps();
+                for (int32_t k = -half; k <= half; ++k) {
+                    const __m256 sv = _mm256_loadu_ps(src.at(x, std::clamp(y + k, 0, h - 1)));
+                    const __m256 kv = _mm256_set1_ps(kernel[static_cast<size_t>(k + half)]);
+                    acc = _mm256_fmadd_ps(sv, kv, acc);
+                }
+                _mm256_storeu_ps(dst.at(x, y), acc);
+            }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+            for (; x + 4 <= x1; x += 4) {
+                float32x4_t acc = vdupq_n_f32(0.0F);
+                for (int32_t k = -half; k <= half; ++k) {
+                    const float32x4_t sv = vld1q_f32(src.at(x, std::clamp(y + k, 0, h - 1)));
+                    const float32x4_t kv = vdupq_n_f32(kernel[static_cast<size_t>(k + half)]);
+                    acc = vmlaq_f32(acc, sv, kv);
+                }
+                vst1q_f32(dst.at(x, y), acc);
+            }
+#endif
+            for (; x < x1; ++x) {
+                float acc = 0.0F;
+                for (int32_t k = -half; k <= half; ++k)
+                    acc += *src.at(x, std::clamp(y + k, 0, h - 1)) * kernel[static_cast<size_t>(k + half)];
+                *dst.at(x, y) = acc;
+            }
+        }
+    }
+
+    /**
+     * @brief One axis of a square-element binary erosion or dilation.
+     *
+     * A square structuring element is separable: the 2D result equals a
+     * horizontal pass followed by a vertical pass over the binary output.
+     * Each pass is a running min (erode) or max (dilate) of the binarised
+     * window, which maps directly onto vector min/max.
+     */
+    void morph_axis(const Plane& src, const Plane& dst, const Rect& r,
+        int32_t extent, int32_t radius, bool horizontal, bool dilating)
+    {
+        auto sample = [&](int32_t x, int32_t y, int32_t k) -> const float* {
+            return horizontal
+                ? src.at(std::clamp(x + k, 0, extent - 1), y)
+                : src.at(x, std::clamp(y + k, 0, extent - 1));
+        };
+
+        auto scalar = [&](int32_t x, int32_t y) {
+            float acc = dilating ? 0.0F : 1.0F;
+            for (int32_t k = -radius; k <= radius; ++k) {
+                const float fg = *sample(x, y, k) >= 0.5F ? 1.0F : 0.0F;
+                acc = dilating ? std::max(acc, fg) : std::min(acc, fg);
+            }
+            *dst.at(x, y) = acc;
+        };
+
+        // Columns whose window needs no clamping. Vertical passes clamp the
+        // row index per tap instead, so every column is interior.
+        const int32_t a = horizontal ? std::clamp(radius, r.x0, r.x1) : r.x0;
+        const int32_t b = horizontal ? std::clamp(extent - radius, a, r.x1) : r.x1;
+
+        for (int32_t y = r.y0; y < r.y1; ++y) {
+            for (int32_t x = r.x0; x < a; ++x)
+                scalar(x, y);
+
+            int32_t x = a;
+#ifdef MAYAFLUX_ARCH_X64
+            const __m256 half = _mm256_set1_ps(0.5F);
+            const __m256 one = _mm256_set1_ps(1.0F);
+            for (; x + 8 <= b; x += 8) {
+                __m256 acc = dilating ? _mm256_setzero_ps() : one;
+                for (int32_t k = -radius; k <= radius; ++k) {
+                    const __m256 v = _mm256_loadu_ps(sample(x, y, k));
+                    const __m256 fg = _mm256_and_ps(_mm256_cmp_ps(v, half, _CMP_GE_OQ), one);
+                    acc = dilating ? _mm256_max_ps(acc, fg) : _mm256_min_ps(acc, fg);
+                }
+                _mm256_storeu_ps(dst.at(x, y), acc);
+            }
+#elif defined(MAYAFLUX_ARCH_ARM64)
+            const float32x4_t half = vdupq_n_f32(0.5F);
+            const float32x4_t one = vdupq_n_f32(1.0F);
+            for (; x + 4 <= b; x += 4) {
+                float32x4_t acc = dilating ? vdupq_n_f32(0.0F) : one;
+                for (int32_t k = -radius; k <= radius; ++k) {
+                    const float32x4_t v = vld1q_f32(sample(x, y, k));
+                    const float32x4_t fg = vreinterpretq_f32_u32(
+                        vandq_u32(vcgeq_f32(v, half), vreinterpretq_u32_f32(one)));
+                    acc = dilating ? vmaxq_f32(acc, fg) : vminq_f32(acc, fg);
+                }
+                vst1q_f32(dst.at(x, y), acc);
+            }
+#endif
+            for (; x < r.x1; ++x)
+                scalar(x, y);
+        }
+    }
+
+    float copy_out(const Plane& src, const Rect& tile, std::span<float> dst, uint32_t w, bool reduce)
+    {
+        float peak = std::numeric_limits<float>::lowest();
+        const auto n = static_cast<size_t>(tile.width());
+        for (int32_t y = tile.y0; y < tile.y1; ++y) {
+            const float* s = src.at(tile.x0, y);
+            std::copy_n(s, n, dst.data() + static_cast<size_t>(y) * w + tile.x0);
+            if (reduce)
+                peak = std::max(peak, *std::max_element(s, s + n));
+        }
+        return peak;
+    }
+
+} // namespace
+
+// =============================================================================
+// Helpers
+// =============================================================================
+
+uint32_t stage_radius(const FusedStage& stage) noexcept
+{
+    switch (stage.kind) {
+    case FusedStageKind::Separable:
+    case FusedStageKind::GradientMagnitude:
+        return static_cast<uint32_t>(std::max(stage.kernel_x.size(), stage.kernel_y.size()) / 2);
+    case FusedStageKind::Erode:
+    case FusedStageKind::Dilate:
+        return stage.radius;
+    default:
+        return 0;
+    }
+}
+
+uint32_t segment_halo(const FusedSegment& segment) noexcept
+{
+    uint32_t halo = 0;
+    for (const auto& st : segment.stages)
+        halo += stage_radius(st);
+    return halo;
+}
+
+void load_pixels(const PixelSource& src, std::span<float> dst)
+{
+    std::visit([&](const auto& s) {
+        using T = typename std::decay_t<decltype(s)>::element_type;
+        if constexpr (std::is_same_v<T, const float>) {
+            std::copy(s.begin(), s.end(), dst.begin());
+        } else {
+            constexpr float scale = normalise_scale<std::remove_const_t<T>>();
+            P::transform(P::par_unseq, s.begin(), s.end(), dst.begin(),
+                [](auto v) { return static_cast<float>(v) * scale; });
+        }
+    },
+        src.data);
+}
+
+// =============================================================================
+// TileScheduler
+// =============================================================================
+
+void TileScheduler::ensure_scratch(size_t workers, size_t plane_size)
+{
+    if (m_workers.size() < workers)
+        m_workers.resize(workers);
+
+    for (auto& ws : m_workers) {
+        if (ws.a.size() >= plane_size)
+            continue;
+        ws.a.resize(plane_size);
+        ws.b.resize(plane_size);
+        ws.t0.resize(plane_size);
+        ws.t1.resize(plane_size);
+    }
+}
+
+float TileScheduler::execute(const FusedSegment& segment, const PixelSource& src,
+    std::span<float> dst, uint32_t w, uint32_t h)
+{
+    if (w == 0 || h == 0 || segment.stages.empty())
+        return 0.0F;
+
+    const uint32_t tw = std::max(m_config.tile_w, 8U);
+    const uint32_t th = std::max(m_config.tile_h, 8U);
+    const auto halo = static_cast<int32_t>(segment_halo(segment));
+
+    const uint32_t tiles_x = (w + tw - 1) / tw;
+    const uint32_t tiles_y = (h + th - 1) / th;
+    const size_t n_tiles = static_cast<size_t>(tiles_x) * tiles_y;
+
+    size_t workers = m_config.max_workers != 0
+        ? m_config.max_workers
+        : std::max(1U, std::thread::hardware_concurrency());
+    workers = std::min(workers, n_tiles);
+
+    const size_t plane_size = static_cast<size_t>(tw + 2 * halo) * (th + 2 * halo);
+    ensure_scratch(workers, plane_size);
+
+    const auto iw = static_cast<int32_t>(w);
+    const auto ih = static_cast<int32_t>(h);
+    const bool to_gray = segment.stages.front().kind == FusedStageKind::Gray;
+    const size_t first = to_gray ? 1 : 0;
+
+    std::atomic<size_t> next_tile { 0 };
+
+    P::for_each(P::par,
+        std::views::iota(size_t { 0 }, workers).begin(),
+        std::views::iota(size_t { 0 }, workers).end(),
+        [&](size_t wi) {
+            auto& ws = m_workers[wi];
+            ws.peak = std::numeric_limits<float>::lowest();
+
+            for (size_t t = next_tile.fetch_add(1, std::memory_order_relaxed); t < n_tiles;
+                t = next_tile.fetch_add(1, std::memory_order_relaxed)) {
+
+                const auto tx = static_cast<int32_t>(t % tiles_x);
+                const auto ty = static_cast<int32_t>(t / tiles_x);
+                const Rect tile {
+                    .x0 = tx * static_cast<int32_t>(tw),
+                    .y0 = ty * static_cast<int32_t>(th),
+                    .x1 = std::min((tx + 1) * static_cast<int32_t>(tw), iw),
+                    .y1 = std::min((ty + 1) * static_cast<int32_t>(th), ih),
+                };
+
+                const Rect load = expand(tile, halo, iw, ih);
+                const int32_t stride = load.width();
+                Plane cur { .data = ws.a.data(), .ox = load.x0, .oy = load.y0, .stride = stride };
+                Plane nxt { .data = ws.b.data(), .ox = load.x0, .oy = load.y0, .stride = stride };
+                const Plane t0 { .data = ws.t0.data(), .ox = load.x0, .oy = load.y0, .stride = stride };
+                const Plane t1 { .data = ws.t1.data(), .ox = load.x0, .oy = load.y0, .stride = stride };
+
+                std::visit([&](const auto& s) { load_region(s, to_gray, cur, load, iw); }, src.data);
+
+                int32_t remaining = halo;
+                for (size_t i = first; i < segment.stages.size(); ++i) {
+                    const auto& st = segment.stages[i];
+                    remaining -= static_cast<int32_t>(stage_radius(st));
+                    const Rect out = expand(tile, remaining, iw, ih);
+
+                    switch (st.kind) {
+                    case FusedStageKind::Scale:
+                    case FusedStageKind::Threshold:
+                    case FusedStageKind::NormalizeRange:
+                        apply_point(st, cur, out);
+                        break;
+
+                    case FusedStageKind::Separable: {
+                        const auto ry = static_cast<int32_t>(st.kernel_y.size() / 2);
+                        const int32_t r0 = std::max(out.y0 - ry, 0);
+                        const int32_t r1 = std::min(out.y1 + ry, ih);
+                        convolve_h(cur, t0, out.x0, out.x1, r0, r1, iw, st.kernel_x);
+                        convolve_v(t0, nxt, out.x0, out.x1, out.y0, out.y1, ih, st.kernel_y);
+                        std::swap(cur, nxt);
+                        break;
+                    }
+
+                    case FusedStageKind::GradientMagnitude: {
+                        const auto ry = static_cast<int32_t>(std::max(st.kernel_x.size(), st.kernel_y.size()) / 2);
+                        const int32_t r0 = std::max(out.y0 - ry, 0);
+                        const int32_t r1 = std::min(out.y1 + ry, ih);
+
+                        convolve_h(cur, t0, out.x0, out.x1, r0, r1, iw, st.kernel_x);
+                        convolve_v(t0, nxt, out.x0, out.x1, out.y0, out.y1, ih, st.kernel_y);
+                        convolve_h(cur, t0, out.x0, out.x1, r0, r1, iw, st.kernel_y);
+                        convolve_v(t0, t1, out.x0, out.x1, out.y0, out.y1, ih, st.kernel_x);
+
+                        const auto n = out.width();
+                        for (int32_t y = out.y0; y < out.y1; ++y) {
+                            float* gx = nxt.at(out.x0, y);
+                            const float* gy = t1.at(out.x0, y);
+                            for (int32_t i = 0; i < n; ++i)
+                                gx[i] = std::sqrt(gx[i] * gx[i] + gy[i] * gy[i]);
+                        }
+                        std::swap(cur, nxt);
+                        break;
+                    }
+
+                    case FusedStageKind::Erode:
+                    case FusedStageKind::Dilate: {
+                        const bool dilating = st.kind == FusedStageKind::Dilate;
+                        const auto r = static_cast<int32_t>(st.radius);
+                        const Rect rows {
+                            .x0 = out.x0,
+                            .y0 = std::max(out.y0 - r, 0),
+                            .x1 = out.x1,
+                            .y1 = std::min(out.y1 + r, ih),
+                        };
+                        morph_axis(cur, t0, rows, iw, r, true, dilating);
+                        morph_axis(t0, nxt, out, ih, r, false, dilating);
+                        std::swap(cur, nxt);
+                        break;
+                    }
+
+                    case FusedStageKind::Gray:
+                        break;
+                    }
+                }
+
+                ws.peak = std::max(ws.peak, copy_out(cur, tile, dst, w, segment.reduce_max));
+            }
+        });
+
+    if (!segment.reduce_max)
+        return 0.0F;
+
+    float peak = std::numeric_limits<float>::lowest();
+    for (size_t i = 0; i < workers; ++i)
+        peak = std::max(peak, m_workers[i].peak);
+    return peak;
+}
+
+} // namespace MayaFlux::Kinesis::Vision
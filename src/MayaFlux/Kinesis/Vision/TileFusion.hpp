@@ -0,0 +1,173 @@
+#pragma once
+
+/**
+ * @file TileFusion.hpp
+ * @brief Tile-fused CPU execution of point and stencil op chains.
+ *
+ * The per-op functions in Kinesis::Vision each traverse the full frame, so a
+ * chain of N ops reads and writes N full-resolution float planes. At 4K this
+ * is bound by memory bandwidth rather than arithmetic. TileScheduler instead
+ * walks the frame in cache-sized tiles and runs every stage of a FusedSegment
+ * on one tile before moving to the next. Each tile is loaded with a halo equal
+ * to the summed stencil radii of the segment, so intermediate results never
+ * leave per-worker scratch.
+ *
+ * ## Conventions
+ * - Results are identical to the unfused per-op functions: border handling is
+ *   clamp-to-edge against the full image, not against the tile.
+ * - Ops that need a global reduction (Sobel/Scharr peak normalisation) end a
+ *   segment. The scheduler reports the segment's output peak and the following
+ *   segment starts with a Scale stage carrying 1/peak.
+ * - Tiles are distributed across worker threads through an atomic counter.
+ *   Each worker owns its scratch, sized once per (tile, halo) geometry.
+ * - PixelSource accepts float, 8-bit and 16-bit input. Integer sources are
+ *   normalised to [0, 1] during the tile load, so an 8-bit camera frame never
+ *   materialises as a full float plane.
+ *
+ * VisionExecutor plans segments from a VisionSequence; the scheduler has no
+ * knowledge of VisionOp.
+ */
+
+namespace MayaFlux::Kinesis::Vision {
+
+/**
+ * @enum FusedStageKind
+ * @brief Per-tile stage kinds understood by TileScheduler.
+ */
+enum class FusedStageKind : uint8_t {
+    Gray,            ///< RGBA -> luma, only valid as first stage of a segment
+    Scale,           ///< v * a
+    Threshold,       ///< v >= a ? 1 : 0
+    NormalizeRange,  ///< clamp((v - a) / (b - a), 0, 1)
+    Separable,       ///< kernel_x horizontally then kernel_y vertically
+    GradientMagnitude, ///< sqrt(dx^2 + dy^2) with kernel_x as derivative, kernel_y as smoothing
+    Erode,           ///< square structuring element, radius
+    Dilate,          ///< square structuring element, radius
+};
+
+/**
+ * @brief One stage of a FusedSegment.
+ *
+ * Kernel spans are non-owning and must outlive the TileScheduler::execute()
+ * call that consumes the segment.
+ */
+struct FusedStage {
+    FusedStageKind kind { FusedStageKind::Scale };
+    float a { 1.0F };
+    float b { 0.0F };
+    uint32_t radius { 0 };
+    std::span<const float> kernel_x;
+    std::span<const float> kernel_y;
+};
+
+/**
+ * @brief Chain of stages executed per tile without full-frame intermediates.
+ */
+struct FusedSegment {
+    std::vector<FusedStage> stages;
+
+    /// Compute max(output) across the frame during execute().
+    bool reduce_max { false };
+};
+
+/**
+ * @brief Tiling parameters.
+ *
+ * Defaults keep the four per-worker scratch planes of one tile (plus a
+ * small halo) around the size of a typical L2.
+ */
+struct TileConfig {
+    bool enabled { true };
+    uint32_t tile_w { 256 };
+    uint32_t tile_h { 64 };
+
+    /// Worker count; 0 uses std::thread::hardware_concurrency().
+    uint32_t max_workers { 0 };
+};
+
+/**
+ * @brief Non-owning view of an input frame at 8, 16 or 32 bits per channel.
+ *
+ * channels is 4 for RGBA input and 1 for single-channel input. Integer data
+ * is normalised by 1/255 or 1/65535 when read.
+ */
+struct PixelSource {
+    std::variant<std::span<const float>, std::span<const uint8_t>, std::span<const uint16_t>> data;
+    uint32_t channels { 1 };
+
+    [[nodiscard]] size_t size() const noexcept
+    {
+        return std::visit([](const auto& s) { return s.size(); }, data);
+    }
+
+    [[nodiscard]] bool is_float() const noexcept
+    {
+        return std::holds_alternative<std::span<const float>>(data);
+    }
+};
+
+/**
+ * @brief Stencil radius a stage contributes to its segment's halo.
+ */
+[[nodiscard]] MAYAFLUX_API uint32_t stage_radius(const FusedStage& stage) noexcept;
+
+/**
+ * @brief Summed stencil radius of all stages in @p segment.
+ */
+[[nodiscard]] MAYAFLUX_API uint32_t segment_halo(const FusedSegment& segment) noexcept;
+
+/**
+ * @brief Normalise a whole integer or float frame into @p dst.
+ *
+ * Used when a sequence starts with an op that is not tile-fusable and the
+ * executor needs a float working plane. dst.size() must be >= src.size().
+ */
+MAYAFLUX_API void load_pixels(const PixelSource& src, std::span<float> dst);
+
+/**
+ * @class TileScheduler
+ * @brief Runs FusedSegments over a frame tile by tile across worker threads.
+ *
+ * Owns per-worker scratch. Scratch is reallocated only when tile geometry,
+ * halo or worker count grows, so steady-state execution at a fixed
+ * configuration performs no heap allocation.
+ *
+ * Not thread-safe: one scheduler per executor.
+ */
+class MAYAFLUX_API TileScheduler {
+public:
+    TileScheduler() = default;
+
+    void set_config(const TileConfig& config) { m_config = config; }
+    [[nodiscard]] const TileConfig& config() const noexcept { return m_config; }
+
+    /**
+     * @brief Execute one segment.
+     *
+     * @param segment Stages to run. Gray may only appear as the first stage and
+     *                requires src.channels == 4; all other stages read one channel.
+     * @param src     Input frame of w * h * src.channels samples.
+     * @param dst     Output plane, size >= w * h. Must not alias src.
+     * @param w       Frame width in pixels.
+     * @param h       Frame height in pixels.
+     * @return        Maximum output value when segment.reduce_max is set, 0 otherwise.
+     */
+    float execute(const FusedSegment& segment, const PixelSource& src,
+        std::span<float> dst, uint32_t w, uint32_t h);
+
+private:
+    struct WorkerScratch {
+        std::vector<float> a;
+        std::vector<float> b;
+        std::vector<float> t0;
+        std::vector<float> t1;
+        float peak { 0.0F };
+    };
+
+    TileConfig m_config;
+    std::vector<WorkerScratch> m_workers;
+
+    void ensure_scratch(size_t workers, size_t plane_size);
+};
+
+} // namespace MayaFlux::Kinesis::Vision
@@ -4,6 +4,7 @@
 #include "Gradient.hpp"
 #include "Harris.hpp"
 #include "ImageFilter.hpp"
+#include "KernelSpec.hpp"
 #include "Morphology.hpp"
 #include "OpticalFlow.hpp"
 #include "PixelOps.hpp"
@@ -11,6 +12,7 @@
 #include "MayaFlux/Transitive/Parallel/Execution.hpp"
 
 namespace P = MayaFlux::Parallel;
+namespace K = MayaFlux::Kinesis::Vision::Kernels;
 
 namespace MayaFlux::Kinesis::Vision {
 
@@ -30,6 +32,25 @@ namespace {
         return *ptr;
     }
 
+    bool is_tile_fusable(VisionOp op) noexcept
+    {
+        switch (op) {
+        case VisionOp::Threshold:
+        case VisionOp::NormalizeRange:
+        case VisionOp::GaussianBlur:
+        case VisionOp::FilterSeparable:
+        case VisionOp::Sobel:
+        case VisionOp::Scharr:
+        case VisionOp::Erode:
+        case VisionOp::Dilate:
+        case VisionOp::Open:
+        case VisionOp::Close:
+            return true;
+        default:
+            return false;
+        }
+    }
+
 } // namespace
 
 // =============================================================================
@@ -90,6 +111,149 @@ void VisionExecutor::reset()
     m_prev_keypoints.clear();
 }
 
+// =============================================================================
+// Tile fusion
+// =============================================================================
+
+size_t VisionExecutor::plan_tile_run(const VisionSequence& sequence, size_t first, uint32_t channels)
+{
+    m_fused_count = 0;
+    auto next_segment = [this]() -> FusedSegment& {
+        if (m_fused.size() <= m_fused_count)
+            m_fused.emplace_back();
+        auto& seg = m_fused[m_fused_count++];
+        seg.stages.clear();
+        seg.reduce_max = false;
+        return seg;
+    };
+
+    const auto& steps = sequence.steps;
+    FusedSegment* seg = &next_segment();
+    size_t i = first;
+    bool stop = false;
+
+    for (; i < steps.size() && !stop; ++i) {
+        const auto& step = steps[i];
+
+        if (step.op == VisionOp::RgbaToGray) {
+            // The keypoint tracker needs the full gray plane cached, which a
+            // fused run never materialises.
+            if (i != first || channels != 4
+                || (sequence.tracks_keypoints && !sequence.track_follows_peaks))
+                break;
+            seg->stages.push_back({ .kind = FusedStageKind::Gray });
+            channels = 1;
+            continue;
+        }
+
+        if (channels != 1)
+            break;
+
+        switch (step.op) {
+        case VisionOp::Threshold: {
+            const auto& p = get_params<ThresholdParams>(step.params, step.op);
+            seg->stages.push_back({ .kind = FusedStageKind::Threshold, .a = p.value });
+            break;
+        }
+
+        case VisionOp::NormalizeRange: {
+            const auto& p = get_params<NormalizeRangeParams>(step.params, step.op);
+            if (p.hi > p.lo)
+                seg->stages.push_back({ .kind = FusedStageKind::NormalizeRange, .a = p.lo, .b = p.hi });
+            break;
+        }
+
+        case VisionOp::GaussianBlur: {
+            const auto& p = get_params<GaussianBlurParams>(step.params, step.op);
+            const auto& kern = gaussian_kernel(p.sigma);
+            seg->stages.push_back({ .kind = FusedStageKind::Separable, .kernel_x = kern, .kernel_y = kern });
+            break;
+        }
+
+        case VisionOp::FilterSeparable: {
+            const auto& p = get_params<FilterSeparableParams>(step.params, step.op);
+            if (p.kernel_x.size() % 2 == 0 || p.kernel_y.size() % 2 == 0) {
+                stop = true;
+                continue;
+            }
+            seg->stages.push_back({ .kind = FusedStageKind::Separable, .kernel_x = p.kernel_x, .kernel_y = p.kernel_y });
+            break;
+        }
+
+        case VisionOp::Sobel:
+        case VisionOp::Scharr: {
+            // Magnitude is normalised by the frame peak, so the gradient ends a
+            // segment. Only fused when a later fusable step discards the
+            // GradientResult that the unfused path would publish.
+            if (i + 1 >= steps.size() || !is_tile_fusable(steps[i + 1].op)) {
+                stop = true;
+                continue;
+            }
+            const std::span<const float> kd = step.op == VisionOp::Sobel
+                ? std::span<const float>(K::sobel_kx)
+                : std::span<const float>(K::scharr_kx);
+            seg->stages.push_back({ .kind = FusedStageKind::GradientMagnitude, .kernel_x = kd, .kernel_y = K::sobel_smooth });
+            seg->reduce_max = true;
+            seg = &next_segment();
+            seg->stages.push_back({ .kind = FusedStageKind::Scale, .a = 1.0F });
+            break;
+        }
+
+        case VisionOp::Erode:
+        case VisionOp::Dilate: {
+            const auto& p = get_params<MorphParams>(step.params, step.op);
+            seg->stages.push_back({
+                .kind = step.op == VisionOp::Erode ? FusedStageKind::Erode : FusedStageKind::Dilate,
+                .radius = p.radius,
+            });
+            break;
+        }
+
+        case VisionOp::Open:
+        case VisionOp::Close: {
+            const auto& p = get_params<MorphParams>(step.params, step.op);
+            const bool opening = step.op == VisionOp::Open;
+            seg->stages.push_back({ .kind = opening ? FusedStageKind::Erode : FusedStageKind::Dilate, .radius = p.radius });
+            seg->stages.push_back({ .kind = opening ? FusedStageKind::Dilate : FusedStageKind::Erode, .radius = p.radius });
+            break;
+        }
+
+        default:
+            stop = true;
+            continue;
+        }
+    }
+
+    if (stop)
+        --i;
+
+    const size_t consumed = i - first;
+    if (consumed < 2) {
+        m_fused_count = 0;
+        return 0;
+    }
+    return consumed;
+}
+
+void VisionExecutor::execute_fused(const PixelSource& src, size_t dst_slot, uint32_t w, uint32_t h)
+{
+    const size_t n = static_cast<size_t>(w) * h;
+    PixelSource in = src;
+
+    // Ping-pong between dst_slot and the filter tmp slot so the last segment
+    // always lands in dst_slot.
+    for (size_t s = 0; s < m_fused_count; ++s) {
+        const size_t out_slot = (m_fused_count - 1 - s) % 2 == 0 ? dst_slot : k_slot_tmp;
+        auto out = std::span<float>(slot_vec(out_slot)).subspan(0, n);
+
+        const float peak = m_tiles.execute(m_fused[s], in, out, w, h);
+        if (m_fused[s].reduce_max && s + 1 < m_fused_count)
+            m_fused[s + 1].stages.front().a = peak > 0.0F ? 1.0F / peak : 1.0F;
+
+        in = PixelSource { .data = std::span<const float>(out), .channels = 1 };
+    }
+}
+
 // =============================================================================
 // run
 // =============================================================================
@@ -98,18 +262,57 @@ VisionResult VisionExecutor::run(
     const VisionSequence& sequence,
     std::span<const float> frame,
     uint32_t w, uint32_t h)
+{
+    return run_impl(sequence, PixelSource { .data = frame, .channels = 1 }, w, h);
+}
+
+VisionResult VisionExecutor::run(
+    const VisionSequence& sequence,
+    std::span<const uint8_t> frame,
+    uint32_t w, uint32_t h)
+{
+    return run_impl(sequence, PixelSource { .data = frame, .channels = 1 }, w, h);
+}
+
+VisionResult VisionExecutor::run(
+    const VisionSequence& sequence,
+    std::span<const uint16_t> frame,
+    uint32_t w, uint32_t h)
+{
+    return run_impl(sequence, PixelSource { .data = frame, .channels = 1 }, w, h);
+}
+
+VisionResult VisionExecutor::run_impl(
+    const VisionSequence& sequence,
+    const PixelSource& frame,
+    uint32_t w, uint32_t h)
 {
     ensure_slots(w, h);
     const size_t slot_min = static_cast<size_t>(m_slot_w) * m_slot_h * 4;
+    // The previous run may have moved either slot out into its pixel_image.
+    // A fused leading run writes into nxt and leaves cur as the next
+    // destination, so both must be sized before any step runs.
     if (slot_vec(k_slot_nxt).size() < slot_min)
         slot_vec(k_slot_nxt).resize(slot_min);
-    if (slot_vec(k_slot_cur).capacity() < slot_min)
-        slot_vec(k_slot_cur).reserve(slot_min);
-
-    uint32_t channels = 4;
-
-    auto& cur_vec = slot_vec(k_slot_cur);
-    cur_vec.assign(frame.begin(), frame.end());
+    if (slot_vec(k_slot_cur).size() < slot_min)
+        slot_vec(k_slot_cur).resize(slot_min);
+
+    uint32_t channels = frame.size() >= static_cast<size_t>(w) * h * 4 ? 4 : 1;
+
+    PixelSource source = frame;
+    source.channels = channels;
+    bool loaded = false;
+
+    auto load_frame = [&]() {
+        auto& cur_vec = slot_vec(k_slot_cur);
+        if (const auto* f = std::get_if<std::span<const float>>(&frame.data)) {
+            cur_vec.assign(f->begin(), f->end());
+        } else {
+            cur_vec.resize(frame.size());
+            load_pixels(frame, cur_vec);
+        }
+        loaded = true;
+    };
 
     size_t cur = k_slot_cur;
     size_t nxt = k_slot_nxt;
@@ -119,7 +322,27 @@ VisionResult VisionExecutor::run(
     result.w = w;
     result.h = h;
 
-    for (const auto& step : sequence.steps) {
+    for (size_t si = 0; si < sequence.steps.size(); ++si) {
+        if (m_tiles.config().enabled) {
+            if (const size_t fused = plan_tile_run(sequence, si, channels); fused > 0) {
+                const PixelSource in = loaded
+                    ? PixelSource { .data = std::span<const float>(slot_vec(cur)), .channels = channels }
+                    : source;
+                execute_fused(in, nxt, w, h);
+                std::swap(cur, nxt);
+                loaded = true;
+                channels = 1;
+                si += fused - 1;
+                result.structured = std::monostate {};
+                continue;
+            }
+        }
+
+        if (!loaded)
+            load_frame();
+
+        const auto& step = sequence.steps[si];
+
         switch (step.op) {
 
         case VisionOp::Downsample2x: {
@@ -429,6 +652,9 @@ VisionResult VisionExecutor::run(
         } // switch
     }
 
+    if (!loaded)
+        load_frame();
+
     result.pixel_image = std::move(m_slots[cur]);
     slot_vec(cur).reserve(static_cast<size_t>(m_slot_w) * m_slot_h * 4);
     return result;
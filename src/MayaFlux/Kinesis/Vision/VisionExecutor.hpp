@@ -4,6 +4,7 @@
 #include "Features.hpp"
 #include "Gradient.hpp"
 #include "OpticalFlow.hpp"
+#include "TileFusion.hpp"
 #include "VisionOp.hpp"
 
 #include "MayaFlux/Kakshya/NDData/EigenAccess.hpp"
@@ -27,6 +28,12 @@ class VKImage;
  * views, accumulating zero heap allocation in steady state at a fixed
  * resolution. Gaussian kernels are cached by sigma across frames.
  *
+ * Runs of consecutive point and stencil ops (threshold, blur, Sobel/Scharr,
+ * erode/dilate/open/close) are planned into FusedSegments and executed tile
+ * by tile through TileScheduler, so the chain never round-trips full-frame
+ * intermediates through memory. 8-bit and 16-bit frames can be passed
+ * directly; a leading fused run normalises them during the tile load.
+ *
  * VisionResult::pixel_image is a DataVariant (vector<float>) moved out of
  * a scratch slot. Callers read it via EigenAccess::view<Eigen::VectorXf>()
  * for zero-copy Eigen access, or as_span() for raw float access.
@@ -111,6 +118,39 @@ public:
         std::span<const float> frame,
         uint32_t w, uint32_t h);
 
+    /**
+     * @brief Execute a VisionSequence on an 8-bit frame.
+     *
+     * Samples are normalised by 1/255. When the sequence starts with a
+     * tile-fusable run the conversion happens per tile, otherwise the frame
+     * is normalised once into the working slot.
+     */
+    [[nodiscard]] VisionResult run(
+        const VisionSequence& sequence,
+        std::span<const uint8_t> frame,
+        uint32_t w, uint32_t h);
+
+    /**
+     * @brief Execute a VisionSequence on a 16-bit frame.
+     *
+     * Samples are normalised by 1/65535. Same fast path as the 8-bit overload.
+     */
+    [[nodiscard]] VisionResult run(
+        const VisionSequence& sequence,
+        std::span<const uint16_t> frame,
+        uint32_t w, uint32_t h);
+
+    /**
+     * @brief Configure tile fusion. Set config.enabled = false to force
+     *        the per-op full-frame path.
+     */
+    void set_tile_config(const TileConfig& config) { m_tiles.set_config(config); }
+
+    /**
+     * @brief Current tile fusion configuration.
+     */
+    [[nodiscard]] const TileConfig& tile_config() const noexcept { return m_tiles.config(); }
+
     /**
      * @brief Clear stored inter-frame state.
      *
@@ -218,6 +258,34 @@ private:
      */
     [[nodiscard]] const std::vector<float>& gaussian_kernel(float sigma);
 
+    // =========================================================================
+    // Tile fusion
+    //
+    // plan_tile_run() walks the sequence from a given step and fills
+    // m_fused[0, m_fused_count) with segments. Segment storage is reused
+    // across frames so planning does not allocate in steady state.
+    // =========================================================================
+
+    TileScheduler m_tiles;
+    std::vector<FusedSegment> m_fused;
+    size_t m_fused_count { 0 };
+
+    /**
+     * @brief Plan a fused run starting at step @p first.
+     * @return Number of steps consumed, 0 when fewer than two steps fuse.
+     */
+    [[nodiscard]] size_t plan_tile_run(const VisionSequence& sequence, size_t first, uint32_t channels);
+
+    /**
+     * @brief Execute the planned segments, leaving the result in @p dst_slot.
+     */
+    void execute_fused(const PixelSource& src, size_t dst_slot, uint32_t w, uint32_t h);
+
+    [[nodiscard]] VisionResult run_impl(
+        const VisionSequence& sequence,
+        const PixelSource& frame,
+        uint32_t w, uint32_t h);
+
     // =========================================================================
     // Inter-frame state
     // =========================================================================
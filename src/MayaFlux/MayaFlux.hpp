@@ -33,6 +33,7 @@
 #include "Nodes/Conduit/NodeChain.hpp"
 #include "Nodes/Conduit/NodeCombine.hpp"
 #include "Nodes/Conduit/StreamReaderNode.hpp"
+#include "Nodes/Conduit/VarispeedReaderNode.hpp"
 #include "Nodes/Filters/FIR.hpp"
 #include "Nodes/Filters/IIR.hpp"
 #include "Nodes/Generators/Counter.hpp"
@@ -148,6 +149,7 @@
 
 #include "Portal/System/System.hpp"
 
+#include "IO/BulkLoader.hpp"
 #include "IO/IOManager.hpp"
 #include "IO/ImageReader.hpp"
 
@@ -7,6 +7,7 @@ namespace MayaFlux::Nexus {
 void Expanse::evaluate(uint32_t fabric_id,
     std::span<const std::pair<uint32_t, glm::vec3>> snapshot)
 {
+    m_evaluated_fabrics.insert(fabric_id);
     auto& prev = m_occupants_by_fabric[fabric_id];
 
     std::unordered_set<uint32_t> inside;
@@ -36,4 +37,38 @@ void Expanse::evaluate(uint32_t fabric_id,
     }
 }
 
+void Expanse::evaluate_changes(uint32_t fabric_id,
+    std::span<const std::pair<uint32_t, glm::vec3>> moved,
+    std::span<const uint32_t> departed)
+{
+    if (moved.empty() && departed.empty())
+        return;
+
+    auto& occupants = m_occupants_by_fabric[fabric_id];
+
+    for (uint32_t eid : departed) {
+        if (occupants.erase(eid) && m_on_exit)
+            m_on_exit(eid);
+    }
+
+    for (const auto& [eid, pos] : moved) {
+        const bool inside = m_contains && m_contains(pos);
+        if (inside == occupants.contains(eid))
+            continue;
+
+        if (inside) {
+            occupants.insert(eid);
+            if (m_on_enter)
+                m_on_enter(eid);
+        } else {
+            occupants.erase(eid);
+            if (m_on_exit)
+                m_on_exit(eid);
+        }
+    }
+
+    if (occupants.empty())
+        m_occupants_by_fabric.erase(fabric_id);
+}
+
 } // namespace MayaFlux::Nexus
@@ -8,17 +8,19 @@ namespace MayaFlux::Nexus {
  *
  * An Expanse is an extent, not a point. It holds a containment predicate that
  * answers whether a world position lies within it, and two actions fired when
- * an entity crosses its edge: one on entry, one on exit. The Fabric evaluates
- * the predicate against every indexed position on each commit and diffs
- * membership against the previous commit, firing the actions for the
- * difference. The Expanse does not query; the Fabric drives it, because only
- * the Fabric sees consecutive snapshots.
+ * an entity crosses its edge: one on entry, one on exit. On each commit the
+ * Fabric tests every indexed entity against the predicate and compares the
+ * answer with the stored membership, firing the actions for the difference.
+ * The Expanse does not query; the Fabric drives it, because only the Fabric
+ * sees consecutive snapshots.
  *
  * The containment predicate is a plain function from position to bool. A fixed
  * box, a sphere, a half-space, or an extent driven by an evolving value are all
  * the same kind of thing: the predicate closes over whatever state shapes the
- * region, so an Expanse whose bounds move or breathe is expressed by a
- * predicate that reads that state, with no change to the mechanism.
+ * region. An Expanse whose predicate depends on position alone may opt into
+ * set_incremental(true), after which only entities that moved or left since
+ * the previous commit are retested; invalidate() then retests every entity
+ * once after a one-off reshape.
  *
  * The entry and exit actions receive the crossing entity id. What crossing
  * means computationally is the action's decision: a tone gated, a parameter
@@ -129,6 +131,27 @@ public:
         return result;
     }
 
+    /** @brief Whether commits retest only entities that moved or left. */
+    [[nodiscard]] bool is_incremental() const { return m_incremental; }
+
+    /**
+     * @brief Retest only changed entities on each commit.
+     *
+     * Valid only when the predicate depends on position alone: an entity
+     * that stands still keeps its membership even if the region moves.
+     * The first commit after enabling, and after invalidate(), still tests
+     * every entity.
+     */
+    void set_incremental(bool incremental) { m_incremental = incremental; }
+
+    /**
+     * @brief Retest every entity against the predicate on the next commit.
+     *
+     * Call after reshaping an incremental Expanse so stationary entities are
+     * reclassified once.
+     */
+    void invalidate() { m_evaluated_fabrics.clear(); }
+
     /**
      * @brief Evaluate a spatial snapshot from one Fabric against this Expanse.
      *
@@ -143,6 +166,22 @@ public:
     void evaluate(uint32_t fabric_id,
         std::span<const std::pair<uint32_t, glm::vec3>> snapshot);
 
+    /**
+     * @brief Update membership for the entities of one Fabric that changed.
+     *
+     * Tests only the positions in @p moved, comparing each answer with the
+     * entity's stored membership, and treats every id in @p departed as
+     * having left. Entities absent from both keep their membership. Cost is
+     * proportional to the number of changes, not the number of entities.
+     *
+     * @param fabric_id Stable id of the calling Fabric.
+     * @param moved     Entities whose position changed since the last evaluation.
+     * @param departed  Entities removed from that Fabric since the last evaluation.
+     */
+    void evaluate_changes(uint32_t fabric_id,
+        std::span<const std::pair<uint32_t, glm::vec3>> moved,
+        std::span<const uint32_t> departed);
+
 private:
     std::string m_fn_name;
     std::string m_on_enter_fn_name;
@@ -153,6 +192,14 @@ private:
 
     uint32_t m_id { 0 };
     std::unordered_map<uint32_t, std::unordered_set<uint32_t>> m_occupants_by_fabric;
+    std::unordered_set<uint32_t> m_evaluated_fabrics;
+    bool m_incremental { false };
+
+    /** @brief Whether @p fabric_id must pass every position rather than only changes. */
+    [[nodiscard]] bool needs_full_evaluation(uint32_t fabric_id) const
+    {
+        return !m_incremental || !m_evaluated_fabrics.contains(fabric_id);
+    }
 
     friend class Fabric;
 };
@@ -2,11 +2,17 @@
 
 #include "MayaFlux/Journal/Archivist.hpp"
 #include "MayaFlux/Kinesis/Spatial/SpatialIndex.hpp"
+#include "MayaFlux/Transitive/Parallel/Execution.hpp"
 #include "MayaFlux/Vruta/EventManager.hpp"
 #include "MayaFlux/Vruta/Scheduler.hpp"
 
 namespace MayaFlux::Nexus {
 
+namespace {
+    /** Commits with fewer perception queries than this run them on the calling thread. */
+    constexpr size_t k_parallel_queries = 64;
+}
+
 Fabric::Fabric(
     Vruta::TaskScheduler& scheduler,
     Vruta::EventManager& event_manager,
@@ -92,6 +98,7 @@ void Fabric::remove(uint32_t id)
     }
     if (reg.spatial_id.has_value()) {
         m_index->remove(*reg.spatial_id);
+        m_departed.push_back(*reg.spatial_id);
     }
 
     m_registrations.erase(it);
@@ -101,6 +108,7 @@ uint32_t Fabric::add_expanse(std::shared_ptr<Expanse> expanse)
 {
     const uint32_t id = m_next_id++;
     expanse->m_id = id;
+    expanse->m_evaluated_fabrics.erase(m_fabric_id);
     m_expanses.try_emplace(id, std::move(expanse));
     return id;
 }
@@ -175,29 +183,12 @@ std::shared_ptr<Agent> Fabric::get_agent(uint32_t id) const
 
 void Fabric::commit()
 {
-    for (auto& [id, reg] : m_registrations) {
-        if (reg.spatial_id.has_value()) {
-            std::visit([&](const auto& ptr) {
-                if (ptr->m_position.has_value()) {
-                    m_index->update(*reg.spatial_id, *ptr->m_position);
-                }
-            },
-                reg.member);
-        }
-    }
-
-    m_index->publish();
-
-    if (!m_expanses.empty()) {
-        const auto snapshot = m_index->all();
-        for (auto& [xid, expanse] : m_expanses)
-            expanse->evaluate(m_fabric_id, snapshot);
-    }
+    update_positions();
+    evaluate_expanses();
+    run_queries();
 
-    for (auto& [id, reg] : m_registrations) {
-        if (reg.commit_driven) {
-            fire(reg);
-        }
+    for (size_t i = 0; i < m_commit_queue.size(); ++i) {
+        fire(*m_commit_queue[i], m_query_arena[i]);
     }
 }
 
@@ -209,7 +200,17 @@ void Fabric::fire(uint32_t id)
             "Fabric::fire: id {} not registered", id);
         return;
     }
-    fire(it->second);
+    // The slot past the commit-driven ones is reserved for fire(id). It is
+    // moved out while callbacks run, so a nested fire() gets its own vector.
+    const size_t slot = m_commit_queue.size();
+    if (m_query_arena.size() <= slot) {
+        m_query_arena.resize(slot + 1);
+    }
+
+    auto results = std::move(m_query_arena[slot]);
+    query(it->second, results);
+    fire(it->second, results);
+    m_query_arena[slot] = std::move(results);
     it->second.pending_cursor.reset();
 }
 
@@ -252,7 +253,101 @@ uint32_t Fabric::assign_id(Member& m)
     return id;
 }
 
-void Fabric::fire(const Registration& reg) const
+void Fabric::update_positions()
+{
+    m_moved.clear();
+
+    for (auto& [id, reg] : m_registrations) {
+        if (!reg.spatial_id.has_value()) {
+            continue;
+        }
+
+        const auto& position = std::visit(
+            [](const auto& ptr) -> const std::optional<glm::vec3>& { return ptr->m_position; },
+            reg.member);
+
+        if (!position.has_value() || position == reg.committed_position) {
+            continue;
+        }
+
+        m_index->update(*reg.spatial_id, *position);
+        reg.committed_position = position;
+        m_moved.emplace_back(*reg.spatial_id, *position);
+    }
+
+    m_index->publish();
+}
+
+void Fabric::evaluate_expanses()
+{
+    const bool full = std::ranges::any_of(m_expanses, [this](const auto& entry) {
+        return entry.second->needs_full_evaluation(m_fabric_id);
+    });
+
+    if (full) {
+        m_positions.clear();
+        for (const auto& [id, reg] : m_registrations) {
+            if (reg.spatial_id.has_value() && reg.committed_position.has_value()) {
+                m_positions.emplace_back(*reg.spatial_id, *reg.committed_position);
+            }
+        }
+    }
+
+    for (auto& [xid, expanse] : m_expanses) {
+        if (expanse->needs_full_evaluation(m_fabric_id)) {
+            expanse->evaluate(m_fabric_id, m_positions);
+        } else {
+            expanse->evaluate_changes(m_fabric_id, m_moved, m_departed);
+        }
+    }
+
+    m_departed.clear();
+}
+
+void Fabric::run_queries()
+{
+    m_commit_queue.clear();
+    for (auto& [id, reg] : m_registrations) {
+        if (reg.commit_driven) {
+            m_commit_queue.push_back(&reg);
+        }
+    }
+
+    const size_t count = m_commit_queue.size();
+    if (m_query_arena.size() < count) {
+        m_query_arena.resize(count);
+    }
+
+    auto run = [this](size_t i) { query(*m_commit_queue[i], m_query_arena[i]); };
+
+    if (count < k_parallel_queries) {
+        for (size_t i = 0; i < count; ++i) {
+            run(i);
+        }
+        return;
+    }
+
+    Parallel::for_each(Parallel::par,
+        std::views::iota(size_t { 0 }, count).begin(),
+        std::views::iota(size_t { 0 }, count).end(),
+        run);
+}
+
+void Fabric::query(const Registration& reg, std::vector<Kinesis::QueryResult>& out) const
+{
+    out.clear();
+    std::visit([&](const auto& ptr) {
+        using T = std::decay_t<decltype(*ptr)>;
+        if constexpr (!std::is_same_v<T, Emitter>) {
+            if (ptr->m_position.has_value()) {
+                m_index->within_radius(*ptr->m_position, ptr->m_query_radius, out);
+            }
+        }
+    },
+        reg.member);
+}
+
+void Fabric::fire(const Registration& reg, std::span<const Kinesis::QueryResult> results) const
 {
     std::visit([&](const auto& ptr) {
         using T = std::decay_t<decltype(*ptr)>;
@@ -274,17 +369,15 @@ void Fabric::fire(const Registration& reg) const
             PerceptionContext ctx;
             if (ptr->m_position.has_value()) {
                 ctx.position = *ptr->m_position;
-                auto results = m_index->within_radius(*ptr->m_position, ptr->m_query_radius);
-                ctx.spatial_results = std::span(results);
+                ctx.spatial_results = results;
             }
             ptr->invoke(ctx);
 
         } else if constexpr (std::is_same_v<T, Agent>) {
             if (ptr->m_position.has_value()) {
-                auto results = m_index->within_radius(*ptr->m_position, ptr->m_query_radius);
                 PerceptionContext pctx;
                 pctx.position = *ptr->m_position;
-                pctx.spatial_results = std::span(results);
+                pctx.spatial_results = results;
                 ptr->invoke_perception(pctx);
 
                 InfluenceContext ictx;
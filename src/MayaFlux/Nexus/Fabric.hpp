@@ -137,15 +137,26 @@ public:
     /**
      * @brief Update all positions, publish the snapshot, fire all registered objects.
      *
-     * For each object with a position, calls @c m_index->update() then
-     * @c m_index->publish(). Then fires each object's function with a
-     * context built from the new snapshot.
+     * Runs in phases against one published snapshot:
+     *  - Update: objects whose position changed since the last commit are
+     *    written to @c m_index, which is then published.
+     *  - Expanses: each Expanse is evaluated against every position. An
+     *    Expanse marked incremental that has already seen this Fabric
+     *    retests only the moved and removed objects instead.
+     *  - Query: the perception queries of all commit-driven Sensors and
+     *    Agents run in parallel into per-object result vectors that are
+     *    reused across commits.
+     *  - Invoke: each commit-driven object's function is called in turn on
+     *    this thread with a context over its query results.
      */
     void commit();
 
     /**
      * @brief Fire a single object against the current snapshot without republishing.
      * @param id Id assigned at registration.
+     *
+     * Queries into a reserved slot of the commit query arena, so repeated
+     * calls do not allocate once the slot has grown.
      */
     void fire(uint32_t id);
 
@@ -280,10 +291,15 @@ private:
         std::optional<uint32_t> spatial_id;
         std::optional<Wiring> wiring;
         std::optional<glm::vec2> pending_cursor;
+        std::optional<glm::vec3> committed_position;
     };
 
     uint32_t assign_id(Member& m);
-    void fire(const Registration& reg) const;
+    void query(const Registration& reg, std::vector<Kinesis::QueryResult>& out) const;
+    void fire(const Registration& reg, std::span<const Kinesis::QueryResult> results) const;
+    void update_positions();
+    void evaluate_expanses();
+    void run_queries();
 
     Vruta::TaskScheduler& m_scheduler;
     Vruta::EventManager& m_event_manager;
@@ -292,6 +308,12 @@ private:
     std::unordered_map<uint32_t, Registration> m_registrations;
     std::unordered_map<uint32_t, std::shared_ptr<Expanse>> m_expanses;
 
+    std::vector<std::pair<uint32_t, glm::vec3>> m_moved;
+    std::vector<uint32_t> m_departed;
+    std::vector<std::pair<uint32_t, glm::vec3>> m_positions;
+    std::vector<Registration*> m_commit_queue;
+    std::vector<std::vector<Kinesis::QueryResult>> m_query_arena;
+
     uint32_t m_fabric_id { 0 };
     uint32_t m_next_id { 1 };
     uint32_t m_next_expanse_id { 1 };
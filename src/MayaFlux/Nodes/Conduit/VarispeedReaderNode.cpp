@@ -0,0 +1,185 @@
+#include "VarispeedReaderNode.hpp"
+
+#include "MayaFlux/Journal/Archivist.hpp"
+#include "MayaFlux/Kakshya/Source/DynamicSoundStream.hpp"
+#include "MayaFlux/Nodes/RootNode.hpp"
+
+namespace MayaFlux::Nodes {
+
+VarispeedReaderNode::VarispeedReaderNode(std::shared_ptr<Kakshya::SoundStreamContainer> container, uint32_t channel)
+    : m_container(std::move(container))
+    , m_stream(dynamic_cast<Kakshya::DynamicSoundStream*>(m_container.get()))
+    , m_channel(channel)
+{
+    m_last_output = 0.0;
+    refresh_view();
+
+    // Build every sinc bandwidth here so neither the first render nor a
+    // later rate or quality change allocates on the audio thread.
+    Kinesis::Discrete::prepare_varispeed();
+}
+
+size_t VarispeedReaderNode::process_into(std::span<double> out)
+{
+    if (!m_container) {
+        std::ranges::fill(out, 0.0);
+        return 0;
+    }
+
+    size_t rendered = 0;
+
+    if (!render_segmented(out, rendered)) {
+        if (m_container->get_data_version() != m_view_version) {
+            if (ProcessingScope::active()) {
+                if (!m_stale_reported) {
+                    MF_RT_WARN(Journal::Component::Nodes, Journal::Context::NodeProcessing,
+                        "VarispeedReaderNode: container data changed; silent until refresh_view()");
+                    m_stale_reported = true;
+                }
+                std::ranges::fill(out, 0.0);
+                m_last_output = 0.0;
+                return 0;
+            }
+            refresh_view();
+        }
+        rendered = Kinesis::Discrete::render_varispeed(m_voice, m_view, out, m_view_stride);
+    }
+
+    if (!out.empty()) {
+        m_last_output = out.back();
+    }
+    return rendered;
+}
+
+bool VarispeedReaderNode::render_segmented(std::span<double> out, size_t& rendered)
+{
+    if (!m_stream)
+        return false;
+
+    uint64_t frames = 0;
+    const auto store = m_stream->pin_segments(frames);
+    if (!store)
+        return false;
+
+    if (m_channel >= store->get_num_channels()) {
+        std::ranges::fill(out, 0.0);
+        rendered = 0;
+        return true;
+    }
+
+    const Kinesis::Discrete::SegmentedSource source {
+        .segments = store->get_segment_table(),
+        .shift = static_cast<uint32_t>(std::countr_zero(store->get_segment_frames())),
+        .offset = store->get_channel_offset(m_channel),
+        .stride = store->get_frame_stride(),
+        .frames = frames,
+    };
+    rendered = Kinesis::Discrete::render_varispeed(m_voice, source, out);
+    return true;
+}
+
+void VarispeedReaderNode::refresh_view()
+{
+    if (!m_container) {
+        m_view = {};
+        m_view_stride = 1;
+        return;
+    }
+
+    // Version first: a change racing the lookup leaves the view marked stale.
+    m_view_version = m_container->get_data_version();
+    std::tie(m_view, m_view_stride) = m_container->get_channel_view(m_channel);
+    m_stale_reported = false;
+}
+
+double VarispeedReaderNode::process_sample(double /*input*/)
+{
+    double sample = 0.0;
+    process_into({ &sample, 1 });
+
+    if ((!m_state_saved || m_fire_events_during_snapshot) && !m_networked_node) {
+        notify_tick(m_last_output);
+    }
+
+    return m_last_output;
+}
+
+std::vector<double> VarispeedReaderNode::process_batch(unsigned int num_samples)
+{
+    std::vector<double> out(num_samples);
+    process_into(out);
+
+    if ((m_callbacks.empty() && m_conditional_callbacks.empty())
+        || (m_state_saved && !m_fire_events_during_snapshot) || m_networked_node) {
+        return out;
+    }
+
+    for (double sample : out) {
+        notify_tick(sample);
+    }
+    return out;
+}
+
+void VarispeedReaderNode::save_state()
+{
+    m_saved_voice = m_voice;
+    m_saved_last_output = m_last_output;
+    m_state_saved = true;
+}
+
+void VarispeedReaderNode::restore_state()
+{
+    m_voice = m_saved_voice;
+    m_last_output = m_saved_last_output;
+    m_state_saved = false;
+}
+
+void VarispeedReaderNode::set_container(std::shared_ptr<Kakshya::SoundStreamContainer> container, uint32_t channel)
+{
+    m_container = std::move(container);
+    m_stream = dynamic_cast<Kakshya::DynamicSoundStream*>(m_container.get());
+    m_channel = channel;
+    refresh_view();
+    seek(0.0);
+}
+
+void VarispeedReaderNode::set_loop(uint64_t begin, uint64_t end)
+{
+    m_voice.loop_begin = begin;
+    m_voice.loop_end = end;
+    m_voice.looping = true;
+}
+
+void VarispeedReaderNode::seek(double frame)
+{
+    m_voice.position = frame;
+    m_voice.finished = false;
+}
+
+void VarispeedReaderNode::update_context(double value)
+{
+    m_context.value = value;
+    m_context.position = m_voice.position;
+    m_context.rate = m_voice.rate;
+}
+
+NodeContext& VarispeedReaderNode::get_last_context()
+{
+    return m_context;
+}
+
+void VarispeedReaderNode::notify_tick(double value)
+{
+    update_context(value);
+
+    for (auto& cb : m_callbacks) {
+        cb(m_context);
+    }
+    for (auto& [cb, cond] : m_conditional_callbacks) {
+        if (cond(m_context)) {
+            cb(m_context);
+        }
+    }
+}
+
+} // namespace MayaFlux::Nodes
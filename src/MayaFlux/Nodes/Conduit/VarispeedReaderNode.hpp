@@ -0,0 +1,144 @@
+#pragma once
+
+#include "MayaFlux/Nodes/Node.hpp"
+
+#include "MayaFlux/Kinesis/Discrete/Varispeed.hpp"
+
+namespace MayaFlux::Kakshya {
+class SoundStreamContainer;
+class DynamicSoundStream;
+}
+
+namespace MayaFlux::Nodes {
+
+/**
+ * @class VarispeedReaderContext
+ * @brief Callback context carrying the playback head of a VarispeedReaderNode
+ */
+class MAYAFLUX_API VarispeedReaderContext : public NodeContext {
+public:
+    VarispeedReaderContext()
+        : NodeContext(0.0)
+    {
+    }
+
+    double position {}; ///< Read head in source frames after this sample
+    double rate { 1.0 }; ///< Playback rate in effect
+};
+
+/**
+ * @class VarispeedReaderNode
+ * @brief Plays one channel of a sound container at a variable, fractional rate
+ *
+ * Reads directly from the container's sample storage through
+ * Kinesis::Discrete::render_varispeed(), so pitch can glide continuously
+ * without any offline resampling. The node owns only a VarispeedVoice;
+ * processing never allocates beyond the vector returned by process_batch().
+ *
+ * Playback rate is in source frames per output sample. To play a file
+ * recorded at 44.1 kHz at original pitch on a 48 kHz graph, use a rate of
+ * 44100.0 / 48000.0 and multiply by any pitch ratio on top.
+ *
+ * The source is never looked up on the audio thread. A DynamicSoundStream
+ * with segmented storage is read through its segment table, so samples
+ * recorded while the node plays are heard as they arrive. Any other
+ * container is read through a channel view cached by refresh_view(); once
+ * the container's data changes, rendering inside a ProcessingScope plays
+ * silence until refresh_view() is called off the audio thread, while
+ * rendering outside one refreshes the view itself.
+ *
+ * SINC quality (default) is band-limited and alias-free up to a rate of 8.
+ * Its kernel tables are built when the node is constructed, so rendering
+ * never allocates.
+ * CUBIC is several times cheaper and suited to control-rate sources or
+ * large voice counts where some aliasing is acceptable.
+ */
+class MAYAFLUX_API VarispeedReaderNode final : public Node {
+public:
+    /**
+     * @param container Source container; may be set later
+     * @param channel   Channel of @p container to play
+     */
+    explicit VarispeedReaderNode(std::shared_ptr<Kakshya::SoundStreamContainer> container = nullptr, uint32_t channel = 0);
+
+    double process_sample(double input = 0.0) override;
+    std::vector<double> process_batch(unsigned int num_samples) override;
+
+    /**
+     * @brief Render directly into a caller-provided buffer
+     * @param out Destination samples
+     * @return Samples rendered before playback finished
+     */
+    size_t process_into(std::span<double> out);
+
+    void save_state() override;
+    void restore_state() override;
+
+    NodeContext& get_last_context() override;
+
+    /**
+     * @brief Re-read the container's channel view after its data changed
+     *
+     * May lock and allocate, so call it off the audio thread. Not needed for
+     * a segmented DynamicSoundStream.
+     */
+    void refresh_view();
+
+    /**
+     * @brief Replace the source and rewind to frame 0
+     */
+    void set_container(std::shared_ptr<Kakshya::SoundStreamContainer> container, uint32_t channel = 0);
+
+    /** @brief Playback rate in source frames per output sample; negative plays backwards */
+    void set_rate(double rate) { m_voice.rate = rate; }
+    [[nodiscard]] double get_rate() const { return m_voice.rate; }
+
+    void set_quality(Kinesis::Discrete::ResampleQuality quality) { m_voice.quality = quality; }
+    [[nodiscard]] Kinesis::Discrete::ResampleQuality get_quality() const { return m_voice.quality; }
+
+    /**
+     * @brief Loop between two frames
+     * @param begin First frame of the loop
+     * @param end   One past the last frame; 0 loops to the end of the source
+     */
+    void set_loop(uint64_t begin, uint64_t end = 0);
+
+    /** @brief Enable or disable looping without changing the loop points */
+    void set_looping(bool enable) { m_voice.looping = enable; }
+
+    /** @brief Move the read head (fractional frames) and clear the finished flag */
+    void seek(double frame);
+
+    [[nodiscard]] double get_position() const { return m_voice.position; }
+
+    /** @brief True once a non-looping voice has played past either end */
+    [[nodiscard]] bool is_finished() const { return m_voice.finished; }
+
+    /** @brief Direct access to the playback state */
+    [[nodiscard]] Kinesis::Discrete::VarispeedVoice& voice() { return m_voice; }
+
+protected:
+    void update_context(double value) override;
+    void notify_tick(double value) override;
+
+private:
+    std::shared_ptr<Kakshya::SoundStreamContainer> m_container;
+    Kakshya::DynamicSoundStream* m_stream {}; ///< m_container when it is a DynamicSoundStream
+    uint32_t m_channel {};
+
+    std::span<const double> m_view; ///< Channel samples, taken by refresh_view()
+    size_t m_view_stride { 1 };
+    uint64_t m_view_version {}; ///< Container data version m_view belongs to
+    bool m_stale_reported {};
+
+    /** @brief Render from a segmented DynamicSoundStream; false if the source is not one */
+    bool render_segmented(std::span<double> out, size_t& rendered);
+
+    Kinesis::Discrete::VarispeedVoice m_voice;
+    Kinesis::Discrete::VarispeedVoice m_saved_voice;
+    double m_saved_last_output {};
+
+    VarispeedReaderContext m_context;
+};
+
+} // namespace MayaFlux::Nodes
@@ -294,7 +294,7 @@ void Logic::reset()
 {
     std::ranges::fill(m_history_ring, false);
     m_history_head = 0;
-    m_history_count = m_history_size;
+    m_history_count = std::min(m_history_size, m_history_ring.size());
     m_edge_detected = false;
     m_last_output = 0.0;
     m_hysteresis_state = false;
@@ -30,15 +30,16 @@ double Random::process_sample(double input)
 
 std::vector<double> Random::process_batch(unsigned int num_samples)
 {
-    auto samples = m_generator.batch(m_current_start, m_current_end, num_samples);
-
-    for (auto& sample : samples) {
-        sample *= m_amplitude;
-    }
-
+    std::vector<double> samples(num_samples);
+    fill(samples);
     return samples;
 }
 
+void Random::fill(std::span<double> out)
+{
+    m_generator.fill(out, m_current_start, m_current_end, m_amplitude);
+}
+
 void Random::set_normal_spread(double spread)
 {
     m_generator.configure("spread", spread);
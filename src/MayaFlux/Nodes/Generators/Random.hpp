@@ -159,6 +159,22 @@ public:
      */
     std::vector<double> process_batch(unsigned int num_samples) override;
 
+    /**
+     * @brief Fills a caller-provided buffer with scaled stochastic values
+     * @param out Destination samples
+     *
+     * Allocation-free counterpart of process_batch(): values are generated
+     * directly into @p out with amplitude applied in the same pass.
+     */
+    void fill(std::span<double> out);
+
+    /**
+     * @brief Seeds the generator for reproducible output
+     * @param seed Base seed
+     * @param stream Independent stream index, e.g. the voice number
+     */
+    void set_seed(uint64_t seed, uint64_t stream = 0) { m_generator.seed(seed, stream); }
+
     /**
      * @brief Sets the variance parameter for normal distribution
      * @param spread New variance value
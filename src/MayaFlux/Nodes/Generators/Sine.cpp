@@ -144,6 +144,41 @@ std::vector<double> Sine::process_batch(unsigned int num_samples)
     return output;
 }
 
+void Sine::process_batch_f32(std::span<float> output)
+{
+    if (output.empty())
+        return;
+
+    if (!is_block_independent()) {
+        Node::process_batch_f32(output);
+        return;
+    }
+
+    const auto amplitude = static_cast<float>(m_amplitude);
+    for (float& sample : output) {
+        sample = amplitude * std::sin(static_cast<float>(m_phase + m_offset));
+        m_phase += m_phase_inc;
+
+        if (m_phase > 2 * M_PI) {
+            m_phase -= 2 * M_PI;
+        } else if (m_phase < -2 * M_PI) {
+            m_phase += 2 * M_PI;
+        }
+    }
+
+    m_last_output = output.back();
+
+    if ((!m_state_saved || m_fire_events_during_snapshot) && !m_networked_node) {
+        notify_tick(m_last_output);
+    }
+}
+
+bool Sine::is_block_independent() const
+{
+    return !m_frequency_modulator && !m_amplitude_modulator
+        && m_callbacks.empty() && m_conditional_callbacks.empty();
+}
+
 void Sine::reset(float frequency, double amplitude, float offset)
 {
     m_phase = 0;
@@ -104,6 +104,21 @@ public:
      */
     std::vector<double> process_batch(unsigned int num_samples) override;
 
+    /**
+     * @brief Renders a block in single precision
+     * @param output Destination span
+     *
+     * Without modulators or tick callbacks the phase is advanced in double
+     * precision and the waveform evaluated in float for the whole block, with
+     * one context update at the end. Otherwise falls back to process_sample().
+     */
+    void process_batch_f32(std::span<float> output) override;
+
+    /**
+     * @brief True without modulators or tick callbacks
+     */
+    [[nodiscard]] bool is_block_independent() const override;
+
     /**
      * @brief Sets the oscillator's frequency
      * @param frequency New frequency in Hz
@@ -1,7 +1,5 @@
 #include "SDFNode.hpp"
 
-#include "MayaFlux/Kinesis/GeometryPrimitives.hpp"
-
 #include "MayaFlux/Journal/Archivist.hpp"
 
 namespace MayaFlux::Nodes::GpuSync {
@@ -29,6 +27,8 @@ SDFNode::SDFNode(
 void SDFNode::set_field(Kinesis::SpatialField field)
 {
     m_field = std::move(field);
+    if (m_mesher)
+        m_mesher->set_field(m_field);
     m_dirty = true;
 }
 
@@ -36,6 +36,7 @@ void SDFNode::set_bounds(const glm::vec3& bounds_min, const glm::vec3& bounds_ma
 {
     m_bounds_min = bounds_min;
     m_bounds_max = bounds_max;
+    m_mesher.reset();
     m_dirty = true;
 }
 
@@ -44,15 +45,36 @@ void SDFNode::set_resolution(uint32_t res_x, uint32_t res_y, uint32_t res_z)
     m_res_x = std::max(res_x, 1U);
     m_res_y = std::max(res_y, 1U);
     m_res_z = std::max(res_z, 1U);
+    m_mesher.reset();
     m_dirty = true;
 }
 
 void SDFNode::set_iso_level(float iso_level)
 {
     m_iso_level = iso_level;
+    m_mesher.reset();
+    m_dirty = true;
+}
+
+void SDFNode::set_mesh_options(const Kinesis::SDFMeshOptions& options)
+{
+    m_options = options;
+    m_mesher.reset();
+    m_dirty = true;
+}
+
+void SDFNode::invalidate_region(const glm::vec3& region_min, const glm::vec3& region_max)
+{
+    if (m_mesher)
+        m_mesher->invalidate_region(region_min, region_max);
     m_dirty = true;
 }
 
+Kinesis::SDFMeshStats SDFNode::mesh_stats() const
+{
+    return m_mesher ? m_mesher->stats() : Kinesis::SDFMeshStats {};
+}
+
 void SDFNode::compute_frame()
 {
     if (!m_dirty)
@@ -62,9 +84,14 @@ void SDFNode::compute_frame()
 
 void SDFNode::rebuild()
 {
-    auto data = Kinesis::generate_sdf_mesh(
-        m_field, m_bounds_min, m_bounds_max,
-        m_res_x, m_res_y, m_res_z, m_iso_level);
+    if (!m_mesher) {
+        m_mesher = std::make_unique<Kinesis::SDFMesher>(
+            m_bounds_min, m_bounds_max,
+            m_res_x, m_res_y, m_res_z, m_iso_level, m_options);
+        m_mesher->set_field(m_field);
+    }
+
+    auto data = m_mesher->extract();
 
     if (!data.is_valid()) {
         MF_WARN(Journal::Component::Nodes, Journal::Context::NodeProcessing,
@@ -2,7 +2,7 @@
 
 #include "MeshWriterNode.hpp"
 
-#include "MayaFlux/Kinesis/Tendency/Tendency.hpp"
+#include "MayaFlux/Kinesis/SDFMesher.hpp"
 
 namespace MayaFlux::Nodes::GpuSync {
 
@@ -42,6 +42,16 @@ namespace MayaFlux::Nodes::GpuSync {
  *
  * // Audio metro writes radius, graphics metro marks node dirty.
  * @endcode
+ *
+ * Samples and per-brick triangles persist between rebuilds. When an edit
+ * only affects part of the volume, invalidate_region() re-meshes just the
+ * bricks it touches:
+ * @code
+ * node->set_mesh_options({ .lipschitz = 1.0F });  // true SDF: skip empty bricks
+ * // blob (influence radius r) moved from old_pos to new_pos
+ * node->invalidate_region(glm::min(old_pos, new_pos) - glm::vec3(r),
+ *                         glm::max(old_pos, new_pos) + glm::vec3(r));
+ * @endcode
  */
 class MAYAFLUX_API SDFNode : public MeshWriterNode {
 public:
@@ -94,6 +104,24 @@ public:
      */
     void set_iso_level(float iso_level);
 
+    /**
+     * @brief Replace brick size, skipping and threading options and mark dirty.
+     * @param options See Kinesis::SDFMeshOptions.
+     */
+    void set_mesh_options(const Kinesis::SDFMeshOptions& options);
+
+    /**
+     * @brief Mark the field as changed inside a box; only bricks touching it are re-meshed.
+     * @param region_min Minimum corner of the edited region.
+     * @param region_max Maximum corner of the edited region.
+     */
+    void invalidate_region(const glm::vec3& region_min, const glm::vec3& region_max);
+
+    /**
+     * @brief Evaluation counts and timings of the most recent rebuild.
+     */
+    [[nodiscard]] Kinesis::SDFMeshStats mesh_stats() const;
+
     /**
      * @brief Re-extract the isosurface if dirty, then upload via parent.
      */
@@ -107,6 +135,8 @@ private:
     uint32_t m_res_y;
     uint32_t m_res_z;
     float m_iso_level;
+    Kinesis::SDFMeshOptions m_options;
+    std::unique_ptr<Kinesis::SDFMesher> m_mesher;
     bool m_dirty { false };
 
     void rebuild();
@@ -16,6 +16,13 @@ bool Node::should_mock_process() const
     return m_state.load() & NodeState::MOCK_PROCESS;
 }
 
+void Node::process_batch_f32(std::span<float> output)
+{
+    for (float& sample : output) {
+        sample = static_cast<float>(process_sample(0.));
+    }
+}
+
 void Node::on_tick(const NodeHook& callback)
 {
     safe_add_callback(m_callbacks, callback);
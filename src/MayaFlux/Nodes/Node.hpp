@@ -159,6 +159,33 @@ public:
      */
     virtual std::vector<double> process_batch(unsigned int num_samples) = 0;
 
+    /**
+     * @brief Renders a block of output samples in single precision
+     * @param output Destination span; one sample is written per element
+     *
+     * Block counterpart of process_sample() used by block node rendering.
+     * The default implementation calls process_sample() once per element and
+     * narrows the result, so every node participates unchanged. Nodes whose
+     * per-sample work dominates (oscillators without modulators, for example)
+     * override this with a float loop that skips per-sample dispatch.
+     *
+     * Like process_sample(), this does NOT mark the node as processed.
+     */
+    virtual void process_batch_f32(std::span<float> output);
+
+    /**
+     * @brief Whether process_batch_f32() can render a whole block on its own
+     * @return true if the block reads no other node and fires no per-sample callbacks
+     *
+     * Block rendering runs each node to the end of the block before the next
+     * node starts, which is only equivalent to the per-sample path when no
+     * node reads another node's output mid-block. Returning false (the
+     * default) makes the whole processing domain fall back to per-sample
+     * rendering. Overrides must return false while the node has modulators,
+     * inputs or tick callbacks.
+     */
+    [[nodiscard]] virtual bool is_block_independent() const { return false; }
+
     /**
      * @brief Registers a callback to be called on each tick
      * @param callback Function to call with the current node context
@@ -535,6 +562,15 @@ public:
      */
     std::atomic<uint32_t> m_modulator_count { 0 };
 
+    /**
+     * @brief Most recent block rendered by process_batch_f32() through a RootNode
+     *
+     * A node routed to several channels is rendered once per cycle by the first
+     * channel's RootNode; the remaining channels read this block while the
+     * PROCESSED flag is set. Resized only when the block size changes.
+     */
+    std::vector<float> m_block_f32;
+
     /**
      * @brief Attempt to claim snapshot context for this processing cycle
      * @param context_id Unique context identifier for this buffer processing
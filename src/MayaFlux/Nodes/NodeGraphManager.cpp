@@ -5,15 +5,20 @@
 #include "Conduit/NodeChain.hpp"
 
 #include "MayaFlux/Journal/Archivist.hpp"
+#include "MayaFlux/Transitive/Profile/Profiler.hpp"
 
 namespace MayaFlux::Nodes {
 
 namespace {
-    const std::vector<std::shared_ptr<Node>> empty {};
+    constexpr size_t token_index(ProcessingToken token)
+    {
+        return static_cast<size_t>(token);
+    }
 }
 
 NodeGraphManager::NodeGraphManager(uint32_t sample_rate, uint32_t block_size, uint32_t frame_rate)
-    : m_registered_sample_rate(sample_rate)
+    : m_topology(std::make_unique<Topology>())
+    , m_registered_sample_rate(sample_rate)
     , m_registered_block_size(block_size)
     , m_registered_frame_rate(frame_rate)
 {
@@ -24,6 +29,12 @@ void NodeGraphManager::add_to_root(const std::shared_ptr<Node>& node,
     ProcessingToken token,
     unsigned int channel)
 {
+    if (ProcessingScope::active()) {
+        queue_edit({ .kind = TopologyEdit::Kind::ADD_NODE, .token = token, .channel = channel, .node = node },
+            "node registration");
+        return;
+    }
+
     set_channel_mask(node, channel);
     node->set_sample_rate(m_registered_sample_rate);
     node->set_frame_rate(m_registered_frame_rate);
@@ -40,41 +51,50 @@ void NodeGraphManager::remove_from_root(const std::shared_ptr<Node>& node,
     ProcessingToken token,
     unsigned int channel)
 {
+    if (ProcessingScope::active()) {
+        queue_edit({ .kind = TopologyEdit::Kind::REMOVE_NODE, .token = token, .channel = channel, .node = node },
+            "node removal");
+        return;
+    }
+
     unset_channel_mask(node, channel);
 
     auto& root = get_root_node(token, channel);
     root.unregister_node(node);
 }
 
-const std::vector<std::shared_ptr<Node>>&
+std::vector<std::shared_ptr<Node>>
 NodeGraphManager::get_nodes(ProcessingToken token, uint32_t channel) const
 {
+    auto topology = m_topology.read();
+    const auto& domain = topology->tokens[token_index(token)];
 
-    auto token_it = m_token_roots.find(token);
-    if (token_it == m_token_roots.end()) {
+    if (domain.roots.empty()) {
         MF_ERROR(Journal::Component::Nodes,
             Journal::Context::NodeProcessing,
             "Attempted to get nodes for non-existent token {}. Returning empty vector.",
             Reflect::enum_to_string(token));
-        return empty;
+        return {};
     }
-    auto channel_it = token_it->second.find(channel);
 
-    if (channel_it == token_it->second.end()) {
+    RootNode* root = domain.root(channel);
+    if (!root) {
         MF_ERROR(Journal::Component::Nodes,
             Journal::Context::NodeProcessing,
             "Attempted to get nodes for token {} channel {} which does not exist. Returning empty vector.",
             Reflect::enum_to_string(token), channel);
-        return empty;
+        return {};
     }
 
-    return channel_it->second->nodes();
+    return root->nodes();
 }
 
 void NodeGraphManager::register_token_processor(ProcessingToken token,
-    std::function<void(std::span<RootNode*>)> processor)
+    std::function<void(std::span<RootNode* const>)> processor)
 {
+    std::lock_guard lock(m_topology_mutex);
     m_token_processors[token] = std::move(processor);
+    publish_topology_locked();
 }
 
 const std::unordered_map<unsigned int, std::shared_ptr<RootNode>>& NodeGraphManager::get_all_channel_root_nodes(ProcessingToken token) const
@@ -82,25 +102,17 @@ const std::unordered_map<unsigned int, std::shared_ptr<RootNode>>& NodeGraphMana
     static std::unordered_map<unsigned int, std::shared_ptr<RootNode>> audio_roots;
     audio_roots.clear();
 
-    auto it = m_token_roots.find(token);
-    if (it != m_token_roots.end()) {
-        for (const auto& [channel, root] : it->second) {
-            audio_roots[channel] = root;
-        }
+    auto topology = m_topology.read();
+    for (const auto& root : topology->tokens[token_index(token)].owners) {
+        audio_roots[root->get_channel()] = root;
     }
     return audio_roots;
 }
 
 bool NodeGraphManager::preprocess_networks(ProcessingToken token)
 {
-    auto& processing_ptr = m_token_network_processing[token];
-
-    if (!processing_ptr) {
-        processing_ptr = std::make_unique<std::atomic<bool>>(false);
-    }
-
     bool expected = false;
-    return processing_ptr->compare_exchange_strong(
+    return m_token_network_processing[token_index(token)].compare_exchange_strong(
         expected, true,
         std::memory_order_acquire,
         std::memory_order_relaxed);
@@ -111,10 +123,11 @@ void NodeGraphManager::process_token(ProcessingToken token, unsigned int num_sam
     if (m_terminate_requested.load())
         return;
 
-    auto roots = get_all_root_nodes(token);
+    auto topology = m_topology.read();
+    const auto& domain = topology->tokens[token_index(token)];
 
-    if (auto it = m_token_processors.find(token); it != m_token_processors.end()) {
-        it->second(std::span<RootNode*>(roots.data(), roots.size()));
+    if (domain.processor) {
+        domain.processor(domain.roots);
         return;
     }
 
@@ -122,30 +135,30 @@ void NodeGraphManager::process_token(ProcessingToken token, unsigned int num_sam
         return;
     }
 
-    auto it = m_token_networks.find(token);
-    if (it != m_token_networks.end()) {
-        for (auto& network : it->second) {
-            if (!network || !network->is_enabled()) {
-                continue;
-            }
+    for (const auto& network : domain.networks) {
+        if (!network || !network->is_enabled()) {
+            continue;
+        }
 
-            if (!network->is_processed_this_cycle()) {
-                network->mark_processing(true);
+        if (!network->is_processed_this_cycle()) {
+            network->mark_processing(true);
+            {
+                Profile::Zone zone(Profile::Category::NETWORK, network.get(), typeid(*network));
                 network->process_batch(num_samples);
-                network->mark_processing(false);
-                network->mark_processed(true);
             }
+            network->mark_processing(false);
+            network->mark_processed(true);
         }
     }
 
     postprocess_networks(token, std::nullopt);
 
     if (token == ProcessingToken::AUDIO_RATE) {
-        for (auto* root : roots) {
+        for (auto* root : domain.roots) {
             root->process_batch(num_samples);
         }
     } else if (token == ProcessingToken::VISUAL_RATE) {
-        for (auto* root : roots) {
+        for (auto* root : domain.roots) {
             root->process_batch_frame(num_samples);
         }
     }
@@ -159,9 +172,9 @@ std::vector<std::vector<double>> NodeGraphManager::process_audio_networks(Proces
 
     std::vector<std::vector<double>> all_network_outputs;
 
-    auto audio_it = m_audio_networks.find(token);
-    if (audio_it != m_audio_networks.end()) {
-        for (auto& network : audio_it->second) {
+    {
+        auto topology = m_topology.read();
+        for (const auto& network : topology->tokens[token_index(token)].audio_networks) {
             if (!network || !network->is_enabled()) {
                 continue;
             }
@@ -172,7 +185,10 @@ std::vector<std::vector<double>> NodeGraphManager::process_audio_networks(Proces
 
             if (!network->is_processed_this_cycle()) {
                 network->mark_processing(true);
-                network->process_batch(num_samples);
+                {
+                    Profile::Zone zone(Profile::Category::NETWORK, network.get(), typeid(*network));
+                    network->process_batch(num_samples);
+                }
                 network->mark_processing(false);
                 network->mark_processed(true);
             }
@@ -209,29 +225,24 @@ void NodeGraphManager::postprocess_networks(ProcessingToken token, std::optional
     if (token == ProcessingToken::AUDIO_RATE && channel.has_value()) {
         auto ch = channel.value_or(0U);
         reset_audio_network_state(token, ch);
-    } else if (auto it = m_token_networks.find(token); it != m_token_networks.end()) {
-        for (auto& network : it->second) {
+    } else {
+        auto topology = m_topology.read();
+        for (const auto& network : topology->tokens[token_index(token)].networks) {
             if (network && network->is_enabled()) {
                 network->mark_processed(false);
             }
         }
     }
 
-    if (auto it = m_token_network_processing.find(token); it != m_token_network_processing.end()) {
-        it->second->store(false, std::memory_order_release);
-    }
+    m_token_network_processing[token_index(token)].store(false, std::memory_order_release);
 }
 
 void NodeGraphManager::reset_audio_network_state(ProcessingToken token, uint32_t channel)
 {
-    auto audio_it = m_audio_networks.find(token);
-    if (audio_it != m_audio_networks.end()) {
-        for (auto& network : audio_it->second) {
-            if (network) {
-                if (network->is_registered_on_channel(channel)) {
-                    network->request_reset_from_channel(channel);
-                }
-            }
+    auto topology = m_topology.read();
+    for (const auto& network : topology->tokens[token_index(token)].audio_networks) {
+        if (network && network->is_registered_on_channel(channel)) {
+            network->request_reset_from_channel(channel);
         }
     }
 }
@@ -239,13 +250,17 @@ void NodeGraphManager::reset_audio_network_state(ProcessingToken token, uint32_t
 void NodeGraphManager::register_token_channel_processor(ProcessingToken token,
     TokenChannelProcessor processor)
 {
+    std::lock_guard lock(m_topology_mutex);
     m_token_channel_processors[token] = std::move(processor);
+    publish_topology_locked();
 }
 
 void NodeGraphManager::register_token_sample_processor(ProcessingToken token,
     TokenSampleProcessor processor)
 {
+    std::lock_guard lock(m_topology_mutex);
     m_token_sample_processors[token] = std::move(processor);
+    publish_topology_locked();
 }
 
 std::vector<double> NodeGraphManager::process_channel(ProcessingToken token,
@@ -255,15 +270,22 @@ std::vector<double> NodeGraphManager::process_channel(ProcessingToken token,
         reset_audio_network_state(token);
     }
 
-    auto& root = get_root_node(token, channel);
+    auto topology = m_topology.read();
+    const auto& domain = topology->tokens[token_index(token)];
+
+    RootNode* root = domain.root(channel);
+    if (!root) {
+        request_root(token, channel);
+        return std::vector<double>(num_samples, 0.0);
+    }
 
-    if (auto it = m_token_channel_processors.find(token); it != m_token_channel_processors.end()) {
-        return it->second(&root, num_samples);
+    if (domain.channel_processor) {
+        return domain.channel_processor(root, num_samples);
     }
 
-    std::vector<double> samples = root.process_batch(num_samples);
+    std::vector<double> samples = root->process_batch(num_samples);
 
-    uint32_t normalize_coef = root.get_node_size();
+    uint32_t normalize_coef = root->get_node_size();
     for (double& sample : samples) {
         normalize_sample(sample, normalize_coef);
     }
@@ -275,17 +297,63 @@ double NodeGraphManager::process_sample(ProcessingToken token, uint32_t channel)
     if (m_terminate_requested.load())
         return 0.0;
 
-    auto& root = get_root_node(token, channel);
+    auto topology = m_topology.read();
+    const auto& domain = topology->tokens[token_index(token)];
+
+    RootNode* root = domain.root(channel);
+    if (!root) {
+        request_root(token, channel);
+        return 0.0;
+    }
 
-    if (auto it = m_token_sample_processors.find(token); it != m_token_sample_processors.end()) {
-        return it->second(&root, channel);
+    if (domain.sample_processor) {
+        return domain.sample_processor(root, channel);
     }
 
-    double sample = root.process_sample();
-    normalize_sample(sample, root.get_node_size());
+    double sample = root->process_sample();
+    normalize_sample(sample, root->get_node_size());
     return sample;
 }
 
+void NodeGraphManager::process_channel_f32(ProcessingToken token, uint32_t channel, std::span<float> output)
+{
+    if (m_terminate_requested.load()) {
+        std::ranges::fill(output, 0.F);
+        return;
+    }
+
+    auto topology = m_topology.read();
+    const auto& domain = topology->tokens[token_index(token)];
+
+    RootNode* root = domain.root(channel);
+    if (!root) {
+        request_root(token, channel);
+        std::ranges::fill(output, 0.F);
+        return;
+    }
+
+    if (domain.sample_processor || !root->renders_blocks()) {
+        for (float& sample : output) {
+            sample = static_cast<float>(process_sample(token, channel));
+        }
+        return;
+    }
+
+    root->process_batch_f32(output);
+    normalize_block(output, root->get_node_size());
+}
+
+bool NodeGraphManager::can_render_blocks(ProcessingToken token) const
+{
+    auto topology = m_topology.read();
+    const auto& domain = topology->tokens[token_index(token)];
+
+    if (domain.sample_processor)
+        return false;
+
+    return std::ranges::all_of(domain.roots, [](const RootNode* root) { return root->renders_blocks(); });
+}
+
 void NodeGraphManager::normalize_sample(double& sample, uint32_t num_nodes)
 {
     if (num_nodes == 0)
@@ -305,6 +373,26 @@ void NodeGraphManager::normalize_sample(double& sample, uint32_t num_nodes)
     }
 }
 
+void NodeGraphManager::normalize_block(std::span<float> samples, uint32_t num_nodes)
+{
+    if (num_nodes == 0)
+        return;
+
+    const float gain = 1.F / std::sqrt(static_cast<float>(num_nodes));
+    const float threshold = 0.95F;
+    const float knee = 0.1F;
+
+    for (float& sample : samples) {
+        sample *= gain;
+
+        const float abs_sample = std::abs(sample);
+        if (abs_sample > threshold) {
+            const float excess = abs_sample - threshold;
+            sample = std::copysign(threshold + std::tanh(excess / knee) * knee, sample);
+        }
+    }
+}
+
 std::unordered_map<unsigned int, std::vector<double>> NodeGraphManager::process_token_with_channel_data(
     ProcessingToken token, unsigned int num_samples)
 {
@@ -327,16 +415,8 @@ unsigned int NodeGraphManager::get_channel_count(ProcessingToken token) const
 
 std::vector<RootNode*> NodeGraphManager::get_all_root_nodes(ProcessingToken token)
 {
-    std::vector<RootNode*> roots;
-
-    auto it = m_token_roots.find(token);
-    if (it != m_token_roots.end()) {
-        for (auto& [channel, root] : it->second) {
-            roots.push_back(root.get());
-        }
-    }
-
-    return roots;
+    auto topology = m_topology.read();
+    return topology->tokens[token_index(token)].roots;
 }
 
 void NodeGraphManager::process_all_tokens(unsigned int num_samples)
@@ -348,17 +428,78 @@ void NodeGraphManager::process_all_tokens(unsigned int num_samples)
 
 RootNode& NodeGraphManager::get_root_node(ProcessingToken token, unsigned int channel)
 {
-    ensure_root_exists(token, channel);
+    {
+        auto topology = m_topology.read();
+        if (auto* root = topology->tokens[token_index(token)].root(channel)) {
+            return *root;
+        }
+    }
+
+    std::lock_guard lock(m_topology_mutex);
+    if (insert_root_locked(token, channel)) {
+        publish_topology_locked();
+    }
     return *m_token_roots[token][channel];
 }
 
 void NodeGraphManager::ensure_root_exists(ProcessingToken token, unsigned int channel)
 {
-    if (m_token_roots[token].find(channel) == m_token_roots[token].end()) {
-        m_token_roots[token][channel] = std::make_shared<RootNode>(token, channel);
+    std::lock_guard lock(m_topology_mutex);
+    if (insert_root_locked(token, channel)) {
+        publish_topology_locked();
     }
 }
 
+bool NodeGraphManager::insert_root_locked(ProcessingToken token, unsigned int channel)
+{
+    auto& channels = m_token_roots[token];
+    if (channels.contains(channel)) {
+        return false;
+    }
+    channels[channel] = std::make_shared<RootNode>(token, channel, this);
+    return true;
+}
+
+void NodeGraphManager::publish_topology_locked()
+{
+    auto next = std::make_unique<Topology>();
+
+    for (const auto& [token, channels] : m_token_roots) {
+        auto& domain = next->tokens[token_index(token)];
+
+        for (const auto& [channel, root] : channels) {
+            domain.owners.push_back(root);
+        }
+        std::ranges::sort(domain.owners, {}, [](const auto& root) { return root->get_channel(); });
+
+        if (!domain.owners.empty()) {
+            domain.by_channel.assign(domain.owners.back()->get_channel() + 1, nullptr);
+        }
+        for (const auto& root : domain.owners) {
+            domain.by_channel[root->get_channel()] = root.get();
+            domain.roots.push_back(root.get());
+        }
+    }
+
+    for (const auto& [token, networks] : m_audio_networks) {
+        next->tokens[token_index(token)].audio_networks = networks;
+    }
+    for (const auto& [token, networks] : m_token_networks) {
+        next->tokens[token_index(token)].networks = networks;
+    }
+    for (const auto& [token, processor] : m_token_processors) {
+        next->tokens[token_index(token)].processor = processor;
+    }
+    for (const auto& [token, processor] : m_token_channel_processors) {
+        next->tokens[token_index(token)].channel_processor = processor;
+    }
+    for (const auto& [token, processor] : m_token_sample_processors) {
+        next->tokens[token_index(token)].sample_processor = processor;
+    }
+
+    m_topology.publish(std::move(next));
+}
+
 void NodeGraphManager::ensure_token_exists(ProcessingToken token, uint32_t num_channels)
 {
     for (uint32_t ch = 0; ch < num_channels; ++ch) {
@@ -390,10 +531,11 @@ void NodeGraphManager::unset_channel_mask(const std::shared_ptr<Node>& node, uin
 
 std::vector<ProcessingToken> NodeGraphManager::get_active_tokens() const
 {
+    auto topology = m_topology.read();
     std::vector<ProcessingToken> tokens;
-    for (const auto& [token, channels] : m_token_roots) {
-        if (!channels.empty()) {
-            tokens.push_back(token);
+    for (size_t i = 0; i < TOKEN_COUNT; ++i) {
+        if (!topology->tokens[i].roots.empty()) {
+            tokens.push_back(static_cast<ProcessingToken>(i));
         }
     }
     return tokens;
@@ -401,24 +543,20 @@ std::vector<ProcessingToken> NodeGraphManager::get_active_tokens() const
 
 std::vector<unsigned int> NodeGraphManager::get_all_channels(ProcessingToken token) const
 {
+    auto topology = m_topology.read();
     std::vector<unsigned int> channels;
-    auto it = m_token_roots.find(token);
-    if (it != m_token_roots.end()) {
-        for (const auto& [channel, root] : it->second) {
-            channels.push_back(channel);
-        }
+    for (auto* root : topology->tokens[token_index(token)].roots) {
+        channels.push_back(root->get_channel());
     }
     return channels;
 }
 
 size_t NodeGraphManager::get_node_count(ProcessingToken token) const
 {
+    auto topology = m_topology.read();
     size_t count = 0;
-    auto it = m_token_roots.find(token);
-    if (it != m_token_roots.end()) {
-        for (const auto& [channel, root] : it->second) {
-            count += root->get_node_size();
-        }
+    for (auto* root : topology->tokens[token_index(token)].roots) {
+        count += root->get_node_size();
     }
     return count;
 }
@@ -453,18 +591,23 @@ void NodeGraphManager::add_network(const std::shared_ptr<Network::NodeNetwork>&
         }
 
         auto channels = network->get_registered_channels();
+
+        std::lock_guard lock(m_topology_mutex);
         m_audio_networks[token].push_back(network);
 
         for (auto ch : channels) {
-            ensure_root_exists(token, ch);
+            insert_root_locked(token, ch);
             MF_INFO(Journal::Component::Nodes,
                 Journal::Context::NodeProcessing,
                 "Added audio network to token {} channel {}: {} nodes",
                 static_cast<int>(token), ch, network->get_node_count());
         }
+        publish_topology_locked();
 
     } else {
+        std::lock_guard lock(m_topology_mutex);
         m_token_networks[token].push_back(network);
+        publish_topology_locked();
 
         MF_INFO(Journal::Component::Nodes,
             Journal::Context::NodeProcessing,
@@ -482,19 +625,29 @@ void NodeGraphManager::remove_network(const std::shared_ptr<Network::NodeNetwork
         return;
     }
 
-    if (network->get_output_mode() == Network::OutputMode::AUDIO_SINK
-        || network->get_output_mode() == Network::OutputMode::AUDIO_COMPUTE) {
-        auto token_it = m_audio_networks.find(token);
-        if (token_it != m_audio_networks.end()) {
-            auto& networks = token_it->second;
-            std::erase_if(networks, [&](const auto& n) { return n == network; });
-        }
-    } else {
-        auto it = m_token_networks.find(token);
-        if (it != m_token_networks.end()) {
-            auto& networks = it->second;
-            std::erase_if(networks, [&](const auto& n) { return n == network; });
+    if (ProcessingScope::active()) {
+        queue_edit({ .kind = TopologyEdit::Kind::REMOVE_NETWORK, .token = token, .network = network },
+            "network removal");
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_topology_mutex);
+        if (network->get_output_mode() == Network::OutputMode::AUDIO_SINK
+            || network->get_output_mode() == Network::OutputMode::AUDIO_COMPUTE) {
+            auto token_it = m_audio_networks.find(token);
+            if (token_it != m_audio_networks.end()) {
+                auto& networks = token_it->second;
+                std::erase_if(networks, [&](const auto& n) { return n == network; });
+            }
+        } else {
+            auto it = m_token_networks.find(token);
+            if (it != m_token_networks.end()) {
+                auto& networks = it->second;
+                std::erase_if(networks, [&](const auto& n) { return n == network; });
+            }
         }
+        publish_topology_locked();
     }
 
     unregister_network_global(network);
@@ -503,69 +656,48 @@ void NodeGraphManager::remove_network(const std::shared_ptr<Network::NodeNetwork
 std::vector<std::shared_ptr<Network::NodeNetwork>>
 NodeGraphManager::get_networks(ProcessingToken token, uint32_t channel) const
 {
-    if (token == ProcessingToken::AUDIO_RATE) {
-        auto it = m_audio_networks.find(token);
-        if (it == m_audio_networks.end())
-            return {};
+    auto topology = m_topology.read();
+    const auto& domain = topology->tokens[token_index(token)];
 
+    if (token == ProcessingToken::AUDIO_RATE) {
         std::vector<std::shared_ptr<Network::NodeNetwork>> result;
 
-        for (const auto& n : it->second) {
+        for (const auto& n : domain.audio_networks) {
             if (n && n->is_registered_on_channel(channel))
                 result.push_back(n);
         }
         return result;
     }
 
-    auto it = m_token_networks.find(token);
-    if (it == m_token_networks.end())
-        return {};
-    return it->second;
+    return domain.networks;
 }
 
 std::vector<std::shared_ptr<Network::NodeNetwork>>
 NodeGraphManager::get_all_networks(ProcessingToken token) const
 {
-    std::vector<std::shared_ptr<Network::NodeNetwork>> all_networks;
-
-    auto audio_it = m_audio_networks.find(token);
-    if (audio_it != m_audio_networks.end()) {
-        all_networks.insert(all_networks.end(),
-            audio_it->second.begin(),
-            audio_it->second.end());
-    }
-
-    auto token_it = m_token_networks.find(token);
-    if (token_it != m_token_networks.end()) {
-        all_networks.insert(all_networks.end(),
-            token_it->second.begin(),
-            token_it->second.end());
-    }
+    auto topology = m_topology.read();
+    const auto& domain = topology->tokens[token_index(token)];
 
+    std::vector<std::shared_ptr<Network::NodeNetwork>> all_networks;
+    all_networks.reserve(domain.audio_networks.size() + domain.networks.size());
+    all_networks.insert(all_networks.end(), domain.audio_networks.begin(), domain.audio_networks.end());
+    all_networks.insert(all_networks.end(), domain.networks.begin(), domain.networks.end());
     return all_networks;
 }
 
 size_t NodeGraphManager::get_network_count(ProcessingToken token) const
 {
-    size_t count = 0;
-
-    auto audio_it = m_audio_networks.find(token);
-    if (audio_it != m_audio_networks.end()) {
-        count += audio_it->second.size();
-    }
-
-    auto token_it = m_token_networks.find(token);
-    if (token_it != m_token_networks.end()) {
-        count += token_it->second.size();
-    }
-
-    return count;
+    auto topology = m_topology.read();
+    const auto& domain = topology->tokens[token_index(token)];
+    return domain.audio_networks.size() + domain.networks.size();
 }
 
 void NodeGraphManager::clear_networks(ProcessingToken token)
 {
+    std::lock_guard lock(m_topology_mutex);
     m_audio_networks.erase(token);
     m_token_networks.erase(token);
+    publish_topology_locked();
 }
 
 void NodeGraphManager::register_network_global(const std::shared_ptr<Network::NodeNetwork>& network)
@@ -694,11 +826,6 @@ void NodeGraphManager::route_network_to_channels(
     register_network_global(network);
     network->set_enabled(true);
 
-    auto& networks = m_audio_networks[token];
-    if (std::ranges::find(networks, network) == networks.end()) {
-        networks.push_back(network);
-    }
-
     uint32_t current_channels = network->get_channel_mask();
 
     uint32_t target_bitmask = 0;
@@ -708,9 +835,18 @@ void NodeGraphManager::route_network_to_channels(
 
     uint32_t combined_mask = current_channels | target_bitmask;
     network->set_channel_mask(combined_mask);
-    for (auto ch : target_channels) {
-        network->add_channel_usage(ch);
-        ensure_root_exists(token, ch);
+
+    {
+        std::lock_guard lock(m_topology_mutex);
+        auto& networks = m_audio_networks[token];
+        if (std::ranges::find(networks, network) == networks.end()) {
+            networks.push_back(network);
+        }
+        for (auto ch : target_channels) {
+            network->add_channel_usage(ch);
+            insert_root_locked(token, ch);
+        }
+        publish_topology_locked();
     }
 
     uint32_t fade_blocks = (fade_cycles + m_registered_block_size - 1) / m_registered_block_size;
@@ -731,57 +867,132 @@ void NodeGraphManager::route_network_to_channels(
 
 void NodeGraphManager::cleanup_completed_routing(ProcessingToken token)
 {
-    std::vector<std::pair<std::shared_ptr<Node>, uint32_t>> nodes_to_remove;
-
     for (const auto& node : m_node_registry) {
         if (!node->needs_channel_routing())
             continue;
 
         auto& state = node->get_routing_state();
 
-        if (state.phase == RoutingState::COMPLETED) {
-            for (uint32_t ch = 0; ch < 32; ch++) {
-                if ((state.from_channels & (1 << ch)) && !(state.to_channels & (1 << ch))) {
-                    nodes_to_remove.emplace_back(node, ch);
-                }
+        if (state.phase != RoutingState::COMPLETED)
+            continue;
+
+        bool queued = true;
+        for (uint32_t ch = 0; ch < 32 && queued; ch++) {
+            if ((state.from_channels & (1 << ch)) && !(state.to_channels & (1 << ch))) {
+                queued = m_pending_edits.push({ .kind = TopologyEdit::Kind::REMOVE_NODE,
+                    .token = token,
+                    .channel = ch,
+                    .node = node });
             }
+        }
+
+        if (queued) {
             state = RoutingState {};
+        } else {
+            MF_RT_WARN(Journal::Component::Nodes, Journal::Context::NodeProcessing,
+                "Topology edit queue full; retrying routing cleanup next cycle");
         }
     }
 
-    for (auto& [node, channel] : nodes_to_remove) {
-        remove_from_root(node, token, channel);
-    }
+    auto topology = m_topology.read();
+    const auto& domain = topology->tokens[token_index(token)];
 
-    std::vector<std::pair<std::shared_ptr<Network::NodeNetwork>, uint32_t>> networks_to_cleanup;
+    for (const auto* list : { &domain.audio_networks, &domain.networks }) {
+        for (const auto& network : *list) {
+            if (!network || !network->needs_channel_routing())
+                continue;
 
-    for (const auto& network : get_all_networks(token)) {
-        if (!network || !network->needs_channel_routing())
-            continue;
+            auto& state = network->get_routing_state();
 
-        auto& state = network->get_routing_state();
+            if (state.phase != RoutingState::COMPLETED)
+                continue;
 
-        if (state.phase == RoutingState::COMPLETED) {
             network->set_channel_mask(state.to_channels);
 
             for (uint32_t ch = 0; ch < 32; ch++) {
                 if ((state.from_channels & (1 << ch)) && !(state.to_channels & (1 << ch))) {
-                    networks_to_cleanup.emplace_back(network, ch);
+                    network->remove_channel_usage(ch);
                 }
             }
             state = RoutingState {};
+
+            if (network->get_channel_mask() == 0) {
+                queue_edit({ .kind = TopologyEdit::Kind::REMOVE_NETWORK, .token = token, .network = network },
+                    "network removal");
+            }
         }
     }
+}
 
-    for (auto& [network, channel] : networks_to_cleanup) {
-        network->remove_channel_usage(channel);
+bool NodeGraphManager::queue_edit(const TopologyEdit& edit, const char* what)
+{
+    if (m_pending_edits.push(edit))
+        return true;
 
-        if (network->get_channel_mask() == 0) {
-            auto& networks = m_audio_networks[token];
-            std::erase_if(networks, [&](const auto& n) { return n == network; });
-            unregister_network_global(network);
+    MF_RT_WARN(Journal::Component::Nodes, Journal::Context::NodeProcessing,
+        "Topology edit queue full; {} dropped", what);
+    return false;
+}
+
+void NodeGraphManager::request_root(ProcessingToken token, uint32_t channel)
+{
+    const uint32_t bit = channel < 32 ? 1U << channel : 0U;
+    auto& requested = m_root_requests[token_index(token)];
+
+    if (bit && (requested.fetch_or(bit, std::memory_order_acq_rel) & bit))
+        return;
+
+    if (!queue_edit({ .kind = TopologyEdit::Kind::ENSURE_ROOT, .token = token, .channel = channel }, "root creation")
+        && bit) {
+        requested.fetch_and(~bit, std::memory_order_release);
+    }
+}
+
+size_t NodeGraphManager::commit_pending_topology()
+{
+    while (auto edit = m_pending_edits.pop()) {
+        switch (edit->kind) {
+        case TopologyEdit::Kind::ENSURE_ROOT:
+            ensure_root_exists(edit->token, edit->channel);
+            if (edit->channel < 32) {
+                m_root_requests[token_index(edit->token)].fetch_and(~(1U << edit->channel), std::memory_order_release);
+            }
+            break;
+
+        case TopologyEdit::Kind::ADD_NODE:
+            if (edit->node) {
+                add_to_root(edit->node, edit->token, edit->channel);
+            }
+            break;
+
+        case TopologyEdit::Kind::REMOVE_NODE:
+            if (edit->node) {
+                remove_from_root(edit->node, edit->token, edit->channel);
+            }
+            break;
+
+        case TopologyEdit::Kind::REMOVE_NETWORK:
+            remove_network(edit->network, edit->token);
+            break;
+        }
+    }
+
+    std::vector<std::shared_ptr<RootNode>> roots;
+    size_t pending = 0;
+    {
+        std::lock_guard lock(m_topology_mutex);
+        pending = m_topology.reclaim();
+        for (const auto& [token, channels] : m_token_roots) {
+            for (const auto& [channel, root] : channels) {
+                roots.push_back(root);
+            }
         }
     }
+
+    for (const auto& root : roots) {
+        pending += root->reclaim_retired();
+    }
+    return pending;
 }
 
 }
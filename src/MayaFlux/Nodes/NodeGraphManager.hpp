@@ -3,6 +3,9 @@
 #include "NodeSpec.hpp"
 #include "RootNode.hpp"
 
+#include "MayaFlux/Transitive/Memory/RingBuffer.hpp"
+#include "MayaFlux/Transitive/Reflect/EnumReflect.hpp"
+
 namespace MayaFlux::Nodes {
 
 using TokenChannelProcessor = std::function<std::vector<double>(RootNode*, uint32_t)>;
@@ -75,6 +78,8 @@ public:
      * Registers the node with the specified processing domain and channel.
      * The node's output will contribute to that token/channel's output.
      * If the node is not already globally registered, it will be registered automatically.
+     * Inside a ProcessingScope the registration is queued and applied by the
+     * next commit_pending_topology().
      */
     void add_to_root(const std::shared_ptr<Node>& node, ProcessingToken token, unsigned int channel = 0);
 
@@ -86,6 +91,8 @@ public:
      *
      * Removes the specified node from the root node of the given processing domain and channel.
      * If the node is not found in that root, no action is taken.
+     * Inside a ProcessingScope the removal is queued and applied by the next
+     * commit_pending_topology().
      */
     void remove_from_root(const std::shared_ptr<Node>& node, ProcessingToken token, unsigned int channel = 0);
 
@@ -95,7 +102,7 @@ public:
      * @param channel Channel within that domain
      * @return Vector of shared pointers to the nodes for that token and channel root
      */
-    [[nodiscard]] const std::vector<std::shared_ptr<Node>>&
+    [[nodiscard]] std::vector<std::shared_ptr<Node>>
     get_nodes(ProcessingToken token, uint32_t channel = 0) const;
 
     /**
@@ -106,10 +113,11 @@ public:
      * Registers a custom processing function for a given processing domain (token).
      * When process_token() is called for that token, the registered processor will
      * be invoked with a span of all root nodes for that domain, enabling efficient
-     * backend-specific or multi-channel processing.
+     * backend-specific or multi-channel processing. The span views the published
+     * topology snapshot and is ordered by channel.
      */
     void register_token_processor(ProcessingToken token,
-        std::function<void(std::span<RootNode*>)> processor);
+        std::function<void(std::span<RootNode* const>)> processor);
 
     /**
      * @brief Gets all channel root nodes for the AUDIO_RATE domain
@@ -193,6 +201,34 @@ public:
      */
     double process_sample(ProcessingToken token, uint32_t channel);
 
+    /**
+     * @brief Render one normalized block for a specific channel in single precision
+     * @param token Processing domain
+     * @param channel Channel index within that domain
+     * @param output Destination span, one sample per frame
+     *
+     * Block counterpart of process_sample(): the channel's root node renders
+     * the whole block through RootNode::process_batch_f32() and the result is
+     * normalized like process_sample(). A registered per-sample processor, or
+     * a root holding nodes that cannot render blocks on their own, is run
+     * through process_sample() once per frame instead. Check
+     * can_render_blocks() first when nodes are shared between channels: the
+     * per-frame fallback is only exact for the channel in isolation.
+     */
+    void process_channel_f32(ProcessingToken token, uint32_t channel, std::span<float> output);
+
+    /**
+     * @brief Whether a domain can be rendered one block per channel
+     * @param token Processing domain
+     * @return true if no per-sample processor is registered and every root
+     *         reports RootNode::renders_blocks()
+     *
+     * Cheap enough to call once per cycle. When false, render the domain
+     * with process_sample() frame by frame so modulators and their carriers
+     * advance together.
+     */
+    [[nodiscard]] bool can_render_blocks(ProcessingToken token) const;
+
     /**
      * @brief Process all channels for a token and return channel-separated data
      * @param token Processing domain
@@ -218,8 +254,9 @@ public:
      * @param token Processing domain
      * @return Vector of RootNode pointers for that domain
      *
-     * Returns a vector of pointers to all root nodes for the specified processing domain.
-     * Useful for custom processing, introspection, or multi-channel operations.
+     * Returns a vector of pointers to all root nodes for the specified processing domain,
+     * ordered by channel. Useful for custom processing, introspection, or multi-channel
+     * operations.
      */
     std::vector<RootNode*> get_all_root_nodes(ProcessingToken token);
 
@@ -229,7 +266,8 @@ public:
      * @param channel Channel index
      * @return Reference to the root node for the given token and channel
      *
-     * If the root node does not exist, it is created and registered.
+     * If the root node does not exist, it is created and registered. Creation
+     * publishes a new topology, so call this from control code only.
      */
     RootNode& get_root_node(ProcessingToken token, unsigned int channel);
 
@@ -284,7 +322,9 @@ public:
      * @brief Remove a network from a processing token
      * @param network Network to remove
      * @param token Processing domain
-     * @param channel Channel index within that domain, optional
+     *
+     * Inside a ProcessingScope the removal is queued and applied by the next
+     * commit_pending_topology().
      */
     void remove_network(const std::shared_ptr<Network::NodeNetwork>& network, ProcessingToken token);
 
@@ -386,9 +426,24 @@ public:
      * This method should be called after routing states have been updated to remove any nodes
      * or networks that have completed their fade-out transitions and are no longer contributing
      * to the output of their previous channels.
+     *
+     * Runs on the processing thread, so it only records the removals; they
+     * are applied by the next commit_pending_topology().
      */
     void cleanup_completed_routing(ProcessingToken token);
 
+    /**
+     * @brief Applies topology edits requested by processing threads and frees retired snapshots
+     * @return Number of retired snapshots (manager and roots) still waiting for readers
+     *
+     * Must be called from a control thread. Processing threads never publish
+     * topology themselves; routing cleanup, on-demand root creation and any
+     * registration made inside a ProcessingScope are queued and applied here. Retired snapshots keep their nodes, roots and
+     * networks alive until a grace period has passed, so this is called
+     * periodically even when nothing changes.
+     */
+    size_t commit_pending_topology();
+
     /**
      * @brief Sets the node configuration for this manager
      * @param config The NodeConfig to set
@@ -426,7 +481,7 @@ private:
      * backend-specific or multi-channel processing.
      */
     std::unordered_map<ProcessingToken,
-        std::function<void(std::span<RootNode*>)>>
+        std::function<void(std::span<RootNode* const>)>>
         m_token_processors;
 
     /**
@@ -467,12 +522,87 @@ private:
     std::unordered_map<ProcessingToken, std::vector<std::shared_ptr<Network::NodeNetwork>>>
         m_token_networks;
 
+    static constexpr size_t TOKEN_COUNT = Reflect::enum_count<ProcessingToken>();
+
     /**
      * @brief Processing flags for each token's networks
      *
      * Used to prevent re-entrant processing of networks within the same cycle.
      */
-    std::unordered_map<ProcessingToken, std::unique_ptr<std::atomic<bool>>> m_token_network_processing;
+    std::array<std::atomic<bool>, TOKEN_COUNT> m_token_network_processing {};
+
+    /**
+     * @brief Flattened, immutable view of one processing domain
+     *
+     * Built from the maps above whenever they change and read by the
+     * processing paths without hashing, locking or allocation.
+     */
+    struct TokenTopology {
+        std::vector<std::shared_ptr<RootNode>> owners;
+        std::vector<RootNode*> by_channel; ///< Indexed by channel; nullptr where no root exists
+        std::vector<RootNode*> roots; ///< Existing roots in channel order
+        std::vector<std::shared_ptr<Network::NodeNetwork>> audio_networks;
+        std::vector<std::shared_ptr<Network::NodeNetwork>> networks;
+        std::function<void(std::span<RootNode* const>)> processor;
+        TokenChannelProcessor channel_processor;
+        TokenSampleProcessor sample_processor;
+
+        [[nodiscard]] RootNode* root(uint32_t channel) const
+        {
+            return channel < by_channel.size() ? by_channel[channel] : nullptr;
+        }
+    };
+
+    struct Topology {
+        std::array<TokenTopology, TOKEN_COUNT> tokens;
+    };
+
+    /**
+     * @brief Published topology of every processing domain
+     *
+     * Control-side mutations update the maps under m_topology_mutex and then
+     * republish; the audio and graphics threads only ever read this snapshot.
+     */
+    Memory::SnapshotCell<Topology> m_topology;
+
+    /// Serializes mutations of the maps above and topology publication.
+    std::mutex m_topology_mutex;
+
+    /**
+     * @brief Topology change requested from a processing thread
+     *
+     * Queueing copies the shared pointers (a reference-count increment, no
+     * allocation). The queue moves each edit out on pop, so the last
+     * reference is always dropped on the control side.
+     */
+    struct TopologyEdit {
+        enum class Kind : uint8_t {
+            ENSURE_ROOT, ///< Create the root for token/channel
+            ADD_NODE, ///< add_to_root(node, token, channel)
+            REMOVE_NODE, ///< remove_from_root(node, token, channel)
+            REMOVE_NETWORK ///< remove_network(network, token)
+        };
+
+        Kind kind { Kind::ENSURE_ROOT };
+        ProcessingToken token {};
+        uint32_t channel {};
+        std::shared_ptr<Node> node;
+        std::shared_ptr<Network::NodeNetwork> network;
+    };
+
+    static constexpr size_t PENDING_EDIT_CAPACITY = 256;
+
+    /// Edits queued by processing threads, drained by commit_pending_topology().
+    Memory::MPSCQueue<TopologyEdit, PENDING_EDIT_CAPACITY> m_pending_edits;
+
+    /// Per token, one bit per channel below 32 with an ENSURE_ROOT already queued.
+    std::array<std::atomic<uint32_t>, TOKEN_COUNT> m_root_requests {};
+
+    /**
+     * @brief Queues @p edit, warning (realtime-safe) if the queue is full
+     * @return False if the edit was dropped
+     */
+    bool queue_edit(const TopologyEdit& edit, const char* what);
 
     std::atomic<bool> m_terminate_requested { false }; ///< Global termination flag
 
@@ -493,6 +623,28 @@ private:
      */
     void ensure_root_exists(ProcessingToken token, unsigned int channel);
 
+    /**
+     * @brief Queues creation of a missing root from a processing thread
+     * @param token Processing domain
+     * @param channel Channel index
+     *
+     * The root appears once commit_pending_topology() has run; until then
+     * the channel renders silence. Repeated requests for the same channel
+     * queue a single edit.
+     */
+    void request_root(ProcessingToken token, uint32_t channel);
+
+    /**
+     * @brief Creates a root without publishing (m_topology_mutex held)
+     * @return True if a new root was created
+     */
+    bool insert_root_locked(ProcessingToken token, unsigned int channel);
+
+    /**
+     * @brief Rebuilds and publishes the topology snapshot (m_topology_mutex held)
+     */
+    void publish_topology_locked();
+
     /**
      * @brief Ensures that a processing token entry exists
      * @param token Processing domain
@@ -544,6 +696,13 @@ private:
      */
     void normalize_sample(double& sample, uint32_t num_nodes);
 
+    /**
+     * @brief Single-precision block form of normalize_sample()
+     * @param samples Block to normalize in place
+     * @param num_nodes Number of nodes in the processing chain
+     */
+    void normalize_block(std::span<float> samples, uint32_t num_nodes);
+
     /**
      * @brief Check if network is registered globally
      */
@@ -1,46 +1,78 @@
 #include "RootNode.hpp"
 
 #include "MayaFlux/Nodes/Generators/Generator.hpp"
+#include "MayaFlux/Nodes/NodeGraphManager.hpp"
+#include "MayaFlux/Transitive/Profile/Profiler.hpp"
 
 namespace MayaFlux::Nodes {
 
-RootNode::RootNode(ProcessingToken token, uint32_t channel)
-    : m_is_processing(false)
-    , m_pending_count(0)
+namespace {
+    thread_local uint32_t t_processing_depth = 0;
+}
+
+ProcessingScope::ProcessingScope() noexcept
+{
+    ++t_processing_depth;
+}
+
+ProcessingScope::~ProcessingScope()
+{
+    --t_processing_depth;
+}
+
+bool ProcessingScope::active() noexcept
+{
+    return t_processing_depth > 0;
+}
+
+RootNode::RootNode(ProcessingToken token, uint32_t channel, NodeGraphManager* manager)
+    : m_topology(std::make_unique<Topology>())
+    , m_is_processing(false)
     , m_channel(channel)
     , m_skip_state_management(false)
     , m_token(token)
+    , m_manager(manager)
 {
 }
 
+void RootNode::publish_locked(std::vector<std::shared_ptr<Node>> owners)
+{
+    auto next = std::make_unique<Topology>();
+    next->nodes.reserve(owners.size());
+    for (const auto& node : owners) {
+        next->nodes.push_back(node.get());
+    }
+    next->owners = std::move(owners);
+
+    m_node_count.store(static_cast<uint32_t>(next->nodes.size()), std::memory_order_release);
+    m_topology.publish(std::move(next));
+}
+
 void RootNode::register_node(const std::shared_ptr<Node>& node)
 {
     if (!node)
         return;
 
-    for (auto& pending_op : m_pending_ops) {
-        bool expected = false;
-        if (pending_op.active.compare_exchange_strong(
-                expected, true,
-                std::memory_order_acquire,
-                std::memory_order_relaxed)) {
-            pending_op.node = node;
-            pending_op.is_addition = true;
-            atomic_remove_flag(node->m_state, NodeState::ACTIVE);
-            atomic_add_flag(node->m_state, NodeState::INACTIVE);
-            m_pending_count.fetch_add(1, std::memory_order_relaxed);
-            return;
-        }
+    if (m_manager && ProcessingScope::active()) {
+        m_manager->add_to_root(node, m_token, m_channel);
+        return;
     }
 
-    while (m_is_processing.load(std::memory_order_acquire))
-        m_is_processing.wait(true, std::memory_order_acquire);
+    {
+        std::lock_guard lock(m_writer_mutex);
+        const auto& current = m_topology.writer_view()->owners;
+        if (current.end() != std::ranges::find(current, node))
+            return;
 
-    if (m_Nodes.end() == std::ranges::find(m_Nodes, node)) {
-        m_Nodes.push_back(node);
-        atomic_remove_flag(node->m_state, NodeState::INACTIVE);
-        atomic_add_flag(node->m_state, NodeState::ACTIVE);
+        auto owners = current;
+        owners.push_back(node);
+        publish_locked(std::move(owners));
     }
+
+    uint32_t state = node->m_state.load();
+    state &= ~static_cast<uint32_t>(NodeState::INACTIVE);
+    state |= static_cast<uint32_t>(NodeState::ACTIVE);
+    atomic_set_flag_strong(node->m_state, static_cast<NodeState>(state));
 }
 
 void RootNode::unregister_node(const std::shared_ptr<Node>& node)
@@ -48,31 +80,22 @@ void RootNode::unregister_node(const std::shared_ptr<Node>& node)
     if (!node)
         return;
 
-    atomic_add_flag(node->m_state, NodeState::PENDING_REMOVAL);
-
-    for (auto& pending_op : m_pending_ops) {
-        bool expected = false;
-        if (pending_op.active.compare_exchange_strong(
-                expected, true,
-                std::memory_order_acquire,
-                std::memory_order_relaxed)) {
-            pending_op.node = node;
-            pending_op.is_addition = false;
-            m_pending_count.fetch_add(1, std::memory_order_relaxed);
-            return;
-        }
+    if (m_manager && ProcessingScope::active()) {
+        m_manager->remove_from_root(node, m_token, m_channel);
+        return;
     }
 
-    while (m_is_processing.load(std::memory_order_acquire))
-        m_is_processing.wait(true, std::memory_order_acquire);
+    atomic_add_flag(node->m_state, NodeState::PENDING_REMOVAL);
 
-    auto it = m_Nodes.begin();
-    while (it != m_Nodes.end()) {
-        if ((*it).get() == node.get()) {
-            it = m_Nodes.erase(it);
-            break;
+    {
+        std::lock_guard lock(m_writer_mutex);
+        const auto& current = m_topology.writer_view()->owners;
+        auto it = std::ranges::find_if(current, [&](const auto& n) { return n.get() == node.get(); });
+        if (it != current.end()) {
+            auto owners = current;
+            owners.erase(owners.begin() + std::distance(current.begin(), it));
+            publish_locked(std::move(owners));
         }
-        ++it;
     }
 
     node->reset_processed_state();
@@ -84,6 +107,24 @@ void RootNode::unregister_node(const std::shared_ptr<Node>& node)
     atomic_set_flag_strong(node->m_state, static_cast<NodeState>(flag));
 }
 
+void RootNode::clear_all_nodes()
+{
+    std::lock_guard lock(m_writer_mutex);
+    publish_locked({});
+}
+
+std::vector<std::shared_ptr<Node>> RootNode::nodes() const
+{
+    std::lock_guard lock(m_writer_mutex);
+    return m_topology.writer_view()->owners;
+}
+
+size_t RootNode::reclaim_retired()
+{
+    std::lock_guard lock(m_writer_mutex);
+    return m_topology.reclaim();
+}
+
 bool RootNode::preprocess()
 {
     if (m_skip_state_management)
@@ -94,16 +135,8 @@ bool RootNode::preprocess()
         return false;
     }
 
-    if (!m_is_processing.compare_exchange_strong(expected, true,
-            std::memory_order_acquire, std::memory_order_relaxed)) {
-        return false;
-    }
-
-    if (m_pending_count.load(std::memory_order_relaxed) > 0) {
-        process_pending_operations();
-    }
-
-    return true;
+    return m_is_processing.compare_exchange_strong(expected, true,
+        std::memory_order_acquire, std::memory_order_relaxed);
 }
 
 double RootNode::process_sample()
@@ -111,21 +144,27 @@ double RootNode::process_sample()
     if (!preprocess())
         return 0.;
 
+    auto topology = m_topology.read();
     auto sample = 0.;
 
-    for (auto& node : m_Nodes) {
-        if (!node)
-            continue;
+    // Per-node timing is decimated: one sample in every configured stride.
+    const bool profile = Profile::Profiler::sample_due(m_profile_counter);
 
+    for (Node* node : topology->nodes) {
         uint32_t state = node->m_state.load();
         double node_output = 0.0;
 
         if (!(state & NodeState::PROCESSED)) {
-            if (node->should_mock_process()) {
-                node->process_sample();
+            const bool mock = node->should_mock_process();
+            if (profile) {
+                Profile::Zone zone(Profile::Category::NODE, node, typeid(*node));
+                node_output = node->process_sample();
             } else {
                 node_output = node->process_sample();
             }
+            if (mock) {
+                node_output = 0.0;
+            }
             atomic_add_flag(node->m_state, NodeState::PROCESSED);
         } else {
             node_output = node->get_last_output();
@@ -138,7 +177,7 @@ double RootNode::process_sample()
         sample += node_output;
     }
 
-    postprocess();
+    finish_cycle(topology->nodes);
 
     return sample;
 }
@@ -148,7 +187,9 @@ void RootNode::process_frame()
     if (!preprocess())
         return;
 
-    for (auto& node : m_Nodes) {
+    auto topology = m_topology.read();
+
+    for (Node* node : topology->nodes) {
         uint32_t state = node->m_state.load();
         if (!(state & NodeState::PROCESSED)) {
             node->process_sample();
@@ -156,28 +197,25 @@ void RootNode::process_frame()
         }
     }
 
-    postprocess();
+    finish_cycle(topology->nodes);
 }
 
 void RootNode::postprocess()
+{
+    auto topology = m_topology.read();
+    finish_cycle(topology->nodes);
+}
+
+void RootNode::finish_cycle(std::span<Node* const> nodes)
 {
     if (m_skip_state_management)
         return;
 
-    for (auto& node : m_Nodes) {
+    for (Node* node : nodes) {
         node->request_reset_from_channel(m_channel);
     }
 
-    if (m_pending_count.load(std::memory_order_relaxed) > 0) {
-        process_pending_operations();
-    }
-
     m_is_processing.store(false, std::memory_order_release);
-    m_is_processing.notify_all();
-
-    if (m_request_terminate.load(std::memory_order_acquire)) {
-        process_pending_operations();
-    }
 }
 
 std::vector<double> RootNode::process_batch(uint32_t num_samples)
@@ -190,49 +228,63 @@ std::vector<double> RootNode::process_batch(uint32_t num_samples)
     return output;
 }
 
-void RootNode::process_batch_frame(uint32_t num_frames)
+void RootNode::process_batch_f32(std::span<float> output)
 {
-    for (uint32_t i = 0; i < num_frames; i++) {
-        process_frame();
-    }
-}
+    std::ranges::fill(output, 0.F);
 
-void RootNode::process_pending_operations()
-{
-    for (auto& pending_op : m_pending_ops) {
-        if (!pending_op.active.load(std::memory_order_acquire))
-            continue;
+    if (!preprocess())
+        return;
 
-        auto& op = pending_op;
+    auto topology = m_topology.read();
+    const bool profile = Profile::Profiler::sample_due(m_profile_counter);
 
-        if (op.is_addition) {
-            if (m_Nodes.end() == std::ranges::find(m_Nodes, op.node)) {
-                m_Nodes.push_back(op.node);
-                uint32_t state = op.node->m_state.load();
-                state &= ~static_cast<uint32_t>(NodeState::INACTIVE);
-                state |= static_cast<uint32_t>(NodeState::ACTIVE);
-                atomic_set_flag_strong(op.node->m_state, static_cast<NodeState>(state));
-            }
-        } else {
-            auto it = m_Nodes.begin();
-            while (it != m_Nodes.end()) {
-                if ((*it).get() == op.node.get()) {
-                    it = m_Nodes.erase(it);
-                    break;
-                }
-                ++it;
+    for (Node* node : topology->nodes) {
+        auto& block = node->m_block_f32;
+        uint32_t state = node->m_state.load();
+        bool mock = false;
+
+        if (!(state & NodeState::PROCESSED)) {
+            block.resize(output.size());
+            mock = node->should_mock_process();
+            if (profile) {
+                Profile::Zone zone(Profile::Category::NODE, node, typeid(*node));
+                node->process_batch_f32(block);
+            } else {
+                node->process_batch_f32(block);
             }
-            op.node->reset_processed_state();
-            uint32_t state = op.node->m_state.load();
-            state &= ~static_cast<uint32_t>(NodeState::PENDING_REMOVAL);
-            state &= ~static_cast<uint32_t>(NodeState::ACTIVE);
-            state |= static_cast<uint32_t>(NodeState::INACTIVE);
-            atomic_set_flag_strong(op.node->m_state, static_cast<NodeState>(state));
+            atomic_add_flag(node->m_state, NodeState::PROCESSED);
+        } else if (block.size() != output.size()) {
+            block.assign(output.size(), static_cast<float>(node->get_last_output()));
+        }
+
+        float gain = mock ? 0.F : 1.F;
+        if (node->needs_channel_routing()) {
+            gain *= static_cast<float>(node->get_routing_state().amount[m_channel]);
         }
+        if (gain == 0.F)
+            continue;
+
+        for (size_t i = 0; i < output.size(); ++i) {
+            output[i] += gain * block[i];
+        }
+    }
+
+    finish_cycle(topology->nodes);
+}
+
+bool RootNode::renders_blocks() const
+{
+    auto topology = m_topology.read();
+    return std::ranges::all_of(topology->nodes, [](const Node* node) {
+        return node->is_block_independent()
+            && node->m_modulator_count.load(std::memory_order_relaxed) == 0;
+    });
+}
 
-        op.node.reset();
-        op.active.store(false, std::memory_order_release);
-        m_pending_count.fetch_sub(1, std::memory_order_relaxed);
+void RootNode::process_batch_frame(uint32_t num_frames)
+{
+    for (uint32_t i = 0; i < num_frames; i++) {
+        process_frame();
     }
 }
 
@@ -242,11 +294,22 @@ void RootNode::terminate_all_nodes()
 
     m_is_processing.store(false, std::memory_order_release);
 
-    for (auto& node : m_Nodes) {
-        unregister_node(node);
+    std::vector<std::shared_ptr<Node>> owners;
+    {
+        std::lock_guard lock(m_writer_mutex);
+        owners = m_topology.writer_view()->owners;
+        publish_locked({});
     }
 
-    process_pending_operations();
+    for (auto& node : owners) {
+        node->reset_processed_state();
+
+        uint32_t state = node->m_state.load();
+        state &= ~static_cast<uint32_t>(NodeState::PENDING_REMOVAL);
+        state &= ~static_cast<uint32_t>(NodeState::ACTIVE);
+        state |= static_cast<uint32_t>(NodeState::INACTIVE);
+        atomic_set_flag_strong(node->m_state, static_cast<NodeState>(state));
+    }
 }
 
 }
@@ -1,12 +1,37 @@
 #pragma once
 
 #include "MayaFlux/Core/ProcessingTokens.hpp"
-
-#define MAX_PENDING_NODES 2048
+#include "MayaFlux/Transitive/Memory/Snapshot.hpp"
 
 namespace MayaFlux::Nodes {
 
 class Node;
+class NodeGraphManager;
+
+/**
+ * @class ProcessingScope
+ * @brief Marks the calling thread as a realtime processing thread while alive
+ *
+ * Topology changes requested on a marked thread (node registration through
+ * RootNode or NodeGraphManager, network removal) are queued rather than
+ * published, and applied by NodeGraphManager::commit_pending_topology() on
+ * the control side, so the processing thread never allocates a snapshot or
+ * frees a retired one. The audio callback holds one for its whole cycle,
+ * which covers scheduled tasks and node callbacks alike. Scopes nest.
+ */
+class MAYAFLUX_API ProcessingScope {
+public:
+    ProcessingScope() noexcept;
+    ~ProcessingScope();
+
+    ProcessingScope(const ProcessingScope&) = delete;
+    ProcessingScope& operator=(const ProcessingScope&) = delete;
+    ProcessingScope(ProcessingScope&&) = delete;
+    ProcessingScope& operator=(ProcessingScope&&) = delete;
+
+    /** @brief True if the calling thread is inside a ProcessingScope */
+    [[nodiscard]] static bool active() noexcept;
+};
 
 /**
  * @class RootNode
@@ -25,6 +50,15 @@ class Node;
  * processes all nodes that should output to that channel. The RootNode
  * processes all registered nodes and aggregates their outputs based on their
  * assigned processing rates.
+ *
+ * The node list is published as an immutable snapshot (see
+ * Memory::SnapshotCell). Registration on a control thread builds a new list
+ * and swaps it in atomically, so it takes effect immediately and never waits
+ * for a processing cycle to finish; a cycle that is already running keeps
+ * iterating the list it started with. Inside a ProcessingScope (the audio
+ * callback, including scheduled tasks and node callbacks) a root owned by a
+ * NodeGraphManager hands registration to that manager instead, which applies
+ * it at the next commit_pending_topology().
  */
 class MAYAFLUX_API RootNode {
 public:
@@ -32,11 +66,14 @@ public:
      * @brief Constructs a RootNode for a specific processing token and channel
      * @param token The processing domain (e.g., AUDIO_RATE)
      * @param channel The channel index (default: 0)
+     * @param manager Owning manager that queues registrations made inside a
+     *        ProcessingScope; null for a standalone root
      *
      * Initializes the root node for the given processing domain and channel.
      * Each channel and processing domain combination should have its own RootNode.
      */
-    RootNode(ProcessingToken token = ProcessingToken::AUDIO_RATE, uint32_t channel = 0);
+    RootNode(ProcessingToken token = ProcessingToken::AUDIO_RATE, uint32_t channel = 0,
+        NodeGraphManager* manager = nullptr);
 
     /**
      * @brief Adds a node to this root node
@@ -44,7 +81,8 @@ public:
      *
      * Registered nodes will be processed when the root node's process()
      * method is called, and their outputs will be combined together.
-     * If called during processing, the operation is deferred until safe.
+     * Takes effect from the next processing cycle; never blocks on one
+     * in progress.
      */
     void register_node(const std::shared_ptr<Node>& node);
 
@@ -53,16 +91,15 @@ public:
      * @param node The node to unregister
      *
      * After unregistering, the node will no longer contribute to
-     * the root node's output. If called during processing, the operation
-     * is deferred until safe.
+     * the root node's output. A cycle already in progress may still
+     * process it once; the node stays alive until that cycle ends.
      */
     void unregister_node(const std::shared_ptr<Node>& node);
 
-    /** @brief Checks if the root node can process pending operations
-     * @return True if successful
+    /** @brief Begins a processing cycle
+     * @return False if terminating or a cycle is already running on this root
      *
-     * This method can be used to determine if the root node is in the middle
-     * of a processing cycle. If true, queued pending operations will be executed
+     * Acts as a reentrancy guard only; it never waits.
      */
     bool preprocess();
 
@@ -100,11 +137,31 @@ public:
      * This method calls process_batch() on each registered node and
      * aggregates their outputs together. The result is the combined output
      * of all nodes registered with this root node.
-     * If nodes are added or removed during processing, those operations are
-     * deferred until after processing completes.
      */
     std::vector<double> process_batch(uint32_t num_samples);
 
+    /**
+     * @brief Renders one block from all registered nodes in single precision
+     * @param output Destination span, overwritten with the summed block
+     *
+     * Each node renders its whole block through Node::process_batch_f32()
+     * before the next node runs, instead of every node advancing one sample
+     * at a time. A node shared with other channels renders once per cycle and
+     * is read back from Node::m_block_f32 by the others. Routing gain is
+     * applied per block, matching its once-per-cycle update.
+     *
+     * Only equivalent to the per-sample path when renders_blocks() holds for
+     * every root of the domain; NodeGraphManager checks that before calling.
+     */
+    void process_batch_f32(std::span<float> output);
+
+    /**
+     * @brief Whether every registered node can render its block on its own
+     * @return true if all nodes report Node::is_block_independent() and none
+     *         is currently held as a modulator
+     */
+    [[nodiscard]] bool renders_blocks() const;
+
     /**
      * @brief Processes multiple frames from all registered nodes
      * @param num_frames Number of frames to process
@@ -119,7 +176,7 @@ public:
      * @brief Gets the number of nodes registered with this root node
      * @return Number of registered nodes
      */
-    inline unsigned int get_node_size() { return m_Nodes.size(); }
+    inline unsigned int get_node_size() { return m_node_count.load(std::memory_order_acquire); }
 
     /**
      * @brief Removes all nodes from this root node
@@ -127,7 +184,7 @@ public:
      * After calling this method, the root node will have no registered
      * nodes and will output zero values.
      */
-    inline void clear_all_nodes() { m_Nodes.clear(); }
+    void clear_all_nodes();
 
     /**
      * @brief Gets the channel index associated with this root node
@@ -151,27 +208,51 @@ public:
 
     /**
      * @brief Gets the list of nodes registered with this root node
-     * @return Vector of shared pointers to registered nodes
+     * @return Copy of the current node list
+     *
+     * Intended for inspection from control code; processing paths iterate
+     * the published snapshot instead.
      */
-    [[nodiscard]] const std::vector<std::shared_ptr<Node>>& nodes() const { return m_Nodes; }
+    [[nodiscard]] std::vector<std::shared_ptr<Node>> nodes() const;
+
+    /**
+     * @brief Frees retired node lists no processing cycle can still see
+     * @return Number of retired lists still waiting for readers to drain
+     *
+     * Retired lists hold the only remaining references to unregistered
+     * nodes, so the control side calls this periodically rather than
+     * relying on the next registration to release them.
+     */
+    size_t reclaim_retired();
 
 private:
     /**
-     * @brief Collection of nodes registered with this root node
+     * @brief Immutable node list published to the processing thread
      *
-     * All nodes in this collection will be processed when the root
-     * node's process() method is called.
+     * @c owners keeps the nodes alive for as long as any cycle may still
+     * read this snapshot; @c nodes is the dense raw list actually iterated.
      */
-    std::vector<std::shared_ptr<Node>> m_Nodes;
+    struct Topology {
+        std::vector<std::shared_ptr<Node>> owners;
+        std::vector<Node*> nodes;
+    };
+
+    Memory::SnapshotCell<Topology> m_topology;
+
+    /// Serializes writers (register, unregister, clear, terminate).
+    mutable std::mutex m_writer_mutex;
+
+    /// Size of the current snapshot, readable from any thread.
+    std::atomic<uint32_t> m_node_count { 0 };
+
+    /// Decimation counter for per-node profiling zones.
+    uint32_t m_profile_counter {};
 
     /**
      * @brief Flag indicating if the root node is currently processing nodes
      *
-     * This atomic flag prevents concurrent modifications to the node collection
-     * during processing cycles. When set to true, any attempts to register or
-     * unregister nodes will be queued as pending operations rather than being
-     * executed immediately, ensuring thread safety and preventing data corruption
-     * during audio processing.
+     * Guards against the same root being entered twice at once (for example
+     * from a node callback). Writers never consult it.
      */
     std::atomic<bool> m_is_processing;
 
@@ -184,46 +265,14 @@ private:
     std::atomic<bool> m_request_terminate { false };
 
     /**
-     * @brief Structure for storing pending node registration/unregistration operations
-     *
-     * When nodes need to be added or removed while the root node is processing,
-     * these operations are stored in this structure and executed later when it's
-     * safe to modify the node collection. This prevents race conditions and ensures
-     * consistent audio processing without interruptions.
+     * @brief Publishes @p owners as the new node list (writer lock held)
      */
-    struct PendingOp {
-        /**
-         * @brief Flag indicating if this pending operation slot is in use
-         */
-        std::atomic<bool> active;
-
-        /**
-         * @brief The node to be registered or unregistered
-         */
-        std::shared_ptr<Node> node;
-
-        bool is_addition { true };
-    } m_pending_ops[MAX_PENDING_NODES];
+    void publish_locked(std::vector<std::shared_ptr<Node>> owners);
 
     /**
-     * @brief Counter tracking the number of pending operations
-     *
-     * This counter helps efficiently manage the pending operations array,
-     * allowing the system to quickly determine if there are operations
-     * waiting to be processed without scanning the entire array.
+     * @brief Ends a cycle over @p nodes: channel resets and reentrancy release
      */
-    std::atomic<uint32_t> m_pending_count;
-
-    /**
-     * @brief Processes any pending node registration/unregistration operations
-     *
-     * This method is called after the processing cycle completes to handle any
-     * node registration or unregistration requests that came in during processing.
-     * It ensures that node collection modifications happen safely between
-     * processing cycles, maintaining audio continuity while allowing dynamic
-     * changes to the node graph.
-     */
-    void process_pending_operations();
+    void finish_cycle(std::span<Node* const> nodes);
 
     /**
      * @brief The processing channel index for this root node
@@ -251,6 +300,11 @@ private:
      * such as audio rate, visual rate, or custom processing rates.
      */
     ProcessingToken m_token;
+
+    /**
+     * @brief Manager that owns this root, used to defer realtime registrations
+     */
+    NodeGraphManager* m_manager;
 };
 
 }
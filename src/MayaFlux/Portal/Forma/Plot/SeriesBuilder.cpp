@@ -27,6 +27,79 @@ namespace {
         return result;
     }
 
+    /**
+     * @brief Summaries of the series series_for_mapping() returns, index-aligned.
+     */
+    std::vector<const Kakshya::WaveformSummary*> summaries_for_mapping(
+        const Kakshya::PlotContainer& container,
+        const Series::AxisMapping& mapping)
+    {
+        const auto& dims = container.get_structure().dimensions;
+        const auto& data = container.get_processed_data();
+
+        std::vector<const Kakshya::WaveformSummary*> result;
+        for (const auto& role : mapping.roles) {
+            for (size_t i = 0; i < dims.size() && i < data.size(); ++i) {
+                if (dims[i].role != role)
+                    continue;
+                const auto* vec = std::get_if<std::vector<double>>(&data[i]);
+                if (!vec || vec->empty())
+                    continue;
+                result.push_back(container.series_summary(static_cast<uint32_t>(i)));
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Visible part of one series, reduced to min/max column pairs when
+     *        it holds more samples than the requested columns can show.
+     */
+    struct SeriesView {
+        std::span<const double> samples;
+        std::vector<double> envelope;
+        uint64_t first {};
+
+        [[nodiscard]] bool reduced() const { return !envelope.empty(); }
+        [[nodiscard]] std::span<const double> values() const
+        {
+            return reduced() ? std::span<const double>(envelope) : samples;
+        }
+    };
+
+    SeriesView view_series(
+        std::span<const double> data,
+        const Kakshya::WaveformSummary* summary,
+        const std::function<SampleWindow()>& window,
+        uint32_t columns)
+    {
+        const SampleWindow w = window ? window() : SampleWindow {};
+
+        SeriesView view;
+        view.first = std::min<uint64_t>(w.first, data.size());
+        const uint64_t available = data.size() - view.first;
+        const uint64_t count = w.count ? std::min(w.count, available) : available;
+        view.samples = data.subspan(view.first, count);
+
+        if (columns == 0 || count <= uint64_t { 2 } * columns)
+            return view;
+
+        thread_local std::vector<Kakshya::WaveformSummary::Bucket> buckets;
+        buckets.resize(columns);
+        if (summary) {
+            summary->summarize(data, view.first, count, buckets);
+        } else {
+            Kakshya::WaveformSummary::reduce(data, view.first, count, buckets);
+        }
+
+        view.envelope.reserve(buckets.size() * 2);
+        for (const auto& b : buckets) {
+            view.envelope.push_back(b.min);
+            view.envelope.push_back(b.max);
+        }
+        return view;
+    }
+
     /**
      * @brief Flatten all AxisMappings into a single merged AxisRange.
      */
@@ -179,9 +252,11 @@ SeriesSpec WaveformBuilder::done() const
     auto z_mappings = m_state.z_mappings();
     const auto global_palette = m_state.palette();
     const float thickness = m_thickness;
+    const uint32_t columns = m_columns;
+    const auto window = m_window;
 
     return {
-        .fn = [x_mappings, y_mappings, z_mappings, global_palette, thickness](
+        .fn = [x_mappings, y_mappings, z_mappings, global_palette, thickness, columns, window](
                   const std::shared_ptr<Kakshya::PlotContainer>& container,
                   std::vector<uint8_t>& out,
                   Element&) mutable {
@@ -192,6 +267,7 @@ SeriesSpec WaveformBuilder::done() const
 
             struct SeriesEntry {
                 std::span<const double> data;
+                SeriesView view;
                 size_t mapping_index;
                 size_t index_within_mapping;
             };
@@ -199,8 +275,15 @@ SeriesSpec WaveformBuilder::done() const
             std::vector<SeriesEntry> y_entries;
             for (size_t mi = 0; mi < y_mappings.size(); ++mi) {
                 auto series = series_for_mapping(*container, y_mappings[mi]);
-                for (size_t si = 0; si < series.size(); ++si)
-                    y_entries.push_back({ .data = series[si], .mapping_index = mi, .index_within_mapping = si });
+                auto summaries = summaries_for_mapping(*container, y_mappings[mi]);
+                for (size_t si = 0; si < series.size(); ++si) {
+                    y_entries.push_back({
+                        .data = series[si],
+                        .view = view_series(series[si], summaries[si], window, columns),
+                        .mapping_index = mi,
+                        .index_within_mapping = si,
+                    });
+                }
             }
             if (y_entries.empty())
                 return;
@@ -218,14 +301,14 @@ SeriesSpec WaveformBuilder::done() const
                 all_z.insert(all_z.end(), s.begin(), s.end());
             }
 
-            apply_auto_scale(x_range, all_x.empty() ? std::vector<std::span<const double>> { y_entries[0].data } : all_x);
+            apply_auto_scale(x_range, all_x.empty() ? std::vector<std::span<const double>> { y_entries[0].view.values() } : all_x);
             apply_auto_scale(z_range, all_z);
 
             out.clear();
 
             for (size_t ei = 0; ei < y_entries.size(); ++ei) {
                 const auto& entry = y_entries[ei];
-                const auto& ys = entry.data;
+                const auto ys = entry.view.values();
                 const size_t n = ys.size();
                 if (n == 0)
                     continue;
@@ -236,24 +319,34 @@ SeriesSpec WaveformBuilder::done() const
                 auto y_range = y_mappings[entry.mapping_index].range;
                 apply_auto_scale(y_range, { ys });
 
-                const bool has_x = ei < all_x.size() && all_x[ei].size() == n;
-                const bool has_z = ei < all_z.size() && all_z[ei].size() == n;
+                const bool reduced = entry.view.reduced();
+                const bool has_x = !reduced && ei < all_x.size() && all_x[ei].size() == entry.data.size();
+                const bool has_z = !reduced && ei < all_z.size() && all_z[ei].size() == entry.data.size();
+                const auto zs = has_z ? all_z[ei].subspan(entry.view.first, n) : std::span<const double> {};
 
                 const std::vector<float> xs = has_x
                     ? [&] {
                           std::vector<float> v;
                           v.reserve(n);
-                          for (double val : all_x[ei])
+                          for (double val : all_x[ei].subspan(entry.view.first, n))
                               v.push_back(x_range.to_ndc(static_cast<float>(val)));
                           return v;
                       }()
+                    : reduced
+                    ? [&] {
+                          const auto col_x = uniform_x(n / 2, x_range);
+                          std::vector<float> v(n);
+                          for (size_t i = 0; i < n; ++i)
+                              v[i] = col_x[i / 2];
+                          return v;
+                      }()
                     : uniform_x(n, x_range);
 
                 for (size_t i = 0; i < n; ++i) {
                     write_vertex(out,
                         { xs[i],
                             y_range.to_ndc(static_cast<float>(ys[i])),
-                            has_z ? z_range.to_ndc(static_cast<float>(all_z[ei][i])) : 0.F },
+                            has_z ? z_range.to_ndc(static_cast<float>(zs[i])) : 0.F },
                         color,
                         thickness);
                 }
@@ -262,14 +355,14 @@ SeriesSpec WaveformBuilder::done() const
                     const glm::vec3 sep_pos {
                         xs[n - 1],
                         y_range.to_ndc(static_cast<float>(ys[n - 1])),
-                        has_z ? z_range.to_ndc(static_cast<float>(all_z[ei][n - 1])) : 0.F,
+                        has_z ? z_range.to_ndc(static_cast<float>(zs[n - 1])) : 0.F,
                     };
                     write_vertex(out, sep_pos, color, 0.F);
                     write_vertex(out, sep_pos, color, 0.F);
                 }
             } },
         .topology = Graphics::PrimitiveTopology::LINE_STRIP,
-        .capacity_for = [](uint64_t n) { return (n + 2) * k_stride; },
+        .capacity_for = [columns](uint64_t n) { return ((columns ? uint64_t { 2 } * columns : n) + 2) * k_stride; },
         .background_fn = m_state.has_background()
             ? std::optional<GeometryFn<float>> { background(m_state.background_bounds(), m_state.background_color()) }
             : std::nullopt,
@@ -437,9 +530,11 @@ SeriesSpec FilledWaveformBuilder::done() const
     auto y_mappings = m_state.y_mappings();
     const auto global_palette = m_state.palette();
     const float baseline_data = m_baseline;
+    const uint32_t columns = m_columns;
+    const auto window = m_window;
 
     return {
-        .fn = [x_mappings, y_mappings, global_palette, baseline_data](
+        .fn = [x_mappings, y_mappings, global_palette, baseline_data, columns, window](
                   const std::shared_ptr<Kakshya::PlotContainer>& container,
                   std::vector<uint8_t>& out,
                   Element&) mutable {
@@ -450,14 +545,22 @@ SeriesSpec FilledWaveformBuilder::done() const
 
             struct SeriesEntry {
                 std::span<const double> data;
+                SeriesView view;
                 size_t mapping_index;
                 size_t index_within_mapping;
             };
             std::vector<SeriesEntry> y_entries;
             for (size_t mi = 0; mi < y_mappings.size(); ++mi) {
                 auto sv = series_for_mapping(*container, y_mappings[mi]);
-                for (size_t si = 0; si < sv.size(); ++si)
-                    y_entries.push_back({ .data = sv[si], .mapping_index = mi, .index_within_mapping = si });
+                auto summaries = summaries_for_mapping(*container, y_mappings[mi]);
+                for (size_t si = 0; si < sv.size(); ++si) {
+                    y_entries.push_back({
+                        .data = sv[si],
+                        .view = view_series(sv[si], summaries[si], window, columns),
+                        .mapping_index = mi,
+                        .index_within_mapping = si,
+                    });
+                }
             }
             if (y_entries.empty())
                 return;
@@ -468,7 +571,7 @@ SeriesSpec FilledWaveformBuilder::done() const
             std::vector<std::span<const double>> all_y;
             all_y.reserve(y_entries.size());
             for (const auto& e : y_entries)
-                all_y.push_back(e.data);
+                all_y.push_back(e.view.values());
             apply_auto_scale(y_range, all_y);
 
             std::vector<std::span<const double>> all_x;
@@ -485,29 +588,46 @@ SeriesSpec FilledWaveformBuilder::done() const
 
             for (size_t ei = 0; ei < y_entries.size(); ++ei) {
                 const auto& entry = y_entries[ei];
-                const size_t n    = entry.data.size();
+                const auto ys     = entry.view.values();
+                const size_t n    = ys.size();
                 if (n == 0)
                     continue;
 
                 const glm::vec3 color = resolve_color(
                     y_mappings[entry.mapping_index], global_palette, entry.index_within_mapping);
 
-                const size_t x_idx = std::min(ei, all_x.empty() ? size_t(0) : all_x.size() - 1);
-                const bool has_x   = !all_x.empty() && all_x[x_idx].size() == n;
-
                 const size_t pre_size = out.size();
 
-                for (size_t i = 0; i < n; ++i) {
-                    const float px = has_x
-                        ? x_range.to_ndc(static_cast<float>(all_x[x_idx][i]))
-                        : x_range.to_ndc(x_range.min
-                              + static_cast<float>(i) / static_cast<float>(std::max<size_t>(n - 1, 1))
-                                  * (x_range.max - x_range.min));
+                if (entry.view.reduced()) {
+                    const size_t cols = n / 2;
+                    for (size_t c = 0; c < cols; ++c) {
+                        const float px = x_range.to_ndc(x_range.min
+                            + static_cast<float>(c) / static_cast<float>(std::max<size_t>(cols - 1, 1))
+                                * (x_range.max - x_range.min));
 
-                    const float py = y_range.to_ndc(static_cast<float>(entry.data[i]));
+                        const float top    = std::max(static_cast<float>(ys[2 * c + 1]), baseline_data);
+                        const float bottom = std::min(static_cast<float>(ys[2 * c]), baseline_data);
 
-                    write_vertex(out, { px, py,          0.F }, color, 1.F);
-                    write_vertex(out, { px, baseline_ndc, 0.F }, color, 0.F);
+                        write_vertex(out, { px, y_range.to_ndc(top),    0.F }, color, 1.F);
+                        write_vertex(out, { px, y_range.to_ndc(bottom), 0.F }, color, 0.F);
+                    }
+                } else {
+                    const size_t x_idx = std::min(ei, all_x.empty() ? size_t(0) : all_x.size() - 1);
+                    const bool has_x   = !all_x.empty() && all_x[x_idx].size() == entry.data.size();
+                    const auto xs      = has_x ? all_x[x_idx].subspan(entry.view.first, n) : std::span<const double> {};
+
+                    for (size_t i = 0; i < n; ++i) {
+                        const float px = has_x
+                            ? x_range.to_ndc(static_cast<float>(xs[i]))
+                            : x_range.to_ndc(x_range.min
+                                  + static_cast<float>(i) / static_cast<float>(std::max<size_t>(n - 1, 1))
+                                      * (x_range.max - x_range.min));
+
+                        const float py = y_range.to_ndc(static_cast<float>(ys[i]));
+
+                        write_vertex(out, { px, py,          0.F }, color, 1.F);
+                        write_vertex(out, { px, baseline_ndc, 0.F }, color, 0.F);
+                    }
                 }
 
                 if (ei + 1 < y_entries.size() && out.size() > pre_size) {
@@ -516,7 +636,7 @@ SeriesSpec FilledWaveformBuilder::done() const
                 }
             } },
         .topology = Graphics::PrimitiveTopology::TRIANGLE_STRIP,
-        .capacity_for = [](uint64_t n) { return n * 2 * k_stride + 128; },
+        .capacity_for = [columns](uint64_t n) { return (columns ? uint64_t { 2 } * columns : n) * 2 * k_stride + 128; },
         .background_fn = m_state.has_background()
             ? std::optional<GeometryFn<float>> { background(
                   m_state.background_bounds(), m_state.background_color()) }
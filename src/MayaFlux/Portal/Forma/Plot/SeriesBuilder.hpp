@@ -512,6 +512,17 @@ private:
 // Encoding builders
 // =============================================================================
 
+/**
+ * @struct SampleWindow
+ * @brief Visible sample range of a series for waveform encodings.
+ *
+ * Clamped to the series at geometry time. count == 0 extends to the end.
+ */
+struct SampleWindow {
+    uint64_t first {};
+    uint64_t count {};
+};
+
 /**
  * @class WaveformBuilder
  * @brief Terminal builder for LINE_STRIP waveform encoding.
@@ -528,6 +539,11 @@ private:
  * Roles not consumed by this encoding remain in the container and are
  * available to any other GeometryFn produced from the same Series.
  *
+ * For long signals set .columns() to the plot's pixel width: each series is
+ * then drawn as at most that many min/max pairs, read from its
+ * WaveformSummary when one is enabled on the container, so zoom and scroll
+ * via .window() cost O(columns) regardless of series length.
+ *
  * .done() produces a GeometryFn<shared_ptr<PlotContainer>>.
  */
 class MAYAFLUX_API WaveformBuilder {
@@ -544,11 +560,42 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Cap the drawn resolution at @p n columns, typically the pixel width.
+     *
+     * A Y series whose visible window holds more than 2 * n samples is drawn
+     * as n vertical min/max spans, answered from the series' WaveformSummary
+     * (PlotContainer::enable_summary()) in O(n), or by scanning the window
+     * when no summary exists. Explicit X and Z series are ignored for such
+     * series. 0, the default, draws every sample.
+     */
+    WaveformBuilder& columns(uint32_t n)
+    {
+        m_columns = n;
+        return *this;
+    }
+
+    /** @brief Draw a fixed window of every Y series, mapped onto the full X range. */
+    WaveformBuilder& window(SampleWindow w)
+    {
+        m_window = [w] { return w; };
+        return *this;
+    }
+
+    /** @brief Draw a window queried every frame. Drives zoom and scroll. */
+    WaveformBuilder& window(std::function<SampleWindow()> fn)
+    {
+        m_window = std::move(fn);
+        return *this;
+    }
+
     [[nodiscard]] SeriesSpec done() const;
 
 private:
     Series m_state;
     float m_thickness { 1.5F };
+    uint32_t m_columns {};
+    std::function<SampleWindow()> m_window;
 };
 
 /**
@@ -616,9 +663,11 @@ private:
  * the baseline. The strip is continuous within a series; separate series
  * are separated by degenerate vertices.
  *
- * Shares all Y-axis, X-axis, palette, and auto-scale machinery with
- * WaveformBuilder. Use when the filled area under the signal carries
- * meaning: envelope display, energy readout, spectral band fill.
+ * Shares all Y-axis, X-axis, palette, auto-scale, column and window machinery
+ * with WaveformBuilder. Use when the filled area under the signal carries
+ * meaning: envelope display, energy readout, spectral band fill. A series
+ * reduced to columns fills, per column, the span covering its min, max
+ * and the baseline.
  *
  * .done() produces a SeriesSpec with TRIANGLE_STRIP topology.
  */
@@ -641,11 +690,34 @@ public:
         return *this;
     }
 
+    /** @brief Cap the drawn resolution at @p n columns. See WaveformBuilder::columns(). */
+    FilledWaveformBuilder& columns(uint32_t n)
+    {
+        m_columns = n;
+        return *this;
+    }
+
+    /** @brief Draw a fixed window of every Y series. See WaveformBuilder::window(). */
+    FilledWaveformBuilder& window(SampleWindow w)
+    {
+        m_window = [w] { return w; };
+        return *this;
+    }
+
+    /** @brief Draw a window queried every frame. See WaveformBuilder::window(). */
+    FilledWaveformBuilder& window(std::function<SampleWindow()> fn)
+    {
+        m_window = std::move(fn);
+        return *this;
+    }
+
     [[nodiscard]] SeriesSpec done() const;
 
 private:
     Series m_state;
     float m_baseline { 0.F };
+    uint32_t m_columns {};
+    std::function<SampleWindow()> m_window;
 };
 
 inline WaveformBuilder Series::as_waveform() const { return { *this }; }
@@ -8,6 +8,8 @@
 #include "MayaFlux/Core/Backends/Graphics/Vulkan/VulkanBackend.hpp"
 #include "MayaFlux/Journal/Archivist.hpp"
 
+#include <fstream>
+
 namespace MayaFlux::Portal::Graphics {
 
 bool ShaderFoundry::s_initialized = false;
@@ -35,12 +37,26 @@ bool ShaderFoundry::initialize(
     }
 
     m_backend = backend;
+
+    auto cache_dir = config.spirv_cache_directory.empty() ? m_config.spirv_cache_directory : config.spirv_cache_directory;
     m_config = config;
+    m_config.spirv_cache_directory = std::move(cache_dir);
 
     m_config.include_directories.emplace_back(Core::SHADER_SOURCE_DIR);
     m_config.include_directories.emplace_back(std::string(Core::SHADER_SOURCE_DIR) + "/include");
     m_config.include_directories.emplace_back(Core::SHADER_BUILD_OUTPUT_DIR);
 
+    m_spirv_cache = std::make_unique<SpirvCache>(
+        [](const SpirvCompileJob& job) -> std::vector<uint32_t> {
+            if (job.language == SpirvCompileJob::Language::SPIRV_ASM) {
+                return Core::VKShaderModule::assemble_spirv_asm(job.source);
+            }
+            return Core::VKShaderModule::compile_glsl_to_spirv(
+                job.source, to_vulkan_stage(job.stage), job.include_directories, job.defines);
+        },
+        Core::VKShaderModule::compiler_fingerprint(),
+        m_config.spirv_cache_directory);
+
     m_global_descriptor_manager = std::make_shared<Core::VKDescriptorManager>();
     m_global_descriptor_manager->initialize(get_device(), 1024);
 
@@ -146,10 +162,23 @@ std::shared_ptr<Core::VKShaderModule> ShaderFoundry::compile_from_file(
             return nullptr;
         }
     } else {
-        if (!shader->create_from_glsl_file(
-                get_device(), filepath, vk_stage, entry_point,
-                m_config.enable_reflection, m_config.include_directories,
-                m_config.defines)) {
+        auto resolved_stage = stage.has_value() ? stage : detect_stage_from_extension(filepath);
+        if (!resolved_stage.has_value()) {
+            MF_ERROR(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+                "Cannot auto-detect shader stage from file extension: '{}'", filepath);
+            return nullptr;
+        }
+
+        ShaderSource source(filepath, *resolved_stage, ShaderSource::SourceType::GLSL_FILE);
+        auto job = make_compile_job(source);
+        if (!job) {
+            MF_ERROR(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+                "Failed to read GLSL shader: {}", filepath);
+            return nullptr;
+        }
+
+        shader = create_module_from_spirv(m_spirv_cache->get_or_compile(*job), *resolved_stage, entry_point);
+        if (!shader) {
             MF_ERROR(Journal::Component::Portal, Journal::Context::ShaderCompilation,
                 "Failed to compile GLSL shader: {}", filepath);
             return nullptr;
@@ -173,20 +202,16 @@ std::shared_ptr<Core::VKShaderModule> ShaderFoundry::compile_from_source(
         return nullptr;
     }
 
-    auto shader = create_shader_module();
-    auto vk_stage = to_vulkan_stage(stage);
-
-    if (!shader->create_from_glsl(
-            get_device(), source, vk_stage, entry_point,
-            m_config.enable_reflection, m_config.include_directories,
-            m_config.defines)) {
+    auto job = make_compile_job(ShaderSource(source, stage, ShaderSource::SourceType::GLSL_STRING));
+    auto shader = create_module_from_spirv(m_spirv_cache->get_or_compile(*job), stage, entry_point);
+    if (!shader) {
         MF_ERROR(Journal::Component::Portal, Journal::Context::ShaderCompilation,
             "Failed to compile GLSL source");
         return nullptr;
     }
 
     MF_DEBUG(Journal::Component::Portal, Journal::Context::ShaderCompilation,
-        "Compiled shader from source ({})", vk::to_string(vk_stage));
+        "Compiled shader from source ({})", vk::to_string(to_vulkan_stage(stage)));
     return shader;
 }
 
@@ -252,10 +277,15 @@ std::shared_ptr<Core::VKShaderModule> ShaderFoundry::compile_from_spirv_asm(
     ShaderStage stage,
     const std::string& entry_point)
 {
-    auto shader = create_shader_module();
-    if (!shader->create_from_spirv_asm(
-            get_device(), spirv_asm, to_vulkan_stage(stage),
-            entry_point, m_config.enable_reflection)) {
+    if (!is_initialized()) {
+        MF_ERROR(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+            "ShaderFoundry not initialized");
+        return nullptr;
+    }
+
+    auto job = make_compile_job(ShaderSource(spirv_asm, stage, ShaderSource::SourceType::SPIRV_ASM));
+    auto shader = create_module_from_spirv(m_spirv_cache->get_or_compile(*job), stage, entry_point);
+    if (!shader) {
         MF_ERROR(Journal::Component::Portal, Journal::Context::ShaderCompilation,
             "Failed to assemble generated SPIR-V");
         return nullptr;
@@ -285,6 +315,115 @@ std::shared_ptr<Core::VKShaderModule> ShaderFoundry::compile(const ShaderSource&
     }
 }
 
+//==============================================================================
+// Batch Compilation
+//==============================================================================
+
+std::vector<ShaderID> ShaderFoundry::load_shaders(std::span<const ShaderSource> manifest, uint32_t max_workers)
+{
+    std::vector<ShaderID> ids(manifest.size(), INVALID_SHADER);
+
+    if (!is_initialized()) {
+        MF_ERROR(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+            "ShaderFoundry not initialized");
+        return ids;
+    }
+
+    std::vector<size_t> pending;
+    std::vector<SpirvCompileJob> jobs;
+
+    for (size_t i = 0; i < manifest.size(); ++i) {
+        const auto& source = manifest[i];
+
+        auto id_it = m_shader_filepath_cache.find(registry_key(source));
+        if (id_it != m_shader_filepath_cache.end()) {
+            ids[i] = id_it->second;
+            continue;
+        }
+
+        if (source.type == ShaderSource::SourceType::SPIRV_FILE) {
+            ids[i] = load_shader(source.content, source.stage, source.entry_point);
+            continue;
+        }
+
+        auto job = make_compile_job(source);
+        if (!job) {
+            MF_ERROR(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+                "Failed to read shader source: {}", source.content);
+            continue;
+        }
+        pending.push_back(i);
+        jobs.push_back(std::move(*job));
+    }
+
+    auto spirv = m_spirv_cache->compile_batch(jobs, max_workers);
+
+    for (size_t j = 0; j < pending.size(); ++j) {
+        const size_t i = pending[j];
+        const auto& source = manifest[i];
+        const std::string key = registry_key(source);
+
+        if (auto existing = m_shader_filepath_cache.find(key); existing != m_shader_filepath_cache.end()) {
+            ids[i] = existing->second;
+            continue;
+        }
+
+        auto module = create_module_from_spirv(spirv[j], source.stage, source.entry_point);
+        if (!module) {
+            MF_ERROR(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+                "Failed to create shader from manifest entry: {}", jobs[j].name);
+            continue;
+        }
+
+        if (source.type == ShaderSource::SourceType::GLSL_FILE) {
+            m_shader_cache[source.content] = module;
+        }
+
+        const ShaderID id = m_next_shader_id++;
+        auto& state = m_shaders[id];
+        state.module = module;
+        state.filepath = key;
+        state.stage = source.stage;
+        state.entry_point = source.entry_point;
+        m_shader_filepath_cache[key] = id;
+        ids[i] = id;
+    }
+
+    const auto stats = m_spirv_cache->stats();
+    MF_INFO(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+        "Loaded shader manifest: {} entries, {} compiled (SPIR-V cache: {} hits, {} misses)",
+        manifest.size(), jobs.size(), stats.hits, stats.misses);
+
+    return ids;
+}
+
+//==============================================================================
+// Persistent SPIR-V Cache
+//==============================================================================
+
+bool ShaderFoundry::set_spirv_cache_directory(const std::filesystem::path& directory)
+{
+    m_config.spirv_cache_directory = directory;
+    return m_spirv_cache ? m_spirv_cache->set_directory(directory) : true;
+}
+
+SpirvCacheStats ShaderFoundry::get_spirv_cache_stats() const
+{
+    return m_spirv_cache ? m_spirv_cache->stats() : SpirvCacheStats {};
+}
+
+void ShaderFoundry::reset_spirv_cache_stats()
+{
+    if (m_spirv_cache) {
+        m_spirv_cache->reset_stats();
+    }
+}
+
+size_t ShaderFoundry::purge_spirv_cache()
+{
+    return m_spirv_cache ? m_spirv_cache->purge() : 0;
+}
+
 ShaderID ShaderFoundry::load_shader(
     const std::string& content,
     std::optional<ShaderStage> stage,
@@ -651,6 +790,9 @@ std::shared_ptr<Core::VKShaderModule> ShaderFoundry::hot_reload(const std::strin
 
 void ShaderFoundry::set_config(const ShaderCompilerConfig& config)
 {
+    if (m_spirv_cache && config.spirv_cache_directory != m_config.spirv_cache_directory) {
+        m_spirv_cache->set_directory(config.spirv_cache_directory);
+    }
     m_config = config;
     MF_DEBUG(Journal::Component::Portal, Journal::Context::ShaderCompilation,
         "Updated shader compiler configuration");
@@ -1397,6 +1539,67 @@ std::shared_ptr<Core::VKShaderModule> ShaderFoundry::create_shader_module()
     return std::make_shared<Core::VKShaderModule>();
 }
 
+std::optional<SpirvCompileJob> ShaderFoundry::make_compile_job(const ShaderSource& source) const
+{
+    SpirvCompileJob job;
+    job.stage = source.stage;
+    job.include_directories = m_config.include_directories;
+    job.defines = m_config.defines;
+
+    switch (source.type) {
+    case ShaderSource::SourceType::GLSL_STRING:
+        job.source = source.content;
+        job.name = generate_source_cache_key(source.content, source.stage);
+        return job;
+
+    case ShaderSource::SourceType::SPIRV_ASM:
+        job.language = SpirvCompileJob::Language::SPIRV_ASM;
+        job.source = source.content;
+        job.name = generate_source_cache_key(source.content, source.stage);
+        return job;
+
+    case ShaderSource::SourceType::GLSL_FILE: {
+        const auto path = resolve_shader_path(source.content).value_or(source.content);
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            return std::nullopt;
+        }
+        job.source.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        job.name = source.content;
+        return job;
+    }
+
+    default:
+        return std::nullopt;
+    }
+}
+
+std::shared_ptr<Core::VKShaderModule> ShaderFoundry::create_module_from_spirv(
+    const std::vector<uint32_t>& spirv, ShaderStage stage, const std::string& entry_point)
+{
+    if (spirv.empty()) {
+        return nullptr;
+    }
+
+    auto shader = create_shader_module();
+    if (!shader->create_from_spirv(get_device(), spirv, to_vulkan_stage(stage),
+            entry_point, m_config.enable_reflection)) {
+        return nullptr;
+    }
+    return shader;
+}
+
+std::string ShaderFoundry::registry_key(const ShaderSource& source) const
+{
+    switch (source.type) {
+    case ShaderSource::SourceType::GLSL_FILE:
+    case ShaderSource::SourceType::SPIRV_FILE:
+        return source.content;
+    default:
+        return generate_source_cache_key(source.content, source.stage);
+    }
+}
+
 vk::Device ShaderFoundry::get_device() const
 {
     return m_backend->get_context().get_device();
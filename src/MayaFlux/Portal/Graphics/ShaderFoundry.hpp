@@ -3,6 +3,7 @@
 #include "ShaderUtils.hpp"
 
 #include "ShaderSpec.hpp"
+#include "SpirvCache.hpp"
 
 namespace MayaFlux::Core {
 class VulkanBackend;
@@ -242,6 +243,51 @@ public:
      */
     std::shared_ptr<Core::VKShaderModule> compile(const ShaderSource& shader_source);
 
+    //==========================================================================
+    // Batch Compilation
+    //==========================================================================
+
+    /**
+     * @brief Load a manifest of shaders, compiling on worker threads
+     * @param manifest Shader descriptors (any SourceType)
+     * @param max_workers Worker cap; 0 uses hardware concurrency
+     * @return ShaderID per manifest entry, in order; INVALID_SHADER on failure
+     *
+     * GLSL and SPIR-V assembly entries are turned into SPIR-V in parallel
+     * through the SPIR-V cache (disk hits are read on the workers too).
+     * Module creation and registration then happen serially on the calling
+     * thread, since they touch the device. Entries already loaded return
+     * their existing ShaderID.
+     */
+    std::vector<ShaderID> load_shaders(std::span<const ShaderSource> manifest, uint32_t max_workers = 0);
+
+    //==========================================================================
+    // Persistent SPIR-V Cache
+    //==========================================================================
+
+    /**
+     * @brief Set the on-disk SPIR-V cache directory
+     * @param directory Cache location, created if missing; empty disables persistence
+     * @return false if the directory could not be created
+     */
+    bool set_spirv_cache_directory(const std::filesystem::path& directory);
+
+    /**
+     * @brief Hit/miss/write counters of the SPIR-V cache
+     */
+    [[nodiscard]] SpirvCacheStats get_spirv_cache_stats() const;
+
+    /**
+     * @brief Reset SPIR-V cache counters
+     */
+    void reset_spirv_cache_stats();
+
+    /**
+     * @brief Delete every entry in the on-disk SPIR-V cache
+     * @return Number of entries removed
+     */
+    size_t purge_spirv_cache();
+
     //==========================================================================
     // Shader Introspection
     //==========================================================================
@@ -668,6 +714,8 @@ private:
     std::unordered_map<ShaderID, ShaderState> m_shaders;
     std::unordered_map<std::string, ShaderID> m_shader_filepath_cache;
 
+    std::unique_ptr<SpirvCache> m_spirv_cache;
+
     std::shared_ptr<Core::VKDescriptorManager> m_global_descriptor_manager;
     std::unordered_map<DescriptorSetID, DescriptorSetState> m_descriptor_sets;
 
@@ -691,6 +739,23 @@ private:
 
     std::shared_ptr<Core::VKShaderModule> create_shader_module();
 
+    /**
+     * @brief Build a device-free compile job for GLSL or SPIR-V assembly input
+     * @return Job, or nullopt for SPIR-V files and unreadable GLSL files
+     */
+    std::optional<SpirvCompileJob> make_compile_job(const ShaderSource& source) const;
+
+    /**
+     * @brief Create a module from SPIR-V produced by the SPIR-V cache
+     */
+    std::shared_ptr<Core::VKShaderModule> create_module_from_spirv(
+        const std::vector<uint32_t>& spirv, ShaderStage stage, const std::string& entry_point);
+
+    /**
+     * @brief Key under which load_shader() registers @p source
+     */
+    std::string registry_key(const ShaderSource& source) const;
+
     void cleanup_sync_objects();
     void cleanup_descriptor_resources();
     void cleanup_shader_modules();
@@ -91,6 +91,7 @@ struct ShaderCompilerConfig {
     bool enable_validation = true; ///< Validate SPIR-V after compilation
     std::vector<std::string> include_directories; ///< Paths for #include resolution
     std::unordered_map<std::string, std::string> defines; ///< Preprocessor macros
+    std::filesystem::path spirv_cache_directory; ///< Persistent SPIR-V cache location (empty disables)
 
     ShaderCompilerConfig() = default;
 };
@@ -0,0 +1,479 @@
+#include "SpirvCache.hpp"
+
+#include "MayaFlux/Journal/Archivist.hpp"
+#include "MayaFlux/Transitive/Parallel/Execution.hpp"
+
+#include <fstream>
+
+namespace P = MayaFlux::Parallel;
+
+namespace MayaFlux::Portal::Graphics {
+
+namespace {
+
+    constexpr uint32_t k_entry_magic = 0x5653464D; // "MFSV"
+    constexpr uint32_t k_spirv_magic = 0x07230203;
+    constexpr size_t k_max_include_depth = 64;
+
+    /**
+     * @brief Entry header preceding the SPIR-V words on disk.
+     */
+    struct EntryHeader {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t word_count;
+        uint32_t checksum;
+    };
+
+    uint64_t mix64(uint64_t x)
+    {
+        x ^= x >> 30;
+        x *= 0xBF58476D1CE4E5B9ULL;
+        x ^= x >> 27;
+        x *= 0x94D049BB133111EBULL;
+        x ^= x >> 31;
+        return x;
+    }
+
+    /**
+     * @brief Two-lane FNV-1a producing a 128-bit digest.
+     *
+     * Each field is length-prefixed so that adjacent fields cannot alias
+     * ("ab" + "c" vs "a" + "bc").
+     */
+    class KeyHasher {
+    public:
+        void bytes(const void* data, size_t size)
+        {
+            const auto* p = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                m_a = (m_a ^ p[i]) * 0x100000001B3ULL;
+                m_b = (m_b ^ p[i]) * 0x100000001B3ULL;
+                m_b ^= m_b >> 29;
+            }
+        }
+
+        void field(std::string_view s)
+        {
+            const uint64_t n = s.size();
+            bytes(&n, sizeof(n));
+            bytes(s.data(), s.size());
+        }
+
+        void number(uint64_t v) { bytes(&v, sizeof(v)); }
+
+        [[nodiscard]] std::string hex() const
+        {
+            return std::format("{:016x}{:016x}", mix64(m_a), mix64(m_b ^ m_a));
+        }
+
+    private:
+        uint64_t m_a { 0xCBF29CE484222325ULL };
+        uint64_t m_b { 0x84222325CBF29CE4ULL };
+    };
+
+    uint32_t checksum(std::span<const uint32_t> words)
+    {
+        uint32_t h = 0x811C9DC5U;
+        for (uint32_t w : words) {
+            h = (h ^ w) * 0x01000193U;
+        }
+        return h;
+    }
+
+    std::optional<std::string> read_text(const std::filesystem::path& path)
+    {
+        std::ifstream f(path, std::ios::binary);
+        if (!f.is_open()) {
+            return std::nullopt;
+        }
+        return std::string { std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>() };
+    }
+
+    /**
+     * @brief Extract the targets of every #include directive in @p source.
+     */
+    std::vector<std::string> scan_includes(std::string_view source)
+    {
+        std::vector<std::string> out;
+        size_t pos = 0;
+
+        while (pos < source.size()) {
+            size_t eol = source.find('\n', pos);
+            if (eol == std::string_view::npos) {
+                eol = source.size();
+            }
+            std::string_view line = source.substr(pos, eol - pos);
+            pos = eol + 1;
+
+            size_t i = line.find_first_not_of(" \t");
+            if (i == std::string_view::npos || line[i] != '#') {
+                continue;
+            }
+            i = line.find_first_not_of(" \t", i + 1);
+            if (i == std::string_view::npos || line.substr(i, 7) != "include") {
+                continue;
+            }
+            i = line.find_first_not_of(" \t", i + 7);
+            if (i == std::string_view::npos || (line[i] != '"' && line[i] != '<')) {
+                continue;
+            }
+            const char close = line[i] == '"' ? '"' : '>';
+            const size_t end = line.find(close, i + 1);
+            if (end == std::string_view::npos) {
+                continue;
+            }
+            out.emplace_back(line.substr(i + 1, end - i - 1));
+        }
+
+        return out;
+    }
+
+    /**
+     * @brief Hash every file reachable from @p source, resolved the same way
+     *        the shaderc includer resolves them (first matching directory wins).
+     */
+    void hash_include_closure(
+        KeyHasher& hasher,
+        std::string_view source,
+        const std::vector<std::string>& dirs,
+        std::unordered_set<std::string>& visited,
+        size_t depth)
+    {
+        if (depth > k_max_include_depth) {
+            return;
+        }
+
+        for (const auto& name : scan_includes(source)) {
+            hasher.field(name);
+
+            std::optional<std::filesystem::path> resolved;
+            for (const auto& dir : dirs) {
+                auto candidate = std::filesystem::path(dir) / name;
+                std::error_code ec;
+                if (std::filesystem::is_regular_file(candidate, ec)) {
+                    resolved = std::move(candidate);
+                    break;
+                }
+            }
+
+            if (!resolved) {
+                hasher.number(0);
+                continue;
+            }
+
+            const std::string canonical = resolved->lexically_normal().string();
+            if (!visited.insert(canonical).second) {
+                hasher.number(1);
+                continue;
+            }
+
+            auto content = read_text(*resolved);
+            if (!content) {
+                hasher.number(0);
+                continue;
+            }
+
+            hasher.number(2);
+            hasher.field(*content);
+            hash_include_closure(hasher, *content, dirs, visited, depth + 1);
+        }
+    }
+
+    uint64_t elapsed_ns(std::chrono::steady_clock::time_point since)
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - since)
+                .count());
+    }
+
+} // namespace
+
+SpirvCache::SpirvCache(Compiler compiler, std::string fingerprint, std::filesystem::path directory)
+    : m_compiler(std::move(compiler))
+    , m_fingerprint(std::move(fingerprint))
+{
+    if (!directory.empty()) {
+        set_directory(directory);
+    }
+}
+
+bool SpirvCache::set_directory(const std::filesystem::path& directory)
+{
+    m_directory.clear();
+
+    if (directory.empty()) {
+        return true;
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec || !std::filesystem::is_directory(directory, ec)) {
+        MF_WARN(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+            "SPIR-V cache directory '{}' unavailable ({}); cache is transient",
+            directory.string(), ec.message());
+        return false;
+    }
+
+    m_directory = directory;
+    MF_DEBUG(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+        "SPIR-V cache directory: {}", m_directory.string());
+    return true;
+}
+
+std::string SpirvCache::make_key(const SpirvCompileJob& job) const
+{
+    KeyHasher hasher;
+
+    hasher.field(m_fingerprint);
+    hasher.number(FORMAT_VERSION);
+    hasher.number(static_cast<uint64_t>(job.language));
+    hasher.number(static_cast<uint64_t>(job.stage));
+    hasher.field(job.source);
+
+    std::vector<std::pair<std::string_view, std::string_view>> defines;
+    defines.reserve(job.defines.size());
+    for (const auto& [name, value] : job.defines) {
+        defines.emplace_back(name, value);
+    }
+    std::ranges::sort(defines);
+    hasher.number(defines.size());
+    for (const auto& [name, value] : defines) {
+        hasher.field(name);
+        hasher.field(value);
+    }
+
+    if (job.language == SpirvCompileJob::Language::GLSL) {
+        std::unordered_set<std::string> visited;
+        hash_include_closure(hasher, job.source, job.include_directories, visited, 0);
+    }
+
+    return hasher.hex();
+}
+
+std::filesystem::path SpirvCache::entry_path(const std::string& key) const
+{
+    return m_directory / (key + ".spv");
+}
+
+std::optional<std::vector<uint32_t>> SpirvCache::load(const std::string& key)
+{
+    if (!is_persistent()) {
+        return std::nullopt;
+    }
+
+    const auto path = entry_path(key);
+    std::ifstream f(path, std::ios::binary);
+    if (!f.is_open()) {
+        return std::nullopt;
+    }
+
+    std::error_code size_ec;
+    const auto file_size = std::filesystem::file_size(path, size_ec);
+
+    EntryHeader header {};
+    f.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    // Size check before allocating: a damaged word_count must not turn into
+    // a huge resize.
+    const bool header_ok = f
+        && !size_ec
+        && header.magic == k_entry_magic
+        && header.version == FORMAT_VERSION
+        && header.word_count > 0
+        && file_size == sizeof(header) + static_cast<uint64_t>(header.word_count) * sizeof(uint32_t);
+
+    std::vector<uint32_t> words;
+    if (header_ok) {
+        words.resize(header.word_count);
+        f.read(reinterpret_cast<char*>(words.data()),
+            static_cast<std::streamsize>(words.size() * sizeof(uint32_t)));
+    }
+
+    if (!header_ok || !f || words[0] != k_spirv_magic || checksum(words) != header.checksum) {
+        m_corrupt.fetch_add(1, std::memory_order_relaxed);
+        MF_WARN(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+            "Discarding corrupt SPIR-V cache entry: {}", path.string());
+        f.close();
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+        return std::nullopt;
+    }
+
+    return words;
+}
+
+bool SpirvCache::store(const std::string& key, std::span<const uint32_t> words)
+{
+    if (!is_persistent() || words.empty()) {
+        return false;
+    }
+
+    const auto final_path = entry_path(key);
+    const auto tmp_path = m_directory / std::format("{}.{:x}.{}.tmp", key,
+                                            std::hash<std::thread::id> {}(std::this_thread::get_id())
+                                                ^ reinterpret_cast<uintptr_t>(this),
+                                            m_temp_counter.fetch_add(1, std::memory_order_relaxed));
+
+    {
+        std::ofstream f(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!f.is_open()) {
+            MF_WARN(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+                "Cannot write SPIR-V cache entry: {}", tmp_path.string());
+            return false;
+        }
+
+        const EntryHeader header {
+            .magic = k_entry_magic,
+            .version = FORMAT_VERSION,
+            .word_count = static_cast<uint32_t>(words.size()),
+            .checksum = checksum(words),
+        };
+        f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        f.write(reinterpret_cast<const char*>(words.data()),
+            static_cast<std::streamsize>(words.size_bytes()));
+
+        if (!f) {
+            f.close();
+            std::error_code ec;
+            std::filesystem::remove(tmp_path, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, final_path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+
+    m_writes.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+std::vector<uint32_t> SpirvCache::resolve(const SpirvCompileJob& job, const std::string& key)
+{
+    auto t0 = std::chrono::steady_clock::now();
+    if (auto cached = load(key)) {
+        m_load_ns.fetch_add(elapsed_ns(t0), std::memory_order_relaxed);
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        MF_DEBUG(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+            "SPIR-V cache hit: {} ({})", job.name.empty() ? key : job.name, key);
+        return std::move(*cached);
+    }
+
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+
+    t0 = std::chrono::steady_clock::now();
+    auto words = m_compiler ? m_compiler(job) : std::vector<uint32_t> {};
+    m_compile_ns.fetch_add(elapsed_ns(t0), std::memory_order_relaxed);
+
+    if (words.empty()) {
+        m_compile_failures.fetch_add(1, std::memory_order_relaxed);
+        return words;
+    }
+
+    store(key, words);
+    return words;
+}
+
+std::vector<uint32_t> SpirvCache::get_or_compile(const SpirvCompileJob& job)
+{
+    return resolve(job, make_key(job));
+}
+
+std::vector<std::vector<uint32_t>> SpirvCache::compile_batch(
+    std::span<const SpirvCompileJob> jobs, uint32_t max_workers)
+{
+    std::vector<std::vector<uint32_t>> results(jobs.size());
+    if (jobs.empty()) {
+        return results;
+    }
+
+    std::vector<std::string> keys(jobs.size());
+    std::vector<size_t> unique;
+    std::vector<size_t> owner(jobs.size());
+    {
+        std::unordered_map<std::string, size_t> first;
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            keys[i] = make_key(jobs[i]);
+            auto [it, inserted] = first.try_emplace(keys[i], i);
+            owner[i] = it->second;
+            if (inserted) {
+                unique.push_back(i);
+            }
+        }
+    }
+
+    size_t workers = max_workers ? max_workers : std::max(1U, std::thread::hardware_concurrency());
+    workers = std::min(workers, unique.size());
+
+    std::atomic<size_t> next { 0 };
+    P::for_each(P::par,
+        std::views::iota(size_t { 0 }, workers).begin(),
+        std::views::iota(size_t { 0 }, workers).end(),
+        [&](size_t) {
+            for (size_t u = next.fetch_add(1, std::memory_order_relaxed); u < unique.size();
+                u = next.fetch_add(1, std::memory_order_relaxed)) {
+                const size_t i = unique[u];
+                results[i] = resolve(jobs[i], keys[i]);
+            }
+        });
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        if (owner[i] != i) {
+            results[i] = results[owner[i]];
+        }
+    }
+
+    MF_INFO(Journal::Component::Portal, Journal::Context::ShaderCompilation,
+        "Batch compiled {} shaders ({} unique) on {} workers", jobs.size(), unique.size(), workers);
+
+    return results;
+}
+
+size_t SpirvCache::purge()
+{
+    if (!is_persistent()) {
+        return 0;
+    }
+
+    size_t removed = 0;
+    std::error_code ec;
+    for (const auto& entry : std::filesystem::directory_iterator(m_directory, ec)) {
+        const auto ext = entry.path().extension();
+        if (entry.is_regular_file(ec) && (ext == ".spv" || ext == ".tmp")) {
+            if (std::filesystem::remove(entry.path(), ec) && ext == ".spv") {
+                ++removed;
+            }
+        }
+    }
+    return removed;
+}
+
+SpirvCacheStats SpirvCache::stats() const
+{
+    return SpirvCacheStats {
+        .hits = m_hits.load(std::memory_order_relaxed),
+        .misses = m_misses.load(std::memory_order_relaxed),
+        .writes = m_writes.load(std::memory_order_relaxed),
+        .corrupt = m_corrupt.load(std::memory_order_relaxed),
+        .compile_failures = m_compile_failures.load(std::memory_order_relaxed),
+        .compile_ms = static_cast<double>(m_compile_ns.load(std::memory_order_relaxed)) * 1e-6,
+        .load_ms = static_cast<double>(m_load_ns.load(std::memory_order_relaxed)) * 1e-6,
+    };
+}
+
+void SpirvCache::reset_stats()
+{
+    m_hits = 0;
+    m_misses = 0;
+    m_writes = 0;
+    m_corrupt = 0;
+    m_compile_failures = 0;
+    m_compile_ns = 0;
+    m_load_ns = 0;
+}
+
+} // namespace MayaFlux::Portal::Graphics
@@ -0,0 +1,180 @@
+#pragma once
+
+#include "GraphicsUtils.hpp"
+
+/**
+ * @file SpirvCache.hpp
+ * @brief Content-addressed on-disk SPIR-V cache and parallel batch compilation.
+ *
+ * GLSL compilation through shaderc and SPIR-V assembly through SPIRV-Tools are
+ * both pure CPU work whose output depends only on their inputs. SpirvCache
+ * hashes those inputs into a key and stores the resulting SPIR-V words under
+ * that key in a cache directory, so a second process start with unchanged
+ * shaders performs no compilation at all.
+ *
+ * ## Key
+ * The key covers:
+ * - the source text and its language
+ * - the shader stage
+ * - the include closure: every file reachable through #include, resolved
+ *   against the job's include directories in order, hashed by name and content
+ * - the preprocessor defines, sorted by name
+ * - the compiler fingerprint (target environment, SPIR-V version, optimisation
+ *   level and toolchain versions), supplied by the owner of the cache
+ *
+ * Include scanning is conservative: directives inside inactive #if blocks are
+ * still followed, so the key may change when it strictly did not need to, but
+ * never stays the same when an included file changes.
+ *
+ * ## Storage
+ * One file per key, `<hex key>.spv`, carrying a small header with a format
+ * version, word count and checksum. Writes go to a unique temporary file that
+ * is renamed into place, so concurrent processes and the workers of
+ * compile_batch() never observe a partial entry. Entries that fail the header,
+ * checksum or SPIR-V magic check are counted as corrupt and recompiled.
+ *
+ * The cache performs no device work; the actual compiler is injected as a
+ * callback, which keeps this layer testable without a Vulkan device.
+ */
+
+namespace MayaFlux::Portal::Graphics {
+
+/**
+ * @struct SpirvCompileJob
+ * @brief CPU-side description of one shader compilation.
+ */
+struct SpirvCompileJob {
+    enum class Language : uint8_t {
+        GLSL, ///< GLSL source, compiled via shaderc
+        SPIRV_ASM, ///< SPIR-V assembly text, assembled via SPIRV-Tools
+    } language { Language::GLSL };
+
+    std::string source;
+    ShaderStage stage { ShaderStage::COMPUTE };
+    std::vector<std::string> include_directories;
+    std::unordered_map<std::string, std::string> defines;
+
+    /// Diagnostic name (file path or generated key), not part of the cache key.
+    std::string name;
+};
+
+/**
+ * @struct SpirvCacheStats
+ * @brief Counters accumulated by a SpirvCache since construction or reset_stats().
+ */
+struct SpirvCacheStats {
+    uint64_t hits {}; ///< Jobs served from disk
+    uint64_t misses {}; ///< Jobs that had to be compiled
+    uint64_t writes {}; ///< Entries written to disk
+    uint64_t corrupt {}; ///< Entries rejected on load
+    uint64_t compile_failures {}; ///< Compiler returned no words
+    double compile_ms {}; ///< Wall time spent inside the compiler
+    double load_ms {}; ///< Wall time spent reading hits
+
+    [[nodiscard]] double hit_rate() const
+    {
+        const auto total = hits + misses;
+        return total ? static_cast<double>(hits) / static_cast<double>(total) : 0.0;
+    }
+};
+
+/**
+ * @class SpirvCache
+ * @brief Thread-safe content-addressed SPIR-V store with a pluggable compiler.
+ *
+ * With an empty directory the cache is transient: get_or_compile() always
+ * compiles and nothing is persisted, but stats are still counted.
+ */
+class MAYAFLUX_API SpirvCache {
+public:
+    /**
+     * @brief Compiler callback. Returns SPIR-V words, or empty on failure.
+     *
+     * Called concurrently from compile_batch() workers, so it must be
+     * reentrant.
+     */
+    using Compiler = std::function<std::vector<uint32_t>(const SpirvCompileJob&)>;
+
+    /**
+     * @param compiler    Compilation backend for misses.
+     * @param fingerprint Compiler identity folded into every key.
+     * @param directory   Cache directory; empty disables persistence.
+     */
+    SpirvCache(Compiler compiler, std::string fingerprint, std::filesystem::path directory = {});
+
+    /**
+     * @brief Change the cache directory. Creates it if missing.
+     * @return false if the directory could not be created; the cache is then transient.
+     */
+    bool set_directory(const std::filesystem::path& directory);
+
+    [[nodiscard]] const std::filesystem::path& directory() const { return m_directory; }
+    [[nodiscard]] bool is_persistent() const { return !m_directory.empty(); }
+
+    /**
+     * @brief Compute the content key of a job as 32 hex digits.
+     *
+     * Reads every file in the job's include closure.
+     */
+    [[nodiscard]] std::string make_key(const SpirvCompileJob& job) const;
+
+    /**
+     * @brief Return SPIR-V for @p job, from disk when possible.
+     * @return SPIR-V words, or empty if compilation failed.
+     */
+    std::vector<uint32_t> get_or_compile(const SpirvCompileJob& job);
+
+    /**
+     * @brief Compile a manifest of jobs on worker threads.
+     * @param jobs        Jobs to compile.
+     * @param max_workers Worker cap; 0 uses std::thread::hardware_concurrency().
+     * @return SPIR-V per job, in input order. Failed jobs yield an empty vector.
+     *
+     * Jobs with identical keys are compiled once. Hits are read on the
+     * workers as well, so a warm batch is bounded by disk rather than the
+     * compiler.
+     */
+    std::vector<std::vector<uint32_t>> compile_batch(std::span<const SpirvCompileJob> jobs, uint32_t max_workers = 0);
+
+    /**
+     * @brief Read an entry by key.
+     * @return Words, or nullopt if absent or corrupt.
+     */
+    std::optional<std::vector<uint32_t>> load(const std::string& key);
+
+    /**
+     * @brief Write an entry by key, replacing any existing one.
+     */
+    bool store(const std::string& key, std::span<const uint32_t> words);
+
+    /**
+     * @brief Delete every entry in the cache directory.
+     * @return Number of entries removed.
+     */
+    size_t purge();
+
+    [[nodiscard]] SpirvCacheStats stats() const;
+    void reset_stats();
+
+    /// On-disk entry format version; bump when the layout changes.
+    static constexpr uint32_t FORMAT_VERSION = 1;
+
+private:
+    Compiler m_compiler;
+    std::string m_fingerprint;
+    std::filesystem::path m_directory;
+
+    std::atomic<uint64_t> m_hits {};
+    std::atomic<uint64_t> m_misses {};
+    std::atomic<uint64_t> m_writes {};
+    std::atomic<uint64_t> m_corrupt {};
+    std::atomic<uint64_t> m_compile_failures {};
+    std::atomic<uint64_t> m_compile_ns {};
+    std::atomic<uint64_t> m_load_ns {};
+    std::atomic<uint64_t> m_temp_counter {};
+
+    std::vector<uint32_t> resolve(const SpirvCompileJob& job, const std::string& key);
+    [[nodiscard]] std::filesystem::path entry_path(const std::string& key) const;
+};
+
+} // namespace MayaFlux::Portal::Graphics
@@ -430,6 +430,27 @@ void TextureLoom::upload_data(
     m_resource_manager->upload_image_data(image, data, size);
 }
 
+void TextureLoom::upload_regions(
+    const std::shared_ptr<Core::VKImage>& image,
+    const void* data,
+    std::span<const vk::Rect2D> regions)
+{
+    if (!is_initialized() || !image || !data) {
+        MF_ERROR(Journal::Component::Portal, Journal::Context::ImageProcessing,
+            "Invalid parameters for upload_regions");
+        return;
+    }
+
+    const auto format = from_vulkan_format(image->get_format());
+    if (!format) {
+        MF_ERROR(Journal::Component::Portal, Journal::Context::ImageProcessing,
+            "upload_regions: unsupported image format {}", vk::to_string(image->get_format()));
+        return;
+    }
+
+    m_resource_manager->upload_image_regions(image, data, get_bytes_per_pixel(*format), regions);
+}
+
 void TextureLoom::upload_data(
     const std::shared_ptr<Core::VKImage>& image,
     const void* data,
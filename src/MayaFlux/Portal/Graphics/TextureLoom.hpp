@@ -245,6 +245,20 @@ public:
         const void* data,
         size_t size);
 
+    /**
+     * @brief Upload only the given rectangles of a full-image pixel array
+     * @param image   Target image
+     * @param data    Pixels for the whole image, tightly packed
+     * @param regions Rectangles to upload
+     *
+     * Use when a small part of a large texture changed, e.g. newly packed
+     * glyphs in an atlas page. Blocks until upload completes.
+     */
+    void upload_regions(
+        const std::shared_ptr<Core::VKImage>& image,
+        const void* data,
+        std::span<const vk::Rect2D> regions);
+
     /**
      * @brief Upload pixel data reusing a caller-supplied persistent staging buffer.
      *        Identical to upload_data() but skips the per-call VkBuffer allocation,
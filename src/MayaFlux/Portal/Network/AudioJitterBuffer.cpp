@@ -0,0 +1,416 @@
+#include "AudioJitterBuffer.hpp"
+
+namespace MayaFlux::Portal::Network {
+
+namespace {
+
+    constexpr double k_level_smoothing = 0.05;
+    constexpr double k_margin_decay = 0.995;
+    constexpr size_t k_match_frames = 64;
+    constexpr double k_min_period_hz = 50.0;
+    constexpr double k_max_period_hz = 1500.0;
+    constexpr double k_min_correlation = 0.3;
+
+    [[nodiscard]] inline double hermite(float ym1, float y0, float y1, float y2, double t) noexcept
+    {
+        const double c1 = 0.5 * (y1 - ym1);
+        const double c2 = ym1 - 2.5 * y0 + 2.0 * y1 - 0.5 * y2;
+        const double c3 = 0.5 * (y2 - ym1) + 1.5 * (y0 - y1);
+        return ((c3 * t + c2) * t + c1) * t + y0;
+    }
+
+    /// Distinguishes "sequence 0 was played" from an empty history entry.
+    [[nodiscard]] constexpr uint64_t played_tag(uint32_t sequence) noexcept
+    {
+        return (uint64_t { 1 } << 32) | sequence;
+    }
+
+    [[nodiscard]] int64_t now_ns() noexcept
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
+    }
+
+} // namespace
+
+AudioJitterBuffer::AudioJitterBuffer(JitterBufferConfig config)
+    : m_config(std::move(config))
+    , m_window(REORDER_WINDOW)
+    , m_window_valid(REORDER_WINDOW, 0)
+    , m_played(PLAYED_HISTORY, 0)
+    , m_fifo(FIFO_CAPACITY, 0.0F)
+{
+    const double fifo_ms = 1000.0 * static_cast<double>(FIFO_CAPACITY / 4) / m_config.sample_rate;
+    m_config.max_delay_ms = std::clamp(m_config.max_delay_ms, m_config.min_delay_ms, fifo_ms);
+    m_stat_target_ms.store(m_config.min_delay_ms, std::memory_order_relaxed);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Producer
+// ─────────────────────────────────────────────────────────────────────────────
+
+bool AudioJitterBuffer::push(ByteView datagram)
+{
+    return push(datagram, now_ns());
+}
+
+bool AudioJitterBuffer::push(ByteView datagram, int64_t arrival_ns)
+{
+    const auto header = decode_audio_packet_header(datagram);
+    if (!header || header->frames == 0 || header->sample_rate == 0) {
+        return false;
+    }
+
+    if (m_config.stream_id && *m_config.stream_id != header->stream_id) {
+        return false;
+    }
+
+    Slot slot;
+    slot.sequence = header->sequence;
+    slot.sample_rate = header->sample_rate;
+    slot.frames = static_cast<uint16_t>(decode_audio_samples(datagram, *header, slot.samples));
+
+    if (m_has_arrival) {
+        const double arrival_delta = static_cast<double>(arrival_ns - m_last_arrival_ns) * 1e-9;
+        const double media_delta = static_cast<double>(static_cast<int64_t>(header->timestamp - m_last_timestamp))
+            / static_cast<double>(header->sample_rate);
+        m_jitter_s += (std::abs(arrival_delta - media_delta) - m_jitter_s) / 16.0;
+        m_stat_jitter_ms.store(m_jitter_s * 1000.0, std::memory_order_relaxed);
+    }
+
+    if (header->send_time_ns != 0) {
+        const double transit = static_cast<double>(arrival_ns - header->send_time_ns) * 1e-9;
+        m_transit_s = m_has_arrival ? m_transit_s + (transit - m_transit_s) / 16.0 : transit;
+        m_stat_transit_ms.store(m_transit_s * 1000.0, std::memory_order_relaxed);
+    }
+
+    m_has_arrival = true;
+    m_last_arrival_ns = arrival_ns;
+    m_last_timestamp = header->timestamp;
+
+    m_received.fetch_add(1, std::memory_order_relaxed);
+
+    if (!m_queue.push(slot)) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Consumer
+// ─────────────────────────────────────────────────────────────────────────────
+
+void AudioJitterBuffer::pull(std::span<double> out)
+{
+    if (m_reset_requested.exchange(false, std::memory_order_acq_rel)) {
+        resync();
+    }
+
+    drain_queue();
+
+    m_block_frames = out.size();
+    update_target();
+
+    if (!m_playing) {
+        if (!m_synced || level() < m_target_frames) {
+            std::ranges::fill(out, 0.0);
+            m_stat_buffered_ms.store(ms(std::max(level(), 0.0)), std::memory_order_relaxed);
+            return;
+        }
+        m_playing = true;
+        m_read = static_cast<double>(m_write) - m_target_frames;
+        m_level_avg = m_target_frames;
+    }
+
+    const double max_frames = m_config.max_delay_ms * m_config.sample_rate / 1000.0;
+    if (level() > max_frames + static_cast<double>(m_block_frames)) {
+        const double skipped = level() - m_target_frames;
+        m_read = static_cast<double>(m_write) - m_target_frames;
+        m_level_avg = m_target_frames;
+        m_drift_integral = 0.0;
+        if (m_packet_frames > 0) {
+            m_dropped.fetch_add(static_cast<uint64_t>(skipped) / m_packet_frames, std::memory_order_relaxed);
+        }
+    }
+
+    m_level_avg += k_level_smoothing * (level() - m_level_avg);
+
+    const double error_s = (m_level_avg - m_target_frames) / m_config.sample_rate;
+    const double kp = m_config.drift_gain;
+    const double ki = std::max(kp * kp / 4.0, 1e-9);
+    const double limit = m_config.max_drift;
+
+    m_drift_integral = std::clamp(
+        m_drift_integral + error_s * static_cast<double>(m_block_frames) / m_config.sample_rate,
+        -limit / ki, limit / ki);
+    m_ratio = m_base_ratio * (1.0 + std::clamp(kp * error_s + ki * m_drift_integral, -limit, limit));
+
+    bool underrun = false;
+    const size_t refill = m_packet_frames > 0 ? m_packet_frames : 64;
+
+    for (double& sample : out) {
+        const auto base = static_cast<uint64_t>(m_read);
+
+        while (m_write < base + 3) {
+            if (!advance()) {
+                conceal(refill);
+                underrun = true;
+            }
+        }
+
+        sample = hermite(fifo_at(base - 1), fifo_at(base), fifo_at(base + 1), fifo_at(base + 2),
+            m_read - static_cast<double>(base));
+        m_read += m_ratio;
+    }
+
+    if (underrun) {
+        m_underruns.fetch_add(1, std::memory_order_relaxed);
+        m_margin_frames = std::min(m_margin_frames + static_cast<double>(refill), max_frames);
+
+        // Stream has gone quiet: stop and wait for the target again.
+        if (m_silent_frames > static_cast<uint64_t>(max_frames) + m_block_frames) {
+            m_playing = false;
+        }
+    }
+
+    m_stat_buffered_ms.store(ms(level()), std::memory_order_relaxed);
+    m_stat_target_ms.store(ms(m_target_frames), std::memory_order_relaxed);
+    m_stat_ratio.store(m_ratio, std::memory_order_relaxed);
+}
+
+void AudioJitterBuffer::drain_queue()
+{
+    while (auto slot = m_queue.pop()) {
+        accept(*slot);
+    }
+    append_ready();
+}
+
+void AudioJitterBuffer::accept(const Slot& slot)
+{
+    if (!m_synced) {
+        m_synced = true;
+        m_next_sequence = slot.sequence;
+    }
+
+    auto ahead = static_cast<int32_t>(slot.sequence - m_next_sequence);
+
+    // A jump this far either way is a restarted sender or a long outage.
+    if (ahead >= static_cast<int32_t>(REORDER_WINDOW) || ahead < -static_cast<int32_t>(FIFO_CAPACITY)) {
+        std::ranges::fill(m_window_valid, 0);
+        m_window_count = 0;
+        m_next_sequence = slot.sequence;
+        ahead = 0;
+    }
+
+    if (ahead < 0) {
+        const bool played = m_played[slot.sequence % PLAYED_HISTORY] == played_tag(slot.sequence);
+        (played ? m_duplicate : m_late).fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const size_t index = slot.sequence % REORDER_WINDOW;
+    if (m_window_valid[index]) {
+        m_duplicate.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    m_window[index] = slot;
+    m_window_valid[index] = 1;
+    ++m_window_count;
+
+    m_packet_frames = slot.frames;
+    m_base_ratio = static_cast<double>(slot.sample_rate) / m_config.sample_rate;
+}
+
+void AudioJitterBuffer::append_ready()
+{
+    while (m_window_count > 0) {
+        const size_t index = m_next_sequence % REORDER_WINDOW;
+        if (!m_window_valid[index]) {
+            return;
+        }
+
+        append_packet(m_window[index]);
+        m_played[m_next_sequence % PLAYED_HISTORY] = played_tag(m_next_sequence);
+        m_window_valid[index] = 0;
+        --m_window_count;
+        ++m_next_sequence;
+    }
+}
+
+void AudioJitterBuffer::append_packet(const Slot& slot)
+{
+    constexpr size_t mask = FIFO_CAPACITY - 1;
+    size_t i = 0;
+
+    if (m_concealing) {
+        const size_t fade = std::min<size_t>(CROSSFADE_FRAMES, slot.frames);
+        for (; i < fade; ++i) {
+            const float w = static_cast<float>(i + 1) / static_cast<float>(fade + 1);
+            const float concealed = conceal_sample();
+            m_fifo[m_write++ & mask] = slot.samples[i] * w + concealed * (1.0F - w);
+        }
+        m_concealing = false;
+    }
+
+    for (; i < slot.frames; ++i) {
+        m_fifo[m_write++ & mask] = slot.samples[i];
+    }
+
+    m_silent_frames = 0;
+}
+
+bool AudioJitterBuffer::advance()
+{
+    if (m_window_count == 0) {
+        return false;
+    }
+
+    // A later packet is here but the next one is not, and its audio is due now.
+    m_lost.fetch_add(1, std::memory_order_relaxed);
+    conceal(m_packet_frames);
+    ++m_next_sequence;
+    append_ready();
+    return true;
+}
+
+void AudioJitterBuffer::conceal(size_t frames)
+{
+    constexpr size_t mask = FIFO_CAPACITY - 1;
+
+    if (!m_concealing) {
+        m_concealing = true;
+        m_plc_origin = m_write;
+        m_plc_period = find_period(std::min<uint64_t>(m_write, FIFO_CAPACITY / 2));
+        m_plc_position = 0;
+        m_plc_run = 0;
+    }
+
+    for (size_t i = 0; i < frames; ++i) {
+        m_fifo[m_write++ & mask] = conceal_sample();
+    }
+
+    m_concealed.fetch_add(frames, std::memory_order_relaxed);
+}
+
+float AudioJitterBuffer::conceal_sample()
+{
+    const double fade_frames = std::max(1.0, m_config.conceal_fade_ms * m_config.sample_rate / 1000.0);
+    const uint64_t hold = m_packet_frames;
+
+    const uint64_t run = m_plc_run++;
+    const double gain = run < hold
+        ? 1.0
+        : 1.0 - static_cast<double>(run - hold) / fade_frames;
+
+    if (gain <= 0.0 || m_plc_period == 0) {
+        ++m_silent_frames;
+        return 0.0F;
+    }
+
+    const uint64_t index = m_plc_origin - m_plc_period + (m_plc_position++ % m_plc_period);
+    return static_cast<float>(fifo_at(index) * gain);
+}
+
+uint32_t AudioJitterBuffer::find_period(size_t span) const
+{
+    const auto min_period = static_cast<size_t>(m_config.sample_rate / k_max_period_hz);
+    const auto max_period = std::min(
+        static_cast<size_t>(m_config.sample_rate / k_min_period_hz),
+        span > k_match_frames ? span - k_match_frames : 0);
+
+    const auto fallback = static_cast<uint32_t>(std::min<size_t>(span, m_packet_frames));
+    if (max_period <= min_period) {
+        return fallback;
+    }
+
+    const uint64_t end = m_write;
+    double tail_energy = 0.0;
+    for (size_t i = 0; i < k_match_frames; ++i) {
+        const double x = fifo_at(end - k_match_frames + i);
+        tail_energy += x * x;
+    }
+    if (tail_energy < 1e-12) {
+        return fallback;
+    }
+
+    double best = k_min_correlation;
+    size_t best_period = 0;
+
+    for (size_t period = min_period; period <= max_period; ++period) {
+        double cross = 0.0;
+        double energy = 0.0;
+        for (size_t i = 0; i < k_match_frames; ++i) {
+            const double a = fifo_at(end - k_match_frames + i);
+            const double b = fifo_at(end - k_match_frames - period + i);
+            cross += a * b;
+            energy += b * b;
+        }
+        if (energy <= 0.0) {
+            continue;
+        }
+        const double correlation = cross / std::sqrt(tail_energy * energy);
+        if (correlation > best) {
+            best = correlation;
+            best_period = period;
+        }
+    }
+
+    return best_period > 0 ? static_cast<uint32_t>(best_period) : fallback;
+}
+
+void AudioJitterBuffer::update_target()
+{
+    const double sr = m_config.sample_rate;
+    const double jitter_frames = m_stat_jitter_ms.load(std::memory_order_relaxed) * sr / 1000.0;
+
+    m_margin_frames *= k_margin_decay;
+
+    const double wanted = static_cast<double>(m_packet_frames)
+        + static_cast<double>(m_block_frames) * m_base_ratio
+        + m_config.jitter_factor * jitter_frames
+        + m_margin_frames;
+
+    m_target_frames = std::clamp(wanted,
+        m_config.min_delay_ms * sr / 1000.0,
+        m_config.max_delay_ms * sr / 1000.0);
+}
+
+void AudioJitterBuffer::resync()
+{
+    while (m_queue.pop()) { }
+
+    std::ranges::fill(m_window_valid, 0);
+    std::ranges::fill(m_played, 0);
+    m_window_count = 0;
+    m_synced = false;
+    m_playing = false;
+    m_concealing = false;
+    m_margin_frames = 0.0;
+    m_level_avg = 0.0;
+    m_drift_integral = 0.0;
+    m_ratio = m_base_ratio;
+}
+
+AudioStreamStats AudioJitterBuffer::get_stats() const
+{
+    AudioStreamStats stats;
+    stats.packets_received = m_received.load(std::memory_order_relaxed);
+    stats.packets_lost = m_lost.load(std::memory_order_relaxed);
+    stats.packets_late = m_late.load(std::memory_order_relaxed);
+    stats.packets_duplicate = m_duplicate.load(std::memory_order_relaxed);
+    stats.packets_dropped = m_dropped.load(std::memory_order_relaxed);
+    stats.frames_concealed = m_concealed.load(std::memory_order_relaxed);
+    stats.underruns = m_underruns.load(std::memory_order_relaxed);
+    stats.jitter_ms = m_stat_jitter_ms.load(std::memory_order_relaxed);
+    stats.transit_ms = m_stat_transit_ms.load(std::memory_order_relaxed);
+    stats.buffered_ms = m_stat_buffered_ms.load(std::memory_order_relaxed);
+    stats.target_ms = m_stat_target_ms.load(std::memory_order_relaxed);
+    stats.drift_ratio = m_stat_ratio.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace MayaFlux::Portal::Network
@@ -0,0 +1,223 @@
+#pragma once
+
+#include "AudioPacket.hpp"
+
+#include "MayaFlux/Transitive/Memory/RingBuffer.hpp"
+
+namespace MayaFlux::Portal::Network {
+
+/**
+ * @struct JitterBufferConfig
+ * @brief Playout policy for an AudioJitterBuffer.
+ */
+struct MAYAFLUX_API JitterBufferConfig {
+    double sample_rate { 48000.0 }; ///< Local playout rate
+
+    double min_delay_ms { 1.0 }; ///< Floor for the adaptive target
+    double max_delay_ms { 40.0 }; ///< Beyond this, buffered audio is skipped
+    double jitter_factor { 3.0 }; ///< Target covers this many jitter estimates
+
+    double max_drift { 0.005 }; ///< Largest playout speed correction (0.5%)
+    double drift_gain { 2.0 }; ///< Proportional speed correction per second of level error
+
+    double conceal_fade_ms { 20.0 }; ///< Concealment fades to silence over this
+
+    std::optional<uint32_t> stream_id; ///< Accept only this stream; any if unset
+};
+
+/**
+ * @struct AudioStreamStats
+ * @brief Snapshot of receive and playout counters.
+ */
+struct AudioStreamStats {
+    uint64_t packets_received {};
+    uint64_t packets_lost {}; ///< Never arrived in time; concealed
+    uint64_t packets_late {}; ///< Arrived after their slot had been concealed
+    uint64_t packets_duplicate {}; ///< Already buffered or played
+    uint64_t packets_dropped {}; ///< Receive queue full, or skipped on overflow
+
+    uint64_t frames_concealed {};
+    uint64_t underruns {};
+
+    double jitter_ms {}; ///< RFC 3550 interarrival jitter
+    double transit_ms {}; ///< Mean send-to-arrival time; needs synchronised clocks
+    double buffered_ms {}; ///< Audio waiting for playout at the last pull
+    double target_ms {}; ///< Current adaptive playout delay
+    double drift_ratio { 1.0 }; ///< Input frames consumed per output frame
+};
+
+/**
+ * @class AudioJitterBuffer
+ * @brief Adaptive playout buffer for one mono stream of audio packets.
+ *
+ * Bridges a network receive thread and the audio thread:
+ *
+ *   push() [network thread]  decode -> lock-free queue
+ *   pull() [audio thread]    queue -> reorder window -> playout FIFO -> resampler
+ *
+ * The audio side never blocks and never allocates. Packets are put back in
+ * order through a small reorder window and appended to the playout FIFO as
+ * soon as they are contiguous. A packet that is still missing when its audio
+ * is needed is declared lost and concealed; if it turns up later it is
+ * counted as late and discarded.
+ *
+ * **Adaptive delay.** The playout target is one packet plus one pull block
+ * plus jitter_factor times the RFC 3550 jitter estimate, clamped to
+ * [min_delay_ms, max_delay_ms]. Each underrun adds a packet of margin that
+ * decays again while playout is clean.
+ *
+ * **Drift.** The FIFO level is smoothed and a critically damped PI controller
+ * (integral gain drift_gain^2 / 4) nudges the playout speed by at most
+ * max_drift, read out through a cubic Hermite interpolator. This absorbs
+ * clock drift between machines and any nominal sample rate difference
+ * without audible pitch change.
+ *
+ * **Concealment.** When audio is missing, the last received waveform is
+ * extended by repeating its best-matching pitch period, then faded to
+ * silence over conceal_fade_ms. The first real audio after a gap is
+ * crossfaded in.
+ *
+ * Large (about 130 KB); create on the heap.
+ */
+class MAYAFLUX_API AudioJitterBuffer {
+public:
+    explicit AudioJitterBuffer(JitterBufferConfig config = {});
+
+    AudioJitterBuffer(const AudioJitterBuffer&) = delete;
+    AudioJitterBuffer& operator=(const AudioJitterBuffer&) = delete;
+    AudioJitterBuffer(AudioJitterBuffer&&) = delete;
+    AudioJitterBuffer& operator=(AudioJitterBuffer&&) = delete;
+
+    /**
+     * @brief Accept one datagram. Call from a single producer thread.
+     * @param datagram    Raw bytes as received.
+     * @param arrival_ns  Arrival time on the system clock, in nanoseconds.
+     * @return false if the datagram is not an audio packet for this stream
+     *         or the receive queue is full.
+     */
+    bool push(ByteView datagram, int64_t arrival_ns);
+
+    /// @brief push() stamped with the current system clock.
+    bool push(ByteView datagram);
+
+    /**
+     * @brief Fill @p out with the next block of playout audio.
+     *
+     * Call from a single consumer thread. Produces silence until enough
+     * audio has been buffered to reach the target delay.
+     */
+    void pull(std::span<double> out);
+
+    /**
+     * @brief Drop buffered audio and wait for the target again.
+     *
+     * Safe from any thread; takes effect at the next pull().
+     */
+    void reset() { m_reset_requested.store(true, std::memory_order_release); }
+
+    [[nodiscard]] AudioStreamStats get_stats() const;
+
+    [[nodiscard]] const JitterBufferConfig& config() const noexcept { return m_config; }
+
+private:
+    struct Slot {
+        uint32_t sequence {};
+        uint32_t sample_rate {};
+        uint16_t frames {};
+        std::array<float, MAX_AUDIO_PACKET_FRAMES> samples {};
+    };
+
+    static constexpr size_t QUEUE_CAPACITY = 64;
+    static constexpr size_t REORDER_WINDOW = 32;
+    static constexpr size_t PLAYED_HISTORY = 256;
+    static constexpr size_t FIFO_CAPACITY = 1 << 15;
+    static constexpr size_t CROSSFADE_FRAMES = 32;
+
+    JitterBufferConfig m_config;
+
+    // ─── Producer side ──────────────────────────────────────────────────────
+
+    Memory::LockFreeQueue<Slot, QUEUE_CAPACITY> m_queue;
+
+    bool m_has_arrival {};
+    int64_t m_last_arrival_ns {};
+    uint64_t m_last_timestamp {};
+    double m_jitter_s {};
+    double m_transit_s {};
+
+    // ─── Consumer side ──────────────────────────────────────────────────────
+
+    std::vector<Slot> m_window;
+    std::vector<uint8_t> m_window_valid;
+    size_t m_window_count {};
+    std::vector<uint64_t> m_played; ///< Tagged sequences of recently played packets
+
+    bool m_synced {};
+    uint32_t m_next_sequence {};
+    uint32_t m_packet_frames {};
+    double m_base_ratio { 1.0 };
+
+    std::vector<float> m_fifo;
+    uint64_t m_write {};
+    double m_read {};
+    bool m_playing {};
+    size_t m_block_frames {};
+
+    double m_level_avg {};
+    double m_margin_frames {};
+    double m_target_frames {};
+    double m_ratio { 1.0 };
+    double m_drift_integral {};
+
+    bool m_concealing {};
+    uint64_t m_plc_origin {};
+    uint32_t m_plc_period {};
+    uint64_t m_plc_position {};
+    uint64_t m_plc_run {};
+    uint64_t m_silent_frames {};
+
+    std::atomic<bool> m_reset_requested { false };
+
+    // ─── Shared statistics ──────────────────────────────────────────────────
+
+    std::atomic<uint64_t> m_received {};
+    std::atomic<uint64_t> m_lost {};
+    std::atomic<uint64_t> m_late {};
+    std::atomic<uint64_t> m_duplicate {};
+    std::atomic<uint64_t> m_dropped {};
+    std::atomic<uint64_t> m_concealed {};
+    std::atomic<uint64_t> m_underruns {};
+    std::atomic<double> m_stat_jitter_ms {};
+    std::atomic<double> m_stat_transit_ms {};
+    std::atomic<double> m_stat_buffered_ms {};
+    std::atomic<double> m_stat_target_ms {};
+    std::atomic<double> m_stat_ratio { 1.0 };
+
+    void drain_queue();
+    void accept(const Slot& slot);
+    void append_ready();
+    void append_packet(const Slot& slot);
+    bool advance();
+    void conceal(size_t frames);
+    [[nodiscard]] float conceal_sample();
+    [[nodiscard]] uint32_t find_period(size_t span) const;
+    void update_target();
+    void resync();
+
+    [[nodiscard]] float fifo_at(uint64_t index) const noexcept
+    {
+        return m_fifo[index & (FIFO_CAPACITY - 1)];
+    }
+
+    [[nodiscard]] double level() const noexcept
+    {
+        return static_cast<double>(m_write) - m_read;
+    }
+
+    [[nodiscard]] double ms(double frames) const noexcept
+    {
+        return frames * 1000.0 / m_config.sample_rate;
+    }
+};
+
+} // namespace MayaFlux::Portal::Network
@@ -0,0 +1,159 @@
+#include "AudioPacket.hpp"
+
+namespace MayaFlux::Portal::Network {
+
+namespace {
+
+    template <typename T>
+    void write_le(uint8_t* dst, T value) noexcept
+    {
+        using U = std::make_unsigned_t<T>;
+        auto bits = static_cast<U>(value);
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            dst[i] = static_cast<uint8_t>(bits >> (8 * i));
+        }
+    }
+
+    template <typename T>
+    [[nodiscard]] T read_le(const uint8_t* src) noexcept
+    {
+        using U = std::make_unsigned_t<T>;
+        U bits {};
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            bits |= static_cast<U>(static_cast<U>(src[i]) << (8 * i));
+        }
+        return static_cast<T>(bits);
+    }
+
+    [[nodiscard]] int32_t quantise(double sample, double scale, int32_t max) noexcept
+    {
+        const double clipped = std::clamp(sample, -1.0, 1.0);
+        return static_cast<int32_t>(std::clamp<long>(std::lround(clipped * scale), -max - 1, max));
+    }
+
+} // namespace
+
+size_t encode_audio_packet(
+    const AudioPacketHeader& header,
+    std::span<const double> samples,
+    std::span<uint8_t> out) noexcept
+{
+    if (samples.size() > MAX_AUDIO_PACKET_FRAMES) {
+        return 0;
+    }
+
+    const size_t size = audio_packet_size(header.format, samples.size());
+    if (out.size() < size) {
+        return 0;
+    }
+
+    uint8_t* p = out.data();
+    write_le<uint32_t>(p, AUDIO_PACKET_MAGIC);
+    p[4] = AUDIO_PACKET_VERSION;
+    p[5] = static_cast<uint8_t>(header.format);
+    write_le<uint16_t>(p + 6, static_cast<uint16_t>(samples.size()));
+    write_le<uint32_t>(p + 8, header.stream_id);
+    write_le<uint32_t>(p + 12, header.sequence);
+    write_le<uint32_t>(p + 16, header.sample_rate);
+    write_le<uint64_t>(p + 20, header.timestamp);
+    write_le<int64_t>(p + 28, header.send_time_ns);
+    p += AUDIO_PACKET_HEADER_SIZE;
+
+    switch (header.format) {
+    case AudioSampleFormat::PCM16:
+        for (double s : samples) {
+            write_le<int16_t>(p, static_cast<int16_t>(quantise(s, 32767.0, 32767)));
+            p += 2;
+        }
+        break;
+    case AudioSampleFormat::PCM24:
+        for (double s : samples) {
+            const auto v = static_cast<uint32_t>(quantise(s, 8388607.0, 8388607));
+            p[0] = static_cast<uint8_t>(v);
+            p[1] = static_cast<uint8_t>(v >> 8);
+            p[2] = static_cast<uint8_t>(v >> 16);
+            p += 3;
+        }
+        break;
+    case AudioSampleFormat::FLOAT32:
+        for (double s : samples) {
+            write_le<uint32_t>(p, std::bit_cast<uint32_t>(static_cast<float>(s)));
+            p += 4;
+        }
+        break;
+    }
+
+    return size;
+}
+
+std::optional<AudioPacketHeader> decode_audio_packet_header(ByteView datagram) noexcept
+{
+    if (datagram.size() < AUDIO_PACKET_HEADER_SIZE) {
+        return std::nullopt;
+    }
+
+    const uint8_t* p = datagram.data();
+    if (read_le<uint32_t>(p) != AUDIO_PACKET_MAGIC || p[4] != AUDIO_PACKET_VERSION) {
+        return std::nullopt;
+    }
+
+    if (p[5] > static_cast<uint8_t>(AudioSampleFormat::FLOAT32)) {
+        return std::nullopt;
+    }
+
+    AudioPacketHeader header;
+    header.format = static_cast<AudioSampleFormat>(p[5]);
+    header.frames = read_le<uint16_t>(p + 6);
+    header.stream_id = read_le<uint32_t>(p + 8);
+    header.sequence = read_le<uint32_t>(p + 12);
+    header.sample_rate = read_le<uint32_t>(p + 16);
+    header.timestamp = read_le<uint64_t>(p + 20);
+    header.send_time_ns = read_le<int64_t>(p + 28);
+
+    if (header.frames > MAX_AUDIO_PACKET_FRAMES
+        || datagram.size() < audio_packet_size(header.format, header.frames)) {
+        return std::nullopt;
+    }
+
+    return header;
+}
+
+size_t decode_audio_samples(
+    ByteView datagram,
+    const AudioPacketHeader& header,
+    std::span<float> out) noexcept
+{
+    const size_t frames = std::min<size_t>(header.frames, out.size());
+    if (datagram.size() < audio_packet_size(header.format, frames)) {
+        return 0;
+    }
+
+    const uint8_t* p = datagram.data() + AUDIO_PACKET_HEADER_SIZE;
+
+    switch (header.format) {
+    case AudioSampleFormat::PCM16:
+        for (size_t i = 0; i < frames; ++i, p += 2) {
+            out[i] = static_cast<float>(read_le<int16_t>(p)) * (1.0F / 32767.0F);
+        }
+        break;
+    case AudioSampleFormat::PCM24:
+        for (size_t i = 0; i < frames; ++i, p += 3) {
+            // Place the 24 bits at the top of an int32 so the shift sign-extends.
+            const auto raw = static_cast<int32_t>(
+                (static_cast<uint32_t>(p[0]) << 8)
+                | (static_cast<uint32_t>(p[1]) << 16)
+                | (static_cast<uint32_t>(p[2]) << 24));
+            out[i] = static_cast<float>(raw >> 8) * (1.0F / 8388607.0F);
+        }
+        break;
+    case AudioSampleFormat::FLOAT32:
+        for (size_t i = 0; i < frames; ++i, p += 4) {
+            out[i] = std::bit_cast<float>(read_le<uint32_t>(p));
+        }
+        break;
+    }
+
+    return frames;
+}
+
+} // namespace MayaFlux::Portal::Network
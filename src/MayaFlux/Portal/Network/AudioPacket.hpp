@@ -0,0 +1,113 @@
+#pragma once
+
+#include "NetworkUtils.hpp"
+
+namespace MayaFlux::Portal::Network {
+
+//=============================================================================
+// Audio packet wire format
+//=============================================================================
+
+/**
+ * @enum AudioSampleFormat
+ * @brief PCM encoding of the samples carried by an audio packet.
+ */
+enum class AudioSampleFormat : uint8_t {
+    PCM16, ///< Signed 16-bit, clipped to [-1, 1]
+    PCM24, ///< Signed 24-bit packed in 3 bytes, clipped to [-1, 1]
+    FLOAT32 ///< IEEE 754 single precision, unclipped
+};
+
+/**
+ * @brief Largest number of frames a single audio packet may carry.
+ *
+ * Receivers size their per-packet slots from this. Keep actual packets
+ * well below it for low latency and to stay inside one MTU: 64 frames of
+ * FLOAT32 is 292 bytes on the wire, 256 frames is 1060.
+ */
+inline constexpr uint16_t MAX_AUDIO_PACKET_FRAMES = 512;
+
+/**
+ * @struct AudioPacketHeader
+ * @brief Decoded header of one audio datagram.
+ *
+ * Wire layout is little-endian and fixed at AUDIO_PACKET_HEADER_SIZE bytes:
+ *
+ *   magic u32 | version u8 | format u8 | frames u16 | stream_id u32 |
+ *   sequence u32 | sample_rate u32 | timestamp u64 | send_time_ns u64
+ *
+ * followed by @c frames mono samples in @c format.
+ */
+struct AudioPacketHeader {
+    AudioSampleFormat format { AudioSampleFormat::FLOAT32 };
+    uint16_t frames {};
+    uint32_t stream_id {}; ///< Lets several streams share one port
+    uint32_t sequence {}; ///< Increments by one per packet, wraps
+    uint32_t sample_rate { 48000 }; ///< Sender's nominal rate
+    uint64_t timestamp {}; ///< Sender frame index of the first sample
+    int64_t send_time_ns {}; ///< Sender wall clock (system_clock) at send
+};
+
+inline constexpr uint32_t AUDIO_PACKET_MAGIC = 0x5041464D; ///< "MFAP"
+inline constexpr uint8_t AUDIO_PACKET_VERSION = 1;
+inline constexpr size_t AUDIO_PACKET_HEADER_SIZE = 36;
+
+/**
+ * @brief Bytes per sample for a format.
+ */
+[[nodiscard]] constexpr size_t bytes_per_sample(AudioSampleFormat format) noexcept
+{
+    switch (format) {
+    case AudioSampleFormat::PCM16:
+        return 2;
+    case AudioSampleFormat::PCM24:
+        return 3;
+    case AudioSampleFormat::FLOAT32:
+        return 4;
+    }
+    return 4;
+}
+
+/**
+ * @brief Total datagram size for a packet of @p frames in @p format.
+ */
+[[nodiscard]] constexpr size_t audio_packet_size(AudioSampleFormat format, size_t frames) noexcept
+{
+    return AUDIO_PACKET_HEADER_SIZE + frames * bytes_per_sample(format);
+}
+
+/**
+ * @brief Serialise a header and its samples into @p out.
+ * @param header  Packet header. header.frames is ignored; samples.size() is used.
+ * @param samples Mono samples, at most MAX_AUDIO_PACKET_FRAMES.
+ * @param out     Destination, at least audio_packet_size() bytes.
+ * @return Bytes written, or 0 if the samples do not fit.
+ *
+ * Never allocates; safe on the audio thread.
+ */
+MAYAFLUX_API size_t encode_audio_packet(
+    const AudioPacketHeader& header,
+    std::span<const double> samples,
+    std::span<uint8_t> out) noexcept;
+
+/**
+ * @brief Parse and validate the header of a received datagram.
+ * @return The header, or std::nullopt if magic, version, format or
+ *         length do not match.
+ */
+[[nodiscard]] MAYAFLUX_API std::optional<AudioPacketHeader>
+decode_audio_packet_header(ByteView datagram) noexcept;
+
+/**
+ * @brief Decode the samples of a datagram whose header has been validated.
+ * @param datagram Full datagram.
+ * @param header   Result of decode_audio_packet_header().
+ * @param out      Destination, at least header.frames long.
+ * @return Number of samples written.
+ */
+MAYAFLUX_API size_t decode_audio_samples(
+    ByteView datagram,
+    const AudioPacketHeader& header,
+    std::span<float> out) noexcept;
+
+} // namespace MayaFlux::Portal::Network
@@ -0,0 +1,252 @@
+#include "AtlasPacker.hpp"
+
+namespace MayaFlux::Portal::Text {
+
+namespace {
+
+    constexpr float k_edt_inf = 1e20F;
+
+    /**
+     * @brief 1D squared Euclidean distance transform (Felzenszwalb & Huttenlocher).
+     *
+     * @param f  Input costs (0 at feature pixels, k_edt_inf elsewhere), n entries.
+     * @param d  Output squared distances, n entries.
+     * @param v  Scratch, n entries.
+     * @param z  Scratch, n + 1 entries.
+     */
+    void edt_1d(const float* f, size_t n, float* d, int32_t* v, float* z)
+    {
+        int32_t k = 0;
+        v[0] = 0;
+        z[0] = -k_edt_inf;
+        z[1] = k_edt_inf;
+
+        const auto intersect = [f](int32_t q, int32_t p) {
+            return ((f[q] + static_cast<float>(q * q)) - (f[p] + static_cast<float>(p * p)))
+                / static_cast<float>(2 * (q - p));
+        };
+
+        for (int32_t q = 1; q < static_cast<int32_t>(n); ++q) {
+            float s = intersect(q, v[k]);
+            while (s <= z[k]) {
+                --k;
+                s = intersect(q, v[k]);
+            }
+            ++k;
+            v[k] = q;
+            z[k] = s;
+            z[k + 1] = k_edt_inf;
+        }
+
+        k = 0;
+        for (int32_t q = 0; q < static_cast<int32_t>(n); ++q) {
+            while (z[k + 1] < static_cast<float>(q)) {
+                ++k;
+            }
+            const auto dq = static_cast<float>(q - v[k]);
+            d[q] = dq * dq + f[v[k]];
+        }
+    }
+
+    /**
+     * @brief 2D squared EDT in place over a w x h grid of costs.
+     */
+    void edt_2d(std::vector<float>& grid, uint32_t w, uint32_t h)
+    {
+        const size_t n = std::max(w, h);
+        std::vector<float> f(n);
+        std::vector<float> d(n);
+        std::vector<int32_t> v(n);
+        std::vector<float> z(n + 1);
+
+        for (uint32_t x = 0; x < w; ++x) {
+            for (uint32_t y = 0; y < h; ++y) {
+                f[y] = grid[static_cast<size_t>(y) * w + x];
+            }
+            edt_1d(f.data(), h, d.data(), v.data(), z.data());
+            for (uint32_t y = 0; y < h; ++y) {
+                grid[static_cast<size_t>(y) * w + x] = d[y];
+            }
+        }
+
+        for (uint32_t y = 0; y < h; ++y) {
+            float* row = grid.data() + static_cast<size_t>(y) * w;
+            std::copy_n(row, w, f.data());
+            edt_1d(f.data(), w, d.data(), v.data(), z.data());
+            std::copy_n(d.data(), w, row);
+        }
+    }
+
+} // namespace
+
+AtlasRect rect_union(const AtlasRect& a, const AtlasRect& b)
+{
+    if (a.empty()) {
+        return b;
+    }
+    if (b.empty()) {
+        return a;
+    }
+    const uint32_t x0 = std::min(a.x, b.x);
+    const uint32_t y0 = std::min(a.y, b.y);
+    const uint32_t x1 = std::max(a.x + a.w, b.x + b.w);
+    const uint32_t y1 = std::max(a.y + a.h, b.y + b.h);
+    return { .x = x0, .y = y0, .w = x1 - x0, .h = y1 - y0 };
+}
+
+// =========================================================================
+// SkylinePacker
+// =========================================================================
+
+SkylinePacker::SkylinePacker(uint32_t width, uint32_t height)
+{
+    reset(width, height);
+}
+
+void SkylinePacker::reset(uint32_t width, uint32_t height)
+{
+    m_width = width;
+    m_height = height;
+    m_used_area = 0;
+    m_skyline.clear();
+    m_skyline.push_back({ .x = 0, .y = 0, .w = width });
+}
+
+std::optional<uint32_t> SkylinePacker::fit(size_t index, uint32_t w, uint32_t h) const
+{
+    const uint32_t x = m_skyline[index].x;
+    if (x + w > m_width) {
+        return std::nullopt;
+    }
+
+    uint32_t y = m_skyline[index].y;
+    int64_t width_left = w;
+
+    for (size_t i = index; width_left > 0; ++i) {
+        if (i >= m_skyline.size()) {
+            return std::nullopt;
+        }
+        y = std::max(y, m_skyline[i].y);
+        if (y + h > m_height) {
+            return std::nullopt;
+        }
+        width_left -= m_skyline[i].w;
+    }
+
+    return y;
+}
+
+std::optional<AtlasRect> SkylinePacker::insert(uint32_t w, uint32_t h)
+{
+    if (w == 0 || h == 0 || w > m_width || h > m_height) {
+        return std::nullopt;
+    }
+
+    size_t best_index = m_skyline.size();
+    uint32_t best_top = std::numeric_limits<uint32_t>::max();
+    uint32_t best_width = std::numeric_limits<uint32_t>::max();
+    uint32_t best_y = 0;
+
+    for (size_t i = 0; i < m_skyline.size(); ++i) {
+        const auto y = fit(i, w, h);
+        if (!y) {
+            continue;
+        }
+        const uint32_t top = *y + h;
+        if (top < best_top || (top == best_top && m_skyline[i].w < best_width)) {
+            best_index = i;
+            best_top = top;
+            best_width = m_skyline[i].w;
+            best_y = *y;
+        }
+    }
+
+    if (best_index == m_skyline.size()) {
+        return std::nullopt;
+    }
+
+    const AtlasRect placed { .x = m_skyline[best_index].x, .y = best_y, .w = w, .h = h };
+
+    m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(best_index),
+        Segment { .x = placed.x, .y = placed.y + h, .w = w });
+
+    for (size_t i = best_index + 1; i < m_skyline.size();) {
+        const auto& prev = m_skyline[i - 1];
+        const uint32_t prev_end = prev.x + prev.w;
+        if (m_skyline[i].x >= prev_end) {
+            break;
+        }
+        const uint32_t shrink = prev_end - m_skyline[i].x;
+        if (m_skyline[i].w <= shrink) {
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i));
+            continue;
+        }
+        m_skyline[i].x += shrink;
+        m_skyline[i].w -= shrink;
+        break;
+    }
+
+    for (size_t i = 0; i + 1 < m_skyline.size();) {
+        if (m_skyline[i].y == m_skyline[i + 1].y) {
+            m_skyline[i].w += m_skyline[i + 1].w;
+            m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        } else {
+            ++i;
+        }
+    }
+
+    m_used_area += placed.area();
+    return placed;
+}
+
+float SkylinePacker::occupancy() const
+{
+    const auto total = static_cast<uint64_t>(m_width) * m_height;
+    return total ? static_cast<float>(m_used_area) / static_cast<float>(total) : 0.F;
+}
+
+// =========================================================================
+// Distance field
+// =========================================================================
+
+void coverage_to_sdf(
+    std::span<const uint8_t> coverage,
+    uint32_t w,
+    uint32_t h,
+    uint32_t spread,
+    std::span<uint8_t> out)
+{
+    const uint32_t ow = w + 2 * spread;
+    const uint32_t oh = h + 2 * spread;
+    const size_t n = static_cast<size_t>(ow) * oh;
+
+    if (out.size() < n || coverage.size() < static_cast<size_t>(w) * h) {
+        return;
+    }
+
+    std::vector<float> to_inside(n, k_edt_inf);
+    std::vector<float> to_outside(n, 0.F);
+
+    for (uint32_t y = 0; y < h; ++y) {
+        for (uint32_t x = 0; x < w; ++x) {
+            if (coverage[static_cast<size_t>(y) * w + x] >= 128) {
+                const size_t o = static_cast<size_t>(y + spread) * ow + x + spread;
+                to_inside[o] = 0.F;
+                to_outside[o] = k_edt_inf;
+            }
+        }
+    }
+
+    edt_2d(to_inside, ow, oh);
+    edt_2d(to_outside, ow, oh);
+
+    const float inv_spread = spread ? 1.F / static_cast<float>(spread) : 1.F;
+
+    for (size_t i = 0; i < n; ++i) {
+        const float d = std::sqrt(to_inside[i]) - std::sqrt(to_outside[i]);
+        const float t = std::clamp(-d * inv_spread, -1.F, 1.F);
+        out[i] = static_cast<uint8_t>(std::lround(128.F + 127.F * t));
+    }
+}
+
+} // namespace MayaFlux::Portal::Text
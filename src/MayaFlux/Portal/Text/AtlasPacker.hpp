@@ -0,0 +1,98 @@
+#pragma once
+
+namespace MayaFlux::Portal::Text {
+
+/**
+ * @struct AtlasRect
+ * @brief Axis-aligned pixel rectangle inside one atlas page.
+ */
+struct AtlasRect {
+    uint32_t x { 0 };
+    uint32_t y { 0 };
+    uint32_t w { 0 };
+    uint32_t h { 0 };
+
+    [[nodiscard]] uint64_t area() const { return static_cast<uint64_t>(w) * h; }
+    [[nodiscard]] bool empty() const { return w == 0 || h == 0; }
+};
+
+/**
+ * @brief Smallest rectangle containing both @p a and @p b.
+ */
+[[nodiscard]] MAYAFLUX_API AtlasRect rect_union(const AtlasRect& a, const AtlasRect& b);
+
+/**
+ * @class SkylinePacker
+ * @brief Bottom-left skyline rectangle packer for one fixed-size atlas page.
+ *
+ * The skyline is the upper envelope of everything placed so far, stored as
+ * a list of horizontal segments. Each insertion picks the segment that
+ * yields the lowest top edge (ties broken by the narrowest segment), which
+ * wastes far less space than a shelf packer when glyph heights vary, e.g.
+ * mixed-case text or an atlas shared by several sizes.
+ *
+ * Freed rectangles are not reclaimed individually; callers evict whole
+ * pages and reset() the packer.
+ */
+class MAYAFLUX_API SkylinePacker {
+public:
+    SkylinePacker() = default;
+    SkylinePacker(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Discard all placements and start over at the given size.
+     */
+    void reset(uint32_t width, uint32_t height);
+
+    /**
+     * @brief Place a w x h rectangle.
+     * @return Placement, or nullopt if it does not fit anywhere.
+     */
+    std::optional<AtlasRect> insert(uint32_t w, uint32_t h);
+
+    /**
+     * @brief Fraction of the page area covered by placed rectangles.
+     */
+    [[nodiscard]] float occupancy() const;
+
+    [[nodiscard]] uint32_t width() const { return m_width; }
+    [[nodiscard]] uint32_t height() const { return m_height; }
+
+private:
+    struct Segment {
+        uint32_t x;
+        uint32_t y;
+        uint32_t w;
+    };
+
+    std::vector<Segment> m_skyline;
+    uint32_t m_width { 0 };
+    uint32_t m_height { 0 };
+    uint64_t m_used_area { 0 };
+
+    [[nodiscard]] std::optional<uint32_t> fit(size_t index, uint32_t w, uint32_t h) const;
+};
+
+/**
+ * @brief Convert a coverage bitmap into a signed distance field.
+ *
+ * Pixels with coverage >= 128 are inside. Distances are exact Euclidean
+ * (two-pass Felzenszwalb transform) and encoded as
+ * 128 + 127 * clamp(-d / spread, -1, 1), so 0.5 in normalised texture
+ * space lies on the outline and values above it are inside.
+ *
+ * @param coverage Source bitmap, w * h bytes, row-major.
+ * @param w        Source width.
+ * @param h        Source height.
+ * @param spread   Distance in pixels mapped to the full encoding range. The
+ *                 output is padded by @p spread on every side.
+ * @param out      Destination, (w + 2 * spread) * (h + 2 * spread) bytes.
+ */
+MAYAFLUX_API void coverage_to_sdf(
+    std::span<const uint8_t> coverage,
+    uint32_t w,
+    uint32_t h,
+    uint32_t spread,
+    std::span<uint8_t> out);
+
+} // namespace MayaFlux::Portal::Text
@@ -4,13 +4,34 @@
 
 namespace MayaFlux::Portal::Text {
 
+namespace {
+
+    constexpr uint32_t k_pad = 1;
+
+    /// Beyond this many pending rects per page, collapse to their bounding box.
+    constexpr size_t k_max_dirty_rects = 16;
+
+    std::atomic<uint64_t> g_next_atlas_id { 1 };
+
+} // namespace
+
 GlyphAtlas::GlyphAtlas(FontFace& face, uint32_t pixel_size, uint32_t atlas_size)
+    : GlyphAtlas(face, pixel_size, GlyphAtlasParams { .page_size = atlas_size })
+{
+}
+
+GlyphAtlas::GlyphAtlas(FontFace& face, uint32_t pixel_size, const GlyphAtlasParams& params)
     : m_face(face)
     , m_pixel_size(pixel_size)
-    , m_atlas_size(atlas_size)
+    , m_params(params)
+    , m_id(g_next_atlas_id.fetch_add(1, std::memory_order_relaxed))
 {
-    m_texture = std::make_unique<Kakshya::TextureContainer>(
-        atlas_size, atlas_size, Portal::Graphics::ImageFormat::R8);
+    m_params.max_pages = std::max(m_params.max_pages, 1U);
+    if (m_params.mode == GlyphRasterMode::SDF) {
+        m_params.sdf_spread = std::max(m_params.sdf_spread, 1U);
+    }
+
+    add_page();
 
     FT_Set_Pixel_Sizes(m_face.get_face(), 0, m_pixel_size);
 }
@@ -19,14 +40,11 @@ const GlyphMetrics* GlyphAtlas::get_or_rasterize(FT_UInt glyph_index)
 {
     auto it = m_cache.find(glyph_index);
     if (it != m_cache.end()) {
+        m_pages[it->second.page].last_used = ++m_use_clock;
         return &it->second;
     }
 
-    if (!rasterize(glyph_index)) {
-        return nullptr;
-    }
-
-    return &m_cache.at(glyph_index);
+    return rasterize(glyph_index);
 }
 
 const GlyphMetrics* GlyphAtlas::get_or_rasterize(FT_ULong codepoint)
@@ -47,6 +65,18 @@ const GlyphMetrics* GlyphAtlas::get_or_rasterize(FT_ULong codepoint)
     return get_or_rasterize(idx);
 }
 
+bool GlyphAtlas::is_dirty() const
+{
+    return std::ranges::any_of(m_pages, [](const Page& p) { return !p.dirty.empty(); });
+}
+
+void GlyphAtlas::clear_dirty()
+{
+    for (auto& page : m_pages) {
+        page.dirty.clear();
+    }
+}
+
 [[nodiscard]] uint32_t GlyphAtlas::line_height() const
 {
     FT_Face face = m_face.get_face();
@@ -66,79 +96,197 @@ const GlyphMetrics* GlyphAtlas::get_or_rasterize(FT_ULong codepoint)
     return a > 0 ? static_cast<uint32_t>(a) : m_pixel_size;
 }
 
-bool GlyphAtlas::rasterize(FT_UInt glyph_index)
+// =========================================================================
+// Pages
+// =========================================================================
+
+void GlyphAtlas::add_page()
+{
+    const uint32_t size = m_params.page_size;
+
+    Page page;
+    page.texture = std::make_unique<Kakshya::TextureContainer>(
+        size, size, Portal::Graphics::ImageFormat::R8);
+    page.packer.reset(size, size);
+    page.dirty.push_back({ .x = 0, .y = 0, .w = size, .h = size });
+    page.last_used = m_use_clock;
+    m_pages.push_back(std::move(page));
+}
+
+void GlyphAtlas::evict_page(uint32_t page)
+{
+    Page& p = m_pages[page];
+
+    std::erase_if(m_cache, [page](const auto& kv) { return kv.second.page == page; });
+
+    const std::span<uint8_t> pixels = p.texture->pixel_bytes(0);
+    std::ranges::fill(pixels, uint8_t { 0 });
+
+    p.packer.reset(m_params.page_size, m_params.page_size);
+    p.dirty.assign(1, { .x = 0, .y = 0, .w = m_params.page_size, .h = m_params.page_size });
+
+    ++m_generation;
+    ++m_evictions;
+
+    MF_DEBUG(Journal::Component::Portal, Journal::Context::API,
+        "GlyphAtlas: evicted page {} (pixel_size={}, {} glyphs resident)",
+        page, m_pixel_size, m_cache.size());
+}
+
+std::optional<std::pair<uint32_t, AtlasRect>> GlyphAtlas::allocate(uint32_t w, uint32_t h)
+{
+    const uint32_t pw = w + k_pad;
+    const uint32_t ph = h + k_pad;
+
+    for (uint32_t i = 0; i < m_pages.size(); ++i) {
+        if (auto r = m_pages[i].packer.insert(pw, ph)) {
+            return std::pair { i, *r };
+        }
+    }
+
+    if (m_pages.size() < m_params.max_pages) {
+        add_page();
+        const auto last = static_cast<uint32_t>(m_pages.size() - 1);
+        if (auto r = m_pages[last].packer.insert(pw, ph)) {
+            return std::pair { last, *r };
+        }
+        return std::nullopt;
+    }
+
+    const auto lru = std::ranges::min_element(m_pages, {}, &Page::last_used);
+    const auto victim = static_cast<uint32_t>(std::distance(m_pages.begin(), lru));
+    evict_page(victim);
+
+    if (auto r = m_pages[victim].packer.insert(pw, ph)) {
+        return std::pair { victim, *r };
+    }
+    return std::nullopt;
+}
+
+void GlyphAtlas::mark_dirty(uint32_t page, const AtlasRect& rect)
+{
+    auto& dirty = m_pages[page].dirty;
+
+    const bool covered = std::ranges::any_of(dirty, [&rect](const AtlasRect& r) {
+        return rect.x >= r.x && rect.y >= r.y
+            && rect.x + rect.w <= r.x + r.w && rect.y + rect.h <= r.y + r.h;
+    });
+    if (covered) {
+        return;
+    }
+
+    if (dirty.size() < k_max_dirty_rects) {
+        dirty.push_back(rect);
+        return;
+    }
+
+    AtlasRect bounds = rect;
+    for (const auto& r : dirty) {
+        bounds = rect_union(bounds, r);
+    }
+    dirty.assign(1, bounds);
+}
+
+// =========================================================================
+// Rasterization
+// =========================================================================
+
+const GlyphMetrics* GlyphAtlas::rasterize(FT_UInt glyph_index)
 {
     FT_Face face = m_face.get_face();
 
     if (const FT_Error err = FT_Set_Pixel_Sizes(face, 0, m_pixel_size); err != 0) {
         MF_ERROR(Journal::Component::Portal, Journal::Context::API,
             "FT_Set_Pixel_Sizes({}) failed: {}", m_pixel_size, static_cast<int>(err));
-        return false;
+        return nullptr;
     }
 
     if (const FT_Error err = FT_Load_Glyph(face, glyph_index, FT_LOAD_RENDER); err != 0) {
         MF_ERROR(Journal::Component::Portal, Journal::Context::API,
             "FT_Load_Glyph({}) failed: {}", glyph_index, static_cast<int>(err));
-        return false;
+        return nullptr;
     }
 
     const FT_Bitmap& bmp = face->glyph->bitmap;
-    const uint32_t gw = bmp.width;
-    const uint32_t gh = bmp.rows;
+    const uint32_t bw = bmp.width;
+    const uint32_t bh = bmp.rows;
+    const auto pitch = static_cast<size_t>(std::abs(bmp.pitch));
 
-    constexpr uint32_t k_pad = 1;
+    GlyphMetrics m;
+    m.bearing_x = face->glyph->bitmap_left;
+    m.bearing_y = face->glyph->bitmap_top;
+    m.advance_x = static_cast<int32_t>(face->glyph->advance.x >> 6);
+
+    if (bw == 0 || bh == 0) {
+        return &m_cache.insert_or_assign(glyph_index, m).first->second;
+    }
+
+    const uint8_t* src = bmp.buffer;
+    size_t src_stride = pitch;
+    uint32_t gw = bw;
+    uint32_t gh = bh;
+
+    if (m_params.mode == GlyphRasterMode::SDF) {
+        const uint32_t spread = m_params.sdf_spread;
+
+        std::vector<uint8_t> coverage(static_cast<size_t>(bw) * bh);
+        for (uint32_t row = 0; row < bh; ++row) {
+            std::memcpy(coverage.data() + static_cast<size_t>(row) * bw, bmp.buffer + row * pitch, bw);
+        }
+
+        gw = bw + 2 * spread;
+        gh = bh + 2 * spread;
+        m_scratch.resize(static_cast<size_t>(gw) * gh);
+        coverage_to_sdf(coverage, bw, bh, spread, m_scratch);
 
-    if (m_cursor_x + gw + k_pad > m_atlas_size) {
-        m_cursor_x = 0;
-        m_cursor_y += m_shelf_height + k_pad;
-        m_shelf_height = 0;
+        src = m_scratch.data();
+        src_stride = gw;
+        m.bearing_x -= static_cast<int32_t>(spread);
+        m.bearing_y += static_cast<int32_t>(spread);
     }
 
-    if (m_cursor_y + gh + k_pad > m_atlas_size) {
+    const auto slot = allocate(gw, gh);
+    if (!slot) {
         MF_ERROR(Journal::Component::Portal, Journal::Context::API,
-            "GlyphAtlas full at pixel_size={} atlas_size={}. "
-            "Construct with a larger atlas_size.",
-            m_pixel_size, m_atlas_size);
-        return false;
+            "GlyphAtlas: glyph {} ({}x{}) does not fit a {}px page at pixel_size={}. "
+            "Construct with a larger page size.",
+            glyph_index, gw, gh, m_params.page_size, m_pixel_size);
+        return nullptr;
     }
 
-    const std::span<uint8_t> pixels = m_texture->pixel_bytes(0);
+    const auto [page, rect] = *slot;
+    Page& p = m_pages[page];
+
+    const std::span<uint8_t> pixels = p.texture->pixel_bytes(0);
     if (pixels.empty()) {
         MF_ERROR(Journal::Component::Portal, Journal::Context::API,
             "GlyphAtlas: TextureContainer pixel_bytes returned empty span");
-        return false;
+        return nullptr;
     }
 
-    const uint32_t stride = m_atlas_size;
+    const uint32_t stride = m_params.page_size;
 
     for (uint32_t row = 0; row < gh; ++row) {
-        const uint8_t* src = bmp.buffer + static_cast<size_t>(row * static_cast<uint32_t>(std::abs(bmp.pitch)));
-        uint8_t* dst = pixels.data() + static_cast<size_t>((m_cursor_y + row) * stride) + m_cursor_x;
-        std::memcpy(dst, src, gw);
+        uint8_t* dst = pixels.data() + static_cast<size_t>(rect.y + row) * stride + rect.x;
+        std::memcpy(dst, src + row * src_stride, gw);
     }
 
-    const float inv = 1.F / static_cast<float>(m_atlas_size);
+    const float inv = 1.F / static_cast<float>(stride);
 
-    GlyphMetrics m;
-    m.uv_x0 = static_cast<float>(m_cursor_x) * inv;
-    m.uv_y0 = static_cast<float>(m_cursor_y) * inv;
-    m.uv_x1 = static_cast<float>(m_cursor_x + gw) * inv;
-    m.uv_y1 = static_cast<float>(m_cursor_y + gh) * inv;
-    m.bearing_x = face->glyph->bitmap_left;
-    m.bearing_y = face->glyph->bitmap_top;
+    m.uv_x0 = static_cast<float>(rect.x) * inv;
+    m.uv_y0 = static_cast<float>(rect.y) * inv;
+    m.uv_x1 = static_cast<float>(rect.x + gw) * inv;
+    m.uv_y1 = static_cast<float>(rect.y + gh) * inv;
     m.width = gw;
     m.height = gh;
-    m.advance_x = static_cast<int32_t>(face->glyph->advance.x >> 6);
+    m.page = page;
+    m.atlas_x = rect.x;
+    m.atlas_y = rect.y;
 
-    m_cache.emplace(glyph_index, m);
-
-    m_cursor_x += gw + k_pad;
-    if (gh > m_shelf_height) {
-        m_shelf_height = gh;
-    }
+    p.last_used = ++m_use_clock;
+    mark_dirty(page, { .x = rect.x, .y = rect.y, .w = gw, .h = gh });
 
-    m_dirty = true;
-    return true;
+    return &m_cache.insert_or_assign(glyph_index, m).first->second;
 }
 
 } // namespace MayaFlux::Portal::Text
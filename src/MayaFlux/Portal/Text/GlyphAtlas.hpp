@@ -1,5 +1,6 @@
 #pragma once
 
+#include "AtlasPacker.hpp"
 #include "FontFace.hpp"
 
 #include "MayaFlux/Kakshya/Source/TextureContainer.hpp"
@@ -17,8 +18,9 @@ namespace MayaFlux::Portal::Text {
  * @struct GlyphMetrics
  * @brief Per-glyph layout and UV data produced by GlyphAtlas.
  *
- * UV coordinates are in normalised [0, 1] atlas space.
+ * UV coordinates are in normalised [0, 1] space of the glyph's atlas page.
  * Bearing and size are in pixels at the atlas's declared pixel_size.
+ * In SDF mode width/height and bearing include the distance-field padding.
  *
  * When HarfBuzz is introduced it will supply glyph_index and position
  * offsets directly; this struct remains the downstream currency.
@@ -34,18 +36,58 @@ struct GlyphMetrics {
     uint32_t width { 0 }; ///< Glyph bitmap width in pixels.
     uint32_t height { 0 }; ///< Glyph bitmap height in pixels.
     int32_t advance_x { 0 }; ///< Horizontal advance in pixels (26.6 fixed-point >> 6).
+
+    uint32_t page { 0 }; ///< Atlas page holding the bitmap.
+    uint32_t atlas_x { 0 }; ///< Left pixel column of the bitmap in its page.
+    uint32_t atlas_y { 0 }; ///< Top pixel row of the bitmap in its page.
+};
+
+/**
+ * @brief What an atlas page stores per texel.
+ */
+enum class GlyphRasterMode : uint8_t {
+    Coverage, ///< Anti-aliased coverage at pixel_size; exact at that size only.
+    SDF ///< Signed distance field; one atlas serves any display size.
+};
+
+/**
+ * @struct GlyphAtlasParams
+ * @brief Page geometry, growth and raster mode for a GlyphAtlas.
+ */
+struct GlyphAtlasParams {
+    /// @brief Width and height of each page in pixels.
+    uint32_t page_size { 512 };
+
+    /// @brief Pages allocated before least-recently-used pages are evicted.
+    uint32_t max_pages { 4 };
+
+    GlyphRasterMode mode { GlyphRasterMode::Coverage };
+
+    /// @brief SDF mode: distance in pixels encoded across the full value range.
+    uint32_t sdf_spread { 4 };
 };
 
 /**
  * @class GlyphAtlas
- * @brief Rasterizes and packs glyphs from a FontFace into a TextureContainer.
+ * @brief Rasterizes and packs glyphs from a FontFace into TextureContainer pages.
+ *
+ * One atlas corresponds to one (FontFace, pixel_size) pair.  Each page is an
+ * R8 TextureContainer; colour is applied at composite or shader time.
+ *
+ * Glyphs are rasterized on first request via get_or_rasterize() and placed
+ * with a skyline packer.  When the current pages are full a new page is
+ * added, up to GlyphAtlasParams::max_pages.  Past that, the page whose
+ * glyphs were least recently requested is cleared and reused; every glyph on
+ * it is dropped and generation() increments so that cached layouts holding
+ * its UVs can be invalidated.
  *
- * One atlas corresponds to one (FontFace, pixel_size) pair.  The atlas
- * texture is R8 (single-channel coverage); colour is applied in the shader.
+ * Every newly written glyph rectangle is recorded per page, so a GPU mirror
+ * can upload only the changed regions (see dirty_rects()).
  *
- * Glyphs are rasterized on first request via get_or_rasterize() and packed
- * into the atlas using a simple shelf packing algorithm.  The atlas texture
- * is rebuilt whenever a new glyph causes a shelf overflow.
+ * In SDF mode each glyph is stored as a distance field derived from its
+ * coverage bitmap, padded by sdf_spread on every side.  lay_out() may then
+ * scale metrics to any display size and rasterize_quads() thresholds the
+ * field, so a single atlas serves every size of a face.
  *
  * The atlas is keyed on FT_UInt glyph index, not Unicode codepoint.
  * Callers obtain glyph indices via FT_Get_Char_Index on the FontFace.
@@ -60,7 +102,7 @@ public:
      * @brief Construct an atlas for a specific face and pixel size.
      * @param face        Loaded FontFace.  Must outlive this atlas.
      * @param pixel_size  Glyph height in pixels (width is derived by FreeType).
-     * @param atlas_size  Width and height of the atlas texture in pixels.
+     * @param atlas_size  Width and height of each atlas page in pixels.
      *                    Must be a power of two.  Default 512 is sufficient
      *                    for ASCII + extended Latin at sizes up to ~48px.
      */
@@ -69,6 +111,15 @@ public:
         uint32_t pixel_size,
         uint32_t atlas_size = 512);
 
+    /**
+     * @brief Construct an atlas with explicit page geometry and raster mode.
+     * @param face        Loaded FontFace.  Must outlive this atlas.
+     * @param pixel_size  Glyph height in pixels.  In SDF mode this is the
+     *                    base size the field is computed at.
+     * @param params      Page size, page limit and raster mode.
+     */
+    GlyphAtlas(FontFace& face, uint32_t pixel_size, const GlyphAtlasParams& params);
+
     ~GlyphAtlas() = default;
 
     GlyphAtlas(const GlyphAtlas&) = delete;
@@ -80,6 +131,8 @@ public:
      * @brief Return metrics for a glyph, rasterizing it into the atlas if needed.
      * @param glyph_index  FT_UInt glyph index (from FT_Get_Char_Index).
      * @return Pointer to cached GlyphMetrics, or nullptr if rasterization fails.
+     *
+     * The pointer stays valid until the glyph's page is evicted.
      */
     const GlyphMetrics* get_or_rasterize(FT_UInt glyph_index);
 
@@ -102,25 +155,43 @@ public:
     const GlyphMetrics* get_or_rasterize(FT_ULong codepoint);
 
     /**
-     * @brief The atlas texture as a TextureContainer (R8, atlas_size x atlas_size).
+     * @brief An atlas page as a TextureContainer (R8, atlas_size x atlas_size).
      *
-     * The container is valid after construction.  Its pixel data is updated
-     * in-place as new glyphs are rasterized; callers must re-upload to GPU
-     * after any rasterization call that returns non-null.
+     * Page 0 is valid after construction; further pages appear as the atlas
+     * grows.  Pixel data is updated in-place as glyphs are rasterized.
+     */
+    [[nodiscard]] const Kakshya::TextureContainer& texture(uint32_t page = 0) const { return *m_pages[page].texture; }
+    [[nodiscard]] Kakshya::TextureContainer& texture(uint32_t page = 0) { return *m_pages[page].texture; }
+
+    /**
+     * @brief Number of allocated pages.
+     */
+    [[nodiscard]] uint32_t page_count() const { return static_cast<uint32_t>(m_pages.size()); }
+
+    /**
+     * @brief Returns true if any page has changed since the last clear_dirty().
+     */
+    [[nodiscard]] bool is_dirty() const;
+
+    /**
+     * @brief Clear dirty state of every page after re-uploading to GPU.
      */
-    [[nodiscard]] const Kakshya::TextureContainer& texture() const { return *m_texture; }
-    [[nodiscard]] Kakshya::TextureContainer& texture() { return *m_texture; }
+    void clear_dirty();
 
     /**
-     * @brief Returns true if at least one glyph was rasterized since the last
-     *        call to clear_dirty().  Use to decide whether to re-upload to GPU.
+     * @brief Rectangles of @p page written since its last clear_dirty(page).
+     *
+     * A rectangle already covered by a pending one is not recorded again.
+     * When many small glyphs are added between uploads the list is collapsed
+     * to its bounding box, so its length stays small.  A freshly added or
+     * evicted page reports its full extent.
      */
-    [[nodiscard]] bool is_dirty() const { return m_dirty; }
+    [[nodiscard]] std::span<const AtlasRect> dirty_rects(uint32_t page) const { return m_pages[page].dirty; }
 
     /**
-     * @brief Clear the dirty flag after re-uploading the atlas to GPU.
+     * @brief Clear dirty state of one page after uploading its dirty_rects().
      */
-    void clear_dirty() { m_dirty = false; }
+    void clear_dirty(uint32_t page) { m_pages[page].dirty.clear(); }
 
     /**
      * @brief Pixel size passed at construction.
@@ -128,9 +199,55 @@ public:
     [[nodiscard]] uint32_t pixel_size() const { return m_pixel_size; }
 
     /**
-     * @brief Atlas texture dimension (width == height == atlas_size).
+     * @brief Atlas page dimension (width == height == atlas_size).
+     */
+    [[nodiscard]] uint32_t atlas_size() const { return m_params.page_size; }
+
+    /**
+     * @brief Raster mode chosen at construction.
+     */
+    [[nodiscard]] GlyphRasterMode mode() const { return m_params.mode; }
+
+    /**
+     * @brief Distance-field spread in pixels (SDF mode only).
      */
-    [[nodiscard]] uint32_t atlas_size() const { return m_atlas_size; }
+    [[nodiscard]] uint32_t sdf_spread() const { return m_params.sdf_spread; }
+
+    /**
+     * @brief Incremented whenever a page is evicted.
+     *
+     * Any GlyphMetrics pointer or UV obtained under an older generation may
+     * refer to a different glyph.
+     */
+    [[nodiscard]] uint64_t generation() const { return m_generation; }
+
+    /**
+     * @brief Mark @p page as just used, as a lookup of one of its glyphs would.
+     *
+     * Callers that reuse glyph UVs without calling get_or_rasterize(), such
+     * as LayoutCache, touch the pages they draw from so those pages are not
+     * taken for cold and evicted.
+     */
+    void touch_page(uint32_t page)
+    {
+        if (page < m_pages.size())
+            m_pages[page].last_used = ++m_use_clock;
+    }
+
+    /**
+     * @brief Process-unique identity of this atlas, stable for its lifetime.
+     */
+    [[nodiscard]] uint64_t id() const { return m_id; }
+
+    /**
+     * @brief Number of glyphs currently resident.
+     */
+    [[nodiscard]] size_t glyph_count() const { return m_cache.size(); }
+
+    /**
+     * @brief Number of page evictions since construction.
+     */
+    [[nodiscard]] uint64_t eviction_count() const { return m_evictions; }
 
     /**
      * @brief Line advance in pixels for this atlas's pixel_size.
@@ -145,21 +262,32 @@ public:
     [[nodiscard]] uint32_t ascender() const;
 
 private:
-    bool rasterize(FT_UInt glyph_index);
+    struct Page {
+        std::unique_ptr<Kakshya::TextureContainer> texture;
+        SkylinePacker packer;
+        std::vector<AtlasRect> dirty;
+        uint64_t last_used { 0 };
+    };
+
+    const GlyphMetrics* rasterize(FT_UInt glyph_index);
+    std::optional<std::pair<uint32_t, AtlasRect>> allocate(uint32_t w, uint32_t h);
+    void add_page();
+    void evict_page(uint32_t page);
+    void mark_dirty(uint32_t page, const AtlasRect& rect);
 
     FontFace& m_face;
     uint32_t m_pixel_size;
-    uint32_t m_atlas_size;
-
-    std::unique_ptr<Kakshya::TextureContainer> m_texture;
+    GlyphAtlasParams m_params;
 
+    std::vector<Page> m_pages;
     std::unordered_map<FT_UInt, GlyphMetrics> m_cache;
 
-    uint32_t m_cursor_x { 0 };
-    uint32_t m_cursor_y { 0 };
-    uint32_t m_shelf_height { 0 };
+    std::vector<uint8_t> m_scratch;
 
-    bool m_dirty { false };
+    uint64_t m_use_clock { 0 };
+    uint64_t m_generation { 0 };
+    uint64_t m_evictions { 0 };
+    uint64_t m_id;
 };
 
 } // namespace MayaFlux::Portal::Text
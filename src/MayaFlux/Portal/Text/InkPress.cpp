@@ -70,7 +70,7 @@ namespace {
         uint32_t buf_h,
         float pen_y_start = 0.F)
     {
-        const LayoutResult layout = lay_out(text, atlas, 0.F, pen_y_start, buf_w);
+        const LayoutResult& layout = thread_layout_cache().lay_out(text, atlas, 0.F, pen_y_start, buf_w);
         if (layout.quads.empty()) {
             return std::nullopt;
         }
@@ -160,18 +160,99 @@ void rasterize_quads(
     const uint8_t cb = static_cast<uint8_t>(std::clamp(color.b, 0.F, 1.F) * 255.F);
     const uint8_t ca = static_cast<uint8_t>(std::clamp(color.a, 0.F, 1.F) * 255.F);
 
-    const Kakshya::TextureContainer& atlas_tex = atlas.texture();
-    const std::span<const uint8_t> atlas_pixels = atlas_tex.pixel_bytes(0);
     const uint32_t atlas_size = atlas.atlas_size();
+    const bool sdf = atlas.mode() == GlyphRasterMode::SDF;
+    const auto spread = static_cast<float>(atlas.sdf_spread());
+
+    const auto write = [&](uint8_t* px, float a) {
+        const auto alpha = static_cast<uint8_t>(std::lround(a * static_cast<float>(ca)));
+        if (alpha < px[3]) {
+            return;
+        }
+        px[0] = cr;
+        px[1] = cg;
+        px[2] = cb;
+        px[3] = alpha;
+    };
 
     for (const auto& q : quads) {
+        if (q.page >= atlas.page_count()) {
+            continue;
+        }
+
+        const std::span<const uint8_t> atlas_pixels = atlas.texture(q.page).pixel_bytes(0);
+
         const auto gx = static_cast<int32_t>(std::floor(q.x0));
         const auto gy = static_cast<int32_t>(std::floor(q.y0));
         const auto gw = static_cast<uint32_t>(std::ceil(q.x1 - q.x0));
         const auto gh = static_cast<uint32_t>(std::ceil(q.y1 - q.y0));
 
-        const auto src_x = static_cast<uint32_t>(q.uv_x0 * static_cast<float>(atlas_size));
-        const auto src_y = static_cast<uint32_t>(q.uv_y0 * static_cast<float>(atlas_size));
+        const float src_x0 = q.uv_x0 * static_cast<float>(atlas_size);
+        const float src_y0 = q.uv_y0 * static_cast<float>(atlas_size);
+        const float src_w = (q.uv_x1 - q.uv_x0) * static_cast<float>(atlas_size);
+        const float src_h = (q.uv_y1 - q.uv_y0) * static_cast<float>(atlas_size);
+
+        if (gw == 0 || gh == 0 || src_w < 1.F || src_h < 1.F) {
+            continue;
+        }
+
+        const auto src_x = static_cast<uint32_t>(src_x0);
+        const auto src_y = static_cast<uint32_t>(src_y0);
+
+        const bool native = !sdf
+            && std::abs(src_w - static_cast<float>(gw)) < 0.5F
+            && std::abs(src_h - static_cast<float>(gh)) < 0.5F;
+
+        if (native) {
+            for (uint32_t row = 0; row < gh; ++row) {
+                const int32_t dst_row = gy + static_cast<int32_t>(row);
+                if (dst_row < 0 || static_cast<uint32_t>(dst_row) >= buf_h) {
+                    continue;
+                }
+
+                const uint8_t* src_row = atlas_pixels.data()
+                    + static_cast<size_t>(src_y + row) * atlas_size + src_x;
+                uint8_t* dst_row_ptr = dst + static_cast<size_t>(dst_row) * buf_w * 4;
+
+                for (uint32_t col = 0; col < gw; ++col) {
+                    const int32_t dst_col = gx + static_cast<int32_t>(col);
+                    if (dst_col < 0 || static_cast<uint32_t>(dst_col) >= buf_w) {
+                        continue;
+                    }
+                    write(dst_row_ptr + static_cast<size_t>(dst_col) * 4,
+                        static_cast<float>(src_row[col]) / 255.F);
+                }
+            }
+            continue;
+        }
+
+        // Resampled path: bilinear lookup clamped to the glyph's own texels,
+        // so neighbouring glyphs in the page never bleed in.
+        const float step_x = src_w / (q.x1 - q.x0);
+        const float step_y = src_h / (q.y1 - q.y0);
+        const float max_x = static_cast<float>(src_x) + src_w - 1.F;
+        const float max_y = static_cast<float>(src_y) + src_h - 1.F;
+
+        // Normalised SDF value -> signed distance in destination pixels.
+        const float sdf_gain = 2.F * spread / std::max(step_x, step_y);
+
+        const auto sample = [&](float sx, float sy) {
+            sx = std::clamp(sx, static_cast<float>(src_x), max_x);
+            sy = std::clamp(sy, static_cast<float>(src_y), max_y);
+            const auto x0 = static_cast<uint32_t>(sx);
+            const auto y0 = static_cast<uint32_t>(sy);
+            const uint32_t x1 = std::min(x0 + 1, static_cast<uint32_t>(max_x));
+            const uint32_t y1 = std::min(y0 + 1, static_cast<uint32_t>(max_y));
+            const float fx = sx - static_cast<float>(x0);
+            const float fy = sy - static_cast<float>(y0);
+
+            const auto at = [&](uint32_t x, uint32_t y) {
+                return static_cast<float>(atlas_pixels[static_cast<size_t>(y) * atlas_size + x]);
+            };
+            const float top = at(x0, y0) + (at(x1, y0) - at(x0, y0)) * fx;
+            const float bot = at(x0, y1) + (at(x1, y1) - at(x0, y1)) * fx;
+            return (top + (bot - top) * fy) / 255.F;
+        };
 
         for (uint32_t row = 0; row < gh; ++row) {
             const int32_t dst_row = gy + static_cast<int32_t>(row);
@@ -179,8 +260,7 @@ void rasterize_quads(
                 continue;
             }
 
-            const uint8_t* src_row = atlas_pixels.data()
-                + static_cast<size_t>(src_y + row) * atlas_size + src_x;
+            const float sy = src_y0 + (static_cast<float>(dst_row) + 0.5F - q.y0) * step_y - 0.5F;
             uint8_t* dst_row_ptr = dst + static_cast<size_t>(dst_row) * buf_w * 4;
 
             for (uint32_t col = 0; col < gw; ++col) {
@@ -189,15 +269,15 @@ void rasterize_quads(
                     continue;
                 }
 
-                const uint8_t coverage = src_row[col];
-                const auto alpha = static_cast<uint8_t>(
-                    (static_cast<uint32_t>(coverage) * static_cast<uint32_t>(ca)) / 255U);
+                const float sx = src_x0 + (static_cast<float>(dst_col) + 0.5F - q.x0) * step_x - 0.5F;
+                const float v = sample(sx, sy);
+                const float a = sdf
+                    ? std::clamp(0.5F + (v - 0.5F) * sdf_gain, 0.F, 1.F)
+                    : v;
 
-                uint8_t* px = dst_row_ptr + static_cast<size_t>(dst_col) * 4;
-                px[0] = cr;
-                px[1] = cg;
-                px[2] = cb;
-                px[3] = alpha;
+                if (a > 0.F) {
+                    write(dst_row_ptr + static_cast<size_t>(dst_col) * 4, a);
+                }
             }
         }
     }
@@ -63,9 +63,15 @@ struct PressParams {
 /**
  * @brief Write glyph quads into a caller-provided RGBA8 pixel buffer.
  *
- * Applies coverage-multiplied alpha blend per glyph cell. The destination
- * buffer must be row-major RGBA8 with stride == buf_w * 4 bytes. Quads
- * that fall outside [0, buf_w) x [0, buf_h) are clipped per pixel.
+ * Applies coverage-multiplied alpha per glyph cell, keeping the larger alpha
+ * where cells overlap. The destination buffer must be row-major RGBA8 with
+ * stride == buf_w * 4 bytes. Quads that fall outside [0, buf_w) x [0, buf_h)
+ * are clipped per pixel.
+ *
+ * Quads whose size matches their atlas texels are copied directly. Scaled
+ * quads (lay_out() with a font_size, or caller transforms) are sampled
+ * bilinearly; with an SDF atlas the distance field is thresholded with a
+ * one-pixel antialiasing ramp, so edges stay sharp at any size.
  *
  * The typical usage pattern is:
  * @code
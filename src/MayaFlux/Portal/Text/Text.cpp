@@ -6,6 +6,7 @@
 #include "FontDiscovery.hpp"
 
 #include "MayaFlux/Core/GlobalGraphicsInfo.hpp"
+#include "MayaFlux/Portal/Graphics/TextureLoom.hpp"
 
 #include "MayaFlux/Journal/Archivist.hpp"
 
@@ -110,4 +111,35 @@ GlyphAtlas& get_default_atlas()
     return *atlas;
 }
 
+bool sync_atlas_page(
+    GlyphAtlas& atlas,
+    uint32_t page,
+    const std::shared_ptr<Core::VKImage>& image)
+{
+    if (page >= atlas.page_count() || !image) {
+        MF_ERROR(Journal::Component::Portal, Journal::Context::API,
+            "sync_atlas_page: invalid page {} or null image", page);
+        return false;
+    }
+
+    const auto rects = atlas.dirty_rects(page);
+    if (rects.empty()) {
+        return false;
+    }
+
+    std::vector<vk::Rect2D> regions;
+    regions.reserve(rects.size());
+    for (const auto& r : rects) {
+        regions.push_back(vk::Rect2D {
+            vk::Offset2D { static_cast<int32_t>(r.x), static_cast<int32_t>(r.y) },
+            vk::Extent2D { r.w, r.h } });
+    }
+
+    const auto pixels = atlas.texture(page).pixel_bytes(0);
+    Graphics::TextureLoom::instance().upload_regions(image, pixels.data(), regions);
+
+    atlas.clear_dirty(page);
+    return true;
+}
+
 } // namespace MayaFlux::Portal::Text
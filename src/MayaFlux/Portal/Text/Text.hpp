@@ -4,6 +4,7 @@
 
 namespace MayaFlux::Core {
 struct TextConfig;
+class VKImage;
 }
 
 namespace MayaFlux::Portal::Text {
@@ -95,4 +96,20 @@ MAYAFLUX_API bool set_default_font(
  */
 MAYAFLUX_API GlyphAtlas& get_default_atlas();
 
+/**
+ * @brief Upload the dirty regions of one atlas page to its GPU mirror.
+ *
+ * Uploads only the rectangles returned by GlyphAtlas::dirty_rects(), then
+ * clears that page's dirty state.  No-op when the page is clean.
+ *
+ * @param atlas  Source atlas.
+ * @param page   Page index, < atlas.page_count().
+ * @param image  R8 image of atlas_size x atlas_size mirroring the page.
+ * @return true if anything was uploaded.
+ */
+MAYAFLUX_API bool sync_atlas_page(
+    GlyphAtlas& atlas,
+    uint32_t page,
+    const std::shared_ptr<Core::VKImage>& image);
+
 } // namespace MayaFlux::Portal::Text
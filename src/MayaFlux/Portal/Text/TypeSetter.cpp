@@ -4,86 +4,246 @@
 
 #include <utf8proc.h>
 
+#include <bit>
+
 namespace MayaFlux::Portal::Text {
 
+namespace {
+
+    LayoutResult lay_out_pass(
+        std::string_view text,
+        GlyphAtlas& atlas,
+        float pen_x,
+        float pen_y,
+        uint32_t wrap_w,
+        float scale)
+    {
+        LayoutResult out;
+        out.quads.reserve(text.size());
+
+        const float origin_x = 0.F;
+        const float line_advance = static_cast<float>(atlas.line_height()) * scale;
+
+        const auto* bytes = reinterpret_cast<const utf8proc_uint8_t*>(text.data());
+        auto remaining = static_cast<utf8proc_ssize_t>(text.size());
+        utf8proc_ssize_t offset = 0;
+
+        while (offset < remaining) {
+            utf8proc_int32_t codepoint = 0;
+            const utf8proc_ssize_t n = utf8proc_iterate(bytes + offset, remaining - offset, &codepoint);
+
+            if (n <= 0) {
+                MF_WARN(Journal::Component::Portal, Journal::Context::API,
+                    "TypeSetter: invalid UTF-8 sequence at byte offset {}, skipping byte",
+                    static_cast<size_t>(offset));
+                offset += 1;
+                continue;
+            }
+
+            offset += n;
+
+            if (codepoint < 0) {
+                continue;
+            }
+
+            if (codepoint == '\n') {
+                pen_x = origin_x;
+                pen_y += line_advance;
+                continue;
+            }
+
+            if (codepoint == '\r') {
+                continue;
+            }
+
+            const GlyphMetrics* m = atlas.get_or_rasterize(static_cast<FT_ULong>(codepoint));
+            if (!m) {
+                continue;
+            }
+
+            if (m->width > 0 && m->height > 0) {
+                GlyphQuad q {};
+                q.x0 = pen_x + static_cast<float>(m->bearing_x) * scale;
+                q.y0 = pen_y - static_cast<float>(m->bearing_y) * scale;
+                q.x1 = q.x0 + static_cast<float>(m->width) * scale;
+                q.y1 = q.y0 + static_cast<float>(m->height) * scale;
+                q.uv_x0 = m->uv_x0;
+                q.uv_y0 = m->uv_y0;
+                q.uv_x1 = m->uv_x1;
+                q.codepoint = static_cast<uint32_t>(codepoint);
+                q.uv_y1 = m->uv_y1;
+                q.page = m->page;
+                out.quads.push_back(q);
+            }
+
+            pen_x += static_cast<float>(m->advance_x) * scale;
+
+            if (wrap_w > 0 && static_cast<uint32_t>(std::ceil(pen_x)) > wrap_w) {
+                pen_x = 0.F;
+                pen_y += line_advance;
+            }
+        }
+
+        out.final_pen_x = pen_x;
+        out.final_pen_y = pen_y;
+        return out;
+    }
+
+    uint64_t mix_hash(uint64_t h, uint64_t v)
+    {
+        h ^= v + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+        return h;
+    }
+
+    uint64_t float_bits(float f)
+    {
+        return std::bit_cast<uint32_t>(f);
+    }
+
+} // namespace
+
 LayoutResult lay_out(
     std::string_view text,
     GlyphAtlas& atlas,
     float pen_x,
     float pen_y,
-    uint32_t wrap_w)
+    uint32_t wrap_w,
+    float font_size)
 {
     if (text.empty()) {
         return { .quads = {}, .final_pen_x = pen_x, .final_pen_y = pen_y };
     }
 
-    LayoutResult out;
-    out.quads.reserve(text.size());
-
-    const float origin_x = 0.F;
+    const float scale = font_size > 0.F
+        ? font_size / static_cast<float>(atlas.pixel_size())
+        : 1.F;
 
-    const auto* bytes = reinterpret_cast<const utf8proc_uint8_t*>(text.data());
-    auto remaining = static_cast<utf8proc_ssize_t>(text.size());
-    utf8proc_ssize_t offset = 0;
+    const uint64_t generation = atlas.generation();
+    LayoutResult out = lay_out_pass(text, atlas, pen_x, pen_y, wrap_w, scale);
 
-    while (offset < remaining) {
-        utf8proc_int32_t codepoint = 0;
-        const utf8proc_ssize_t n = utf8proc_iterate(bytes + offset, remaining - offset, &codepoint);
+    if (atlas.generation() != generation) {
+        const uint64_t retry_generation = atlas.generation();
+        out = lay_out_pass(text, atlas, pen_x, pen_y, wrap_w, scale);
 
-        if (n <= 0) {
+        if (atlas.generation() != retry_generation) {
             MF_WARN(Journal::Component::Portal, Journal::Context::API,
-                "TypeSetter: invalid UTF-8 sequence at byte offset {}, skipping byte",
-                static_cast<size_t>(offset));
-            offset += 1;
-            continue;
+                "TypeSetter: run of {} bytes needs more glyphs than the atlas holds "
+                "(pixel_size={}, {} pages); some quads reference evicted glyphs",
+                text.size(), atlas.pixel_size(), atlas.page_count());
         }
+    }
 
-        offset += n;
+    return out;
+}
 
-        if (codepoint < 0) {
-            continue;
-        }
+// =========================================================================
+// LayoutCache
+// =========================================================================
 
-        if (codepoint == '\n') {
-            pen_x = origin_x;
-            pen_y += static_cast<float>(atlas.line_height());
-            continue;
-        }
+LayoutCache::LayoutCache(size_t capacity)
+    : m_capacity(std::max<size_t>(capacity, 1))
+{
+}
 
-        if (codepoint == '\r') {
-            continue;
+const LayoutResult& LayoutCache::lay_out(
+    std::string_view text,
+    GlyphAtlas& atlas,
+    float pen_x,
+    float pen_y,
+    uint32_t wrap_w,
+    float font_size)
+{
+    uint64_t hash = std::hash<std::string_view> {}(text);
+    hash = mix_hash(hash, atlas.id());
+    hash = mix_hash(hash, float_bits(pen_x));
+    hash = mix_hash(hash, float_bits(pen_y));
+    hash = mix_hash(hash, float_bits(font_size));
+    hash = mix_hash(hash, wrap_w);
+
+    if (auto found = m_index.find(hash); found != m_index.end()) {
+        const auto it = found->second;
+        const bool same = it->text == text
+            && it->atlas_id == atlas.id()
+            && it->pen_x == pen_x
+            && it->pen_y == pen_y
+            && it->font_size == font_size
+            && it->wrap_w == wrap_w;
+
+        if (same && it->generation == atlas.generation()) {
+            m_entries.splice(m_entries.begin(), m_entries, it);
+            for (uint32_t page : it->pages)
+                atlas.touch_page(page);
+            ++m_hits;
+            return it->result;
         }
 
-        const GlyphMetrics* m = atlas.get_or_rasterize(static_cast<FT_ULong>(codepoint));
-        if (!m) {
-            continue;
-        }
+        m_entries.erase(it);
+        m_index.erase(found);
+    }
 
-        if (m->width > 0 && m->height > 0) {
-            GlyphQuad q {};
-            q.x0 = pen_x + static_cast<float>(m->bearing_x);
-            q.y0 = pen_y - static_cast<float>(m->bearing_y);
-            q.x1 = q.x0 + static_cast<float>(m->width);
-            q.y1 = q.y0 + static_cast<float>(m->height);
-            q.uv_x0 = m->uv_x0;
-            q.uv_y0 = m->uv_y0;
-            q.uv_x1 = m->uv_x1;
-            q.codepoint = static_cast<uint32_t>(codepoint);
-            q.uv_y1 = m->uv_y1;
-            out.quads.push_back(q);
-        }
+    ++m_misses;
 
-        pen_x += static_cast<float>(m->advance_x);
+    LayoutResult result = Text::lay_out(text, atlas, pen_x, pen_y, wrap_w, font_size);
 
-        if (wrap_w > 0 && static_cast<uint32_t>(std::ceil(pen_x)) > wrap_w) {
-            pen_x = 0.F;
-            pen_y += static_cast<float>(atlas.line_height());
-        }
+    std::vector<uint32_t> pages;
+    for (const auto& q : result.quads) {
+        if (std::ranges::find(pages, q.page) == pages.end())
+            pages.push_back(q.page);
     }
 
-    out.final_pen_x = pen_x;
-    out.final_pen_y = pen_y;
-    return out;
+    m_entries.push_front(Entry {
+        .hash = hash,
+        .text = std::string(text),
+        .atlas_id = atlas.id(),
+        .generation = atlas.generation(),
+        .pen_x = pen_x,
+        .pen_y = pen_y,
+        .font_size = font_size,
+        .wrap_w = wrap_w,
+        .result = std::move(result),
+        .pages = std::move(pages),
+    });
+    m_index[hash] = m_entries.begin();
+
+    trim();
+    return m_entries.front().result;
+}
+
+void LayoutCache::clear()
+{
+    m_entries.clear();
+    m_index.clear();
+}
+
+void LayoutCache::set_capacity(size_t capacity)
+{
+    m_capacity = std::max<size_t>(capacity, 1);
+    trim();
+}
+
+void LayoutCache::trim()
+{
+    while (m_entries.size() > m_capacity) {
+        m_index.erase(m_entries.back().hash);
+        m_entries.pop_back();
+    }
+}
+
+LayoutCache& thread_layout_cache()
+{
+    thread_local LayoutCache cache;
+    return cache;
+}
+
+LayoutResult lay_out_cached(
+    std::string_view text,
+    GlyphAtlas& atlas,
+    float pen_x,
+    float pen_y,
+    uint32_t wrap_w,
+    float font_size)
+{
+    return thread_layout_cache().lay_out(text, atlas, pen_x, pen_y, wrap_w, font_size);
 }
 
 } // namespace MayaFlux::Portal::Text
@@ -12,8 +12,8 @@ namespace MayaFlux::Portal::Text {
  * lay_out().  The caller is responsible for converting to NDC or whatever
  * coordinate system the render path expects.
  *
- * UV coordinates are in normalised [0, 1] atlas space, matching the values
- * stored in GlyphMetrics.
+ * UV coordinates are in normalised [0, 1] space of atlas page @c page,
+ * matching the values stored in GlyphMetrics.
  */
 struct GlyphQuad {
     float x0, y0; ///< Top-left pixel position.
@@ -21,6 +21,7 @@ struct GlyphQuad {
     float uv_x0, uv_y0; ///< Top-left UV in atlas space.
     float uv_x1, uv_y1; ///< Bottom-right UV in atlas space.
     uint32_t codepoint { 0 }; ///< Unicode codepoint that produced this quad.
+    uint32_t page { 0 }; ///< Atlas page the UVs refer to.
 };
 
 /**
@@ -53,13 +54,105 @@ struct LayoutResult {
  *               set) if new glyphs are rasterized.
  * @param pen_x  Starting horizontal pen position in pixels.
  * @param pen_y  Starting vertical pen position in pixels (baseline).
+ * @param wrap_w Wrap boundary in pixels. Zero disables wrapping.
+ * @param font_size Display size in pixels. Zero uses atlas.pixel_size();
+ *               any other value scales all metrics, which is lossless for
+ *               an SDF atlas and blurs or aliases a coverage atlas.
  * @return       LayoutResult containing quads and final pen position.
+ *
+ * If rasterizing a glyph evicts an atlas page part-way through, quads laid
+ * out earlier may reference the evicted page; the run is laid out once more
+ * so that every quad refers to resident glyphs.
  */
 [[nodiscard]] LayoutResult lay_out(
     std::string_view text,
     GlyphAtlas& atlas,
     float pen_x = 0.F,
     float pen_y = 0.F,
-    uint32_t wrap_w = 0);
+    uint32_t wrap_w = 0,
+    float font_size = 0.F);
+
+/**
+ * @class LayoutCache
+ * @brief LRU cache of lay_out() results keyed by string, atlas and placement.
+ *
+ * Re-laying out unchanged text every frame costs a UTF-8 decode and a hash
+ * lookup per codepoint.  The cache stores whole runs keyed by (text, atlas
+ * id, font size, pen origin, wrap width).  An entry is only reused while the
+ * atlas generation it was built under is current; any page eviction makes
+ * every cached run for that atlas miss once.  Each entry remembers the atlas
+ * pages its quads sample, and a hit touches those pages so that text drawn
+ * every frame keeps its glyphs resident.
+ *
+ * Not thread-safe.  lay_out_cached() uses a thread-local instance.
+ */
+class MAYAFLUX_API LayoutCache {
+public:
+    explicit LayoutCache(size_t capacity = 256);
+
+    /**
+     * @brief Return the cached layout for these arguments, computing it on a miss.
+     *
+     * The reference stays valid until the next call that inserts into or
+     * clears this cache.
+     */
+    const LayoutResult& lay_out(
+        std::string_view text,
+        GlyphAtlas& atlas,
+        float pen_x = 0.F,
+        float pen_y = 0.F,
+        uint32_t wrap_w = 0,
+        float font_size = 0.F);
+
+    void clear();
+
+    /// @brief Change the entry limit, dropping least recently used runs if needed.
+    void set_capacity(size_t capacity);
+
+    [[nodiscard]] size_t capacity() const { return m_capacity; }
+    [[nodiscard]] size_t size() const { return m_entries.size(); }
+    [[nodiscard]] uint64_t hits() const { return m_hits; }
+    [[nodiscard]] uint64_t misses() const { return m_misses; }
+
+private:
+    struct Entry {
+        uint64_t hash;
+        std::string text;
+        uint64_t atlas_id;
+        uint64_t generation;
+        float pen_x;
+        float pen_y;
+        float font_size;
+        uint32_t wrap_w;
+        LayoutResult result;
+        std::vector<uint32_t> pages; ///< Distinct atlas pages referenced by result.
+    };
+
+    std::list<Entry> m_entries; ///< Most recently used first.
+    std::unordered_map<uint64_t, std::list<Entry>::iterator> m_index;
+    size_t m_capacity;
+    uint64_t m_hits { 0 };
+    uint64_t m_misses { 0 };
+
+    void trim();
+};
+
+/**
+ * @brief lay_out() through a thread-local LayoutCache.
+ *
+ * Returns a copy so callers may mutate the quads freely.
+ */
+[[nodiscard]] MAYAFLUX_API LayoutResult lay_out_cached(
+    std::string_view text,
+    GlyphAtlas& atlas,
+    float pen_x = 0.F,
+    float pen_y = 0.F,
+    uint32_t wrap_w = 0,
+    float font_size = 0.F);
+
+/**
+ * @brief The thread-local LayoutCache used by lay_out_cached().
+ */
+MAYAFLUX_API LayoutCache& thread_layout_cache();
 
 } // namespace MayaFlux::Portal::Text
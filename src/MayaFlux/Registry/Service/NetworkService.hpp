@@ -93,10 +93,21 @@ struct MAYAFLUX_API NetworkService {
      * @return true if the send was accepted.
      *
      * For UDP: non-blocking sendto().
-     * For TCP: may block briefly if kernel send buffer is full.
+     * For TCP: queued and written by the io thread; false when the
+     * connection's send queue is over TCPBackendInfo::send_queue_limit.
      */
     std::function<bool(uint64_t endpoint_id, const uint8_t* data, size_t size)> send;
 
+    /**
+     * @brief Bytes accepted by send() but not yet written to the socket
+     * @param endpoint_id Endpoint to query.
+     * @return Queued bytes for TCP connections, 0 for everything else.
+     *
+     * Producers that stream faster than the peer reads can poll this to
+     * throttle themselves before send() starts refusing.
+     */
+    std::function<size_t(uint64_t endpoint_id)> get_send_queue_bytes;
+
     /**
      * @brief Send data to a specific address through an endpoint
      * @param endpoint_id Source endpoint.
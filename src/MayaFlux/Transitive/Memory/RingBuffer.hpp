@@ -1222,7 +1222,9 @@ private:
         if (!m_state.ready_flags[slot].load(std::memory_order_acquire))
             return std::nullopt;
 
-        T value = m_storage.buffer[slot];
+        // Move out so owning payloads are released by the consumer, not
+        // left in the slot until a producer overwrites it.
+        T value = std::move(m_storage.buffer[slot]);
 
         m_state.ready_flags[slot].store(false, std::memory_order_release);
         m_state.read_index.store(State::increment(slot, cap), std::memory_order_release);
@@ -0,0 +1,194 @@
+#pragma once
+
+namespace MayaFlux::Memory {
+
+/**
+ * @class SnapshotCell
+ * @brief Single-writer, multi-reader publication of immutable snapshots (RCU).
+ *
+ * The writer builds a complete new T off to the side and publishes it with
+ * one atomic pointer swap. Readers pin the current snapshot with read() and
+ * iterate it freely; they never block, spin or retry, and the writer never
+ * waits for them either.
+ *
+ * Replaced snapshots are retired and reclaimed later, once every read
+ * section that could still see them has ended. Grace periods are detected
+ * with two reader counters and an epoch flip per phase (the sleepable-RCU
+ * scheme), progressed opportunistically by publish() and reclaim() on the
+ * writer side. Reclamation therefore always runs on the writer thread.
+ *
+ * Writers must be serialized externally (a mutex on the control path is
+ * fine; readers never touch it).
+ *
+ * Usage — writer side:
+ * @code
+ * auto next = std::make_unique<List>(*cell.writer_view());
+ * next->push_back(item);
+ * cell.publish(std::move(next));
+ * @endcode
+ *
+ * Usage — reader side:
+ * @code
+ * auto snapshot = cell.read();
+ * for (auto* item : snapshot->items) { ... }
+ * @endcode
+ */
+template <typename T>
+class SnapshotCell {
+public:
+    /**
+     * @class ReadGuard
+     * @brief Pins one snapshot for the lifetime of the guard.
+     */
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const SnapshotCell& cell) noexcept
+            : m_cell(&cell)
+            , m_slot(cell.enter())
+            , m_value(cell.m_current.load(std::memory_order_seq_cst))
+        {
+        }
+
+        ~ReadGuard()
+        {
+            if (m_cell)
+                m_cell->leave(m_slot);
+        }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        ReadGuard(ReadGuard&& other) noexcept
+            : m_cell(std::exchange(other.m_cell, nullptr))
+            , m_slot(other.m_slot)
+            , m_value(other.m_value)
+        {
+        }
+        ReadGuard& operator=(ReadGuard&&) = delete;
+
+        [[nodiscard]] const T* get() const noexcept { return m_value; }
+        const T* operator->() const noexcept { return m_value; }
+        const T& operator*() const noexcept { return *m_value; }
+        explicit operator bool() const noexcept { return m_value != nullptr; }
+
+    private:
+        const SnapshotCell* m_cell;
+        uint32_t m_slot;
+        const T* m_value;
+    };
+
+    SnapshotCell() = default;
+
+    explicit SnapshotCell(std::unique_ptr<T> initial)
+        : m_current(initial.release())
+    {
+    }
+
+    /// Readers must have finished before destruction.
+    ~SnapshotCell()
+    {
+        delete m_current.load(std::memory_order_acquire);
+    }
+
+    SnapshotCell(const SnapshotCell&) = delete;
+    SnapshotCell& operator=(const SnapshotCell&) = delete;
+    SnapshotCell(SnapshotCell&&) = delete;
+    SnapshotCell& operator=(SnapshotCell&&) = delete;
+
+    /**
+     * @brief Pin the current snapshot. Wait-free.
+     */
+    [[nodiscard]] ReadGuard read() const noexcept { return ReadGuard(*this); }
+
+    /**
+     * @brief Current snapshot, for the writer thread only.
+     *
+     * Valid until the writer's next publish() or reclaim(). Other threads
+     * must use read().
+     */
+    [[nodiscard]] const T* writer_view() const noexcept
+    {
+        return m_current.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Replace the current snapshot and retire the previous one.
+     * @param next New snapshot; ownership passes to the cell.
+     */
+    void publish(std::unique_ptr<T> next)
+    {
+        T* previous = m_current.exchange(next.release(), std::memory_order_seq_cst);
+        if (previous)
+            m_retired.emplace_back(previous);
+        reclaim();
+    }
+
+    /**
+     * @brief Advance the grace period and free snapshots no reader can see.
+     * @return Number of retired snapshots still awaiting reclamation.
+     *
+     * Never waits. Called by publish(); call it periodically from the
+     * writer thread if publications are rare and memory must be returned.
+     */
+    size_t reclaim()
+    {
+        for (;;) {
+            if (m_phase == 0) {
+                if (m_retired.empty())
+                    return 0;
+                m_waiting = std::move(m_retired);
+                m_retired.clear();
+                m_wait_slot = flip();
+                m_phase = 1;
+            }
+
+            if (m_readers[m_wait_slot].count.load(std::memory_order_seq_cst) != 0)
+                return pending();
+
+            if (m_phase == 1) {
+                m_wait_slot = flip();
+                m_phase = 2;
+                continue;
+            }
+
+            m_waiting.clear();
+            m_phase = 0;
+        }
+    }
+
+    /// @brief Retired snapshots not yet reclaimed.
+    [[nodiscard]] size_t pending() const noexcept { return m_retired.size() + m_waiting.size(); }
+
+private:
+    struct alignas(64) ReaderCount {
+        std::atomic<uint32_t> count { 0 };
+    };
+
+    std::atomic<T*> m_current { nullptr };
+    mutable std::atomic<uint32_t> m_epoch { 0 };
+    mutable std::array<ReaderCount, 2> m_readers {};
+
+    std::vector<std::unique_ptr<T>> m_retired; ///< Not yet covered by a grace period
+    std::vector<std::unique_ptr<T>> m_waiting; ///< Inside the current grace period
+    uint32_t m_phase {};
+    uint32_t m_wait_slot {};
+
+    uint32_t enter() const noexcept
+    {
+        const uint32_t slot = m_epoch.load(std::memory_order_seq_cst) & 1U;
+        m_readers[slot].count.fetch_add(1, std::memory_order_seq_cst);
+        return slot;
+    }
+
+    void leave(uint32_t slot) const noexcept
+    {
+        m_readers[slot].count.fetch_sub(1, std::memory_order_release);
+    }
+
+    /// Direct new readers to the other counter; returns the one to drain.
+    uint32_t flip() noexcept
+    {
+        return m_epoch.fetch_add(1, std::memory_order_seq_cst) & 1U;
+    }
+};
+
+} // namespace MayaFlux::Memory
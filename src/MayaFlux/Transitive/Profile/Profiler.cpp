@@ -0,0 +1,456 @@
+#include "Profiler.hpp"
+
+#include "MayaFlux/Transitive/Reflect/EnumReflect.hpp"
+#include "MayaFlux/Transitive/Reflect/TypeInfo.hpp"
+
+#include <nlohmann/json.hpp>
+
+#include <format>
+#include <fstream>
+
+namespace MayaFlux::Profile {
+
+namespace {
+
+    /**
+     * Log-linear histogram over unsigned integers: exact below 16, then 8
+     * sub-buckets per octave up to 2^48.
+     */
+    class Histogram {
+    public:
+        static constexpr uint32_t LINEAR = 16;
+        static constexpr uint32_t SUB_BITS = 3;
+        static constexpr uint32_t SUB = 1U << SUB_BITS;
+        static constexpr uint32_t OCTAVES = 44;
+        static constexpr uint32_t BUCKETS = LINEAR + OCTAVES * SUB;
+
+        void add(uint64_t value) noexcept
+        {
+            ++m_counts[index(value)];
+            ++m_total;
+        }
+
+        [[nodiscard]] double quantile(double q, uint64_t max) const noexcept
+        {
+            if (m_total == 0) {
+                return 0.0;
+            }
+            const auto target = static_cast<uint64_t>(std::ceil(q * static_cast<double>(m_total)));
+            uint64_t seen = 0;
+            for (uint32_t b = 0; b < BUCKETS; ++b) {
+                seen += m_counts[b];
+                if (seen >= std::max<uint64_t>(target, 1)) {
+                    return std::min(midpoint(b), static_cast<double>(max));
+                }
+            }
+            return static_cast<double>(max);
+        }
+
+    private:
+        std::array<uint64_t, BUCKETS> m_counts {};
+        uint64_t m_total {};
+
+        static uint32_t index(uint64_t v) noexcept
+        {
+            if (v < LINEAR) {
+                return static_cast<uint32_t>(v);
+            }
+            const auto octave = static_cast<uint32_t>(std::bit_width(v)) - 1;
+            const auto sub = static_cast<uint32_t>(v >> (octave - SUB_BITS)) & (SUB - 1);
+            return std::min(LINEAR + (octave - 4) * SUB + sub, BUCKETS - 1);
+        }
+
+        static double midpoint(uint32_t b) noexcept
+        {
+            if (b < LINEAR) {
+                return static_cast<double>(b);
+            }
+            const uint32_t octave = (b - LINEAR) / SUB + 4;
+            const uint32_t sub = (b - LINEAR) % SUB;
+            const double width = std::ldexp(1.0, static_cast<int>(octave - SUB_BITS));
+            return std::ldexp(1.0, static_cast<int>(octave)) + (sub + 0.5) * width;
+        }
+    };
+
+    std::string category_name(Category category)
+    {
+        return Reflect::enum_to_lowercase_string(category);
+    }
+
+} // namespace
+
+struct Profiler::Series {
+    Category category {};
+    const void* subject {};
+    const char* label {};
+    const std::type_info* type {};
+    std::string name;
+
+    uint64_t count {};
+    uint64_t total_ns {};
+    uint64_t max_ns {};
+    Histogram durations;
+
+    uint32_t deadline_ns {};
+    uint64_t max_load_permille {};
+    uint64_t overruns {};
+    Histogram loads; ///< Per-mille of deadline
+};
+
+Profiler& Profiler::instance()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler()
+    : m_origin_ticks(now())
+    , m_origin_time(std::chrono::steady_clock::now())
+{
+}
+
+Profiler::~Profiler()
+{
+    s_active.store(false, std::memory_order_relaxed);
+    stop_worker();
+}
+
+void Profiler::enable(const Config& config)
+{
+    stop_worker();
+
+    {
+        std::lock_guard lock(m_stats_mutex);
+        m_trace_capacity = std::max<size_t>(config.trace_capacity, 1);
+        if (m_trace.size() > m_trace_capacity) {
+            m_trace.clear();
+            m_trace_head = 0;
+        }
+    }
+
+    s_sample_stride.store(std::max<uint32_t>(config.sample_stride, 1), std::memory_order_relaxed);
+    m_drain_interval = config.drain_interval;
+
+    {
+        std::lock_guard lock(m_worker_mutex);
+        m_stop_worker = false;
+    }
+    m_worker = std::thread([this] {
+        std::unique_lock lock(m_worker_mutex);
+        while (!m_stop_worker) {
+            m_worker_cv.wait_for(lock, m_drain_interval, [this] { return m_stop_worker; });
+            lock.unlock();
+            drain();
+            lock.lock();
+        }
+    });
+
+    s_active.store(true, std::memory_order_release);
+}
+
+void Profiler::disable()
+{
+    s_active.store(false, std::memory_order_release);
+    stop_worker();
+    drain();
+}
+
+void Profiler::stop_worker()
+{
+    {
+        std::lock_guard lock(m_worker_mutex);
+        m_stop_worker = true;
+    }
+    m_worker_cv.notify_all();
+    if (m_worker.joinable()) {
+        m_worker.join();
+    }
+}
+
+void Profiler::reset()
+{
+    std::lock_guard lock(m_stats_mutex);
+    drain_locked();
+
+    m_series.clear();
+    m_series_by_subject.clear();
+    m_trace.clear();
+    m_trace_head = 0;
+
+    std::lock_guard rings_lock(m_rings_mutex);
+    m_dropped_base = 0;
+    for (const auto& ring : m_rings) {
+        m_dropped_base += ring->dropped.load(std::memory_order_relaxed);
+    }
+}
+
+Profiler::ThreadRing* Profiler::thread_ring()
+{
+    thread_local ThreadRing* ring = nullptr;
+    if (!ring) {
+        std::lock_guard lock(m_rings_mutex);
+        auto owned = std::make_unique<ThreadRing>();
+        owned->index = static_cast<uint32_t>(m_rings.size());
+        ring = owned.get();
+        m_rings.push_back(std::move(owned));
+    }
+    return ring;
+}
+
+void Profiler::record(const Event& event) noexcept
+{
+    auto* ring = thread_ring();
+    if (!ring->events.push(event)) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void Profiler::name_thread(std::string name)
+{
+    auto* ring = thread_ring();
+    std::lock_guard lock(m_rings_mutex);
+    ring->name = std::move(name);
+}
+
+double Profiler::ns_per_tick_locked()
+{
+#ifdef MAYAFLUX_ARCH_X64
+    const uint64_t ticks = now() - m_origin_ticks;
+    const auto elapsed = std::chrono::duration<double, std::nano>(
+        std::chrono::steady_clock::now() - m_origin_time)
+                             .count();
+    // Refine the TSC rate once enough wall time has passed to make it precise.
+    if (ticks > 0 && elapsed > 1e6) {
+        m_ns_per_tick = elapsed / static_cast<double>(ticks);
+    }
+#endif
+    return m_ns_per_tick;
+}
+
+void Profiler::drain()
+{
+    std::lock_guard lock(m_stats_mutex);
+    drain_locked();
+}
+
+void Profiler::drain_locked()
+{
+    std::vector<ThreadRing*> rings;
+    {
+        std::lock_guard lock(m_rings_mutex);
+        rings.reserve(m_rings.size());
+        for (const auto& ring : m_rings) {
+            rings.push_back(ring.get());
+        }
+    }
+
+    const double ns_per_tick = ns_per_tick_locked();
+
+    for (auto* ring : rings) {
+        while (auto event = ring->events.pop()) {
+            auto& bucket = m_series_by_subject[event->subject];
+            auto it = std::ranges::find_if(bucket, [&](const Series* s) {
+                return s->category == event->category && s->label == event->label && s->type == event->type;
+            });
+
+            Series* series = nullptr;
+            if (it == bucket.end()) {
+                auto owned = std::make_unique<Series>();
+                owned->category = event->category;
+                owned->subject = event->subject;
+                owned->label = event->label;
+                owned->type = event->type;
+                owned->name = event->label
+                    ? std::string(event->label)
+                    : std::string(Reflect::detail::strip_namespaces(Reflect::demangled_name(*event->type)));
+                series = owned.get();
+                bucket.push_back(series);
+                m_series.push_back(std::move(owned));
+            } else {
+                series = *it;
+            }
+
+            const auto ticks = event->end >= event->begin ? event->end - event->begin : 0;
+            const auto ns = static_cast<uint64_t>(static_cast<double>(ticks) * ns_per_tick);
+
+            series->count++;
+            series->total_ns += ns;
+            series->max_ns = std::max(series->max_ns, ns);
+            series->durations.add(ns);
+
+            if (event->deadline_ns != 0) {
+                series->deadline_ns = event->deadline_ns;
+                const uint64_t permille = ns * 1000 / event->deadline_ns;
+                series->loads.add(permille);
+                series->max_load_permille = std::max(series->max_load_permille, permille);
+                if (ns > event->deadline_ns) {
+                    series->overruns++;
+                }
+            }
+
+            TraceEvent trace { .event = *event, .thread = ring->index };
+            if (m_trace.size() < m_trace_capacity) {
+                m_trace.push_back(trace);
+            } else {
+                m_trace[m_trace_head] = trace;
+                m_trace_head = (m_trace_head + 1) % m_trace_capacity;
+            }
+        }
+    }
+}
+
+std::vector<ZoneStats> Profiler::summary()
+{
+    std::lock_guard lock(m_stats_mutex);
+    drain_locked();
+
+    std::vector<ZoneStats> result;
+    result.reserve(m_series.size());
+
+    for (const auto& s : m_series) {
+        ZoneStats z;
+        z.name = s->name;
+        z.category = s->category;
+        z.subject = s->subject;
+        z.count = s->count;
+        z.total_ns = static_cast<double>(s->total_ns);
+        z.mean_ns = s->count ? z.total_ns / static_cast<double>(s->count) : 0.0;
+        z.p50_ns = s->durations.quantile(0.50, s->max_ns);
+        z.p95_ns = s->durations.quantile(0.95, s->max_ns);
+        z.p99_ns = s->durations.quantile(0.99, s->max_ns);
+        z.max_ns = static_cast<double>(s->max_ns);
+
+        if (s->deadline_ns != 0 && s->count != 0) {
+            z.deadline_ns = s->deadline_ns;
+            z.mean_load = z.mean_ns / s->deadline_ns;
+            z.p99_load = s->loads.quantile(0.99, s->max_load_permille) / 1000.0;
+            z.peak_load = static_cast<double>(s->max_load_permille) / 1000.0;
+            z.overruns = s->overruns;
+        }
+        result.push_back(std::move(z));
+    }
+
+    std::ranges::sort(result, std::greater {}, &ZoneStats::total_ns);
+    return result;
+}
+
+std::string Profiler::report_json(size_t top)
+{
+    auto stats = summary();
+    if (top != 0 && stats.size() > top) {
+        stats.resize(top);
+    }
+
+    nlohmann::json zones = nlohmann::json::array();
+    for (const auto& z : stats) {
+        nlohmann::json zone {
+            { "name", z.name },
+            { "category", category_name(z.category) },
+            { "subject", std::format("{}", z.subject) },
+            { "count", z.count },
+            { "total_ms", z.total_ns * 1e-6 },
+            { "mean_us", z.mean_ns * 1e-3 },
+            { "p50_us", z.p50_ns * 1e-3 },
+            { "p95_us", z.p95_ns * 1e-3 },
+            { "p99_us", z.p99_ns * 1e-3 },
+            { "max_us", z.max_ns * 1e-3 },
+        };
+        if (z.deadline_ns != 0) {
+            zone["deadline_us"] = z.deadline_ns * 1e-3;
+            zone["load_mean"] = z.mean_load;
+            zone["load_p99"] = z.p99_load;
+            zone["load_peak"] = z.peak_load;
+            zone["overruns"] = z.overruns;
+        }
+        zones.push_back(std::move(zone));
+    }
+
+    nlohmann::json report {
+        { "enabled", active() },
+        { "sample_stride", s_sample_stride.load(std::memory_order_relaxed) },
+        { "dropped_events", dropped_events() },
+        { "zones", std::move(zones) },
+    };
+    return report.dump();
+}
+
+std::string Profiler::chrome_trace_json()
+{
+    std::lock_guard lock(m_stats_mutex);
+    drain_locked();
+
+    const double us_per_tick = ns_per_tick_locked() * 1e-3;
+    nlohmann::json events = nlohmann::json::array();
+
+    {
+        std::lock_guard rings_lock(m_rings_mutex);
+        for (const auto& ring : m_rings) {
+            events.push_back({
+                { "name", "thread_name" },
+                { "ph", "M" },
+                { "pid", 1 },
+                { "tid", ring->index },
+                { "args", { { "name", ring->name.empty() ? std::format("thread {}", ring->index) : ring->name } } },
+            });
+        }
+    }
+
+    std::unordered_map<const std::type_info*, std::string> type_names;
+    const size_t n = m_trace.size();
+    for (size_t i = 0; i < n; ++i) {
+        const auto& [event, thread] = m_trace[(m_trace_head + i) % n];
+
+        std::string name;
+        if (event.label) {
+            name = event.label;
+        } else {
+            auto [it, inserted] = type_names.try_emplace(event.type);
+            if (inserted) {
+                it->second = std::string(Reflect::detail::strip_namespaces(Reflect::demangled_name(*event.type)));
+            }
+            name = it->second;
+        }
+
+        const auto begin = static_cast<double>(static_cast<int64_t>(event.begin - m_origin_ticks)) * us_per_tick;
+        const auto duration = static_cast<double>(event.end - event.begin) * us_per_tick;
+
+        events.push_back({
+            { "name", std::move(name) },
+            { "cat", category_name(event.category) },
+            { "ph", "X" },
+            { "ts", begin },
+            { "dur", duration },
+            { "pid", 1 },
+            { "tid", thread },
+            { "args", { { "subject", std::format("{}", event.subject) } } },
+        });
+    }
+
+    nlohmann::json trace {
+        { "traceEvents", std::move(events) },
+        { "displayTimeUnit", "ns" },
+    };
+    return trace.dump();
+}
+
+bool Profiler::export_chrome_trace(const std::filesystem::path& path)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    out << chrome_trace_json();
+    return static_cast<bool>(out);
+}
+
+uint64_t Profiler::dropped_events() const
+{
+    std::lock_guard lock(m_rings_mutex);
+    uint64_t total = 0;
+    for (const auto& ring : m_rings) {
+        total += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return total - m_dropped_base;
+}
+
+} // namespace MayaFlux::Profile
@@ -0,0 +1,299 @@
+#pragma once
+
+#include "MayaFlux/Transitive/Memory/RingBuffer.hpp"
+
+#include <condition_variable>
+
+#ifdef MAYAFLUX_ARCH_X64
+#include <immintrin.h>
+#endif
+
+namespace MayaFlux::Profile {
+
+/**
+ * @enum Category
+ * @brief What a timed zone measures; used for grouping and trace colouring.
+ */
+enum class Category : uint8_t {
+    CYCLE, ///< A whole device or frame callback, usually with a deadline
+    NODE, ///< A single node inside a RootNode cycle
+    NETWORK, ///< A NodeNetwork batch
+    BUFFER_PROCESSOR, ///< One BufferProcessor in a processing chain
+    SCHEDULER, ///< A TaskScheduler token pass
+    CUSTOM ///< User zones
+};
+
+/**
+ * @struct Event
+ * @brief One completed zone as written to a per-thread ring.
+ *
+ * Trivially copyable and allocation-free. Exactly one of @c label or
+ * @c type names the zone; names are resolved off-thread during aggregation.
+ */
+struct Event {
+    uint64_t begin; ///< Profiler ticks
+    uint64_t end; ///< Profiler ticks
+    const void* subject; ///< Identity of the measured object, may be null
+    const char* label; ///< Static, null-terminated name, or null
+    const std::type_info* type; ///< Dynamic type used when @c label is null
+    uint32_t deadline_ns; ///< Budget for this zone; 0 when none applies
+    Category category;
+};
+
+/**
+ * @struct Config
+ * @brief Runtime profiling options.
+ */
+struct Config {
+    /// Zones that run once per sample (nodes) record one in this many samples.
+    uint32_t sample_stride { 32 };
+
+    /// How often the background aggregator drains the per-thread rings.
+    std::chrono::milliseconds drain_interval { 20 };
+
+    /// Most recent events retained for Chrome trace export.
+    size_t trace_capacity { 1U << 16 };
+};
+
+/**
+ * @struct ZoneStats
+ * @brief Aggregated timing of one zone (one category, subject and name).
+ *
+ * Percentiles come from a log-linear histogram with 8 sub-buckets per
+ * octave, so they are accurate to roughly 12%.
+ */
+struct ZoneStats {
+    std::string name;
+    Category category {};
+    const void* subject {};
+
+    uint64_t count {};
+    double total_ns {};
+    double mean_ns {};
+    double p50_ns {};
+    double p95_ns {};
+    double p99_ns {};
+    double max_ns {};
+
+    /// Deadline-relative load, only meaningful when deadline_ns != 0.
+    uint32_t deadline_ns {};
+    double mean_load {};
+    double p99_load {};
+    double peak_load {};
+    uint64_t overruns {};
+};
+
+/**
+ * @class Profiler
+ * @brief Process-wide, runtime-switchable realtime profiler.
+ *
+ * Instrumented code opens a Zone; when profiling is disabled that costs one
+ * relaxed atomic load and a branch. When enabled, each zone takes two
+ * timestamps (TSC on x86-64, steady_clock elsewhere) and pushes one Event
+ * into a lock-free ring owned by the calling thread. Recording never locks
+ * or allocates, except for the ring itself on a thread's first event.
+ *
+ * A background thread drains the rings into per-zone histograms and a
+ * bounded trace window. Queries (summary(), report_json(),
+ * chrome_trace_json()) drain first, so results are always current.
+ *
+ * Lives in Transitive so the Lila server can query it directly.
+ */
+class MAYAFLUX_API Profiler {
+public:
+    static Profiler& instance();
+
+    ~Profiler();
+
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    Profiler& operator=(Profiler&&) = delete;
+
+    /**
+     * @brief Start recording and the background aggregator.
+     */
+    void enable(const Config& config = {});
+
+    /**
+     * @brief Stop recording; aggregated data is kept until reset().
+     */
+    void disable();
+
+    /**
+     * @brief Discard all aggregated statistics and trace events.
+     */
+    void reset();
+
+    /// @brief Hot-path check used by Zone.
+    [[nodiscard]] static bool active() noexcept { return s_active.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Decimation for per-sample zones.
+     * @param counter Caller-owned counter, advanced on every call while active
+     * @return True when this sample should be timed
+     */
+    [[nodiscard]] static bool sample_due(uint32_t& counter) noexcept
+    {
+        return active() && (counter++ % s_sample_stride.load(std::memory_order_relaxed)) == 0;
+    }
+
+    /// @brief Current timestamp in profiler ticks.
+    [[nodiscard]] static uint64_t now() noexcept
+    {
+#ifdef MAYAFLUX_ARCH_X64
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    /**
+     * @brief Push a completed event into the calling thread's ring.
+     *
+     * Events are dropped (and counted) if the ring is full.
+     */
+    void record(const Event& event) noexcept;
+
+    /**
+     * @brief Label the calling thread in trace output. Not for hot paths.
+     */
+    void name_thread(std::string name);
+
+    /**
+     * @brief Aggregate everything currently in the per-thread rings.
+     */
+    void drain();
+
+    /**
+     * @brief Per-zone statistics, sorted by total time descending.
+     */
+    [[nodiscard]] std::vector<ZoneStats> summary();
+
+    /**
+     * @brief Statistics as a JSON document.
+     * @param top Keep only the @p top most expensive zones; 0 keeps all
+     */
+    [[nodiscard]] std::string report_json(size_t top = 0);
+
+    /**
+     * @brief Retained events in Chrome trace-event format (chrome://tracing, Perfetto).
+     */
+    [[nodiscard]] std::string chrome_trace_json();
+
+    /**
+     * @brief Write chrome_trace_json() to @p path.
+     * @return False if the file could not be written
+     */
+    bool export_chrome_trace(const std::filesystem::path& path);
+
+    /// @brief Events lost to full rings since the last reset().
+    [[nodiscard]] uint64_t dropped_events() const;
+
+private:
+    Profiler();
+
+    static constexpr size_t RING_CAPACITY = 8192;
+
+    using EventRing = Memory::RingBuffer<Event, Memory::FixedStorage<Event, RING_CAPACITY>,
+        Memory::LockFreePolicy, Memory::QueueAccess>;
+
+    struct ThreadRing {
+        EventRing events;
+        std::atomic<uint64_t> dropped { 0 };
+        uint32_t index {};
+        std::string name;
+    };
+
+    struct Series;
+    struct TraceEvent {
+        Event event;
+        uint32_t thread;
+    };
+
+    ThreadRing* thread_ring();
+    void drain_locked();
+    [[nodiscard]] double ns_per_tick_locked();
+    void stop_worker();
+
+    inline static std::atomic<bool> s_active { false };
+    inline static std::atomic<uint32_t> s_sample_stride { 32 };
+
+    mutable std::mutex m_rings_mutex;
+    std::vector<std::unique_ptr<ThreadRing>> m_rings;
+
+    std::mutex m_stats_mutex;
+    std::vector<std::unique_ptr<Series>> m_series;
+    std::unordered_map<const void*, std::vector<Series*>> m_series_by_subject;
+    std::vector<TraceEvent> m_trace;
+    size_t m_trace_head {};
+    size_t m_trace_capacity { 1U << 16 };
+    uint64_t m_dropped_base {};
+
+    uint64_t m_origin_ticks {};
+    std::chrono::steady_clock::time_point m_origin_time;
+    double m_ns_per_tick { 1.0 };
+
+    std::mutex m_worker_mutex;
+    std::condition_variable m_worker_cv;
+    std::thread m_worker;
+    bool m_stop_worker {};
+    std::chrono::milliseconds m_drain_interval { 20 };
+};
+
+/**
+ * @class Zone
+ * @brief RAII timer recording one Event for its scope.
+ *
+ * @code
+ * Profile::Zone zone(Profile::Category::NODE, node, typeid(*node));
+ * node->process_sample();
+ * @endcode
+ */
+class Zone {
+public:
+    Zone(Category category, const void* subject, const char* label, uint32_t deadline_ns = 0) noexcept
+        : m_live(Profiler::active())
+    {
+        if (m_live) {
+            m_event.subject = subject;
+            m_event.label = label;
+            m_event.type = nullptr;
+            m_event.deadline_ns = deadline_ns;
+            m_event.category = category;
+            m_event.begin = Profiler::now();
+        }
+    }
+
+    Zone(Category category, const void* subject, const std::type_info& type) noexcept
+        : m_live(Profiler::active())
+    {
+        if (m_live) {
+            m_event.subject = subject;
+            m_event.label = nullptr;
+            m_event.type = &type;
+            m_event.deadline_ns = 0;
+            m_event.category = category;
+            m_event.begin = Profiler::now();
+        }
+    }
+
+    ~Zone()
+    {
+        if (m_live) {
+            m_event.end = Profiler::now();
+            Profiler::instance().record(m_event);
+        }
+    }
+
+    Zone(const Zone&) = delete;
+    Zone& operator=(const Zone&) = delete;
+    Zone(Zone&&) = delete;
+    Zone& operator=(Zone&&) = delete;
+
+private:
+    Event m_event;
+    bool m_live;
+};
+
+} // namespace MayaFlux::Profile
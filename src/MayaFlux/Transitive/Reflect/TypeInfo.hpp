@@ -63,18 +63,17 @@ template <typename T>
 }
 
 /**
- * @brief Returns the demangled fully qualified dynamic type name of @p obj.
+ * @brief Returns the demangled fully qualified name of @p type.
  *
  * Allocates once per call via abi::__cxa_demangle on GCC/Clang. On MSVC
- * typeid().name() is already human-readable. Intended for display and
+ * type_info::name() is already human-readable. Intended for display and
  * introspection paths, not hot loops.
  *
- * @param obj Any polymorphic object.
+ * @param type Any type_info, e.g. from typeid().
  */
-template <typename T>
-[[nodiscard]] inline std::string dynamic_type_name(const T& obj) noexcept
+[[nodiscard]] inline std::string demangled_name(const std::type_info& type) noexcept
 {
-    const char* mangled = typeid(obj).name();
+    const char* mangled = type.name();
 #if (defined(MAYAFLUX_COMPILER_CLANG) || defined(MAYAFLUX_COMPILER_GCC)) && !defined(MAYAFLUX_PLATFORM_WINDOWS)
     int status {};
     char* buf = abi::__cxa_demangle(mangled, nullptr, nullptr, &status);
@@ -86,6 +85,16 @@ template <typename T>
 #endif
 }
 
+/**
+ * @brief Returns the demangled fully qualified dynamic type name of @p obj.
+ * @param obj Any polymorphic object.
+ */
+template <typename T>
+[[nodiscard]] inline std::string dynamic_type_name(const T& obj) noexcept
+{
+    return demangled_name(typeid(obj));
+}
+
 /**
  * @brief Returns the unqualified dynamic type name of @p obj.
  * @param obj Any polymorphic object.
@@ -3,6 +3,8 @@
 #include "ChronUtils.hpp"
 
 #include "MayaFlux/Journal/Archivist.hpp"
+#include "MayaFlux/Transitive/Profile/Profiler.hpp"
+#include "MayaFlux/Transitive/Reflect/EnumReflect.hpp"
 
 namespace MayaFlux::Vruta {
 
@@ -216,6 +218,8 @@ const std::vector<TaskEntry>& TaskScheduler::get_all_tasks()
 
 void TaskScheduler::process_token(ProcessingToken token, uint64_t processing_units)
 {
+    Profile::Zone zone(Profile::Category::SCHEDULER, this, Reflect::enum_to_string(token).data());
+
     drain_pending_tasks();
 
     auto processor_it = m_token_processors.find(token);
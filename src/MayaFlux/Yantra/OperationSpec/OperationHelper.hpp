@@ -4,6 +4,7 @@
 #include "MayaFlux/Yantra/Data/DataIO.hpp"
 
 #include "MayaFlux/Kakshya/Utils/DataUtils.hpp"
+#include "MayaFlux/Kakshya/Utils/VariantView.hpp"
 
 namespace MayaFlux::Yantra {
 
@@ -65,22 +66,25 @@ public:
      * @tparam T ComputeData type
      * @param compute_data Input data
      * @return Span of double data
+     *
+     * The input's storage is never replaced. A DataVariant already holding
+     * double is aliased; anything else is converted into a copy held per
+     * thread, valid until the next call of the same overload on that thread.
      */
     template <typename T>
         requires SingleVariant<T>
     static std::span<double> extract_numeric_data(const T& compute_data)
     {
+        static thread_local std::vector<double> storage;
+
         if constexpr (std::is_same_v<T, Kakshya::DataVariant>) {
-            auto const_span = Kakshya::convert_variant<double>(compute_data);
-            return std::span<double>(const_cast<double*>(const_span.data()), const_span.size());
+            return view_doubles(compute_data, storage);
         }
         if constexpr (is_eigen_matrix_v<T>) {
-            Kakshya::DataVariant variant = create_data_variant_from_eigen(compute_data);
-            return Kakshya::convert_variant<double>(variant, s_complex_strategy);
+            return copy_doubles(create_data_variant_from_eigen(compute_data), storage);
         }
 
-        Kakshya::DataVariant variant { compute_data };
-        return Kakshya::convert_variant_to_double(variant, s_complex_strategy);
+        return copy_doubles(Kakshya::DataVariant { compute_data }, storage);
     }
 
     /**
@@ -88,13 +92,19 @@ public:
      * @tparam T ComputeData type
      * @param compute_data Input data
      * @return Vector of spans of double data (one per channel/variant)
+     *
+     * Variant storage is never replaced: channels already holding double are
+     * aliased, others are converted into copies held per thread, valid until
+     * the next call of the same overload on that thread.
      */
     template <typename T>
         requires(MultiVariant<T> || EigenMatrixLike<T>)
     static std::vector<std::span<double>> extract_numeric_data(const T& compute_data, bool needs_processig = false)
     {
+        static thread_local std::vector<std::vector<double>> storage;
+
         if constexpr (std::is_same_v<T, std::vector<Kakshya::DataVariant>>) {
-            return Kakshya::convert_variants<double>(compute_data, s_complex_strategy);
+            return view_doubles(compute_data, storage);
         }
 
         if constexpr (std::is_same_v<T, std::shared_ptr<Kakshya::SignalSourceContainer>>) {
@@ -103,11 +113,9 @@ public:
                     compute_data->process_default();
                     compute_data->update_processing_state(Kakshya::ProcessingState::PROCESSED);
                 }
-                std::vector<Kakshya::DataVariant> variant = compute_data->get_processed_data();
-                return Kakshya::convert_variants<double>(variant, s_complex_strategy);
+                return view_doubles(compute_data->get_processed_data(), storage);
             }
-            std::vector<Kakshya::DataVariant> variant = compute_data->get_data();
-            return Kakshya::convert_variants<double>(variant, s_complex_strategy);
+            return view_doubles(compute_data->get_data(), storage);
         }
 
         if constexpr (is_eigen_matrix_v<T>)
@@ -133,23 +141,22 @@ public:
             error<std::invalid_argument>(Journal::Component::Yantra, Journal::Context::ContainerProcessing, std::source_location::current(), "Null container provided for region extraction");
         }
 
+        static thread_local std::vector<std::vector<double>> storage;
+
         if constexpr (std::is_same_v<T, Kakshya::Region>) {
-            auto data = container->get_region_data(compute_data);
-            return Kakshya::convert_variants<double>(data);
+            return copy_doubles(container->get_region_data(compute_data), storage);
 
         } else if constexpr (std::is_same_v<T, Kakshya::RegionGroup>) {
             if (compute_data.regions.empty()) {
                 error<std::runtime_error>(Journal::Component::Yantra, Journal::Context::ContainerProcessing, std::source_location::current(), "Empty RegionGroup cannot be extracted");
             }
-            auto data = container->get_region_group_data(compute_data);
-            return Kakshya::convert_variants<double>(data);
+            return copy_doubles(container->get_region_group_data(compute_data), storage);
 
         } else if constexpr (std::is_same_v<T, std::vector<Kakshya::RegionSegment>>) {
             if (compute_data.empty()) {
                 error<std::runtime_error>(Journal::Component::Yantra, Journal::Context::ContainerProcessing, std::source_location::current(), "Empty RegionSegment vector cannot be extracted");
             }
-            auto data = container->get_segments_data(compute_data);
-            return Kakshya::convert_variants<double>(data);
+            return copy_doubles(container->get_segments_data(compute_data), storage);
         }
     }
 
@@ -557,6 +564,53 @@ private:
      * @param compute_data Input data
      * @return Pair of (dimensions, modality)
      */
+    /**
+     * @brief Read @p variant as double without replacing its storage
+     *
+     * Aliases the variant when it already holds double, otherwise converts
+     * into @p storage. Use copy_doubles() for temporaries.
+     */
+    static std::span<double> view_doubles(const Kakshya::DataVariant& variant, std::vector<double>& storage)
+    {
+        auto view = Kakshya::view_as<double>(variant, storage, s_complex_strategy);
+        return { const_cast<double*>(view.data()), view.size() };
+    }
+
+    /**
+     * @brief Convert a copy of @p variant into @p storage
+     */
+    static std::span<double> copy_doubles(const Kakshya::DataVariant& variant, std::vector<double>& storage)
+    {
+        Kakshya::convert_into<double>(variant, storage, s_complex_strategy);
+        return { storage.data(), storage.size() };
+    }
+
+    static std::vector<std::span<double>> view_doubles(
+        const std::vector<Kakshya::DataVariant>& variants,
+        std::vector<std::vector<double>>& storage)
+    {
+        storage.resize(variants.size());
+        std::vector<std::span<double>> spans;
+        spans.reserve(variants.size());
+        for (size_t i = 0; i < variants.size(); ++i) {
+            spans.push_back(view_doubles(variants[i], storage[i]));
+        }
+        return spans;
+    }
+
+    static std::vector<std::span<double>> copy_doubles(
+        const std::vector<Kakshya::DataVariant>& variants,
+        std::vector<std::vector<double>>& storage)
+    {
+        storage.resize(variants.size());
+        std::vector<std::span<double>> spans;
+        spans.reserve(variants.size());
+        for (size_t i = 0; i < variants.size(); ++i) {
+            spans.push_back(copy_doubles(variants[i], storage[i]));
+        }
+        return spans;
+    }
+
     template <typename EigenMatrix>
     static std::vector<std::span<double>> extract_from_eigen_matrix(const EigenMatrix& matrix)
     {
@@ -18,6 +18,7 @@
  *   -p, --port <port>     Server port (default: 9090)
  *   -v, --verbose         Enable verbose logging
  *   -l, --level <level>   Set log level (TRACE, DEBUG, INFO, WARN, ERROR, FATAL)
+ *   --build-cache         Write the interpreter prelude snapshot and exit
  *   -h, --help            Show help message
  */
 
@@ -58,6 +59,7 @@ void print_usage(const char* program_name)
               << "  -p, --port <port>     Server port (default: 9090)\n"
               << "  -v, --verbose         Enable verbose logging\n"
               << "  -l, --level <level>   Set log level (TRACE, DEBUG, INFO, WARN, ERROR, FATAL)\n"
+              << "  --build-cache         Write the interpreter prelude snapshot and exit\n"
               << "  -h, --help            Show this help message\n"
               << "\nExamples:\n"
               << "  " << program_name << "                    # Start on default port 9090\n"
@@ -101,6 +103,7 @@ int main(int argc, char** argv)
 {
     int port = 9090;
     bool verbose = false;
+    bool build_cache = false;
     Lila::LogLevel log_level = Lila::LogLevel::INFO;
 
     for (int i = 1; i < argc; ++i) {
@@ -124,6 +127,8 @@ int main(int argc, char** argv)
             }
         } else if (arg == "-v" || arg == "--verbose") {
             verbose = true;
+        } else if (arg == "--build-cache") {
+            build_cache = true;
         } else if (arg == "-l" || arg == "--level") {
             if (i + 1 < argc) {
                 log_level = parse_log_level(argv[++i]);
@@ -142,6 +147,16 @@ int main(int argc, char** argv)
     logger.set_level(log_level);
     logger.set_verbose(verbose);
 
+    if (build_cache) {
+        Lila::Lila builder;
+        if (!builder.build_prelude_snapshot()) {
+            LILA_FATAL(Lila::Emitter::SYSTEM,
+                std::string("Failed to build prelude snapshot: ") + builder.get_last_error());
+            return 1;
+        }
+        return 0;
+    }
+
     std::signal(SIGINT, signal_handler);
     std::signal(SIGTERM, signal_handler);
 
@@ -0,0 +1,192 @@
+#include "../test_config.h"
+
+#include "MayaFlux/Buffers/AudioBuffer.hpp"
+#include "MayaFlux/Buffers/BufferProcessingChain.hpp"
+#include "MayaFlux/Buffers/Node/LogicProcessor.hpp"
+#include "MayaFlux/Buffers/Node/PolynomialProcessor.hpp"
+#include "MayaFlux/Buffers/Root/GainProcessor.hpp"
+#include "MayaFlux/Nodes/Generators/Logic.hpp"
+#include "MayaFlux/Nodes/Generators/Polynomial.hpp"
+
+namespace MayaFlux::Test {
+
+namespace {
+    constexpr size_t k_samples = 1000; // Not a multiple of the fusion tile size
+
+    class OffsetProcessor : public Buffers::BufferProcessor {
+    public:
+        void processing_function(const std::shared_ptr<Buffers::Buffer>& buffer) override
+        {
+            for (auto& sample : std::dynamic_pointer_cast<Buffers::AudioBuffer>(buffer)->get_data()) {
+                sample += 0.25;
+            }
+        }
+    };
+
+    std::shared_ptr<Buffers::PolynomialProcessor> make_recursive()
+    {
+        auto node = std::make_shared<Nodes::Generator::Polynomial>(
+            [](std::span<double> history) {
+                return history[0] + (history.size() > 1 ? 0.5 * history[1] : 0.0);
+            },
+            Nodes::Generator::PolynomialMode::RECURSIVE, 2);
+        return std::make_shared<Buffers::PolynomialProcessor>(node);
+    }
+
+    std::shared_ptr<Buffers::LogicProcessor> make_gate()
+    {
+        auto logic = std::make_shared<Buffers::LogicProcessor>(0.3);
+        logic->set_modulation_type(Buffers::LogicProcessor::ModulationType::ZERO_ON_FALSE);
+        return logic;
+    }
+
+    std::vector<std::shared_ptr<Buffers::BufferProcessor>> make_pipeline()
+    {
+        return {
+            make_recursive(),
+            std::make_shared<Buffers::GainProcessor>(0.4),
+            make_gate(),
+            std::make_shared<OffsetProcessor>(),
+            std::make_shared<Buffers::GainProcessor>(2.0),
+            std::make_shared<Buffers::PolynomialProcessor>(
+                std::make_shared<Nodes::Generator::Polynomial>(std::vector<double> { 0.5, 1.0, 0.0 })),
+        };
+    }
+}
+
+class ProcessingChainTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        buffer = std::make_shared<Buffers::AudioBuffer>(0, TestConfig::BUFFER_SIZE);
+        reference = std::make_shared<Buffers::AudioBuffer>(1, TestConfig::BUFFER_SIZE);
+        buffer->resize(k_samples);
+        reference->resize(k_samples);
+    }
+
+    void fill(size_t cycle)
+    {
+        for (size_t i = 0; i < k_samples; ++i) {
+            const double value = std::sin(0.013 * static_cast<double>(cycle * k_samples + i));
+            buffer->get_data()[i] = value;
+            reference->get_data()[i] = value;
+        }
+    }
+
+    std::shared_ptr<Buffers::AudioBuffer> buffer;
+    std::shared_ptr<Buffers::AudioBuffer> reference;
+};
+
+TEST_F(ProcessingChainTest, FusedStagesMatchSequentialProcessing)
+{
+    auto chain = std::make_shared<Buffers::BufferProcessingChain>();
+    const auto fused = make_pipeline();
+    const auto sequential = make_pipeline();
+
+    for (const auto& processor : fused) {
+        ASSERT_TRUE(chain->add_processor(processor, buffer));
+    }
+    for (const auto& processor : sequential) {
+        processor->on_attach(reference);
+    }
+
+    // poly, gain, logic | offset | gain, poly
+    EXPECT_EQ(chain->get_fused_stage_count(buffer), 2U);
+
+    for (size_t cycle = 0; cycle < 4; ++cycle) {
+        fill(cycle);
+        chain->process(buffer);
+        for (const auto& processor : sequential) {
+            processor->process(reference);
+        }
+
+        for (size_t i = 0; i < k_samples; ++i) {
+            ASSERT_DOUBLE_EQ(buffer->get_data()[i], reference->get_data()[i]) << "cycle " << cycle << " sample " << i;
+        }
+    }
+
+    auto gate = std::dynamic_pointer_cast<Buffers::LogicProcessor>(fused[2]);
+    EXPECT_EQ(gate->get_logic_data().size(), k_samples);
+    EXPECT_TRUE(gate->has_generated_data());
+}
+
+TEST_F(ProcessingChainTest, NonElementwiseModesFallBackPerCycle)
+{
+    auto chain = std::make_shared<Buffers::BufferProcessingChain>();
+    auto poly = make_recursive();
+    auto gain = std::make_shared<Buffers::GainProcessor>(0.5);
+    chain->add_processor(poly, buffer);
+    chain->add_processor(gain, buffer);
+    EXPECT_EQ(chain->get_fused_stage_count(buffer), 1U);
+
+    auto ref_poly = make_recursive();
+    auto ref_gain = std::make_shared<Buffers::GainProcessor>(0.5);
+    ref_poly->set_process_mode(Buffers::PolynomialProcessor::ProcessMode::WINDOWED);
+    ref_poly->set_window_size(100);
+
+    // Switched after compilation: the stage must notice and run unfused.
+    poly->set_process_mode(Buffers::PolynomialProcessor::ProcessMode::WINDOWED);
+    poly->set_window_size(100);
+
+    fill(0);
+    chain->process(buffer);
+    ref_poly->process(reference);
+    ref_gain->process(reference);
+
+    for (size_t i = 0; i < k_samples; ++i) {
+        ASSERT_DOUBLE_EQ(buffer->get_data()[i], reference->get_data()[i]) << "sample " << i;
+    }
+
+    chain->invalidate_plan();
+    EXPECT_EQ(chain->get_fused_stage_count(buffer), 0U);
+}
+
+TEST_F(ProcessingChainTest, PlanFollowsChainChanges)
+{
+    auto chain = std::make_shared<Buffers::BufferProcessingChain>();
+    auto first = std::make_shared<Buffers::GainProcessor>(2.0);
+    auto second = std::make_shared<Buffers::GainProcessor>(3.0);
+    chain->add_processor(first, buffer);
+    chain->add_processor(second, buffer);
+    EXPECT_EQ(chain->get_fused_stage_count(buffer), 1U);
+
+    std::ranges::fill(buffer->get_data(), 1.0);
+    chain->process(buffer);
+    EXPECT_DOUBLE_EQ(buffer->get_data().back(), 6.0);
+
+    chain->remove_processor(first, buffer);
+    EXPECT_EQ(chain->get_fused_stage_count(buffer), 0U);
+
+    std::ranges::fill(buffer->get_data(), 1.0);
+    chain->process(buffer);
+    EXPECT_DOUBLE_EQ(buffer->get_data().back(), 3.0);
+
+    // Token filtering is resolved at compile time and must follow strategy changes.
+    chain->set_preferred_token(Buffers::ProcessingToken::GRAPHICS_BACKEND);
+    chain->set_enforcement_strategy(Buffers::TokenEnforcementStrategy::OVERRIDE_SKIP);
+
+    std::ranges::fill(buffer->get_data(), 1.0);
+    chain->process(buffer);
+    EXPECT_DOUBLE_EQ(buffer->get_data().back(), 1.0);
+
+    chain->set_enforcement_strategy(Buffers::TokenEnforcementStrategy::IGNORE);
+    std::ranges::fill(buffer->get_data(), 1.0);
+    chain->process(buffer);
+    EXPECT_DOUBLE_EQ(buffer->get_data().back(), 3.0);
+}
+
+TEST_F(ProcessingChainTest, GainRampsToNewValue)
+{
+    auto gain = std::make_shared<Buffers::GainProcessor>(1.0);
+    gain->set_gain_db(-6.0);
+    EXPECT_NEAR(gain->get_gain(), 0.501, 1e-3);
+
+    std::ranges::fill(buffer->get_data(), 1.0);
+    gain->process(buffer);
+    const auto& data = buffer->get_data();
+    EXPECT_LT(data.front(), 1.0);
+    EXPECT_GT(data.front(), data[k_samples / 2]);
+    EXPECT_NEAR(data.back(), gain->get_gain(), 1e-12);
+}
+
+} // namespace MayaFlux::Test
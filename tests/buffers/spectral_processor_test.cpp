@@ -0,0 +1,132 @@
+#include "../test_config.h"
+
+#include "MayaFlux/Buffers/AudioBuffer.hpp"
+#include "MayaFlux/Buffers/Spectral/FeatureProcessor.hpp"
+#include "MayaFlux/Buffers/Spectral/SpectralProcessor.hpp"
+#include "MayaFlux/Nodes/Conduit/Constant.hpp"
+
+namespace MayaFlux::Test {
+
+class SpectralProcessorTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        buffer = std::make_shared<Buffers::AudioBuffer>(0, TestConfig::BUFFER_SIZE);
+    }
+
+    void fill_block(size_t block)
+    {
+        auto& data = buffer->get_data();
+        for (size_t i = 0; i < data.size(); i++) {
+            const auto n = static_cast<double>(block * data.size() + i);
+            data[i] = 0.5 * std::sin(2.0 * std::numbers::pi * 0.01 * n);
+        }
+    }
+
+    std::shared_ptr<Buffers::AudioBuffer> buffer;
+};
+
+TEST_F(SpectralProcessorTest, PassThroughIsDelayedByLatency)
+{
+    auto processor = std::make_shared<Buffers::SpectralProcessor>(nullptr, 1024, 256);
+    EXPECT_TRUE(processor->is_compatible_with(buffer));
+    EXPECT_EQ(processor->get_latency(), 1024U);
+
+    processor->on_attach(buffer);
+
+    std::vector<double> output;
+    for (size_t block = 0; block < 8; ++block) {
+        fill_block(block);
+        processor->process(buffer);
+        output.insert(output.end(), buffer->get_data().begin(), buffer->get_data().end());
+    }
+
+    const size_t latency = processor->get_latency();
+    for (size_t i = latency; i < output.size(); ++i) {
+        const double expected = 0.5 * std::sin(2.0 * std::numbers::pi * 0.01 * static_cast<double>(i - latency));
+        ASSERT_NEAR(output[i], expected, 1e-9);
+    }
+}
+
+TEST_F(SpectralProcessorTest, WindowShapeIsPassedToEngine)
+{
+    using Kinesis::Discrete::SpectralWindow;
+
+    auto processor = std::make_shared<Buffers::SpectralProcessor>(nullptr, 1024, 256, SpectralWindow::BLACKMAN);
+    EXPECT_EQ(processor->get_window_shape(), SpectralWindow::BLACKMAN);
+    EXPECT_EQ(std::make_shared<Buffers::PitchShiftProcessor>(0.0)->get_window_shape(), SpectralWindow::HANN);
+    EXPECT_EQ(std::make_shared<Buffers::SpectralGateProcessor>(0.0, 1024, 256, SpectralWindow::HAMMING)->get_window_shape(),
+        SpectralWindow::HAMMING);
+
+    processor->on_attach(buffer);
+    std::vector<double> output;
+    for (size_t block = 0; block < 8; ++block) {
+        fill_block(block);
+        processor->process(buffer);
+        output.insert(output.end(), buffer->get_data().begin(), buffer->get_data().end());
+    }
+
+    const size_t latency = processor->get_latency();
+    for (size_t i = latency; i < output.size(); ++i) {
+        const double expected = 0.5 * std::sin(2.0 * std::numbers::pi * 0.01 * static_cast<double>(i - latency));
+        ASSERT_NEAR(output[i], expected, 1e-9);
+    }
+}
+
+TEST_F(SpectralProcessorTest, ParametersAreLive)
+{
+    auto shifter = std::make_shared<Buffers::PitchShiftProcessor>(7.0);
+    EXPECT_NEAR(shifter->get_semitones(), 7.0, 1e-9);
+    shifter->set_semitones(-5.0);
+    EXPECT_NEAR(shifter->get_semitones(), -5.0, 1e-9);
+    EXPECT_EQ(shifter->get_window_size(), 2048U);
+
+    auto gate = std::make_shared<Buffers::SpectralGateProcessor>(0.0);
+    gate->on_attach(buffer);
+    for (size_t block = 0; block < 8; ++block) {
+        fill_block(block);
+        gate->process(buffer);
+    }
+    // -6 dBFS tone below a 0 dB gate.
+    for (double v : buffer->get_data()) {
+        ASSERT_NEAR(v, 0.0, 1e-12);
+    }
+
+    gate->set_threshold_db(-20.0);
+    EXPECT_DOUBLE_EQ(gate->get_threshold_db(), -20.0);
+    for (size_t block = 8; block < 16; ++block) {
+        fill_block(block);
+        gate->process(buffer);
+    }
+    const auto peak = std::ranges::max(buffer->get_data(), {}, [](double v) { return std::abs(v); });
+    EXPECT_NEAR(std::abs(peak), 0.5, 0.02);
+}
+
+TEST_F(SpectralProcessorTest, FeatureNodesUpdateEachHop)
+{
+    using Kinesis::Discrete::Descriptor;
+    auto features = std::make_shared<Buffers::FeatureProcessor>(Kinesis::Discrete::FeatureConfig {
+        .descriptors = { Descriptor::RMS, Descriptor::CHROMA }, .window_size = 1024, .hop_size = 256 });
+    EXPECT_TRUE(features->is_compatible_with(buffer));
+    EXPECT_EQ(features->get_node(Descriptor::CENTROID), nullptr);
+    EXPECT_EQ(features->get_node(Descriptor::CHROMA, 12), nullptr);
+
+    auto rms = features->get_node(Descriptor::RMS);
+    ASSERT_NE(rms, nullptr);
+
+    features->on_attach(buffer);
+    size_t blocks = 0;
+    for (; blocks * TestConfig::BUFFER_SIZE < 4096; ++blocks) {
+        fill_block(blocks);
+        features->process(buffer);
+    }
+    const std::vector<double> analysed(buffer->get_data().begin(), buffer->get_data().end());
+    fill_block(blocks - 1);
+    EXPECT_EQ(analysed, buffer->get_data());
+
+    EXPECT_EQ(features->get_frame_count(), blocks * TestConfig::BUFFER_SIZE / 256);
+    EXPECT_NEAR(rms->get_constant(), 0.5 / std::numbers::sqrt2, 0.01);
+    EXPECT_DOUBLE_EQ(rms->get_constant(), features->get_latest()[features->get_layout().offset_of(Descriptor::RMS)]);
+}
+
+} // namespace MayaFlux::Test
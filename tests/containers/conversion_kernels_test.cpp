@@ -0,0 +1,192 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kakshya/Utils/ConversionKernels.hpp"
+#include "MayaFlux/Kakshya/Utils/VariantView.hpp"
+
+#include <random>
+
+using namespace MayaFlux::Kakshya;
+
+namespace MayaFlux::Test {
+
+namespace {
+    // Odd length so every vector path also exercises its scalar tail.
+    constexpr size_t k_len = 1037;
+
+    std::vector<std::complex<float>> random_complex(uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> d(-4.F, 4.F);
+        std::vector<std::complex<float>> v(k_len);
+        for (auto& z : v) {
+            z = { d(rng), d(rng) };
+        }
+        v[0] = { 0.F, 0.F };
+        v[1] = { -1.F, 0.F };
+        v[2] = { 0.F, -2.F };
+        v[3] = { -3.F, -0.F };
+        return v;
+    }
+}
+
+TEST(ConversionKernelsTest, WidenAndNarrowMatchStaticCast)
+{
+    std::vector<float> f(k_len);
+    for (size_t i = 0; i < k_len; ++i) {
+        f[i] = static_cast<float>(i) * 0.37F - 100.F;
+    }
+
+    std::vector<double> d(k_len);
+    widen_to_double(f, d);
+    for (size_t i = 0; i < k_len; ++i) {
+        ASSERT_EQ(d[i], static_cast<double>(f[i]));
+    }
+
+    for (auto& x : d) {
+        x += 1e-9;
+    }
+    std::vector<float> back(k_len);
+    narrow_to_float(d, back);
+    for (size_t i = 0; i < k_len; ++i) {
+        ASSERT_EQ(back[i], static_cast<float>(d[i]));
+    }
+}
+
+TEST(ConversionKernelsTest, IntegerToFloatScales)
+{
+    std::vector<uint8_t> u8(k_len);
+    std::vector<uint16_t> u16(k_len);
+    std::vector<int16_t> i16(k_len);
+    for (size_t i = 0; i < k_len; ++i) {
+        u8[i] = static_cast<uint8_t>(i);
+        u16[i] = static_cast<uint16_t>(i * 63);
+        i16[i] = static_cast<int16_t>(static_cast<int>(i * 63) - 32768);
+    }
+
+    std::vector<float> out(k_len);
+    u8_to_float(u8, out, 1.F / 255.F);
+    for (size_t i = 0; i < k_len; ++i) {
+        ASSERT_FLOAT_EQ(out[i], static_cast<float>(u8[i]) * (1.F / 255.F));
+    }
+
+    u16_to_float(u16, out);
+    for (size_t i = 0; i < k_len; ++i) {
+        ASSERT_EQ(out[i], static_cast<float>(u16[i]));
+    }
+
+    i16_to_float(i16, out);
+    for (size_t i = 0; i < k_len; ++i) {
+        ASSERT_FLOAT_EQ(out[i], static_cast<float>(i16[i]) / 32768.F);
+    }
+}
+
+TEST(ConversionKernelsTest, FloatToI16RoundsAndSaturates)
+{
+    std::vector<float> in { 0.F, 1.F, -1.F, 2.F, -2.F, 0.5F, -0.5F, 1e-6F };
+    in.resize(k_len, 0.25F);
+    std::vector<int16_t> out(k_len);
+    float_to_i16(in, out);
+
+    EXPECT_EQ(out[0], 0);
+    EXPECT_EQ(out[1], 32767);
+    EXPECT_EQ(out[2], -32767);
+    EXPECT_EQ(out[3], 32767);
+    EXPECT_EQ(out[4], -32767);
+    EXPECT_EQ(out[5], static_cast<int16_t>(std::nearbyint(0.5F * 32767.F)));
+    EXPECT_EQ(out[6], static_cast<int16_t>(std::nearbyint(-0.5F * 32767.F)));
+    EXPECT_EQ(out[7], 0);
+    EXPECT_EQ(out[k_len - 1], static_cast<int16_t>(std::nearbyint(0.25F * 32767.F)));
+}
+
+TEST(ConversionKernelsTest, ComplexKernelsMatchStd)
+{
+    const auto z = random_complex(11);
+
+    std::vector<float> mag(k_len);
+    std::vector<float> pow(k_len);
+    std::vector<float> phase(k_len);
+    complex_magnitude(z, mag);
+    complex_squared_magnitude(z, pow);
+    complex_phase(z, phase);
+
+    for (size_t i = 0; i < k_len; ++i) {
+        ASSERT_NEAR(mag[i], std::abs(z[i]), 1e-5F * (1.F + std::abs(z[i])));
+        ASSERT_NEAR(pow[i], std::norm(z[i]), 1e-5F * (1.F + std::norm(z[i])));
+        ASSERT_NEAR(phase[i], std::arg(z[i]), 2e-6F) << "at " << i;
+    }
+
+    std::vector<std::complex<double>> zd(z.begin(), z.end());
+    std::vector<double> magd(k_len);
+    std::vector<double> phased(k_len);
+    complex_magnitude(zd, magd);
+    complex_phase(zd, phased);
+    for (size_t i = 0; i < k_len; ++i) {
+        ASSERT_NEAR(magd[i], std::abs(zd[i]), 1e-12 * (1.0 + std::abs(zd[i])));
+        ASSERT_DOUBLE_EQ(phased[i], std::arg(zd[i]));
+    }
+}
+
+TEST(VariantViewTest, ViewAsLeavesVariantUntouched)
+{
+    const DataVariant variant = std::vector<float> { 1.F, 2.F, 3.F };
+    std::vector<double> storage;
+
+    const auto span = view_as<double>(variant, storage);
+    ASSERT_EQ(span.size(), 3U);
+    EXPECT_DOUBLE_EQ(span[2], 3.0);
+    EXPECT_TRUE(std::holds_alternative<std::vector<float>>(variant));
+    EXPECT_EQ(span.data(), storage.data());
+
+    std::vector<float> unused;
+    const auto same = view_as<float>(variant, unused);
+    EXPECT_EQ(same.data(), std::get<std::vector<float>>(variant).data());
+    EXPECT_TRUE(unused.empty());
+}
+
+TEST(VariantViewTest, ComplexStrategyIsHonoured)
+{
+    const DataVariant variant = std::vector<std::complex<double>> { { 3.0, 4.0 }, { 0.0, 1.0 } };
+    std::vector<double> storage;
+
+    auto mag = view_as<double>(variant, storage, ComplexConversionStrategy::MAGNITUDE);
+    EXPECT_DOUBLE_EQ(mag[0], 5.0);
+
+    auto pow = view_as<double>(variant, storage, ComplexConversionStrategy::SQUARED_MAGNITUDE);
+    EXPECT_DOUBLE_EQ(pow[0], 25.0);
+    EXPECT_DOUBLE_EQ(pow[1], 1.0);
+}
+
+TEST(VariantViewTest, ShadowConvertsOncePerVersion)
+{
+    DataVariant variant = std::vector<float> { 1.F, 2.F, 3.F, 4.F };
+    VariantShadow<double> shadow;
+
+    auto a = shadow.view(variant, 0);
+    auto b = shadow.view(variant, 0);
+    EXPECT_FALSE(a.is_zero_copy());
+    EXPECT_EQ(a.data(), b.data());
+    EXPECT_EQ(shadow.conversions(), 1U);
+
+    std::get<std::vector<float>>(variant)[0] = 10.F;
+    auto c = shadow.view(variant, 1);
+    EXPECT_EQ(shadow.conversions(), 2U);
+    EXPECT_DOUBLE_EQ(c[0], 10.0);
+
+    // Earlier leases still see the old contents in their own buffer.
+    EXPECT_DOUBLE_EQ(a[0], 1.0);
+    EXPECT_NE(a.data(), c.data());
+    EXPECT_TRUE(std::holds_alternative<std::vector<float>>(variant));
+}
+
+TEST(VariantViewTest, ShadowIsZeroCopyForMatchingType)
+{
+    const DataVariant variant = std::vector<double> { 0.5, 0.25 };
+    VariantShadow<double> shadow;
+
+    auto v = shadow.view(variant, 0);
+    EXPECT_TRUE(v.is_zero_copy());
+    EXPECT_EQ(v.data(), std::get<std::vector<double>>(variant).data());
+    EXPECT_EQ(shadow.conversions(), 0U);
+}
+
+}
@@ -0,0 +1,397 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kakshya/Source/DynamicSoundStream.hpp"
+#include "MayaFlux/Nodes/Conduit/VarispeedReaderNode.hpp"
+#include "MayaFlux/Nodes/RootNode.hpp"
+
+#include <numeric>
+#include <thread>
+
+using namespace MayaFlux::Kakshya;
+
+namespace MayaFlux::Test {
+
+// ============================================================================
+// SegmentedStore Tests
+// ============================================================================
+
+TEST(SegmentedStoreTest, RoundsSegmentSizeToPowerOfTwo)
+{
+    SegmentedStore store(2, 1000, false);
+    EXPECT_EQ(store.get_segment_frames(), 1024);
+    EXPECT_EQ(store.get_capacity(), 0);
+
+    store.reserve(1);
+    EXPECT_EQ(store.get_segment_count(), 1);
+    EXPECT_EQ(store.get_capacity(), 1024);
+
+    store.reserve(1025);
+    EXPECT_EQ(store.get_segment_count(), 2);
+}
+
+TEST(SegmentedStoreTest, ReserveNeverMovesExistingSegments)
+{
+    SegmentedStore store(1, 16, false);
+    store.reserve(16);
+
+    const std::vector<double> first(16, 0.5);
+    store.write(0, 0, first);
+    const double* before = store.contiguous_run(0, 0, 16).data();
+
+    store.reserve(16 * 1000);
+
+    EXPECT_EQ(store.contiguous_run(0, 0, 16).data(), before);
+    EXPECT_DOUBLE_EQ(store.sample(0, 15), 0.5);
+    EXPECT_DOUBLE_EQ(store.sample(0, 16 * 999), 0.0);
+}
+
+TEST(SegmentedStoreTest, ClearZeroesInPlace)
+{
+    SegmentedStore store(1, 16, false);
+    store.reserve(48);
+
+    const std::vector<double> ones(48, 1.0);
+    store.write(0, 0, ones);
+    const double* before = store.contiguous_run(0, 16, 16).data();
+
+    store.clear();
+
+    EXPECT_EQ(store.get_capacity(), 48);
+    EXPECT_EQ(store.contiguous_run(0, 16, 16).data(), before);
+    EXPECT_DOUBLE_EQ(store.sample(0, 0), 0.0);
+    EXPECT_DOUBLE_EQ(store.sample(0, 47), 0.0);
+}
+
+TEST(SegmentedStoreTest, WritesAndReadsAcrossSegmentBoundaries)
+{
+    for (bool interleaved : { false, true }) {
+        SegmentedStore store(3, 8, interleaved);
+        store.reserve(40);
+
+        std::vector<double> ramp(29);
+        std::iota(ramp.begin(), ramp.end(), 1.0);
+        EXPECT_EQ(store.write(1, 5, ramp), 29);
+
+        std::vector<double> out(31, -1.0);
+        store.read(1, 4, out);
+        EXPECT_DOUBLE_EQ(out[0], 0.0);
+        for (size_t i = 0; i < ramp.size(); ++i)
+            EXPECT_DOUBLE_EQ(out[i + 1], ramp[i]) << "interleaved=" << interleaved;
+        EXPECT_DOUBLE_EQ(out[30], 0.0);
+
+        EXPECT_DOUBLE_EQ(store.sample(0, 10), 0.0);
+        EXPECT_DOUBLE_EQ(store.sample(2, 10), 0.0);
+    }
+}
+
+TEST(SegmentedStoreTest, DropsFramesPastCapacity)
+{
+    SegmentedStore store(1, 4, false);
+    store.reserve(8);
+
+    const std::vector<double> data(6, 1.0);
+    EXPECT_EQ(store.write(0, 5, data), 3);
+    EXPECT_EQ(store.write(0, 8, data), 0);
+
+    std::vector<double> out(4, -1.0);
+    store.read(0, 7, out);
+    EXPECT_EQ(out, (std::vector<double> { 1.0, 0.0, 0.0, 0.0 }));
+}
+
+TEST(SegmentedStoreTest, InterleavedWriteMaterializesInBothLayouts)
+{
+    const std::vector<double> frames { 1, 10, 2, 20, 3, 30, 4, 40, 5, 50 };
+
+    SegmentedStore planar(2, 2, false);
+    planar.reserve(5);
+    EXPECT_EQ(planar.write_interleaved(0, frames), 5);
+
+    auto channels = planar.materialize(5);
+    ASSERT_EQ(channels.size(), 2);
+    EXPECT_EQ(std::get<std::vector<double>>(channels[0]), (std::vector<double> { 1, 2, 3, 4, 5 }));
+    EXPECT_EQ(std::get<std::vector<double>>(channels[1]), (std::vector<double> { 10, 20, 30, 40, 50 }));
+
+    SegmentedStore interleaved(2, 2, true);
+    interleaved.reserve(5);
+    EXPECT_EQ(interleaved.write_interleaved(0, frames), 5);
+
+    auto flat = interleaved.materialize(5);
+    ASSERT_EQ(flat.size(), 1);
+    EXPECT_EQ(std::get<std::vector<double>>(flat[0]), frames);
+}
+
+// ============================================================================
+// DynamicSoundStream segmented storage Tests
+// ============================================================================
+
+class DynamicSoundStreamSegmentedTest : public ::testing::Test {
+protected:
+    std::shared_ptr<DynamicSoundStream> container;
+
+    void SetUp() override
+    {
+        container = std::make_shared<DynamicSoundStream>(48000, 2);
+        container->get_structure().organization = OrganizationStrategy::PLANAR;
+    }
+
+    static std::vector<double> ramp(size_t n, double start)
+    {
+        std::vector<double> v(n);
+        std::iota(v.begin(), v.end(), start);
+        return v;
+    }
+};
+
+TEST_F(DynamicSoundStreamSegmentedTest, PreservesExistingDataWhenEnabled)
+{
+    auto left = ramp(100, 0.0);
+    auto right = ramp(100, 1000.0);
+    container->write_frames({ std::span<const double>(left), std::span<const double>(right) }, 0);
+    const uint64_t frames = container->get_num_frames();
+
+    container->enable_segmented_storage(32);
+    EXPECT_TRUE(container->is_segmented());
+    EXPECT_EQ(container->get_segment_frames(), 32);
+    EXPECT_EQ(container->get_num_frames(), frames);
+
+    std::vector<double> out(100);
+    container->get_channel_frames(out, 1, 0);
+    EXPECT_EQ(out, right);
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, AppendsPerChannelWithoutMovingEarlierFrames)
+{
+    container->enable_segmented_storage(64);
+
+    auto block = ramp(48, 0.0);
+    container->write_frames(block, 0, 0);
+    const auto head = container->get_channel_frames(0, 0, 48);
+    ASSERT_EQ(head.size(), 48);
+
+    for (uint64_t pos = 48; pos < 48 * 200; pos += 48) {
+        auto next = ramp(48, static_cast<double>(pos));
+        EXPECT_EQ(container->write_frames(next, pos, 0), 48);
+    }
+
+    EXPECT_EQ(container->get_num_frames(), 48 * 200);
+    EXPECT_EQ(container->get_channel_frames(0, 0, 48).data(), head.data());
+
+    std::vector<double> out(100);
+    container->get_channel_frames(out, 0, 9000);
+    EXPECT_EQ(out, ramp(100, 9000.0));
+
+    const auto run = container->get_channel_frames(0, 60, 100);
+    EXPECT_EQ(run.size(), 4);
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, RegionDataAndSequentialReadsUseSegments)
+{
+    container->enable_segmented_storage(8);
+
+    auto left = ramp(20, 0.0);
+    auto right = ramp(20, 100.0);
+    container->write_frames({ std::span<const double>(left), std::span<const double>(right) }, 0);
+
+    const Region region { std::vector<uint64_t> { 6, 0 }, std::vector<uint64_t> { 11, 1 } };
+    auto data = container->get_region_data(region);
+    ASSERT_EQ(data.size(), 2);
+    EXPECT_EQ(std::get<std::vector<double>>(data[0]), ramp(6, 6.0));
+    EXPECT_EQ(std::get<std::vector<double>>(data[1]), ramp(6, 106.0));
+
+    std::vector<double> out(6);
+    container->set_read_position({ 7, 7 });
+    EXPECT_EQ(container->read_frames(out, 6), 6);
+    EXPECT_EQ(out, (std::vector<double> { 7, 107, 8, 108, 9, 109 }));
+    EXPECT_EQ(container->get_read_position()[0], 10);
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, InterleavedOrganizationIsSupported)
+{
+    container->get_structure().organization = OrganizationStrategy::INTERLEAVED;
+    container->enable_segmented_storage(4);
+
+    const std::vector<double> frames { 1, -1, 2, -2, 3, -3, 4, -4, 5, -5, 6, -6 };
+    container->write_frames(std::vector { std::span<const double>(frames) }, 0);
+    EXPECT_EQ(container->get_num_frames(), 6);
+
+    std::vector<double> right(6);
+    container->get_channel_frames(right, 1, 0);
+    EXPECT_EQ(right, (std::vector<double> { -1, -2, -3, -4, -5, -6 }));
+
+    auto data = container->get_region_data(Region { std::vector<uint64_t> { 3, 0 }, std::vector<uint64_t> { 4, 1 } });
+    ASSERT_EQ(data.size(), 1);
+    EXPECT_EQ(std::get<std::vector<double>>(data[0]), (std::vector<double> { 4, -4, 5, -5 }));
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, ContiguousViewOnlyAfterMaterialize)
+{
+    container->enable_segmented_storage(16);
+
+    auto left = ramp(40, 0.0);
+    auto right = ramp(40, 50.0);
+    container->write_frames({ std::span<const double>(left), std::span<const double>(right) }, 0);
+
+    EXPECT_TRUE(container->has_data());
+    EXPECT_TRUE(container->get_channel_view(0).first.empty());
+
+    container->materialize();
+    auto [view, stride] = container->get_channel_view(1);
+    EXPECT_EQ(stride, 1);
+    EXPECT_EQ(std::vector<double>(view.begin(), view.end()), right);
+    EXPECT_TRUE(container->is_segmented());
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, DisableRestoresContiguousStorage)
+{
+    container->enable_segmented_storage(16);
+
+    auto left = ramp(40, 0.0);
+    container->write_frames(left, 0, 0);
+    container->disable_segmented_storage();
+
+    EXPECT_FALSE(container->is_segmented());
+    const auto span = container->get_channel_frames(0, 0, 40);
+    EXPECT_EQ(std::vector<double>(span.begin(), span.end()), left);
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, CircularModeLeavesSegmentedStorage)
+{
+    container->enable_segmented_storage(16);
+    container->enable_circular_buffer(32);
+    EXPECT_FALSE(container->is_segmented());
+    EXPECT_TRUE(container->is_circular());
+
+    container->enable_segmented_storage(16);
+    EXPECT_FALSE(container->is_segmented());
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, ClearKeepsSegmentedMode)
+{
+    container->enable_segmented_storage(16);
+    auto left = ramp(40, 1.0);
+    container->write_frames(left, 0, 0);
+
+    container->clear();
+    EXPECT_TRUE(container->is_segmented());
+    EXPECT_FALSE(container->has_data());
+    EXPECT_EQ(container->get_num_frames(), 0);
+
+    container->write_frames(left, 0, 0);
+    std::vector<double> out(40);
+    container->get_channel_frames(out, 0, 0);
+    EXPECT_EQ(out, left);
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, ReadersSurviveClearAndDisable)
+{
+    auto left = ramp(256, 1.0);
+    std::atomic<bool> done { false };
+
+    std::thread reader([&] {
+        std::vector<double> out(64);
+        while (!done.load(std::memory_order_acquire)) {
+            container->get_channel_frames(out, 0, 100);
+            container->peek_sequential(out, out.size());
+        }
+    });
+
+    for (int i = 0; i < 200; ++i) {
+        container->enable_segmented_storage(16);
+        container->write_frames(left, 0, 0);
+        container->clear();
+        container->write_frames(left, 0, 0);
+        container->disable_segmented_storage();
+    }
+
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_FALSE(container->is_segmented());
+    std::vector<double> out(256);
+    container->get_channel_frames(out, 0, 0);
+    EXPECT_EQ(out, left);
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, PinnedSegmentsFollowWrites)
+{
+    container->enable_segmented_storage(16);
+    container->write_frames(ramp(20, 1.0), 0, 1);
+
+    uint64_t frames = 0;
+    auto store = container->pin_segments(frames);
+    ASSERT_TRUE(store);
+    EXPECT_EQ(frames, 20);
+
+    const auto table = store->get_segment_table();
+    ASSERT_GE(table.size(), 2U);
+    EXPECT_EQ(table[1][store->get_channel_offset(1) + 3 * store->get_frame_stride()], 20.0);
+
+    container->disable_segmented_storage();
+    EXPECT_FALSE(container->pin_segments(frames));
+    EXPECT_EQ(frames, 0);
+}
+
+// ============================================================================
+// VarispeedReaderNode playback Tests
+// ============================================================================
+
+TEST_F(DynamicSoundStreamSegmentedTest, VarispeedReaderHearsFramesWrittenWhilePlaying)
+{
+    container->enable_segmented_storage(16);
+    container->write_frames(ramp(40, 1.0), 0, 1);
+
+    Nodes::VarispeedReaderNode reader(container, 1);
+    reader.set_quality(Kinesis::Discrete::ResampleQuality::CUBIC);
+
+    // Unity-rate cubic playback lands on source frames exactly.
+    Nodes::ProcessingScope scope;
+    std::vector<double> out(32);
+    EXPECT_EQ(reader.process_into(out), out.size());
+    EXPECT_EQ(out, ramp(32, 1.0));
+
+    // Never materialized: the node reads the segments, not a stale snapshot.
+    container->write_frames(ramp(40, 41.0), 40, 1);
+    EXPECT_EQ(reader.process_into(out), out.size());
+    EXPECT_EQ(out, ramp(32, 33.0));
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, VarispeedReaderRefreshesContiguousViewOffTheAudioThread)
+{
+    container->write_frames(ramp(64, 1.0), 0, 0);
+
+    Nodes::VarispeedReaderNode reader(container, 0);
+    reader.set_quality(Kinesis::Discrete::ResampleQuality::CUBIC);
+
+    std::vector<double> out(16);
+    {
+        Nodes::ProcessingScope scope;
+        EXPECT_EQ(reader.process_into(out), out.size());
+        EXPECT_EQ(out, ramp(16, 1.0));
+
+        // A write may reallocate the channel; the stale view is not read.
+        container->write_frames(ramp(64, 65.0), 64, 0);
+        EXPECT_EQ(reader.process_into(out), 0U);
+        EXPECT_EQ(out, std::vector<double>(16, 0.0));
+        EXPECT_DOUBLE_EQ(reader.get_position(), 16.0);
+    }
+
+    reader.refresh_view();
+    Nodes::ProcessingScope scope;
+    EXPECT_EQ(reader.process_into(out), out.size());
+    EXPECT_EQ(out, ramp(16, 17.0));
+}
+
+TEST_F(DynamicSoundStreamSegmentedTest, VarispeedReaderOutsideProcessingScopeRefreshesItself)
+{
+    container->write_frames(ramp(32, 1.0), 0, 0);
+
+    Nodes::VarispeedReaderNode reader(container, 0);
+    reader.set_quality(Kinesis::Discrete::ResampleQuality::CUBIC);
+    container->write_frames(ramp(32, 33.0), 32, 0);
+
+    std::vector<double> out(48);
+    EXPECT_EQ(reader.process_into(out), out.size());
+    EXPECT_EQ(out, ramp(48, 1.0));
+}
+
+} // namespace MayaFlux::Test
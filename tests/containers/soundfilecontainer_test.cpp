@@ -73,6 +73,21 @@ TEST_F(SoundFileContainerTest, FrameAndCoordinateAccess)
     EXPECT_EQ(coords2[1], 1);
 }
 
+TEST_F(SoundFileContainerTest, SetValueKeepsFloatStorage)
+{
+    const std::vector<float> samples { 0.1F, 0.2F, 0.3F, 0.4F, 0.5F, 0.6F, 0.7F, 0.8F };
+    container->set_raw_data({ samples });
+    ASSERT_TRUE(std::holds_alternative<std::vector<float>>(container->get_data()[0]));
+
+    container->set_value_at({ 2, 1 }, 0.25);
+
+    const auto& data = container->get_data();
+    ASSERT_TRUE(std::holds_alternative<std::vector<float>>(data[0]));
+    EXPECT_FLOAT_EQ(std::get<std::vector<float>>(data[0])[5], 0.25F);
+    EXPECT_FLOAT_EQ(std::get<std::vector<float>>(data[0])[4], 0.5F);
+    EXPECT_DOUBLE_EQ(container->get_value_at<double>({ 2, 1 }), 0.25);
+}
+
 TEST_F(SoundFileContainerTest, RegionDataAccess)
 {
     container->set_value_at({ 1, 1 }, 1.23);
@@ -103,6 +118,23 @@ TEST_F(SoundFileContainerTest, RegionDataAccess)
     EXPECT_DOUBLE_EQ(updated_vec[3], 6.0);
 }
 
+TEST_F(SoundFileContainerTest, SetRegionDataLeavesSourceUntouched)
+{
+    Region region(std::vector<uint64_t>({ 1, 0 }), std::vector<uint64_t>({ 2, 1 }));
+
+    const std::vector<DataVariant> new_data { std::vector<float> { 9.F, 8.F, 7.F, 6.F } };
+    container->set_region_data(region, new_data);
+
+    ASSERT_TRUE(std::holds_alternative<std::vector<float>>(new_data[0]));
+    EXPECT_FLOAT_EQ(std::get<std::vector<float>>(new_data[0])[0], 9.F);
+
+    auto updated = container->get_region_data(region);
+    ASSERT_FALSE(updated.empty());
+    auto updated_vec = std::get<std::vector<double>>(updated[0]);
+    EXPECT_DOUBLE_EQ(updated_vec[0], 9.0);
+    EXPECT_DOUBLE_EQ(updated_vec[3], 6.0);
+}
+
 TEST_F(SoundFileContainerTest, RegionGroupManagement)
 {
     RegionGroup group("test_group");
@@ -0,0 +1,187 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kakshya/Utils/WaveformSummary.hpp"
+
+#include <numeric>
+
+using namespace MayaFlux::Kakshya;
+
+namespace MayaFlux::Test {
+
+namespace {
+    std::vector<double> sine(size_t n, double period)
+    {
+        std::vector<double> v(n);
+        for (size_t i = 0; i < n; ++i)
+            v[i] = std::sin(2.0 * std::numbers::pi * static_cast<double>(i) / period);
+        return v;
+    }
+
+    void expect_same(const WaveformSummary& a, const WaveformSummary& b)
+    {
+        ASSERT_EQ(a.get_level_count(), b.get_level_count());
+        for (size_t level = 0; level < a.get_level_count(); ++level) {
+            ASSERT_EQ(a.get_bucket_count(level), b.get_bucket_count(level));
+            for (size_t i = 0; i < a.get_bucket_count(level); ++i) {
+                EXPECT_FLOAT_EQ(a.bucket(level, i).min, b.bucket(level, i).min);
+                EXPECT_FLOAT_EQ(a.bucket(level, i).max, b.bucket(level, i).max);
+                EXPECT_NEAR(a.bucket(level, i).rms, b.bucket(level, i).rms, 1e-5);
+            }
+        }
+    }
+}
+
+TEST(WaveformSummaryTest, BuildsPowerOfTwoLevels)
+{
+    WaveformSummary summary(100);
+    EXPECT_EQ(summary.get_base_bucket(), 128);
+
+    std::vector<double> ramp(1000);
+    std::iota(ramp.begin(), ramp.end(), 0.0);
+    summary.build(ramp);
+
+    EXPECT_EQ(summary.get_sample_count(), 1000);
+    ASSERT_EQ(summary.get_level_count(), 4);
+    EXPECT_EQ(summary.get_bucket_count(0), 8);
+    EXPECT_EQ(summary.get_bucket_count(1), 4);
+    EXPECT_EQ(summary.get_bucket_count(2), 2);
+    EXPECT_EQ(summary.get_bucket_count(3), 1);
+    EXPECT_EQ(summary.get_bucket_span(2), 512);
+
+    EXPECT_FLOAT_EQ(summary.bucket(0, 1).min, 128.F);
+    EXPECT_FLOAT_EQ(summary.bucket(0, 1).max, 255.F);
+    EXPECT_FLOAT_EQ(summary.bucket(0, 7).max, 999.F);
+    EXPECT_FLOAT_EQ(summary.bucket(3, 0).min, 0.F);
+    EXPECT_FLOAT_EQ(summary.bucket(3, 0).max, 999.F);
+}
+
+TEST(WaveformSummaryTest, RmsMatchesSamples)
+{
+    const std::vector<double> square { 0.5, -0.5, 0.5, -0.5, 0.5, -0.5 };
+    WaveformSummary summary(4);
+    summary.build(square);
+
+    EXPECT_NEAR(summary.bucket(0, 0).rms, 0.5, 1e-6);
+    EXPECT_NEAR(summary.bucket(0, 1).rms, 0.5, 1e-6);
+    EXPECT_NEAR(summary.bucket(1, 0).rms, 0.5, 1e-6);
+}
+
+TEST(WaveformSummaryTest, ParallelBuildMatchesIncrementalAppend)
+{
+    const auto signal = sine(300000, 977.0);
+
+    WaveformSummary built(64);
+    built.build(signal);
+
+    WaveformSummary appended(64);
+    for (size_t end = 0; end < signal.size();) {
+        end = std::min<size_t>(end + 4801, signal.size());
+        appended.update(std::span(signal).first(end), end, 0);
+    }
+
+    expect_same(built, appended);
+}
+
+TEST(WaveformSummaryTest, UpdateRecomputesChangedRangeOnly)
+{
+    auto signal = sine(4096, 100.0);
+    WaveformSummary summary(32);
+    summary.build(signal);
+
+    signal[1000] = 4.0;
+    summary.update(signal, 1000, 1);
+
+    WaveformSummary rebuilt(32);
+    rebuilt.build(signal);
+    expect_same(summary, rebuilt);
+
+    const size_t top = summary.get_level_count() - 1;
+    EXPECT_FLOAT_EQ(summary.bucket(top, 0).max, 4.F);
+}
+
+TEST(WaveformSummaryTest, ShrinkingSeriesRebuilds)
+{
+    auto signal = sine(2000, 50.0);
+    WaveformSummary summary(16);
+    summary.build(signal);
+
+    signal.resize(100);
+    summary.update(signal, 0, 0);
+    EXPECT_EQ(summary.get_sample_count(), 100);
+    EXPECT_EQ(summary.get_bucket_count(0), 7);
+}
+
+TEST(WaveformSummaryTest, LevelForPicksCoarsestFittingSpan)
+{
+    WaveformSummary summary(256);
+    summary.build(std::vector<double>(1 << 20, 0.0));
+
+    EXPECT_EQ(summary.level_for(10.0), 0);
+    EXPECT_EQ(summary.level_for(256.0), 0);
+    EXPECT_EQ(summary.level_for(511.0), 0);
+    EXPECT_EQ(summary.level_for(512.0), 1);
+    EXPECT_EQ(summary.level_for(5000.0), 4);
+    EXPECT_EQ(summary.level_for(1e12), summary.get_level_count() - 1);
+}
+
+TEST(WaveformSummaryTest, SummarizeStaysWithinAlignedColumnExtent)
+{
+    const auto signal = sine(1 << 18, 3001.0);
+    WaveformSummary summary(16);
+    summary.build(signal);
+
+    for (auto [first, count] : { std::pair<uint64_t, uint64_t> { 0, signal.size() }, { 70001, 90000 } }) {
+        constexpr uint64_t cols = 300;
+        std::vector<WaveformSummary::Bucket> columns(cols);
+        summary.summarize(signal, first, count, columns);
+
+        std::vector<WaveformSummary::Bucket> exact(cols);
+        WaveformSummary::reduce(signal, first, count, exact);
+
+        const uint64_t slack = count / cols / 4;
+        for (uint64_t c = 0; c < cols; ++c) {
+            EXPECT_LE(columns[c].min, exact[c].min);
+            EXPECT_GE(columns[c].max, exact[c].max);
+
+            const uint64_t s = first + c * count / cols;
+            const uint64_t e = first + (c + 1) * count / cols;
+            const uint64_t ws = s > slack ? s - slack : 0;
+            const uint64_t we = std::min<uint64_t>(e + slack, signal.size());
+            WaveformSummary::Bucket widened;
+            WaveformSummary::reduce(signal, ws, we - ws, std::span(&widened, 1));
+            EXPECT_GE(columns[c].min, widened.min);
+            EXPECT_LE(columns[c].max, widened.max);
+        }
+    }
+}
+
+TEST(WaveformSummaryTest, FineZoomFallsBackToExactReduction)
+{
+    const auto signal = sine(10000, 40.0);
+    WaveformSummary summary(256);
+    summary.build(signal);
+
+    std::vector<WaveformSummary::Bucket> columns(100);
+    summary.summarize(signal, 5000, 1000, columns);
+
+    std::vector<WaveformSummary::Bucket> exact(100);
+    WaveformSummary::reduce(signal, 5000, 1000, exact);
+    for (size_t c = 0; c < columns.size(); ++c) {
+        EXPECT_FLOAT_EQ(columns[c].min, exact[c].min);
+        EXPECT_FLOAT_EQ(columns[c].max, exact[c].max);
+    }
+}
+
+TEST(WaveformSummaryTest, ReduceRepeatsSamplesForWideColumns)
+{
+    const std::vector<double> data { 1.0, 2.0 };
+    std::vector<WaveformSummary::Bucket> columns(4);
+    WaveformSummary::reduce(data, 0, 2, columns);
+
+    EXPECT_FLOAT_EQ(columns[0].max, 1.F);
+    EXPECT_FLOAT_EQ(columns[1].max, 1.F);
+    EXPECT_FLOAT_EQ(columns[2].max, 2.F);
+    EXPECT_FLOAT_EQ(columns[3].min, 2.F);
+}
+
+} // namespace MayaFlux::Test
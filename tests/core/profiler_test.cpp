@@ -0,0 +1,189 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Transitive/Profile/Profiler.hpp"
+
+#include <nlohmann/json.hpp>
+
+using namespace MayaFlux::Profile;
+
+namespace MayaFlux::Test {
+
+namespace {
+    const ZoneStats* find_zone(const std::vector<ZoneStats>& stats, std::string_view name)
+    {
+        auto it = std::ranges::find(stats, name, &ZoneStats::name);
+        return it == stats.end() ? nullptr : &*it;
+    }
+
+    struct Probe {
+        virtual ~Probe() = default;
+    };
+
+    struct DerivedProbe : Probe { };
+}
+
+class ProfilerTest : public ::testing::Test {
+protected:
+    void SetUp() override
+    {
+        auto& profiler = Profiler::instance();
+        profiler.disable();
+        profiler.reset();
+    }
+
+    void TearDown() override
+    {
+        Profiler::instance().disable();
+        Profiler::instance().reset();
+    }
+};
+
+TEST_F(ProfilerTest, DisabledZonesRecordNothing)
+{
+    {
+        Zone zone(Category::CUSTOM, this, "idle");
+    }
+    uint32_t counter = 0;
+    EXPECT_FALSE(Profiler::sample_due(counter));
+    EXPECT_TRUE(Profiler::instance().summary().empty());
+}
+
+TEST_F(ProfilerTest, PercentilesFollowDistribution)
+{
+    auto& profiler = Profiler::instance();
+    profiler.enable();
+
+    // Uniform spans of 1..1000 units; aggregation is in ns, so only ratios are checked.
+    constexpr uint64_t unit = 4096;
+    const uint64_t origin = Profiler::now();
+    for (uint64_t i = 1; i <= 1000; ++i) {
+        profiler.record({ .begin = origin, .end = origin + i * unit, .subject = this, .label = "uniform",
+            .type = nullptr, .deadline_ns = 0, .category = Category::CUSTOM });
+    }
+
+    const auto stats = profiler.summary();
+    const auto* zone = find_zone(stats, "uniform");
+    ASSERT_NE(zone, nullptr);
+    EXPECT_EQ(zone->count, 1000U);
+    EXPECT_NEAR(zone->mean_ns / zone->max_ns, 0.5, 0.01);
+    EXPECT_NEAR(zone->p50_ns / zone->max_ns, 0.50, 0.08);
+    EXPECT_NEAR(zone->p95_ns / zone->max_ns, 0.95, 0.08);
+    EXPECT_NEAR(zone->p99_ns / zone->max_ns, 0.99, 0.08);
+    EXPECT_LE(zone->p99_ns, zone->max_ns);
+}
+
+TEST_F(ProfilerTest, DeadlineLoadAndOverruns)
+{
+    auto& profiler = Profiler::instance();
+    profiler.enable();
+
+    for (int i = 0; i < 4; ++i) {
+        Zone zone(Category::CYCLE, this, "callback", 1'000'000);
+        if (i % 2 == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(3));
+        }
+    }
+
+    const auto stats = profiler.summary();
+    const auto* zone = find_zone(stats, "callback");
+    ASSERT_NE(zone, nullptr);
+    EXPECT_EQ(zone->count, 4U);
+    EXPECT_EQ(zone->deadline_ns, 1'000'000U);
+    EXPECT_EQ(zone->overruns, 2U);
+    EXPECT_GT(zone->peak_load, 1.0);
+    EXPECT_GE(zone->peak_load, zone->p99_load * 0.85);
+}
+
+TEST_F(ProfilerTest, TypedZonesAreNamedAndSeparatedBySubject)
+{
+    auto& profiler = Profiler::instance();
+    profiler.enable({ .sample_stride = 4 });
+
+    DerivedProbe a;
+    DerivedProbe b;
+    const Probe& base = a;
+
+    uint32_t counter = 0;
+    int timed = 0;
+    for (int i = 0; i < 16; ++i) {
+        if (Profiler::sample_due(counter)) {
+            ++timed;
+            Zone zone(Category::NODE, &a, typeid(base));
+        }
+        Zone zone(Category::NODE, &b, typeid(b));
+    }
+    EXPECT_EQ(timed, 4);
+
+    const auto stats = profiler.summary();
+    ASSERT_EQ(stats.size(), 2U);
+    for (const auto& zone : stats) {
+        EXPECT_EQ(zone.name, "DerivedProbe");
+        EXPECT_EQ(zone.count, zone.subject == &a ? 4U : 16U);
+    }
+}
+
+TEST_F(ProfilerTest, ReportAndChromeTraceAreValidJson)
+{
+    auto& profiler = Profiler::instance();
+    profiler.enable();
+    profiler.name_thread("test main");
+
+    for (int i = 0; i < 3; ++i) {
+        Zone zone(Category::BUFFER_PROCESSOR, this, "chain");
+    }
+    std::thread([&] {
+        Zone zone(Category::SCHEDULER, nullptr, "worker");
+    }).join();
+
+    const auto report = nlohmann::json::parse(profiler.report_json(1));
+    ASSERT_EQ(report["zones"].size(), 1U);
+    EXPECT_TRUE(report["enabled"].get<bool>());
+    EXPECT_EQ(report["dropped_events"].get<uint64_t>(), 0U);
+
+    const auto trace = nlohmann::json::parse(profiler.chrome_trace_json());
+    const auto& events = trace["traceEvents"];
+
+    size_t complete = 0;
+    bool named = false;
+    std::set<int> threads;
+    for (const auto& e : events) {
+        if (e["ph"] == "X") {
+            ++complete;
+            threads.insert(e["tid"].get<int>());
+            EXPECT_GE(e["dur"].get<double>(), 0.0);
+        } else if (e["ph"] == "M" && e["args"]["name"] == "test main") {
+            named = true;
+        }
+    }
+    EXPECT_EQ(complete, 4U);
+    EXPECT_EQ(threads.size(), 2U);
+    EXPECT_TRUE(named);
+}
+
+TEST_F(ProfilerTest, TraceWindowKeepsMostRecentEvents)
+{
+    auto& profiler = Profiler::instance();
+    profiler.enable({ .trace_capacity = 8 });
+
+    const uint64_t origin = Profiler::now();
+    for (uint64_t i = 0; i < 20; ++i) {
+        profiler.record({ .begin = origin + i * 100, .end = origin + i * 100 + 50, .subject = nullptr, .label = "tick",
+            .type = nullptr, .deadline_ns = 0, .category = Category::CUSTOM });
+    }
+
+    const auto trace = nlohmann::json::parse(profiler.chrome_trace_json());
+    std::vector<double> stamps;
+    for (const auto& e : trace["traceEvents"]) {
+        if (e["ph"] == "X") {
+            stamps.push_back(e["ts"].get<double>());
+        }
+    }
+    ASSERT_EQ(stamps.size(), 8U);
+    EXPECT_TRUE(std::ranges::is_sorted(stamps));
+
+    const auto stats = profiler.summary();
+    ASSERT_EQ(stats.size(), 1U);
+    EXPECT_EQ(stats.front().count, 20U);
+}
+
+} // namespace MayaFlux::Test
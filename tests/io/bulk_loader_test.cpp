@@ -0,0 +1,231 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Core/GlobalStreamInfo.hpp"
+#include "MayaFlux/IO/BulkLoader.hpp"
+#include "MayaFlux/Kakshya/Source/SoundFileContainer.hpp"
+
+#include <fstream>
+
+using namespace MayaFlux::IO;
+
+namespace MayaFlux::Test {
+
+class BulkLoaderTest : public ::testing::Test {
+protected:
+    std::filesystem::path root;
+    Core::GlobalStreamInfo stream_info;
+    std::unique_ptr<IOManager> manager;
+
+    void SetUp() override
+    {
+        root = std::filesystem::temp_directory_path()
+            / ("mf_bulk_loader_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed())
+                + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root);
+
+        stream_info.sample_rate = 48000;
+        stream_info.buffer_size = 512;
+        manager = std::make_unique<IOManager>(stream_info, 60, nullptr);
+    }
+
+    void TearDown() override
+    {
+        manager.reset();
+        std::error_code ec;
+        std::filesystem::remove_all(root, ec);
+    }
+
+    /// Mono 16-bit PCM WAV of @p frames samples of a ramp.
+    std::string write_wav(const std::string& name, uint32_t frames = 480)
+    {
+        const auto path = root / name;
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+
+        auto u32 = [&f](uint32_t v) { f.write(reinterpret_cast<const char*>(&v), 4); };
+        auto u16 = [&f](uint16_t v) { f.write(reinterpret_cast<const char*>(&v), 2); };
+
+        const uint32_t data_bytes = frames * 2;
+        f.write("RIFF", 4);
+        u32(36 + data_bytes);
+        f.write("WAVEfmt ", 8);
+        u32(16);
+        u16(1);
+        u16(1);
+        u32(48000);
+        u32(48000 * 2);
+        u16(2);
+        u16(16);
+        f.write("data", 4);
+        u32(data_bytes);
+        for (uint32_t i = 0; i < frames; ++i) {
+            u16(static_cast<uint16_t>(static_cast<int16_t>((i % 64) * 256 - 8192)));
+        }
+        return path.string();
+    }
+
+    /// 2x2 uncompressed 32-bit TGA.
+    std::string write_tga(const std::string& name)
+    {
+        const auto path = root / name;
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+
+        const std::array<uint8_t, 18> header { 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 2, 0, 32, 0x28 };
+        f.write(reinterpret_cast<const char*>(header.data()), header.size());
+        for (int i = 0; i < 4; ++i) {
+            const std::array<uint8_t, 4> bgra { 0, static_cast<uint8_t>(i * 64), 255, 255 };
+            f.write(reinterpret_cast<const char*>(bgra.data()), bgra.size());
+        }
+        return path.string();
+    }
+
+    /// One textured triangle as OBJ, with a sibling .mtl whose map_Kd is @p texture.
+    std::string write_obj(const std::string& name, const std::string& texture)
+    {
+        const auto path = root / name;
+        auto mtl = path;
+        mtl.replace_extension(".mtl");
+
+        std::ofstream(mtl, std::ios::trunc)
+            << "newmtl textured\n"
+            << "Kd 1 1 1\n"
+            << "map_Kd " << texture << "\n";
+
+        std::ofstream(path, std::ios::trunc)
+            << "mtllib " << mtl.filename().string() << "\n"
+            << "v 0 0 0\nv 1 0 0\nv 0 1 0\n"
+            << "vt 0 0\nvt 1 0\nvt 0 1\n"
+            << "usemtl textured\n"
+            << "f 1/1 2/2 3/3\n";
+        return path.string();
+    }
+
+    AssetManifest audio_manifest(const std::vector<int32_t>& priorities)
+    {
+        AssetManifest manifest;
+        for (size_t i = 0; i < priorities.size(); ++i) {
+            manifest.push_back({
+                .kind = AssetKind::Audio,
+                .path = write_wav("clip_" + std::to_string(i) + ".wav"),
+                .priority = priorities[i],
+            });
+        }
+        return manifest;
+    }
+};
+
+TEST_F(BulkLoaderTest, FinalisesInPriorityOrder)
+{
+    std::vector<size_t> order;
+    auto load = manager->load_batch(audio_manifest({ 0, 5, 1, 5, -2 }),
+        { .max_workers = 1, .on_loaded = [&order](const LoadedAsset& asset) { order.push_back(asset.index); } });
+
+    const auto results = load->wait();
+
+    EXPECT_EQ(order, (std::vector<size_t> { 1, 3, 2, 0, 4 }));
+    ASSERT_EQ(results.size(), 5);
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i].index, i);
+        EXPECT_TRUE(results[i].success) << results[i].error;
+        ASSERT_NE(results[i].audio, nullptr);
+        EXPECT_EQ(results[i].audio->get_num_channels(), 1);
+    }
+}
+
+TEST_F(BulkLoaderTest, CancelResolvesEveryFuture)
+{
+    std::vector<int32_t> priorities(16);
+    std::iota(priorities.begin(), priorities.end(), 0);
+    auto load = manager->load_batch(audio_manifest(priorities), { .max_workers = 1 });
+
+    load->cancel();
+    load->poll();
+
+    for (size_t i = 0; i < load->size(); ++i) {
+        auto future = load->future(i);
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+        const auto& result = future.get();
+        EXPECT_TRUE(result.cancelled);
+        EXPECT_FALSE(result.success);
+    }
+
+    const auto progress = load->progress();
+    EXPECT_TRUE(progress.done());
+    EXPECT_EQ(progress.cancelled, priorities.size());
+    EXPECT_EQ(progress.completed, 0);
+}
+
+TEST_F(BulkLoaderTest, ProgressReachesTotal)
+{
+    auto manifest = audio_manifest({ 0, 0, 0, 0 });
+    manifest.push_back({ .kind = AssetKind::Audio, .path = (root / "missing.wav").string() });
+
+    std::vector<BulkLoadProgress> reports;
+    auto load = manager->load_batch(std::move(manifest),
+        { .max_workers = 2, .on_progress = [&reports](const BulkLoadProgress& p) { reports.push_back(p); } });
+
+    const auto results = load->wait();
+    EXPECT_FALSE(results.back().success);
+    EXPECT_FALSE(results.back().error.empty());
+
+    ASSERT_FALSE(reports.empty());
+    for (size_t i = 1; i < reports.size(); ++i) {
+        EXPECT_GE(reports[i].completed + reports[i].failed, reports[i - 1].completed + reports[i - 1].failed);
+    }
+
+    const auto& last = reports.back();
+    EXPECT_TRUE(last.done());
+    EXPECT_EQ(last.total, 5);
+    EXPECT_EQ(last.decoded, 5);
+    EXPECT_EQ(last.completed, 4);
+    EXPECT_EQ(last.failed, 1);
+    EXPECT_EQ(last.cancelled, 0);
+    EXPECT_FLOAT_EQ(last.fraction(), 1.0F);
+    EXPECT_EQ(load->progress(), last);
+}
+
+TEST_F(BulkLoaderTest, ModelsShareOneTextureDecodeAndFinaliseAfterIt)
+{
+    // Both models reach the same file through different relative paths.
+    write_tga("shared.tga");
+    std::filesystem::create_directories(root / "nested");
+    const auto nested_model = write_obj("nested/nested.obj", "../shared.tga");
+    const auto near_model = write_obj("near.obj", "shared.tga");
+
+    BulkLoad* handle = nullptr;
+    std::vector<std::pair<size_t, BulkLoadProgress>> finalised;
+    auto load = manager->load_batch(
+        {
+            { .kind = AssetKind::Mesh, .path = nested_model, .priority = 1 },
+            { .kind = AssetKind::Mesh, .path = near_model, .priority = 0 },
+        },
+        { .max_workers = 1, .on_loaded = [&](const LoadedAsset& asset) {
+             finalised.emplace_back(asset.index, handle->progress());
+         } });
+    handle = load.get();
+
+    const auto results = load->wait();
+
+    ASSERT_EQ(results.size(), 2);
+    for (const auto& result : results) {
+        EXPECT_TRUE(result.success) << result.path << ": " << result.error;
+        EXPECT_EQ(result.meshes.size(), 1);
+    }
+
+    // Higher priority finalises first, and only once the texture it depends
+    // on has decoded. The second model still holds the texture, so the
+    // decode has not been released yet.
+    ASSERT_EQ(finalised.size(), 2);
+    EXPECT_EQ(finalised[0].first, 0);
+    EXPECT_EQ(finalised[1].first, 1);
+    EXPECT_EQ(finalised[0].second.textures_total, 1);
+    EXPECT_EQ(finalised[0].second.textures_decoded, 1);
+    EXPECT_EQ(finalised[0].second.completed, 1);
+
+    const auto progress = load->progress();
+    EXPECT_TRUE(progress.done());
+    EXPECT_EQ(progress.completed, 2);
+    EXPECT_EQ(progress.textures_total, 1);
+}
+
+} // namespace MayaFlux::Test
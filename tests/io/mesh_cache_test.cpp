@@ -0,0 +1,277 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/IO/MeshCache.hpp"
+
+#include <fstream>
+
+using namespace MayaFlux::IO;
+using namespace MayaFlux::Kakshya;
+
+namespace MayaFlux::Test {
+
+class MeshCacheTest : public ::testing::Test {
+protected:
+    std::filesystem::path root;
+
+    void SetUp() override
+    {
+        root = std::filesystem::temp_directory_path()
+            / ("mf_mesh_cache_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed())
+                + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root);
+    }
+
+    void TearDown() override
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(root, ec);
+    }
+
+    void write_file(const std::filesystem::path& path, const std::string& text)
+    {
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+        f << text;
+    }
+
+    /// A quad of @p quads * 4 canonical vertices with distinguishable bytes.
+    static MeshData make_mesh(uint32_t quads, bool with_submeshes)
+    {
+        auto mesh = MeshData::empty();
+        const uint32_t stride = mesh.layout.stride_bytes;
+
+        auto& vb = std::get<std::vector<uint8_t>>(mesh.vertex_variant);
+        vb.resize(static_cast<size_t>(quads) * 4 * stride);
+        for (size_t i = 0; i < vb.size(); ++i) {
+            vb[i] = static_cast<uint8_t>(i * 31 + quads);
+        }
+        mesh.layout.vertex_count = quads * 4;
+
+        auto& ib = std::get<std::vector<uint32_t>>(mesh.index_variant);
+        for (uint32_t q = 0; q < quads; ++q) {
+            for (uint32_t i : { 0U, 1U, 2U, 2U, 3U, 0U }) {
+                ib.push_back(q * 4 + i);
+            }
+        }
+
+        if (with_submeshes) {
+            RegionGroup group("submeshes");
+            for (uint32_t q = 0; q < quads; ++q) {
+                MeshSubrange sub;
+                sub.index_start = q * 6;
+                sub.index_count = 6;
+                sub.vertex_offset = q;
+                sub.name = "part_" + std::to_string(q);
+                sub.material_name = q % 2 ? "metal" : "";
+                sub.diffuse_path = q % 2 ? "textures/metal.png" : "";
+                sub.diffuse_embedded = q == 2;
+                group.add_region(sub.to_region());
+            }
+            mesh.submeshes = std::move(group);
+        }
+        return mesh;
+    }
+
+    static void expect_same(const MeshData& a, const MeshData& b)
+    {
+        EXPECT_EQ(std::get<std::vector<uint8_t>>(a.vertex_variant), std::get<std::vector<uint8_t>>(b.vertex_variant));
+        EXPECT_EQ(std::get<std::vector<uint32_t>>(a.index_variant), std::get<std::vector<uint32_t>>(b.index_variant));
+        EXPECT_EQ(a.layout.stride_bytes, b.layout.stride_bytes);
+        EXPECT_EQ(a.layout.vertex_count, b.layout.vertex_count);
+
+        ASSERT_EQ(a.layout.attributes.size(), b.layout.attributes.size());
+        for (size_t i = 0; i < a.layout.attributes.size(); ++i) {
+            EXPECT_EQ(a.layout.attributes[i].component_modality, b.layout.attributes[i].component_modality);
+            EXPECT_EQ(a.layout.attributes[i].offset_in_vertex, b.layout.attributes[i].offset_in_vertex);
+            EXPECT_EQ(a.layout.attributes[i].name, b.layout.attributes[i].name);
+        }
+
+        ASSERT_EQ(a.submeshes.has_value(), b.submeshes.has_value());
+        if (!a.submeshes) {
+            return;
+        }
+        EXPECT_EQ(b.submeshes->name, "submeshes");
+        ASSERT_EQ(a.submeshes->regions.size(), b.submeshes->regions.size());
+        for (size_t i = 0; i < a.submeshes->regions.size(); ++i) {
+            const auto& ra = a.submeshes->regions[i];
+            const auto& rb = b.submeshes->regions[i];
+            EXPECT_EQ(ra.start_coordinates, rb.start_coordinates);
+            EXPECT_EQ(ra.end_coordinates, rb.end_coordinates);
+            for (const char* key : { "name", "material_name", "diffuse_path" }) {
+                EXPECT_EQ(ra.get_attribute<std::string>(key), rb.get_attribute<std::string>(key)) << key;
+            }
+            for (const char* key : { "vertex_offset", "index_count" }) {
+                EXPECT_EQ(ra.get_attribute<uint64_t>(key), rb.get_attribute<uint64_t>(key)) << key;
+            }
+            EXPECT_EQ(ra.get_attribute<bool>("diffuse_embedded"), rb.get_attribute<bool>("diffuse_embedded"));
+        }
+    }
+};
+
+TEST_F(MeshCacheTest, TransientCacheNeverStores)
+{
+    write_file(root / "model.obj", "v 0 0 0\n");
+
+    MeshCache cache;
+    EXPECT_FALSE(cache.is_persistent());
+    EXPECT_TRUE(cache.make_key(root / "model.obj", "fp").empty());
+
+    const std::vector meshes { make_mesh(1, false) };
+    EXPECT_FALSE(cache.store("abc", meshes));
+    EXPECT_FALSE(cache.load("abc").has_value());
+}
+
+TEST_F(MeshCacheTest, KeyTracksContentAndFingerprint)
+{
+    write_file(root / "a.obj", "v 0 0 0\n");
+    write_file(root / "b.obj", "v 0 0 0\n");
+    write_file(root / "c.obj", "v 0 0 1\n");
+
+    MeshCache cache(root / "cache");
+    const auto a = cache.make_key(root / "a.obj", "fp");
+
+    EXPECT_EQ(a.size(), 32U);
+    EXPECT_EQ(a, cache.make_key(root / "b.obj", "fp"));
+    EXPECT_NE(a, cache.make_key(root / "c.obj", "fp"));
+    EXPECT_NE(a, cache.make_key(root / "a.obj", "fp2"));
+    EXPECT_TRUE(cache.make_key(root / "missing.obj", "fp").empty());
+}
+
+TEST_F(MeshCacheTest, RoundTripsMeshesAcrossInstances)
+{
+    write_file(root / "model.fbx", "binary model");
+
+    const std::vector meshes { make_mesh(4, true), make_mesh(1, false), make_mesh(7, true) };
+
+    std::string key;
+    {
+        MeshCache cache(root / "cache");
+        key = cache.make_key(root / "model.fbx", "fp");
+        EXPECT_FALSE(cache.load(key).has_value());
+        EXPECT_TRUE(cache.store(key, meshes));
+        EXPECT_EQ(cache.stats().writes, 1U);
+        EXPECT_EQ(cache.stats().misses, 1U);
+    }
+
+    MeshCache cache(root / "cache");
+    EXPECT_TRUE(cache.is_current(key));
+
+    const auto loaded = cache.load(key);
+    ASSERT_TRUE(loaded.has_value());
+    ASSERT_EQ(loaded->size(), meshes.size());
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        expect_same(meshes[i], (*loaded)[i]);
+        EXPECT_TRUE((*loaded)[i].access().has_value());
+    }
+    EXPECT_EQ(cache.stats().hits, 1U);
+    EXPECT_EQ(cache.stats().misses, 0U);
+}
+
+TEST_F(MeshCacheTest, DependencyChangeMakesEntryStale)
+{
+    write_file(root / "model.obj", "mtllib model.mtl\n");
+    write_file(root / "model.mtl", "newmtl a\n");
+
+    MeshCache cache(root / "cache");
+    const auto key = cache.make_key(root / "model.obj", "fp");
+    const std::vector meshes { make_mesh(2, true) };
+    const std::vector<std::filesystem::path> deps { root / "model.mtl" };
+    ASSERT_TRUE(cache.store(key, meshes, deps));
+    EXPECT_TRUE(cache.is_current(key));
+
+    write_file(root / "model.mtl", "newmtl a\nKd 1 0 0\n");
+
+    EXPECT_FALSE(cache.is_current(key));
+    EXPECT_FALSE(cache.load(key).has_value());
+    EXPECT_EQ(cache.stats().stale, 1U);
+    EXPECT_EQ(cache.stats().corrupt, 0U);
+}
+
+TEST_F(MeshCacheTest, CorruptEntryIsDiscarded)
+{
+    write_file(root / "model.obj", "v 0 0 0\n");
+
+    MeshCache cache(root / "cache");
+    const auto key = cache.make_key(root / "model.obj", "fp");
+    const std::vector meshes { make_mesh(2, false) };
+    ASSERT_TRUE(cache.store(key, meshes));
+
+    const auto entry = root / "cache" / (key + ".mfmesh");
+    {
+        std::fstream f(entry, std::ios::binary | std::ios::in | std::ios::out);
+        f.seekp(static_cast<std::streamoff>(std::filesystem::file_size(entry) - 3));
+        f.put('\x5A');
+    }
+
+    EXPECT_FALSE(cache.load(key).has_value());
+    EXPECT_EQ(cache.stats().corrupt, 1U);
+    EXPECT_FALSE(std::filesystem::exists(entry));
+}
+
+TEST_F(MeshCacheTest, TruncatedEntryIsDiscarded)
+{
+    write_file(root / "model.obj", "v 0 0 0\n");
+
+    MeshCache cache(root / "cache");
+    const auto key = cache.make_key(root / "model.obj", "fp");
+    const std::vector meshes { make_mesh(2, false) };
+    ASSERT_TRUE(cache.store(key, meshes));
+
+    const auto entry = root / "cache" / (key + ".mfmesh");
+    std::filesystem::resize_file(entry, std::filesystem::file_size(entry) / 2);
+
+    EXPECT_FALSE(cache.load(key).has_value());
+    EXPECT_EQ(cache.stats().corrupt, 1U);
+}
+
+TEST_F(MeshCacheTest, RejectsInvalidMeshes)
+{
+    MeshCache cache(root / "cache");
+    const std::vector meshes { MeshData::empty() };
+    EXPECT_FALSE(cache.store("0123456789abcdef0123456789abcdef", meshes));
+    EXPECT_EQ(cache.stats().writes, 0U);
+}
+
+TEST_F(MeshCacheTest, ConcurrentWritersLeaveOneValidEntry)
+{
+    write_file(root / "model.obj", "v 0 0 0\n");
+
+    MeshCache cache(root / "cache");
+    const auto key = cache.make_key(root / "model.obj", "fp");
+    const std::vector meshes { make_mesh(16, true) };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] { cache.store(key, meshes); });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    size_t entries = 0;
+    for (const auto& e : std::filesystem::directory_iterator(root / "cache")) {
+        EXPECT_EQ(e.path().extension(), ".mfmesh");
+        ++entries;
+    }
+    EXPECT_EQ(entries, 1U);
+
+    const auto loaded = cache.load(key);
+    ASSERT_TRUE(loaded.has_value());
+    expect_same(meshes[0], loaded->front());
+}
+
+TEST_F(MeshCacheTest, PurgeRemovesEntries)
+{
+    write_file(root / "a.obj", "a");
+    write_file(root / "b.obj", "b");
+
+    MeshCache cache(root / "cache");
+    const std::vector meshes { make_mesh(1, false) };
+    ASSERT_TRUE(cache.store(cache.make_key(root / "a.obj", "fp"), meshes));
+    ASSERT_TRUE(cache.store(cache.make_key(root / "b.obj", "fp"), meshes));
+
+    EXPECT_EQ(cache.purge(), 2U);
+    EXPECT_FALSE(cache.load(cache.make_key(root / "a.obj", "fp")).has_value());
+}
+
+} // namespace MayaFlux::Test
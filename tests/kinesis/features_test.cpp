@@ -0,0 +1,179 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kinesis/Discrete/Features.hpp"
+
+#include <random>
+
+using namespace MayaFlux::Kinesis::Discrete;
+
+namespace MayaFlux::Test {
+
+namespace {
+    constexpr double k_rate = 48000.0;
+
+    std::vector<double> sine(size_t n, double hz, double amplitude = 1.0)
+    {
+        std::vector<double> out(n);
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = amplitude * std::sin(2.0 * std::numbers::pi * hz * static_cast<double>(i) / k_rate);
+        }
+        return out;
+    }
+
+    std::vector<double> noise(size_t n, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        std::vector<double> out(n);
+        for (auto& v : out) {
+            v = dist(rng);
+        }
+        return out;
+    }
+
+    FeatureConfig all_descriptors()
+    {
+        return { .descriptors = { Descriptor::RMS, Descriptor::ZERO_CROSSING_RATE, Descriptor::CENTROID,
+                     Descriptor::SPREAD, Descriptor::FLATNESS, Descriptor::ROLLOFF, Descriptor::FLUX,
+                     Descriptor::ONSET_STRENGTH, Descriptor::MFCC, Descriptor::CHROMA },
+            .window_size = 2048,
+            .hop_size = 512,
+            .sample_rate = k_rate };
+    }
+}
+
+TEST(FeatureEngineTest, LayoutFollowsRequestOrder)
+{
+    FeatureEngine engine({ .descriptors = { Descriptor::CHROMA, Descriptor::RMS, Descriptor::MFCC, Descriptor::RMS },
+        .mfcc_count = 8 });
+
+    const auto& layout = engine.layout();
+    EXPECT_EQ(layout.offset_of(Descriptor::CHROMA), 0U);
+    EXPECT_EQ(layout.offset_of(Descriptor::RMS), 12U);
+    EXPECT_EQ(layout.offset_of(Descriptor::MFCC), 13U);
+    EXPECT_EQ(layout.width_of(Descriptor::MFCC), 8U);
+    EXPECT_FALSE(layout.has(Descriptor::FLUX));
+    EXPECT_EQ(layout.stride, 21U);
+}
+
+TEST(FeatureEngineTest, SineDescriptors)
+{
+    FeatureEngine engine(all_descriptors());
+    const auto track = engine.analyze(sine(48000, 440.0, 0.5));
+    ASSERT_GT(track.frames, 10U);
+
+    const size_t f = track.frames / 2;
+    EXPECT_NEAR(track.value(f, Descriptor::RMS), 0.5 / std::numbers::sqrt2, 1e-3);
+    EXPECT_NEAR(track.value(f, Descriptor::ZERO_CROSSING_RATE), 2.0 * 440.0 / k_rate, 1e-3);
+    EXPECT_NEAR(track.value(f, Descriptor::CENTROID), 440.0, 30.0);
+    EXPECT_LT(track.value(f, Descriptor::SPREAD), 100.0);
+    EXPECT_LT(track.value(f, Descriptor::FLATNESS), 0.01);
+    EXPECT_NEAR(track.value(f, Descriptor::ROLLOFF), 440.0, 30.0);
+    EXPECT_LT(track.value(f, Descriptor::FLUX), 1e-3);
+
+    // A4 is pitch class 9 with C = 0.
+    for (int c = 0; c < 12; ++c) {
+        EXPECT_EQ(track.value(f, Descriptor::CHROMA, c) == 1.0, c == 9) << "class " << c;
+    }
+}
+
+TEST(FeatureEngineTest, NoiseIsFlatAndBright)
+{
+    FeatureEngine engine(all_descriptors());
+    const auto track = engine.analyze(noise(48000, 3));
+
+    const size_t f = track.frames / 2;
+    EXPECT_GT(track.value(f, Descriptor::FLATNESS), 0.3);
+    EXPECT_NEAR(track.value(f, Descriptor::CENTROID), k_rate / 4.0, 1000.0);
+    EXPECT_NEAR(track.value(f, Descriptor::ROLLOFF), 0.85 * k_rate / 2.0, 1000.0);
+
+    const auto tone = FeatureEngine(all_descriptors()).analyze(sine(48000, 440.0));
+    EXPECT_GT(track.value(f, Descriptor::ZERO_CROSSING_RATE), tone.value(f, Descriptor::ZERO_CROSSING_RATE));
+    // Higher cepstral coefficients describe spectral shape; a flat spectrum has little of it.
+    EXPECT_LT(std::abs(track.value(f, Descriptor::MFCC, 1)), std::abs(tone.value(f, Descriptor::MFCC, 1)));
+}
+
+TEST(FeatureEngineTest, FluxAndOnsetPeakAtStep)
+{
+    std::vector<double> signal(48000, 0.0);
+    const auto burst = noise(24000, 7);
+    std::ranges::copy(burst, signal.begin() + 24000);
+
+    FeatureEngine engine({ .descriptors = { Descriptor::FLUX, Descriptor::ONSET_STRENGTH }, .sample_rate = k_rate });
+    const auto track = engine.analyze(signal);
+
+    const auto flux = track.column(Descriptor::FLUX);
+    const auto onset = track.column(Descriptor::ONSET_STRENGTH);
+    const auto flux_peak = static_cast<size_t>(std::ranges::max_element(flux) - flux.begin());
+    const auto onset_peak = static_cast<size_t>(std::ranges::max_element(onset) - onset.begin());
+
+    const double step_time = 24000.0 / k_rate;
+    const double tolerance = static_cast<double>(engine.config().window_size) / k_rate;
+    EXPECT_NEAR(track.time_of(flux_peak, engine.config().window_size), step_time, tolerance);
+    EXPECT_NEAR(track.time_of(onset_peak, engine.config().window_size), step_time, tolerance);
+    EXPECT_EQ(flux.front(), 0.0);
+    EXPECT_EQ(onset.front(), 0.0);
+}
+
+TEST(FeatureEngineTest, StreamingMatchesOffline)
+{
+    const auto signal = noise(20000, 11);
+    FeatureEngine offline(all_descriptors());
+    const auto track = offline.analyze(signal);
+
+    // Streaming frame k covers samples [k*hop - (N - hop), (k+1)*hop); offline frame j starts at j*hop.
+    FeatureEngine streaming(all_descriptors());
+    const uint32_t N = streaming.config().window_size;
+    const uint32_t H = streaming.config().hop_size;
+    const size_t skip = N / H - 1;
+
+    std::vector<std::vector<double>> frames;
+    for (size_t i = 0; i < signal.size(); i += 300) {
+        const auto block = std::span(signal).subspan(i, std::min<size_t>(300, signal.size() - i));
+        streaming.process(block, [&](std::span<const double> frame) {
+            frames.emplace_back(frame.begin(), frame.end());
+        });
+    }
+
+    ASSERT_GT(frames.size(), skip + 10);
+    const auto& layout = offline.layout();
+    for (size_t k = skip + 1; k < skip + 10; ++k) {
+        const auto expected = track.frame(k - skip);
+        for (size_t i = 0; i < layout.stride; ++i) {
+            EXPECT_NEAR(frames[k][i], expected[i], 1e-9 * (1.0 + std::abs(expected[i]))) << "frame " << k << " slot " << i;
+        }
+    }
+    EXPECT_EQ(std::vector<double>(streaming.latest().begin(), streaming.latest().end()), frames.back());
+}
+
+TEST(FeatureEngineTest, StridedInputMatchesPlanar)
+{
+    const auto left = sine(8192, 1000.0);
+    const auto right = noise(8192, 5);
+    std::vector<double> interleaved(left.size() * 2);
+    for (size_t i = 0; i < left.size(); ++i) {
+        interleaved[2 * i] = left[i];
+        interleaved[2 * i + 1] = right[i];
+    }
+
+    FeatureEngine engine(all_descriptors());
+    const auto planar = engine.analyze(right);
+    const auto strided = engine.analyze(std::span<const double>(interleaved).subspan(1), 2);
+    ASSERT_EQ(planar.frames, strided.frames);
+    EXPECT_EQ(planar.values, strided.values);
+}
+
+TEST(FeatureEngineTest, ShortSignalYieldsOneFrame)
+{
+    FeatureEngine engine({ .descriptors = { Descriptor::RMS }, .window_size = 1024 });
+    const auto track = engine.analyze(std::vector<double>(100, 1.0));
+    ASSERT_EQ(track.frames, 1U);
+    EXPECT_NEAR(track.value(0, Descriptor::RMS), std::sqrt(100.0 / 1024.0), 1e-12);
+}
+
+TEST(FeatureEngineTest, RejectsBadWindow)
+{
+    EXPECT_THROW(FeatureEngine({ .window_size = 1000 }), std::invalid_argument);
+}
+
+} // namespace MayaFlux::Test
@@ -0,0 +1,207 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kinesis/Spatial/Delaunay.hpp"
+#include "MayaFlux/Kinesis/Spatial/ProximityGraphs.hpp"
+
+#include <random>
+
+using namespace MayaFlux::Kinesis;
+
+namespace MayaFlux::Test {
+
+namespace {
+    Eigen::MatrixXd random_points(Eigen::Index dims, Eigen::Index n, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> d(-5.0, 5.0);
+        Eigen::MatrixXd pts(dims, n);
+        for (Eigen::Index i = 0; i < n; ++i) {
+            for (Eigen::Index a = 0; a < dims; ++a) {
+                pts(a, i) = d(rng);
+            }
+        }
+        return pts;
+    }
+
+    Eigen::MatrixXd grid_points(int side)
+    {
+        Eigen::MatrixXd pts(2, side * side);
+        for (int y = 0; y < side; ++y) {
+            for (int x = 0; x < side; ++x) {
+                pts(0, y * side + x) = x;
+                pts(1, y * side + x) = y;
+            }
+        }
+        return pts;
+    }
+
+    double dist_sq(const Eigen::MatrixXd& pts, size_t i, size_t j)
+    {
+        return (pts.col(static_cast<Eigen::Index>(i)) - pts.col(static_cast<Eigen::Index>(j))).squaredNorm();
+    }
+
+    EdgeList brute_gabriel(const Eigen::MatrixXd& pts)
+    {
+        EdgeList edges;
+        const auto n = static_cast<size_t>(pts.cols());
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = i + 1; j < n; ++j) {
+                const double pq = dist_sq(pts, i, j);
+                bool keep = true;
+                for (size_t r = 0; r < n && keep; ++r) {
+                    const double pr = dist_sq(pts, i, r);
+                    const double qr = dist_sq(pts, j, r);
+                    keep = r == i || r == j || pr == 0.0 || qr == 0.0 || pr + qr > pq;
+                }
+                if (keep) {
+                    edges.emplace_back(i, j);
+                }
+            }
+        }
+        return edges;
+    }
+
+    EdgeList brute_relative(const Eigen::MatrixXd& pts)
+    {
+        EdgeList edges;
+        const auto n = static_cast<size_t>(pts.cols());
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = i + 1; j < n; ++j) {
+                const double pq = dist_sq(pts, i, j);
+                bool keep = true;
+                for (size_t r = 0; r < n && keep; ++r) {
+                    keep = r == i || r == j || std::max(dist_sq(pts, i, r), dist_sq(pts, j, r)) >= pq;
+                }
+                if (keep) {
+                    edges.emplace_back(i, j);
+                }
+            }
+        }
+        return edges;
+    }
+
+    double tree_length(const Eigen::MatrixXd& pts, const EdgeList& edges)
+    {
+        double total = 0.0;
+        for (const auto& [i, j] : edges) {
+            total += std::sqrt(dist_sq(pts, i, j));
+        }
+        return total;
+    }
+
+    bool is_spanning_tree(size_t n, const EdgeList& edges)
+    {
+        if (edges.size() != n - 1) {
+            return false;
+        }
+        std::vector<size_t> parent(n);
+        std::iota(parent.begin(), parent.end(), size_t { 0 });
+        auto find = [&](size_t x) {
+            while (parent[x] != x) {
+                x = parent[x] = parent[parent[x]];
+            }
+            return x;
+        };
+        for (const auto& [i, j] : edges) {
+            const size_t a = find(i);
+            const size_t b = find(j);
+            if (a == b) {
+                return false;
+            }
+            parent[a] = b;
+        }
+        return true;
+    }
+
+    void expect_graphs_match_brute(const Eigen::MatrixXd& pts)
+    {
+        EXPECT_EQ(gabriel_graph(pts), brute_gabriel(pts));
+        EXPECT_EQ(relative_neighborhood_graph(pts), brute_relative(pts));
+
+        const EdgeList mst = minimum_spanning_tree(pts);
+        EXPECT_TRUE(is_spanning_tree(static_cast<size_t>(pts.cols()), mst));
+
+        Eigen::MatrixXd high(4, pts.cols());
+        high.setZero();
+        high.topRows(pts.rows()) = pts;
+        EXPECT_NEAR(tree_length(pts, mst), tree_length(high, minimum_spanning_tree(high)), 1e-9);
+    }
+}
+
+TEST(ProximityGraphsTest, KNearestMatchesBruteForce)
+{
+    const Eigen::MatrixXd pts = random_points(3, 800, 1);
+    const size_t k = 6;
+    const EdgeList edges = k_nearest_neighbors(pts, k);
+    ASSERT_EQ(edges.size(), 800 * k);
+
+    for (size_t i = 0; i < 800; ++i) {
+        std::vector<std::pair<double, size_t>> all;
+        for (size_t j = 0; j < 800; ++j) {
+            if (j != i) {
+                all.emplace_back(dist_sq(pts, i, j), j);
+            }
+        }
+        std::ranges::sort(all);
+        for (size_t m = 0; m < k; ++m) {
+            EXPECT_EQ(edges[i * k + m], std::make_pair(i, all[m].second));
+        }
+    }
+
+    const EdgeList nearest = nearest_neighbor_graph(pts);
+    ASSERT_EQ(nearest.size(), 800U);
+    for (size_t i = 0; i < 800; ++i) {
+        EXPECT_EQ(nearest[i], edges[i * k]);
+    }
+}
+
+TEST(ProximityGraphsTest, RadiusGraphMatchesBruteForce)
+{
+    const Eigen::MatrixXd pts = random_points(2, 1000, 2);
+    EdgeList expected;
+    for (size_t i = 0; i < 1000; ++i) {
+        for (size_t j = i + 1; j < 1000; ++j) {
+            if (dist_sq(pts, i, j) <= 0.6 * 0.6) {
+                expected.emplace_back(i, j);
+            }
+        }
+    }
+    EXPECT_EQ(radius_threshold_graph(pts, 0.6), expected);
+}
+
+TEST(ProximityGraphsTest, DelaunayGraphsMatchBruteForce2D)
+{
+    expect_graphs_match_brute(random_points(2, 400, 3));
+}
+
+TEST(ProximityGraphsTest, DelaunayGraphsMatchBruteForce3D)
+{
+    expect_graphs_match_brute(random_points(3, 300, 4));
+}
+
+TEST(ProximityGraphsTest, DegenerateInputs)
+{
+    // Cocircular grid: square diagonals lie on the diametral circle and are excluded.
+    expect_graphs_match_brute(grid_points(12));
+
+    Eigen::MatrixXd dup = random_points(2, 60, 5);
+    dup.col(10) = dup.col(3);
+    dup.col(20) = dup.col(3);
+    dup.col(41) = dup.col(7);
+    expect_graphs_match_brute(dup);
+
+    Eigen::MatrixXd line(1, 40);
+    for (Eigen::Index i = 0; i < 40; ++i) {
+        line(0, i) = static_cast<double>((i * 17) % 40);
+    }
+    expect_graphs_match_brute(line);
+
+    Eigen::MatrixXd collinear(3, 33);
+    for (Eigen::Index i = 0; i < 33; ++i) {
+        collinear.col(i) = Eigen::Vector3d(1.0, 0.5, 0.25) * static_cast<double>((i * 7) % 33);
+    }
+    EXPECT_EQ(delaunay_edges(collinear).size(), 32U);
+    expect_graphs_match_brute(collinear);
+}
+
+}
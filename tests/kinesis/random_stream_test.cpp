@@ -0,0 +1,206 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kinesis/RandomStream.hpp"
+#include "MayaFlux/Kinesis/Stochastic.hpp"
+
+using namespace MayaFlux::Kinesis::Stochastic;
+
+namespace MayaFlux::Test {
+
+namespace {
+    struct Moments {
+        double mean {};
+        double variance {};
+    };
+
+    Moments moments(std::span<const double> values)
+    {
+        Moments m;
+        for (double v : values) {
+            m.mean += v;
+        }
+        m.mean /= static_cast<double>(values.size());
+        for (double v : values) {
+            m.variance += (v - m.mean) * (v - m.mean);
+        }
+        m.variance /= static_cast<double>(values.size() - 1);
+        return m;
+    }
+
+    double normal_cdf(double x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); }
+
+    /// Largest gap between the empirical CDF of @p values and @p cdf.
+    template <typename Cdf>
+    double ks_distance(std::vector<double> values, Cdf cdf)
+    {
+        std::ranges::sort(values);
+        const auto n = static_cast<double>(values.size());
+        double d = 0.0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            const double f = cdf(values[i]);
+            d = std::max({ d, f - static_cast<double>(i) / n, static_cast<double>(i + 1) / n - f });
+        }
+        return d;
+    }
+}
+
+TEST(RandomStreamTest, SameSeedAndStreamReproduce)
+{
+    RandomStream a(42, 3);
+    RandomStream b(42, 3);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(a.next(), b.next());
+    }
+
+    a.seed(42, 3);
+    RandomStream c(42, 3);
+    EXPECT_EQ(a.next(), c.next());
+}
+
+TEST(RandomStreamTest, StreamsAreDistinct)
+{
+    RandomStream a(42, 0);
+    RandomStream b(42, 1);
+    RandomStream c(43, 0);
+
+    int equal_ab = 0;
+    int equal_ac = 0;
+    for (int i = 0; i < 1000; ++i) {
+        const uint64_t x = a.next();
+        equal_ab += x == b.next() ? 1 : 0;
+        equal_ac += x == c.next() ? 1 : 0;
+    }
+    EXPECT_EQ(equal_ab, 0);
+    EXPECT_EQ(equal_ac, 0);
+
+    // Correlation between two voices of one seed should be negligible.
+    std::vector<double> u(20000);
+    std::vector<double> v(20000);
+    RandomStream(7, 0).fill_uniform(std::span(u), -1.0, 1.0);
+    RandomStream(7, 1).fill_uniform(std::span(v), -1.0, 1.0);
+    double dot = 0.0;
+    for (size_t i = 0; i < u.size(); ++i) {
+        dot += u[i] * v[i];
+    }
+    EXPECT_LT(std::abs(dot / static_cast<double>(u.size())), 0.02);
+}
+
+TEST(RandomStreamTest, BlockFillMatchesScalarSequence)
+{
+    RandomStream scalar(99);
+    RandomStream block(99);
+
+    // Misalign the lane cursor so the block path must realign first.
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ(scalar.next(), block.next());
+    }
+
+    std::vector<uint64_t> bits(1027);
+    block.fill_bits(bits);
+    for (uint64_t word : bits) {
+        ASSERT_EQ(word, scalar.next());
+    }
+
+    std::vector<double> unit(515);
+    block.fill_uniform(std::span(unit), 0.0, 1.0);
+    for (double x : unit) {
+        ASSERT_EQ(x, scalar.uniform());
+    }
+    EXPECT_EQ(block.next(), scalar.next());
+}
+
+TEST(RandomStreamTest, UniformCoversRange)
+{
+    RandomStream rng(5);
+    std::vector<double> values(100000);
+    rng.fill_uniform(std::span(values), -2.0, 3.0);
+
+    for (double v : values) {
+        ASSERT_GE(v, -2.0);
+        ASSERT_LT(v, 3.0);
+    }
+    const auto m = moments(values);
+    EXPECT_NEAR(m.mean, 0.5, 0.03);
+    EXPECT_NEAR(m.variance, 25.0 / 12.0, 0.05);
+    EXPECT_LT(ks_distance(values, [](double x) { return (x + 2.0) / 5.0; }), 0.01);
+
+    std::vector<float> floats(10000);
+    rng.fill_uniform(std::span(floats), 0.0F, 1.0F);
+    for (float f : floats) {
+        ASSERT_GE(f, 0.0F);
+        ASSERT_LT(f, 1.0F);
+    }
+}
+
+TEST(RandomStreamTest, NormalMatchesDistribution)
+{
+    RandomStream rng(11);
+    std::vector<double> values(200000);
+    rng.fill_normal(values, 1.0, 2.0);
+
+    const auto m = moments(values);
+    EXPECT_NEAR(m.mean, 1.0, 0.02);
+    EXPECT_NEAR(m.variance, 4.0, 0.05);
+    EXPECT_LT(ks_distance(values, [](double x) { return normal_cdf((x - 1.0) / 2.0); }), 0.006);
+
+    std::vector<double> scalar(200000);
+    for (auto& v : scalar) {
+        v = rng.normal();
+    }
+    EXPECT_LT(ks_distance(scalar, normal_cdf), 0.006);
+
+    // Tail mass beyond the ziggurat base (|z| > 3.44) is about 5.8e-4.
+    const auto tail = std::ranges::count_if(scalar, [](double z) { return std::abs(z) > 3.442619855899; });
+    EXPECT_NEAR(static_cast<double>(tail) / static_cast<double>(scalar.size()), 5.76e-4, 2.5e-4);
+}
+
+TEST(RandomStreamTest, ExponentialMatchesDistribution)
+{
+    RandomStream rng(13);
+    std::vector<double> values(200000);
+    rng.fill_exponential(values, 4.0);
+
+    for (double v : values) {
+        ASSERT_GE(v, 0.0);
+    }
+    const auto m = moments(values);
+    EXPECT_NEAR(m.mean, 0.25, 0.005);
+    EXPECT_NEAR(m.variance, 0.0625, 0.003);
+    EXPECT_LT(ks_distance(values, [](double x) { return 1.0 - std::exp(-4.0 * x); }), 0.006);
+}
+
+TEST(RandomStreamTest, JumpLeavesSequence)
+{
+    RandomStream a(21);
+    RandomStream b(21);
+    b.jump();
+
+    std::vector<uint64_t> first(4096);
+    std::vector<uint64_t> second(4096);
+    a.fill_bits(first);
+    b.fill_bits(second);
+    std::ranges::sort(first);
+    std::ranges::sort(second);
+
+    std::vector<uint64_t> shared;
+    std::ranges::set_intersection(first, second, std::back_inserter(shared));
+    EXPECT_TRUE(shared.empty());
+}
+
+TEST(RandomStreamTest, StochasticFillIsReproducible)
+{
+    Stochastic a(Algorithm::NORMAL);
+    Stochastic b(Algorithm::NORMAL);
+    a.seed(1234, 2);
+    b.seed(1234, 2);
+
+    std::vector<double> x(512);
+    a.fill(x, -1.0, 1.0, 0.5);
+    const auto y = b.batch(-1.0, 1.0, 512);
+    for (size_t i = 0; i < x.size(); ++i) {
+        ASSERT_DOUBLE_EQ(x[i], y[i] * 0.5);
+        ASSERT_LE(std::abs(x[i]), 0.5);
+    }
+}
+
+} // namespace MayaFlux::Test
@@ -0,0 +1,132 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kinesis/GeometryPrimitives.hpp"
+#include "MayaFlux/Kinesis/SDFMesher.hpp"
+
+using namespace MayaFlux::Kinesis;
+
+namespace MayaFlux::Test {
+
+namespace {
+    SpatialField sphere(glm::vec3 center, float radius)
+    {
+        return { .fn = [center, radius](const glm::vec3& p) { return glm::length(p - center) - radius; } };
+    }
+
+    struct Mesh {
+        std::vector<Kakshya::MeshVertex> vertices;
+        std::vector<uint32_t> indices;
+    };
+
+    Mesh unpack(const Kakshya::MeshData& data)
+    {
+        Mesh m;
+        const auto& bytes = std::get<std::vector<uint8_t>>(data.vertex_variant);
+        m.vertices.resize(bytes.size() / sizeof(Kakshya::MeshVertex));
+        std::memcpy(m.vertices.data(), bytes.data(), m.vertices.size() * sizeof(Kakshya::MeshVertex));
+        m.indices = std::get<std::vector<uint32_t>>(data.index_variant);
+        return m;
+    }
+
+    void expect_identical(const Mesh& a, const Mesh& b)
+    {
+        ASSERT_EQ(a.vertices.size(), b.vertices.size());
+        ASSERT_EQ(a.indices, b.indices);
+        for (size_t i = 0; i < a.vertices.size(); ++i) {
+            EXPECT_EQ(a.vertices[i].position.x, b.vertices[i].position.x);
+            EXPECT_EQ(a.vertices[i].position.y, b.vertices[i].position.y);
+            EXPECT_EQ(a.vertices[i].position.z, b.vertices[i].position.z);
+            EXPECT_EQ(a.vertices[i].normal.z, b.vertices[i].normal.z);
+        }
+    }
+}
+
+TEST(SDFMesherTest, WeldedSphereIsClosed)
+{
+    SDFMeshStats stats;
+    const Mesh m = unpack(generate_sdf_mesh(sphere(glm::vec3(0.1F, -0.05F, 0.02F), 1.0F),
+        glm::vec3(-1.5F), glm::vec3(1.5F), 37, 37, 37, 0.0F, SDFMeshOptions { .brick_size = 5 }, &stats));
+
+    ASSERT_FALSE(m.indices.empty());
+    EXPECT_EQ(stats.triangles * 3, m.indices.size());
+    EXPECT_LT(m.vertices.size() * 4, m.indices.size());
+
+    // Every edge of a closed surface borders exactly two triangles.
+    std::map<std::pair<uint32_t, uint32_t>, int> edge_use;
+    for (size_t t = 0; t < m.indices.size(); t += 3) {
+        for (int e = 0; e < 3; ++e) {
+            const auto [a, b] = std::minmax(m.indices[t + e], m.indices[t + (e + 1) % 3]);
+            ++edge_use[{ a, b }];
+        }
+    }
+    for (const auto& [edge, uses] : edge_use) {
+        EXPECT_EQ(uses, 2);
+    }
+
+    for (const auto& v : m.vertices) {
+        EXPECT_NEAR(glm::length(v.position - glm::vec3(0.1F, -0.05F, 0.02F)), 1.0F, 0.01F);
+    }
+}
+
+TEST(SDFMesherTest, UnweldedMatchesWeldedTriangles)
+{
+    const auto field = sphere(glm::vec3(0.0F), 0.8F);
+    const Mesh welded = unpack(generate_sdf_mesh(field, glm::vec3(-1.0F), glm::vec3(1.0F), 20, 20, 20, 0.0F, SDFMeshOptions {}));
+    const Mesh flat = unpack(generate_sdf_mesh(field, glm::vec3(-1.0F), glm::vec3(1.0F), 20, 20, 20, 0.0F,
+        SDFMeshOptions { .weld_vertices = false }));
+
+    ASSERT_EQ(flat.vertices.size(), welded.indices.size());
+    for (size_t i = 0; i < welded.indices.size(); ++i) {
+        EXPECT_EQ(flat.indices[i], i);
+        EXPECT_EQ(flat.vertices[i].position.x, welded.vertices[welded.indices[i]].position.x);
+    }
+}
+
+TEST(SDFMesherTest, SparseSkippingMatchesDense)
+{
+    const auto field = sphere(glm::vec3(0.3F, 0.0F, -0.2F), 0.5F);
+
+    SDFMeshStats dense_stats;
+    SDFMeshStats sparse_stats;
+    const Mesh dense = unpack(generate_sdf_mesh(field, glm::vec3(-2.0F), glm::vec3(2.0F), 64, 64, 64, 0.0F,
+        SDFMeshOptions {}, &dense_stats));
+    const Mesh sparse = unpack(generate_sdf_mesh(field, glm::vec3(-2.0F), glm::vec3(2.0F), 64, 64, 64, 0.0F,
+        SDFMeshOptions { .lipschitz = 1.0F }, &sparse_stats));
+
+    expect_identical(dense, sparse);
+    EXPECT_EQ(dense_stats.field_evaluations, 67U * 67U * 67U);
+    EXPECT_GT(sparse_stats.bricks_skipped, sparse_stats.bricks_total / 2);
+    EXPECT_LT(sparse_stats.field_evaluations * 5, dense_stats.field_evaluations);
+}
+
+TEST(SDFMesherTest, IncrementalMatchesFullRebuild)
+{
+    // The blob's influence is clamped to 0.7 of its centre, so moving it only
+    // changes the field near its old and new positions.
+    auto blob = std::make_shared<glm::vec3>(-0.6F, 0.0F, 0.0F);
+    const SpatialField field { .fn = [blob](const glm::vec3& p) {
+        const float a = glm::length(p - glm::vec3(0.7F, 0.2F, 0.0F)) - 0.4F;
+        const float b = std::min(glm::length(p - *blob) - 0.3F, 0.4F);
+        return std::min(a, b);
+    } };
+
+    const SDFMeshOptions options { .brick_size = 6, .lipschitz = 1.0F };
+    SDFMesher mesher(glm::vec3(-1.5F), glm::vec3(1.5F), 48, 48, 48, 0.0F, options);
+    mesher.set_field(field);
+    (void)mesher.extract();
+
+    const glm::vec3 before = *blob;
+    *blob = glm::vec3(-0.5F, -0.3F, 0.1F);
+    mesher.invalidate_region(glm::min(before, *blob) - glm::vec3(0.7F), glm::max(before, *blob) + glm::vec3(0.7F));
+    const Mesh incremental = unpack(mesher.extract());
+
+    EXPECT_LT(mesher.stats().bricks_meshed * 8, mesher.stats().bricks_total);
+    EXPECT_GT(mesher.stats().bricks_meshed, 0U);
+
+    SDFMesher fresh(glm::vec3(-1.5F), glm::vec3(1.5F), 48, 48, 48, 0.0F, options);
+    fresh.set_field(field);
+    expect_identical(incremental, unpack(fresh.extract()));
+    EXPECT_LT(mesher.stats().field_evaluations, fresh.stats().field_evaluations);
+}
+
+}
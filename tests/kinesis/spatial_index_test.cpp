@@ -0,0 +1,259 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kinesis/Spatial/SpatialIndex.hpp"
+
+#include <random>
+
+using namespace MayaFlux::Kinesis;
+
+namespace MayaFlux::Test {
+
+namespace {
+    std::vector<glm::vec3> random_points(size_t n, float extent, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> d(-extent, extent);
+        std::vector<glm::vec3> pts(n);
+        for (auto& p : pts) {
+            p = glm::vec3(d(rng), d(rng), d(rng));
+        }
+        return pts;
+    }
+
+    float sq(const glm::vec3& a, const glm::vec3& b)
+    {
+        const glm::vec3 d = a - b;
+        return d.x * d.x + d.y * d.y + d.z * d.z;
+    }
+
+    std::vector<float> brute_knn(const std::vector<glm::vec3>& pts, const glm::vec3& q, uint32_t k)
+    {
+        std::vector<float> d;
+        d.reserve(pts.size());
+        for (const auto& p : pts) {
+            d.push_back(sq(p, q));
+        }
+        std::ranges::sort(d);
+        d.resize(std::min<size_t>(k, d.size()));
+        return d;
+    }
+
+    std::vector<uint32_t> brute_radius(const std::vector<glm::vec3>& pts, const glm::vec3& q, float r)
+    {
+        std::vector<uint32_t> ids;
+        for (uint32_t i = 0; i < pts.size(); ++i) {
+            if (sq(pts[i], q) <= r * r) {
+                ids.push_back(i);
+            }
+        }
+        return ids;
+    }
+
+    std::vector<uint32_t> sorted_ids(std::span<const QueryResult> results)
+    {
+        std::vector<uint32_t> ids;
+        for (const auto& r : results) {
+            ids.push_back(r.id);
+        }
+        std::ranges::sort(ids);
+        return ids;
+    }
+
+    void expect_matches_brute(const SpatialIndex3D& index, const std::vector<glm::vec3>& pts,
+        const std::vector<glm::vec3>& queries, float radius, uint32_t k)
+    {
+        for (const auto& q : queries) {
+            EXPECT_EQ(sorted_ids(index.within_radius(q, radius)), brute_radius(pts, q, radius));
+
+            const auto knn = index.k_nearest(q, k);
+            const auto expected = brute_knn(pts, q, k);
+            ASSERT_EQ(knn.size(), expected.size());
+            for (size_t i = 0; i < knn.size(); ++i) {
+                EXPECT_FLOAT_EQ(knn[i].distance_sq, expected[i]);
+            }
+        }
+    }
+}
+
+TEST(SpatialIndexTest, DenseGridMatchesBruteForce)
+{
+    const auto pts = random_points(5000, 10.F, 1);
+    auto index = make_spatial_index_3d(1.F);
+    for (const auto& p : pts) {
+        index->insert(p);
+    }
+    index->publish();
+
+    auto queries = random_points(50, 12.F, 2);
+    queries.emplace_back(100.F, 0.F, 0.F);
+    expect_matches_brute(*index, pts, queries, 1.7F, 16);
+}
+
+TEST(SpatialIndexTest, SparseOutliersUseHashedGrid)
+{
+    auto pts = random_points(2000, 5.F, 3);
+    pts.emplace_back(1.0e5F, 0.F, 0.F);
+    pts.emplace_back(0.F, -1.0e5F, 3.F);
+
+    auto index = make_spatial_index_3d(0.5F);
+    for (const auto& p : pts) {
+        index->insert(p);
+    }
+    index->publish();
+
+    auto queries = random_points(40, 6.F, 4);
+    queries.emplace_back(9.0e4F, 0.F, 0.F);
+    expect_matches_brute(*index, pts, queries, 1.2F, 8);
+}
+
+TEST(SpatialIndexTest, KNearestAcrossEmptySpace)
+{
+    const std::vector<glm::vec3> pts {
+        { 0.F, 0.F, 0.F }, { 50.F, 0.F, 0.F }, { 0.F, 80.F, 0.F }, { 0.F, 0.F, -120.F }
+    };
+    auto index = make_spatial_index_3d(1.F);
+    for (const auto& p : pts) {
+        index->insert(p);
+    }
+    index->publish();
+
+    const auto knn = index->k_nearest(glm::vec3(49.F, 1.F, 0.F), 10);
+    ASSERT_EQ(knn.size(), 4U);
+    EXPECT_EQ(knn[0].id, 1U);
+    EXPECT_EQ(knn[1].id, 0U);
+    EXPECT_FLOAT_EQ(knn[0].distance_sq, 2.F);
+}
+
+TEST(SpatialIndexTest, KNearestHonoursCustomDistance)
+{
+    // Squashes the y axis, so a far point along y is nearer than the grid's
+    // Euclidean ring bound admits.
+    SpatialIndex3D index(1.F, [](const glm::vec3& a, const glm::vec3& b) {
+        const glm::vec3 d = a - b;
+        return d.x * d.x + 0.01F * d.y * d.y + d.z * d.z;
+    });
+    const uint32_t origin = index.insert(glm::vec3(0.F));
+    const uint32_t far_y = index.insert(glm::vec3(0.F, 20.F, 0.F));
+    index.insert(glm::vec3(3.F, 0.F, 0.F));
+    index.publish();
+
+    const auto knn = index.k_nearest(glm::vec3(0.F), 2);
+    ASSERT_EQ(knn.size(), 2U);
+    EXPECT_EQ(knn[0].id, origin);
+    EXPECT_EQ(knn[1].id, far_y);
+    EXPECT_FLOAT_EQ(knn[1].distance_sq, 4.F);
+}
+
+TEST(SpatialIndexTest, BatchQueriesMatchSingleQueries)
+{
+    const auto pts = random_points(3000, 8.F, 5);
+    auto index = make_spatial_index_3d(1.F);
+    for (const auto& p : pts) {
+        index->insert(p);
+    }
+    index->publish();
+
+    const auto queries = random_points(300, 8.F, 6);
+
+    const auto radius = index->within_radius_batch(queries, 1.5F);
+    const auto knn = index->k_nearest_batch(queries, 5);
+    ASSERT_EQ(radius.size(), queries.size());
+    ASSERT_EQ(knn.size(), queries.size());
+
+    for (size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(sorted_ids(radius[i]), sorted_ids(index->within_radius(queries[i], 1.5F)));
+
+        const auto single = index->k_nearest(queries[i], 5);
+        ASSERT_EQ(knn[i].size(), single.size());
+        for (size_t j = 0; j < single.size(); ++j) {
+            EXPECT_FLOAT_EQ(knn[i][j].distance_sq, single[j].distance_sq);
+        }
+    }
+}
+
+TEST(SpatialIndexTest, WithinRadiusIntoReusedVector)
+{
+    const auto pts = random_points(2000, 8.F, 9);
+    auto index = make_spatial_index_3d(1.F);
+    for (const auto& p : pts) {
+        index->insert(p);
+    }
+    index->publish();
+
+    std::vector<QueryResult> out;
+    for (const auto& q : random_points(50, 8.F, 10)) {
+        index->within_radius(q, 2.F, out);
+        EXPECT_EQ(sorted_ids(out), sorted_ids(index->within_radius(q, 2.F)));
+    }
+
+    const auto* data = out.data();
+    index->within_radius(glm::vec3(100.F), 0.5F, out);
+    EXPECT_TRUE(out.empty());
+    EXPECT_EQ(out.data(), data);
+}
+
+TEST(SpatialIndexTest, UpdatesAndRemovalsAppearAfterPublish)
+{
+    auto index = make_spatial_index_3d(1.F);
+    const uint32_t a = index->insert(glm::vec3(0.F));
+    const uint32_t b = index->insert(glm::vec3(5.F, 0.F, 0.F));
+    index->publish();
+
+    index->update(b, glm::vec3(0.5F, 0.F, 0.F));
+    index->remove(a);
+    EXPECT_EQ(index->count(), 2U);
+
+    index->publish();
+    EXPECT_EQ(index->count(), 1U);
+    EXPECT_FALSE(index->position_of(a).has_value());
+
+    const auto near = index->within_radius(glm::vec3(0.F), 1.F);
+    ASSERT_EQ(near.size(), 1U);
+    EXPECT_EQ(near[0].id, b);
+}
+
+TEST(SpatialIndexTest, LowDimensionalGridMatchesBruteForce)
+{
+    constexpr uint32_t dims = 4;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> d(-3.0, 3.0);
+
+    auto index = make_spatial_index_nd(0.75F, dims);
+    std::vector<Eigen::VectorXd> pts;
+    for (int i = 0; i < 1500; ++i) {
+        Eigen::VectorXd p(dims);
+        for (uint32_t a = 0; a < dims; ++a) {
+            p(a) = d(rng);
+        }
+        pts.push_back(p);
+        index->insert(p);
+    }
+    index->publish();
+
+    for (int q = 0; q < 20; ++q) {
+        Eigen::VectorXd c(dims);
+        for (uint32_t a = 0; a < dims; ++a) {
+            c(a) = d(rng);
+        }
+
+        std::vector<uint32_t> expected;
+        std::vector<float> dist;
+        for (uint32_t i = 0; i < pts.size(); ++i) {
+            const auto d_sq = static_cast<float>((pts[i] - c).squaredNorm());
+            dist.push_back(d_sq);
+            if (d_sq <= 1.F) {
+                expected.push_back(i);
+            }
+        }
+        EXPECT_EQ(sorted_ids(index->within_radius(c, 1.F)), expected);
+
+        std::ranges::sort(dist);
+        const auto knn = index->k_nearest(c, 6);
+        ASSERT_EQ(knn.size(), 6U);
+        for (size_t i = 0; i < knn.size(); ++i) {
+            EXPECT_FLOAT_EQ(knn[i].distance_sq, dist[i]);
+        }
+    }
+}
+
+}
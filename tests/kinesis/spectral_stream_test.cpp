@@ -0,0 +1,205 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kinesis/Discrete/SpectralStream.hpp"
+
+#include <random>
+
+using namespace MayaFlux::Kinesis::Discrete;
+
+namespace MayaFlux::Test {
+
+namespace {
+    std::vector<double> sine(size_t n, double cycles_per_sample, double amplitude = 1.0)
+    {
+        std::vector<double> out(n);
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = amplitude * std::sin(2.0 * std::numbers::pi * cycles_per_sample * static_cast<double>(i));
+        }
+        return out;
+    }
+
+    std::vector<double> noise(size_t n, uint32_t seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<double> dist(-1.0, 1.0);
+        std::vector<double> out(n);
+        for (auto& v : out) {
+            v = dist(rng);
+        }
+        return out;
+    }
+
+    /// Goertzel power of @p x at @p cycles_per_sample.
+    double tone_power(std::span<const double> x, double cycles_per_sample)
+    {
+        const double w = 2.0 * std::numbers::pi * cycles_per_sample;
+        const double coeff = 2.0 * std::cos(w);
+        double s1 = 0.0;
+        double s2 = 0.0;
+        for (double v : x) {
+            const double s0 = v + coeff * s1 - s2;
+            s2 = s1;
+            s1 = s0;
+        }
+        return (s1 * s1 + s2 * s2 - coeff * s1 * s2) / static_cast<double>(x.size() * x.size());
+    }
+
+    /// Feed @p input through @p stft in blocks of @p block samples.
+    std::vector<double> run(StreamingSTFT& stft, std::vector<double> input, size_t block, const SpectrumProcessor& processor)
+    {
+        for (size_t i = 0; i < input.size(); i += block) {
+            const size_t n = std::min(block, input.size() - i);
+            stft.process(std::span(input).subspan(i, n), processor);
+        }
+        return input;
+    }
+}
+
+TEST(SpectralStreamTest, IdentityReconstructsWithReportedLatency)
+{
+    const auto input = noise(8192, 7);
+
+    for (uint32_t hop : { 256U, 512U }) {
+        StreamingSTFT stft(1024, hop);
+        ASSERT_EQ(stft.latency(), 1024U);
+
+        const auto output = run(stft, input, 300, nullptr);
+        const size_t latency = stft.latency();
+
+        for (size_t i = 0; i < latency; ++i) {
+            ASSERT_NEAR(output[i], 0.0, 1e-12);
+        }
+        for (size_t i = latency; i < output.size(); ++i) {
+            ASSERT_NEAR(output[i], input[i - latency], 1e-9) << "hop " << hop << " sample " << i;
+        }
+        EXPECT_EQ(stft.frame_index(), input.size() / hop);
+    }
+}
+
+TEST(SpectralStreamTest, EveryWindowShapeReconstructs)
+{
+    const auto input = noise(8192, 11);
+
+    for (auto shape : { SpectralWindow::HANN, SpectralWindow::HAMMING, SpectralWindow::BLACKMAN }) {
+        StreamingSTFT stft(1024, 256, shape);
+        EXPECT_EQ(stft.window_shape(), shape);
+        ASSERT_EQ(stft.window().size(), 1024U);
+
+        const auto output = run(stft, input, 300, nullptr);
+        for (size_t i = stft.latency(); i < output.size(); ++i) {
+            ASSERT_NEAR(output[i], input[i - stft.latency()], 1e-9) << "shape " << static_cast<int>(shape);
+        }
+    }
+
+    // Periodic Hann: symmetric length N+1 without its last sample.
+    const auto periodic = spectral_window(SpectralWindow::HANN, 8);
+    const auto symmetric = hann(9);
+    ASSERT_EQ(periodic.size(), 8U);
+    for (size_t i = 0; i < periodic.size(); ++i) {
+        EXPECT_DOUBLE_EQ(periodic[i], symmetric[i]);
+    }
+}
+
+TEST(SpectralStreamTest, OutputIsIndependentOfBlockSize)
+{
+    const auto input = noise(6000, 3);
+    const SpectrumProcessor lowpass = [](std::vector<std::complex<double>>& spectrum, size_t) {
+        for (size_t b = spectrum.size() / 4; b < spectrum.size(); ++b) {
+            spectrum[b] = {};
+        }
+    };
+
+    StreamingSTFT reference(512, 128);
+    const auto expected = run(reference, input, input.size(), lowpass);
+
+    for (size_t block : { 1UL, 64UL, 77UL, 512UL }) {
+        StreamingSTFT stft(512, 128);
+        const auto output = run(stft, input, block, lowpass);
+        for (size_t i = 0; i < output.size(); ++i) {
+            ASSERT_DOUBLE_EQ(output[i], expected[i]) << "block " << block;
+        }
+    }
+}
+
+TEST(SpectralStreamTest, PitchShiftMovesToneUpAnOctave)
+{
+    constexpr double freq = 0.02;
+    StreamingSTFT stft(2048, 256);
+    StreamingPitchShift shift(12.0, 2048, 256);
+    EXPECT_NEAR(shift.get_semitones(), 12.0, 1e-9);
+
+    const auto output = run(stft, sine(32768, freq, 0.5), 512,
+        [&shift](auto& spectrum, size_t frame) { shift(spectrum, frame); });
+
+    const auto settled = std::span<const double>(output).subspan(8192);
+    const double octave = tone_power(settled, 2.0 * freq);
+    const double original = tone_power(settled, freq);
+    EXPECT_GT(octave, 100.0 * original);
+    EXPECT_NEAR(std::sqrt(2.0 * octave) * 2.0, 0.5, 0.1);
+
+    // Unity ratio behaves as an identity after the pipeline fills.
+    StreamingSTFT unity_stft(2048, 256);
+    StreamingPitchShift unity(0.0, 2048, 256);
+    const auto input = sine(16384, freq, 0.5);
+    const auto same = run(unity_stft, input, 512,
+        [&unity](auto& spectrum, size_t frame) { unity(spectrum, frame); });
+    for (size_t i = 8192; i < same.size(); ++i) {
+        ASSERT_NEAR(same[i], input[i - unity_stft.latency()], 1e-6);
+    }
+}
+
+TEST(SpectralStreamTest, GateRemovesTonesBelowThreshold)
+{
+    constexpr size_t n = 16384;
+    auto loud = sine(n, 0.05, 0.5);
+    const auto quiet = sine(n, 0.13, 0.001);
+    for (size_t i = 0; i < n; ++i) {
+        loud[i] += quiet[i];
+    }
+
+    StreamingSTFT stft(1024, 256);
+    StreamingSpectralGate gate(-40.0, 1024);
+    EXPECT_DOUBLE_EQ(gate.get_threshold_db(), -40.0);
+
+    const auto output = run(stft, loud, 256,
+        [&gate](auto& spectrum, size_t frame) { gate(spectrum, frame); });
+
+    // Goertzel reads amplitude / 2; the residual at 0.13 is leakage from the loud tone.
+    const auto settled = std::span<const double>(output).subspan(4096);
+    EXPECT_NEAR(std::sqrt(tone_power(std::span<const double>(loud).subspan(4096), 0.13)), 5e-4, 1e-4);
+    EXPECT_NEAR(std::sqrt(tone_power(settled, 0.05)), 0.25, 0.01);
+    EXPECT_LT(std::sqrt(tone_power(settled, 0.13)), 1e-4);
+
+    gate.set_threshold_db(0.0);
+    auto silent = run(stft, sine(n, 0.05, 0.5), 256,
+        [&gate](auto& spectrum, size_t frame) { gate(spectrum, frame); });
+    const auto tail = std::span<const double>(silent).subspan(4096);
+    EXPECT_LT(*std::ranges::max_element(tail, {}, [](double v) { return std::abs(v); }), 1e-12);
+}
+
+TEST(SpectralStreamTest, GateGainFollowsWindowShape)
+{
+    // A bin-centred -6.02 dBFS tone, analysed with each window, must sit
+    // between a -6.5 dB and a -5.5 dB threshold.
+    constexpr uint32_t size = 1024;
+    constexpr size_t bin = 64;
+    const auto tone = sine(size, static_cast<double>(bin) / size, 0.5);
+
+    for (auto shape : { SpectralWindow::HANN, SpectralWindow::HAMMING, SpectralWindow::BLACKMAN }) {
+        const auto window = spectral_window(shape, size);
+        std::complex<double> peak {};
+        for (size_t i = 0; i < size; ++i) {
+            peak += tone[i] * window[i] * std::polar(1.0, -2.0 * std::numbers::pi * static_cast<double>(bin * i) / size);
+        }
+
+        std::vector<std::complex<double>> spectrum(size / 2 + 1);
+        for (double threshold : { -6.5, -5.5 }) {
+            spectrum[bin] = peak;
+            StreamingSpectralGate(threshold, size, shape)(spectrum, 0);
+            EXPECT_EQ(spectrum[bin] != std::complex<double> {}, threshold < -6.0)
+                << "shape " << static_cast<int>(shape) << " threshold " << threshold;
+        }
+    }
+}
+
+} // namespace MayaFlux::Test
@@ -0,0 +1,192 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kinesis/Discrete/Varispeed.hpp"
+
+using namespace MayaFlux::Kinesis::Discrete;
+
+namespace MayaFlux::Test {
+
+namespace {
+    std::vector<double> sine(size_t n, double cycles_per_sample)
+    {
+        std::vector<double> out(n);
+        for (size_t i = 0; i < n; ++i) {
+            out[i] = std::sin(2.0 * std::numbers::pi * cycles_per_sample * static_cast<double>(i));
+        }
+        return out;
+    }
+
+    double rms(std::span<const double> x)
+    {
+        double sum = 0.0;
+        for (double v : x) {
+            sum += v * v;
+        }
+        return std::sqrt(sum / static_cast<double>(x.size()));
+    }
+}
+
+TEST(VarispeedTest, FractionalRateTracksBandLimitedSignal)
+{
+    constexpr double freq = 0.03;
+    const auto source = sine(8192, freq);
+
+    for (auto quality : { ResampleQuality::SINC, ResampleQuality::CUBIC }) {
+        VarispeedVoice voice { .position = 100.0, .rate = 0.73, .quality = quality };
+        std::vector<double> out(4096);
+        ASSERT_EQ(render_varispeed(voice, source, out), out.size());
+
+        const double tolerance = quality == ResampleQuality::SINC ? 2e-4 : 2e-3;
+        double max_error = 0.0;
+        for (size_t i = 0; i < out.size(); ++i) {
+            const double pos = 100.0 + 0.73 * static_cast<double>(i);
+            max_error = std::max(max_error, std::abs(out[i] - std::sin(2.0 * std::numbers::pi * freq * pos)));
+        }
+        EXPECT_LT(max_error, tolerance);
+        EXPECT_NEAR(voice.position, 100.0 + 0.73 * 4096.0, 1e-6);
+    }
+}
+
+TEST(VarispeedTest, SincSuppressesAliasingWhenPitchingUp)
+{
+    // 0.4 cycles/sample read at rate 2 would fold to 0.2; it must be filtered out.
+    const auto source = sine(16384, 0.4);
+    std::vector<double> out(4096);
+
+    VarispeedVoice sinc { .position = 64.0, .rate = 2.0 };
+    render_varispeed(sinc, source, out);
+    EXPECT_LT(rms(out), 0.01);
+
+    VarispeedVoice cubic { .position = 64.0, .rate = 2.0, .quality = ResampleQuality::CUBIC };
+    render_varispeed(cubic, source, out);
+    EXPECT_GT(rms(out), 0.1);
+
+    // Content inside the new band passes at nearly unity gain.
+    const auto low = sine(16384, 0.1);
+    VarispeedVoice pass { .position = 64.0, .rate = 2.0 };
+    render_varispeed(pass, low, out);
+    EXPECT_NEAR(rms(out), std::sqrt(0.5), 0.01);
+}
+
+TEST(VarispeedTest, BlockSplitMatchesSingleRender)
+{
+    const auto source = sine(4096, 0.011);
+
+    VarispeedVoice whole { .position = 3.25, .rate = 1.37 };
+    std::vector<double> a(1000);
+    render_varispeed(whole, source, a);
+
+    VarispeedVoice split { .position = 3.25, .rate = 1.37 };
+    std::vector<double> b(1000);
+    render_varispeed(split, source, std::span(b).first(333));
+    render_varispeed(split, source, std::span(b).subspan(333));
+
+    EXPECT_EQ(a, b);
+    EXPECT_DOUBLE_EQ(whole.position, split.position);
+
+    std::vector<double> rates(1000, 1.37);
+    VarispeedVoice modulated { .position = 3.25 };
+    std::vector<double> c(1000);
+    render_varispeed(modulated, source, c, rates);
+    EXPECT_EQ(a, c);
+}
+
+TEST(VarispeedTest, InterleavedStrideMatchesPlanar)
+{
+    const auto left = sine(2048, 0.02);
+    const auto right = sine(2048, 0.05);
+    std::vector<double> interleaved(left.size() * 2);
+    for (size_t i = 0; i < left.size(); ++i) {
+        interleaved[2 * i] = left[i];
+        interleaved[2 * i + 1] = right[i];
+    }
+
+    for (auto quality : { ResampleQuality::SINC, ResampleQuality::CUBIC }) {
+        VarispeedVoice planar { .rate = 0.8, .quality = quality };
+        VarispeedVoice strided { .rate = 0.8, .quality = quality };
+        std::vector<double> a(2000);
+        std::vector<double> b(2000);
+        render_varispeed(planar, right, a);
+        render_varispeed(strided, std::span<const double>(interleaved).subspan(1), b, 2);
+
+        for (size_t i = 0; i < a.size(); ++i) {
+            ASSERT_NEAR(a[i], b[i], 1e-12);
+        }
+    }
+}
+
+TEST(VarispeedTest, SegmentedSourceMatchesContiguous)
+{
+    // 64-frame segments: kernel windows regularly straddle a boundary, and
+    // the loop wraps across several segments. Channel 1 of stereo segments
+    // is read planar (fast path inside a segment) and interleaved (per tap).
+    constexpr uint32_t shift = 6;
+    constexpr size_t segment_frames = size_t { 1 } << shift;
+    const auto right = sine(1000, 0.03);
+
+    for (bool interleaved : { false, true }) {
+        const size_t offset = interleaved ? 1 : segment_frames;
+        const size_t stride = interleaved ? 2 : 1;
+
+        std::vector<std::vector<double>> storage((right.size() + segment_frames - 1) / segment_frames,
+            std::vector<double>(segment_frames * 2, 0.0));
+        for (size_t i = 0; i < right.size(); ++i) {
+            storage[i / segment_frames][offset + (i % segment_frames) * stride] = right[i];
+        }
+        std::vector<const double*> table;
+        for (const auto& segment : storage) {
+            table.push_back(segment.data());
+        }
+
+        const SegmentedSource segmented {
+            .segments = table, .shift = shift, .offset = offset, .stride = stride, .frames = right.size()
+        };
+
+        for (auto quality : { ResampleQuality::SINC, ResampleQuality::CUBIC }) {
+            for (bool looping : { false, true }) {
+                VarispeedVoice flat { .position = 3.25, .rate = 1.37, .quality = quality, .looping = looping, .loop_begin = 100, .loop_end = 700 };
+                VarispeedVoice split = flat;
+                std::vector<double> a(1200);
+                std::vector<double> b(1200);
+
+                EXPECT_EQ(render_varispeed(flat, right, a), render_varispeed(split, segmented, b));
+                EXPECT_EQ(flat.finished, split.finished);
+                EXPECT_DOUBLE_EQ(flat.position, split.position);
+                for (size_t i = 0; i < a.size(); ++i) {
+                    ASSERT_NEAR(a[i], b[i], 1e-9) << "sample " << i;
+                }
+            }
+        }
+    }
+}
+
+TEST(VarispeedTest, FinishesAndLoops)
+{
+    const std::vector<double> source(100, 1.0);
+
+    VarispeedVoice once { .position = 90.0, .rate = 1.0 };
+    std::vector<double> out(64, -1.0);
+    EXPECT_EQ(render_varispeed(once, source, out), 10U);
+    EXPECT_TRUE(once.finished);
+    EXPECT_EQ(out[10], 0.0);
+    EXPECT_EQ(out.back(), 0.0);
+
+    VarispeedVoice reverse { .position = 5.0, .rate = -1.0 };
+    EXPECT_EQ(render_varispeed(reverse, source, out), 6U);
+    EXPECT_TRUE(reverse.finished);
+
+    // A constant loop stays constant across the wrap: the kernel reads the
+    // loop head past loop_end. The loop sits clear of the silent pre-roll
+    // before frame 0 that the widest kernel would otherwise reach.
+    VarispeedVoice loop { .position = 50.0, .rate = 1.5, .looping = true, .loop_begin = 40, .loop_end = 90 };
+    std::vector<double> looped(500);
+    EXPECT_EQ(render_varispeed(loop, source, looped), looped.size());
+    EXPECT_FALSE(loop.finished);
+    for (double v : looped) {
+        ASSERT_NEAR(v, 1.0, 1e-5);
+    }
+    EXPECT_GE(loop.position, 40.0);
+    EXPECT_LT(loop.position, 90.0);
+}
+
+} // namespace MayaFlux::Test
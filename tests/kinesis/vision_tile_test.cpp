@@ -0,0 +1,151 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Kinesis/Vision/VisionExecutor.hpp"
+
+#include <random>
+
+using namespace MayaFlux::Kinesis::Vision;
+
+namespace MayaFlux::Test {
+
+class VisionTileFusionTest : public ::testing::Test {
+protected:
+    static constexpr uint32_t W = 203;
+    static constexpr uint32_t H = 97;
+
+    void SetUp() override
+    {
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<int> dist(0, 255);
+
+        rgba8.resize(static_cast<size_t>(W) * H * 4);
+        rgba.resize(rgba8.size());
+        for (size_t i = 0; i < rgba8.size(); ++i) {
+            rgba8[i] = static_cast<uint8_t>(dist(rng));
+            rgba[i] = static_cast<float>(rgba8[i]) * (1.0F / 255.0F);
+        }
+    }
+
+    static VisionResult run_unfused(const VisionSequence& seq, std::span<const float> frame)
+    {
+        VisionExecutor ex;
+        ex.set_tile_config({ .enabled = false });
+        return ex.run(seq, frame, W, H);
+    }
+
+    static VisionResult run_fused(const VisionSequence& seq, std::span<const float> frame)
+    {
+        VisionExecutor ex;
+        ex.set_tile_config({ .tile_w = 32, .tile_h = 16, .max_workers = 3 });
+        return ex.run(seq, frame, W, H);
+    }
+
+    std::vector<float> rgba;
+    std::vector<uint8_t> rgba8;
+};
+
+TEST_F(VisionTileFusionTest, BlurSobelThresholdMorphMatchesPerOp)
+{
+    const auto seq = VisionSequence::Builder {}
+                         .rgba_to_gray()
+                         .gaussian_blur(1.5F)
+                         .sobel()
+                         .threshold(0.2F)
+                         .open(1)
+                         .build();
+
+    const auto ref = run_unfused(seq, rgba);
+    const auto fused = run_fused(seq, rgba);
+
+    ASSERT_EQ(ref.w, fused.w);
+    ASSERT_EQ(ref.h, fused.h);
+    const auto a = ref.as_span();
+    const auto b = fused.as_span();
+    for (size_t i = 0; i < static_cast<size_t>(W) * H; ++i)
+        ASSERT_EQ(a[i], b[i]) << "pixel " << i;
+}
+
+TEST_F(VisionTileFusionTest, SmoothingChainMatchesPerOpWithinTolerance)
+{
+    const auto seq = VisionSequence::Builder {}
+                         .rgba_to_gray()
+                         .gaussian_blur(2.0F)
+                         .normalize_range(0.2F, 0.8F)
+                         .filter_separable({ 0.25F, 0.5F, 0.25F }, { 0.25F, 0.5F, 0.25F })
+                         .build();
+
+    const auto ref = run_unfused(seq, rgba);
+    const auto fused = run_fused(seq, rgba);
+
+    const auto a = ref.as_span();
+    const auto b = fused.as_span();
+    for (size_t i = 0; i < static_cast<size_t>(W) * H; ++i)
+        ASSERT_NEAR(a[i], b[i], 1e-5F) << "pixel " << i;
+}
+
+TEST_F(VisionTileFusionTest, EightBitSourceMatchesFloatSource)
+{
+    const auto seq = VisionSequence::Builder {}
+                         .rgba_to_gray()
+                         .gaussian_blur(1.0F)
+                         .threshold(0.5F)
+                         .dilate(2)
+                         .build();
+
+    VisionExecutor ex;
+    const auto from_u8 = ex.run(seq, std::span<const uint8_t>(rgba8), W, H);
+    const auto ref = run_unfused(seq, rgba);
+
+    const auto a = ref.as_span();
+    const auto b = from_u8.as_span();
+    size_t mismatched = 0;
+    for (size_t i = 0; i < static_cast<size_t>(W) * H; ++i)
+        mismatched += a[i] != b[i] ? 1 : 0;
+
+    // 1/255 scaling before vs after the luma sum can flip pixels that sit
+    // exactly on the threshold.
+    EXPECT_LE(mismatched, static_cast<size_t>(W) * H / 1000);
+}
+
+TEST_F(VisionTileFusionTest, TerminalSobelKeepsGradientResult)
+{
+    const auto seq = VisionSequence::Builder {}
+                         .rgba_to_gray()
+                         .gaussian_blur(1.0F)
+                         .sobel()
+                         .build();
+
+    VisionExecutor ex;
+    const auto result = ex.run(seq, rgba, W, H);
+    EXPECT_TRUE(std::holds_alternative<GradientResult>(result.structured));
+}
+
+TEST_F(VisionTileFusionTest, RepeatedRunsReuseSlotsAfterFusedPrefix)
+{
+    const auto seq = VisionSequence::Builder {}
+                         .rgba_to_gray()
+                         .gaussian_blur(1.0F)
+                         .normalize_range(0.1F, 0.9F)
+                         .threshold_adaptive(7, 0.01F)
+                         .build();
+
+    const auto ref = run_unfused(seq, rgba);
+
+    VisionExecutor ex;
+    ex.set_tile_config({ .tile_w = 32, .tile_h = 16, .max_workers = 2 });
+    for (int pass = 0; pass < 3; ++pass) {
+        const auto result = ex.run(seq, rgba, W, H);
+        ASSERT_EQ(result.w, W);
+        ASSERT_EQ(result.h, H);
+        const auto a = ref.as_span();
+        const auto b = result.as_span();
+        ASSERT_GE(b.size(), static_cast<size_t>(W) * H) << "pass " << pass;
+
+        size_t mismatched = 0;
+        for (size_t i = 0; i < static_cast<size_t>(W) * H; ++i)
+            mismatched += a[i] != b[i] ? 1 : 0;
+        EXPECT_LE(mismatched, static_cast<size_t>(W) * H / 1000) << "pass " << pass;
+    }
+}
+
+} // namespace MayaFlux::Test
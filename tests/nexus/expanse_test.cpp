@@ -0,0 +1,110 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Nexus/Expanse.hpp"
+
+using namespace MayaFlux::Nexus;
+
+namespace MayaFlux::Test {
+
+namespace {
+    using Snapshot = std::vector<std::pair<uint32_t, glm::vec3>>;
+
+    struct Crossings {
+        std::vector<uint32_t> entered;
+        std::vector<uint32_t> exited;
+    };
+
+    std::shared_ptr<Expanse> unit_box(Crossings& log, const float* offset = nullptr)
+    {
+        return std::make_shared<Expanse>(
+            [offset](const glm::vec3& p) {
+                const float x = p.x - (offset ? *offset : 0.F);
+                return x >= 0.F && x <= 1.F;
+            },
+            [&log](uint32_t id) { log.entered.push_back(id); },
+            [&log](uint32_t id) { log.exited.push_back(id); });
+    }
+}
+
+TEST(ExpanseTest, ChangesMatchFullEvaluation)
+{
+    Crossings full_log;
+    Crossings delta_log;
+    auto full = unit_box(full_log);
+    auto delta = unit_box(delta_log);
+    delta->set_incremental(true);
+
+    Snapshot positions { { 1, glm::vec3(0.5F) }, { 2, glm::vec3(2.F) }, { 3, glm::vec3(-1.F) } };
+    full->evaluate(7, positions);
+    delta->evaluate(7, positions);
+
+    const Snapshot moved { { 2, glm::vec3(0.9F) }, { 1, glm::vec3(3.F) } };
+    positions[1].second = moved[0].second;
+    positions[0].second = moved[1].second;
+
+    full->evaluate(7, positions);
+    delta->evaluate_changes(7, moved, {});
+
+    EXPECT_EQ(full_log.entered, delta_log.entered);
+    EXPECT_EQ(full_log.exited, delta_log.exited);
+    EXPECT_EQ(*full->occupants(7), *delta->occupants(7));
+    EXPECT_EQ(*delta->occupants(7), std::unordered_set<uint32_t> { 2 });
+}
+
+TEST(ExpanseTest, StationaryEntitiesAreNotRetested)
+{
+    Crossings log;
+    size_t calls = 0;
+    Expanse expanse(
+        [&calls](const glm::vec3& p) { ++calls; return p.x < 1.F; },
+        [&log](uint32_t id) { log.entered.push_back(id); },
+        nullptr);
+    expanse.set_incremental(true);
+
+    expanse.evaluate(1, Snapshot { { 1, glm::vec3(0.F) }, { 2, glm::vec3(0.5F) } });
+    EXPECT_EQ(calls, 2);
+
+    calls = 0;
+    log.entered.clear();
+    expanse.evaluate_changes(1, Snapshot { { 3, glm::vec3(0.2F) } }, {});
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(log.entered, (std::vector<uint32_t> { 3 }));
+    EXPECT_EQ(expanse.occupants(1)->size(), 3);
+}
+
+TEST(ExpanseTest, DepartedEntitiesExit)
+{
+    Crossings log;
+    auto expanse = unit_box(log);
+    expanse->evaluate(1, Snapshot { { 4, glm::vec3(0.5F) } });
+
+    const std::vector<uint32_t> departed { 4, 9 };
+    expanse->evaluate_changes(1, {}, departed);
+
+    EXPECT_EQ(log.exited, (std::vector<uint32_t> { 4 }));
+    EXPECT_EQ(expanse->occupants(1), nullptr);
+}
+
+TEST(ExpanseTest, FullEvaluationUnlessIncremental)
+{
+    Crossings log;
+    float offset = 0.F;
+    auto expanse = unit_box(log, &offset);
+    EXPECT_FALSE(expanse->is_incremental());
+
+    const Snapshot still { { 5, glm::vec3(1.5F) } };
+    expanse->evaluate(1, still);
+    EXPECT_EQ(expanse->occupants(1), nullptr);
+
+    expanse->set_incremental(true);
+
+    offset = 1.F;
+    expanse->evaluate_changes(1, {}, {});
+    EXPECT_TRUE(log.entered.empty());
+
+    expanse->invalidate();
+    expanse->evaluate(1, still);
+    EXPECT_EQ(log.entered, (std::vector<uint32_t> { 5 }));
+}
+
+} // namespace MayaFlux::Test
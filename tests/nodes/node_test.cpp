@@ -129,6 +129,255 @@ TEST_F(NodeTest, ComplexMultiChannelChain)
     EXPECT_GT(std::abs(output_ch0 - output_ch1), 0.01);
 }
 
+TEST_F(NodeTest, RootNodeTopologyChangesFromCallback)
+{
+    auto& root = node_manager->get_root_node(token, 0);
+
+    auto sine1 = std::make_shared<Nodes::Generator::Sine>(440.0f, 0.5f);
+    auto sine2 = std::make_shared<Nodes::Generator::Sine>(880.0f, 0.5f);
+
+    int sine1_ticks = 0;
+    int sine2_ticks = 0;
+    sine2->on_tick([&](const Nodes::NodeContext&) { sine2_ticks++; });
+    sine1->on_tick([&](const Nodes::NodeContext&) {
+        if (++sine1_ticks == 1) {
+            node_manager->add_to_root(sine2, token, 0);
+        } else if (sine1_ticks == 3) {
+            node_manager->remove_from_root(sine1, token, 0);
+        }
+    });
+
+    node_manager->add_to_root(sine1, token, 0);
+
+    root.process_sample();
+    EXPECT_EQ(root.get_node_size(), 2);
+    EXPECT_EQ(sine2_ticks, 0);
+
+    for (int i = 0; i < 4; i++) {
+        root.process_sample();
+    }
+
+    EXPECT_EQ(sine1_ticks, 3);
+    EXPECT_EQ(sine2_ticks, 4);
+    EXPECT_EQ(root.get_node_size(), 1);
+    EXPECT_FALSE(sine1->m_state.load() & Nodes::NodeState::ACTIVE);
+}
+
+TEST_F(NodeTest, RootNodeRegistersConcurrentlyWithProcessing)
+{
+    auto& root = node_manager->get_root_node(token, 0);
+    std::atomic<bool> done { false };
+
+    std::thread writer([&] {
+        std::vector<std::shared_ptr<Nodes::Node>> nodes;
+        for (int i = 0; i < 200; i++) {
+            nodes.push_back(std::make_shared<Nodes::Generator::Sine>(100.0f + static_cast<float>(i), 0.1f));
+            root.register_node(nodes.back());
+            if (i % 3 == 0) {
+                root.unregister_node(nodes[i / 2]);
+            }
+        }
+        done.store(true);
+    });
+
+    size_t cycles = 0;
+    while (!done.load() || cycles < 64) {
+        root.process_sample();
+        cycles++;
+    }
+    writer.join();
+
+    EXPECT_EQ(root.get_node_size(), root.nodes().size());
+    EXPECT_GT(root.get_node_size(), 0U);
+}
+
+TEST_F(NodeTest, RootNodesOrderedByChannel)
+{
+    node_manager->get_root_node(token, 3);
+    node_manager->get_root_node(token, 1);
+
+    auto roots = node_manager->get_all_root_nodes(token);
+    ASSERT_EQ(roots.size(), 3);
+    EXPECT_EQ(roots[0]->get_channel(), 0);
+    EXPECT_EQ(roots[1]->get_channel(), 1);
+    EXPECT_EQ(roots[2]->get_channel(), 3);
+    EXPECT_EQ(&node_manager->get_root_node(token, 3), roots[2]);
+}
+
+TEST_F(NodeTest, ProcessingThreadTopologyEditsWaitForCommit)
+{
+    EXPECT_EQ(node_manager->process_sample(token, 2), 0.0);
+    EXPECT_EQ(node_manager->get_all_channels(token).size(), 1);
+
+    node_manager->commit_pending_topology();
+    EXPECT_EQ(node_manager->get_all_channels(token), (std::vector<unsigned int> { 0, 2 }));
+
+    auto sine = std::make_shared<Nodes::Generator::Sine>(440.0f, 0.5f);
+    node_manager->add_to_root(sine, token, 0);
+    node_manager->route_node_to_channels(sine, { 2 }, 1, token);
+
+    for (int i = 0; i < 8 && sine->get_routing_state().phase != Nodes::RoutingState::COMPLETED; i++) {
+        node_manager->update_routing_states_for_cycle(token);
+    }
+    ASSERT_EQ(sine->get_routing_state().phase, Nodes::RoutingState::COMPLETED);
+
+    node_manager->cleanup_completed_routing(token);
+    EXPECT_EQ(node_manager->get_root_node(token, 0).get_node_size(), 1);
+
+    node_manager->commit_pending_topology();
+    EXPECT_EQ(node_manager->get_root_node(token, 0).get_node_size(), 0);
+    EXPECT_EQ(node_manager->get_root_node(token, 2).get_node_size(), 1);
+    EXPECT_EQ(node_manager->get_node_count(token), 1);
+}
+
+TEST_F(NodeTest, ProcessingScopeQueuesRootRegistration)
+{
+    auto sine = std::make_shared<Nodes::Generator::Sine>(440.0f, 0.5f);
+    auto& root = node_manager->get_root_node(token, 0);
+
+    {
+        Nodes::ProcessingScope scope;
+        EXPECT_TRUE(Nodes::ProcessingScope::active());
+        root.register_node(sine);
+        EXPECT_EQ(root.get_node_size(), 0);
+    }
+    EXPECT_FALSE(Nodes::ProcessingScope::active());
+
+    node_manager->commit_pending_topology();
+    EXPECT_EQ(root.get_node_size(), 1);
+
+    {
+        Nodes::ProcessingScope scope;
+        root.unregister_node(sine);
+        EXPECT_EQ(root.get_node_size(), 1);
+    }
+
+    node_manager->commit_pending_topology();
+    EXPECT_EQ(root.get_node_size(), 0);
+}
+
+TEST_F(NodeTest, RepeatedRootRequestsQueueOnce)
+{
+    auto sine = std::make_shared<Nodes::Generator::Sine>(440.0f, 0.5f);
+
+    {
+        Nodes::ProcessingScope scope;
+        for (int i = 0; i < 1024; i++) {
+            node_manager->process_sample(token, 3);
+        }
+        node_manager->add_to_root(sine, token, 3);
+    }
+
+    node_manager->commit_pending_topology();
+    EXPECT_EQ(node_manager->get_all_channels(token), (std::vector<unsigned int> { 0, 3 }));
+    EXPECT_EQ(node_manager->get_root_node(token, 3).get_node_size(), 1);
+}
+
+TEST_F(NodeTest, Float32BlockMatchesSamplePath)
+{
+    auto reference_manager = std::make_shared<Nodes::NodeGraphManager>();
+    auto reference = std::make_shared<Nodes::Generator::Sine>(440.0f, 0.5f);
+    reference_manager->add_to_root(reference, token, 0);
+
+    auto sine = std::make_shared<Nodes::Generator::Sine>(440.0f, 0.5f);
+    node_manager->add_to_root(sine, token, 0);
+    node_manager->add_to_root(sine, token, 1);
+
+    std::vector<float> left(256);
+    std::vector<float> right(256);
+    for (int block = 0; block < 4; block++) {
+        node_manager->process_channel_f32(token, 0, left);
+        node_manager->process_channel_f32(token, 1, right);
+
+        for (size_t i = 0; i < left.size(); i++) {
+            const double expected = reference_manager->process_sample(token, 0);
+            EXPECT_NEAR(left[i], expected, 1e-5);
+            EXPECT_EQ(left[i], right[i]);
+        }
+    }
+
+    EXPECT_NEAR(sine->get_last_output(), reference->get_last_output(), 1e-5);
+}
+
+TEST_F(NodeTest, Float32BlockFallsBackForRoutedModulator)
+{
+    auto build = [this](const std::shared_ptr<Nodes::NodeGraphManager>& manager) {
+        auto modulator = std::make_shared<Nodes::Generator::Sine>(3.0f, 0.5f);
+        auto carrier = std::make_shared<Nodes::Generator::Sine>(440.0f, 0.5f);
+        carrier->set_amplitude_modulator(modulator);
+        manager->add_to_root(modulator, token, 0);
+        manager->add_to_root(carrier, token, 0);
+    };
+
+    auto reference_manager = std::make_shared<Nodes::NodeGraphManager>();
+    build(reference_manager);
+    build(node_manager);
+
+    EXPECT_FALSE(node_manager->can_render_blocks(token));
+
+    std::vector<float> block(256);
+    for (int cycle = 0; cycle < 4; cycle++) {
+        node_manager->process_channel_f32(token, 0, block);
+        for (float sample : block) {
+            EXPECT_NEAR(sample, reference_manager->process_sample(token, 0), 1e-6);
+        }
+    }
+}
+
+TEST_F(NodeTest, TickCallbacksKeepSampleRendering)
+{
+    auto sine = std::make_shared<Nodes::Generator::Sine>(440.0f, 0.5f);
+    node_manager->add_to_root(sine, token, 0);
+    EXPECT_TRUE(node_manager->can_render_blocks(token));
+
+    sine->on_tick([](Nodes::NodeContext&) { });
+    EXPECT_FALSE(node_manager->can_render_blocks(token));
+}
+
+TEST_F(NodeTest, Float32BlockThroughput)
+{
+    constexpr uint32_t voices = 64;
+    constexpr uint32_t channels = 2;
+    constexpr uint32_t frames = 512;
+    constexpr int blocks = 200;
+
+    auto sample_manager = std::make_shared<Nodes::NodeGraphManager>();
+    for (uint32_t v = 0; v < voices; v++) {
+        const float freq = 110.0f + 7.0f * static_cast<float>(v);
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            sample_manager->add_to_root(std::make_shared<Nodes::Generator::Sine>(freq, 0.1f), token, ch);
+            node_manager->add_to_root(std::make_shared<Nodes::Generator::Sine>(freq, 0.1f), token, ch);
+        }
+    }
+
+    std::vector<double> interleaved(static_cast<size_t>(frames) * channels);
+    auto start = std::chrono::steady_clock::now();
+    for (int b = 0; b < blocks; b++) {
+        for (uint32_t i = 0; i < frames; i++) {
+            for (uint32_t ch = 0; ch < channels; ch++) {
+                interleaved[i * channels + ch] = sample_manager->process_sample(token, ch);
+            }
+        }
+    }
+    const auto sample_time = std::chrono::steady_clock::now() - start;
+
+    std::vector<float> planar(static_cast<size_t>(frames) * channels);
+    start = std::chrono::steady_clock::now();
+    for (int b = 0; b < blocks; b++) {
+        for (uint32_t ch = 0; ch < channels; ch++) {
+            node_manager->process_channel_f32(token, ch, std::span<float>(planar).subspan(ch * frames, frames));
+        }
+    }
+    const auto block_time = std::chrono::steady_clock::now() - start;
+
+    const auto us = [](auto d) { return std::chrono::duration_cast<std::chrono::microseconds>(d).count(); };
+    std::cout << "[ PERF     ] " << voices << " voices x " << channels << " ch x " << frames << " frames, "
+              << blocks << " blocks: double per-sample " << us(sample_time) << " us, float block "
+              << us(block_time) << " us\n";
+
+    EXPECT_LT(block_time, sample_time);
+}
+
 class SineNodeTest : public ::testing::Test {
 protected:
     void SetUp() override
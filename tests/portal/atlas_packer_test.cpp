@@ -0,0 +1,105 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Portal/Text/AtlasPacker.hpp"
+
+#include <random>
+
+using namespace MayaFlux::Portal::Text;
+
+namespace MayaFlux::Test {
+
+namespace {
+    bool overlaps(const AtlasRect& a, const AtlasRect& b)
+    {
+        return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+    }
+}
+
+TEST(SkylinePackerTest, PlacementsStayInBoundsAndNeverOverlap)
+{
+    SkylinePacker packer(256, 256);
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<uint32_t> dim(3, 28);
+
+    std::vector<AtlasRect> placed;
+    for (int i = 0; i < 400; ++i) {
+        const auto r = packer.insert(dim(rng), dim(rng));
+        if (!r) {
+            continue;
+        }
+        EXPECT_LE(r->x + r->w, 256U);
+        EXPECT_LE(r->y + r->h, 256U);
+        for (const auto& p : placed) {
+            ASSERT_FALSE(overlaps(*r, p));
+        }
+        placed.push_back(*r);
+    }
+
+    EXPECT_GT(placed.size(), 100U);
+    EXPECT_GT(packer.occupancy(), 0.6F);
+}
+
+TEST(SkylinePackerTest, FillsEvenlyAndRejectsWhenFull)
+{
+    SkylinePacker packer(64, 64);
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_TRUE(packer.insert(16, 16).has_value());
+    }
+    EXPECT_FLOAT_EQ(packer.occupancy(), 1.F);
+    EXPECT_FALSE(packer.insert(1, 1).has_value());
+
+    packer.reset(64, 64);
+    EXPECT_FLOAT_EQ(packer.occupancy(), 0.F);
+    EXPECT_TRUE(packer.insert(64, 64).has_value());
+}
+
+TEST(SkylinePackerTest, RejectsOversizedAndEmpty)
+{
+    SkylinePacker packer(32, 32);
+    EXPECT_FALSE(packer.insert(33, 4).has_value());
+    EXPECT_FALSE(packer.insert(4, 33).has_value());
+    EXPECT_FALSE(packer.insert(0, 4).has_value());
+}
+
+TEST(AtlasPackerTest, RectUnionCoversBoth)
+{
+    const AtlasRect a { .x = 2, .y = 3, .w = 4, .h = 5 };
+    const AtlasRect b { .x = 10, .y = 1, .w = 2, .h = 2 };
+    const auto u = rect_union(a, b);
+    EXPECT_EQ(u.x, 2U);
+    EXPECT_EQ(u.y, 1U);
+    EXPECT_EQ(u.w, 10U);
+    EXPECT_EQ(u.h, 7U);
+    EXPECT_EQ(rect_union(AtlasRect {}, a).area(), a.area());
+}
+
+TEST(AtlasPackerTest, SdfEncodesInsideOutsideAndEdge)
+{
+    constexpr uint32_t w = 16;
+    constexpr uint32_t h = 16;
+    constexpr uint32_t spread = 4;
+
+    std::vector<uint8_t> coverage(w * h, 0);
+    for (uint32_t y = 4; y < 12; ++y) {
+        for (uint32_t x = 4; x < 12; ++x) {
+            coverage[y * w + x] = 255;
+        }
+    }
+
+    constexpr uint32_t ow = w + 2 * spread;
+    constexpr uint32_t oh = h + 2 * spread;
+    std::vector<uint8_t> sdf(ow * oh, 0);
+    coverage_to_sdf(coverage, w, h, spread, sdf);
+
+    const auto at = [&](uint32_t x, uint32_t y) { return sdf[(y + spread) * ow + x + spread]; };
+
+    EXPECT_EQ(at(8, 8), 255);
+    EXPECT_EQ(sdf[0], 1);
+    EXPECT_GT(at(4, 8), 128);
+    EXPECT_LT(at(3, 8), 128);
+    EXPECT_LT(at(3, 8), at(4, 8));
+    EXPECT_LT(at(1, 8), at(3, 8));
+    EXPECT_EQ(at(8, 4), at(4, 8));
+}
+
+}
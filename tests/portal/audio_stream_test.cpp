@@ -0,0 +1,300 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Buffers/Remote/AudioReceiveBuffer.hpp"
+#include "MayaFlux/Buffers/Remote/AudioSendProcessor.hpp"
+#include "MayaFlux/Core/Backends/Network/UDPBackend.hpp"
+#include "MayaFlux/Portal/Network/AudioJitterBuffer.hpp"
+
+#include <asio/executor_work_guard.hpp>
+
+using namespace MayaFlux::Portal::Network;
+
+namespace MayaFlux::Test {
+
+namespace {
+
+    constexpr double k_rate = 48000.0;
+    constexpr uint16_t k_packet_frames = 64;
+
+    double sine(uint64_t n)
+    {
+        return 0.5 * std::sin(2.0 * std::numbers::pi * 440.0 * static_cast<double>(n) / k_rate);
+    }
+
+    std::vector<uint8_t> make_packet(uint32_t sequence, AudioSampleFormat format = AudioSampleFormat::FLOAT32)
+    {
+        std::vector<double> samples(k_packet_frames);
+        const uint64_t start = static_cast<uint64_t>(sequence) * k_packet_frames;
+        for (size_t i = 0; i < samples.size(); ++i) {
+            samples[i] = sine(start + i);
+        }
+
+        AudioPacketHeader header;
+        header.format = format;
+        header.sequence = sequence;
+        header.timestamp = start;
+
+        std::vector<uint8_t> bytes(audio_packet_size(format, samples.size()));
+        bytes.resize(encode_audio_packet(header, samples, bytes));
+        return bytes;
+    }
+
+    int64_t arrival_of(uint32_t sequence)
+    {
+        return static_cast<int64_t>(sequence) * k_packet_frames * 1'000'000'000LL / static_cast<int64_t>(k_rate);
+    }
+
+    /// Largest step between neighbouring samples; a 440 Hz sine at 0.5 never exceeds 0.03.
+    double max_step(std::span<const double> x)
+    {
+        double step = 0.0;
+        for (size_t i = 1; i < x.size(); ++i) {
+            step = std::max(step, std::abs(x[i] - x[i - 1]));
+        }
+        return step;
+    }
+
+} // namespace
+
+TEST(AudioPacketTest, RoundTripsEveryFormat)
+{
+    const std::vector<double> samples { 0.0, 0.25, -0.5, 0.999, -1.0, 1.5 };
+
+    for (auto [format, tolerance] : { std::pair { AudioSampleFormat::PCM16, 1.0 / 32767.0 },
+             std::pair { AudioSampleFormat::PCM24, 1.0 / 8388607.0 },
+             std::pair { AudioSampleFormat::FLOAT32, 1e-7 } }) {
+        AudioPacketHeader header;
+        header.format = format;
+        header.stream_id = 7;
+        header.sequence = 0xFFFFFFFF;
+        header.sample_rate = 44100;
+        header.timestamp = 1ULL << 40;
+        header.send_time_ns = -12345;
+
+        std::vector<uint8_t> bytes(audio_packet_size(format, samples.size()));
+        ASSERT_EQ(encode_audio_packet(header, samples, bytes), bytes.size());
+
+        auto decoded = decode_audio_packet_header(bytes);
+        ASSERT_TRUE(decoded);
+        EXPECT_EQ(decoded->format, format);
+        EXPECT_EQ(decoded->frames, samples.size());
+        EXPECT_EQ(decoded->stream_id, 7U);
+        EXPECT_EQ(decoded->sequence, 0xFFFFFFFFU);
+        EXPECT_EQ(decoded->sample_rate, 44100U);
+        EXPECT_EQ(decoded->timestamp, 1ULL << 40);
+        EXPECT_EQ(decoded->send_time_ns, -12345);
+
+        std::vector<float> out(samples.size());
+        ASSERT_EQ(decode_audio_samples(bytes, *decoded, out), samples.size());
+
+        for (size_t i = 0; i < samples.size() - 1; ++i) {
+            EXPECT_NEAR(out[i], samples[i], tolerance) << static_cast<int>(format) << " sample " << i;
+        }
+
+        if (format == AudioSampleFormat::FLOAT32) {
+            EXPECT_FLOAT_EQ(out.back(), 1.5F);
+        } else {
+            EXPECT_NEAR(out.back(), 1.0, tolerance);
+        }
+    }
+}
+
+TEST(AudioPacketTest, RejectsMalformedDatagrams)
+{
+    auto bytes = make_packet(3);
+
+    EXPECT_FALSE(decode_audio_packet_header(ByteView(bytes.data(), AUDIO_PACKET_HEADER_SIZE - 1)));
+    EXPECT_FALSE(decode_audio_packet_header(ByteView(bytes.data(), bytes.size() - 1)));
+
+    auto bad_magic = bytes;
+    bad_magic[0] ^= 0xFF;
+    EXPECT_FALSE(decode_audio_packet_header(bad_magic));
+
+    auto jitter = std::make_unique<AudioJitterBuffer>(JitterBufferConfig { .stream_id = 9 });
+    EXPECT_FALSE(jitter->push(bytes, 0));
+    EXPECT_EQ(jitter->get_stats().packets_received, 0U);
+}
+
+TEST(AudioJitterBufferTest, ReordersAndConcealsLostPackets)
+{
+    auto jitter = std::make_unique<AudioJitterBuffer>();
+
+    // Arrival order: 5/6 swapped, 10 lost, 3 duplicated.
+    std::vector<uint32_t> order;
+    for (uint32_t s = 0; s < 40; ++s) {
+        if (s == 10) {
+            continue;
+        }
+        order.push_back(s);
+    }
+    std::swap(order[5], order[6]);
+    order.insert(order.begin() + 4, 3);
+
+    std::vector<double> played;
+    std::vector<double> block(128);
+    size_t next = 0;
+
+    for (int cycle = 0; cycle < 24; ++cycle) {
+        for (int k = 0; k < 2 && next < order.size(); ++k, ++next) {
+            jitter->push(make_packet(order[next]), arrival_of(order[next]));
+        }
+        jitter->pull(block);
+        played.insert(played.end(), block.begin(), block.end());
+    }
+
+    const auto stats = jitter->get_stats();
+    EXPECT_EQ(stats.packets_received, 40U);
+    EXPECT_EQ(stats.packets_lost, 1U);
+    EXPECT_EQ(stats.packets_duplicate, 1U);
+    EXPECT_EQ(stats.packets_late, 0U);
+    EXPECT_GE(stats.frames_concealed, k_packet_frames);
+
+    const auto first = std::ranges::find_if(played, [](double x) { return x != 0.0; });
+    ASSERT_NE(first, played.end());
+    const std::span<const double> audible(first, played.end());
+
+    EXPECT_LT(max_step(audible), 0.06);
+}
+
+TEST(AudioJitterBufferTest, LatePacketAfterConcealmentIsDiscarded)
+{
+    auto jitter = std::make_unique<AudioJitterBuffer>();
+    std::vector<double> block(64);
+
+    for (uint32_t s = 0; s < 6; ++s) {
+        jitter->push(make_packet(s), arrival_of(s));
+    }
+    jitter->push(make_packet(7), arrival_of(7));
+
+    for (int i = 0; i < 8; ++i) {
+        jitter->pull(block);
+    }
+
+    jitter->push(make_packet(6), arrival_of(8));
+    jitter->pull(block);
+
+    const auto stats = jitter->get_stats();
+    EXPECT_EQ(stats.packets_lost, 1U);
+    EXPECT_EQ(stats.packets_late, 1U);
+}
+
+class AudioJitterDriftTest : public ::testing::TestWithParam<double> { };
+
+TEST_P(AudioJitterDriftTest, LevelStaysNearTarget)
+{
+    const double speed = GetParam();
+    auto jitter = std::make_unique<AudioJitterBuffer>();
+
+    std::vector<double> block(128);
+    std::vector<double> played;
+    double owed = 0.0;
+    uint32_t sequence = 0;
+
+    for (int cycle = 0; cycle < 3000; ++cycle) {
+        owed += 128.0 * speed;
+        while (owed >= k_packet_frames) {
+            jitter->push(make_packet(sequence), arrival_of(sequence));
+            ++sequence;
+            owed -= k_packet_frames;
+        }
+        jitter->pull(block);
+        if (cycle >= 2000) {
+            played.insert(played.end(), block.begin(), block.end());
+        }
+    }
+
+    const auto stats = jitter->get_stats();
+    EXPECT_EQ(stats.packets_dropped, 0U);
+    EXPECT_EQ(stats.packets_lost, 0U);
+    EXPECT_LE(stats.underruns, 1U);
+    EXPECT_LT(std::abs(stats.buffered_ms - stats.target_ms), 4.0);
+    EXPECT_LT(stats.target_ms, 5.0);
+
+    if (speed > 1.0) {
+        EXPECT_GT(stats.drift_ratio, 1.0);
+    } else {
+        EXPECT_LT(stats.drift_ratio, 1.0);
+    }
+
+    EXPECT_LT(max_step(played), 0.06);
+}
+
+INSTANTIATE_TEST_SUITE_P(SenderClock, AudioJitterDriftTest, ::testing::Values(0.998, 1.002));
+
+TEST(AudioStreamTest, StreamsOverUdpLoopback)
+{
+    constexpr uint16_t port = 47931;
+
+    asio::io_context context;
+    auto guard = asio::make_work_guard(context);
+
+    Core::UDPBackend udp(Core::UDPBackendInfo {}, context);
+    ASSERT_TRUE(udp.initialize());
+
+    auto receiver = std::make_shared<Buffers::AudioReceiveBuffer>(0, 128);
+    receiver->resize(128);
+    receiver->setup_processors(Buffers::ProcessingToken::AUDIO_BACKEND);
+
+    udp.set_receive_callback([&](uint64_t, const uint8_t* data, size_t size, std::string_view) {
+        receiver->receive(ByteView(data, size));
+    });
+    udp.start();
+
+    Core::EndpointInfo in;
+    in.id = 1;
+    in.role = Core::EndpointRole::RECEIVE;
+    in.local_port = port;
+    ASSERT_EQ(udp.open_endpoint(in), 1U);
+
+    Core::EndpointInfo out;
+    out.id = 2;
+    out.role = Core::EndpointRole::SEND;
+    out.remote_address = "127.0.0.1";
+    out.remote_port = port;
+    ASSERT_EQ(udp.open_endpoint(out), 2U);
+
+    std::thread io([&] { context.run(); });
+
+    auto sender = std::make_shared<Buffers::AudioSendProcessor>(
+        [&](ByteView bytes) { return udp.send(2, bytes.data(), bytes.size()); },
+        Buffers::AudioSendConfig { .format = AudioSampleFormat::PCM24 });
+
+    auto source = std::make_shared<Buffers::AudioBuffer>(0, 128);
+    source->resize(128);
+
+    uint64_t n = 0;
+    for (int cycle = 0; cycle < 20; ++cycle) {
+        for (double& x : source->get_data()) {
+            x = sine(n++);
+        }
+        sender->process(source);
+    }
+    ASSERT_EQ(sender->get_packets_sent(), 40U);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (receiver->get_stats().packets_received < 40 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    double energy = 0.0;
+    for (int cycle = 0; cycle < 16; ++cycle) {
+        receiver->process_default();
+        for (double x : receiver->get_data()) {
+            energy += x * x;
+        }
+    }
+
+    guard.reset();
+    udp.shutdown();
+    context.stop();
+    io.join();
+
+    const auto stats = receiver->get_stats();
+    EXPECT_EQ(stats.packets_received, 40U);
+    EXPECT_EQ(stats.packets_lost, 0U);
+    EXPECT_GT(energy, 1.0);
+    EXPECT_GE(stats.transit_ms, 0.0);
+    EXPECT_LT(stats.transit_ms, 50.0);
+}
+
+} // namespace MayaFlux::Test
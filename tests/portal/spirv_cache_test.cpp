@@ -0,0 +1,234 @@
+#include "gtest/gtest.h"
+
+#include "MayaFlux/Portal/Graphics/SpirvCache.hpp"
+
+#include <fstream>
+
+using namespace MayaFlux::Portal::Graphics;
+
+namespace MayaFlux::Test {
+
+class SpirvCacheTest : public ::testing::Test {
+protected:
+    std::filesystem::path root;
+    std::atomic<int> compile_calls { 0 };
+
+    void SetUp() override
+    {
+        root = std::filesystem::temp_directory_path()
+            / ("mf_spirv_cache_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed())
+                + "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+        std::filesystem::remove_all(root);
+        std::filesystem::create_directories(root / "include");
+    }
+
+    void TearDown() override
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(root, ec);
+    }
+
+    /// Deterministic stand-in for shaderc: SPIR-V magic followed by a digest of the source.
+    SpirvCache::Compiler fake_compiler()
+    {
+        return [this](const SpirvCompileJob& job) -> std::vector<uint32_t> {
+            ++compile_calls;
+            if (job.source.find("error") != std::string::npos) {
+                return {};
+            }
+            std::vector<uint32_t> words { 0x07230203, 0x00010600, static_cast<uint32_t>(job.source.size()) };
+            for (char c : job.source) {
+                words.push_back(static_cast<uint32_t>(c));
+            }
+            return words;
+        };
+    }
+
+    void write_file(const std::filesystem::path& path, const std::string& text)
+    {
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+        f << text;
+    }
+
+    SpirvCompileJob glsl_job(const std::string& source)
+    {
+        SpirvCompileJob job;
+        job.source = source;
+        job.include_directories = { (root / "include").string() };
+        return job;
+    }
+};
+
+TEST_F(SpirvCacheTest, SecondInstanceHitsDisk)
+{
+    const auto job = glsl_job("#version 460\nvoid main() {}\n");
+
+    std::vector<uint32_t> first;
+    {
+        SpirvCache cache(fake_compiler(), "test", root / "cache");
+        first = cache.get_or_compile(job);
+        EXPECT_EQ(cache.stats().misses, 1U);
+        EXPECT_EQ(cache.stats().writes, 1U);
+    }
+
+    SpirvCache cache(fake_compiler(), "test", root / "cache");
+    auto second = cache.get_or_compile(job);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(compile_calls.load(), 1);
+    EXPECT_EQ(cache.stats().hits, 1U);
+    EXPECT_EQ(cache.stats().misses, 0U);
+}
+
+TEST_F(SpirvCacheTest, KeyCoversDefinesStageAndFingerprint)
+{
+    SpirvCache cache(fake_compiler(), "test");
+    SpirvCache other_compiler(fake_compiler(), "test-v2");
+
+    auto job = glsl_job("#version 460\nvoid main() {}\n");
+    const auto base = cache.make_key(job);
+
+    EXPECT_EQ(base.size(), 32U);
+    EXPECT_EQ(base, cache.make_key(job));
+    EXPECT_NE(base, other_compiler.make_key(job));
+
+    auto staged = job;
+    staged.stage = ShaderStage::FRAGMENT;
+    EXPECT_NE(base, cache.make_key(staged));
+
+    auto defined = job;
+    defined.defines["USE_FAST_PATH"] = "1";
+    EXPECT_NE(base, cache.make_key(defined));
+
+    auto redefined = defined;
+    redefined.defines["USE_FAST_PATH"] = "0";
+    EXPECT_NE(cache.make_key(defined), cache.make_key(redefined));
+
+    auto renamed = job;
+    renamed.name = "shaders/other.comp";
+    EXPECT_EQ(base, cache.make_key(renamed));
+}
+
+TEST_F(SpirvCacheTest, KeyFollowsIncludeClosure)
+{
+    write_file(root / "include" / "outer.glsl", "#include \"inner.glsl\"\nfloat outer() { return inner(); }\n");
+    write_file(root / "include" / "inner.glsl", "float inner() { return 1.0; }\n");
+
+    SpirvCache cache(fake_compiler(), "test", root / "cache");
+    const auto job = glsl_job("#version 460\n  #  include \"outer.glsl\"\nvoid main() {}\n");
+
+    const auto before = cache.make_key(job);
+    cache.get_or_compile(job);
+
+    write_file(root / "include" / "inner.glsl", "float inner() { return 2.0; }\n");
+    const auto after = cache.make_key(job);
+    EXPECT_NE(before, after);
+
+    cache.get_or_compile(job);
+    EXPECT_EQ(cache.stats().misses, 2U);
+    EXPECT_EQ(compile_calls.load(), 2);
+}
+
+TEST_F(SpirvCacheTest, CorruptEntryIsRecompiled)
+{
+    const auto job = glsl_job("#version 460\nvoid main() {}\n");
+    SpirvCache cache(fake_compiler(), "test", root / "cache");
+
+    const auto expected = cache.get_or_compile(job);
+    const auto entry = root / "cache" / (cache.make_key(job) + ".spv");
+    ASSERT_TRUE(std::filesystem::exists(entry));
+
+    {
+        std::fstream f(entry, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(-1, std::ios::end);
+        f.put('\x7f');
+    }
+
+    EXPECT_EQ(cache.get_or_compile(job), expected);
+    EXPECT_EQ(cache.stats().corrupt, 1U);
+    EXPECT_EQ(compile_calls.load(), 2);
+}
+
+TEST_F(SpirvCacheTest, OversizedWordCountIsAMiss)
+{
+    const auto job = glsl_job("#version 460\nvoid main() {}\n");
+    SpirvCache cache(fake_compiler(), "test", root / "cache");
+
+    const auto expected = cache.get_or_compile(job);
+    const auto entry = root / "cache" / (cache.make_key(job) + ".spv");
+    ASSERT_TRUE(std::filesystem::exists(entry));
+
+    {
+        // word_count is the third header field.
+        std::fstream f(entry, std::ios::in | std::ios::out | std::ios::binary);
+        f.seekp(8);
+        const uint32_t huge = 0xFFFFFFF0U;
+        f.write(reinterpret_cast<const char*>(&huge), sizeof(huge));
+    }
+
+    EXPECT_EQ(cache.get_or_compile(job), expected);
+    EXPECT_EQ(cache.stats().corrupt, 1U);
+    EXPECT_EQ(compile_calls.load(), 2);
+}
+
+TEST_F(SpirvCacheTest, FailuresAreNotPersisted)
+{
+    SpirvCache cache(fake_compiler(), "test", root / "cache");
+    const auto job = glsl_job("#version 460\nerror\n");
+
+    EXPECT_TRUE(cache.get_or_compile(job).empty());
+    EXPECT_TRUE(cache.get_or_compile(job).empty());
+    EXPECT_EQ(cache.stats().compile_failures, 2U);
+    EXPECT_EQ(cache.stats().writes, 0U);
+}
+
+TEST_F(SpirvCacheTest, BatchCompilesUniqueJobsInOrder)
+{
+    SpirvCache cache(fake_compiler(), "test", root / "cache");
+
+    std::vector<SpirvCompileJob> manifest;
+    for (int i = 0; i < 24; ++i) {
+        manifest.push_back(glsl_job("#version 460\n// variant " + std::to_string(i % 16) + "\nvoid main() {}\n"));
+    }
+    manifest[5].source = "error";
+
+    auto results = cache.compile_batch(manifest, 4);
+    ASSERT_EQ(results.size(), manifest.size());
+
+    for (size_t i = 0; i < manifest.size(); ++i) {
+        if (i == 5) {
+            EXPECT_TRUE(results[i].empty());
+            continue;
+        }
+        EXPECT_EQ(results[i], fake_compiler()(manifest[i])) << "entry " << i;
+    }
+    compile_calls = 0;
+
+    const auto cold = cache.stats();
+    EXPECT_EQ(cold.misses, 17U);
+    EXPECT_EQ(cold.hits, 0U);
+
+    cache.reset_stats();
+    auto warm = cache.compile_batch(manifest, 4);
+    EXPECT_EQ(warm, results);
+    EXPECT_EQ(cache.stats().hits, 16U);
+    EXPECT_EQ(cache.stats().misses, 1U);
+    EXPECT_EQ(compile_calls.load(), 1);
+
+    EXPECT_EQ(cache.purge(), 16U);
+}
+
+TEST_F(SpirvCacheTest, TransientCacheAlwaysCompiles)
+{
+    SpirvCache cache(fake_compiler(), "test");
+    const auto job = glsl_job("#version 460\nvoid main() {}\n");
+
+    EXPECT_FALSE(cache.is_persistent());
+    cache.get_or_compile(job);
+    cache.get_or_compile(job);
+    EXPECT_EQ(compile_calls.load(), 2);
+    EXPECT_EQ(cache.stats().hits, 0U);
+    EXPECT_EQ(cache.purge(), 0U);
+}
+
+} // namespace MayaFlux::Test